@@ -0,0 +1,22 @@
+// Benchmarks the collision broadphase against a brute-force scan (see
+// entitiesBenchmark in main/entities.h): the bullets of a step, as
+// points, against the full 5x11 formation of aliens, from a few bullets
+// to more than the game ever has in flight.
+
+#include "entities.h"
+
+
+#define ROWS                 (5)
+#define COLS                 (11)
+
+
+int main() {
+    bool ok = true;
+
+    const int bullets[] = { 8, 24, 48 };
+    for (int i = 0; i < sizeof(bullets) / sizeof(bullets[0]); i++) {
+        ok &= entitiesBenchmark(ROWS, COLS, bullets[i]);
+    }
+
+    return ok ? 0: 1;
+}
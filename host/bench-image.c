@@ -0,0 +1,19 @@
+// Benchmarks the per-line decode of the compiled full-screen images
+// against copying the same number of raw RGB565 pixels (see
+// imageBenchmark in main/image.h): the run-length coded background and
+// the quantized starfield.
+
+#include <stdio.h>
+
+#include "image.h"
+#include "images.h"
+
+
+int main() {
+    bool ok = true;
+
+    ok &= imageBenchmark(image_background, IMAGE_BACKGROUND_SIZE);
+    ok &= imageBenchmark(image_space, IMAGE_SPACE_SIZE);
+
+    return ok ? 0: 1;
+}
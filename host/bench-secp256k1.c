@@ -0,0 +1,24 @@
+// Benchmarks public key derivation and signing with the generated table
+// of the build's window (see secp256k1Benchmark in main/secp256k1.h),
+// checked against a known vector, e.g.
+//
+//   bench-secp256k1-4 [COUNT]
+//
+// On the device, the same benchmark is checked against ffx_ec_*.
+
+#include <stdlib.h>
+
+#include "secp256k1.h"
+
+
+// Keys derived and digests signed; the host is fast enough for more
+// than the device hook in main.c uses
+#define DEFAULT_COUNT        (64)
+
+
+int main(int argc, char **argv) {
+    uint32_t count = DEFAULT_COUNT;
+    if (argc > 1) { count = strtoul(argv[1], NULL, 10); }
+
+    return secp256k1Benchmark(count) ? 0: 1;
+}
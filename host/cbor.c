@@ -0,0 +1,345 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "firefly-cbor.h"
+
+
+typedef enum Major {
+    MajorUnsigned = 0,
+    MajorNegative,
+    MajorData,
+    MajorString,
+    MajorArray,
+    MajorMap,
+    MajorTag,
+    MajorSimple,
+} Major;
+
+// Items nested deeper than this are refused, rather than recursing on
+// whatever a client sends
+#define MAX_DEPTH            (16)
+
+
+/////////////////////////////
+// Reading
+
+typedef struct Head {
+    Major major;
+    uint64_t value;
+
+    // Offset of anything following the head (e.g. the bytes of data)
+    size_t offset;
+} Head;
+
+static FfxCborError readHead(const uint8_t *data, size_t length,
+  size_t offset, Head *head) {
+
+    if (offset >= length) { return FfxCborErrorOverrun; }
+
+    uint8_t byte = data[offset++];
+    head->major = byte >> 5;
+
+    uint8_t info = byte & 0x1f;
+    if (info < 24) {
+        head->value = info;
+        head->offset = offset;
+        return FfxCborErrorNone;
+    }
+
+    // Indefinite lengths (31) and the reserved values
+    if (info > 27) { return FfxCborErrorUnsupported; }
+
+    size_t size = 1 << (info - 24);
+    if (offset + size > length) { return FfxCborErrorOverrun; }
+
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++) { value = (value << 8) | data[offset++]; }
+
+    head->value = value;
+    head->offset = offset;
+
+    return FfxCborErrorNone;
+}
+
+// The offset just past the item at %offset%
+static FfxCborError skipItem(const uint8_t *data, size_t length,
+  size_t offset, size_t *next, int depth) {
+
+    if (depth == MAX_DEPTH) { return FfxCborErrorUnsupported; }
+
+    Head head;
+    FfxCborError error = readHead(data, length, offset, &head);
+    if (error) { return error; }
+
+    offset = head.offset;
+
+    uint64_t count = 0;
+    switch (head.major) {
+        case MajorData: case MajorString:
+            if (head.value > length - offset) { return FfxCborErrorOverrun; }
+            *next = offset + head.value;
+            return FfxCborErrorNone;
+        case MajorArray:
+            count = head.value;
+            break;
+        case MajorMap:
+            if (head.value > length) { return FfxCborErrorOverrun; }
+            count = 2 * head.value;
+            break;
+        case MajorTag:
+            count = 1;
+            break;
+        default:
+            // Numbers and simple values are only the head
+            *next = offset;
+            return FfxCborErrorNone;
+    }
+
+    // Each item is at least a byte, so a count past the end is short
+    if (count > length - offset) { return FfxCborErrorOverrun; }
+
+    for (uint64_t i = 0; i < count; i++) {
+        error = skipItem(data, length, offset, &offset, depth + 1);
+        if (error) { return error; }
+    }
+
+    *next = offset;
+
+    return FfxCborErrorNone;
+}
+
+FfxCborCursor ffx_cbor_walk(const uint8_t *data, size_t length) {
+    return (FfxCborCursor){ .data = data, .length = length, .offset = 0 };
+}
+
+FfxCborError ffx_cbor_followIndex(FfxCborCursor *cursor, size_t index) {
+    Head head;
+    FfxCborError error = readHead(cursor->data, cursor->length,
+      cursor->offset, &head);
+    if (error) { return error; }
+
+    // Map keys are every other item
+    size_t skip = index;
+    if (head.major == MajorMap) {
+        skip = 2 * index;
+    } else if (head.major != MajorArray) {
+        return FfxCborErrorType;
+    }
+
+    if (index >= head.value) { return FfxCborErrorNotFound; }
+
+    size_t offset = head.offset;
+    for (size_t i = 0; i < skip; i++) {
+        error = skipItem(cursor->data, cursor->length, offset, &offset, 0);
+        if (error) { return error; }
+    }
+
+    // The entry itself must be complete
+    size_t next = 0;
+    error = skipItem(cursor->data, cursor->length, offset, &next, 0);
+    if (error) { return error; }
+
+    cursor->offset = offset;
+
+    return FfxCborErrorNone;
+}
+
+FfxCborError ffx_cbor_getLength(FfxCborCursor cursor, size_t *length) {
+    Head head;
+    FfxCborError error = readHead(cursor.data, cursor.length, cursor.offset,
+      &head);
+    if (error) { return error; }
+
+    switch (head.major) {
+        case MajorData: case MajorString: case MajorArray: case MajorMap:
+            *length = head.value;
+            return FfxCborErrorNone;
+        default:
+            break;
+    }
+
+    return FfxCborErrorType;
+}
+
+FfxCborError ffx_cbor_getValue(FfxCborCursor cursor, uint64_t *value) {
+    Head head;
+    FfxCborError error = readHead(cursor.data, cursor.length, cursor.offset,
+      &head);
+    if (error) { return error; }
+
+    if (head.major != MajorUnsigned) { return FfxCborErrorType; }
+
+    *value = head.value;
+
+    return FfxCborErrorNone;
+}
+
+FfxCborError ffx_cbor_getData(FfxCborCursor cursor, const uint8_t **data,
+  size_t *length) {
+
+    Head head;
+    FfxCborError error = readHead(cursor.data, cursor.length, cursor.offset,
+      &head);
+    if (error) { return error; }
+
+    if (head.major != MajorData && head.major != MajorString) {
+        return FfxCborErrorType;
+    }
+    if (head.value > cursor.length - head.offset) {
+        return FfxCborErrorOverrun;
+    }
+
+    *data = &cursor.data[head.offset];
+    *length = head.value;
+
+    return FfxCborErrorNone;
+}
+
+static FfxCborError dumpItem(const uint8_t *data, size_t length,
+  size_t offset, size_t *next, int depth) {
+
+    if (depth == MAX_DEPTH) { return FfxCborErrorUnsupported; }
+
+    Head head;
+    FfxCborError error = readHead(data, length, offset, &head);
+    if (error) { return error; }
+
+    offset = head.offset;
+
+    switch (head.major) {
+        case MajorUnsigned:
+            printf("%llu", (unsigned long long)head.value);
+            break;
+        case MajorNegative:
+            printf("-%llu", (unsigned long long)head.value + 1);
+            break;
+        case MajorData: case MajorString:
+            if (head.value > length - offset) { return FfxCborErrorOverrun; }
+            if (head.major == MajorString) {
+                printf("\"%.*s\"", (int)head.value, &data[offset]);
+            } else {
+                printf("h\"");
+                for (size_t i = 0; i < head.value; i++) {
+                    printf("%02x", data[offset + i]);
+                }
+                printf("\"");
+            }
+            offset += head.value;
+            break;
+        case MajorArray: case MajorMap:
+            if (head.value > length - offset) { return FfxCborErrorOverrun; }
+            printf((head.major == MajorArray) ? "[": "{");
+            for (uint64_t i = 0; i < head.value; i++) {
+                if (i) { printf(","); }
+                error = dumpItem(data, length, offset, &offset, depth + 1);
+                if (error) { return error; }
+                if (head.major == MajorMap) {
+                    printf(":");
+                    error = dumpItem(data, length, offset, &offset,
+                      depth + 1);
+                    if (error) { return error; }
+                }
+            }
+            printf((head.major == MajorArray) ? "]": "}");
+            break;
+        case MajorTag:
+            printf("%llu(", (unsigned long long)head.value);
+            error = dumpItem(data, length, offset, &offset, depth + 1);
+            if (error) { return error; }
+            printf(")");
+            break;
+        default:
+            if (head.value == 20) {
+                printf("false");
+            } else if (head.value == 21) {
+                printf("true");
+            } else if (head.value == 22) {
+                printf("null");
+            } else {
+                printf("simple(%llu)", (unsigned long long)head.value);
+            }
+            break;
+    }
+
+    *next = offset;
+
+    return FfxCborErrorNone;
+}
+
+void ffx_cbor_dump(FfxCborCursor cursor) {
+    size_t next = 0;
+    if (dumpItem(cursor.data, cursor.length, cursor.offset, &next, 0)) {
+        printf("<invalid>");
+    }
+    printf("\n");
+}
+
+
+/////////////////////////////
+// Building
+
+FfxCborBuilder ffx_cbor_build(uint8_t *data, size_t length) {
+    return (FfxCborBuilder){ .data = data, .length = length };
+}
+
+size_t ffx_cbor_getBuildLength(FfxCborBuilder *builder) {
+    return builder->offset;
+}
+
+// The head, then %length% bytes of %data% (if any)
+static bool append(FfxCborBuilder *builder, Major major, uint64_t value,
+  const uint8_t *data, size_t length) {
+
+    if (builder->overflow) { return false; }
+
+    uint8_t head[9];
+    size_t size = 0;
+    if (value < 24) {
+        head[size++] = (major << 5) | value;
+    } else {
+        // Followed by 1, 2, 4 or 8 bytes
+        uint8_t info = (value < 0x100) ? 24: (value < 0x10000) ? 25:
+          (value < 0x100000000) ? 26: 27;
+        head[size++] = (major << 5) | info;
+        for (int i = (1 << (info - 24)) - 1; i >= 0; i--) {
+            head[size++] = value >> (8 * i);
+        }
+    }
+
+    if (size + length > builder->length - builder->offset) {
+        builder->overflow = true;
+        return false;
+    }
+
+    memcpy(&builder->data[builder->offset], head, size);
+    builder->offset += size;
+
+    if (length) {
+        memcpy(&builder->data[builder->offset], data, length);
+        builder->offset += length;
+    }
+
+    return true;
+}
+
+bool ffx_cbor_appendNumber(FfxCborBuilder *builder, uint64_t value) {
+    return append(builder, MajorUnsigned, value, NULL, 0);
+}
+
+bool ffx_cbor_appendData(FfxCborBuilder *builder, const uint8_t *data,
+  size_t length) {
+    return append(builder, MajorData, length, data, length);
+}
+
+bool ffx_cbor_appendString(FfxCborBuilder *builder, const char *str) {
+    size_t length = strlen(str);
+    return append(builder, MajorString, length, (const uint8_t*)str, length);
+}
+
+bool ffx_cbor_appendArray(FfxCborBuilder *builder, size_t count) {
+    return append(builder, MajorArray, count, NULL, 0);
+}
+
+bool ffx_cbor_appendMap(FfxCborBuilder *builder, size_t count) {
+    return append(builder, MajorMap, count, NULL, 0);
+}
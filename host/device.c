@@ -0,0 +1,145 @@
+// Host port of the device keys and addresses (firefly-hollows,
+// firefly-ecc and firefly-address), for running main/requests.c in
+// pixie-dispatch. The keys are fixed test keys, derived from the account
+// index, so accounts are repeatable (and worthless).
+
+#include <stdio.h>
+#include <string.h>
+
+#include "firefly-address.h"
+#include "firefly-ecc.h"
+#include "firefly-hollows.h"
+
+#include "secp256k1.h"
+
+
+/////////////////////////////
+// keccak256 (the original padding, as Ethereum uses, not SHA3)
+
+#define KECCAK_RATE          (136)
+
+static const uint64_t roundConstants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a,
+    0x8000000080008000, 0x000000000000808b, 0x0000000080000001,
+    0x8000000080008081, 0x8000000000008009, 0x000000000000008a,
+    0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+    0x000000000000800a, 0x800000008000000a, 0x8000000080008081,
+    0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+};
+
+// Rotation of each lane, and the lane each moves to, in pi order
+static const uint8_t rotations[24] = {
+    1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+    27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44,
+};
+
+static const uint8_t lanes[24] = {
+    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+    15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1,
+};
+
+static uint64_t rotl(uint64_t value, int shift) {
+    return (value << shift) | (value >> (64 - shift));
+}
+
+static void keccakF(uint64_t *state) {
+    for (int round = 0; round < 24; round++) {
+        // Theta
+        uint64_t c[5];
+        for (int x = 0; x < 5; x++) {
+            c[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^
+              state[x + 20];
+        }
+        for (int x = 0; x < 5; x++) {
+            uint64_t d = c[(x + 4) % 5] ^ rotl(c[(x + 1) % 5], 1);
+            for (int y = 0; y < 25; y += 5) { state[y + x] ^= d; }
+        }
+
+        // Rho and pi
+        uint64_t lane = state[1];
+        for (int i = 0; i < 24; i++) {
+            uint64_t next = state[lanes[i]];
+            state[lanes[i]] = rotl(lane, rotations[i]);
+            lane = next;
+        }
+
+        // Chi
+        for (int y = 0; y < 25; y += 5) {
+            for (int x = 0; x < 5; x++) { c[x] = state[y + x]; }
+            for (int x = 0; x < 5; x++) {
+                state[y + x] = c[x] ^ (~c[(x + 1) % 5] & c[(x + 2) % 5]);
+            }
+        }
+
+        // Iota
+        state[0] ^= roundConstants[round];
+    }
+}
+
+static void keccak256(uint8_t *digest, const uint8_t *data, size_t length) {
+    uint64_t state[25] = { 0 };
+
+    // Absorb, with the final (padded) block always present
+    uint8_t block[KECCAK_RATE];
+    while (1) {
+        size_t count = (length < KECCAK_RATE) ? length: KECCAK_RATE;
+        memset(block, 0, sizeof(block));
+        memcpy(block, data, count);
+
+        bool last = (count < KECCAK_RATE);
+        if (last) {
+            block[count] ^= 0x01;
+            block[KECCAK_RATE - 1] ^= 0x80;
+        }
+
+        for (int i = 0; i < KECCAK_RATE / 8; i++) {
+            uint64_t word = 0;
+            for (int j = 7; j >= 0; j--) {
+                word = (word << 8) | block[8 * i + j];
+            }
+            state[i] ^= word;
+        }
+        keccakF(state);
+
+        if (last) { break; }
+        data += count;
+        length -= count;
+    }
+
+    for (int i = 0; i < 32; i++) { digest[i] = state[i / 8] >> (8 * (i % 8)); }
+}
+
+
+/////////////////////////////
+// API
+
+bool ffx_deviceTestPrivkey(FfxEcPrivkey *privkey, uint32_t index) {
+    char seed[32];
+    snprintf(seed, sizeof(seed), "pixie-host test key %ld", (long)index);
+    keccak256(privkey->data, (const uint8_t*)seed, strlen(seed));
+    return true;
+}
+
+bool ffx_ec_computePubkey(FfxEcPubkey *pubkey, const FfxEcPrivkey *privkey) {
+    return secp256k1ComputePubkey(pubkey->data, privkey->data);
+}
+
+FfxAddress ffx_eth_getAddress(const FfxEcPubkey *pubkey) {
+    uint8_t digest[32];
+    keccak256(digest, &pubkey->data[1], sizeof(pubkey->data) - 1);
+
+    FfxAddress address;
+    memcpy(address.data, &digest[12], sizeof(address.data));
+    return address;
+}
+
+void ffx_sendReply(uint32_t id, FfxCborBuilder *reply) {
+    printf("[host] no radio; reply dropped: id=%ld\n", (long)id);
+}
+
+void ffx_sendErrorReply(uint32_t id, uint32_t code, const char *message) {
+    printf("[host] no radio; error dropped: id=%ld code=%ld\n", (long)id,
+      (long)code);
+}
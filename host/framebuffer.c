@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "framebuffer.h"
+#include "profiler.h"
+
+
+#define ROW_SIZE             (1 + 3 * FRAMEBUFFER_WIDTH)
+
+// Stored (uncompressed) deflate blocks are at most this long
+#define BLOCK_MAX            (0xffff)
+
+
+void framebufferInit(Framebuffer *framebuffer) {
+    memset(framebuffer, 0, sizeof(Framebuffer));
+}
+
+void framebufferWriteFragment(Framebuffer *framebuffer, uint32_t y,
+  const uint16_t *fragment, uint32_t height) {
+
+    if (y >= FRAMEBUFFER_HEIGHT) { return; }
+    if (y + height > FRAMEBUFFER_HEIGHT) { height = FRAMEBUFFER_HEIGHT - y; }
+
+    // Stands in for the SPI transfer
+    PROFILE_BEGIN(t0);
+
+    uint16_t *pixels = &framebuffer->pixels[y * FRAMEBUFFER_WIDTH];
+    size_t count = height * FRAMEBUFFER_WIDTH;
+
+    for (size_t i = 0; i < count; i++) {
+        uint16_t pixel = fragment[i];
+        if (FRAMEBUFFER_SWAP_BYTES) {
+            pixel = (pixel >> 8) | (pixel << 8);
+        }
+        pixels[i] = pixel;
+    }
+
+    framebuffer->rows += height;
+
+    PROFILE_END(t0, ProfilerKindTransfer,
+      y * PROFILER_FRAGMENTS / FRAMEBUFFER_HEIGHT, count);
+}
+
+uint32_t framebufferEndFrame(Framebuffer *framebuffer) {
+    uint32_t rows = framebuffer->rows;
+    framebuffer->rows = 0;
+    framebuffer->frames++;
+    return rows;
+}
+
+
+/////////////////////////////
+// PNG
+
+static uint32_t crcTable[256] = { 0 };
+
+static uint32_t updateCrc(uint32_t crc, const uint8_t *data, size_t length) {
+    if (crcTable[1] == 0) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? (0xedb88320 ^ (c >> 1)): (c >> 1);
+            }
+            crcTable[n] = c;
+        }
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        crc = crcTable[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static void writeUint32(uint8_t *data, uint32_t value) {
+    data[0] = value >> 24;
+    data[1] = value >> 16;
+    data[2] = value >> 8;
+    data[3] = value;
+}
+
+// A chunk is written in parts, so the image data need not be buffered
+typedef struct Chunk {
+    FILE *fp;
+    uint32_t crc;
+} Chunk;
+
+static void beginChunk(Chunk *chunk, FILE *fp, const char *type,
+  uint32_t length) {
+
+    uint8_t header[8];
+    writeUint32(header, length);
+    memcpy(&header[4], type, 4);
+    fwrite(header, 1, 8, fp);
+
+    chunk->fp = fp;
+    chunk->crc = updateCrc(0xffffffff, &header[4], 4);
+}
+
+static void writeChunk(Chunk *chunk, const uint8_t *data, size_t length) {
+    fwrite(data, 1, length, chunk->fp);
+    chunk->crc = updateCrc(chunk->crc, data, length);
+}
+
+static void endChunk(Chunk *chunk) {
+    uint8_t crc[4];
+    writeUint32(crc, chunk->crc ^ 0xffffffff);
+    fwrite(crc, 1, 4, chunk->fp);
+}
+
+static void getRow(Framebuffer *framebuffer, uint32_t y, uint8_t *row) {
+    const uint16_t *pixels = &framebuffer->pixels[y * FRAMEBUFFER_WIDTH];
+
+    // No filter
+    *row++ = 0;
+
+    for (int x = 0; x < FRAMEBUFFER_WIDTH; x++) {
+        uint16_t pixel = pixels[x];
+        uint8_t r = (pixel >> 11) & 0x1f, g = (pixel >> 5) & 0x3f;
+        uint8_t b = pixel & 0x1f;
+        *row++ = (r << 3) | (r >> 2);
+        *row++ = (g << 2) | (g >> 4);
+        *row++ = (b << 3) | (b >> 2);
+    }
+}
+
+bool framebufferWritePng(Framebuffer *framebuffer, const char *path) {
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) { return false; }
+
+    static const uint8_t signature[] = {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'
+    };
+    fwrite(signature, 1, sizeof(signature), fp);
+
+    Chunk chunk;
+
+    // 8-bit RGB, no interlace
+    uint8_t header[13] = { 0 };
+    writeUint32(&header[0], FRAMEBUFFER_WIDTH);
+    writeUint32(&header[4], FRAMEBUFFER_HEIGHT);
+    header[8] = 8;
+    header[9] = 2;
+    beginChunk(&chunk, fp, "IHDR", sizeof(header));
+    writeChunk(&chunk, header, sizeof(header));
+    endChunk(&chunk);
+
+    // A zlib stream of stored blocks; larger than compressed, but needs
+    // no dependencies and the frames are small
+    size_t length = ROW_SIZE * FRAMEBUFFER_HEIGHT;
+    size_t blocks = (length + BLOCK_MAX - 1) / BLOCK_MAX;
+    beginChunk(&chunk, fp, "IDAT", 2 + 5 * blocks + length + 4);
+
+    static const uint8_t zlibHeader[] = { 0x78, 0x01 };
+    writeChunk(&chunk, zlibHeader, sizeof(zlibHeader));
+
+    uint32_t adlerA = 1, adlerB = 0;
+
+    uint8_t row[ROW_SIZE];
+    size_t rowOffset = ROW_SIZE;
+    uint32_t y = 0;
+
+    for (size_t offset = 0; offset < length; offset += BLOCK_MAX) {
+        size_t blockLength = length - offset;
+        if (blockLength > BLOCK_MAX) { blockLength = BLOCK_MAX; }
+
+        uint8_t blockHeader[5];
+        blockHeader[0] = (offset + blockLength == length) ? 1: 0;
+        blockHeader[1] = blockLength;
+        blockHeader[2] = blockLength >> 8;
+        blockHeader[3] = ~blockLength;
+        blockHeader[4] = (~blockLength) >> 8;
+        writeChunk(&chunk, blockHeader, sizeof(blockHeader));
+
+        // Rows span blocks
+        while (blockLength) {
+            if (rowOffset == ROW_SIZE) {
+                getRow(framebuffer, y++, row);
+                rowOffset = 0;
+            }
+
+            size_t count = ROW_SIZE - rowOffset;
+            if (count > blockLength) { count = blockLength; }
+
+            writeChunk(&chunk, &row[rowOffset], count);
+            for (size_t i = 0; i < count; i++) {
+                adlerA = (adlerA + row[rowOffset + i]) % 65521;
+                adlerB = (adlerB + adlerA) % 65521;
+            }
+
+            rowOffset += count;
+            blockLength -= count;
+        }
+    }
+
+    uint8_t adler[4];
+    writeUint32(adler, (adlerB << 16) | adlerA);
+    writeChunk(&chunk, adler, sizeof(adler));
+    endChunk(&chunk);
+
+    beginChunk(&chunk, fp, "IEND", 0);
+    endChunk(&chunk);
+
+    return (fclose(fp) == 0);
+}
@@ -0,0 +1,55 @@
+#ifndef __FRAMEBUFFER_H__
+#define __FRAMEBUFFER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// A headless stand-in for the display, for host builds: the scene is
+// rendered into memory, fragment by fragment as it would be sent over
+// SPI, and frames can be written out as PNG (e.g. for golden images).
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define FRAMEBUFFER_WIDTH        (240)
+#define FRAMEBUFFER_HEIGHT       (240)
+
+// Fragments hold big-endian pixels, as sent to the display
+#ifndef FRAMEBUFFER_SWAP_BYTES
+#define FRAMEBUFFER_SWAP_BYTES   (1)
+#endif
+
+
+typedef struct Framebuffer {
+    // RGB565, in native byte order
+    uint16_t pixels[FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT];
+
+    uint32_t frames;
+
+    // Rows written since the last frame; as on the device, only the
+    // rows of the damaged area are rendered
+    uint32_t rows;
+} Framebuffer;
+
+
+void framebufferInit(Framebuffer *framebuffer);
+
+// Copy a rendered fragment of %height% rows starting at row %y%
+void framebufferWriteFragment(Framebuffer *framebuffer, uint32_t y,
+  const uint16_t *fragment, uint32_t height);
+
+// Mark the end of a frame; returns the rows written during it
+uint32_t framebufferEndFrame(Framebuffer *framebuffer);
+
+// Write the current contents to %path% as an RGB PNG; false on error
+bool framebufferWritePng(Framebuffer *framebuffer, const char *path);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FRAMEBUFFER_H__ */
@@ -0,0 +1,290 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "firefly-hollows.h"
+#include "firefly-scene.h"
+
+#include "framebuffer.h"
+#include "key-script.h"
+
+
+// Rows rendered at a time, as the display is sent fragments
+#define FRAGMENT_HEIGHT      (24)
+
+
+typedef struct Handler {
+    FfxEventFunc func;
+    void *arg;
+} Handler;
+
+typedef struct Panel {
+    FfxNode node;
+    void *state;
+
+    Handler handlers[FfxEventCount];
+
+    bool focused;
+
+    bool done;
+    int result;
+
+    struct Panel *parent;
+} Panel;
+
+typedef struct Host {
+    FfxScene scene;
+    FfxNode root;
+
+    // The top of the panel stack
+    Panel *panel;
+
+    // Simulated; each frame advances it by the interval
+    uint32_t now;
+    uint32_t interval;
+
+    KeyScript script;
+    FfxKeys keys;
+    bool quit;
+
+    Framebuffer framebuffer;
+    uint16_t fragment[FRAMEBUFFER_WIDTH * FRAGMENT_HEIGHT];
+
+    uint32_t writes;
+
+    // Skip the fragments outside the damage a panel sets
+    bool useDamage;
+    uint32_t fragments;
+} Host;
+
+static Host *host = NULL;
+
+
+/////////////////////////////
+// FreeRTOS shims
+
+TickType_t xTaskGetTickCount() {
+    return host ? host->now: 0;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    if (host) { host->now += ticks; }
+}
+
+void vTaskGetInfo(TaskHandle_t task, TaskStatus_t *status,
+  BaseType_t getHighWater, eTaskState state) {
+    status->pcTaskName = "host";
+}
+
+
+/////////////////////////////
+// Events
+
+static void emit(Panel *panel, FfxEvent event, FfxEventProps props) {
+    Handler *handler = &panel->handlers[event];
+    if (handler->func == NULL) { return; }
+    handler->func(event, props, handler->arg);
+}
+
+bool ffx_onEvent(FfxEvent event, FfxEventFunc func, void *arg) {
+    if (host == NULL || host->panel == NULL || event >= FfxEventCount) {
+        return false;
+    }
+
+    Handler *handler = &host->panel->handlers[event];
+    handler->func = func;
+    handler->arg = arg;
+
+    return true;
+}
+
+// Undamaged fragments are neither rendered nor sent, so the framebuffer
+// keeps them from the previous frame, as the display would
+static void render() {
+    Framebuffer *framebuffer = &host->framebuffer;
+
+    for (uint32_t y = 0; y < FRAMEBUFFER_HEIGHT; y += FRAGMENT_HEIGHT) {
+        if (host->useDamage &&
+          !ffx_scene_isDamaged(host->scene, y, FRAGMENT_HEIGHT)) {
+            continue;
+        }
+
+        ffx_scene_render(host->scene, host->root, host->fragment, y,
+          FRAGMENT_HEIGHT);
+        framebufferWriteFragment(framebuffer, y, host->fragment,
+          FRAGMENT_HEIGHT);
+        host->fragments++;
+    }
+
+    ffx_scene_endFrame(host->scene);
+    framebufferEndFrame(framebuffer);
+}
+
+// Run the script steps due; stops early if %panel% pops
+static void runScript(Panel *panel) {
+    KeyScriptStep step;
+    while (!panel->done && !host->quit &&
+      keyScriptNext(&host->script, host->now, &step)) {
+
+        switch (step.action) {
+            case KeyScriptActionKeys: {
+                FfxEventProps props = { 0 };
+                props.keys.down = step.keys;
+                props.keys.changed = step.keys ^ host->keys;
+                host->keys = step.keys;
+                if (props.keys.changed) {
+                    emit(panel, FfxEventKeys, props);
+                }
+                break;
+            }
+
+            case KeyScriptActionFrame:
+                if (framebufferWritePng(&host->framebuffer, step.path)) {
+                    host->writes++;
+                } else {
+                    printf("[hollows] could not write frame: %s\n",
+                      step.path);
+                }
+                break;
+
+            case KeyScriptActionQuit:
+                host->quit = true;
+                break;
+        }
+    }
+}
+
+// Run frames of %panel% until it pops or the script quits; keys
+// delivered may push (and run) panels over it
+static void runPanel(Panel *panel) {
+    while (!panel->done && !host->quit) {
+        if (!panel->focused) {
+            panel->focused = true;
+            emit(panel, FfxEventFocus, (FfxEventProps){ 0 });
+            if (panel->done) { break; }
+        }
+
+        FfxEventProps props = { 0 };
+        props.render.ticks = host->now;
+        emit(panel, FfxEventRenderScene, props);
+        if (panel->done) { break; }
+
+        ffx_scene_sequence(host->scene, host->now);
+        render();
+
+        // Frame steps write what is on screen at their time
+        runScript(panel);
+
+        host->now += host->interval;
+    }
+}
+
+
+/////////////////////////////
+// Panels
+
+int ffx_pushPanel(FfxPanelInitFunc initFunc, size_t stateSize,
+  FfxPanelStyle style, void *arg) {
+
+    if (host == NULL || host->quit) { return -1; }
+
+    Panel *panel = calloc(1, sizeof(Panel));
+    assert(panel);
+
+    panel->state = calloc(1, stateSize ? stateSize: 1);
+    assert(panel->state);
+
+    panel->node = ffx_scene_createGroup(host->scene);
+    ffx_sceneGroup_appendChild(host->root, panel->node);
+
+    Panel *parent = host->panel;
+    if (parent) { ffx_sceneNode_setHidden(parent->node, true); }
+
+    panel->parent = parent;
+    host->panel = panel;
+
+    int status = initFunc(host->scene, panel->node, panel->state, arg);
+    if (status == 0) {
+        runPanel(panel);
+    } else {
+        printf("[hollows] panel init failed: status=%d\n", status);
+        panel->result = -1;
+    }
+
+    int result = (panel->done) ? panel->result: -1;
+
+    host->panel = parent;
+    if (parent) {
+        ffx_sceneNode_setHidden(parent->node, false);
+        parent->focused = false;
+    }
+
+    ffx_sceneNode_free(panel->node);
+    free(panel->state);
+    free(panel);
+
+    return result;
+}
+
+void ffx_popPanel(int result) {
+    if (host == NULL || host->panel == NULL) { return; }
+    host->panel->done = true;
+    host->panel->result = result;
+}
+
+
+/////////////////////////////
+// Host
+
+bool ffx_hostInit(const char *path, uint32_t interval) {
+    if (host) { ffx_hostFree(); }
+
+    host = calloc(1, sizeof(Host));
+    assert(host);
+
+    if (!keyScriptOpen(&host->script, path)) {
+        printf("[hollows] could not read script: %s\n", path);
+        free(host);
+        host = NULL;
+        return false;
+    }
+
+    host->interval = interval ? interval: 1;
+    host->useDamage = true;
+
+    host->scene = ffx_scene_init();
+    host->root = ffx_scene_createGroup(host->scene);
+
+    framebufferInit(&host->framebuffer);
+
+    return true;
+}
+
+uint32_t ffx_hostGetFrames() {
+    return host ? host->framebuffer.frames: 0;
+}
+
+uint32_t ffx_hostGetWrites() {
+    return host ? host->writes: 0;
+}
+
+void ffx_hostSetDamage(bool enabled) {
+    if (host) { host->useDamage = enabled; }
+}
+
+uint32_t ffx_hostGetFragments() {
+    return host ? host->fragments: 0;
+}
+
+void ffx_hostFree() {
+    if (host == NULL) { return; }
+
+    keyScriptClose(&host->script);
+    ffx_sceneNode_free(host->root);
+    ffx_scene_free(host->scene);
+    free(host);
+    host = NULL;
+}
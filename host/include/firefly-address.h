@@ -0,0 +1,29 @@
+#ifndef __FIREFLY_ADDRESS_H__
+#define __FIREFLY_ADDRESS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Host port of firefly-address: Ethereum addresses from public keys
+// (see host/device.c)
+
+#include <stdint.h>
+
+#include "firefly-ecc.h"
+
+
+typedef struct FfxAddress {
+    uint8_t data[20];
+} FfxAddress;
+
+
+// The last 20 bytes of the keccak256 of the (x, y) of %pubkey%
+FfxAddress ffx_eth_getAddress(const FfxEcPubkey *pubkey);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FIREFLY_ADDRESS_H__ */
@@ -0,0 +1,86 @@
+#ifndef __FIREFLY_CBOR_H__
+#define __FIREFLY_CBOR_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Host port of firefly-cbor: the subset main/requests.c uses to read
+// messages and build replies (see host/cbor.c). Only definite lengths
+// are supported, which is all the clients send.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+typedef enum FfxCborError {
+    FfxCborErrorNone          = 0,
+    FfxCborErrorOverrun,
+    FfxCborErrorUnsupported,
+    FfxCborErrorType,
+    FfxCborErrorNotFound,
+} FfxCborError;
+
+typedef struct FfxCborCursor {
+    const uint8_t *data;
+    size_t length;
+    size_t offset;
+} FfxCborCursor;
+
+typedef struct FfxCborBuilder {
+    uint8_t *data;
+    size_t length;
+    size_t offset;
+
+    // Set once an append did not fit; nothing more is appended
+    bool overflow;
+} FfxCborBuilder;
+
+
+/////////////////////////////
+// Reading
+
+FfxCborCursor ffx_cbor_walk(const uint8_t *data, size_t length);
+
+// Move %cursor% to entry %index% of the array (or the key %index% of the
+// map) it is at
+FfxCborError ffx_cbor_followIndex(FfxCborCursor *cursor, size_t index);
+
+// Array entries, map pairs, or data (or string) bytes
+FfxCborError ffx_cbor_getLength(FfxCborCursor cursor, size_t *length);
+
+// An unsigned number
+FfxCborError ffx_cbor_getValue(FfxCborCursor cursor, uint64_t *value);
+
+// Data or a string, in place
+FfxCborError ffx_cbor_getData(FfxCborCursor cursor, const uint8_t **data,
+  size_t *length);
+
+// Print the item at %cursor% (e.g. [1,h"0a0b","str"]), with a newline
+void ffx_cbor_dump(FfxCborCursor cursor);
+
+
+/////////////////////////////
+// Building
+
+FfxCborBuilder ffx_cbor_build(uint8_t *data, size_t length);
+
+size_t ffx_cbor_getBuildLength(FfxCborBuilder *builder);
+
+// Each returns false (and sets overflow) if it did not fit
+bool ffx_cbor_appendNumber(FfxCborBuilder *builder, uint64_t value);
+bool ffx_cbor_appendData(FfxCborBuilder *builder, const uint8_t *data,
+  size_t length);
+bool ffx_cbor_appendString(FfxCborBuilder *builder, const char *str);
+
+// Followed by %count% entries (or pairs)
+bool ffx_cbor_appendArray(FfxCborBuilder *builder, size_t count);
+bool ffx_cbor_appendMap(FfxCborBuilder *builder, size_t count);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FIREFLY_CBOR_H__ */
@@ -0,0 +1,60 @@
+#ifndef __FIREFLY_COLOR_H__
+#define __FIREFLY_COLOR_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Host port of the firefly-scene colors, for the panels main/ builds on
+// the host. A color is 0xRRGGBB, which is opaque, unless bit 31 is set,
+// in which case bits 24-29 hold its opacity (0 to OPACITY_100).
+
+#include <stdint.h>
+
+
+typedef uint32_t color_ffxt;
+
+#define OPACITY_0                (0)
+#define OPACITY_10               (3)
+#define OPACITY_20               (6)
+#define OPACITY_30               (10)
+#define OPACITY_40               (13)
+#define OPACITY_50               (16)
+#define OPACITY_60               (19)
+#define OPACITY_70               (22)
+#define OPACITY_75               (24)
+#define OPACITY_80               (26)
+#define OPACITY_90               (29)
+#define OPACITY_100              (32)
+
+#define COLOR_BLACK              (0x000000)
+#define COLOR_WHITE              (0xffffff)
+#define COLOR_RED                (0xff0000)
+#define COLOR_GREEN              (0x00ff00)
+#define COLOR_BLUE               (0x0000ff)
+
+#define COLOR_HAS_OPACITY        (0x80000000)
+
+// Black at 75% opacity; darkens whatever is behind it
+#define RGBA_DARKER75            (COLOR_HAS_OPACITY | (OPACITY_75 << 24))
+
+
+color_ffxt ffx_color_rgb(uint8_t r, uint8_t g, uint8_t b);
+
+// The color with its opacity replaced by %opacity% (0 to OPACITY_100)
+color_ffxt ffx_color_setOpacity(color_ffxt color, uint32_t opacity);
+
+uint32_t ffx_color_getOpacity(color_ffxt color);
+
+// The color, without its opacity, as RGB565
+uint16_t ffx_color_rgb16(color_ffxt color);
+
+// Blend from %a% to %b% by %t% (0 to 1), including the opacity
+color_ffxt ffx_color_lerp(color_ffxt a, color_ffxt b, float t);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FIREFLY_COLOR_H__ */
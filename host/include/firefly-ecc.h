@@ -0,0 +1,42 @@
+#ifndef __FIREFLY_ECC_H__
+#define __FIREFLY_ECC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Host port of firefly-ecc: the key types, and the public key derivation
+// (see host/device.c), which is main/secp256k1.c, as the host has no
+// reference implementation
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+typedef struct FfxEcPrivkey {
+    uint8_t data[32];
+} FfxEcPrivkey;
+
+// Uncompressed; 0x04, x, y
+typedef struct FfxEcPubkey {
+    uint8_t data[65];
+} FfxEcPubkey;
+
+typedef struct FfxEcDigest {
+    uint8_t data[32];
+} FfxEcDigest;
+
+// r, s and the recovery id
+typedef struct FfxEcSignature {
+    uint8_t data[65];
+} FfxEcSignature;
+
+
+bool ffx_ec_computePubkey(FfxEcPubkey *pubkey, const FfxEcPrivkey *privkey);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FIREFLY_ECC_H__ */
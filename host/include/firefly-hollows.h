@@ -0,0 +1,115 @@
+#ifndef __FIREFLY_HOLLOWS_H__
+#define __FIREFLY_HOLLOWS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Host port of the firefly-hollows panel stack and event loop (see
+// host/hollows.c), for running the panels in main/ without a device.
+// Time is simulated: each frame advances the clock by a fixed interval,
+// so runs are repeatable. Input comes from a key script (key-script.h).
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "firefly-cbor.h"
+#include "firefly-color.h"
+#include "firefly-ecc.h"
+#include "firefly-scene.h"
+
+
+typedef enum FfxKey {
+    FfxKeyNone     = 0,
+    FfxKeyCancel   = (1 << 0),
+    FfxKeyOk       = (1 << 1),
+    FfxKeyNorth    = (1 << 2),
+    FfxKeySouth    = (1 << 3),
+} FfxKey;
+
+// A set of FfxKey
+typedef uint16_t FfxKeys;
+
+typedef enum FfxEvent {
+    FfxEventFocus = 0,
+    FfxEventKeys,
+    FfxEventRenderScene,
+
+    FfxEventCount
+} FfxEvent;
+
+typedef union FfxEventProps {
+    struct {
+        FfxKeys down;
+        FfxKeys changed;
+    } keys;
+
+    struct {
+        uint32_t ticks;
+    } render;
+} FfxEventProps;
+
+typedef enum FfxPanelStyle {
+    FfxPanelStyleInstant = 0,
+    FfxPanelStyleCoverUp,
+    FfxPanelStyleSlideLeft,
+} FfxPanelStyle;
+
+typedef void (*FfxEventFunc)(FfxEvent event, FfxEventProps props, void *arg);
+
+typedef int (*FfxPanelInitFunc)(FfxScene scene, FfxNode node, void *state,
+  void *arg);
+
+
+// Call %func% for %event% on the current panel, replacing any handler
+bool ffx_onEvent(FfxEvent event, FfxEventFunc func, void *arg);
+
+// Push a panel, with %stateSize% bytes of zeroed state, and run it until
+// it pops; returns its result (or -1 if the host is quitting). Panels
+// appear at once, whatever the %style%.
+int ffx_pushPanel(FfxPanelInitFunc initFunc, size_t stateSize,
+  FfxPanelStyle style, void *arg);
+
+// Pop the current panel, returning %result% from its ffx_pushPanel
+void ffx_popPanel(int result);
+
+
+/////////////////////////////
+// Device, for main/requests.c (see host/device.c)
+
+// The key of account %index%; on the host, a fixed test key per index
+bool ffx_deviceTestPrivkey(FfxEcPrivkey *privkey, uint32_t index);
+
+// The host has no radio; requests are driven over a socket instead (see
+// main/transport-socket.h), so these only log
+void ffx_sendReply(uint32_t id, FfxCborBuilder *reply);
+void ffx_sendErrorReply(uint32_t id, uint32_t code, const char *message);
+
+
+/////////////////////////////
+// Host
+
+// Read input from the key script at %path% and render a frame every
+// %interval% ms of simulated time; false if the script cannot be read
+bool ffx_hostInit(const char *path, uint32_t interval);
+
+// Frames rendered, and written by frame steps
+uint32_t ffx_hostGetFrames();
+uint32_t ffx_hostGetWrites();
+
+// Whether fragments outside the damage a panel sets (see
+// ffx_scene_setDamage) are skipped; on by default
+void ffx_hostSetDamage(bool enabled);
+
+// Fragments rendered and sent, over all frames
+uint32_t ffx_hostGetFragments();
+
+void ffx_hostFree();
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FIREFLY_HOLLOWS_H__ */
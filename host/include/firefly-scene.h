@@ -0,0 +1,206 @@
+#ifndef __FIREFLY_SCENE_H__
+#define __FIREFLY_SCENE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Host port of firefly-scene: the subset of the scene graph the panels
+// in main/ use, rendered in software into display fragments (see
+// host/scene.c). Labels are drawn as a block per character, since the
+// fonts are part of the firefly-scene component.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "firefly-color.h"
+
+
+typedef struct FfxPoint {
+    int32_t x;
+    int32_t y;
+} FfxPoint;
+
+typedef struct FfxSize {
+    int32_t width;
+    int32_t height;
+} FfxSize;
+
+typedef struct FfxSceneContext *FfxScene;
+typedef struct FfxSceneNode *FfxNode;
+
+typedef enum FfxFont {
+    FfxFontSmall = 0,
+    FfxFontSmallBold,
+    FfxFontMedium,
+    FfxFontMediumBold,
+    FfxFontLarge,
+    FfxFontLargeBold,
+} FfxFont;
+
+typedef struct FfxFontMetrics {
+    // The size of each (monospace) character cell
+    FfxSize size;
+
+    // Pixels of the cell below the baseline
+    int32_t descent;
+} FfxFontMetrics;
+
+// A horizontal and a vertical alignment; by default the position is
+// the left end of the baseline
+typedef enum FfxTextAlign {
+    FfxTextAlignLeft      = 0x00,
+    FfxTextAlignCenter    = 0x01,
+    FfxTextAlignRight     = 0x02,
+
+    FfxTextAlignBaseline  = 0x00,
+    FfxTextAlignTop       = 0x10,
+    FfxTextAlignMiddle    = 0x20,
+    FfxTextAlignBottom    = 0x30,
+} FfxTextAlign;
+
+typedef enum FfxCurve {
+    FfxCurveLinear = 0,
+    FfxCurveEaseInQuad,
+    FfxCurveEaseOutQuad,
+    FfxCurveEaseInOutQuad,
+    FfxCurveEaseInBack,
+    FfxCurveEaseOutBack,
+} FfxCurve;
+
+typedef enum FfxSceneActionStop {
+    // The animation ran to completion
+    FfxSceneActionStopNormal = 0,
+
+    // Stopped; the property keeps its current (interpolated) value
+    FfxSceneActionStopCurrent,
+
+    // Stopped; the property jumps to its target
+    FfxSceneActionStopFinal,
+} FfxSceneActionStop;
+
+typedef void (*FfxNodeAnimationCompletionFunc)(FfxNode node,
+  FfxSceneActionStop stopAction, void *arg);
+
+typedef struct FfxNodeAnimation {
+    uint32_t delay;
+    uint32_t duration;
+    FfxCurve curve;
+    FfxNodeAnimationCompletionFunc onComplete;
+    void *arg;
+} FfxNodeAnimation;
+
+// Change the properties of %node% to animate them to their new values,
+// as configured by %animation%
+typedef void (*FfxNodeAnimationFunc)(FfxNode node,
+  FfxNodeAnimation *animation, void *arg);
+
+
+static inline FfxPoint ffx_point(int32_t x, int32_t y) {
+    return (FfxPoint){ .x = x, .y = y };
+}
+
+static inline FfxSize ffx_size(int32_t width, int32_t height) {
+    return (FfxSize){ .width = width, .height = height };
+}
+
+
+/////////////////////////////
+// Scene
+
+FfxScene ffx_scene_init();
+void ffx_scene_free(FfxScene scene);
+
+FfxFontMetrics ffx_scene_getFontMetrics(FfxFont font);
+
+FfxNode ffx_scene_createGroup(FfxScene scene);
+FfxNode ffx_scene_createBox(FfxScene scene, FfxSize size);
+FfxNode ffx_scene_createImage(FfxScene scene, const uint16_t *data,
+  size_t length);
+FfxNode ffx_scene_createLabel(FfxScene scene, FfxFont font,
+  const char *text);
+
+// Advance the animations to %now% (ms)
+void ffx_scene_sequence(FfxScene scene, uint32_t now);
+
+// Render %root% into %fragment%, the %height% rows of the display from
+// row %y%, as big-endian RGB565 (as sent to the display)
+void ffx_scene_render(FfxScene scene, FfxNode root, uint16_t *fragment,
+  int32_t y, int32_t height);
+
+
+/////////////////////////////
+// Damage (host only)
+
+// The display pipeline of firefly-scene does not take a damage region
+// yet; code which can provide one checks for this
+#define FFX_SCENE_DAMAGE
+
+// Damage is a bitmask of strips of this many rows
+#define FFX_SCENE_DAMAGE_ROWS    (24)
+#define FFX_SCENE_DAMAGE_ALL     (0xffffffff)
+
+// Only the strips in %fragments% changed this frame; the rest of the
+// display can keep what was last sent. Applies until the frame is done
+// (see ffx_scene_endFrame).
+void ffx_scene_setDamage(FfxScene scene, uint32_t fragments);
+
+// Whether any of the %height% rows from row %y% are damaged
+bool ffx_scene_isDamaged(FfxScene scene, int32_t y, int32_t height);
+
+// Reset the damage to the whole display, for the next frame
+void ffx_scene_endFrame(FfxScene scene);
+
+
+/////////////////////////////
+// Nodes
+
+// Remove %node% from its parent and free it, its children and their
+// animations
+void ffx_sceneNode_free(FfxNode node);
+
+FfxScene ffx_sceneNode_getScene(FfxNode node);
+
+FfxPoint ffx_sceneNode_getPosition(FfxNode node);
+void ffx_sceneNode_setPosition(FfxNode node, FfxPoint position);
+
+bool ffx_sceneNode_isHidden(FfxNode node);
+void ffx_sceneNode_setHidden(FfxNode node, bool hidden);
+
+void ffx_sceneNode_animate(FfxNode node, FfxNodeAnimationFunc animateFunc,
+  void *arg);
+void ffx_sceneNode_animatePosition(FfxNode node, FfxPoint target,
+  uint32_t delay, uint32_t duration, FfxCurve curve,
+  FfxNodeAnimationCompletionFunc onComplete, void *arg);
+void ffx_sceneNode_stopAnimations(FfxNode node, FfxSceneActionStop stopAction);
+
+void ffx_sceneGroup_appendChild(FfxNode group, FfxNode child);
+
+color_ffxt ffx_sceneBox_getColor(FfxNode node);
+void ffx_sceneBox_setColor(FfxNode node, color_ffxt color);
+FfxSize ffx_sceneBox_getSize(FfxNode node);
+void ffx_sceneBox_setSize(FfxNode node, FfxSize size);
+void ffx_sceneBox_animateColor(FfxNode node, color_ffxt target,
+  uint32_t delay, uint32_t duration, FfxCurve curve,
+  FfxNodeAnimationCompletionFunc onComplete, void *arg);
+
+// The %data% is not copied, so must outlive the node (or the next call)
+const uint16_t* ffx_sceneImage_getData(FfxNode node);
+void ffx_sceneImage_setData(FfxNode node, const uint16_t *data,
+  size_t length);
+
+// The text is copied
+void ffx_sceneLabel_setText(FfxNode node, const char *text);
+void ffx_sceneLabel_setAlign(FfxNode node, FfxTextAlign align);
+void ffx_sceneLabel_setTextColor(FfxNode node, color_ffxt color);
+void ffx_sceneLabel_setOutlineColor(FfxNode node, color_ffxt color);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FIREFLY_SCENE_H__ */
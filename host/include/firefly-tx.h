@@ -0,0 +1,26 @@
+#ifndef __FIREFLY_TX_H__
+#define __FIREFLY_TX_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Host port of firefly-tx: only the result type main/requests.h keeps
+// for transactions, as the transaction methods are not built on the host
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+typedef struct FfxDataResult {
+    const uint8_t *bytes;
+    size_t length;
+    int error;
+} FfxDataResult;
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FIREFLY_TX_H__ */
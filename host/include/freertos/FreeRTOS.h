@@ -0,0 +1,28 @@
+#ifndef __FREERTOS_H__
+#define __FREERTOS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Host shim of the FreeRTOS definitions main/ uses; ticks are ms of the
+// simulated clock of host/hollows.c (or the real clock, in
+// pixie-dispatch.c)
+
+#include <stdint.h>
+
+
+typedef uint32_t TickType_t;
+typedef int32_t BaseType_t;
+
+#define pdFALSE                  (0)
+#define pdTRUE                   (1)
+
+#define portTICK_PERIOD_MS       (1)
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FREERTOS_H__ */
@@ -0,0 +1,40 @@
+#ifndef __FREERTOS_TASK_H__
+#define __FREERTOS_TASK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include "freertos/FreeRTOS.h"
+
+
+typedef void* TaskHandle_t;
+
+typedef enum eTaskState {
+    eRunning = 0,
+    eReady,
+    eBlocked,
+    eSuspended,
+    eDeleted,
+    eInvalid
+} eTaskState;
+
+typedef struct TaskStatus_t {
+    const char *pcTaskName;
+} TaskStatus_t;
+
+
+TickType_t xTaskGetTickCount();
+
+// Advances the simulated clock; nothing else runs meanwhile
+void vTaskDelay(TickType_t ticks);
+
+void vTaskGetInfo(TaskHandle_t task, TaskStatus_t *status,
+  BaseType_t getHighWater, eTaskState state);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __FREERTOS_TASK_H__ */
@@ -0,0 +1,123 @@
+#include <string.h>
+
+#include "key-script.h"
+
+
+#define LINE_LENGTH          (320)
+
+
+typedef struct KeyName {
+    const char *name;
+    FfxKeys key;
+} KeyName;
+
+static const KeyName keyNames[] = {
+    { "north", FfxKeyNorth },
+    { "south", FfxKeySouth },
+    { "ok", FfxKeyOk },
+    { "cancel", FfxKeyCancel },
+};
+
+#define KEY_NAME_COUNT       (sizeof(keyNames) / sizeof(keyNames[0]))
+
+static bool parseKeys(char *names, FfxKeys *keys) {
+    *keys = 0;
+
+    for (char *name = strtok(names, " \t"); name; name = strtok(NULL, " \t")) {
+        size_t i = 0;
+        for (; i < KEY_NAME_COUNT; i++) {
+            if (strcmp(name, keyNames[i].name) == 0) { break; }
+        }
+        if (i == KEY_NAME_COUNT) { return false; }
+        *keys |= keyNames[i].key;
+    }
+
+    return true;
+}
+
+static bool parseStep(char *line, KeyScriptStep *step) {
+    memset(step, 0, sizeof(KeyScriptStep));
+
+    char action[16] = { 0 };
+    int offset = 0;
+    if (sscanf(line, "%u %15s %n", &step->at, action, &offset) < 2) {
+        return false;
+    }
+
+    char *rest = &line[offset];
+
+    if (strcmp(action, "keys") == 0) {
+        step->action = KeyScriptActionKeys;
+        return parseKeys(rest, &step->keys);
+
+    } else if (strcmp(action, "frame") == 0) {
+        step->action = KeyScriptActionFrame;
+        if (*rest == 0 || strlen(rest) > KEY_SCRIPT_PATH_LENGTH) {
+            return false;
+        }
+        strcpy(step->path, rest);
+        return true;
+
+    } else if (strcmp(action, "quit") == 0) {
+        step->action = KeyScriptActionQuit;
+        return true;
+    }
+
+    return false;
+}
+
+// Read the next step into script->next
+static void readStep(KeyScript *script) {
+    uint32_t last = script->next.at;
+
+    char line[LINE_LENGTH];
+    while (fgets(line, sizeof(line), script->fp)) {
+        script->line++;
+
+        line[strcspn(line, "\r\n")] = 0;
+
+        char *start = line + strspn(line, " \t");
+        if (*start == 0 || *start == '#') { continue; }
+
+        if (!parseStep(start, &script->next) || script->next.at < last) {
+            printf("[key-script] bad step: line=%ld\n", script->line);
+            break;
+        }
+
+        script->pending = true;
+        return;
+    }
+
+    memset(&script->next, 0, sizeof(KeyScriptStep));
+    script->next.at = last;
+    script->next.action = KeyScriptActionQuit;
+    script->pending = true;
+}
+
+bool keyScriptOpen(KeyScript *script, const char *path) {
+    memset(script, 0, sizeof(KeyScript));
+
+    script->fp = fopen(path, "r");
+    if (script->fp == NULL) { return false; }
+
+    readStep(script);
+
+    return true;
+}
+
+bool keyScriptNext(KeyScript *script, uint32_t now, KeyScriptStep *step) {
+    if (!script->pending || script->next.at > now) { return false; }
+
+    *step = script->next;
+    script->pending = false;
+
+    if (step->action != KeyScriptActionQuit) { readStep(script); }
+
+    return true;
+}
+
+void keyScriptClose(KeyScript *script) {
+    if (script->fp) { fclose(script->fp); }
+    script->fp = NULL;
+    script->pending = false;
+}
@@ -0,0 +1,71 @@
+#ifndef __KEY_SCRIPT_H__
+#define __KEY_SCRIPT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// Scripted input for host builds. Each line is a time (ms since start)
+// and an action:
+//
+//   # comment
+//   500 keys ok          the keys held become Ok (none releases all)
+//   600 keys north ok
+//   700 keys
+//   900 frame menu.png   write the framebuffer as a PNG
+//   1000 quit
+//
+// Times must not decrease.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "firefly-hollows.h"
+
+
+#define KEY_SCRIPT_PATH_LENGTH   (255)
+
+
+typedef enum KeyScriptAction {
+    KeyScriptActionKeys = 0,
+    KeyScriptActionFrame,
+    KeyScriptActionQuit,
+} KeyScriptAction;
+
+typedef struct KeyScriptStep {
+    uint32_t at;
+    KeyScriptAction action;
+
+    // For KeyScriptActionKeys
+    FfxKeys keys;
+
+    // For KeyScriptActionFrame
+    char path[KEY_SCRIPT_PATH_LENGTH + 1];
+} KeyScriptStep;
+
+typedef struct KeyScript {
+    FILE *fp;
+    uint32_t line;
+
+    // Read, but not yet due
+    bool pending;
+    KeyScriptStep next;
+} KeyScript;
+
+
+// False if %path% cannot be read
+bool keyScriptOpen(KeyScript *script, const char *path);
+
+// Take the next step due by %now% (ms); false if there is none yet. A
+// malformed line or the end of the script is a quit step.
+bool keyScriptNext(KeyScript *script, uint32_t now, KeyScriptStep *step);
+
+void keyScriptClose(KeyScript *script);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __KEY_SCRIPT_H__ */
@@ -0,0 +1,106 @@
+// Serves main/requests.c on the host over a Unix socket (see
+// main/transport-socket.h), for driving it with tools/loadgen.py
+// without a phone or radio, e.g.
+//
+//   pixie-dispatch --socket /tmp/pixie.sock
+//
+// Only the built-in methods (accounts, capabilities, batches and
+// uploads) are registered; the transaction methods need the firefly
+// components. Runs until interrupted.
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "requests.h"
+#include "transport-socket.h"
+
+
+// How often a poll returns, to check for an interrupt
+#define POLL_TIMEOUT         (100)
+
+
+static volatile sig_atomic_t running = 1;
+
+static void onSignal(int signal) {
+    running = 0;
+}
+
+
+/////////////////////////////
+// FreeRTOS shims, on the real clock, as requests time out uploads
+
+TickType_t xTaskGetTickCount() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    struct timespec duration = {
+        .tv_sec = ticks / 1000,
+        .tv_nsec = (ticks % 1000) * 1000000
+    };
+    nanosleep(&duration, NULL);
+}
+
+void vTaskGetInfo(TaskHandle_t task, TaskStatus_t *status,
+  BaseType_t getHighWater, eTaskState state) {
+    status->pcTaskName = "host";
+}
+
+
+/////////////////////////////
+// Main
+
+static void usage() {
+    printf("Usage: pixie-dispatch --socket PATH\n");
+}
+
+int main(int argc, char **argv) {
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else {
+            usage();
+            return 1;
+        }
+    }
+
+    if (path == NULL) {
+        usage();
+        return 1;
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    // Large (for the stack), as it holds the arena
+    static Requests requests;
+    requestsInit(&requests);
+
+    static SocketTransport transport;
+    if (!socketTransportOpen(&transport, path)) { return 1; }
+
+    requestsSetTransport(&requests, &transport.transport);
+
+    while (running) {
+        if (!socketTransportPoll(&transport, &requests, POLL_TIMEOUT)) {
+            break;
+        }
+    }
+
+    printf("[host] dispatch: answered=%ld queued=%ld refused=%ld\n",
+      (long)requests.answered, (long)requests.queued,
+      (long)requests.refused);
+
+    socketTransportClose(&transport);
+
+    return 0;
+}
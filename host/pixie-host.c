@@ -0,0 +1,161 @@
+// Runs the panels on the host, headless: the scene is rendered into an
+// in-memory framebuffer from simulated time and scripted keys (see
+// key-script.h), and frames are written as PNG when the script asks, e.g.
+//
+//   pixie-host --panel menu --script tests/render-menu.keys
+//
+// Fragments outside the damage a panel reports are skipped, keeping what
+// was last sent, as the display would (--damage off renders them all, for
+// comparing). The render profile (see main/profiler.h) is written once
+// the script quits, for measuring the cost of each panel per frame.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "firefly-hollows.h"
+#include "firefly-scene.h"
+
+#include "panel-connect.h"
+#include "panel-gifs.h"
+#include "panel-info.h"
+#include "panel-menu.h"
+#include "panel-space.h"
+#include "profiler.h"
+
+
+// Simulated ms per frame
+#define FRAME_INTERVAL       (16)
+
+
+// The connect panel needs the ethers component, so is not built here
+int pushPanelConnect() {
+    printf("[host] connect panel not built\n");
+    return 0;
+}
+
+
+/////////////////////////////
+// A sample transaction review, long enough to scroll
+
+typedef struct InfoState {
+    int selected;
+} InfoState;
+
+static void formatInfo(void *_state, uint16_t userData, char *text,
+  size_t length) {
+    snprintf(text, length, "Param %d", userData);
+}
+
+// The params and buttons are appended on the first frame, as the
+// transaction panel formats its views during the slide-in
+static void fillInfo(void *infoState, void *_state) {
+    setFormatFunc(infoState, formatInfo);
+    for (int i = 0; i < 48; i++) {
+        appendFormatted(infoState, FfxFontSmall, COLOR_WHITE, i);
+    }
+
+    appendHR(infoState);
+    appendPadding(infoState, 15);
+
+    appendButton(infoState, "Approve", ffx_color_rgb(0, 200, 0),
+      PanelTxActionApprove);
+    appendButton(infoState, "Reject", ffx_color_rgb(200, 0, 0),
+      PanelTxActionReject);
+}
+
+static int initInfo(void *infoState, void *_state, void *arg) {
+    appendTitle(infoState, "SIGN TRANSACTION");
+
+    appendEntry(infoState, "To", "0x8ba1f109551bD432803012645Ac136ddd64DBA72",
+      PanelTxViewTo);
+    appendEntry(infoState, "Value", "1.5 ether", PanelTxViewValue);
+    appendEntry(infoState, "Network", "Ethereum", PanelTxViewNoDrill);
+    appendEntry(infoState, "Fees", "0.0021 ether", PanelTxViewFees);
+
+    setFillFunc(infoState, fillInfo);
+
+    return 0;
+}
+
+static void selectInfo(void *_state, uint16_t userData) {
+    InfoState *state = _state;
+    state->selected = userData;
+
+    printf("[host] info selected: userData=%d\n", userData);
+
+    if (userData == PanelTxActionApprove) {
+        ffx_popPanel(PANEL_TX_APPROVE);
+    } else if (userData == PanelTxActionReject) {
+        ffx_popPanel(PANEL_TX_REJECT);
+    }
+}
+
+
+/////////////////////////////
+// Main
+
+static void usage() {
+    printf("Usage: pixie-host --script PATH [--panel menu|space|gifs|info] "
+      "[--interval MS] [--damage on|off]\n");
+}
+
+int main(int argc, char **argv) {
+    const char *script = NULL;
+    const char *panel = "menu";
+    uint32_t interval = FRAME_INTERVAL;
+    bool damage = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 == argc) {
+            usage();
+            return 1;
+        }
+
+        if (strcmp(argv[i], "--script") == 0) {
+            script = argv[++i];
+        } else if (strcmp(argv[i], "--panel") == 0) {
+            panel = argv[++i];
+        } else if (strcmp(argv[i], "--interval") == 0) {
+            interval = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--damage") == 0) {
+            damage = (strcmp(argv[++i], "off") != 0);
+        } else {
+            usage();
+            return 1;
+        }
+    }
+
+    if (script == NULL) {
+        usage();
+        return 1;
+    }
+
+    if (!ffx_hostInit(script, interval)) { return 1; }
+    ffx_hostSetDamage(damage);
+
+    int result;
+    if (strcmp(panel, "menu") == 0) {
+        result = pushPanelMenu();
+    } else if (strcmp(panel, "space") == 0) {
+        result = pushPanelSpace();
+    } else if (strcmp(panel, "gifs") == 0) {
+        result = pushPanelGifs();
+    } else if (strcmp(panel, "info") == 0) {
+        result = pushPanelInfo(initInfo, sizeof(InfoState), selectInfo, NULL);
+    } else {
+        usage();
+        ffx_hostFree();
+        return 1;
+    }
+
+    printf("[host] %s: result=%d frames=%d written=%d fragments=%d\n",
+      panel, result, ffx_hostGetFrames(), ffx_hostGetWrites(),
+      ffx_hostGetFragments());
+
+    PROFILE_DUMP(panel);
+
+    ffx_hostFree();
+
+    return 0;
+}
@@ -0,0 +1,777 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "firefly-scene.h"
+
+#include "image.h"
+#include "profiler.h"
+
+
+#define DISPLAY_WIDTH        (240)
+#define DISPLAY_HEIGHT       (240)
+
+#define LABEL_LENGTH         (128)
+
+
+typedef enum NodeKind {
+    NodeKindGroup = 0,
+    NodeKindBox,
+    NodeKindImage,
+    NodeKindLabel,
+} NodeKind;
+
+struct FfxSceneNode {
+    FfxScene scene;
+    NodeKind kind;
+
+    FfxPoint position;
+    bool hidden;
+
+    FfxNode parent;
+    FfxNode firstChild;
+    FfxNode lastChild;
+    FfxNode nextSibling;
+
+    // Box
+    FfxSize size;
+    color_ffxt color;
+
+    // Image
+    const uint16_t *data;
+    size_t length;
+
+    // Label
+    FfxFont font;
+    FfxTextAlign align;
+    color_ffxt textColor;
+    color_ffxt outlineColor;
+    bool outline;
+    char text[LABEL_LENGTH];
+};
+
+typedef enum AnimationKind {
+    AnimationKindPosition = 0,
+    AnimationKindColor,
+} AnimationKind;
+
+typedef struct Animation {
+    FfxNode node;
+    AnimationKind kind;
+
+    uint32_t start;
+    FfxNodeAnimation config;
+
+    FfxPoint fromPosition, toPosition;
+    color_ffxt fromColor, toColor;
+
+    struct Animation *next;
+} Animation;
+
+struct FfxSceneContext {
+    Animation *animations;
+
+    // Of the last sequence; animations start from here
+    uint32_t now;
+
+    // Strips of FFX_SCENE_DAMAGE_ROWS changed this frame
+    uint32_t damage;
+};
+
+
+color_ffxt ffx_color_rgb(uint8_t r, uint8_t g, uint8_t b) {
+    return (r << 16) | (g << 8) | b;
+}
+
+uint32_t ffx_color_getOpacity(color_ffxt color) {
+    if ((color & COLOR_HAS_OPACITY) == 0) { return OPACITY_100; }
+    return (color >> 24) & 0x3f;
+}
+
+color_ffxt ffx_color_setOpacity(color_ffxt color, uint32_t opacity) {
+    if (opacity > OPACITY_100) { opacity = OPACITY_100; }
+    return COLOR_HAS_OPACITY | (opacity << 24) | (color & 0xffffff);
+}
+
+uint16_t ffx_color_rgb16(color_ffxt color) {
+    uint8_t r = color >> 16, g = color >> 8, b = color;
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+color_ffxt ffx_color_lerp(color_ffxt a, color_ffxt b, float t) {
+    color_ffxt result = 0;
+    for (int shift = 0; shift < 24; shift += 8) {
+        int ca = (a >> shift) & 0xff, cb = (b >> shift) & 0xff;
+        result |= (uint32_t)(ca + (cb - ca) * t + 0.5f) << shift;
+    }
+
+    int oa = ffx_color_getOpacity(a), ob = ffx_color_getOpacity(b);
+    return ffx_color_setOpacity(result, oa + (ob - oa) * t + 0.5f);
+}
+
+
+/////////////////////////////
+// Scene
+
+// Monospace cells; the glyphs themselves are part of firefly-scene
+static const FfxFontMetrics fontMetrics[] = {
+    [FfxFontSmall] = { { 7, 14 }, 3 },
+    [FfxFontSmallBold] = { { 7, 14 }, 3 },
+    [FfxFontMedium] = { { 9, 18 }, 4 },
+    [FfxFontMediumBold] = { { 9, 18 }, 4 },
+    [FfxFontLarge] = { { 12, 24 }, 5 },
+    [FfxFontLargeBold] = { { 12, 24 }, 5 },
+};
+
+FfxScene ffx_scene_init() {
+    FfxScene scene = calloc(1, sizeof(struct FfxSceneContext));
+    assert(scene);
+    scene->damage = FFX_SCENE_DAMAGE_ALL;
+    return scene;
+}
+
+void ffx_scene_free(FfxScene scene) {
+    while (scene->animations) {
+        Animation *animation = scene->animations;
+        scene->animations = animation->next;
+        free(animation);
+    }
+    free(scene);
+}
+
+FfxFontMetrics ffx_scene_getFontMetrics(FfxFont font) {
+    if (font > FfxFontLargeBold) { font = FfxFontSmall; }
+    return fontMetrics[font];
+}
+
+static FfxNode createNode(FfxScene scene, NodeKind kind) {
+    FfxNode node = calloc(1, sizeof(struct FfxSceneNode));
+    assert(node);
+    node->scene = scene;
+    node->kind = kind;
+    return node;
+}
+
+FfxNode ffx_scene_createGroup(FfxScene scene) {
+    return createNode(scene, NodeKindGroup);
+}
+
+FfxNode ffx_scene_createBox(FfxScene scene, FfxSize size) {
+    FfxNode node = createNode(scene, NodeKindBox);
+    node->size = size;
+    node->color = COLOR_BLACK;
+    return node;
+}
+
+FfxNode ffx_scene_createImage(FfxScene scene, const uint16_t *data,
+  size_t length) {
+
+    FfxNode node = createNode(scene, NodeKindImage);
+    node->data = data;
+    node->length = length;
+    return node;
+}
+
+FfxNode ffx_scene_createLabel(FfxScene scene, FfxFont font,
+  const char *text) {
+
+    FfxNode node = createNode(scene, NodeKindLabel);
+    node->font = font;
+    node->textColor = COLOR_WHITE;
+    ffx_sceneLabel_setText(node, text);
+    return node;
+}
+
+
+/////////////////////////////
+// Animations
+
+static float applyCurve(FfxCurve curve, float t) {
+    const float c1 = 1.70158f, c3 = c1 + 1;
+
+    switch (curve) {
+        case FfxCurveEaseInQuad:
+            return t * t;
+        case FfxCurveEaseOutQuad:
+            return t * (2 - t);
+        case FfxCurveEaseInOutQuad:
+            return (t < 0.5f) ? (2 * t * t): (1 - 2 * (1 - t) * (1 - t));
+        case FfxCurveEaseInBack:
+            return c3 * t * t * t - c1 * t * t;
+        case FfxCurveEaseOutBack:
+            t -= 1;
+            return 1 + c3 * t * t * t + c1 * t * t;
+        case FfxCurveLinear:
+        default:
+            return t;
+    }
+}
+
+// Set the animated property to %t% (0 to 1, after the curve) of the way
+static void applyAnimation(Animation *animation, float t) {
+    FfxNode node = animation->node;
+
+    switch (animation->kind) {
+        case AnimationKindPosition: {
+            FfxPoint a = animation->fromPosition, b = animation->toPosition;
+            node->position.x = a.x + (int32_t)((b.x - a.x) * t +
+              ((b.x >= a.x) ? 0.5f: -0.5f));
+            node->position.y = a.y + (int32_t)((b.y - a.y) * t +
+              ((b.y >= a.y) ? 0.5f: -0.5f));
+            break;
+        }
+        case AnimationKindColor:
+            node->color = ffx_color_lerp(animation->fromColor,
+              animation->toColor, t);
+            break;
+    }
+}
+
+static Animation* addAnimation(FfxNode node, AnimationKind kind,
+  FfxNodeAnimation *config) {
+
+    Animation *animation = calloc(1, sizeof(Animation));
+    assert(animation);
+    animation->node = node;
+    animation->kind = kind;
+    animation->start = node->scene->now;
+    animation->config = *config;
+
+    animation->next = node->scene->animations;
+    node->scene->animations = animation;
+
+    return animation;
+}
+
+void ffx_scene_sequence(FfxScene scene, uint32_t now) {
+    scene->now = now;
+
+    // Completed animations are unlinked before their callbacks run, as
+    // those may start (or stop) animations
+    Animation *done = NULL;
+
+    Animation **link = &scene->animations;
+    while (*link) {
+        Animation *animation = *link;
+        FfxNodeAnimation *config = &animation->config;
+
+        int32_t elapsed = now - animation->start - config->delay;
+        if (elapsed < 0) {
+            link = &animation->next;
+            continue;
+        }
+
+        if (elapsed < (int32_t)config->duration) {
+            applyAnimation(animation, applyCurve(config->curve,
+              (float)elapsed / config->duration));
+            link = &animation->next;
+            continue;
+        }
+
+        applyAnimation(animation, 1);
+        *link = animation->next;
+        animation->next = done;
+        done = animation;
+    }
+
+    while (done) {
+        Animation *animation = done;
+        done = animation->next;
+        if (animation->config.onComplete) {
+            animation->config.onComplete(animation->node,
+              FfxSceneActionStopNormal, animation->config.arg);
+        }
+        free(animation);
+    }
+}
+
+void ffx_sceneNode_stopAnimations(FfxNode node, FfxSceneActionStop stopAction) {
+    FfxScene scene = node->scene;
+
+    Animation *stopped = NULL;
+
+    Animation **link = &scene->animations;
+    while (*link) {
+        Animation *animation = *link;
+        if (animation->node != node) {
+            link = &animation->next;
+            continue;
+        }
+
+        if (stopAction == FfxSceneActionStopFinal) {
+            applyAnimation(animation, 1);
+        }
+
+        *link = animation->next;
+        animation->next = stopped;
+        stopped = animation;
+    }
+
+    while (stopped) {
+        Animation *animation = stopped;
+        stopped = animation->next;
+        if (animation->config.onComplete) {
+            animation->config.onComplete(node, stopAction,
+              animation->config.arg);
+        }
+        free(animation);
+    }
+}
+
+void ffx_sceneNode_animatePosition(FfxNode node, FfxPoint target,
+  uint32_t delay, uint32_t duration, FfxCurve curve,
+  FfxNodeAnimationCompletionFunc onComplete, void *arg) {
+
+    FfxNodeAnimation config = {
+        .delay = delay, .duration = duration, .curve = curve,
+        .onComplete = onComplete, .arg = arg
+    };
+
+    Animation *animation = addAnimation(node, AnimationKindPosition, &config);
+    animation->fromPosition = node->position;
+    animation->toPosition = target;
+}
+
+void ffx_sceneBox_animateColor(FfxNode node, color_ffxt target,
+  uint32_t delay, uint32_t duration, FfxCurve curve,
+  FfxNodeAnimationCompletionFunc onComplete, void *arg) {
+
+    FfxNodeAnimation config = {
+        .delay = delay, .duration = duration, .curve = curve,
+        .onComplete = onComplete, .arg = arg
+    };
+
+    Animation *animation = addAnimation(node, AnimationKindColor, &config);
+    animation->fromColor = node->color;
+    animation->toColor = target;
+}
+
+// The properties %animateFunc% sets are restored, then animated to
+void ffx_sceneNode_animate(FfxNode node, FfxNodeAnimationFunc animateFunc,
+  void *arg) {
+
+    FfxPoint position = node->position;
+    color_ffxt color = node->color;
+
+    FfxNodeAnimation config = { 0 };
+    animateFunc(node, &config, arg);
+
+    bool moved = (node->position.x != position.x ||
+      node->position.y != position.y);
+    bool colored = (node->color != color);
+
+    if (config.duration == 0 || (!moved && !colored)) {
+        if (config.onComplete) {
+            config.onComplete(node, FfxSceneActionStopNormal, config.arg);
+        }
+        return;
+    }
+
+    // Only one of the animations reports completion
+    if (moved) {
+        Animation *animation = addAnimation(node, AnimationKindPosition,
+          &config);
+        animation->fromPosition = position;
+        animation->toPosition = node->position;
+        node->position = position;
+        config.onComplete = NULL;
+    }
+
+    if (colored) {
+        Animation *animation = addAnimation(node, AnimationKindColor, &config);
+        animation->fromColor = color;
+        animation->toColor = node->color;
+        node->color = color;
+    }
+}
+
+
+/////////////////////////////
+// Nodes
+
+static void unlinkNode(FfxNode node) {
+    FfxNode parent = node->parent;
+    if (parent == NULL) { return; }
+
+    FfxNode previous = NULL;
+    for (FfxNode child = parent->firstChild; child;
+      child = child->nextSibling) {
+        if (child == node) { break; }
+        previous = child;
+    }
+
+    if (previous) {
+        previous->nextSibling = node->nextSibling;
+    } else {
+        parent->firstChild = node->nextSibling;
+    }
+    if (parent->lastChild == node) { parent->lastChild = previous; }
+
+    node->parent = NULL;
+    node->nextSibling = NULL;
+}
+
+// Free %node% and its children, dropping their animations unannounced
+static void freeNode(FfxNode node) {
+    FfxNode child = node->firstChild;
+    while (child) {
+        FfxNode next = child->nextSibling;
+        freeNode(child);
+        child = next;
+    }
+
+    Animation **link = &node->scene->animations;
+    while (*link) {
+        Animation *animation = *link;
+        if (animation->node == node) {
+            *link = animation->next;
+            free(animation);
+        } else {
+            link = &animation->next;
+        }
+    }
+
+    free(node);
+}
+
+void ffx_sceneNode_free(FfxNode node) {
+    unlinkNode(node);
+    freeNode(node);
+}
+
+FfxScene ffx_sceneNode_getScene(FfxNode node) {
+    return node->scene;
+}
+
+FfxPoint ffx_sceneNode_getPosition(FfxNode node) {
+    return node->position;
+}
+
+void ffx_sceneNode_setPosition(FfxNode node, FfxPoint position) {
+    node->position = position;
+}
+
+bool ffx_sceneNode_isHidden(FfxNode node) {
+    return node->hidden;
+}
+
+void ffx_sceneNode_setHidden(FfxNode node, bool hidden) {
+    node->hidden = hidden;
+}
+
+void ffx_sceneGroup_appendChild(FfxNode group, FfxNode child) {
+    assert(group->kind == NodeKindGroup);
+
+    unlinkNode(child);
+    child->parent = group;
+
+    if (group->lastChild) {
+        group->lastChild->nextSibling = child;
+    } else {
+        group->firstChild = child;
+    }
+    group->lastChild = child;
+}
+
+color_ffxt ffx_sceneBox_getColor(FfxNode node) {
+    return node->color;
+}
+
+void ffx_sceneBox_setColor(FfxNode node, color_ffxt color) {
+    node->color = color;
+}
+
+FfxSize ffx_sceneBox_getSize(FfxNode node) {
+    return node->size;
+}
+
+void ffx_sceneBox_setSize(FfxNode node, FfxSize size) {
+    node->size = size;
+}
+
+const uint16_t* ffx_sceneImage_getData(FfxNode node) {
+    return node->data;
+}
+
+void ffx_sceneImage_setData(FfxNode node, const uint16_t *data,
+  size_t length) {
+
+    node->data = data;
+    node->length = length;
+}
+
+void ffx_sceneLabel_setText(FfxNode node, const char *text) {
+    snprintf(node->text, sizeof(node->text), "%s", text ? text: "");
+}
+
+void ffx_sceneLabel_setAlign(FfxNode node, FfxTextAlign align) {
+    node->align = align;
+}
+
+void ffx_sceneLabel_setTextColor(FfxNode node, color_ffxt color) {
+    node->textColor = color;
+}
+
+void ffx_sceneLabel_setOutlineColor(FfxNode node, color_ffxt color) {
+    node->outlineColor = color;
+    node->outline = true;
+}
+
+
+/////////////////////////////
+// Rendering
+
+// The fragment being rendered, in native byte order until done
+typedef struct Fragment {
+    uint16_t *pixels;
+    int32_t y;
+    int32_t height;
+    uint32_t index;
+} Fragment;
+
+// Blend %color% over %pixel% by %alpha% (of %scale%)
+static uint16_t blend(uint16_t pixel, uint16_t color, uint32_t alpha,
+  uint32_t scale) {
+
+    if (alpha >= scale) { return color; }
+    if (alpha == 0) { return pixel; }
+
+    uint32_t r = (((color >> 11) & 0x1f) * alpha + ((pixel >> 11) & 0x1f) *
+      (scale - alpha)) / scale;
+    uint32_t g = (((color >> 5) & 0x3f) * alpha + ((pixel >> 5) & 0x3f) *
+      (scale - alpha)) / scale;
+    uint32_t b = ((color & 0x1f) * alpha + (pixel & 0x1f) *
+      (scale - alpha)) / scale;
+    return (r << 11) | (g << 5) | b;
+}
+
+// Fill the rectangle, clipped to the fragment; returns the pixels written
+static uint32_t fillRect(Fragment *fragment, int32_t x, int32_t y,
+  int32_t width, int32_t height, color_ffxt color) {
+
+    uint32_t opacity = ffx_color_getOpacity(color);
+    if (opacity == 0) { return 0; }
+
+    int32_t x0 = (x < 0) ? 0: x;
+    int32_t x1 = (x + width > DISPLAY_WIDTH) ? DISPLAY_WIDTH: x + width;
+    int32_t y0 = (y < fragment->y) ? fragment->y: y;
+    int32_t y1 = (y + height > fragment->y + fragment->height) ?
+      fragment->y + fragment->height: y + height;
+    if (x0 >= x1 || y0 >= y1) { return 0; }
+
+    uint16_t rgb = ffx_color_rgb16(color);
+    for (int32_t py = y0; py < y1; py++) {
+        uint16_t *row = &fragment->pixels[(py - fragment->y) * DISPLAY_WIDTH];
+        for (int32_t px = x0; px < x1; px++) {
+            row[px] = blend(row[px], rgb, opacity, OPACITY_100);
+        }
+    }
+
+    return (x1 - x0) * (y1 - y0);
+}
+
+static uint32_t renderBox(Fragment *fragment, FfxNode node, FfxPoint origin) {
+    return fillRect(fragment, origin.x, origin.y, node->size.width,
+      node->size.height, node->color);
+}
+
+static uint32_t renderImage(Fragment *fragment, FfxNode node,
+  FfxPoint origin) {
+
+    const uint16_t *data = node->data;
+    size_t words = node->length / 2;
+    if (data == NULL || words < 3) { return 0; }
+
+    uint32_t format = data[0];
+    int32_t width = data[1], height = data[2];
+    size_t count = width * height;
+
+    // Where the pixels (or indices) and any alpha or palette start
+    const uint16_t *colors = NULL, *alphas = NULL, *palette = NULL;
+    const uint16_t *indices = NULL;
+
+    // Run-length coded lines are decoded a fragment at a time
+    bool coded = false;
+
+    switch (format) {
+        case IMAGE_FORMAT_RGB:
+            if (words < 3 + count) { return 0; }
+            colors = &data[3];
+            break;
+        case IMAGE_FORMAT_RGBA:
+            if (words < 4 || words < 4 + data[3] + count ||
+              data[3] < (count + 3) / 4) {
+                return 0;
+            }
+            alphas = &data[4];
+            colors = &data[4 + data[3]];
+            break;
+        case IMAGE_FORMAT_INDEXED:
+            if (words < 3 + 256 + (count + 1) / 2) { return 0; }
+            palette = &data[3];
+            indices = &data[3 + 256];
+            break;
+        case IMAGE_FORMAT_RLE:
+            if (!imageIsValid(data, node->length)) { return 0; }
+            coded = true;
+            break;
+        default:
+            return 0;
+    }
+
+    int32_t y0 = (origin.y < fragment->y) ? fragment->y - origin.y: 0;
+    int32_t y1 = fragment->y + fragment->height - origin.y;
+    if (y1 > height) { y1 = height; }
+    int32_t x0 = (origin.x < 0) ? -origin.x: 0;
+    int32_t x1 = DISPLAY_WIDTH - origin.x;
+    if (x1 > width) { x1 = width; }
+    if (x0 >= x1 || y0 >= y1) { return 0; }
+
+    for (int32_t y = y0; y < y1; y++) {
+        uint16_t *row = &fragment->pixels[(origin.y + y - fragment->y) *
+          DISPLAY_WIDTH + origin.x];
+        if (coded) {
+            imageDecodeLine(data, y, x0, x1 - x0, &row[x0]);
+            continue;
+        }
+        for (int32_t x = x0; x < x1; x++) {
+            size_t i = y * width + x;
+            if (palette) {
+                uint8_t index = indices[i / 2] >> ((i & 1) ? 8: 0);
+                row[x] = palette[index];
+            } else if (alphas) {
+                uint32_t alpha = (alphas[i / 4] >> (12 - 4 * (i % 4))) & 0xf;
+                row[x] = blend(row[x], colors[i], alpha, 15);
+            } else {
+                row[x] = colors[i];
+            }
+        }
+    }
+
+    return (x1 - x0) * (y1 - y0);
+}
+
+// Each character is drawn as a block filling its cell above the baseline
+static uint32_t renderLabel(Fragment *fragment, FfxNode node,
+  FfxPoint origin) {
+
+    FfxFontMetrics metrics = ffx_scene_getFontMetrics(node->font);
+    int32_t width = strlen(node->text) * metrics.size.width;
+    int32_t height = metrics.size.height;
+
+    int32_t x = origin.x, y = origin.y;
+    switch (node->align & 0x0f) {
+        case FfxTextAlignCenter:
+            x -= width / 2;
+            break;
+        case FfxTextAlignRight:
+            x -= width;
+            break;
+    }
+    switch (node->align & 0xf0) {
+        case FfxTextAlignTop:
+            break;
+        case FfxTextAlignMiddle:
+            y -= height / 2;
+            break;
+        case FfxTextAlignBottom:
+            y -= height;
+            break;
+        default:
+            y -= height - metrics.descent;
+            break;
+    }
+
+    int32_t ascent = height - metrics.descent;
+
+    uint32_t pixels = 0;
+    for (const char *c = node->text; *c; c++, x += metrics.size.width) {
+        if (*c == ' ') { continue; }
+
+        if (node->outline) {
+            pixels += fillRect(fragment, x, y + 1, metrics.size.width,
+              ascent, node->outlineColor);
+        }
+        pixels += fillRect(fragment, x + 1, y + 2, metrics.size.width - 2,
+          ascent - 2, node->textColor);
+    }
+
+    return pixels;
+}
+
+static void renderNode(Fragment *fragment, FfxNode node, FfxPoint origin) {
+    if (node->hidden) { return; }
+
+    origin.x += node->position.x;
+    origin.y += node->position.y;
+
+    PROFILE_BEGIN(t0);
+
+    switch (node->kind) {
+        case NodeKindGroup:
+            for (FfxNode child = node->firstChild; child;
+              child = child->nextSibling) {
+                renderNode(fragment, child, origin);
+            }
+            break;
+
+        case NodeKindBox: {
+            uint32_t pixels = renderBox(fragment, node, origin);
+            PROFILE_END(t0, ProfilerKindBox, fragment->index, pixels);
+            break;
+        }
+
+        case NodeKindImage: {
+            uint32_t pixels = renderImage(fragment, node, origin);
+            PROFILE_END(t0, ProfilerKindImage, fragment->index, pixels);
+            break;
+        }
+
+        case NodeKindLabel: {
+            uint32_t pixels = renderLabel(fragment, node, origin);
+            PROFILE_END(t0, ProfilerKindLabel, fragment->index, pixels);
+            break;
+        }
+    }
+}
+
+void ffx_scene_render(FfxScene scene, FfxNode root, uint16_t *pixels,
+  int32_t y, int32_t height) {
+
+    Fragment fragment = {
+        .pixels = pixels, .y = y, .height = height,
+        .index = y * PROFILER_FRAGMENTS / DISPLAY_HEIGHT
+    };
+
+    PROFILE_BEGIN(t0);
+
+    size_t count = height * DISPLAY_WIDTH;
+    memset(pixels, 0, count * sizeof(uint16_t));
+
+    renderNode(&fragment, root, ffx_point(0, 0));
+
+    for (size_t i = 0; i < count; i++) {
+        pixels[i] = (pixels[i] >> 8) | (pixels[i] << 8);
+    }
+
+    PROFILE_END(t0, ProfilerKindFragment, fragment.index, 0);
+}
+
+void ffx_scene_setDamage(FfxScene scene, uint32_t fragments) {
+    scene->damage = fragments;
+}
+
+bool ffx_scene_isDamaged(FfxScene scene, int32_t y, int32_t height) {
+    if (height <= 0) { return false; }
+
+    int32_t first = y / FFX_SCENE_DAMAGE_ROWS;
+    int32_t last = (y + height - 1) / FFX_SCENE_DAMAGE_ROWS;
+    for (int32_t strip = first; strip <= last && strip < 32; strip++) {
+        if (scene->damage & (1 << strip)) { return true; }
+    }
+
+    return false;
+}
+
+void ffx_scene_endFrame(FfxScene scene) {
+    scene->damage = FFX_SCENE_DAMAGE_ALL;
+}
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""
+Serves the requests over a Unix socket (pixie-dispatch) and checks:
+  - accounts, capabilities and batches are answered, a batched call
+    which fails (or whose reply may not fit) is answered by its error,
+    and unknown methods fail
+  - a payload uploaded in chunks is answered by the method it was for
+  - tools/loadgen.py replays the trace in this directory with no errors
+    or lost requests, and fails on a trace of unknown methods
+  - the dispatcher exits cleanly when interrupted
+"""
+
+import argparse
+import importlib.util
+import json
+import os
+import signal
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+
+TIMEOUT = 10.0
+
+# Requests for the loadgen run, cycling the trace
+LOADGEN_COUNT = 400
+
+ADDRESS_LENGTH = 20
+
+ERROR_TOO_LARGE = 5
+
+
+def loadTool(name):
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+      "..", "tools", name)
+    spec = importlib.util.spec_from_file_location(name.split(".")[0], path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+class Connection:
+    def __init__(self, path, loadgen):
+        self.loadgen = loadgen
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.sock.settimeout(TIMEOUT)
+        self.sock.connect(path)
+        self.nextId = 1
+
+    def readAll(self, length):
+        data = b""
+        while len(data) < length:
+            chunk = self.sock.recv(length - len(data))
+            if not chunk: raise EOFError()
+            data += chunk
+        return data
+
+    # Returns (error, result), where result is the message on error
+    def call(self, method, params):
+        id = self.nextId
+        self.nextId += 1
+
+        frame = self.loadgen.encode([ id, method, params ])
+        self.sock.sendall(struct.pack(">I", len(frame)) + frame)
+
+        (length, ) = struct.unpack(">I", self.readAll(4))
+        frame = self.readAll(length)
+        (replyId, error) = struct.unpack(">II", frame[:8])
+        if replyId != id:
+            raise Exception("reply for %d, not %d" % (replyId, id))
+
+        if error: return (error, frame[8:].decode("utf8"))
+        return (0, self.loadgen.decode(frame, 8)[0])
+
+    def close(self):
+        self.sock.close()
+
+
+def waitForSocket(path, process):
+    deadline = time.time() + TIMEOUT
+    while time.time() < deadline:
+        if os.path.exists(path): return True
+        if process.poll() is not None: return False
+        time.sleep(0.05)
+    return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description = "Test the dispatcher")
+    parser.add_argument("--dispatch", required = True, help = "pixie-dispatch")
+    parser.add_argument("--trace", required = True, help = "loadgen trace")
+    args = parser.parse_args()
+
+    loadgenPath = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+      "..", "..", "tools", "loadgen.py")
+    loadgen = loadTool("loadgen.py")
+
+    failed = [ ]
+    def check(cond, message):
+        if not cond:
+            print("dispatch: %s" % message)
+            failed.append(message)
+
+    scratch = tempfile.mkdtemp(prefix = "pixie-dispatch-")
+    path = os.path.join(scratch, "pixie.sock")
+
+    # Logged to a file, as it logs every request
+    log = open(os.path.join(scratch, "dispatch.log"), "w+b")
+    process = subprocess.Popen([ args.dispatch, "--socket", path ],
+      stdout = log, stderr = subprocess.STDOUT)
+
+    try:
+        if not waitForSocket(path, process):
+            print("dispatch: not listening")
+            sys.exit(1)
+
+        # Calls, checking the results
+        conn = Connection(path, loadgen)
+
+        (error, result) = conn.call("ffx_accounts", [ ])
+        check(error == 0 and len(result) == 1 and
+          len(result[0]) == ADDRESS_LENGTH, "accounts: %r" % (result, ))
+        address = result[0] if error == 0 else None
+
+        (error, result) = conn.call("ffx_capabilities", [ ])
+        check(error == 0 and "ffx_batch" in result and
+          "ffx_uploadBegin" in result, "capabilities: %r" % (result, ))
+
+        (error, result) = conn.call("ffx_batch", [ [ "ffx_accounts", [ ] ],
+          [ "ffx_missing", [ ] ] ])
+        check(error == 0 and result[0] == [ address ] and
+          result[1].get("error") == 1, "batch: %r" % (result, ))
+
+        (error, result) = conn.call("ffx_batch", [ [ "ffx_capabilities",
+          [ ] ], [ "ffx_accounts", [ ] ] ])
+        check(error == 0 and result[0].get("error") == ERROR_TOO_LARGE and
+          result[1] == [ address ], "batched capabilities: %r" % (result, ))
+
+        (error, result) = conn.call("ffx_missing", [ ])
+        check(error == 1, "unknown method: error=%d" % error)
+
+        # A batch too large for a message, in chunks of the minimum size
+        payload = loadgen.encode([ [ "ffx_accounts", [ ] ],
+          [ "ffx_accounts", [ 0 ] ] ])
+        (error, ack) = conn.call("ffx_uploadBegin", [ "ffx_batch",
+          len(payload), 0 ])
+        check(error == 0, "upload begin: %r" % (ack, ))
+        if error == 0:
+            chunk = ack["chunk"]
+            count = (len(payload) + chunk - 1) // chunk
+            check(count > 1, "upload: a single chunk")
+            for seq in range(count):
+                (error, result) = conn.call("ffx_uploadChunk", [ ack["upload"],
+                  seq, payload[seq * chunk:(seq + 1) * chunk] ])
+                if seq < count - 1:
+                    check(error == 0 and result["next"] == seq + 1,
+                      "upload chunk %d: %r" % (seq, result))
+            check(error == 0 and result == [ [ address ], [ address ] ],
+              "upload result: %r" % (result, ))
+
+        conn.close()
+
+        # Replayed by loadgen
+        summary = os.path.join(scratch, "summary.json")
+        run = subprocess.run([ sys.executable, loadgenPath, "--socket", path,
+          "--trace", args.trace, "--count", str(LOADGEN_COUNT), "--json",
+          summary ])
+        check(run.returncode == 0, "loadgen failed")
+        if run.returncode == 0:
+            with open(summary) as fp:
+                stats = json.load(fp)
+            total = sum(s["count"] for s in stats.values())
+            check(total == LOADGEN_COUNT, "loadgen: %d replies" % total)
+
+        missing = os.path.join(scratch, "missing.jsonl")
+        with open(missing, "w") as fp:
+            fp.write(json.dumps({ "method": "ffx_missing" }) + "\n")
+        run = subprocess.run([ sys.executable, loadgenPath, "--socket", path,
+          "--trace", missing ], stdout = subprocess.DEVNULL)
+        check(run.returncode == 1, "loadgen passed unknown methods")
+
+    finally:
+        process.send_signal(signal.SIGINT)
+        try:
+            process.wait(timeout = TIMEOUT)
+        except subprocess.TimeoutExpired:
+            process.kill()
+            process.wait()
+
+        log.seek(0)
+        lines = log.read().decode("utf8", "replace").split("\n")
+        print("\n".join(line for line in lines
+          if line.startswith("[host]") or line.startswith("[socket]")))
+
+    check(process.returncode == 0, "exit status %d" % process.returncode)
+
+    if failed: sys.exit(1)
+
+    print("dispatch: ok")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,83 @@
+// Collision broadphase: the grid finds the same overlaps as a brute-force
+// scan, and items dropped when the grid is full are counted.
+
+#include <stdlib.h>
+
+#include "entities.h"
+
+#include "test.h"
+
+
+// The first of the %count% entities from %first% overlapping %index%
+static int findBrute(Entities *entities, int first, int count, int index) {
+    for (int i = first; i < first + count; i++) {
+        if (i == index || !entitiesIsAlive(entities, i)) { continue; }
+        if (entitiesOverlap(entities, index, i)) { return i; }
+    }
+    return -1;
+}
+
+int main() {
+    static Entities entities;
+    static EntityGrid grid;
+
+    // A formation of 5 rows by 11 columns, in rows down the screen, with
+    // points scattered over (and beyond) it
+    {
+        entitiesInit(&entities);
+        for (int r = 0; r < 5; r++) {
+            for (int c = 0; c < 11; c++) {
+                entitiesAdd(&entities, c * 240 / 11, r * 240 / 5, 20, 26, 0);
+            }
+        }
+        const int formation = entities.count;
+        CHECK(entities.x[1] > entities.x[0] && entities.y[11] >
+          entities.y[0], "formation layout");
+
+        // Some dead, which neither may find
+        for (int i = 0; i < formation; i += 7) {
+            entitiesSetAlive(&entities, i, false);
+        }
+
+        srand(42);
+        for (int i = 0; i < 64; i++) {
+            entitiesAdd(&entities, rand() % 280 - 20, rand() % 280 - 20,
+              0, 0, 0);
+        }
+
+        entityGridBuild(&grid, &entities, 0, formation);
+        CHECK(grid.overflow == 0, "overflow=%d", grid.overflow);
+
+        int mismatches = 0, hits = 0;
+        for (int p = formation; p < entities.count; p++) {
+            int brute = findBrute(&entities, 0, formation, p);
+            int found = entityGridFindOverlap(&grid, &entities, p);
+            if ((brute < 0) != (found < 0)) { mismatches++; }
+            if (found >= 0) {
+                hits++;
+                if (!entitiesOverlap(&entities, p, found)) { mismatches++; }
+            }
+        }
+        CHECK(mismatches == 0, "mismatches=%d", mismatches);
+        CHECK(hits > 0, "hits=%d", hits);
+    }
+
+    // Entities larger than a cell fill the grid; the excess is counted
+    {
+        entitiesInit(&entities);
+        for (int i = 0; i < ENTITIES_MAX; i++) {
+            entitiesAdd(&entities, 0, 0, 100, 100, 0);
+        }
+
+        // Each touches 4x4 cells
+        entityGridBuild(&grid, &entities, 0, entities.count);
+        CHECK(grid.overflow == 16 * ENTITIES_MAX - ENTITY_GRID_MAX_ITEMS,
+          "overflow=%d", grid.overflow);
+
+        // Rebuilding with fewer clears it
+        entityGridBuild(&grid, &entities, 0, 4);
+        CHECK(grid.overflow == 0, "overflow=%d", grid.overflow);
+    }
+
+    TEST_DONE("entities");
+}
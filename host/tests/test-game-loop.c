@@ -0,0 +1,109 @@
+// Fixed-timestep loop, with an injected clock: the step rate follows
+// elapsed time whatever the frame rate, without drift, the interpolation
+// tracks the time into the next step, and long frames are capped.
+
+#include <string.h>
+
+#include "game-loop.h"
+
+#include "test.h"
+
+
+static void countStep(void *arg) {
+    uint32_t *count = arg;
+    (*count)++;
+}
+
+// Render %frames% frames alternating between %a% and %b% ms after %now%;
+// returns the steps run
+static uint32_t run(GameLoop *loop, uint32_t *now, uint32_t frames,
+  uint32_t a, uint32_t b) {
+
+    uint32_t steps = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        *now += (i & 1) ? b: a;
+        steps += gameLoopUpdate(loop, *now);
+    }
+    return steps;
+}
+
+int main() {
+    // The same steps for the same elapsed time, whether frames come
+    // faster or slower than the period, or jitter
+    {
+        const uint32_t intervals[][2] = {
+            { 11, 11 }, { 33, 33 }, { 50, 50 }, { 20, 46 }, { 5, 61 }
+        };
+
+        for (int i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+            uint32_t count = 0;
+            GameLoop loop;
+            gameLoopInit(&loop, 33, 34, countStep, &count);
+            CHECK(gameLoopGetPeriod(&loop) == 33, "period=%d",
+              gameLoopGetPeriod(&loop));
+
+            uint32_t now = 1000;
+            CHECK(gameLoopUpdate(&loop, now) == 0, "first frame starts clock");
+
+            // 33 s of frames
+            uint32_t a = intervals[i][0], b = intervals[i][1];
+            uint32_t frames = 2 * 33000 / (a + b);
+            uint32_t steps = run(&loop, &now, frames, a, b);
+            CHECK(steps == 1000 && count == 1000, "%d/%d ms: steps=%d", a, b,
+              steps);
+            CHECK(gameLoopGetAlpha(&loop) == 0, "%d/%d ms: alpha=%d", a, b,
+              gameLoopGetAlpha(&loop));
+        }
+    }
+
+    // Between steps, the alpha (and so the interpolation) follows the time
+    // into the next step
+    {
+        uint32_t count = 0;
+        GameLoop loop;
+        gameLoopInit(&loop, 32, 34, countStep, &count);
+
+        uint32_t now = 0;
+        gameLoopUpdate(&loop, now);
+
+        now += 8;
+        CHECK(gameLoopUpdate(&loop, now) == 0, "early frame stepped");
+        CHECK(gameLoopGetAlpha(&loop) == GAME_LOOP_ONE / 4, "alpha=%d",
+          gameLoopGetAlpha(&loop));
+        CHECK(gameLoopLerp(&loop, 100, 200) == 125, "lerp=%d",
+          gameLoopLerp(&loop, 100, 200));
+
+        now += 32;
+        CHECK(gameLoopUpdate(&loop, now) == 1, "late frame steps");
+        CHECK(gameLoopLerp(&loop, 100, 200) == 125, "lerp=%d",
+          gameLoopLerp(&loop, 100, 200));
+    }
+
+    // A given period steps with elapsed time, without drift, across tick
+    // wrap-around
+    {
+        uint32_t count = 0;
+        GameLoop loop;
+        gameLoopInit(&loop, 16, 34, countStep, &count);
+
+        uint32_t now = 0xffffffff - 5000;
+        CHECK(gameLoopUpdate(&loop, now) == 0, "first frame starts clock");
+
+        uint32_t steps = run(&loop, &now, 3000, 23, 11);
+        CHECK(steps == 3000 * 17 / 16, "steps=%d", steps);
+        CHECK(gameLoopGetAlpha(&loop) == GAME_LOOP_ONE / 2, "alpha=%d",
+          gameLoopGetAlpha(&loop));
+
+        // A stall runs at most GAME_LOOP_MAX_STEPS and drops the rest,
+        // keeping the fraction of a step
+        now += 16 * 10 + 4;
+        steps = gameLoopUpdate(&loop, now);
+        CHECK(steps == GAME_LOOP_MAX_STEPS, "stall steps=%d", steps);
+        CHECK(loop.stats.dropped == 16 * (10 - GAME_LOOP_MAX_STEPS),
+          "dropped=%d", loop.stats.dropped);
+        CHECK(gameLoopGetAlpha(&loop) == GAME_LOOP_ONE * 3 / 4, "alpha=%d",
+          gameLoopGetAlpha(&loop));
+    }
+
+    TEST_DONE("game-loop");
+}
@@ -0,0 +1,141 @@
+// The media file and its streaming cache, through the FILE* backend:
+// lookups, cache hits, reads which cross a chunk and those which wrap
+// into the spill area.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "media.h"
+
+#include "test.h"
+
+
+#define PATH          ("test-media.bin")
+
+// Not a multiple of the chunk size, so the entry ends mid-chunk
+#define ENTRY_OFFSET  (MEDIA_HEADER_SIZE + 2 * MEDIA_ENTRY_SIZE)
+#define ENTRY_LENGTH  (3 * MEDIA_CHUNK_SIZE + 700)
+
+
+static uint8_t getByte(uint32_t offset) {
+    return (offset * 7 + (offset >> 8)) & 0xff;
+}
+
+static void writeU32(uint8_t *data, uint32_t value) {
+    for (int i = 0; i < 4; i++) { data[i] = value >> (8 * i); }
+}
+
+// A media file with an empty entry and a patterned one
+static void writeMedia() {
+    size_t length = ENTRY_OFFSET + ENTRY_LENGTH;
+    uint8_t *data = calloc(1, length);
+
+    memcpy(data, "FFXM", 4);
+    data[4] = 1;
+    data[6] = 2;
+    writeU32(&data[8], length);
+
+    uint8_t *entry = &data[MEDIA_HEADER_SIZE];
+    strcpy((char*)entry, "empty");
+    writeU32(&entry[MEDIA_NAME_LENGTH], ENTRY_OFFSET);
+    writeU32(&entry[MEDIA_NAME_LENGTH + 4], 0);
+
+    entry += MEDIA_ENTRY_SIZE;
+    strcpy((char*)entry, "pattern");
+    writeU32(&entry[MEDIA_NAME_LENGTH], ENTRY_OFFSET);
+    writeU32(&entry[MEDIA_NAME_LENGTH + 4], ENTRY_LENGTH);
+
+    for (uint32_t i = 0; i < ENTRY_LENGTH; i++) {
+        data[ENTRY_OFFSET + i] = getByte(i);
+    }
+
+    FILE *file = fopen(PATH, "wb");
+    fwrite(data, 1, length, file);
+    fclose(file);
+    free(data);
+}
+
+static bool checkRead(MediaCache *cache, uint32_t offset, size_t length) {
+    const uint8_t *data = mediaCacheRead(cache, offset, length);
+    if (data == NULL) { return false; }
+
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] != getByte(offset + i)) { return false; }
+    }
+
+    return true;
+}
+
+int main() {
+    writeMedia();
+
+    Media media;
+    CHECK(mediaOpen(&media, PATH), "open");
+    CHECK(media.count == 2, "count=%d", media.count);
+
+    MediaEntry entry;
+    CHECK(!mediaFind(&media, "missing", &entry), "found a missing entry");
+    CHECK(mediaFind(&media, "pattern", &entry), "pattern not found");
+    CHECK(entry.offset == ENTRY_OFFSET && entry.length == ENTRY_LENGTH,
+      "offset=%d length=%d", entry.offset, entry.length);
+
+    uint8_t *buffer = mediaAllocCache();
+    MediaCache cache;
+    mediaCacheInit(&cache, &media, &entry, buffer);
+
+    // Chunks are aligned to the file, so the entry's first chunk is 0
+    CHECK(checkRead(&cache, 0, 64), "first read");
+    CHECK(cache.reads == 1, "reads=%d", cache.reads);
+
+    // Hits; anywhere within the chunk
+    CHECK(checkRead(&cache, 100, 200), "hit");
+    CHECK(checkRead(&cache, 0, 16), "hit");
+    CHECK(cache.reads == 1, "reads=%d", cache.reads);
+
+    // Crossing from chunk 0 (even half) into chunk 1 (odd half)
+    uint32_t boundary = MEDIA_CHUNK_SIZE - ENTRY_OFFSET;
+    CHECK(checkRead(&cache, boundary - 10, 20), "crossing 0 to 1");
+    CHECK(cache.reads == 2, "reads=%d", cache.reads);
+
+    // Both halves are now loaded; more of either is a hit
+    CHECK(checkRead(&cache, boundary + 500, 300), "hit in chunk 1");
+    CHECK(cache.reads == 2, "reads=%d", cache.reads);
+
+    // Crossing from chunk 1 (odd) into chunk 2 (even) wraps around the
+    // buffer, so the result is made contiguous in the spill area
+    boundary += MEDIA_CHUNK_SIZE;
+    CHECK(checkRead(&cache, boundary - 100, MEDIA_SPILL_SIZE),
+      "crossing 1 to 2");
+    CHECK(cache.reads == 3, "reads=%d", cache.reads);
+
+    // Chunk 0 was replaced by chunk 2
+    CHECK(checkRead(&cache, 0, 8), "reload chunk 0");
+    CHECK(cache.reads == 4, "reads=%d", cache.reads);
+
+    // The last chunk is short; read up to the end of the entry
+    CHECK(checkRead(&cache, ENTRY_LENGTH - 300, 300), "end of entry");
+
+    // Out of range, or too large for the spill area
+    CHECK(mediaCacheRead(&cache, ENTRY_LENGTH - 10, 20) == NULL,
+      "read past the end");
+    CHECK(mediaCacheRead(&cache, 0, MEDIA_SPILL_SIZE + 1) == NULL,
+      "read larger than the spill");
+
+    // Sequential streaming reads each chunk once
+    mediaCacheInit(&cache, &media, &entry, buffer);
+    for (uint32_t offset = 0; offset + 100 <= ENTRY_LENGTH; offset += 100) {
+        if (!checkRead(&cache, offset, 100)) {
+            CHECK(false, "streaming read at %d", offset);
+            break;
+        }
+    }
+    uint32_t chunks = (ENTRY_OFFSET + ENTRY_LENGTH + MEDIA_CHUNK_SIZE - 1) /
+      MEDIA_CHUNK_SIZE;
+    CHECK(cache.reads == chunks, "reads=%d chunks=%d", cache.reads, chunks);
+
+    free(buffer);
+    mediaClose(&media);
+    remove(PATH);
+
+    TEST_DONE("media");
+}
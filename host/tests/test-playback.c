@@ -0,0 +1,133 @@
+// Frame pacing of the playback scheduler, with an injected clock: the
+// frame shown follows the clock without drift, late updates drop (or
+// hold) frames, and tick wrap-around is handled.
+
+#include <string.h>
+
+#include "playback.h"
+
+#include "test.h"
+
+
+static uint16_t durations[] = { 50, 150, 100, 0 };
+
+static uint16_t getDuration(void *arg, uint32_t frame) {
+    uint16_t *values = arg;
+    return values[frame];
+}
+
+// The frame due at %elapsed% ms, for a clip of %count% frames
+static uint32_t getExpected(uint16_t *values, uint32_t count,
+  uint32_t elapsed) {
+
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        total += values[i] ? values[i]: 1;
+    }
+
+    elapsed %= total;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t duration = values[i] ? values[i]: 1;
+        if (elapsed < duration) { return i; }
+        elapsed -= duration;
+    }
+
+    return 0;
+}
+
+// Update every %step% ms for %length% ms from %start%, checking the frame
+// shown at each is the one due
+static void checkPacing(PlaybackPolicy policy, uint32_t start,
+  uint32_t step, uint32_t length) {
+
+    uint16_t values[] = { 100, 100, 100, 100, 100 };
+
+    Playback playback;
+    playbackInit(&playback, 5, getDuration, values, policy);
+
+    uint32_t mismatches = 0;
+    for (uint32_t t = 0; t <= length; t += step) {
+        playbackUpdate(&playback, start + t);
+        if (playback.frame != getExpected(values, 5, t)) { mismatches++; }
+    }
+
+    CHECK(mismatches == 0, "start=%u step=%d mismatches=%d", start, step,
+      mismatches);
+    CHECK(playback.stats.late == 0, "late=%d", playback.stats.late);
+}
+
+int main() {
+    // No drift over a long run, at the frame rate and off it; starting
+    // just before the tick counter wraps
+    checkPacing(PlaybackPolicySkip, 0, 16, 60000);
+    checkPacing(PlaybackPolicySkip, 1000, 7, 60000);
+    checkPacing(PlaybackPolicyHold, 0, 16, 60000);
+    checkPacing(PlaybackPolicySkip, 0xffffffff - 5000, 16, 20000);
+
+    // Variable durations (a 0 is shown for 1 ms)
+    {
+        Playback playback;
+        playbackInit(&playback, 4, getDuration, durations,
+          PlaybackPolicySkip);
+
+        uint32_t mismatches = 0;
+        for (uint32_t t = 0; t <= 10000; t++) {
+            playbackUpdate(&playback, t);
+            if (playback.frame != getExpected(durations, 4, t)) {
+                mismatches++;
+            }
+        }
+        CHECK(mismatches == 0, "variable: mismatches=%d", mismatches);
+        CHECK(playback.stats.dropped == 0, "dropped=%d",
+          playback.stats.dropped);
+    }
+
+    // A stall; skipping drops the frames missed and stays on schedule
+    {
+        uint16_t values[] = { 100, 100, 100, 100, 100 };
+
+        Playback playback;
+        playbackInit(&playback, 5, getDuration, values, PlaybackPolicySkip);
+
+        CHECK(playbackUpdate(&playback, 0), "first frame");
+        CHECK(!playbackUpdate(&playback, 99), "changed early");
+        CHECK(playbackUpdate(&playback, 350), "after the stall");
+        CHECK(playback.frame == 3, "frame=%d", playback.frame);
+        CHECK(playback.stats.dropped == 2, "dropped=%d",
+          playback.stats.dropped);
+        CHECK(playback.deadline == 400, "deadline=%u", playback.deadline);
+
+        // A stall of over a loop resyncs to the clock
+        CHECK(playbackUpdate(&playback, 5000), "after a long stall");
+        CHECK(playback.deadline == 5100, "deadline=%u", playback.deadline);
+    }
+
+    // A stall; holding shows every frame, and the schedule moves back
+    {
+        uint16_t values[] = { 100, 100, 100, 100, 100 };
+
+        Playback playback;
+        playbackInit(&playback, 5, getDuration, values, PlaybackPolicyHold);
+
+        playbackUpdate(&playback, 0);
+        CHECK(playbackUpdate(&playback, 350), "after the stall");
+        CHECK(playback.frame == 1, "frame=%d", playback.frame);
+        CHECK(playback.stats.late == 1, "late=%d", playback.stats.late);
+        CHECK(playback.deadline == 450, "deadline=%u", playback.deadline);
+        CHECK(playback.stats.dropped == 0, "dropped=%d",
+          playback.stats.dropped);
+    }
+
+    // A single frame never changes
+    {
+        uint16_t values[] = { 100 };
+
+        Playback playback;
+        playbackInit(&playback, 1, getDuration, values, PlaybackPolicySkip);
+
+        CHECK(playbackUpdate(&playback, 0), "first frame");
+        CHECK(!playbackUpdate(&playback, 1000), "single frame changed");
+    }
+
+    TEST_DONE("playback");
+}
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""
+Runs the panels headless (pixie-host) with the key scripts in this
+directory and checks the frames they write:
+  - each run writes every frame its script asks for and exits cleanly
+  - frames change when the panel should (the cursor moves, the game
+    runs, the review scrolls) and are restored when it returns
+  - the game renders only its damaged fragments, and its frames match
+    rendering every fragment
+  - the GIF panel decodes the video from the media file onto the screen
+  - the review builds every row on screen after a scroll longer than
+    its node pools, and scrolling back restores it
+  - selecting the approve button pops the review with its result
+
+The frames are left in test-render/ (in the working directory, which
+also holds the media file) for inspection or as golden images.
+"""
+
+import argparse
+import importlib.util
+import os
+import re
+import subprocess
+import sys
+
+
+OUTPUT = "test-render"
+
+# Of the screen, for a frame to count as showing the video
+MIN_VIDEO_COVERAGE = 0.5
+
+# Above the approve button, the sample review is a column of text rows;
+# no band of this height may be blank
+INFO_ROWS_BOTTOM = 140
+INFO_BAND = 12
+
+
+def loadTool(name):
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+      "..", "tools", name)
+    spec = importlib.util.spec_from_file_location(name.split(".")[0], path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+def main():
+    parser = argparse.ArgumentParser(description = "Test headless rendering")
+    parser.add_argument("--host", required = True, help = "pixie-host")
+    parser.add_argument("--scripts", required = True,
+      help = "directory of the render-*.keys scripts")
+    args = parser.parse_args()
+
+    pngfile = loadTool("pngfile.py")
+
+    os.makedirs(OUTPUT, exist_ok = True)
+
+    failed = [ ]
+    def check(cond, message):
+        if not cond:
+            print("render: %s" % message)
+            failed.append(message)
+
+    frames = { }
+    results = { }
+    fragments = { }
+
+    # The space game twice, first rendering every fragment; its frames are
+    # kept with a "full-" prefix
+    runs = [ ("menu", "on"), ("space", "off"), ("space", "on"), ("info", "on") ]
+    for (panel, damage) in runs:
+        script = os.path.join(args.scripts, "render-%s.keys" % panel)
+        with open(script) as f:
+            paths = re.findall(r"^\s*\d+\s+frame\s+(\S+)", f.read(), re.M)
+
+        for path in paths:
+            if os.path.exists(path): os.remove(path)
+
+        run = subprocess.run([ args.host, "--panel", panel,
+          "--script", script, "--damage", damage ], capture_output = True,
+          text = True)
+        sys.stdout.write(run.stdout)
+        check(run.returncode == 0, "%s: exit %d" % (panel, run.returncode))
+
+        match = re.search(r"\[host\] %s: result=(-?\d+) frames=(\d+) "
+          "written=(\d+) fragments=(\d+)" % panel, run.stdout)
+        check(match is not None, "%s: no summary" % panel)
+        if match is None: continue
+
+        results[panel] = int(match.group(1))
+        fragments[(panel, damage)] = int(match.group(4))
+        check(int(match.group(3)) == len(paths), "%s: wrote %s of %d frames"
+          % (panel, match.group(3), len(paths)))
+
+        for path in paths:
+            if not os.path.exists(path):
+                check(False, "%s: missing" % path)
+                continue
+            image = pngfile.read(path)
+            check((image.width, image.height) == (240, 240),
+              "%s: size %dx%d" % (path, image.width, image.height))
+            name = os.path.splitext(os.path.basename(path))[0]
+            if damage == "off": name = "full-" + name
+            frames[name] = image.pixels
+
+    if failed:
+        sys.exit(1)
+
+    def lit(name):
+        return sum(1 for p in frames[name] if p[:3] != (0, 0, 0))
+
+    check(frames["menu-start"] != frames["menu-south"],
+      "menu: cursor did not move")
+    check(frames["menu-back"] == frames["menu-south"],
+      "menu: not restored after the GIF panel")
+    check(lit("gifs") > 240 * 240 * MIN_VIDEO_COVERAGE,
+      "gifs: video not shown (lit=%d)" % lit("gifs"))
+
+    check(frames["space-start"] != frames["space-later"],
+      "space: nothing moved")
+
+    # Fragments left out by the damage must not have changed
+    for name in [ n for n in frames if n.startswith("space-") ]:
+        check(frames[name] == frames["full-" + name],
+          "%s: differs from rendering every fragment" % name)
+    (damaged, full) = (fragments[("space", "on")], fragments[("space", "off")])
+    print("render: space fragments=%d of %d" % (damaged, full))
+    check(damaged < full, "space: rendered every fragment")
+
+    check(frames["info-start"] != frames["info-approve"],
+      "info: did not scroll")
+    check(frames["info-end"] != frames["info-approve"],
+      "info: highlight did not move")
+    check(frames["info-top"] == frames["info-start"],
+      "info: not restored scrolling back to the top")
+    check(frames["info-approve-again"] == frames["info-approve"],
+      "info: differs the second time at approve")
+
+    # The long jump to approve passes more rows than the pools hold; the
+    # rows above the button must all be built once it stops
+    empty = [ y for y in range(0, INFO_ROWS_BOTTOM, INFO_BAND)
+      if all(p[:3] == (0, 0, 0) for p in
+        frames["info-approve"][y * 240:(y + INFO_BAND) * 240]) ]
+    check(not empty, "info: rows missing at y=%s" % empty)
+    check(results.get("info") == 1, "info: result=%s (expected approve)" %
+      results.get("info"))
+
+    if failed:
+        sys.exit(1)
+
+    print("render: ok")
+
+
+if __name__ == "__main__":
+    main()
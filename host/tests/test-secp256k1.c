@@ -0,0 +1,162 @@
+// secp256k1 against known vectors (public keys derived by OpenSSL, and
+// RFC 6979 signatures verified with it), including keys and nonces with
+// zero low digits, which add the same row offset twice unless each row
+// has its own.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "secp256k1.h"
+
+#include "test.h"
+
+
+typedef struct PubkeyVector {
+    const char *privkey;
+    const char *pubkey;
+} PubkeyVector;
+
+typedef struct SignVector {
+    const char *privkey;
+    const char *digest;
+    const char *signature;
+} SignVector;
+
+static const PubkeyVector pubkeys[] = {
+    { "0000000000000000000000000000000000000000000000000000000000000001",
+      "0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f817"
+      "98483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4"
+      "b8" },
+    { "0000000000000000000000000000000000000000000000000000000000000002",
+      "04c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709e"
+      "e51ae168fea63dc339a3c58419466ceaeef7f632653266d0e1236431a950cfe5"
+      "2a" },
+    { "0000000000000000000000000000000000000000000000000000000000000003",
+      "04f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036"
+      "f9388f7b0f632de8140fe337e62a37f3566500a99934c2231b6cb9fd7584b8e6"
+      "72" },
+    { "0000000000000000000000000000000000000000000000000000000000000010",
+      "04e60fce93b59e9ec53011aabc21c23e97b2a31369b87a5ae9c44ee89e2a6dec"
+      "0af7e3507399e595929db99f34f57937101296891e44d23f0be1f32cce696168"
+      "21" },
+    { "0000000000000000000000000000000000000000000000000000000000000100",
+      "048282263212c609d9ea2a6e3e172de238d8c39cabd5ac1ca10646e23fd5f515"
+      "0811f8a8098557dfe45e8256e830b60ace62d613ac2f7b17bed31b6eaff6e26c"
+      "af" },
+    { "0000000000000000000000000000000000000000000000000000000001234500",
+      "04a7d275912903620f26bfe42e00c058ee494025edb71d960f2f310a12f9ff56"
+      "de89210eedbeec498fcb87c8669f361c2aec4f754dddfecab3e0cba061a43e11"
+      "a0" },
+    { "0000000000000000000000000000000000000000000000000000000100000000",
+      "04100f44da696e71672791d0a09b7bde459f1215a29b3c03bfefd7835b39a48d"
+      "b0cdd9e13192a00b772ec8f3300c090666b7ff4a18ff5195ac0fbd5cd62bc65a"
+      "09" },
+    { "0000000000000000000000000000000100000000000000000000000000000000",
+      "048f68b9d2f63b5f339239c1ad981f162ee88c5678723ea3351b7b444c9ec4c0"
+      "da662a9f2dba063986de1d90c2b6be215dbbea2cfe95510bfdf23cbf79501fff"
+      "82" },
+    { "8000000000000000000000000000000000000000000000000000000000000000",
+      "04b23790a42be63e1b251ad6c94fdef07271ec0aada31db6c3e8bd32043f8be3"
+      "84fc6b694919d55edbe8d50f88aa81f94517f004f4149ecb58d10a473deb1988"
+      "0e" },
+    { "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140",
+      "0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f817"
+      "98b7c52588d95c3b9aa25b0403f1eef75702e84bb7597aabe663b82f6f04ef27"
+      "77" },
+    { "9f73cd7c814a8bd49a0e65c7aabb168faf0a60eab60a5aadbec520490f0c0f49",
+      "0428adc5f32a79bb488f32e97926c680548068cc83f6bad8a6bfbdbc3eb9ed89"
+      "2249a3d1a1cc585c7674be5d6e90f46069dff2ce342499bbf1349163ede88fa1"
+      "31" },
+};
+
+static const SignVector signatures[] = {
+    // sha256("Satoshi Nakamoto")
+    { "0000000000000000000000000000000000000000000000000000000000000001",
+      "a0dc65ffca799873cbea0ac274015b9526505daaaed385155425f7337704883e",
+      "934b1ea10a4b3c1757e2b0c017d0b6143ce3c9a7e6a4a49860d7a6ab210ee3d8"
+      "2442ce9d2b916064108014783e923ec36b49743e2ffa1c4496f01a512aafd9e5"
+      "01" },
+    // sha256("pixie")
+    { "0000000000000000000000000000000000000000000000000000000001234500",
+      "9f73cd7c814a8bd49a0e65c7aabb168faf0a60eab60a5aadbec520490f0c0f49",
+      "475c8ffc7e36df4ce6ce3b7af0d6683355843f762773bfe8062ef330428d6de4"
+      "6d0e9f4847a6b33bd5e885ed411179c8e38ca12c2a8b36a23728c55e6352e595"
+      "00" },
+    // sha256("pixie 861"); low 8 bits of k zero
+    { "0000000000000000000000000000000000000000000000000000000000000001",
+      "c19364508bf855d78a8e8331a6345450436900b862110880de57b66c04053b51",
+      "4432646246e35841b1e59fd3f7cfa239ab95a28011433744c70edf8f710152e3"
+      "004c1913d821960d3aa701c24b0ea9162cddd73d356b087686af1bc1f7898f96"
+      "01" },
+    // sha256("pixie 7633"); low 12 bits of k zero
+    { "0000000000000000000000000000000000000000000000000000000001234500",
+      "ec0433c40a0c67af08934b79805a784481141f7c82889258e51004adef1d35fe",
+      "1d3fd9762d7df15a667ba6fcf61af3d27bf8a33ecba05c28529abd2aac21b241"
+      "283888efa81b0b556367367c027c9cbaa8cc7ce84df5a07876dbd2a2e8be917b"
+      "01" },
+    // sha256("pixie 106"); low 8 bits of k zero
+    { "8000000000000000000000000000000000000000000000000000000000000000",
+      "227a1a8ddeef6497f4ff33bf32e3eead55b123209452e09d2a686b4ea28a184b",
+      "8ec7dd94d2b8c9948261a0b914810d869b93ea6589d7f04b3d42fd277ad67fb0"
+      "32bdd93a59cf3f728c4cb14d9fc067ead74620107f539e397b614ecfd4999d7b"
+      "00" },
+};
+
+#define COUNT(array)    (sizeof(array) / sizeof((array)[0]))
+
+
+static void fromHex(uint8_t *data, const char *hex, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        char byte[3] = { hex[2 * i], hex[2 * i + 1], 0 };
+        data[i] = strtoul(byte, NULL, 16);
+    }
+}
+
+int main() {
+    for (int i = 0; i < COUNT(pubkeys); i++) {
+        uint8_t privkey[SECP256K1_PRIVKEY_LENGTH];
+        fromHex(privkey, pubkeys[i].privkey, sizeof(privkey));
+
+        uint8_t expected[SECP256K1_PUBKEY_LENGTH];
+        fromHex(expected, pubkeys[i].pubkey, sizeof(expected));
+
+        uint8_t pubkey[SECP256K1_PUBKEY_LENGTH];
+        bool success = secp256k1ComputePubkey(pubkey, privkey);
+        CHECK(success && !memcmp(pubkey, expected, sizeof(pubkey)),
+          "pubkey: privkey=%s", pubkeys[i].privkey);
+    }
+
+    for (int i = 0; i < COUNT(signatures); i++) {
+        uint8_t privkey[SECP256K1_PRIVKEY_LENGTH];
+        fromHex(privkey, signatures[i].privkey, sizeof(privkey));
+
+        uint8_t digest[SECP256K1_DIGEST_LENGTH];
+        fromHex(digest, signatures[i].digest, sizeof(digest));
+
+        uint8_t expected[SECP256K1_SIGNATURE_LENGTH];
+        fromHex(expected, signatures[i].signature, sizeof(expected));
+
+        uint8_t signature[SECP256K1_SIGNATURE_LENGTH];
+        bool success = secp256k1Sign(signature, privkey, digest);
+        CHECK(success && !memcmp(signature, expected, sizeof(signature)),
+          "sign: privkey=%s digest=%s", signatures[i].privkey,
+          signatures[i].digest);
+    }
+
+    // Keys out of [1, n) are rejected
+    {
+        uint8_t privkey[SECP256K1_PRIVKEY_LENGTH] = { 0 };
+        uint8_t pubkey[SECP256K1_PUBKEY_LENGTH];
+        uint8_t signature[SECP256K1_SIGNATURE_LENGTH];
+        uint8_t digest[SECP256K1_DIGEST_LENGTH] = { 0 };
+
+        CHECK(!secp256k1ComputePubkey(pubkey, privkey), "pubkey: zero");
+        CHECK(!secp256k1Sign(signature, privkey, digest), "sign: zero");
+
+        fromHex(privkey, "ffffffffffffffffffffffffffffff"
+          "febaaedce6af48a03bbfd25e8cd0364141", sizeof(privkey));
+        CHECK(!secp256k1ComputePubkey(pubkey, privkey), "pubkey: n");
+    }
+
+    TEST_DONE("secp256k1");
+}
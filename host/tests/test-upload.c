@@ -0,0 +1,167 @@
+// Chunked uploads, with an injected clock: chunks may arrive out of
+// order within the window, resends and chunks beyond the window are
+// ignored, the last chunk holds the remainder, a client can resume from
+// the progress after reconnecting, and an idle upload expires.
+
+#include <string.h>
+
+#include "upload.h"
+
+#include "test.h"
+
+
+#define CHUNK_SIZE      (UPLOAD_CHUNK_MIN)
+#define MTU             (CHUNK_SIZE + UPLOAD_OVERHEAD)
+
+// Past a full window, with a short last chunk
+#define LENGTH          ((UPLOAD_WINDOW + 4) * CHUNK_SIZE + 5)
+#define CHUNK_COUNT     ((LENGTH + CHUNK_SIZE - 1) / CHUNK_SIZE)
+
+
+static uint8_t payload[LENGTH];
+
+static UploadStatus sendChunk(Upload *upload, uint32_t seq, uint32_t now) {
+    size_t offset = seq * CHUNK_SIZE;
+    size_t length = LENGTH - offset;
+    if (length > CHUNK_SIZE) { length = CHUNK_SIZE; }
+    return uploadChunk(upload, upload->id, seq, &payload[offset], length,
+      now);
+}
+
+int main() {
+    for (int i = 0; i < LENGTH; i++) { payload[i] = i * 7 + 3; }
+
+    uint8_t buffer[1024];
+    Arena arena;
+    arenaInit(&arena, buffer, sizeof(buffer));
+
+    Upload upload;
+    uploadInit(&upload);
+
+    // Chunks sized from the link
+    {
+        CHECK(uploadBegin(&upload, &arena, "ffx_test", LENGTH, MTU, 0) ==
+          UploadStatusOk, "begin");
+        CHECK(upload.chunkSize == CHUNK_SIZE, "chunkSize=%d",
+          upload.chunkSize);
+        CHECK(upload.chunkCount == CHUNK_COUNT, "chunkCount=%d",
+          upload.chunkCount);
+
+        // Only one upload at a time
+        Upload other = upload;
+        CHECK(uploadBegin(&other, &arena, "ffx_test", LENGTH, MTU, 10) ==
+          UploadStatusBusy, "second begin");
+
+        uploadInit(&other);
+        CHECK(uploadBegin(&other, &arena, "ffx_test", 4096, MTU, 0) ==
+          UploadStatusTooLarge, "too large");
+        CHECK(uploadBegin(&other, &arena, "ffx_test", 0, MTU, 0) ==
+          UploadStatusInvalid, "empty");
+    }
+
+    // Out of order within the window; the first missing chunk holds the
+    // rest back
+    {
+        CHECK(sendChunk(&upload, 2, 100) == UploadStatusOk, "chunk 2");
+        CHECK(sendChunk(&upload, 1, 110) == UploadStatusOk, "chunk 1");
+        CHECK(upload.next == 0 && upload.received == 0x6,
+          "next=%d received=0x%lx", upload.next, upload.received);
+
+        CHECK(sendChunk(&upload, 0, 120) == UploadStatusOk, "chunk 0");
+        CHECK(upload.next == 3 && upload.received == 0,
+          "next=%d received=0x%lx", upload.next, upload.received);
+    }
+
+    // The window edge: the last chunk inside it is stored, the first
+    // beyond it is ignored (and must be resent)
+    {
+        uint32_t last = upload.next + UPLOAD_WINDOW - 1;
+        CHECK(sendChunk(&upload, last, 130) == UploadStatusOk, "last in");
+        CHECK(upload.received == (1 << (UPLOAD_WINDOW - 1)),
+          "received=0x%lx", upload.received);
+
+        CHECK(sendChunk(&upload, last + 1, 140) == UploadStatusOk,
+          "beyond");
+        CHECK(upload.received == (1 << (UPLOAD_WINDOW - 1)),
+          "beyond stored: received=0x%lx", upload.received);
+    }
+
+    // Resends of chunks already received change nothing
+    {
+        uint32_t next = upload.next, received = upload.received;
+        CHECK(sendChunk(&upload, 1, 150) == UploadStatusOk, "resend 1");
+        CHECK(sendChunk(&upload, upload.next + UPLOAD_WINDOW - 1, 150) ==
+          UploadStatusOk, "resend in window");
+        CHECK(upload.next == next && upload.received == received,
+          "next=%d received=0x%lx", upload.next, upload.received);
+    }
+
+    // Chunks of the wrong size, or past the end, are refused
+    {
+        CHECK(uploadChunk(&upload, upload.id, 4, payload, CHUNK_SIZE - 1,
+          150) == UploadStatusInvalid, "short chunk");
+        CHECK(uploadChunk(&upload, upload.id, CHUNK_COUNT - 1, payload,
+          CHUNK_SIZE, 150) == UploadStatusInvalid, "full last chunk");
+        CHECK(uploadChunk(&upload, upload.id, CHUNK_COUNT, payload, 5,
+          150) == UploadStatusInvalid, "past the end");
+        CHECK(uploadChunk(&upload, upload.id + 1, 4, payload, CHUNK_SIZE,
+          150) == UploadStatusUnknown, "other id");
+    }
+
+    // Resume after a (long, but not expired) gap: the progress says what
+    // is missing, and the rest completes it, with the short last chunk
+    {
+        uint32_t now = 150 + UPLOAD_TIMEOUT - 1;
+        CHECK(!uploadExpire(&upload, now), "expired while resuming");
+
+        UploadStatus status = UploadStatusOk;
+        for (uint32_t seq = upload.next; seq < CHUNK_COUNT; seq++) {
+            if (seq < upload.next) { continue; }
+            if (upload.received & (1 << (seq - upload.next))) { continue; }
+            status = sendChunk(&upload, seq, now);
+            CHECK(status == UploadStatusOk ||
+              (status == UploadStatusComplete && seq == CHUNK_COUNT - 1),
+              "seq=%d status=%d", seq, status);
+        }
+
+        CHECK(status == UploadStatusComplete, "status=%d", status);
+        CHECK(memcmp(upload.data, payload, LENGTH) == 0, "payload differs");
+
+        uploadFinish(&upload);
+        CHECK(!uploadIsActive(&upload), "active after finish");
+    }
+
+    // An idle upload expires; until then it is kept, and afterwards its
+    // chunks are unknown and a new upload may begin
+    {
+        arenaReset(&arena);
+        CHECK(uploadBegin(&upload, &arena, "ffx_test", LENGTH, MTU, 5000) ==
+          UploadStatusOk, "begin");
+        uint32_t id = upload.id;
+
+        CHECK(sendChunk(&upload, 0, 6000) == UploadStatusOk, "chunk 0");
+
+        CHECK(!uploadExpire(&upload, 6000 + UPLOAD_TIMEOUT - 1),
+          "expired early");
+        CHECK(uploadExpire(&upload, 6000 + UPLOAD_TIMEOUT), "not expired");
+        CHECK(!uploadIsActive(&upload), "active after expiry");
+        CHECK(!uploadExpire(&upload, 6000 + UPLOAD_TIMEOUT), "expired twice");
+
+        CHECK(uploadChunk(&upload, id, 1, &payload[CHUNK_SIZE], CHUNK_SIZE,
+          7000 + UPLOAD_TIMEOUT) == UploadStatusUnknown, "expired chunk");
+
+        // Begin replaces an idle upload itself, with a new id
+        arenaReset(&arena);
+        CHECK(uploadBegin(&upload, &arena, "ffx_test", LENGTH, MTU, 0) ==
+          UploadStatusOk, "begin");
+        CHECK(upload.id != id, "id reused");
+        id = upload.id;
+
+        CHECK(uploadBegin(&upload, &arena, "ffx_other", 8, MTU,
+          UPLOAD_TIMEOUT) == UploadStatusOk, "replace");
+        CHECK(upload.id != id && strcmp(upload.method, "ffx_other") == 0,
+          "not replaced: id=%ld method=%s", upload.id, upload.method);
+    }
+
+    TEST_DONE("upload");
+}
@@ -0,0 +1,27 @@
+#ifndef __TEST_H__
+#define __TEST_H__
+
+// Minimal checks for the host tests; a failed check is reported and
+// the test exits non-zero once done
+
+#include <stdio.h>
+
+
+static int testFailures = 0;
+
+#define CHECK(cond, ...) do { \
+    if (!(cond)) { \
+        printf("[test] %s:%d: %s: ", __FILE__, __LINE__, #cond); \
+        printf(__VA_ARGS__); \
+        printf("\n"); \
+        testFailures++; \
+    } \
+} while (0)
+
+#define TEST_DONE(name) do { \
+    printf("[test] %s: %s\n", (name), testFailures ? "FAILED": "ok"); \
+    return testFailures ? 1: 0; \
+} while (0)
+
+
+#endif /* __TEST_H__ */
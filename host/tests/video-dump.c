@@ -0,0 +1,66 @@
+// Decode every frame of a video in a packed media file, then wrap around
+// to frame 0 (through the loop frame), writing each as RGB565 pixels
+// (little-endian); see test-video.py.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "media.h"
+
+
+static bool writeFrame(FILE *out, Video *video) {
+    const uint16_t *palette = &video->image[3];
+    const uint8_t *indices = (const uint8_t*)&video->image[3 + 256];
+
+    for (int i = 0; i < video->width * video->height; i++) {
+        uint16_t color = palette[indices[i]];
+        uint8_t bytes[2] = { color & 0xff, color >> 8 };
+        if (fwrite(bytes, 1, 2, out) != 2) { return false; }
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        fprintf(stderr, "usage: video-dump MEDIA NAME OUTPUT\n");
+        return 2;
+    }
+
+    Media media;
+    if (!mediaOpen(&media, argv[1])) { return 1; }
+
+    size_t imageSize = VIDEO_IMAGE_SIZE(240, 240);
+    uint16_t *image = malloc(imageSize);
+    uint8_t *cache = mediaAllocCache();
+
+    MediaVideo player;
+    if (!mediaVideoOpen(&player, &media, argv[2], image, imageSize, cache)) {
+        return 1;
+    }
+
+    Video *video = &player.video;
+
+    FILE *out = fopen(argv[3], "wb");
+    if (out == NULL) { return 1; }
+
+    for (uint32_t frame = 0; frame <= video->frameCount; frame++) {
+        if (!videoSeek(video, frame % video->frameCount) ||
+          !writeFrame(out, video)) {
+            fprintf(stderr, "video-dump: frame %d failed\n", frame);
+            return 1;
+        }
+    }
+
+    fclose(out);
+
+    printf("video-dump: %s: %d frames (%d flash reads)\n", argv[2],
+      video->frameCount, player.cache.reads);
+
+    mediaVideoClose(&player);
+    mediaClose(&media);
+    free(cache);
+    free(image);
+
+    return 0;
+}
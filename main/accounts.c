@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "firefly-hollows.h"
+
+#include "accounts.h"
+#include "secp256k1.h"
+#include "utils.h"
+
+
+// Only public material is kept; the private key is fetched for the
+// derivation and wiped immediately after.
+typedef struct Account {
+    bool valid;
+    uint32_t index;
+
+    // Last use, for choosing which entry to replace
+    uint32_t used;
+
+    FfxEcPubkey pubkey;
+    FfxAddress address;
+} Account;
+
+// Requests are all handled on the panel task, so there is no locking
+static Account accounts[ACCOUNTS_CACHE_SIZE] = { 0 };
+
+// Bumped on each use; only needs to order the entries
+static uint32_t useCount = 0;
+
+
+static Account* findAccount(uint32_t index) {
+    for (int i = 0; i < ACCOUNTS_CACHE_SIZE; i++) {
+        Account *account = &accounts[i];
+        if (account->valid && account->index == index) { return account; }
+    }
+    return NULL;
+}
+
+// An uncompressed point which is not at infinity (all zeros)
+static bool isValidPubkey(const FfxEcPubkey *pubkey) {
+    if (pubkey->data[0] != 0x04) { return false; }
+
+    uint8_t bits = 0;
+    for (int i = 1; i < sizeof(pubkey->data); i++) { bits |= pubkey->data[i]; }
+    return (bits != 0);
+}
+
+static bool deriveAccount(Account *account, uint32_t index) {
+    uint32_t t0 = ticks();
+
+    FfxEcPrivkey privkey;
+    if (!ffx_deviceTestPrivkey(&privkey, index)) { return false; }
+
+    // A bad pubkey would be cached (and its address shown) until reboot,
+    // so fall back on the reference implementation
+    bool success = secp256k1ComputePubkey(account->pubkey.data,
+      privkey.data) && isValidPubkey(&account->pubkey);
+    if (!success) {
+        printf("[accounts] pubkey failed; using ffx_ec: index=%ld\n", index);
+        ffx_ec_computePubkey(&account->pubkey, &privkey);
+        success = isValidPubkey(&account->pubkey);
+    }
+
+    memset(privkey.data, 0, sizeof(privkey.data));
+
+    if (!success) { return false; }
+
+    account->address = ffx_eth_getAddress(&account->pubkey);
+    account->index = index;
+    account->valid = true;
+
+    printf("[accounts] derived: index=%ld dt=%ld\n", index, ticks() - t0);
+
+    return true;
+}
+
+// Returns the cached (or newly derived) account %index%
+static Account* getAccount(uint32_t index) {
+    Account *account = findAccount(index);
+
+    if (account == NULL) {
+        // Replace an empty entry, otherwise the least recently used
+        account = &accounts[0];
+        for (int i = 0; i < ACCOUNTS_CACHE_SIZE; i++) {
+            if (!accounts[i].valid) {
+                account = &accounts[i];
+                break;
+            }
+            if (accounts[i].used < account->used) { account = &accounts[i]; }
+        }
+
+        account->valid = false;
+        if (!deriveAccount(account, index)) { return NULL; }
+    }
+
+    account->used = ++useCount;
+
+    return account;
+}
+
+bool accountsGetPubkey(uint32_t index, FfxEcPubkey *pubkey) {
+    Account *account = getAccount(index);
+    if (account) { *pubkey = account->pubkey; }
+    return (account != NULL);
+}
+
+bool accountsGetAddress(uint32_t index, FfxAddress *address) {
+    Account *account = getAccount(index);
+    if (account) { *address = account->address; }
+    return (account != NULL);
+}
@@ -0,0 +1,35 @@
+#ifndef __ACCOUNTS_H__
+#define __ACCOUNTS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "firefly-address.h"
+#include "firefly-ecc.h"
+
+
+// Number of accounts whose public material is kept; the least recently
+// used is replaced. Entries are never invalidated, as the device key is
+// fixed for the life of the process (nothing provisions or replaces it
+// while running); anything which comes to change it must also clear the
+// cache.
+#define ACCOUNTS_CACHE_SIZE      (4)
+
+
+// Get the public key of account %index%, deriving it (slow) only the
+// first time since boot.
+bool accountsGetPubkey(uint32_t index, FfxEcPubkey *pubkey);
+
+// Get the address of account %index%; see accountsGetPubkey
+bool accountsGetAddress(uint32_t index, FfxAddress *address);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ACCOUNTS_H__ */
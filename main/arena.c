@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "arena.h"
+
+
+void arenaInit(Arena *arena, uint8_t *data, size_t size) {
+    memset(arena, 0, sizeof(Arena));
+    arena->data = data;
+    arena->size = size;
+}
+
+void* arenaAlloc(Arena *arena, size_t length) {
+    size_t aligned = (length + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    if (aligned > arena->size - arena->used) {
+        arena->failures++;
+        return NULL;
+    }
+
+    void *result = &arena->data[arena->used];
+    arena->used += aligned;
+
+    if (arena->used > arena->peak) { arena->peak = arena->used; }
+    if (arena->used > arena->highWater) { arena->highWater = arena->used; }
+
+    return result;
+}
+
+void* arenaGetFree(Arena *arena, size_t *length) {
+    *length = arena->size - arena->used;
+    return &arena->data[arena->used];
+}
+
+size_t arenaSave(Arena *arena) {
+    return arena->used;
+}
+
+void arenaRestore(Arena *arena, size_t mark) {
+    if (mark < arena->used) { arena->used = mark; }
+}
+
+void arenaReset(Arena *arena) {
+    arena->used = 0;
+    arena->peak = 0;
+    arena->resets++;
+}
+
+void arenaDumpStats(Arena *arena, const char *tag) {
+    printf("[%s] arena: peak=%d high-water=%d size=%d resets=%ld " \
+      "failures=%ld\n", tag, (int)arena->peak, (int)arena->highWater,
+      (int)arena->size, arena->resets, arena->failures);
+}
@@ -0,0 +1,60 @@
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+// Allocations are rounded up to keep the next one aligned
+#define ARENA_ALIGN              (4)
+
+
+// A bump allocator over a fixed block; everything is freed at once by
+// arenaReset (or back to a mark by arenaRestore)
+typedef struct Arena {
+    uint8_t *data;
+    size_t size;
+    size_t used;
+
+    // Most used since the last reset, and ever (for tuning the size)
+    size_t peak;
+    size_t highWater;
+
+    uint32_t resets;
+
+    // Allocations which did not fit
+    uint32_t failures;
+} Arena;
+
+
+// Use the %size% bytes at %data%, which must outlive the arena
+void arenaInit(Arena *arena, uint8_t *data, size_t size);
+
+// Returns %length% bytes, or NULL if there is not enough space
+void* arenaAlloc(Arena *arena, size_t length);
+
+// Returns the unallocated space, setting %length% to its size, for
+// writers which do not know their output length in advance; claim the
+// part used with arenaAlloc before any other allocation
+void* arenaGetFree(Arena *arena, size_t *length);
+
+// Returns a mark to release everything allocated after with arenaRestore
+size_t arenaSave(Arena *arena);
+void arenaRestore(Arena *arena, size_t mark);
+
+// Free everything; call once a request is complete
+void arenaReset(Arena *arena);
+
+// Write the usage to the console, prefixed with %tag%
+void arenaDumpStats(Arena *arena, const char *tag);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ARENA_H__ */
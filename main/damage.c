@@ -0,0 +1,130 @@
+#include <string.h>
+
+#include "damage.h"
+
+
+static int32_t getArea(DamageRect rect) {
+    return rect.width * rect.height;
+}
+
+static DamageRect getUnion(DamageRect a, DamageRect b) {
+    int x1 = a.x + a.width, y1 = a.y + a.height;
+    if (b.x + b.width > x1) { x1 = b.x + b.width; }
+    if (b.y + b.height > y1) { y1 = b.y + b.height; }
+    if (b.x < a.x) { a.x = b.x; }
+    if (b.y < a.y) { a.y = b.y; }
+    a.width = x1 - a.x;
+    a.height = y1 - a.y;
+    return a;
+}
+
+static bool intersects(DamageRect a, DamageRect b) {
+    return (a.x < b.x + b.width && b.x < a.x + a.width &&
+      a.y < b.y + b.height && b.y < a.y + a.height);
+}
+
+static void removeRect(Damage *damage, int index) {
+    damage->rects[index] = damage->rects[--damage->count];
+}
+
+void damageReset(Damage *damage) {
+    memset(damage, 0, sizeof(Damage));
+}
+
+void damageAdd(Damage *damage, DamageRect rect) {
+    // Clip to the screen
+    if (rect.x < 0) { rect.width += rect.x; rect.x = 0; }
+    if (rect.y < 0) { rect.height += rect.y; rect.y = 0; }
+    if (rect.x + rect.width > DAMAGE_WIDTH) {
+        rect.width = DAMAGE_WIDTH - rect.x;
+    }
+    if (rect.y + rect.height > DAMAGE_HEIGHT) {
+        rect.height = DAMAGE_HEIGHT - rect.y;
+    }
+    if (rect.width <= 0 || rect.height <= 0) { return; }
+
+    while (true) {
+        // Absorb anything the rect overlaps; the union may then overlap
+        // others, so start over after each
+        bool merged = false;
+        for (int i = 0; i < damage->count; i++) {
+            if (!intersects(rect, damage->rects[i])) { continue; }
+            rect = getUnion(rect, damage->rects[i]);
+            removeRect(damage, i);
+            merged = true;
+            break;
+        }
+        if (merged) { continue; }
+
+        if (damage->count < DAMAGE_MAX_RECTS) { break; }
+
+        // Full; merge with whichever rect grows the damage least
+        int best = 0;
+        int32_t bestCost = INT32_MAX;
+        for (int i = 0; i < damage->count; i++) {
+            DamageRect other = damage->rects[i];
+            int32_t cost = getArea(getUnion(rect, other)) - getArea(other);
+            if (cost < bestCost) {
+                best = i;
+                bestCost = cost;
+            }
+        }
+
+        rect = getUnion(rect, damage->rects[best]);
+        removeRect(damage, best);
+    }
+
+    damage->rects[damage->count++] = rect;
+}
+
+void damageAddMove(Damage *damage, FfxPoint from, FfxPoint to, FfxSize size) {
+    DamageRect a = {
+        .x = from.x, .y = from.y, .width = size.width, .height = size.height
+    };
+    DamageRect b = {
+        .x = to.x, .y = to.y, .width = size.width, .height = size.height
+    };
+
+    // Small moves are cheaper as one rect than as two with a shared edge
+    DamageRect both = getUnion(a, b);
+    if (getArea(both) <= getArea(a) + getArea(b)) {
+        damageAdd(damage, both);
+    } else {
+        damageAdd(damage, a);
+        damageAdd(damage, b);
+    }
+}
+
+bool damageMoveNode(Damage *damage, FfxNode node, FfxPoint origin,
+  FfxPoint position, FfxSize size) {
+
+    FfxPoint current = ffx_sceneNode_getPosition(node);
+    if (current.x == position.x && current.y == position.y) { return false; }
+
+    ffx_sceneNode_setPosition(node, position);
+
+    damageAddMove(damage,
+      ffx_point(origin.x + current.x, origin.y + current.y),
+      ffx_point(origin.x + position.x, origin.y + position.y), size);
+
+    return true;
+}
+
+uint32_t damageGetFragments(Damage *damage) {
+    uint32_t fragments = 0;
+    for (int i = 0; i < damage->count; i++) {
+        DamageRect rect = damage->rects[i];
+        int first = rect.y / DAMAGE_FRAGMENT_HEIGHT;
+        int last = (rect.y + rect.height - 1) / DAMAGE_FRAGMENT_HEIGHT;
+        for (int f = first; f <= last; f++) { fragments |= (1 << f); }
+    }
+    return fragments;
+}
+
+uint32_t damageGetArea(Damage *damage) {
+    uint32_t area = 0;
+    for (int i = 0; i < damage->count; i++) {
+        area += getArea(damage->rects[i]);
+    }
+    return area;
+}
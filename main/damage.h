@@ -0,0 +1,67 @@
+#ifndef __DAMAGE_H__
+#define __DAMAGE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "firefly-scene.h"
+
+
+// The display is rendered and transmitted in strips of this many rows
+#define DAMAGE_FRAGMENT_HEIGHT   (24)
+
+#define DAMAGE_WIDTH             (240)
+#define DAMAGE_HEIGHT            (240)
+
+// Rects beyond this are merged into their nearest neighbour
+#define DAMAGE_MAX_RECTS         (8)
+
+#ifdef FFX_SCENE_DAMAGE
+_Static_assert(DAMAGE_FRAGMENT_HEIGHT == FFX_SCENE_DAMAGE_ROWS,
+  "damage strips do not match the scene");
+#endif
+
+
+typedef struct DamageRect {
+    int16_t x, y;
+    int16_t width, height;
+} DamageRect;
+
+// The regions of the screen which changed during a frame
+typedef struct Damage {
+    DamageRect rects[DAMAGE_MAX_RECTS];
+    uint8_t count;
+} Damage;
+
+
+void damageReset(Damage *damage);
+
+// Add a region, clipped to the screen; overlapping regions are merged
+void damageAdd(Damage *damage, DamageRect rect);
+
+// Add the union of the bounds of a %size% sprite at %from% and at %to%;
+// if they are far apart, each is added separately
+void damageAddMove(Damage *damage, FfxPoint from, FfxPoint to, FfxSize size);
+
+// Move %node% to %position%, recording the damage; does nothing (and
+// returns false) if it is already there. The %origin% is the screen
+// position of the node's parent.
+bool damageMoveNode(Damage *damage, FfxNode node, FfxPoint origin,
+  FfxPoint position, FfxSize size);
+
+// Bitmask of the DAMAGE_FRAGMENT_HEIGHT strips that intersect the damage
+uint32_t damageGetFragments(Damage *damage);
+
+// Total number of damaged pixels (regions never overlap)
+uint32_t damageGetArea(Damage *damage);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __DAMAGE_H__ */
@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#else
+#include <time.h>
+#endif
+
+#include "entities.h"
+
+
+#ifdef ESP_PLATFORM
+#define BENCHMARK_PASSES    (256)
+#else
+// The host is far faster, so needs more passes to time a step
+#define BENCHMARK_PASSES    (4096)
+#endif
+
+
+static int getCell(int value, int limit) {
+    value >>= ENTITY_GRID_SHIFT;
+    if (value < 0) { return 0; }
+    if (value >= limit) { return limit - 1; }
+    return value;
+}
+
+void entitiesInit(Entities *entities) {
+    memset(entities, 0, sizeof(Entities));
+}
+
+int entitiesAdd(Entities *entities, int16_t x, int16_t y, uint8_t width,
+  uint8_t height, uint8_t sprite) {
+
+    if (entities->count == ENTITIES_MAX) { return -1; }
+
+    int index = entities->count++;
+    entities->width[index] = width;
+    entities->height[index] = height;
+    entities->vx[index] = entities->vy[index] = 0;
+    entities->sprite[index] = sprite;
+    entitiesPlace(entities, index, x, y);
+    entitiesSetAlive(entities, index, true);
+
+    return index;
+}
+
+bool entitiesIsAlive(Entities *entities, int index) {
+    return (entities->alive[index >> 5] & (1 << (index & 31))) != 0;
+}
+
+void entitiesSetAlive(Entities *entities, int index, bool alive) {
+    if (alive) {
+        entities->alive[index >> 5] |= (1 << (index & 31));
+    } else {
+        entities->alive[index >> 5] &= ~(1 << (index & 31));
+    }
+}
+
+void entitiesPlace(Entities *entities, int index, int16_t x, int16_t y) {
+    entities->x[index] = entities->previousX[index] = x;
+    entities->y[index] = entities->previousY[index] = y;
+}
+
+void entitiesSnapshot(Entities *entities) {
+    memcpy(entities->previousX, entities->x, entities->count * sizeof(int16_t));
+    memcpy(entities->previousY, entities->y, entities->count * sizeof(int16_t));
+}
+
+void entitiesMove(Entities *entities) {
+    for (int i = 0; i < entities->count; i++) {
+        if (!entitiesIsAlive(entities, i)) { continue; }
+        entities->x[i] += entities->vx[i];
+        entities->y[i] += entities->vy[i];
+    }
+}
+
+bool entitiesOverlap(Entities *entities, int a, int b) {
+    return (entities->x[a] < entities->x[b] + entities->width[b] &&
+      entities->x[b] < entities->x[a] + entities->width[a] &&
+      entities->y[a] < entities->y[b] + entities->height[b] &&
+      entities->y[b] < entities->y[a] + entities->height[a]);
+}
+
+// Loops %cell% over each grid cell entity %index% touches
+#define FOR_EACH_CELL(entities, index, cell) \
+    for (int cy = getCell((entities)->y[index], ENTITY_GRID_ROWS), \
+      cy1 = getCell((entities)->y[index] + (entities)->height[index], \
+      ENTITY_GRID_ROWS); cy <= cy1; cy++) \
+        for (int cx = getCell((entities)->x[index], ENTITY_GRID_COLS), \
+          cx1 = getCell((entities)->x[index] + (entities)->width[index], \
+          ENTITY_GRID_COLS), cell = cy * ENTITY_GRID_COLS + cx; \
+          cx <= cx1; cx++, cell++)
+
+void entityGridBuild(EntityGrid *grid, Entities *entities, int first,
+  int count) {
+
+    // Counting sort; count each cell's entities, then place them
+    uint16_t fill[ENTITY_GRID_CELLS] = { 0 };
+
+    for (int i = first; i < first + count; i++) {
+        if (!entitiesIsAlive(entities, i)) { continue; }
+        FOR_EACH_CELL(entities, i, cell) { fill[cell]++; }
+    }
+
+    // Entities larger than a cell can overflow the items; the excess is
+    // dropped rather than indexed, and counted
+    uint32_t total = 0;
+    for (int cell = 0; cell <= ENTITY_GRID_CELLS; cell++) {
+        grid->start[cell] = (total < ENTITY_GRID_MAX_ITEMS) ? total:
+          ENTITY_GRID_MAX_ITEMS;
+        if (cell == ENTITY_GRID_CELLS) { break; }
+        total += fill[cell];
+        fill[cell] = grid->start[cell];
+    }
+    grid->overflow = (total > ENTITY_GRID_MAX_ITEMS) ?
+      total - ENTITY_GRID_MAX_ITEMS: 0;
+
+    for (int i = first; i < first + count; i++) {
+        if (!entitiesIsAlive(entities, i)) { continue; }
+        FOR_EACH_CELL(entities, i, cell) {
+            if (fill[cell] == grid->start[cell + 1]) { continue; }
+            grid->items[fill[cell]++] = i;
+        }
+    }
+}
+
+int entityGridFindOverlap(EntityGrid *grid, Entities *entities, int index) {
+    FOR_EACH_CELL(entities, index, cell) {
+        for (int i = grid->start[cell]; i < grid->start[cell + 1]; i++) {
+            int other = grid->items[i];
+            if (other == index) { continue; }
+            if (entitiesOverlap(entities, index, other)) { return other; }
+        }
+    }
+
+    return -1;
+}
+
+
+/////////////////////////////
+// Benchmark
+
+static uint32_t getMicros() {
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
+bool entitiesBenchmark(int rows, int cols, int probes) {
+    Entities *entities = malloc(sizeof(Entities));
+    EntityGrid *grid = malloc(sizeof(EntityGrid));
+    if (entities == NULL || grid == NULL) {
+        free(entities);
+        free(grid);
+        return false;
+    }
+
+    entitiesInit(entities);
+
+    // A formation of 20x26 sprites packed across the screen, then the
+    // probes as points scattered over it
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            entitiesAdd(entities, c * 240 / cols, r * 240 / rows, 20, 26, 0);
+        }
+    }
+    const int formation = entities->count;
+
+    srand(42);
+    for (int i = 0; i < probes; i++) {
+        entitiesAdd(entities, rand() % 240, rand() % 240, 0, 0, 0);
+    }
+
+    int hitsBrute = 0;
+    uint32_t start = getMicros();
+    for (int pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        for (int p = formation; p < entities->count; p++) {
+            for (int i = 0; i < formation; i++) {
+                if (entitiesOverlap(entities, p, i)) {
+                    hitsBrute++;
+                    break;
+                }
+            }
+        }
+    }
+    uint32_t brute = getMicros() - start;
+
+    int hitsGrid = 0, overflow = 0;
+    start = getMicros();
+    for (int pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        // The formation moves every step, so rebuilding is part of the cost
+        entityGridBuild(grid, entities, 0, formation);
+        overflow += grid->overflow;
+        for (int p = formation; p < entities->count; p++) {
+            if (entityGridFindOverlap(grid, entities, p) >= 0) { hitsGrid++; }
+        }
+    }
+    uint32_t gridded = getMicros() - start;
+
+    // Per-step costs in hundredths of a microsecond
+    brute = brute * 100 / BENCHMARK_PASSES;
+    gridded = gridded * 100 / BENCHMARK_PASSES;
+
+    printf("[entities] benchmark: formation=%dx%d probes=%d " \
+      "brute=%ld.%02ldus grid=%ld.%02ldus hits=%d/%d overflow=%d\n", rows,
+      cols, entities->count - formation, brute / 100, brute % 100,
+      gridded / 100, gridded % 100, hitsBrute / BENCHMARK_PASSES,
+      hitsGrid / BENCHMARK_PASSES, overflow / BENCHMARK_PASSES);
+
+    free(entities);
+    free(grid);
+
+    return (hitsGrid == hitsBrute);
+}
@@ -0,0 +1,107 @@
+#ifndef __ENTITIES_H__
+#define __ENTITIES_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#define ENTITIES_MAX             (128)
+
+#define ENTITIES_ALIVE_WORDS     ((ENTITIES_MAX + 31) / 32)
+
+// The broadphase grid covers the screen with square cells of
+// (1 << ENTITY_GRID_SHIFT) pixels; anything outside it is clamped into
+// the edge cells
+#define ENTITY_GRID_SHIFT        (5)
+#define ENTITY_GRID_COLS         (8)
+#define ENTITY_GRID_ROWS         (8)
+#define ENTITY_GRID_CELLS        (ENTITY_GRID_COLS * ENTITY_GRID_ROWS)
+
+// Each entity is added to every cell it touches; an entity no larger
+// than a cell touches at most 4
+#define ENTITY_GRID_MAX_ITEMS    (4 * ENTITIES_MAX)
+
+
+// Game entities, stored as parallel arrays so the hot loops only touch
+// the fields they need. This holds the game state; the scene graph is
+// only updated from it once per frame, so the logic runs without a scene.
+typedef struct Entities {
+    uint16_t count;
+
+    // Screen bounds
+    int16_t x[ENTITIES_MAX];
+    int16_t y[ENTITIES_MAX];
+    uint8_t width[ENTITIES_MAX];
+    uint8_t height[ENTITIES_MAX];
+
+    // Position after the previous step, for interpolating
+    int16_t previousX[ENTITIES_MAX];
+    int16_t previousY[ENTITIES_MAX];
+
+    // Pixels per step
+    int8_t vx[ENTITIES_MAX];
+    int8_t vy[ENTITIES_MAX];
+
+    // What to draw; the meaning is up to the game
+    uint8_t sprite[ENTITIES_MAX];
+
+    // Bitset; dead entities are ignored by moves and the grid
+    uint32_t alive[ENTITIES_ALIVE_WORDS];
+} Entities;
+
+// A uniform grid of entity indices; entities in cell c are
+// items[start[c]] through items[start[c + 1] - 1]
+typedef struct EntityGrid {
+    uint16_t start[ENTITY_GRID_CELLS + 1];
+    uint16_t items[ENTITY_GRID_MAX_ITEMS];
+
+    // Items the last build dropped because the grid was full; overlaps
+    // with them are missed
+    uint16_t overflow;
+} EntityGrid;
+
+
+void entitiesInit(Entities *entities);
+
+// Returns the index of the new (alive, stationary) entity, or -1 if full
+int entitiesAdd(Entities *entities, int16_t x, int16_t y, uint8_t width,
+  uint8_t height, uint8_t sprite);
+
+bool entitiesIsAlive(Entities *entities, int index);
+void entitiesSetAlive(Entities *entities, int index, bool alive);
+
+// Move to %x%, %y% without interpolating from the old position
+void entitiesPlace(Entities *entities, int index, int16_t x, int16_t y);
+
+// Start a step; the current positions become the previous ones
+void entitiesSnapshot(Entities *entities);
+
+// Move every live entity by its velocity
+void entitiesMove(Entities *entities);
+
+// Whether the bounds of %a% and %b% overlap; zero-sized entities are
+// points, which overlap bounds they are strictly inside
+bool entitiesOverlap(Entities *entities, int a, int b);
+
+// Index the live entities among the %count% starting at %first%
+void entityGridBuild(EntityGrid *grid, Entities *entities, int first,
+  int count);
+
+// Returns the first indexed entity overlapping entity %index%, or -1
+int entityGridFindOverlap(EntityGrid *grid, Entities *entities, int index);
+
+// Log the cost of finding the overlaps of %probes% points against a
+// %rows% by %cols% formation with the grid against a brute-force scan,
+// and any items the grid dropped; false if the two found different hits
+bool entitiesBenchmark(int rows, int cols, int probes);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __ENTITIES_H__ */
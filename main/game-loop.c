@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "game-loop.h"
+
+
+static const uint32_t bucketLimits[] = GAME_LOOP_BUCKET_LIMITS;
+
+
+static void recordFrame(GameLoop *loop, uint32_t interval, uint32_t steps) {
+    GameLoopStats *stats = &loop->stats;
+
+    int bucket = 0;
+    while (bucket < GAME_LOOP_BUCKETS - 1 &&
+      interval > bucketLimits[bucket]) {
+        bucket++;
+    }
+    stats->intervals[bucket]++;
+
+    stats->steps[steps]++;
+    if (interval > loop->budget) { stats->overBudget++; }
+    if (interval > stats->longest) { stats->longest = interval; }
+    stats->frames++;
+}
+
+void gameLoopInit(GameLoop *loop, uint32_t period, uint32_t budget,
+  GameLoopStepFunc step, void *arg) {
+
+    memset(loop, 0, sizeof(GameLoop));
+    loop->period = period ? period: 1;
+    loop->budget = budget;
+    loop->step = step;
+    loop->arg = arg;
+}
+
+uint32_t gameLoopUpdate(GameLoop *loop, uint32_t now) {
+    if (!loop->started) {
+        loop->started = true;
+        loop->last = now;
+        return 0;
+    }
+
+    // Unsigned subtraction is correct across tick wrap-around
+    uint32_t interval = now - loop->last;
+    loop->last = now;
+
+    loop->accumulator += interval;
+
+    uint32_t steps = 0;
+    while (loop->accumulator >= loop->period) {
+        if (steps == GAME_LOOP_MAX_STEPS) {
+            // Keep the fraction, so the interpolation stays smooth
+            uint32_t excess = loop->accumulator - loop->accumulator %
+              loop->period;
+            loop->stats.dropped += excess;
+            loop->accumulator -= excess;
+            break;
+        }
+
+        loop->accumulator -= loop->period;
+        loop->step(loop->arg);
+        steps++;
+    }
+
+    recordFrame(loop, interval, steps);
+
+    return steps;
+}
+
+int32_t gameLoopGetAlpha(GameLoop *loop) {
+    return loop->accumulator * GAME_LOOP_ONE / loop->period;
+}
+
+int32_t gameLoopLerp(GameLoop *loop, int32_t previous, int32_t current) {
+    return previous + (current - previous) * gameLoopGetAlpha(loop) /
+      GAME_LOOP_ONE;
+}
+
+uint32_t gameLoopGetPeriod(GameLoop *loop) {
+    return loop->period;
+}
+
+void gameLoopDumpStats(GameLoop *loop, const char *tag) {
+    GameLoopStats *stats = &loop->stats;
+
+    printf("[%s] period=%ldms frames=%ld over-budget=%ld (%ldms) " \
+      "longest=%ldms dropped=%ldms\n", tag, loop->period, stats->frames,
+      stats->overBudget, loop->budget, stats->longest, stats->dropped);
+
+    printf("[%s] interval:", tag);
+    for (int i = 0; i < GAME_LOOP_BUCKETS; i++) {
+        if (bucketLimits[i]) {
+            printf(" <=%ld:%ld", bucketLimits[i], stats->intervals[i]);
+        } else {
+            printf(" more:%ld", stats->intervals[i]);
+        }
+    }
+    printf("\n");
+
+    printf("[%s] steps:", tag);
+    for (int i = 0; i <= GAME_LOOP_MAX_STEPS; i++) {
+        printf(" %d:%ld", i, stats->steps[i]);
+    }
+    printf("\n");
+}
+
+void gameLoopResetStats(GameLoop *loop) {
+    memset(&loop->stats, 0, sizeof(GameLoopStats));
+}
@@ -0,0 +1,92 @@
+#ifndef __GAME_LOOP_H__
+#define __GAME_LOOP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// Most steps run per update; beyond this the simulation slows down
+// rather than trying to catch up (which would make the next frame later)
+#define GAME_LOOP_MAX_STEPS      (4)
+
+// Interpolation factors are fixed-point, in 1/GAME_LOOP_ONE
+#define GAME_LOOP_ONE            (256)
+
+// Frame interval histogram buckets; each is the upper bound (ms) and
+// the last bucket catches everything longer
+#define GAME_LOOP_BUCKETS        (8)
+#define GAME_LOOP_BUCKET_LIMITS  { 10, 17, 20, 25, 34, 50, 100, 0 }
+
+
+// Advance the simulation by one fixed step
+typedef void (*GameLoopStepFunc)(void *arg);
+
+typedef struct GameLoopStats {
+    // Frames by the time since the previous frame (GAME_LOOP_BUCKET_LIMITS)
+    uint32_t intervals[GAME_LOOP_BUCKETS];
+
+    // Frames by the number of steps run in them
+    uint32_t steps[GAME_LOOP_MAX_STEPS + 1];
+
+    // Frames which took longer than the budget
+    uint32_t overBudget;
+
+    // Time (ms) not simulated because GAME_LOOP_MAX_STEPS was reached
+    uint32_t dropped;
+
+    uint32_t frames;
+    uint32_t longest;
+} GameLoopStats;
+
+typedef struct GameLoop {
+    uint32_t period;
+    uint32_t budget;
+
+    GameLoopStepFunc step;
+    void *arg;
+
+    bool started;
+    uint32_t last;
+
+    // Time (ms) not yet simulated
+    uint32_t accumulator;
+
+    GameLoopStats stats;
+} GameLoop;
+
+
+// Prepare %loop% to call %step(arg)% every %period% ms (at least 1) of
+// elapsed time, however fast frames are rendered; frames taking longer
+// than %budget% ms are counted as over budget.
+void gameLoopInit(GameLoop *loop, uint32_t period, uint32_t budget,
+  GameLoopStepFunc step, void *arg);
+
+// Run the steps due by %now% (ms); returns the number run. The first call
+// only starts the clock.
+uint32_t gameLoopUpdate(GameLoop *loop, uint32_t now);
+
+// How far (0 to GAME_LOOP_ONE) the time not yet simulated is into the
+// next step; for interpolating between the previous and current state
+int32_t gameLoopGetAlpha(GameLoop *loop);
+
+// Interpolate from %previous% to %current% by the alpha
+int32_t gameLoopLerp(GameLoop *loop, int32_t previous, int32_t current);
+
+// The step period (ms)
+uint32_t gameLoopGetPeriod(GameLoop *loop);
+
+// Write the histograms to the console, prefixed with %tag%
+void gameLoopDumpStats(GameLoop *loop, const char *tag);
+
+void gameLoopResetStats(GameLoop *loop);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __GAME_LOOP_H__ */
@@ -0,0 +1,61 @@
+#ifndef __IMAGE_H__
+#define __IMAGE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ *  Line decoding for the firefly-scene image formats, plus a compressed
+ *  format for full-screen backgrounds (see tools/asset-compile.py).
+ *
+ *  RLE image (IMAGE_FORMAT_RLE; uint16 words, little-endian)
+ *     0  format (0x0148)
+ *     1  width
+ *     2  height
+ *     3  reserved
+ *     4  palette: 256 x RGB565
+ *   260  line table: height + 1 x uint32 (low word first), the byte
+ *        offset of each line within the stream; the last entry is the
+ *        stream length
+ *        stream: each line is coded independently as tokens of
+ *          0x00 - 0x7f  (t + 1) literal palette indices follow
+ *          0x80 - 0xff  the next index repeats (t - 0x80 + 2) times
+ *
+ *  Since lines are independent, any fragment of any line can be decoded
+ *  without touching the rest of the image.
+ */
+
+#define IMAGE_FORMAT_RGB         (0x0104)
+#define IMAGE_FORMAT_RGBA        (0x0105)
+#define IMAGE_FORMAT_INDEXED     (0x0138)
+#define IMAGE_FORMAT_RLE         (0x0148)
+
+#define IMAGE_RLE_PALETTE        (4)
+#define IMAGE_RLE_LINES          (IMAGE_RLE_PALETTE + 256)
+
+
+// Returns true if %data% (%size% bytes) is a complete image in a format
+// imageDecodeLine supports
+bool imageIsValid(const uint16_t *data, size_t size);
+
+// Decode %width% RGB565 pixels of line %y% starting at %x% into %output%;
+// the image must have passed imageIsValid
+bool imageDecodeLine(const uint16_t *data, int y, int x, int width,
+  uint16_t *output);
+
+// Log the cost of decoding every full line of %data% against copying
+// the same number of raw RGB565 pixels; false if any line failed
+bool imageBenchmark(const uint16_t *data, size_t size);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __IMAGE_H__ */
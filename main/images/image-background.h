@@ -1,7217 +0,0 @@
-#ifndef __IMAGE_background_H__
-#define __IMAGE_background_H__
-
-#ifdef __cplusplus
-extern "C" {
-#endif  /* __cplusplus */
-#include <stdint.h>
-
-const uint16_t image_background[] = {
-  0x0104, 0x00f0, 0x00f0, 0x18e6, 0x1907, 0x31c9, 0x31ea, 0x39ea,
-  0x39ea, 0x3a0a, 0x3a0a, 0x3a2b, 0x3a2b, 0x424b, 0x424b, 0x3a2b,
-  0x3a0a, 0x1082, 0x0841, 0x0841, 0x1082, 0x18e4, 0x08a2, 0x10a2,
-  0x10a2, 0x10c3, 0x1927, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0862, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a4, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0882, 0x10a2, 0x10a2,
-  0x08a2, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x0841, 0x0821, 0x0841,
-  0x0821, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2988, 0x2988, 0x2989, 0x29a9,
-  0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31e9, 0x31ea, 0x39ea, 0x39ea,
-  0x31ea, 0x31ea, 0x31ea, 0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x29a9,
-  0x2989, 0x2989, 0x2989, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2147, 0x31c9, 0x31ea,
-  0x39ea, 0x39ea, 0x3a0a, 0x3a0b, 0x3a2a, 0x422b, 0x424b, 0x3a2b,
-  0x3a2b, 0x2105, 0x0841, 0x0841, 0x0841, 0x0882, 0x0882, 0x08a2,
-  0x10a2, 0x10a2, 0x1905, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0841, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x08a3, 0x10a2, 0x10a2, 0x10a2,
-  0x08a2, 0x10c4, 0x18e6, 0x18e6, 0x10a4, 0x0821, 0x0841, 0x0821,
-  0x0862, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x2127, 0x2989, 0x2988, 0x29a9, 0x29a9,
-  0x29a9, 0x31a9, 0x31c9, 0x31c9, 0x31c9, 0x31ea, 0x31ea, 0x31ea,
-  0x31ea, 0x31ea, 0x31c9, 0x31c9, 0x31c9, 0x29a9, 0x31a9, 0x2989,
-  0x2989, 0x2988, 0x2168, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2988, 0x31ea,
-  0x39ea, 0x39ea, 0x3a0a, 0x3a0a, 0x3a2a, 0x3a2b, 0x422b, 0x422b,
-  0x3a2b, 0x31c9, 0x0841, 0x0841, 0x0841, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x08a2, 0x08a2, 0x2168, 0x1907, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0862, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0862, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x1083,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0882, 0x10a2, 0x10a2, 0x0882,
-  0x08a2, 0x10a4, 0x18e6, 0x10a4, 0x0841, 0x0821, 0x0821, 0x0841,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x2168, 0x2988, 0x2989, 0x29a9, 0x29a9,
-  0x29a9, 0x31a9, 0x31c9, 0x31c9, 0x31c9, 0x31ea, 0x39ea, 0x31ea,
-  0x31ea, 0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x31a9, 0x29a9, 0x2989,
-  0x2989, 0x2988, 0x2148, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2127, 0x31ea,
-  0x31ea, 0x31ea, 0x39ea, 0x3a0a, 0x3a0a, 0x3a0a, 0x3a0b, 0x3a2b,
-  0x3a2b, 0x3a2b, 0x18a3, 0x0841, 0x0841, 0x0862, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x08a2, 0x2146, 0x2988, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0841,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x1084, 0x18e6,
-  0x18e6, 0x10e6, 0x0862, 0x0841, 0x0841, 0x0841, 0x0841, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x08a2, 0x10a2, 0x0882, 0x0882,
-  0x08a2, 0x10c4, 0x10a4, 0x0821, 0x0821, 0x0821, 0x0821, 0x10a5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1907, 0x2988, 0x2988, 0x2988, 0x29a9, 0x29a9,
-  0x29a9, 0x31a9, 0x31c9, 0x31e9, 0x31c9, 0x39ea, 0x39ea, 0x31ea,
-  0x31ea, 0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x29a9, 0x29a9, 0x2989,
-  0x2988, 0x2968, 0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x29a9,
-  0x31ea, 0x39ea, 0x39ea, 0x39ea, 0x3a0a, 0x3a0a, 0x3a0a, 0x3a2b,
-  0x3a2a, 0x3a2b, 0x2987, 0x0841, 0x0841, 0x0861, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x08a2, 0x1905, 0x2989, 0x2148, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0841, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x10a4,
-  0x18e6, 0x18e6, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0883, 0x08a2, 0x0882, 0x0882, 0x10a2,
-  0x0882, 0x0883, 0x0821, 0x0821, 0x0821, 0x0821, 0x10a4, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x2148, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9,
-  0x31c9, 0x31a9, 0x31c9, 0x31e9, 0x31ea, 0x31ea, 0x39ea, 0x31ea,
-  0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x29a9, 0x2989, 0x2989,
-  0x2988, 0x2168, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2147,
-  0x31ea, 0x31ea, 0x31ea, 0x31ea, 0x39ea, 0x3a0a, 0x3a0a, 0x3a0a,
-  0x3a2b, 0x3a2b, 0x3a2a, 0x1083, 0x0841, 0x0841, 0x0862, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x2126, 0x29a9, 0x2989, 0x2127, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x0841, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x10a4, 0x10c5, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x10a5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0883, 0x0882, 0x0862, 0x0882, 0x08a2,
-  0x0882, 0x0841, 0x0821, 0x0821, 0x0821, 0x1084, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1907, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9,
-  0x31a9, 0x31c9, 0x31c9, 0x31c9, 0x31ea, 0x39ea, 0x31ea, 0x31c9,
-  0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x29a9, 0x2989, 0x2989, 0x2988,
-  0x2988, 0x2168, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907,
-  0x2989, 0x31c9, 0x31c9, 0x31ea, 0x39ea, 0x39ea, 0x3a0a, 0x3a0a,
-  0x3a0a, 0x3a2a, 0x3a2b, 0x2987, 0x0841, 0x0841, 0x0841, 0x0862,
-  0x0882, 0x0882, 0x0882, 0x2988, 0x29a9, 0x2989, 0x2988, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a5, 0x0841, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0841, 0x1084, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0062, 0x0862, 0x0882, 0x0882,
-  0x0862, 0x0821, 0x0821, 0x0821, 0x0863, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x2127, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9,
-  0x31a9, 0x31a9, 0x31c9, 0x31c9, 0x31ea, 0x31ea, 0x31c9, 0x31c9,
-  0x31c9, 0x31c9, 0x31a9, 0x29a9, 0x2989, 0x2989, 0x2989, 0x2988,
-  0x2968, 0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x2127, 0x31c9, 0x31c9, 0x31ea, 0x31ea, 0x39ea, 0x39ea, 0x3a0a,
-  0x3a0a, 0x3a0a, 0x3a2a, 0x3a0a, 0x10a3, 0x0841, 0x0841, 0x0841,
-  0x0861, 0x10c3, 0x2147, 0x29a9, 0x29a9, 0x2989, 0x2989, 0x2148,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a4, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0883, 0x0062, 0x0882, 0x0883,
-  0x0841, 0x0821, 0x0821, 0x0841, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x2148, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9,
-  0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31ea, 0x31ea, 0x31c9, 0x31c9,
-  0x31c9, 0x31c9, 0x31a9, 0x29a9, 0x2989, 0x2989, 0x2988, 0x2988,
-  0x2988, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x29a9, 0x31c9, 0x31c9, 0x31ea, 0x31ea, 0x3a0a, 0x3a0a,
-  0x3a0a, 0x3a0a, 0x3a0a, 0x3a2b, 0x31a8, 0x0861, 0x0841, 0x0841,
-  0x0841, 0x18c4, 0x31c9, 0x29a9, 0x31a9, 0x29a9, 0x2989, 0x2989,
-  0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0842, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c4, 0x10e5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0883, 0x10a4, 0x0841,
-  0x0821, 0x0821, 0x0821, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x2127, 0x2968, 0x2968, 0x2988, 0x2988, 0x29a9, 0x29a9, 0x29a9,
-  0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31ea, 0x31c9, 0x31c9, 0x31c9,
-  0x31a9, 0x31a9, 0x29a9, 0x2989, 0x2989, 0x2988, 0x2988, 0x2968,
-  0x2168, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x2147, 0x31c9, 0x31c9, 0x31e9, 0x31ea, 0x31ea, 0x31ea,
-  0x39ea, 0x3a0a, 0x3a0a, 0x3a0a, 0x3a0a, 0x20e5, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x2126, 0x31c9, 0x29a9, 0x29a9, 0x2989, 0x2989,
-  0x2968, 0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10a4, 0x08a3, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0841, 0x0841, 0x0821,
-  0x0821, 0x0821, 0x0862, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x2148, 0x2968, 0x2988, 0x2988, 0x2989, 0x2989, 0x29a9, 0x29a9,
-  0x31c9, 0x31c9, 0x31c9, 0x31e9, 0x31e9, 0x31c9, 0x31c9, 0x31c9,
-  0x31a9, 0x31a9, 0x2989, 0x2989, 0x2989, 0x2988, 0x2968, 0x2968,
-  0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x31a9, 0x31c9, 0x31c9, 0x31c9, 0x31ea, 0x31ea,
-  0x39ea, 0x39ea, 0x3a0a, 0x3a0a, 0x3a0a, 0x3a0a, 0x18e4, 0x0841,
-  0x0841, 0x0841, 0x1082, 0x31a9, 0x31c9, 0x29a9, 0x2989, 0x2989,
-  0x2989, 0x2148, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0842, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0841, 0x0841, 0x0841, 0x1062, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x08a4,
-  0x08a3, 0x0882, 0x08a2, 0x10a2, 0x10c4, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x18e6, 0x1084, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0841, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907,
-  0x2168, 0x2968, 0x2968, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31a9,
-  0x31a9, 0x29a9, 0x2989, 0x2989, 0x2988, 0x2988, 0x2168, 0x2968,
-  0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x2168, 0x31c9, 0x31c9, 0x31c9, 0x31e9, 0x31e9,
-  0x31ea, 0x31ea, 0x39ea, 0x3a0a, 0x3a0a, 0x3a0a, 0x3a0a, 0x18c4,
-  0x0841, 0x0841, 0x0841, 0x2146, 0x31c9, 0x29a9, 0x29a9, 0x2989,
-  0x2989, 0x2988, 0x2147, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0841, 0x0841, 0x0841, 0x10a4, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x08a4, 0x0882, 0x08a2,
-  0x10a2, 0x10a2, 0x10a2, 0x08a2, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0841, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2148,
-  0x2168, 0x2968, 0x2988, 0x2988, 0x2989, 0x2989, 0x29a9, 0x31c9,
-  0x31a9, 0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x31a9,
-  0x29a9, 0x2989, 0x2989, 0x2989, 0x2988, 0x2968, 0x2168, 0x2168,
-  0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1906, 0x2989, 0x31c9, 0x31c9, 0x31c9, 0x31c9,
-  0x31ea, 0x31ea, 0x39ea, 0x3a0a, 0x3a0a, 0x3a0a, 0x3a0a, 0x31e9,
-  0x1062, 0x0841, 0x0841, 0x10a3, 0x31c9, 0x31a9, 0x29a9, 0x2989,
-  0x2989, 0x2988, 0x2168, 0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0841, 0x0841, 0x18c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0882, 0x0882, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x10a2, 0x08a3, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1084, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2168,
-  0x2168, 0x2968, 0x2988, 0x2988, 0x2988, 0x29a9, 0x29a9, 0x29a9,
-  0x31a9, 0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x31a9, 0x29a9,
-  0x29a9, 0x2989, 0x2989, 0x2988, 0x2968, 0x2168, 0x2168, 0x2148,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1907, 0x31a9, 0x31a9, 0x31c9, 0x31c9,
-  0x31c9, 0x31ea, 0x31ea, 0x3a0a, 0x39ea, 0x3a0a, 0x3a0a, 0x39ea,
-  0x2105, 0x0841, 0x0841, 0x0841, 0x2968, 0x31a9, 0x29a9, 0x29a9,
-  0x2989, 0x2989, 0x2988, 0x2168, 0x2127, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x1084, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0883, 0x0882, 0x10a2, 0x08a2, 0x0882,
-  0x10a2, 0x10a2, 0x10a2, 0x10c4, 0x18e6, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x0862, 0x0821, 0x0821, 0x0821, 0x0821, 0x0842, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2147, 0x2168,
-  0x2168, 0x2968, 0x2988, 0x2988, 0x2988, 0x29a9, 0x29a9, 0x31c9,
-  0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x31a9, 0x29a9,
-  0x2989, 0x2989, 0x2989, 0x2988, 0x2968, 0x2168, 0x2168, 0x2127,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2988, 0x31c9, 0x31c9, 0x31c9,
-  0x31c9, 0x31c9, 0x31ea, 0x39ea, 0x39ea, 0x39ea, 0x3a0a, 0x3a0a,
-  0x31c9, 0x1061, 0x0841, 0x0841, 0x18e4, 0x31c9, 0x29a9, 0x29a9,
-  0x2989, 0x2989, 0x2988, 0x2968, 0x2168, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0862,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0842, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a5, 0x0882, 0x10a2, 0x0882, 0x0882, 0x10a2,
-  0x10a2, 0x10a2, 0x0882, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x0863, 0x0821, 0x0841, 0x0821, 0x0821, 0x1083, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2148, 0x2168,
-  0x2168, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x31a9, 0x29a9, 0x2989,
-  0x2989, 0x2989, 0x2988, 0x2968, 0x2168, 0x2168, 0x2148, 0x1907,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2127, 0x29a9, 0x31c9, 0x31c9,
-  0x31c9, 0x31c9, 0x31ea, 0x31ea, 0x31ea, 0x31ea, 0x39ea, 0x39ea,
-  0x39ea, 0x2105, 0x0841, 0x0841, 0x0861, 0x29a8, 0x31a9, 0x29a9,
-  0x2989, 0x2989, 0x2988, 0x2988, 0x2968, 0x2127, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0841,
-  0x0841, 0x0841, 0x0821, 0x0821, 0x0821, 0x0821, 0x0841, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x0883, 0x0882, 0x10a2, 0x0882, 0x0882, 0x10a2,
-  0x10a2, 0x08a2, 0x0882, 0x0882, 0x08a3, 0x10a4, 0x10a4, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2127, 0x2148, 0x2148,
-  0x2168, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x31c9, 0x31c9, 0x31c9, 0x31a9, 0x31a9, 0x29a9, 0x2989, 0x2989,
-  0x2989, 0x2988, 0x2988, 0x2968, 0x2168, 0x2148, 0x2168, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2988, 0x31c9, 0x31a9,
-  0x31c9, 0x31c9, 0x31c9, 0x31c9, 0x31ea, 0x31ea, 0x31ea, 0x39ea,
-  0x39ea, 0x39e9, 0x1061, 0x0841, 0x0841, 0x18e5, 0x31a9, 0x29a9,
-  0x29a9, 0x2989, 0x2989, 0x2988, 0x2968, 0x2968, 0x1907, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1083, 0x0841,
-  0x0841, 0x0841, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0862, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x0862, 0x0882, 0x0882, 0x0882, 0x0882, 0x08a2,
-  0x10a2, 0x0882, 0x08a2, 0x10a2, 0x10a2, 0x08a3, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x1083, 0x0821,
-  0x0821, 0x0841, 0x0841, 0x0862, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2148, 0x2148, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x31a9, 0x31c9, 0x31a9, 0x31a9, 0x31a9, 0x2989, 0x2989, 0x2989,
-  0x2988, 0x2988, 0x2968, 0x2168, 0x2168, 0x2148, 0x2147, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2147, 0x29a9, 0x31a9,
-  0x31c9, 0x31a9, 0x31c9, 0x31a9, 0x2987, 0x2126, 0x1905, 0x18e4,
-  0x1905, 0x2167, 0x2105, 0x0841, 0x0841, 0x0841, 0x2126, 0x31a9,
-  0x2989, 0x2989, 0x2989, 0x2988, 0x2988, 0x2968, 0x2148, 0x1907,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18c6, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0842, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0862, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x0062, 0x0862, 0x0062, 0x0882, 0x08a2, 0x08a2,
-  0x0882, 0x0882, 0x10a2, 0x10a2, 0x10a3, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10a4, 0x1083, 0x0862, 0x0841, 0x0821, 0x0841,
-  0x0061, 0x0862, 0x0882, 0x0882, 0x0883, 0x10a4, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2127, 0x2148, 0x2148, 0x2168,
-  0x2968, 0x2988, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x31a9, 0x31a9, 0x31a9, 0x29a9, 0x29a9, 0x2989, 0x2989, 0x2988,
-  0x2988, 0x2968, 0x2968, 0x2168, 0x2148, 0x2148, 0x2127, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2148, 0x29a9,
-  0x29a9, 0x2987, 0x1905, 0x10a3, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x0861, 0x0841, 0x0841, 0x0841, 0x2126,
-  0x29a9, 0x2989, 0x2989, 0x2988, 0x2988, 0x2968, 0x2168, 0x2148,
-  0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x1084, 0x10c5, 0x0862, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0842, 0x1083, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x0862, 0x0062, 0x0062, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x10a2, 0x0882, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x10a5,
-  0x0863, 0x0841, 0x0821, 0x0821, 0x0821, 0x0821, 0x0841, 0x0062,
-  0x0882, 0x08a2, 0x10a2, 0x10a2, 0x10a2, 0x08a2, 0x0883, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1906, 0x2148, 0x2148, 0x2148, 0x2168,
-  0x2968, 0x2988, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x31c9, 0x31a9, 0x29a9, 0x29a9, 0x29a9, 0x2989, 0x2989, 0x2988,
-  0x2988, 0x2968, 0x2168, 0x2148, 0x2148, 0x2148, 0x1907, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906, 0x2968,
-  0x18e4, 0x0882, 0x08a2, 0x08a2, 0x0882, 0x10a2, 0x10a2, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x0862, 0x0841, 0x0841, 0x0841,
-  0x2947, 0x2989, 0x2989, 0x2989, 0x2988, 0x2968, 0x2168, 0x2168,
-  0x2148, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x10c5, 0x18e6, 0x18e6, 0x10a4, 0x0862,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0841,
-  0x0862, 0x1083, 0x10a4, 0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10a4, 0x10a4, 0x10a4, 0x0883, 0x0862, 0x0862, 0x0862, 0x0882,
-  0x08a3, 0x10a4, 0x10c6, 0x18e6, 0x10c5, 0x10a4, 0x0862, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0841, 0x0062, 0x0862,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x08a2, 0x10a2, 0x10a2, 0x0882,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x2127, 0x2148, 0x2148, 0x2148, 0x2168,
-  0x2968, 0x2988, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x31c9,
-  0x31c9, 0x31a9, 0x29a9, 0x29a9, 0x29a9, 0x2989, 0x2988, 0x2968,
-  0x2968, 0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c4, 0x08a2,
-  0x10a2, 0x08a2, 0x10a2, 0x10a2, 0x08a2, 0x08a2, 0x08a2, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0862, 0x0841, 0x0841,
-  0x1082, 0x2989, 0x2989, 0x2989, 0x2988, 0x2988, 0x2968, 0x2168,
-  0x2148, 0x2127, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10a3, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a5, 0x0863, 0x0841, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0842, 0x10a4, 0x10a5, 0x10a4, 0x10a4, 0x0883, 0x0883,
-  0x0883, 0x1083, 0x0863, 0x0842, 0x0841, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0841, 0x0862, 0x1084, 0x10c5, 0x0862, 0x0062,
-  0x0062, 0x0882, 0x0882, 0x0882, 0x0882, 0x08a2, 0x10a2, 0x10a2,
-  0x08a2, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1907, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168,
-  0x2968, 0x2988, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x31c9,
-  0x31c9, 0x29a9, 0x29a9, 0x29a9, 0x2989, 0x2988, 0x2988, 0x2968,
-  0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x2147, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x18e5,
-  0x1905, 0x10a3, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x08a2, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0861, 0x0841,
-  0x0841, 0x2126, 0x2989, 0x2989, 0x2989, 0x2988, 0x2968, 0x2168,
-  0x2168, 0x2148, 0x1907, 0x18e6, 0x18e6, 0x10c5, 0x08a2, 0x10c4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x1062, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10a5, 0x1083, 0x0842, 0x0841, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0841, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0841, 0x0841, 0x0841, 0x0821, 0x0821, 0x0821, 0x0841,
-  0x0883, 0x10a4, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x08a3, 0x0882,
-  0x0882, 0x0882, 0x08a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2,
-  0x10a2, 0x08a2, 0x08a4, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x2127, 0x2147, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x29a9, 0x29a9, 0x29a9, 0x2989, 0x2988, 0x2988, 0x2968, 0x2968,
-  0x2168, 0x2168, 0x2148, 0x2148, 0x2147, 0x2127, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x2968, 0x2988, 0x1905, 0x10a2, 0x10a2, 0x10a2, 0x08a2, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0862, 0x0841,
-  0x0841, 0x1062, 0x2988, 0x2989, 0x2989, 0x2988, 0x2968, 0x2168,
-  0x2168, 0x2148, 0x2147, 0x18e6, 0x18e6, 0x10c6, 0x0882, 0x10a2,
-  0x10a4, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1083, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10a5,
-  0x1084, 0x0862, 0x0842, 0x0841, 0x0821, 0x0821, 0x0821, 0x0821,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0862, 0x0862, 0x0883, 0x10a4, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0883,
-  0x0882, 0x08a2, 0x08a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2,
-  0x08a2, 0x10a3, 0x10a4, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x2147, 0x2147, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x29a9, 0x29a9, 0x2989, 0x2988, 0x2988, 0x2988, 0x2968, 0x2168,
-  0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x2147, 0x2989, 0x29a9, 0x2967, 0x10e4, 0x10a2, 0x10a2, 0x10a2,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0862, 0x0841,
-  0x0841, 0x0841, 0x18c4, 0x2988, 0x2147, 0x2988, 0x2988, 0x2968,
-  0x2168, 0x2148, 0x2148, 0x2127, 0x18e6, 0x18e6, 0x08a2, 0x08a2,
-  0x10a2, 0x08a2, 0x10c4, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0861, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10a4, 0x1084, 0x1084,
-  0x1084, 0x1084, 0x10a4, 0x10a4, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x10c6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a5, 0x0883, 0x0882, 0x0882, 0x0882, 0x0882, 0x08a3, 0x10a4,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x2107, 0x2127, 0x2147, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x29a9, 0x29a9, 0x2989, 0x2988, 0x2988, 0x2968, 0x2168, 0x2168,
-  0x2168, 0x2148, 0x2148, 0x2147, 0x2148, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x2168, 0x2988, 0x2989, 0x29a9, 0x2126, 0x10a2, 0x08a2,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x10e4, 0x2105,
-  0x0841, 0x0841, 0x0841, 0x10a3, 0x10a3, 0x2168, 0x2968, 0x2968,
-  0x2168, 0x2168, 0x2148, 0x2168, 0x1906, 0x18e6, 0x08a3, 0x08a2,
-  0x10a2, 0x10a2, 0x10a2, 0x0882, 0x10a3, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1906, 0x2147, 0x2127, 0x2147, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x2989, 0x2988, 0x2988, 0x2988, 0x2988, 0x2168, 0x2168, 0x2148,
-  0x2148, 0x2148, 0x2148, 0x2148, 0x1907, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x2107, 0x2988, 0x2988, 0x29a9, 0x29a9, 0x2988, 0x1905,
-  0x10a3, 0x0882, 0x0882, 0x0882, 0x10a3, 0x2126, 0x31c9, 0x31a8,
-  0x1062, 0x0841, 0x0841, 0x0841, 0x0841, 0x2147, 0x2167, 0x2168,
-  0x2168, 0x2168, 0x2148, 0x2148, 0x2147, 0x1907, 0x10a3, 0x08a2,
-  0x08a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x08a3, 0x10c4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0862, 0x0841, 0x0841, 0x0841,
-  0x1082, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1927, 0x2147, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2988, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x29a9,
-  0x2989, 0x2988, 0x2988, 0x2968, 0x2168, 0x2168, 0x2168, 0x2168,
-  0x2148, 0x2148, 0x2148, 0x2148, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x2968, 0x2988, 0x2989, 0x2989, 0x29a9, 0x29a9,
-  0x29a9, 0x2988, 0x2167, 0x2988, 0x31a9, 0x31c9, 0x31a9, 0x31a9,
-  0x2126, 0x0841, 0x0841, 0x0841, 0x0841, 0x18e5, 0x2167, 0x2167,
-  0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x2127, 0x10c4, 0x08a2,
-  0x08a2, 0x08a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x08a2,
-  0x10a3, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1083, 0x0841, 0x0841, 0x0841, 0x0862,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x2127, 0x2127, 0x2147, 0x2147, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x29a9, 0x2989,
-  0x2988, 0x2988, 0x2968, 0x2968, 0x2168, 0x2168, 0x2168, 0x2168,
-  0x2148, 0x2148, 0x2147, 0x2127, 0x1906, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x2127, 0x2989, 0x2988, 0x2989, 0x29a9, 0x2989,
-  0x29a9, 0x29a9, 0x31a9, 0x29a8, 0x29a8, 0x31a8, 0x31c9, 0x31a8,
-  0x31a9, 0x18a3, 0x0841, 0x0841, 0x0841, 0x0841, 0x2105, 0x2167,
-  0x2147, 0x2147, 0x2168, 0x2148, 0x2148, 0x2147, 0x18e6, 0x0882,
-  0x0882, 0x08a2, 0x08a2, 0x08a2, 0x08a2, 0x0882, 0x08a2, 0x0882,
-  0x08a2, 0x08a3, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a4, 0x0841, 0x0841, 0x0841, 0x0861, 0x0883,
-  0x10c4, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907,
-  0x2147, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2989, 0x29a9, 0x2989, 0x2989,
-  0x2988, 0x2988, 0x2968, 0x2168, 0x2168, 0x2168, 0x2168, 0x2148,
-  0x2148, 0x2148, 0x2127, 0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x2968, 0x2988, 0x2988, 0x2988, 0x2989,
-  0x29a9, 0x2989, 0x29a8, 0x29a8, 0x29a8, 0x29a8, 0x31a9, 0x31a9,
-  0x31a8, 0x29a8, 0x1082, 0x0841, 0x0841, 0x0841, 0x0841, 0x18e4,
-  0x2147, 0x2147, 0x2147, 0x2148, 0x2148, 0x2148, 0x2127, 0x08a3,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0883, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x0841, 0x0861, 0x0861, 0x0861, 0x0882, 0x0882,
-  0x08a2, 0x08a2, 0x10a3, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2989, 0x2989, 0x2989, 0x2988,
-  0x2988, 0x2968, 0x2968, 0x2168, 0x2168, 0x2168, 0x2148, 0x2148,
-  0x2148, 0x2127, 0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x2127, 0x2968, 0x2988, 0x2988, 0x2989,
-  0x2989, 0x2988, 0x2988, 0x2988, 0x29a8, 0x29a8, 0x29a8, 0x31a9,
-  0x31a8, 0x29a8, 0x2988, 0x10a3, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x18c4, 0x2147, 0x2147, 0x2147, 0x2148, 0x2148, 0x2147, 0x1905,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x0841, 0x0861, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x10a2, 0x10a2, 0x10c4, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2988, 0x2988, 0x2988, 0x2989, 0x2988, 0x2988, 0x2988,
-  0x2968, 0x2168, 0x2168, 0x2168, 0x2168, 0x2148, 0x2148, 0x2147,
-  0x2148, 0x2127, 0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2148, 0x2988, 0x2988, 0x2988,
-  0x2988, 0x2968, 0x2988, 0x2988, 0x29a8, 0x29a8, 0x29a8, 0x29a8,
-  0x29a8, 0x31a8, 0x29a8, 0x2988, 0x18e4, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x2106, 0x2147, 0x2147, 0x2147, 0x2148, 0x2148, 0x2127,
-  0x08a3, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x08a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4,
-  0x0841, 0x0861, 0x0882, 0x0882, 0x0882, 0x0862, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x08a2, 0x10a2, 0x10a2, 0x08a3, 0x10c4, 0x10c5,
-  0x10e5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2127,
-  0x2127, 0x2147, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988,
-  0x2168, 0x2968, 0x2168, 0x2168, 0x2168, 0x2148, 0x2147, 0x2148,
-  0x2127, 0x2127, 0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2968, 0x2988, 0x2968,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988, 0x29a8,
-  0x29a8, 0x29a8, 0x29a8, 0x2988, 0x2988, 0x1905, 0x0841, 0x0841,
-  0x0841, 0x1082, 0x2127, 0x2147, 0x2147, 0x2147, 0x2147, 0x2148,
-  0x1906, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x0883, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x1083, 0x0841,
-  0x0841, 0x0862, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x08a2, 0x10a2, 0x10a2, 0x08a2, 0x10c4,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2127, 0x2127,
-  0x2147, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988, 0x2968,
-  0x2168, 0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x2147, 0x2148,
-  0x2127, 0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2148, 0x2968, 0x2167,
-  0x2167, 0x2968, 0x2968, 0x2988, 0x2968, 0x2988, 0x2988, 0x29a8,
-  0x29a8, 0x29a8, 0x29a8, 0x29a8, 0x2988, 0x2988, 0x10a3, 0x0841,
-  0x0841, 0x0841, 0x1082, 0x2126, 0x2147, 0x2127, 0x2148, 0x2147,
-  0x2127, 0x18e5, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x1084, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x0882, 0x08a3, 0x10a4, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988, 0x2968,
-  0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x2148, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2147, 0x2147,
-  0x2167, 0x2968, 0x2968, 0x2968, 0x2968, 0x2988, 0x2988, 0x2988,
-  0x2988, 0x29a8, 0x29a8, 0x2988, 0x2988, 0x2988, 0x2147, 0x0861,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x1083, 0x10a3, 0x18c4, 0x2127,
-  0x2148, 0x2147, 0x1906, 0x08a3, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0882, 0x0882, 0x0882, 0x08a3, 0x10e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c5, 0x10a4, 0x1083, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0861, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0883, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2168, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2988, 0x2168, 0x2968, 0x2968,
-  0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x2147, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x2147, 0x2147,
-  0x2147, 0x2167, 0x2968, 0x2968, 0x2968, 0x2968, 0x2988, 0x2988,
-  0x2988, 0x2988, 0x29a8, 0x2988, 0x2988, 0x2988, 0x2988, 0x2126,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x10a3, 0x1906, 0x2127, 0x2127, 0x10c5, 0x08a4, 0x0883, 0x0882,
-  0x0882, 0x0883, 0x10a4, 0x10c5, 0x1083, 0x1062, 0x0862, 0x0861,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x1083, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0883, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2968, 0x2968, 0x2968, 0x2168,
-  0x2168, 0x2148, 0x2148, 0x2148, 0x2148, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x2147,
-  0x2147, 0x2167, 0x2167, 0x2967, 0x2968, 0x2968, 0x2968, 0x2988,
-  0x2988, 0x2988, 0x2988, 0x29a8, 0x29a8, 0x2988, 0x2968, 0x2968,
-  0x2126, 0x1083, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x1083, 0x18c5, 0x1906, 0x18e6, 0x10c6, 0x10c5,
-  0x10c5, 0x10c6, 0x18c6, 0x10a4, 0x1062, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x1083, 0x10e6,
-  0x10c5, 0x08a2, 0x08a2, 0x0882, 0x0882, 0x0882, 0x0882, 0x0882,
-  0x0883, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2147, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148, 0x2168,
-  0x2968, 0x2968, 0x2988, 0x2968, 0x2968, 0x2968, 0x2168, 0x2168,
-  0x2148, 0x2148, 0x2148, 0x2148, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x1906,
-  0x2147, 0x2147, 0x2147, 0x2167, 0x2967, 0x2968, 0x2968, 0x2968,
-  0x2988, 0x2988, 0x2988, 0x2988, 0x29a8, 0x2988, 0x2988, 0x2968,
-  0x2968, 0x2968, 0x2126, 0x18c4, 0x1062, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x1083, 0x10c5, 0x18e6, 0x18e6,
-  0x10e6, 0x0882, 0x10a2, 0x08a2, 0x08a2, 0x0882, 0x0882, 0x0882,
-  0x0883, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2147, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148, 0x2168,
-  0x2168, 0x2968, 0x2968, 0x2968, 0x2168, 0x2168, 0x2168, 0x2168,
-  0x2148, 0x2148, 0x2148, 0x2127, 0x2127, 0x2147, 0x2127, 0x2127,
-  0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x2147, 0x2147, 0x2147, 0x2147, 0x2967, 0x2968, 0x2968, 0x2968,
-  0x2968, 0x2968, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988,
-  0x2968, 0x2968, 0x2147, 0x2147, 0x2147, 0x2106, 0x18c4, 0x1083,
-  0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x1083, 0x10a4, 0x18c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a3, 0x10a2, 0x10a2, 0x08a2, 0x0882, 0x0882, 0x0882,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148, 0x2168,
-  0x2168, 0x2968, 0x2968, 0x2968, 0x2168, 0x2168, 0x2148, 0x2148,
-  0x2148, 0x2148, 0x2148, 0x2127, 0x2147, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x1906, 0x2147, 0x2147, 0x2147, 0x2147, 0x2167, 0x2167, 0x2968,
-  0x2968, 0x2968, 0x2968, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988,
-  0x2968, 0x2968, 0x2967, 0x2147, 0x2147, 0x2147, 0x2147, 0x2127,
-  0x2126, 0x18e5, 0x10c4, 0x1083, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1083, 0x1084, 0x10c5,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a4, 0x10a2, 0x10a2, 0x08a2, 0x0882, 0x0882, 0x0882,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1907, 0x1907, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148, 0x2168,
-  0x2168, 0x2968, 0x2968, 0x2168, 0x2168, 0x2148, 0x2148, 0x2148,
-  0x2148, 0x2148, 0x2148, 0x2147, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x18e6, 0x2127, 0x2147, 0x2147, 0x2147, 0x2147, 0x2167, 0x2167,
-  0x2968, 0x2968, 0x2968, 0x2988, 0x2988, 0x2988, 0x2988, 0x2988,
-  0x2968, 0x2968, 0x2968, 0x2147, 0x2147, 0x2147, 0x2147, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x1907,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c4, 0x10a2, 0x10a2, 0x08a2, 0x0882, 0x0882, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1907, 0x1907, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2147, 0x2147, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148,
-  0x2168, 0x2968, 0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x2148,
-  0x2148, 0x2148, 0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x2127, 0x2127, 0x2127, 0x2147, 0x2147, 0x2147, 0x2167,
-  0x2167, 0x2968, 0x2968, 0x2968, 0x2968, 0x2988, 0x2988, 0x2988,
-  0x2988, 0x2968, 0x2968, 0x2167, 0x2147, 0x2147, 0x2147, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x08a2, 0x10a2, 0x08a2, 0x08a2, 0x08a3, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1907, 0x1907, 0x1907, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2147, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148,
-  0x2168, 0x2168, 0x2168, 0x2148, 0x2148, 0x2148, 0x2148, 0x2148,
-  0x2148, 0x2127, 0x2127, 0x2127, 0x2127, 0x1927, 0x2127, 0x2127,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x18e6, 0x2127, 0x2127, 0x2147, 0x2147, 0x2147, 0x2147,
-  0x2167, 0x2167, 0x2968, 0x2968, 0x2968, 0x2968, 0x2988, 0x2988,
-  0x2968, 0x2968, 0x2968, 0x2168, 0x2147, 0x2147, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2147, 0x2147, 0x2127, 0x2127, 0x2127,
-  0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x0882, 0x10a2, 0x08a2, 0x0883, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x10c5, 0x10a5, 0x1084, 0x1084, 0x0884, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0884, 0x1084, 0x10a4, 0x10a5, 0x10c5,
-  0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1907, 0x1907, 0x1907, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2147, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148,
-  0x2148, 0x2168, 0x2148, 0x2148, 0x2148, 0x2148, 0x2148, 0x2148,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2107,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x1906, 0x2127, 0x2127, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2167, 0x2167, 0x2968, 0x2168, 0x2968, 0x2968, 0x2968,
-  0x2988, 0x2968, 0x2968, 0x2168, 0x2167, 0x2147, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x08a2, 0x08a2, 0x08a2, 0x10e5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10a4, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x10a4, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148,
-  0x2148, 0x2148, 0x2148, 0x2148, 0x2148, 0x2148, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x1907,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x18e6, 0x2127, 0x2127, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2147, 0x2147, 0x2167, 0x2167, 0x2968, 0x2968, 0x2968,
-  0x2968, 0x2968, 0x2968, 0x2167, 0x2167, 0x2167, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10a2, 0x10a3, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10a5, 0x1084, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10a5, 0x10c6, 0x18e6,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2147, 0x2148, 0x2148, 0x2148, 0x2148,
-  0x2148, 0x2148, 0x2148, 0x2148, 0x2148, 0x2147, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2107, 0x1907,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x1906, 0x2127, 0x2127, 0x2127, 0x2147,
-  0x2147, 0x2147, 0x2147, 0x2147, 0x2167, 0x2167, 0x2968, 0x2968,
-  0x2968, 0x2968, 0x2968, 0x2968, 0x2167, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a4, 0x10a3, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10a5, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2147, 0x2147, 0x2148, 0x2148, 0x2148,
-  0x2148, 0x2148, 0x2148, 0x2147, 0x2147, 0x2147, 0x2147, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2167, 0x2968,
-  0x2968, 0x2968, 0x2968, 0x2968, 0x2168, 0x2147, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x10a4, 0x10c5, 0x1906, 0x1907, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2148,
-  0x2148, 0x2148, 0x2148, 0x2147, 0x2147, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1906, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2167,
-  0x2167, 0x2968, 0x2968, 0x2968, 0x2167, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x1926, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10a4, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x1084,
-  0x10a4, 0x10a4, 0x10a4, 0x18e6, 0x1907, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2147, 0x2147, 0x2148, 0x2148,
-  0x2148, 0x2148, 0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18c5, 0x1906, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2167,
-  0x2167, 0x2967, 0x2167, 0x2168, 0x2167, 0x2167, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x1927, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0884, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x1084,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10c5, 0x1907, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2147, 0x2148, 0x2148, 0x2147,
-  0x2147, 0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1906, 0x2126, 0x1926,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2147, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2147, 0x2167, 0x2167, 0x2167, 0x2167, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2126, 0x1926, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x1906, 0x2127,
-  0x2127, 0x2127, 0x2147, 0x2127, 0x2147, 0x2147, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x10a5, 0x1084, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18c5, 0x1906, 0x2126,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2147, 0x2147,
-  0x2147, 0x2147, 0x2147, 0x2167, 0x2167, 0x2167, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x1926, 0x1927, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x1084, 0x1084,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x18e6,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2147, 0x2147, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1906, 0x2126,
-  0x2126, 0x2126, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x1926, 0x1926, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x1084, 0x1084, 0x1084,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x18e6, 0x2127, 0x2127, 0x2147, 0x2127, 0x2147, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e5, 0x1906,
-  0x2126, 0x2126, 0x1926, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2126, 0x1926, 0x1926, 0x1906,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x1084, 0x1084, 0x1084,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x1906, 0x2127, 0x2147, 0x2147, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6,
-  0x2126, 0x2126, 0x2126, 0x2126, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x1926, 0x1926, 0x1906,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x1084, 0x1084, 0x1084,
-  0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10c4, 0x18e6, 0x2127, 0x2147, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1906, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x1906, 0x1906, 0x2106, 0x2126, 0x2126, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2147, 0x2147, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2127, 0x2126, 0x1926, 0x1906,
-  0x1906, 0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x1084, 0x1084, 0x1084,
-  0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10c4, 0x1906, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x18e6, 0x1906, 0x1906, 0x2126, 0x2126, 0x2126, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2147, 0x2147, 0x2147,
-  0x2147, 0x2127, 0x2127, 0x2127, 0x2126, 0x2126, 0x1926, 0x1906,
-  0x1906, 0x1907, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x1084, 0x1084,
-  0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10c4, 0x10c4, 0x1906, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x1906, 0x1906, 0x2126, 0x2126, 0x2126, 0x2126, 0x2127,
-  0x2126, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2147,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x1926, 0x1926, 0x1906,
-  0x1906, 0x1906, 0x2127, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x1084, 0x1084,
-  0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10c4, 0x10c4, 0x1907, 0x2127, 0x2127,
-  0x2127, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x1906, 0x1906, 0x1906, 0x1906, 0x2126, 0x2126, 0x2126,
-  0x2126, 0x1926, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x2126, 0x1926, 0x1906,
-  0x1906, 0x1906, 0x1927, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1906, 0x18e7, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10a5, 0x10a5, 0x10a4, 0x10a4, 0x10a5,
-  0x10a5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x1084,
-  0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x18c5, 0x2127, 0x2127,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x2126,
-  0x2126, 0x2126, 0x2127, 0x2126, 0x2127, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2127, 0x1926, 0x1926, 0x1906,
-  0x1906, 0x1906, 0x1907, 0x2127, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1906, 0x1906, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10a5,
-  0x0884, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0884, 0x10a5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x1084,
-  0x1084, 0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x18e5, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x18e6, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x2126, 0x2126, 0x2126, 0x2126, 0x1926, 0x2127, 0x2127, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2126, 0x1926, 0x1926, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1927, 0x2127, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x1084, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x1084,
-  0x1084, 0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x1906,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1906, 0x18e6, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x18e6, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x2127,
-  0x2127, 0x2127, 0x2127, 0x2127, 0x2126, 0x1926, 0x1926, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x2127, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x18e6, 0x18e7, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x1084, 0x1084, 0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10c4,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x18e6, 0x18e7, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x2126, 0x2126, 0x2126, 0x2126,
-  0x2126, 0x2126, 0x2127, 0x2127, 0x2127, 0x1926, 0x1926, 0x2106,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x18e6, 0x18e7, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x1084, 0x1084, 0x1084, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x18e6, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1906, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x2126, 0x1906, 0x2126,
-  0x2126, 0x2126, 0x2126, 0x2127, 0x2127, 0x1926, 0x1926, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x18e6, 0x1906, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x18e7, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x10a4, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4,
-  0x10a4, 0x1906, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x18e7,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x2126,
-  0x2126, 0x2126, 0x2126, 0x2126, 0x2127, 0x1926, 0x2126, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x1084, 0x1084, 0x1084, 0x1084, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x1084, 0x1084,
-  0x1084, 0x10c5, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1906,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x2126, 0x2126, 0x2126, 0x2126, 0x2126, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x1906, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x10c5, 0x0883,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x1084, 0x1084, 0x1084, 0x1084, 0x10a4,
-  0x10a4, 0x10a4, 0x10a4, 0x10a4, 0x1084, 0x1084, 0x10a4, 0x10a4,
-  0x1084, 0x10a4, 0x1906, 0x1907, 0x1907, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x2126, 0x1906, 0x1906, 0x2126, 0x2126, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x18e6, 0x1084, 0x0883,
-  0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x1084, 0x1084, 0x1084,
-  0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084,
-  0x1084, 0x1084, 0x18c5, 0x1907, 0x1906, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x2126, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x10a4, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x1084, 0x1084,
-  0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x1084, 0x0883,
-  0x1084, 0x1084, 0x1084, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1906, 0x1907, 0x1907, 0x1907, 0x10c5, 0x0884, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x1084, 0x1084,
-  0x1084, 0x0883, 0x1084, 0x1084, 0x1084, 0x0883, 0x1084, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c5, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1906, 0x1907, 0x1907, 0x18e6, 0x1084, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x1084,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906, 0x1906,
-  0x1906, 0x1906, 0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1906, 0x1907, 0x1907, 0x10c5, 0x1084, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x1084, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1906, 0x1906, 0x18e6, 0x1906, 0x1927,
-  0x1927, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1907, 0x1907, 0x18e6, 0x1084, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x2127,
-  0x1907, 0x2127, 0x1907, 0x1907, 0x1906, 0x18e6, 0x18e6, 0x1907,
-  0x1907, 0x1907, 0x10c5, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x18e6, 0x10e6, 0x0884, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x10a4, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x1906, 0x1084, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10a5, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0863,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x10e6, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x1907, 0x10a4, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1084, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x1907, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x18e6, 0x1084, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x1906, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907,
-  0x10c5, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x1907, 0x1907, 0x1907, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1906,
-  0x10a4, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1084, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x1907, 0x1907,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x1907,
-  0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1907, 0x1906,
-  0x1084, 0x0883, 0x0883, 0x0883, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906, 0x18e6, 0x1907,
-  0x18e6, 0x1906, 0x1907, 0x1907, 0x18e6, 0x1907, 0x1906, 0x10c5,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0883, 0x0883, 0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x10e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4,
-  0x0883, 0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10e6,
-  0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5,
-  0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10c6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x0884, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c6, 0x10e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x10a5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a4, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x1084, 0x10a5, 0x10c6, 0x18e6, 0x18e6,
-  0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c5, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10a5,
-  0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x0884, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x1084, 0x10a4,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10a4, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x10a4, 0x10a4, 0x10a4, 0x10a5, 0x10c5, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0884, 0x10a4, 0x10a5, 0x10c5, 0x10a4, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a5, 0x1084, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a5, 0x1084, 0x1084,
-  0x10a4, 0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10a5,
-  0x10a5, 0x10a5, 0x10a4, 0x10a4, 0x10a5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10a5, 0x10a4, 0x1084, 0x0884, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c6, 0x10e6, 0x10c5, 0x10a5, 0x10a4, 0x1084, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x0884, 0x1084, 0x10a5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c6,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a5, 0x10a4,
-  0x1084, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x10a4, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0884, 0x10e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x10e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10a5, 0x10a4, 0x0884, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0884, 0x10a5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x10c6, 0x18e6, 0x10e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10a5, 0x1084, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c5, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10a5,
-  0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5, 0x10a5, 0x0884, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x10c5, 0x18e6, 0x18e6, 0x10a5, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10a5, 0x1084, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10a4, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x10a5, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884,
-  0x10a5, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10a4, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10a4, 0x10a4, 0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0884, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x1084,
-  0x10a4, 0x10a5, 0x10c6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10c6, 0x18e6, 0x10c6, 0x10a5, 0x1084, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10a5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c6, 0x18e6, 0x10c6,
-  0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10a5,
-  0x1084, 0x0884, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x10c6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x10c5, 0x10a5, 0x10a5, 0x10a4, 0x10a4, 0x10a5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x10c5, 0x18e6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x10c5, 0x0884, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10a4, 0x10e6, 0x0883, 0x0884, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x10e6, 0x10e6, 0x0884, 0x0884, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10c5, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10c5, 0x18e6, 0x10e6, 0x0884, 0x0884, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x10c5, 0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0884, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10a4, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884, 0x1084, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10e6, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10a5,
-  0x0863, 0x0863, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884, 0x1084, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x18e6, 0x10c6,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10c5,
-  0x0863, 0x0884, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c5, 0x18e6, 0x10a4, 0x0883, 0x10a4, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x10c6, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x10c6, 0x0883, 0x0863, 0x0863, 0x0883, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x1084, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x10c6,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10c5,
-  0x0863, 0x10c5, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x18e6, 0x18e6, 0x1084, 0x0884, 0x10c5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x18e6, 0x10c6, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x18e6, 0x10c6,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0883, 0x10c6,
-  0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x10c6,
-  0x0863, 0x0883, 0x0863, 0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6,
-  0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x10c5,
-  0x10a4, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10c6, 0x18e6, 0x18e6, 0x1084, 0x0883, 0x18e6, 0x1084, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a5, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x18e6,
-  0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x10c5,
-  0x1084, 0x1084, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5,
-  0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0883, 0x18e6, 0x10a4, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x10c6,
-  0x10e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x10c6,
-  0x10c6, 0x1084, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a4, 0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x10c5,
-  0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0884, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5,
-  0x18e6, 0x18e6, 0x10e6, 0x0863, 0x0883, 0x18e6, 0x10c5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x10c5,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6, 0x18e6,
-  0x10c6, 0x0863, 0x0863, 0x0884, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x10c5,
-  0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10a4, 0x10e6, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6,
-  0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0884, 0x18e6, 0x10c6, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10a4, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x10a5,
-  0x18e6, 0x10c6, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6, 0x18e6,
-  0x10a5, 0x0863, 0x0883, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x10c6,
-  0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10c5, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10c6,
-  0x18e6, 0x18e6, 0x10c5, 0x0863, 0x10a4, 0x18e6, 0x18e6, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0884, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863, 0x10a5,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6, 0x18e6,
-  0x0883, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x18e6, 0x18e6, 0x10a4, 0x0883, 0x0863, 0x0863, 0x10c6,
-  0x10c6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0884, 0x10e6, 0x18e6, 0x10e6, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6,
-  0x18e6, 0x18e6, 0x10a5, 0x0863, 0x10a5, 0x18e6, 0x18e6, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a4, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0883,
-  0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863, 0x10a5,
-  0x18e6, 0x0884, 0x0884, 0x10a5, 0x0863, 0x10c6, 0x18e6, 0x10c6,
-  0x1084, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0883, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x10c6, 0x18e6, 0x0883, 0x10a5, 0x10c5, 0x0883, 0x10c6,
-  0x10e6, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x0863, 0x0883, 0x10e6,
-  0x18e6, 0x18e6, 0x1084, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10a4, 0x0884, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0884, 0x10a4, 0x10a5, 0x10c5, 0x10c5,
-  0x10c5, 0x10a5, 0x10c5, 0x10a5, 0x1084, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863, 0x10c5,
-  0x10c6, 0x0863, 0x10a5, 0x18e6, 0x10a5, 0x10c6, 0x18e6, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0863, 0x1084, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c5, 0x10c6, 0x0863, 0x10c5, 0x18e6, 0x10c6, 0x10e6,
-  0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x1084, 0x0863, 0x10c6,
-  0x18e6, 0x10c6, 0x0863, 0x0883, 0x10e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10a4, 0x0863, 0x0863,
-  0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10a5, 0x10a4,
-  0x1084, 0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x10a4, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x10c6, 0x10a4, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863, 0x10c6,
-  0x10a5, 0x0863, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x10a5,
-  0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c5, 0x10c5, 0x0863, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10c5, 0x0883, 0x10c5,
-  0x18e6, 0x10a5, 0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10a5,
-  0x0884, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6, 0x0884, 0x0863, 0x10c5,
-  0x0883, 0x0884, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0863,
-  0x10c6, 0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10c5, 0x10a4, 0x0863, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6, 0x10c5, 0x10c5,
-  0x18e6, 0x0884, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x1084, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x0883, 0x0863, 0x10a4,
-  0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863,
-  0x1084, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863, 0x0863, 0x0883,
-  0x0863, 0x10a4, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x10c5, 0x0863, 0x0884, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10a5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x10c6, 0x10a5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084,
-  0x0863, 0x10c5, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0883, 0x0884,
-  0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6,
-  0x0884, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10c6, 0x10e6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x10c6, 0x0884, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0863, 0x0883, 0x10e6, 0x18e6, 0x18e6, 0x0884, 0x0863, 0x0884,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5,
-  0x0863, 0x0883, 0x0883, 0x0863, 0x0863, 0x0883, 0x10e6, 0x10a4,
-  0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x10e6, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x0883, 0x0863, 0x10a5, 0x18e6, 0x18e6, 0x10c6, 0x1084, 0x0883,
-  0x0863, 0x0863, 0x0884, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4,
-  0x0863, 0x1084, 0x10c6, 0x0883, 0x0863, 0x0863, 0x1084, 0x0863,
-  0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x0883, 0x0863, 0x0863, 0x0883, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10e6, 0x18e6, 0x18e6,
-  0x10a5, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1084, 0x0863, 0x0884, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0863,
-  0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884,
-  0x0863, 0x0884, 0x18e6, 0x10c6, 0x0884, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0883, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a4, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x10c5, 0x0863,
-  0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10a5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0863,
-  0x0863, 0x0884, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0883,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a5, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6, 0x10a4, 0x0863,
-  0x0863, 0x0884, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863,
-  0x0863, 0x1084, 0x18e6, 0x10c6, 0x0884, 0x0863, 0x0863, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0883, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0884, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a4, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x10e6, 0x0883, 0x0863,
-  0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863,
-  0x0863, 0x10a4, 0x10e6, 0x0884, 0x0863, 0x0863, 0x1084, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0884, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1084, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x10a4, 0x0863, 0x0863,
-  0x0883, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863,
-  0x0863, 0x10a4, 0x1084, 0x0863, 0x0863, 0x0883, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x0863, 0x0863, 0x0863, 0x10a5, 0x10c5, 0x0863, 0x0863, 0x0863,
-  0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084,
-  0x0863, 0x0863, 0x0863, 0x0884, 0x0863, 0x0863, 0x0863, 0x0884,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x1084, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x1084, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10a4, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0884, 0x1084, 0x10a5, 0x10a5, 0x10c5,
-  0x10c5, 0x10a5, 0x10a5, 0x1084, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x0884, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0884, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x10a4, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10a4,
-  0x10c5, 0x10c5, 0x10a5, 0x1084, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x10a4, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x10a5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884,
-  0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10c6,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x10a5, 0x10a5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0884,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x1084, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x1084, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10a4, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10a5,
-  0x10a4, 0x10a4, 0x10a5, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10a4, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10a5, 0x0883, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6,
-  0x18e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x1084, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x1084, 0x10a5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c5, 0x10a4, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6,
-  0x18e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0884, 0x1084, 0x10a4, 0x10a5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a5, 0x10a4, 0x1084, 0x0884,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x10e6, 0x10e6, 0x18e6, 0x18e6, 0x10c6, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c6, 0x18e6, 0x18e6, 0x10e6, 0x10c6, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0883, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x1084, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x10c5, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10a4,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c6, 0x18e6, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x10a4, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10a5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c6, 0x10c5, 0x10c6, 0x18e6, 0x18e6, 0x18e6,
-  0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x1964, 0x2a62, 0x32e1, 0x3300, 0x32c1, 0x21e3,
-  0x10e5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10a5, 0x1084, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x10c5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x1905, 0x2a62, 0x3b80, 0x3b40, 0x32a1, 0x2a62, 0x2ac1, 0x3b80,
-  0x32c1, 0x1905, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10a4, 0x0884,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0884, 0x10a4, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6, 0x10c5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1905,
-  0x32e1, 0x3ba0, 0x2a62, 0x10e5, 0x10c5, 0x10c5, 0x10c5, 0x2184,
-  0x3ba0, 0x2a62, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x10a5, 0x1084, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10a4,
-  0x10c5, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a4, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x2aa1,
-  0x3ba0, 0x2202, 0x10c5, 0x21a3, 0x2ac1, 0x32e1, 0x2a42, 0x10c5,
-  0x21e3, 0x3b60, 0x1924, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10a5, 0x10a4, 0x1084,
-  0x0884, 0x0883, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0883, 0x0884, 0x1084, 0x10a4, 0x10a5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10a4, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x2184, 0x3ba0,
-  0x2a81, 0x10c5, 0x2222, 0x3340, 0x2a42, 0x2203, 0x2ac1, 0x2a62,
-  0x18e5, 0x3b80, 0x21e3, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x10c6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1127, 0x1107, 0x18e6, 0x18e6, 0x10e6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c5, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x2242, 0x3380,
-  0x1924, 0x1964, 0x2ae1, 0x1105, 0x10c5, 0x10c5, 0x10e5, 0x2aa1,
-  0x1924, 0x3320, 0x2202, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e7, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1106,
-  0x1127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c6, 0x10c6, 0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x22c1, 0x22c1,
-  0x10c5, 0x2281, 0x1984, 0x10c5, 0x10c5, 0x10c5, 0x10e5, 0x2261,
-  0x1944, 0x2b40, 0x19c3, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x1927,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1107, 0x1147,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10c5, 0x1105, 0x1ae0, 0x1a61,
-  0x10e5, 0x1aa1, 0x1144, 0x1124, 0x10c5, 0x10c5, 0x19e2, 0x19c3,
-  0x1984, 0x2340, 0x1904, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1948,
-  0x1927, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1107, 0x1127, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10e6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c6,
-  0x10a5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x1105, 0x12e1, 0x0a22,
-  0x10e5, 0x12c0, 0x1144, 0x1183, 0x11a3, 0x11e2, 0x1202, 0x10c5,
-  0x12a1, 0x1261, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1988, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1947, 0x222a, 0x2a8b, 0x2aab, 0x2a8b, 0x21a9,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1106, 0x1127, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c6, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x1105, 0x0aa1, 0x0a61,
-  0x10c5, 0x0a81, 0x0a61, 0x10c5, 0x1124, 0x1105, 0x10c5, 0x0a22,
-  0x0b01, 0x1144, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1907, 0x1168, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x19ea, 0x22cd, 0x330d, 0x2aed, 0x2acc, 0x3b0d, 0x3b2d,
-  0x222a, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1127, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10a5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x10e5, 0x0261, 0x0281,
-  0x10c5, 0x1144, 0x0301, 0x0242, 0x0964, 0x0984, 0x0282, 0x02e1,
-  0x0983, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1968, 0x1927, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907,
-  0x122b, 0x12ce, 0x1aac, 0x1a8c, 0x128c, 0x1aac, 0x1aac, 0x22cc,
-  0x332d, 0x1a0a, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1107, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6,
-  0x10e6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x10c6, 0x10c5, 0x10c5, 0x0203, 0x0282,
-  0x1124, 0x10c5, 0x0944, 0x0222, 0x0262, 0x0242, 0x09e3, 0x1124,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1907, 0x1168, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1107, 0x022c,
-  0x02ae, 0x026d, 0x028d, 0x028d, 0x0a8d, 0x0aad, 0x0aad, 0x0aad,
-  0x1a8c, 0x22ee, 0x1189, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1106, 0x1106, 0x18e6, 0x18e6, 0x18e6, 0x1107,
-  0x1127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10e6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10e6, 0x10e6, 0x10e6, 0x18e6, 0x10c6, 0x0883, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x09a4, 0x0283,
-  0x0984, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1168, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x09ea, 0x024d,
-  0x022c, 0x024c, 0x024c, 0x024c, 0x024c, 0x024c, 0x026d, 0x028d,
-  0x026c, 0x12ad, 0x128c, 0x1107, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x1107, 0x1107,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10e6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10e6, 0x10e6, 0x10e6, 0x10e6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10e6, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x1124, 0x0263,
-  0x01e3, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c6, 0x10c6, 0x10c6, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x1127, 0x1147, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0989, 0x022c, 0x01eb,
-  0x020b, 0x020c, 0x01eb, 0x01ca, 0x01ca, 0x01ca, 0x020b, 0x022c,
-  0x022c, 0x022b, 0x0aae, 0x0989, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10e6, 0x10e6, 0x18e6, 0x10e6, 0x1127, 0x1106, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10e6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0883, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c6, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10e5, 0x10e5, 0x10c5, 0x10c5, 0x10c5, 0x01e3,
-  0x0243, 0x0924, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1147, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1128, 0x01eb, 0x01ca, 0x01cb,
-  0x01cb, 0x0989, 0x09a9, 0x1a0a, 0x224a, 0x1a2a, 0x09ca, 0x01ca,
-  0x020b, 0x020b, 0x024c, 0x0a2b, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10c6, 0x18e6, 0x10e6, 0x1127, 0x1106, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x1167, 0x10e6, 0x10c5, 0x10c5, 0x0964,
-  0x0263, 0x09a3, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1127, 0x10e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0189, 0x01cb, 0x01aa, 0x098a,
-  0x0969, 0x19ea, 0x3acb, 0x4aeb, 0x4b0b, 0x4b0b, 0x3aab, 0x11a9,
-  0x01aa, 0x020b, 0x01eb, 0x024c, 0x1128, 0x18e6, 0x18e6, 0x18e6,
-  0x10a5, 0x10c6, 0x18e6, 0x1107, 0x1106, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x18e6, 0x10e6, 0x10c6, 0x10e5, 0x1186, 0x10c5, 0x10c5, 0x10e5,
-  0x0202, 0x0222, 0x10e5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x10c6, 0x10e6,
-  0x10e6, 0x10e6, 0x10e6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1107, 0x1127, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1108, 0x018a, 0x0169, 0x0969, 0x0948,
-  0x2a4a, 0x4b0b, 0x4b0b, 0x42eb, 0x42eb, 0x42eb, 0x4b0b, 0x3aab,
-  0x0989, 0x01aa, 0x01ca, 0x020c, 0x0989, 0x18e6, 0x18e6, 0x10c6,
-  0x10a5, 0x18e6, 0x1106, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1084, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x10c5, 0x10c6, 0x11c7, 0x1946, 0x10c6, 0x10c6,
-  0x09c3, 0x0242, 0x0964, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10e6, 0x10c6,
-  0x10c6, 0x10c6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1107, 0x1107, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x1127, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x0149, 0x0169, 0x0949, 0x0928, 0x2a2a,
-  0x4b0b, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x430b, 0x4b0b,
-  0x2a4a, 0x0149, 0x01aa, 0x01ab, 0x098a, 0x18e6, 0x18e6, 0x1085,
-  0x10a6, 0x10e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10c5, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x10e6, 0x10e6, 0x18e6, 0x18e6, 0x1127, 0x1228, 0x18e6, 0x18e6,
-  0x0944, 0x0223, 0x09c3, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6,
-  0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1106, 0x1107,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x1106, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e7, 0x0929, 0x0129, 0x0907, 0x2189, 0x4b0b,
-  0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb,
-  0x42eb, 0x1989, 0x0149, 0x018a, 0x016a, 0x1107, 0x18e6, 0x1084,
-  0x10c6, 0x10c6, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x0883, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1248, 0x1167, 0x18e6,
-  0x1125, 0x01e2, 0x01c2, 0x1106, 0x10e6, 0x10e6, 0x10e6, 0x10e6,
-  0x10e6, 0x18e6, 0x1147, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6,
-  0x1107, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1106, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x08e7, 0x0908, 0x08e8, 0x1107, 0x42cb, 0x4b0b,
-  0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb,
-  0x4b0b, 0x2a4a, 0x0108, 0x0169, 0x016a, 0x1107, 0x1085, 0x1065,
-  0x10c6, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x1106, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x11a7, 0x1248, 0x18e6,
-  0x10e6, 0x01c3, 0x0222, 0x1144, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1167, 0x1167, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1107, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x08e7, 0x08e8, 0x08a6, 0x29e9, 0x430b, 0x42eb,
-  0x430b, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb, 0x42eb,
-  0x4b0b, 0x42cb, 0x1127, 0x0908, 0x0949, 0x1107, 0x1064, 0x10a5,
-  0x10a5, 0x18c6, 0x18e6, 0x1147, 0x09e8, 0x0a69, 0x0aa9, 0x12a9,
-  0x0a08, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0884,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a4, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1907, 0x12a8, 0x1127,
-  0x18e6, 0x0964, 0x0242, 0x0984, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1208, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x10e7, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c6, 0x08c7, 0x08c7, 0x10c7, 0x3aaa, 0x42cb, 0x42cb,
-  0x42eb, 0x42cb, 0x42eb, 0x42eb, 0x42eb, 0x430b, 0x430b, 0x42eb,
-  0x42eb, 0x4b0b, 0x1988, 0x08e7, 0x0129, 0x08c6, 0x1044, 0x10a5,
-  0x1085, 0x1127, 0x0a29, 0x0aa9, 0x0289, 0x0a89, 0x0a69, 0x1269,
-  0x1aca, 0x11e8, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x1084, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1248, 0x11e7,
-  0x18e6, 0x0964, 0x0202, 0x0982, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x11c8, 0x11c8, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1106, 0x18e6, 0x10e6, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a6, 0x10c5, 0x18e6, 0x10e6,
-  0x18e6, 0x10c6, 0x08c7, 0x0886, 0x2188, 0x3aeb, 0x3aaa, 0x3aeb,
-  0x2125, 0x2105, 0x3aeb, 0x42ca, 0x42eb, 0x3269, 0x3228, 0x42eb,
-  0x42cb, 0x430b, 0x21c9, 0x08a6, 0x0908, 0x08a6, 0x1044, 0x1085,
-  0x0947, 0x0228, 0x0a69, 0x0a28, 0x0228, 0x0228, 0x0208, 0x0208,
-  0x0a08, 0x1289, 0x1127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a4, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x11c7, 0x1268,
-  0x18e6, 0x1105, 0x01a2, 0x0142, 0x1105, 0x18e6, 0x18e6, 0x18e6,
-  0x0a49, 0x1127, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10e6, 0x18e6, 0x10e6, 0x1106,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x0886, 0x08a7, 0x0866, 0x29e9, 0x3acb, 0x3acb, 0x3249,
-  0x1021, 0x10c4, 0x32aa, 0x3acb, 0x3aaa, 0x1862, 0x18a3, 0x3acb,
-  0x3acb, 0x3aeb, 0x2a09, 0x08a6, 0x08e8, 0x1086, 0x1065, 0x0987,
-  0x0a28, 0x0208, 0x09e7, 0x01e7, 0x01e7, 0x01c7, 0x09c7, 0x09e8,
-  0x01c7, 0x1209, 0x1187, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0883, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1146, 0x12a8,
-  0x1966, 0x10c6, 0x0942, 0x0962, 0x1104, 0x18e6, 0x18e6, 0x1187,
-  0x0a68, 0x18e6, 0x18e6, 0x18e6, 0x1107, 0x1127, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10e6, 0x18e6, 0x10e6,
-  0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x10a6, 0x1085, 0x18e6, 0x2147,
-  0x29a8, 0x1927, 0x0866, 0x1086, 0x326a, 0x32aa, 0x32ab, 0x29e7,
-  0x0862, 0x1146, 0x2a6a, 0x3aeb, 0x29c7, 0x1042, 0x1125, 0x32aa,
-  0x3aab, 0x3aeb, 0x2a29, 0x0886, 0x08a7, 0x1086, 0x0967, 0x09e7,
-  0x09c7, 0x01a7, 0x0187, 0x09a7, 0x11e8, 0x1a08, 0x09c8, 0x0987,
-  0x0987, 0x09c7, 0x11a7, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906, 0x1267,
-  0x11e6, 0x18e6, 0x0922, 0x0962, 0x1104, 0x18e6, 0x18e6, 0x0a08,
-  0x09e8, 0x18e6, 0x18e6, 0x1108, 0x0949, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x10c6, 0x18e6, 0x18e6,
-  0x10e6, 0x10e6, 0x18e6, 0x18e6, 0x10a5, 0x1065, 0x29e9, 0x3a8b,
-  0x326b, 0x3a8b, 0x21a9, 0x18e7, 0x328a, 0x326a, 0x32ab, 0x21a7,
-  0x0883, 0x0946, 0x2a6a, 0x32cb, 0x2146, 0x0883, 0x0966, 0x32aa,
-  0x32aa, 0x32cb, 0x2a2a, 0x0886, 0x0866, 0x0947, 0x09e8, 0x0966,
-  0x0166, 0x0987, 0x2229, 0x32ab, 0x42cc, 0x42cc, 0x3acc, 0x11a7,
-  0x0146, 0x0987, 0x1187, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5, 0x18e6,
-  0x18e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1206,
-  0x1206, 0x1906, 0x0903, 0x0942, 0x0903, 0x18e6, 0x18e6, 0x0a48,
-  0x1187, 0x18e6, 0x1107, 0x018a, 0x10e7, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c6, 0x18e6,
-  0x18e6, 0x10e6, 0x18e6, 0x18e6, 0x10a5, 0x2189, 0x2a0b, 0x21ab,
-  0x21ab, 0x21ab, 0x2a0c, 0x21cb, 0x224a, 0x2a6a, 0x2aab, 0x2187,
-  0x0883, 0x0926, 0x2a4a, 0x32ab, 0x1905, 0x00a4, 0x0987, 0x32aa,
-  0x328a, 0x32ab, 0x2a29, 0x0866, 0x0866, 0x0927, 0x0187, 0x0946,
-  0x19e9, 0x328b, 0x3aac, 0x3aac, 0x3aac, 0x3aac, 0x42ec, 0x326b,
-  0x0126, 0x0946, 0x0946, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x10e6,
-  0x18e6, 0x10c6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x10c5, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e7, 0x1127, 0x1128, 0x1148, 0x18e7, 0x18e6, 0x11c6,
-  0x1247, 0x1946, 0x08e3, 0x0922, 0x0903, 0x18e6, 0x1147, 0x0a68,
-  0x1127, 0x18e6, 0x018a, 0x1128, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10a5, 0x18e6,
-  0x18e6, 0x18e6, 0x10e6, 0x18e6, 0x1929, 0x19ac, 0x194b, 0x194a,
-  0x1909, 0x1909, 0x194b, 0x21ac, 0x21cb, 0x224a, 0x2a6a, 0x21e8,
-  0x0822, 0x1126, 0x2a6a, 0x2a8a, 0x18e4, 0x0063, 0x19a7, 0x328a,
-  0x2a6a, 0x32aa, 0x2a09, 0x0865, 0x0866, 0x08e7, 0x0967, 0x222a,
-  0x328b, 0x32ab, 0x32ab, 0x328b, 0x32ab, 0x3aab, 0x3aac, 0x3aac,
-  0x1147, 0x00e6, 0x0906, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10c6,
-  0x18e6, 0x10c6, 0x18e6, 0x18e6, 0x10e6, 0x10a5, 0x10c6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1106, 0x10e7, 0x1107, 0x1168, 0x11aa, 0x1107, 0x1186,
-  0x1a47, 0x11a6, 0x10c4, 0x0902, 0x0902, 0x18e6, 0x11a7, 0x0a48,
-  0x18e6, 0x0928, 0x018a, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1085, 0x10c6,
-  0x18e6, 0x18e6, 0x10c6, 0x10e7, 0x194c, 0x194b, 0x18c8, 0x10a7,
-  0x18c7, 0x18a7, 0x10a7, 0x190a, 0x216b, 0x21ca, 0x2a29, 0x2a29,
-  0x1926, 0x21e8, 0x226a, 0x228a, 0x1946, 0x1083, 0x2229, 0x2a6a,
-  0x2a4a, 0x2a8a, 0x21c9, 0x1045, 0x0845, 0x0927, 0x224a, 0x2a6b,
-  0x2a4b, 0x2a6b, 0x2a6b, 0x328b, 0x328b, 0x328b, 0x328b, 0x3aac,
-  0x1168, 0x00a5, 0x08e6, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x10a5,
-  0x10c6, 0x10c5, 0x18e6, 0x18e6, 0x10c5, 0x10a5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1148, 0x0989, 0x1187,
-  0x1206, 0x11a6, 0x10e4, 0x0902, 0x08e2, 0x10e5, 0x11c7, 0x11c7,
-  0x1107, 0x01ab, 0x1128, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10a5, 0x1085,
-  0x18e6, 0x18e6, 0x10c6, 0x192a, 0x192b, 0x18c8, 0x18a7, 0x21a9,
-  0x326a, 0x2a4a, 0x2168, 0x1887, 0x18ea, 0x214a, 0x21c9, 0x2a09,
-  0x224a, 0x224a, 0x224a, 0x224a, 0x2229, 0x2209, 0x2a29, 0x2a09,
-  0x2a09, 0x2a6a, 0x1988, 0x1025, 0x1065, 0x19a9, 0x224a, 0x224a,
-  0x224a, 0x2a6b, 0x2a6b, 0x2a6b, 0x2a6b, 0x328b, 0x32ab, 0x3aab,
-  0x1968, 0x0885, 0x08c5, 0x18e5, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0883,
-  0x10c5, 0x10e6, 0x18e6, 0x10c6, 0x10a5, 0x10c5, 0x10e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x0989, 0x11a8,
-  0x11c5, 0x11c5, 0x1104, 0x08c2, 0x08c2, 0x1105, 0x09c6, 0x11a6,
-  0x0948, 0x018a, 0x10e7, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c6, 0x1064,
-  0x18e6, 0x18e6, 0x18e7, 0x192b, 0x18e9, 0x1886, 0x21c9, 0x2aab,
-  0x2a8b, 0x2a8b, 0x2aab, 0x2188, 0x1087, 0x18ea, 0x1969, 0x2209,
-  0x1a09, 0x1a29, 0x1a2a, 0x1a2a, 0x1a2a, 0x2229, 0x2a09, 0x2a09,
-  0x29e9, 0x2a49, 0x1927, 0x1025, 0x1065, 0x11c9, 0x1a2a, 0x224a,
-  0x224a, 0x21e9, 0x224a, 0x226a, 0x2a4b, 0x2a6b, 0x2a6b, 0x32ac,
-  0x1967, 0x0864, 0x0885, 0x20e5, 0x20e5, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x10e7, 0x10e7, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10c5, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x10a5, 0x18e6, 0x18e6, 0x10c5, 0x1084, 0x10c5, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1148, 0x1189,
-  0x1186, 0x11c5, 0x1104, 0x10a2, 0x10c2, 0x1104, 0x11c6, 0x1186,
-  0x0169, 0x0929, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x1107, 0x1084,
-  0x1085, 0x18e6, 0x10e9, 0x190b, 0x1087, 0x18e7, 0x2a8b, 0x2a6b,
-  0x224b, 0x224b, 0x224b, 0x224a, 0x18c6, 0x1088, 0x18e9, 0x11a9,
-  0x1a09, 0x1a09, 0x1a29, 0x1a09, 0x1a09, 0x1a09, 0x2209, 0x21e9,
-  0x21e9, 0x224a, 0x10c6, 0x1005, 0x1086, 0x11c9, 0x1a09, 0x1a4a,
-  0x1945, 0x1042, 0x2209, 0x226b, 0x226b, 0x224b, 0x2a4b, 0x2a8b,
-  0x1947, 0x0844, 0x1084, 0x20a4, 0x20c4, 0x1209, 0x0a2a, 0x0a09,
-  0x11e9, 0x11a8, 0x1188, 0x1188, 0x10e6, 0x1106, 0x1106, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0884, 0x18e6, 0x18e6, 0x10a4, 0x1084, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1127, 0x1189,
-  0x1166, 0x1185, 0x1124, 0x10a2, 0x10a2, 0x1104, 0x1185, 0x0966,
-  0x016a, 0x0927, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1906, 0x1127,
-  0x1168, 0x11a8, 0x11e9, 0x0a09, 0x122a, 0x124a, 0x0a4a, 0x1126,
-  0x1064, 0x120a, 0x110a, 0x10c9, 0x1866, 0x21c9, 0x226b, 0x2209,
-  0x220a, 0x220a, 0x19c8, 0x226b, 0x1988, 0x1046, 0x1089, 0x1109,
-  0x11e9, 0x19e9, 0x19e9, 0x19e9, 0x19e9, 0x1a09, 0x1a09, 0x1a09,
-  0x1a09, 0x1a09, 0x1086, 0x1024, 0x10c6, 0x11c9, 0x1a09, 0x19c8,
-  0x1062, 0x08a4, 0x1a2a, 0x19a8, 0x1925, 0x224a, 0x224a, 0x2a6b,
-  0x10e6, 0x0844, 0x1065, 0x1884, 0x2084, 0x11a8, 0x0aec, 0x0a8b,
-  0x0a4a, 0x0aac, 0x0acc, 0x0acb, 0x0acc, 0x0aab, 0x0a6a, 0x1229,
-  0x11e9, 0x1148, 0x11e5, 0x1166, 0x1107, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1084, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0884, 0x08a4, 0x08c4, 0x08e4, 0x08e4, 0x08c4, 0x08a4, 0x0883,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0883, 0x0883, 0x0883, 0x0883, 0x0863,
-  0x0863, 0x10a4, 0x18e6, 0x0884, 0x10a4, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x1106, 0x1127, 0x1147, 0x1168, 0x11a8, 0x11e9, 0x11e9,
-  0x1229, 0x124a, 0x122a, 0x124a, 0x124a, 0x126a, 0x09e9, 0x1168,
-  0x1147, 0x1164, 0x1103, 0x10a2, 0x10a2, 0x10e4, 0x1165, 0x0947,
-  0x0949, 0x1127, 0x1107, 0x10e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x1127, 0x1188, 0x120a, 0x0aab, 0x0acc,
-  0x0acc, 0x0acc, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x130c, 0x124a,
-  0x1064, 0x1148, 0x10c9, 0x1087, 0x18a6, 0x222a, 0x1a0a, 0x1082,
-  0x1146, 0x18e5, 0x10a3, 0x1a2a, 0x1a09, 0x1065, 0x1047, 0x1088,
-  0x11a8, 0x19c8, 0x19c9, 0x19e9, 0x19e9, 0x11c9, 0x11c9, 0x11e9,
-  0x1209, 0x11a8, 0x1025, 0x1025, 0x1107, 0x11a8, 0x19e9, 0x1125,
-  0x0884, 0x11a8, 0x19c8, 0x1022, 0x1063, 0x1a0a, 0x222a, 0x222a,
-  0x1085, 0x0844, 0x1044, 0x1884, 0x1864, 0x1167, 0x0a4a, 0x11c8,
-  0x0acb, 0x0acc, 0x0acc, 0x0acc, 0x0b0c, 0x0aec, 0x0aec, 0x0aec,
-  0x0aec, 0x0b0c, 0x0a4d, 0x0a8c, 0x0aab, 0x126a, 0x1229, 0x09e9,
-  0x1126, 0x1167, 0x1147, 0x1107, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x10c5, 0x10a5, 0x10a4, 0x10c5, 0x10c5, 0x1084, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x08a4, 0x0905, 0x1107, 0x0987, 0x0a08,
-  0x0a4a, 0x0a8b, 0x0aab, 0x0acb, 0x0acb, 0x0aab, 0x0a8a, 0x0a49,
-  0x09e9, 0x09e8, 0x0987, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863,
-  0x0863, 0x0863, 0x10a5, 0x0884, 0x10c5, 0x1127, 0x1188, 0x0a09,
-  0x124a, 0x0a8b, 0x0acb, 0x0aec, 0x0acc, 0x0acc, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0a8b, 0x1147,
-  0x1147, 0x1165, 0x1103, 0x1082, 0x1082, 0x10c3, 0x1145, 0x0927,
-  0x0928, 0x0a6a, 0x0aab, 0x0a8a, 0x124a, 0x1229, 0x11e9, 0x1188,
-  0x1127, 0x1188, 0x1147, 0x1127, 0x1107, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1107, 0x1127, 0x1168, 0x11a9, 0x11c8, 0x11e9, 0x1209, 0x122a,
-  0x124a, 0x124a, 0x0a4a, 0x0a4a, 0x1209, 0x11c9, 0x1188, 0x1147,
-  0x1906, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x1107, 0x11a8, 0x124a, 0x0aac, 0x12ec, 0x0aec, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x12ec, 0x1acb, 0x1aec, 0x234d, 0x1a8b,
-  0x1086, 0x10a7, 0x10a9, 0x1866, 0x1927, 0x1a4a, 0x19a8, 0x0862,
-  0x1166, 0x10c4, 0x08c4, 0x11e9, 0x1a0a, 0x10c6, 0x1046, 0x1048,
-  0x1107, 0x11a8, 0x11a8, 0x11a8, 0x11a8, 0x19c8, 0x19a8, 0x19a8,
-  0x19e9, 0x1127, 0x1024, 0x1045, 0x1127, 0x1168, 0x19a8, 0x1083,
-  0x08c4, 0x11c9, 0x10c4, 0x08a4, 0x1187, 0x1a4a, 0x1a2a, 0x19e9,
-  0x0824, 0x0824, 0x1844, 0x1844, 0x1844, 0x1085, 0x09a8, 0x0acb,
-  0x0aeb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acb, 0x0acb,
-  0x0acb, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0acc, 0x0acb,
-  0x0b4d, 0x0b0c, 0x0acb, 0x0aab, 0x126a, 0x0a2a, 0x11e9, 0x11e9,
-  0x11a9, 0x1147, 0x1127, 0x1907, 0x18e6, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x10e6, 0x10c5,
-  0x0884, 0x0863, 0x0863, 0x0863, 0x0863, 0x0863, 0x0884, 0x08c4,
-  0x0946, 0x09e8, 0x0a08, 0x0aaa, 0x0aec, 0x0b0b, 0x0acb, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0acc, 0x0987, 0x09a7, 0x0a09, 0x09a8, 0x0946,
-  0x1146, 0x1105, 0x0905, 0x08c4, 0x08c4, 0x08c4, 0x08c4, 0x08e5,
-  0x0905, 0x1125, 0x09a7, 0x0a29, 0x0a6a, 0x0acc, 0x12cc, 0x0aac,
-  0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0a8a, 0x0927,
-  0x0927, 0x1145, 0x10e3, 0x1062, 0x1082, 0x10c3, 0x1124, 0x0927,
-  0x0907, 0x0aab, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0acc, 0x0b0c,
-  0x0b4d, 0x0aec, 0x0aec, 0x0acb, 0x0aab, 0x0a8a, 0x0a4a, 0x0a4a,
-  0x0a2a, 0x122a, 0x11a8, 0x1188, 0x1167, 0x1947, 0x1127, 0x1127,
-  0x1167, 0x1168, 0x1188, 0x11a8, 0x11e9, 0x09c8, 0x126a, 0x0a8a,
-  0x0aab, 0x0acc, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0acc, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec,
-  0x0aab, 0x0a4a, 0x1209, 0x1147, 0x1106, 0x18e6, 0x18e6, 0x18e6,
-  0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x18e6, 0x1127, 0x122a,
-  0x0a8b, 0x0aec, 0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x12ec,
-  0x130c, 0x22eb, 0x2b0b, 0x2aea, 0x2aca, 0x2aca, 0x2269, 0x18e6,
-  0x1065, 0x1067, 0x1088, 0x1845, 0x1168, 0x1a2a, 0x11a8, 0x0842,
-  0x0967, 0x10e5, 0x0883, 0x11a8, 0x19c9, 0x1147, 0x1025, 0x1027,
-  0x1087, 0x1167, 0x1168, 0x1168, 0x1188, 0x1188, 0x1168, 0x1188,
-  0x11a8, 0x1086, 0x1004, 0x1065, 0x1127, 0x1167, 0x1188, 0x10e5,
-  0x1147, 0x1146, 0x0863, 0x0946, 0x19e9, 0x19e9, 0x1a4a, 0x1147,
-  0x0804, 0x1024, 0x1844, 0x1844, 0x1844, 0x1864, 0x12cb, 0x0aec,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0aec,
-  0x0aec, 0x0acc, 0x0aec, 0x0aec, 0x0acc, 0x0acc, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0acc, 0x0aab, 0x0a8b, 0x0a6a, 0x0a4a, 0x1209,
-  0x1a09, 0x0a4a, 0x122a, 0x1209, 0x11a8, 0x1167, 0x1146, 0x0966,
-  0x0966, 0x1146, 0x1167, 0x09e8, 0x0a09, 0x0a29, 0x0a8a, 0x0acb,
-  0x0acc, 0x128b, 0x0aec, 0x0acc, 0x0aec, 0x0aec, 0x0acc, 0x0acc,
-  0x0aab, 0x0aab, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0aab, 0x0aab,
-  0x0acc, 0x0acc, 0x0aec, 0x130c, 0x0b2d, 0x0aec, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0aec,
-  0x0aec, 0x0aec, 0x0b0c, 0x0aec, 0x0acc, 0x0acc, 0x0aec, 0x0acc,
-  0x0acc, 0x0acb, 0x0acb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x0aab, 0x1126,
-  0x1126, 0x1145, 0x10c3, 0x1062, 0x1082, 0x10a2, 0x1104, 0x0906,
-  0x0906, 0x0a8a, 0x0acb, 0x0acb, 0x0acb, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12cc,
-  0x12ec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x0b0c, 0x0b0c, 0x0b4d, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acb, 0x0acb, 0x0acb, 0x0aeb, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aab, 0x0a6a, 0x11c8, 0x1167,
-  0x1107, 0x18e6, 0x18e6, 0x18e6, 0x1107, 0x19a8, 0x0aab, 0x0b0c,
-  0x0aeb, 0x0acc, 0x0aeb, 0x12cb, 0x12ec, 0x130c, 0x1b0c, 0x232c,
-  0x22eb, 0x2aa9, 0x2289, 0x1a8a, 0x128a, 0x0a8b, 0x1107, 0x1886,
-  0x1024, 0x1066, 0x1068, 0x1845, 0x11a8, 0x11c9, 0x19a8, 0x1105,
-  0x1188, 0x1967, 0x1105, 0x11a8, 0x1188, 0x1167, 0x1045, 0x1006,
-  0x1046, 0x1107, 0x1947, 0x1947, 0x1147, 0x1147, 0x1147, 0x1167,
-  0x1127, 0x1024, 0x1004, 0x10a6, 0x1106, 0x1147, 0x1167, 0x1168,
-  0x19a8, 0x1126, 0x08a4, 0x11a8, 0x19e9, 0x11c9, 0x1a09, 0x1085,
-  0x0804, 0x1024, 0x1824, 0x1824, 0x1824, 0x1885, 0x22aa, 0x22eb,
-  0x1aec, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acc, 0x0acc, 0x0aec,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0b0c,
-  0x0b0c, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x0b0c, 0x0aec, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0aec, 0x0acc, 0x0acb, 0x0acb, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aeb, 0x0acb, 0x0acb,
-  0x0acb, 0x0aac, 0x0acb, 0x0acb, 0x0acc, 0x0acc, 0x0acc, 0x0acb,
-  0x0acb, 0x0acb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0a6a, 0x10e5,
-  0x10e5, 0x1124, 0x10c3, 0x1062, 0x1082, 0x10a2, 0x10e4, 0x08e5,
-  0x08e5, 0x0aab, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0aeb,
-  0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acb, 0x0acb, 0x0aec, 0x0aec, 0x0aec, 0x0acc,
-  0x0acc, 0x122a, 0x11e9, 0x0a2a, 0x124a, 0x0aec, 0x0acb, 0x0aab,
-  0x0aac, 0x12ec, 0x12ec, 0x130c, 0x232c, 0x22ea, 0x228a, 0x1a49,
-  0x0a2a, 0x024b, 0x022a, 0x022b, 0x026b, 0x0988, 0x1886, 0x1024,
-  0x1024, 0x1046, 0x1047, 0x1065, 0x11a8, 0x1188, 0x1188, 0x11a8,
-  0x1188, 0x1188, 0x1168, 0x1167, 0x1147, 0x1147, 0x1065, 0x1006,
-  0x1006, 0x10c6, 0x1106, 0x1106, 0x1106, 0x1107, 0x1107, 0x1147,
-  0x10a6, 0x1004, 0x1025, 0x10c5, 0x10e6, 0x1107, 0x1127, 0x1947,
-  0x1167, 0x1168, 0x1168, 0x11a8, 0x11a8, 0x19c9, 0x1188, 0x1024,
-  0x1024, 0x1824, 0x1824, 0x1824, 0x1824, 0x1064, 0x022a, 0x126a,
-  0x22ab, 0x22eb, 0x1aec, 0x130c, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aab, 0x0acb, 0x02ab, 0x028b,
-  0x02ab, 0x02ab, 0x0aab, 0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aab, 0x028b, 0x0a09, 0x10e5,
-  0x10e5, 0x1104, 0x10a2, 0x1082, 0x1082, 0x10a2, 0x10a4, 0x08e5,
-  0x08e5, 0x0229, 0x0aab, 0x0aab, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0aab, 0x0acb, 0x0acb,
-  0x0acb, 0x0acb, 0x0acb, 0x0acb, 0x0aab, 0x0acb, 0x0acb, 0x0acb,
-  0x0aab, 0x0aab, 0x02ab, 0x02ab, 0x0aab, 0x02ab, 0x0a8b, 0x026b,
-  0x028b, 0x028b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x028b,
-  0x028b, 0x0a8b, 0x0a6b, 0x02ab, 0x02ab, 0x0acb, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acb, 0x0aec,
-  0x0aec, 0x0aec, 0x0acc, 0x0aec, 0x0aec, 0x0aab, 0x0acb, 0x0aab,
-  0x130c, 0x130c, 0x22eb, 0x2ac9, 0x2268, 0x1209, 0x01e9, 0x01c9,
-  0x01c9, 0x01e9, 0x01c9, 0x01c8, 0x0167, 0x1025, 0x1825, 0x1004,
-  0x1024, 0x1026, 0x1007, 0x1086, 0x1188, 0x1167, 0x1167, 0x1147,
-  0x1147, 0x1947, 0x1127, 0x1107, 0x1106, 0x1107, 0x1085, 0x1005,
-  0x1005, 0x1086, 0x10c6, 0x10c6, 0x10c6, 0x10c6, 0x10e6, 0x10e6,
-  0x1025, 0x1004, 0x1065, 0x1085, 0x10c6, 0x10c6, 0x1106, 0x1106,
-  0x1127, 0x1947, 0x1167, 0x1167, 0x1188, 0x19a8, 0x10c6, 0x1004,
-  0x1024, 0x1844, 0x1824, 0x1824, 0x1824, 0x1064, 0x01e9, 0x01c9,
-  0x01c9, 0x01e9, 0x1249, 0x22cb, 0x22eb, 0x130c, 0x0aec, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acb, 0x0aab, 0x02ab, 0x0aab, 0x0aab, 0x0aab, 0x02ab,
-  0x02ab, 0x02ab, 0x0acb, 0x0acc, 0x02ab, 0x0aab, 0x0acb, 0x0aac,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x024b, 0x024b, 0x024a, 0x0986,
-  0x0926, 0x0986, 0x1104, 0x1082, 0x1082, 0x10e4, 0x0925, 0x08e5,
-  0x10e4, 0x0209, 0x026b, 0x026b, 0x0acb, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0aab, 0x028b, 0x028b, 0x026b, 0x026b, 0x024b, 0x024b,
-  0x024b, 0x024b, 0x024b, 0x024b, 0x026b, 0x026b, 0x024b, 0x024b,
-  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x026a, 0x024b,
-  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
-  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x026b, 0x0aab,
-  0x0acb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acb, 0x0acb, 0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0aec,
-  0x1acb, 0x2aa9, 0x2a48, 0x09a7, 0x0125, 0x0126, 0x0146, 0x0125,
-  0x0104, 0x00c4, 0x00e4, 0x0104, 0x00e5, 0x1004, 0x1024, 0x1024,
-  0x1024, 0x1026, 0x1006, 0x1086, 0x1127, 0x1106, 0x10e6, 0x10e6,
-  0x10e6, 0x10e6, 0x10e6, 0x10e6, 0x10c6, 0x10c6, 0x1885, 0x1005,
-  0x1005, 0x1065, 0x10a5, 0x10a5, 0x10c5, 0x10c5, 0x10c5, 0x1085,
-  0x1024, 0x1044, 0x1065, 0x1085, 0x10a5, 0x10c5, 0x10c6, 0x10c6,
-  0x1106, 0x1106, 0x1927, 0x1947, 0x1167, 0x1147, 0x1004, 0x1003,
-  0x1003, 0x1003, 0x1004, 0x1004, 0x1004, 0x0884, 0x0165, 0x0166,
-  0x01a7, 0x01a8, 0x0187, 0x01a7, 0x11e8, 0x2aca, 0x22eb, 0x12ec,
-  0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x0aab, 0x0acc, 0x02ab,
-  0x02ab, 0x02ac, 0x0acc, 0x0aab, 0x028b, 0x028b, 0x026b, 0x024b,
-  0x026b, 0x026b, 0x0a6b, 0x0a8b, 0x02ab, 0x0aab, 0x0acc, 0x02ab,
-  0x02ab, 0x0aab, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aab, 0x026b, 0x026b, 0x028b,
-  0x026b, 0x028b, 0x026b, 0x0a09, 0x0a29, 0x026b, 0x028b, 0x024a,
-  0x024a, 0x026b, 0x026b, 0x0aab, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x024b, 0x024b, 0x024b, 0x026b, 0x026b, 0x026b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026a,
-  0x0aab, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12ca,
-  0x2a89, 0x2a89, 0x0986, 0x0166, 0x09a6, 0x11c7, 0x11c6, 0x19a5,
-  0x19e6, 0x2227, 0x2227, 0x2a47, 0x2a68, 0x2a68, 0x2a68, 0x2a68,
-  0x2a68, 0x2a48, 0x2a28, 0x2208, 0x2a28, 0x21e8, 0x21c7, 0x2167,
-  0x1926, 0x10e6, 0x10a5, 0x1085, 0x1085, 0x1085, 0x1044, 0x1004,
-  0x1004, 0x1024, 0x1044, 0x1044, 0x1064, 0x1064, 0x1065, 0x1004,
-  0x1004, 0x1024, 0x1024, 0x1044, 0x1064, 0x1085, 0x1085, 0x10c5,
-  0x10a6, 0x10c6, 0x10c6, 0x10c6, 0x1107, 0x10a5, 0x1885, 0x2105,
-  0x2146, 0x2187, 0x29c7, 0x29e7, 0x2a07, 0x2a68, 0x2a68, 0x2a68,
-  0x2a68, 0x2a88, 0x2a88, 0x2a88, 0x2248, 0x2a68, 0x3288, 0x2aca,
-  0x1b0c, 0x12ec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x028b, 0x02ab, 0x02cc, 0x02cc, 0x02ac,
-  0x028b, 0x026b, 0x028b, 0x024b, 0x022a, 0x022a, 0x020a, 0x020a,
-  0x020a, 0x022a, 0x022a, 0x022a, 0x024b, 0x026b, 0x0a6b, 0x028b,
-  0x0aab, 0x0aab, 0x0aab, 0x0acb, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0aab, 0x028b,
-  0x0a6b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b,
-  0x0aab, 0x0acb, 0x0aac, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0aab, 0x026b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b,
-  0x026a, 0x024b, 0x024b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b,
-  0x024b, 0x024b, 0x026b, 0x026b, 0x024b, 0x024b, 0x024b, 0x024b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x024b,
-  0x0aab, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x1aca,
-  0x2a89, 0x3289, 0x3288, 0x3289, 0x3289, 0x32a9, 0x2aa9, 0x2aaa,
-  0x2aca, 0x22ca, 0x22ca, 0x22cb, 0x1acb, 0x1aeb, 0x1aeb, 0x1aeb,
-  0x1aca, 0x22ca, 0x22ca, 0x22ca, 0x22ca, 0x22ca, 0x22ca, 0x2aca,
-  0x2aa9, 0x2a69, 0x2a08, 0x29c7, 0x2167, 0x2106, 0x1906, 0x18c6,
-  0x18c6, 0x1906, 0x2166, 0x2187, 0x21c7, 0x2207, 0x2208, 0x21c7,
-  0x2167, 0x2146, 0x1906, 0x18c5, 0x18a5, 0x1885, 0x1885, 0x1885,
-  0x18c5, 0x1906, 0x2166, 0x21e7, 0x2a28, 0x2a89, 0x2ac9, 0x2ac9,
-  0x2aca, 0x2aca, 0x2ac9, 0x2ac9, 0x22ca, 0x22ca, 0x22ca, 0x22ca,
-  0x22aa, 0x22a9, 0x2aa9, 0x2aa9, 0x2aa9, 0x2aa9, 0x2a89, 0x3268,
-  0x2aa9, 0x12ec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0aab, 0x02ab, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x024a, 0x020a, 0x01e9, 0x01e9, 0x01e9, 0x01e9, 0x0209,
-  0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x020a, 0x022a, 0x024b,
-  0x028b, 0x02ab, 0x0acc, 0x0acc, 0x02ab, 0x0acb, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0aac, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acb, 0x02ab, 0x0aab, 0x0a6b, 0x0a6b, 0x0a6b,
-  0x026b, 0x028b, 0x026b, 0x024b, 0x024b, 0x026b, 0x026b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x024b, 0x024b,
-  0x026b, 0x0aab, 0x02ab, 0x02ab, 0x02ab, 0x028b, 0x028b, 0x026b,
-  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x026a, 0x026b,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12cb,
-  0x1aaa, 0x1aca, 0x1acb, 0x12cb, 0x12cb, 0x12cb, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12cb, 0x1acb, 0x1aca,
-  0x22aa, 0x22aa, 0x22aa, 0x22a9, 0x2289, 0x2a89, 0x2a89, 0x2a89,
-  0x22aa, 0x1aca, 0x1aeb, 0x22ca, 0x2aca, 0x2aa9, 0x32a9, 0x32a9,
-  0x32a9, 0x2aa9, 0x2aca, 0x22ca, 0x22ca, 0x2aca, 0x2aca, 0x22ca,
-  0x22eb, 0x1aeb, 0x22ca, 0x22ca, 0x22a9, 0x2a69, 0x2249, 0x2249,
-  0x2289, 0x22aa, 0x22ca, 0x1aeb, 0x12eb, 0x12ec, 0x12ec, 0x0acc,
-  0x12cb, 0x1acb, 0x1aca, 0x1aaa, 0x22aa, 0x22aa, 0x22aa, 0x1aaa,
-  0x1acb, 0x1aeb, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12eb, 0x12eb,
-  0x12eb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aeb, 0x0aab,
-  0x026b, 0x022a, 0x0209, 0x0209, 0x020a, 0x020a, 0x020a, 0x022a,
-  0x022a, 0x022a, 0x022a, 0x022a, 0x022a, 0x020a, 0x01e9, 0x0209,
-  0x022a, 0x026b, 0x028b, 0x02ab, 0x0aab, 0x02ac, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acb, 0x0acc, 0x0acc, 0x0aac, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0aeb, 0x0aab, 0x024b, 0x024b, 0x026b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x024b, 0x026b, 0x0acb,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aeb,
-  0x0aab, 0x0aab, 0x0aab, 0x02ab, 0x02ab, 0x0aab, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12cb, 0x12cb, 0x12cb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12cb, 0x12cb, 0x12cb,
-  0x1aca, 0x12cb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12ab, 0x12ab,
-  0x12ab, 0x12ab, 0x0acc, 0x12cb, 0x1aaa, 0x1aaa, 0x1aaa, 0x12ab,
-  0x0aeb, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x12ec, 0x12ec,
-  0x0aec, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x12ec, 0x12eb, 0x12eb,
-  0x12eb, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x0aec, 0x0aec, 0x0aec,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acb, 0x0aab, 0x02ab, 0x0a6b, 0x028b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x02ab, 0x0aab, 0x0acb, 0x0aeb,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x0acb, 0x0acb, 0x02ab,
-  0x0aab, 0x02ab, 0x02ab, 0x02ab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
-  0x0acb, 0x0aac, 0x0aac, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x026b, 0x024b, 0x026b,
-  0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x02ab,
-  0x0aab, 0x0acb, 0x0acb, 0x0aeb, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb,
-  0x0aac, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acb, 0x0aab, 0x0aab, 0x0aac, 0x0acc, 0x0acc, 0x0aac,
-  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0acb, 0x0aac, 0x0acc, 0x0aec,
-  0x0aec, 0x0acc, 0x0aab, 0x0acb, 0x0aab, 0x0acb, 0x0aac, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x026b, 0x024b,
-  0x024b, 0x024b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b, 0x024b,
-  0x024b, 0x026b, 0x026b, 0x028b, 0x026b, 0x028b, 0x0aab, 0x0acb,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0aac, 0x0aac, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x0aec, 0x0aab, 0x0acb,
-  0x02ab, 0x0acc, 0x0acc, 0x0aab, 0x02ab, 0x028b, 0x028b, 0x02ab,
-  0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab, 0x0aab,
-  0x0aab, 0x0aab, 0x0aab, 0x0acc, 0x0aec, 0x0acc, 0x0aab, 0x0aab,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x02ab,
-  0x0a6b, 0x026b, 0x026a, 0x026b, 0x026b, 0x024b, 0x026a, 0x024b,
-  0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x024b, 0x026a, 0x0acb,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb,
-  0x028b, 0x028b, 0x028b, 0x028b, 0x026b, 0x0aab, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0aec, 0x0aac, 0x0aab, 0x0aab, 0x02ab, 0x02ab, 0x0acc, 0x0acc,
-  0x02ac, 0x02ab, 0x028b, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
-  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
-  0x0aab, 0x0aab, 0x0aab, 0x0a8b, 0x0a8b, 0x0aab, 0x0aab, 0x0aac,
-  0x0acc, 0x0aab, 0x0aab, 0x0aab, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0aeb, 0x0aab, 0x0aab, 0x0aab, 0x028b, 0x0a8b, 0x028b,
-  0x026b, 0x026b, 0x026b, 0x028b, 0x026b, 0x0a6b, 0x0aab, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aab, 0x026a,
-  0x026a, 0x024b, 0x024b, 0x026a, 0x026b, 0x026a, 0x026b, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0aac, 0x0acb, 0x0acb, 0x0aab, 0x02ab, 0x02ab,
-  0x028b, 0x0aab, 0x0acc, 0x0acc, 0x0aab, 0x028b, 0x0a8b, 0x0a8b,
-  0x028b, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
-  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
-  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x028b,
-  0x028b, 0x02ab, 0x0aac, 0x0acc, 0x0acc, 0x0aab, 0x0acb, 0x0aac,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acb, 0x0acb, 0x0acb, 0x0aac, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb,
-  0x0a8b, 0x028b, 0x028b, 0x028b, 0x028b, 0x0a8b, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x0acc, 0x0acb, 0x02ab,
-  0x02ab, 0x02ab, 0x028b, 0x028b, 0x0aab, 0x0aab, 0x0aab, 0x02ab,
-  0x028b, 0x0a8b, 0x0a6b, 0x0a6b, 0x028b, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
-  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
-  0x02ab, 0x02ab, 0x02ab, 0x028b, 0x02ab, 0x0aab, 0x0acc, 0x02ab,
-  0x0aab, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x02ab, 0x028c, 0x02cc, 0x02ac,
-  0x02cc, 0x02cc, 0x02ac, 0x02ac, 0x02ac, 0x02ac, 0x02ac, 0x02ac,
-  0x02ab, 0x02ab, 0x028b, 0x028b, 0x0a6b, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x028b, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab,
-  0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x02ab, 0x028b, 0x02ab, 0x028b,
-  0x0acc, 0x0acc, 0x0aab, 0x0acc, 0x0acb, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0aab, 0x0acb, 0x0acb, 0x0aab, 0x0aab, 0x0aab, 0x028b, 0x02ab,
-  0x028b, 0x028b, 0x028b, 0x02ac, 0x02ac, 0x02ac, 0x028b, 0x028b,
-  0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x0a6b,
-  0x0a8b, 0x0a8b, 0x028b, 0x02ab, 0x02ab, 0x0aab, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x030d, 0x02ab, 0x0aab, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x0acc, 0x0aec, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acb, 0x0acb, 0x0aab, 0x0aab, 0x028b, 0x026b, 0x028c,
-  0x02ac, 0x028c, 0x028b, 0x026b, 0x026b, 0x026b, 0x026b, 0x026b,
-  0x026b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b, 0x028b,
-  0x028b, 0x028b, 0x0a8b, 0x028b, 0x028b, 0x02ab, 0x0aab, 0x0acc,
-  0x0acc, 0x0acc, 0x0aab, 0x0a6b, 0x0a8b, 0x0a8b, 0x0aab, 0x02ab,
-  0x0aab, 0x0acb, 0x0aab, 0x0acb, 0x0acb, 0x0acb, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0acc,
-  0x0aec, 0x0acc, 0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0aec, 0x0acc,
-  0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x12ec, 0x1b2c, 0x130c, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0aac,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aeb, 0x0aab,
-  0x0aab, 0x02ab, 0x028b, 0x028b, 0x028b, 0x02ac, 0x02ac, 0x02ac,
-  0x028b, 0x028b, 0x028b, 0x026b, 0x026b, 0x028b, 0x028b, 0x028b,
-  0x02ab, 0x02ac, 0x02ac, 0x02ac, 0x028b, 0x028b, 0x028b, 0x0aab,
-  0x0aab, 0x0aab, 0x0acb, 0x0acb, 0x0acc, 0x0aec, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0acc, 0x0acb, 0x0acb,
-  0x0acc, 0x0acc, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12eb,
-  0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x0aec, 0x0aec, 0x0acc, 0x0acc,
-  0x0aec, 0x12ec, 0x1b2c, 0x1b2c, 0x232c, 0x1b0c, 0x0aec, 0x0aec,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0acc, 0x0aec, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aab, 0x0aab, 0x02ab, 0x028b,
-  0x028b, 0x028b, 0x026b, 0x028b, 0x026b, 0x028b, 0x028b, 0x026b,
-  0x026b, 0x02ab, 0x02ab, 0x0acb, 0x0aab, 0x0acb, 0x0aec, 0x12ec,
-  0x12ec, 0x0aec, 0x130c, 0x12ec, 0x0aec, 0x0aec, 0x0aab, 0x0acb,
-  0x0acb, 0x0acb, 0x0aeb, 0x0aac, 0x0acc, 0x0aac, 0x12ec, 0x130c,
-  0x1b2c, 0x1b2c, 0x0aec, 0x0acc, 0x0acc, 0x12cb, 0x1b2c, 0x1b6d,
-  0x1b6c, 0x1b2c, 0x1b2c, 0x1b0b, 0x1b2c, 0x1b0c, 0x1b0c, 0x1b2c,
-  0x1b2c, 0x236c, 0x234c, 0x232b, 0x1b4c, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x12ec, 0x12ec, 0x0aec, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec,
-  0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0acc, 0x130c, 0x1b4c, 0x232c,
-  0x0aec, 0x12ec, 0x1b2c, 0x232c, 0x1b4c, 0x1b2b, 0x1b0c, 0x1b0c,
-  0x130c, 0x130c, 0x1b2c, 0x1b0c, 0x1b2c, 0x1b4c, 0x1b4c, 0x232c,
-  0x234c, 0x1b2c, 0x12ec, 0x12ec, 0x12ec, 0x134c, 0x1b8d, 0x1b4c,
-  0x1b2b, 0x236d, 0x236d, 0x236d, 0x238d, 0x234c, 0x234c, 0x236d,
-  0x23ae, 0x1b0b, 0x1a69, 0x1b2c, 0x1b4c, 0x0b0b, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x130c, 0x1b2c, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0aec, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x12ec, 0x12ec, 0x130c, 0x1b2c, 0x1b2c, 0x12ec,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0aec, 0x0acc, 0x12ec, 0x1b4c, 0x234c, 0x236d, 0x1b2c,
-  0x1b4c, 0x1b8d, 0x1b6c, 0x236c, 0x1b6d, 0x234c, 0x234c, 0x234c,
-  0x232c, 0x234c, 0x232c, 0x234c, 0x234c, 0x234c, 0x1b4c, 0x1b4c,
-  0x1b4c, 0x1b4c, 0x1b6d, 0x236d, 0x236c, 0x1aca, 0x1966, 0x10a3,
-  0x1186, 0x1a28, 0x1aaa, 0x1aca, 0x1a89, 0x1b0b, 0x1b2c, 0x1aca,
-  0x1a08, 0x1105, 0x1aaa, 0x236c, 0x232c, 0x232c, 0x1b0b, 0x130c,
-  0x130c, 0x12cc, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x0b0c,
-  0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x0aec, 0x0acc, 0x0acc, 0x0aac,
-  0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x12eb, 0x234c, 0x1b2c, 0x0acc,
-  0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0aec, 0x130c, 0x12ec, 0x0acc,
-  0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb,
-  0x0acb, 0x0acb, 0x0acb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec,
-  0x12ec, 0x1b0c, 0x1b6c, 0x1bad, 0x236c, 0x232c, 0x12ec, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x1b2c, 0x1b4c, 0x234c, 0x1b8d, 0x1a08, 0x10c4,
-  0x1a08, 0x1a08, 0x1a89, 0x1aeb, 0x1aaa, 0x1b8d, 0x1b8d, 0x1b6d,
-  0x1b6c, 0x234c, 0x236c, 0x1b4c, 0x1b4c, 0x1b4c, 0x1b8d, 0x1b6d,
-  0x238d, 0x1b4c, 0x1a8a, 0x1a69, 0x1105, 0x1022, 0x0801, 0x1001,
-  0x1022, 0x1001, 0x1022, 0x1042, 0x1042, 0x1104, 0x10c4, 0x1022,
-  0x0800, 0x19e7, 0x1bad, 0x1b4c, 0x1b4c, 0x232c, 0x234c, 0x232c,
-  0x232c, 0x232c, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b2c,
-  0x1b4c, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b2c, 0x12ec,
-  0x0aec, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0aec, 0x1b4c, 0x236c, 0x1b6c,
-  0x130c, 0x0aec, 0x0acc, 0x0acc, 0x0aec, 0x1b2c, 0x1b4c, 0x130c,
-  0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acb, 0x0acc, 0x0aec, 0x0aec, 0x0aec, 0x0acc, 0x0aac, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0aec, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0aec, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x130c,
-  0x1b4c, 0x236d, 0x236d, 0x1a49, 0x19e7, 0x130c, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0acc,
-  0x12ec, 0x1b0b, 0x234c, 0x23ad, 0x1b8d, 0x1a89, 0x1042, 0x1001,
-  0x1021, 0x1001, 0x1062, 0x1082, 0x1042, 0x1a48, 0x1b0b, 0x1a89,
-  0x1b6c, 0x1b8d, 0x1b8d, 0x1b8d, 0x1b8d, 0x1b8d, 0x1acb, 0x1aeb,
-  0x1b2c, 0x1966, 0x1022, 0x1021, 0x1001, 0x1001, 0x1022, 0x1022,
-  0x1001, 0x1022, 0x1021, 0x1021, 0x1021, 0x1001, 0x1001, 0x0801,
-  0x1062, 0x1b0b, 0x1b8d, 0x236c, 0x1b2c, 0x1b4c, 0x1b2c, 0x234c,
-  0x234c, 0x1b2c, 0x234c, 0x236d, 0x236d, 0x236c, 0x236c, 0x238d,
-  0x1bad, 0x1b6c, 0x1b8d, 0x1b8d, 0x236c, 0x1b2c, 0x232c, 0x232c,
-  0x1b2c, 0x130c, 0x0b0c, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x1b4c, 0x1b2c, 0x1b6d,
-  0x1b8d, 0x1b4c, 0x1b0c, 0x132c, 0x1b2c, 0x1b4c, 0x230c, 0x236c,
-  0x1b4c, 0x130b, 0x12ec, 0x0acc, 0x0acc, 0x0acb, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x0aec,
-  0x130b, 0x130c, 0x130c, 0x130c, 0x1b0c, 0x1b0c, 0x12ec, 0x12ec,
-  0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12ec, 0x12ec, 0x0aac, 0x0acb,
-  0x0acc, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0aec, 0x0aec, 0x0aec, 0x12ec, 0x12ec, 0x12ec,
-  0x12ec, 0x12ec, 0x0acc, 0x0aec, 0x0acc, 0x0aec, 0x0aec, 0x0acc,
-  0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x1b2b, 0x234c,
-  0x23ae, 0x1a69, 0x10e4, 0x0801, 0x1a07, 0x134d, 0x0acb, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acb, 0x0acc, 0x130c,
-  0x1b4c, 0x236d, 0x236d, 0x1aa9, 0x19a6, 0x1062, 0x1022, 0x1022,
-  0x1022, 0x1042, 0x1001, 0x1001, 0x1001, 0x1001, 0x1083, 0x1062,
-  0x10e4, 0x19a6, 0x1146, 0x19e8, 0x1b0b, 0x1a07, 0x1042, 0x1083,
-  0x1063, 0x1001, 0x1001, 0x1002, 0x1042, 0x1022, 0x1022, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1022, 0x1042, 0x1042, 0x1042, 0x0801,
-  0x10c4, 0x19c7, 0x1aeb, 0x236c, 0x1b8d, 0x1b4c, 0x1b6d, 0x1b6d,
-  0x232c, 0x238d, 0x236d, 0x1aeb, 0x1b2b, 0x236d, 0x236d, 0x1aaa,
-  0x1a69, 0x1b2c, 0x1a89, 0x1aeb, 0x1b6d, 0x236d, 0x1b4c, 0x1b6c,
-  0x232c, 0x234c, 0x1b4c, 0x1b2c, 0x0aec, 0x0acb, 0x0acc, 0x0aec,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0aac, 0x1b2c, 0x23ad, 0x1a28, 0x10e4,
-  0x1acb, 0x23ad, 0x234c, 0x232b, 0x1b4c, 0x236c, 0x1b0b, 0x1a48,
-  0x236c, 0x236d, 0x1b2c, 0x1b2c, 0x1b0c, 0x130c, 0x12ec, 0x0aec,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x12ec, 0x130c, 0x1b2c, 0x1b2c,
-  0x234c, 0x130c, 0x0acb, 0x0acc, 0x1b2c, 0x1b2c, 0x12ec, 0x1b2c,
-  0x1b2c, 0x130c, 0x0b0c, 0x0acc, 0x0acb, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x130c, 0x234c, 0x1b4c, 0x130c,
-  0x0acc, 0x0aec, 0x0aeb, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acb, 0x0acc, 0x12ec, 0x130c, 0x130c, 0x130c, 0x12ec, 0x0aec,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aac, 0x0acb, 0x0acc,
-  0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acb, 0x0acb, 0x0aac, 0x0acc, 0x0aec, 0x0aec, 0x0aec,
-  0x0aec, 0x0aec, 0x0aec, 0x1b2b, 0x236c, 0x1b4c, 0x1b4c, 0x1b4c,
-  0x1b4c, 0x1b4c, 0x1b4c, 0x1b4c, 0x1b2c, 0x1b2c, 0x1b2c, 0x130c,
-  0x12ec, 0x12ec, 0x0aac, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x1b2c, 0x234c, 0x1bad,
-  0x1a8a, 0x1001, 0x0800, 0x10a3, 0x236d, 0x1b4c, 0x0aec, 0x0acc,
-  0x0aec, 0x0aec, 0x0aec, 0x0acc, 0x0aec, 0x130c, 0x1b2c, 0x234c,
-  0x236d, 0x1b4c, 0x1987, 0x1001, 0x0801, 0x1001, 0x1001, 0x1022,
-  0x1022, 0x1022, 0x1022, 0x1022, 0x1042, 0x1021, 0x1001, 0x1001,
-  0x0801, 0x0801, 0x0800, 0x1001, 0x10a3, 0x1001, 0x0801, 0x1001,
-  0x1001, 0x1022, 0x1022, 0x1042, 0x1042, 0x1022, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x0822,
-  0x10a3, 0x1063, 0x1186, 0x11c7, 0x1a89, 0x1b8d, 0x1b0b, 0x1186,
-  0x19e7, 0x1a89, 0x10c4, 0x1082, 0x10c4, 0x1925, 0x1104, 0x1002,
-  0x1001, 0x1104, 0x1042, 0x1001, 0x10e4, 0x1aca, 0x1b0b, 0x1b2b,
-  0x1b8d, 0x1b2c, 0x1b4c, 0x234c, 0x1b4c, 0x132b, 0x130c, 0x0aec,
-  0x0acc, 0x0acc, 0x0acc, 0x0aec, 0x0aec, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x12ec, 0x1b2c, 0x234c, 0x23ad, 0x11e7, 0x0800,
-  0x1042, 0x19e7, 0x236d, 0x234c, 0x1b4c, 0x234c, 0x1b8d, 0x1987,
-  0x1105, 0x1b6c, 0x23ad, 0x234c, 0x232c, 0x234c, 0x232c, 0x1b4c,
-  0x1b4c, 0x1b4c, 0x1b4c, 0x1b4c, 0x232c, 0x1b4c, 0x234c, 0x232c,
-  0x232c, 0x1b4c, 0x1b4c, 0x1b2c, 0x1b4c, 0x1b2c, 0x1b4c, 0x1b4c,
-  0x234c, 0x234c, 0x1b4c, 0x1b2c, 0x130c, 0x0aec, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x1b0c, 0x234c, 0x1aeb, 0x234c,
-  0x1b6d, 0x1b0b, 0x1b2c, 0x12ec, 0x12ec, 0x0aec, 0x0aec, 0x0aec,
-  0x130c, 0x1b2c, 0x1b2b, 0x0aec, 0x12ec, 0x1b4c, 0x232c, 0x1b4c,
-  0x1b2c, 0x1b2c, 0x1b2c, 0x132b, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b2c,
-  0x1b4c, 0x234c, 0x130c, 0x1b2b, 0x1b4c, 0x1b2c, 0x1b0c, 0x12ec,
-  0x0aec, 0x0acc, 0x0aec, 0x0aec, 0x0aec, 0x0aec, 0x0aac, 0x0aec,
-  0x12ec, 0x130c, 0x1b0c, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b4c, 0x1b4c,
-  0x1b4c, 0x1b4c, 0x1b2c, 0x1b2c, 0x234c, 0x236c, 0x1b6c, 0x236d,
-  0x236d, 0x236d, 0x236c, 0x236c, 0x234c, 0x234c, 0x1b0c, 0x12ec,
-  0x0aec, 0x12ec, 0x1b0c, 0x1b2c, 0x12ec, 0x0aec, 0x0acc, 0x0aec,
-  0x0acc, 0x0aec, 0x0acc, 0x130c, 0x1b2c, 0x1b6d, 0x1b0b, 0x19e7,
-  0x1001, 0x1001, 0x1001, 0x19a6, 0x1b8d, 0x232c, 0x1b4c, 0x1b2b,
-  0x1b2c, 0x1b2c, 0x1b2c, 0x1b2c, 0x1b4c, 0x236c, 0x236c, 0x236c,
-  0x1b2c, 0x1104, 0x0800, 0x1001, 0x1001, 0x1022, 0x1022, 0x1022,
-  0x1022, 0x1022, 0x1042, 0x1022, 0x1022, 0x1022, 0x1042, 0x1022,
-  0x1042, 0x1022, 0x1022, 0x1001, 0x1001, 0x1021, 0x1042, 0x1022,
-  0x1042, 0x1022, 0x1022, 0x1042, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1042, 0x1001, 0x1042, 0x1082, 0x1001, 0x1a08, 0x1104, 0x0801,
-  0x1042, 0x1001, 0x0800, 0x1001, 0x1001, 0x0801, 0x0801, 0x1001,
-  0x1001, 0x1001, 0x1001, 0x1001, 0x0800, 0x1062, 0x1925, 0x1105,
-  0x1b0b, 0x1b8d, 0x1b6c, 0x236c, 0x234c, 0x234c, 0x234c, 0x1b2c,
-  0x130c, 0x130c, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x12ec, 0x130c,
-  0x130c, 0x1b2c, 0x1b4c, 0x234c, 0x236d, 0x1bad, 0x1166, 0x0801,
-  0x0801, 0x0800, 0x19e7, 0x1b6d, 0x1b0b, 0x1b6c, 0x23cd, 0x1aaa,
-  0x0800, 0x10e4, 0x1a69, 0x1aeb, 0x1bad, 0x236c, 0x234c, 0x232c,
-  0x234c, 0x234c, 0x234c, 0x234c, 0x232c, 0x1b4c, 0x236c, 0x236d,
-  0x1b6c, 0x1aeb, 0x22ca, 0x234c, 0x236c, 0x1b8d, 0x236d, 0x234c,
-  0x1b2c, 0x1b4c, 0x232c, 0x234c, 0x232c, 0x1b2c, 0x1b2c, 0x130c,
-  0x12ec, 0x0aec, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc, 0x0acc,
-  0x0acc, 0x0acc, 0x0b0c, 0x130c, 0x1b4c, 0x1b8d, 0x1a28, 0x1104,
-  0x22cb, 0x23ad, 0x234d, 0x234c, 0x1b4c, 0x1b2c, 0x1b2c, 0x1b4c,
-  0x232c, 0x234c, 0x1b2c, 0x130c, 0x1b0c, 0x1b6c, 0x236c, 0x234c,
-  0x236d, 0x236c, 0x234c, 0x236c, 0x234c, 0x234c, 0x236d, 0x236d,
-  0x234c, 0x1b2b, 0x1b4c, 0x236c, 0x236d, 0x236d, 0x234c, 0x232c,
-  0x1b2c, 0x1b2c, 0x1b2c, 0x132b, 0x1b2b, 0x1b2c, 0x1b2c, 0x1b2c,
-  0x232c, 0x234c, 0x234c, 0x236d, 0x234c, 0x236d, 0x236d, 0x1b8d,
-  0x236d, 0x236d, 0x234c, 0x1145, 0x10c4, 0x1105, 0x1166, 0x1987,
-  0x19c7, 0x19e7, 0x1b0b, 0x1a69, 0x1b2c, 0x1bad, 0x1b4d, 0x1b4c,
-  0x134c, 0x132c, 0x236c, 0x234c, 0x232c, 0x1b4c, 0x1b2c, 0x1b0c,
-  0x1b2c, 0x1b2b, 0x1b2c, 0x234c, 0x1bad, 0x1acb, 0x10a4, 0x1001,
-  0x1001, 0x1042, 0x1001, 0x1966, 0x1b4c, 0x1b4c, 0x232c, 0x232c,
-  0x232c, 0x1b4c, 0x234c, 0x234c, 0x1b8d, 0x236c, 0x1b4c, 0x1aaa,
-  0x10e4, 0x0801, 0x1001, 0x1042, 0x1042, 0x1042, 0x1022, 0x1022,
-  0x1042, 0x1042, 0x1062, 0x1042, 0x1022, 0x1022, 0x1022, 0x1022,
-  0x1022, 0x1022, 0x1022, 0x1022, 0x1022, 0x1042, 0x1042, 0x1042,
-  0x1042, 0x1022, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1022, 0x1021, 0x1021, 0x1001, 0x1041, 0x1022, 0x1021,
-  0x1001, 0x1001, 0x1022, 0x1022, 0x1022, 0x1022, 0x1022, 0x1042,
-  0x1022, 0x1022, 0x1022, 0x1022, 0x1022, 0x1001, 0x1001, 0x1001,
-  0x1063, 0x1a28, 0x1b2c, 0x1b6d, 0x1b8d, 0x236c, 0x232c, 0x1b0c,
-  0x0aec, 0x0aec, 0x1b2c, 0x234c, 0x1b2c, 0x130c, 0x130c, 0x130c,
-  0x130b, 0x1b2c, 0x232c, 0x1b6d, 0x236c, 0x1a69, 0x1042, 0x1001,
-  0x1042, 0x1001, 0x1001, 0x1966, 0x1965, 0x19a7, 0x1b4c, 0x1b2c,
-  0x1063, 0x0800, 0x1021, 0x10a3, 0x1a49, 0x1b4c, 0x236c, 0x236d,
-  0x1b8d, 0x236c, 0x1b6c, 0x236c, 0x236d, 0x1b8d, 0x234c, 0x1a89,
-  0x1945, 0x1063, 0x10c4, 0x10c4, 0x1104, 0x19a7, 0x1acb, 0x238d,
-  0x236d, 0x1b4c, 0x236c, 0x1b4c, 0x1b2c, 0x232c, 0x234c, 0x1b4c,
-  0x234c, 0x1b4c, 0x1b2c, 0x1b2c, 0x1b2b, 0x130c, 0x130c, 0x130c,
-  0x130c, 0x1b2c, 0x1b2c, 0x232c, 0x1b4c, 0x236c, 0x1b4c, 0x1082,
-  0x1062, 0x1a08, 0x234c, 0x23ad, 0x236d, 0x236d, 0x236d, 0x236d,
-  0x236c, 0x1b8d, 0x236d, 0x236d, 0x23ad, 0x1b6c, 0x1aeb, 0x234c,
-  0x232b, 0x236c, 0x236d, 0x234c, 0x236c, 0x236d, 0x1b0b, 0x1b2c,
-  0x1b2c, 0x19a6, 0x10c4, 0x1104, 0x1a08, 0x1acb, 0x236c, 0x23ad,
-  0x1b8d, 0x236c, 0x1b4c, 0x232c, 0x232c, 0x232c, 0x232c, 0x232c,
-  0x236d, 0x1bad, 0x1b6d, 0x1aeb, 0x1b2c, 0x1aeb, 0x1a69, 0x1a08,
-  0x1186, 0x1925, 0x1125, 0x0862, 0x1001, 0x1001, 0x1001, 0x1001,
-  0x1001, 0x0801, 0x1083, 0x1083, 0x1966, 0x1aaa, 0x1b0b, 0x1aca,
-  0x1aaa, 0x236d, 0x236c, 0x1b8d, 0x23ad, 0x236d, 0x236d, 0x236c,
-  0x234c, 0x234c, 0x236c, 0x1b8d, 0x1aaa, 0x1063, 0x0801, 0x1001,
-  0x1022, 0x1042, 0x1001, 0x1062, 0x1aaa, 0x1b6d, 0x1b4c, 0x1b4c,
-  0x234c, 0x234c, 0x1b8d, 0x236d, 0x1b2b, 0x1125, 0x1146, 0x1105,
-  0x0800, 0x1022, 0x1042, 0x1042, 0x1062, 0x1042, 0x1062, 0x1042,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1042, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1022, 0x1022, 0x1022, 0x1042, 0x1042, 0x1042,
-  0x1062, 0x1042, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1022, 0x1042, 0x1042, 0x1022, 0x1001, 0x1002, 0x1022,
-  0x1022, 0x1022, 0x1002, 0x1022, 0x1022, 0x1022, 0x1022, 0x1022,
-  0x1022, 0x1022, 0x1022, 0x1042, 0x1042, 0x1022, 0x1002, 0x1022,
-  0x1001, 0x1001, 0x1083, 0x1145, 0x1aaa, 0x236d, 0x238d, 0x1b6d,
-  0x132c, 0x12ec, 0x1b2b, 0x1b4c, 0x12ec, 0x0acb, 0x0acb, 0x0acb,
-  0x0aec, 0x1b6d, 0x23ad, 0x1b2b, 0x1145, 0x1062, 0x1001, 0x1042,
-  0x1022, 0x1022, 0x1021, 0x1001, 0x1001, 0x0801, 0x10a4, 0x1a8a,
-  0x10c4, 0x0801, 0x1022, 0x1001, 0x1001, 0x1083, 0x1a08, 0x1b2b,
-  0x1a28, 0x1126, 0x11a6, 0x1a48, 0x1aca, 0x19e7, 0x10c4, 0x1001,
-  0x1001, 0x1001, 0x1001, 0x1001, 0x1001, 0x0801, 0x1042, 0x19a7,
-  0x1b4c, 0x1b4c, 0x1b4c, 0x23ad, 0x1b8d, 0x1b4c, 0x1b4c, 0x1b4c,
-  0x1b2c, 0x1b4c, 0x1b2c, 0x234c, 0x1b8d, 0x236c, 0x232c, 0x232b,
-  0x234c, 0x232c, 0x1b2c, 0x234c, 0x1b4c, 0x1b4c, 0x1bad, 0x1146,
-  0x0800, 0x0801, 0x1104, 0x1aeb, 0x1b0b, 0x1aca, 0x1b0b, 0x1b2c,
-  0x1b8d, 0x1acb, 0x1a28, 0x1aaa, 0x1a69, 0x1125, 0x10c4, 0x19c7,
-  0x1083, 0x19c7, 0x1a08, 0x19c7, 0x1104, 0x19c7, 0x1104, 0x1082,
-  0x10c4, 0x1082, 0x1001, 0x0801, 0x1001, 0x1042, 0x1186, 0x1a8a,
-  0x1acb, 0x1b4c, 0x236c, 0x236c, 0x236c, 0x1b4c, 0x236c, 0x23ad,
-  0x1b4c, 0x1a49, 0x1105, 0x10e4, 0x19a7, 0x1063, 0x1001, 0x1001,
-  0x1001, 0x1001, 0x1021, 0x1083, 0x1042, 0x1062, 0x1062, 0x1042,
-  0x1022, 0x1042, 0x1001, 0x1001, 0x1001, 0x1042, 0x10c4, 0x10e4,
-  0x1042, 0x1187, 0x1966, 0x1925, 0x1a8a, 0x1aaa, 0x1aca, 0x1b6c,
-  0x1b0b, 0x234c, 0x1b4c, 0x1a69, 0x1001, 0x1001, 0x1042, 0x1022,
-  0x1842, 0x1842, 0x1021, 0x1001, 0x1965, 0x1a69, 0x1b4c, 0x1b6c,
-  0x1b4c, 0x234c, 0x1a08, 0x1186, 0x1083, 0x0800, 0x1021, 0x1022,
-  0x1042, 0x1042, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1022, 0x1042, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1043, 0x1042, 0x1063, 0x1843, 0x1042, 0x1022, 0x1022, 0x1042,
-  0x1042, 0x1022, 0x1042, 0x1062, 0x1022, 0x1022, 0x1022, 0x1022,
-  0x1042, 0x1042, 0x1062, 0x1062, 0x1062, 0x1042, 0x1022, 0x1022,
-  0x1042, 0x1022, 0x1001, 0x0801, 0x1001, 0x1104, 0x1aca, 0x236c,
-  0x1b8d, 0x23ad, 0x236c, 0x1b4c, 0x1b6c, 0x132c, 0x1b2c, 0x1b6c,
-  0x236c, 0x22aa, 0x1aeb, 0x10c4, 0x0800, 0x1001, 0x1022, 0x1021,
-  0x1843, 0x1022, 0x1042, 0x1042, 0x1022, 0x1021, 0x1002, 0x1145,
-  0x1083, 0x1001, 0x1022, 0x1042, 0x1022, 0x1001, 0x1062, 0x1082,
-  0x0801, 0x1001, 0x1001, 0x1042, 0x1022, 0x0801, 0x1001, 0x1022,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1001, 0x0801,
-  0x10a3, 0x19c7, 0x1966, 0x1a48, 0x1b2c, 0x1b8d, 0x236d, 0x1b8d,
-  0x1b8d, 0x1b6d, 0x1b8d, 0x1b8d, 0x1aeb, 0x1b0b, 0x1b6d, 0x1b6d,
-  0x1b4c, 0x1b4c, 0x1b6d, 0x1b4c, 0x1b2c, 0x1b8d, 0x1b6c, 0x10c4,
-  0x1001, 0x1042, 0x0801, 0x1042, 0x1083, 0x1042, 0x1062, 0x10e4,
-  0x1145, 0x1042, 0x1001, 0x1042, 0x1001, 0x0801, 0x1001, 0x1001,
-  0x0801, 0x1001, 0x1001, 0x1001, 0x1001, 0x0801, 0x1001, 0x1001,
-  0x0801, 0x1001, 0x1042, 0x1042, 0x1022, 0x1001, 0x0801, 0x1001,
-  0x1083, 0x1966, 0x1aaa, 0x236c, 0x1b0b, 0x236d, 0x236c, 0x1a69,
-  0x10a3, 0x0801, 0x0801, 0x1042, 0x1021, 0x1001, 0x1022, 0x1022,
-  0x1042, 0x1042, 0x1063, 0x1083, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1842, 0x1062, 0x1042, 0x1042, 0x1022, 0x1001, 0x0801, 0x1001,
-  0x1001, 0x1001, 0x1001, 0x0800, 0x1001, 0x1042, 0x1062, 0x1125,
-  0x1a89, 0x1a69, 0x1987, 0x10a3, 0x0801, 0x1042, 0x1022, 0x1042,
-  0x1062, 0x1062, 0x1042, 0x1001, 0x1082, 0x10e4, 0x1aca, 0x1aca,
-  0x11c7, 0x11c8, 0x0801, 0x0801, 0x1001, 0x1062, 0x1042, 0x1022,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1842, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1843, 0x1843, 0x1022, 0x1842, 0x1862,
-  0x1062, 0x1042, 0x1082, 0x1862, 0x1042, 0x1042, 0x1042, 0x1022,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1863, 0x1022, 0x1022,
-  0x1022, 0x1022, 0x1042, 0x1042, 0x1021, 0x0800, 0x1022, 0x1104,
-  0x1125, 0x1a48, 0x1b4c, 0x236d, 0x232c, 0x236d, 0x238d, 0x238d,
-  0x19c6, 0x1042, 0x1082, 0x0801, 0x1001, 0x1022, 0x1022, 0x1021,
-  0x1864, 0x1843, 0x1022, 0x1864, 0x1042, 0x1022, 0x1042, 0x1062,
-  0x1042, 0x1021, 0x1022, 0x1022, 0x1022, 0x1042, 0x1001, 0x1001,
-  0x1021, 0x1022, 0x1022, 0x1001, 0x1001, 0x1022, 0x1042, 0x1042,
-  0x1042, 0x1022, 0x1022, 0x1022, 0x1022, 0x1022, 0x1042, 0x1042,
-  0x1001, 0x1001, 0x1001, 0x0801, 0x1082, 0x1145, 0x19e7, 0x1145,
-  0x1a28, 0x1aeb, 0x1a8a, 0x1104, 0x1125, 0x236c, 0x234c, 0x1aaa,
-  0x1b2c, 0x236d, 0x1aca, 0x1105, 0x1aaa, 0x1a49, 0x1966, 0x1021,
-  0x1001, 0x1022, 0x1042, 0x1001, 0x0801, 0x1001, 0x1001, 0x1001,
-  0x0801, 0x1001, 0x1001, 0x1001, 0x1001, 0x1042, 0x1022, 0x1002,
-  0x1042, 0x1001, 0x1001, 0x1022, 0x1042, 0x1042, 0x1022, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1842, 0x1842, 0x1042, 0x1042, 0x1022,
-  0x1001, 0x1062, 0x19e7, 0x10e4, 0x1a89, 0x1a8a, 0x10c4, 0x1001,
-  0x0801, 0x1021, 0x1042, 0x1021, 0x1001, 0x1042, 0x1042, 0x1042,
-  0x1062, 0x1042, 0x1083, 0x1083, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1842, 0x1062, 0x1042, 0x1022,
-  0x1042, 0x1042, 0x1022, 0x1042, 0x1022, 0x1001, 0x1001, 0x0800,
-  0x1104, 0x10e4, 0x1002, 0x1001, 0x1022, 0x1042, 0x1042, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1022, 0x1022, 0x1001, 0x1145, 0x19a7,
-  0x1001, 0x1022, 0x1001, 0x1041, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1863, 0x1864, 0x1042, 0x1843, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1082, 0x1062, 0x1042,
-  0x1042, 0x1022, 0x1042, 0x1022, 0x1022, 0x1022, 0x1001, 0x1001,
-  0x0801, 0x1001, 0x1083, 0x1166, 0x1105, 0x1125, 0x1aaa, 0x1966,
-  0x1001, 0x1001, 0x1001, 0x1022, 0x1022, 0x1022, 0x1021, 0x1042,
-  0x2085, 0x1843, 0x1042, 0x1885, 0x1043, 0x1042, 0x1042, 0x1022,
-  0x1843, 0x1022, 0x1042, 0x1042, 0x1022, 0x1022, 0x1022, 0x1042,
-  0x1042, 0x1042, 0x1843, 0x1042, 0x1042, 0x1042, 0x1062, 0x1062,
-  0x1042, 0x1042, 0x1062, 0x1062, 0x1062, 0x1843, 0x1042, 0x1062,
-  0x1062, 0x1042, 0x1042, 0x1021, 0x0801, 0x0801, 0x1001, 0x0801,
-  0x1001, 0x1063, 0x1001, 0x0800, 0x1104, 0x1966, 0x1083, 0x1062,
-  0x10e4, 0x1125, 0x1042, 0x1042, 0x19c7, 0x1022, 0x1001, 0x1022,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1022, 0x1042, 0x1042, 0x1022,
-  0x1022, 0x1042, 0x1022, 0x1042, 0x1022, 0x1022, 0x1022, 0x1842,
-  0x1042, 0x1022, 0x1842, 0x1062, 0x1062, 0x1042, 0x1042, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1042,
-  0x1022, 0x1063, 0x1042, 0x0800, 0x1165, 0x1063, 0x0801, 0x1001,
-  0x1042, 0x1022, 0x1042, 0x1042, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1083, 0x1063, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1062, 0x1063, 0x1063, 0x1042, 0x1001,
-  0x1022, 0x1042, 0x1001, 0x1022, 0x1042, 0x1062, 0x1062, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1062, 0x1022, 0x1001, 0x1042, 0x10a4,
-  0x1001, 0x1001, 0x1062, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1042, 0x1042, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1063, 0x1864, 0x1842, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1063, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1062,
-  0x1863, 0x1063, 0x1063, 0x1862, 0x1822, 0x1022, 0x1022, 0x1002,
-  0x1001, 0x1021, 0x1001, 0x1001, 0x1001, 0x1001, 0x1062, 0x1021,
-  0x1001, 0x1022, 0x1022, 0x1022, 0x1022, 0x1001, 0x1043, 0x1064,
-  0x18a5, 0x1884, 0x1842, 0x18a6, 0x1884, 0x1043, 0x1042, 0x1042,
-  0x1043, 0x1043, 0x1062, 0x1043, 0x1043, 0x1042, 0x1042, 0x1042,
-  0x1062, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1063, 0x1043, 0x1043, 0x1042, 0x1042, 0x1021, 0x1021,
-  0x1021, 0x1001, 0x1001, 0x1042, 0x1001, 0x0801, 0x1001, 0x1001,
-  0x1001, 0x1001, 0x1001, 0x1062, 0x1062, 0x1001, 0x1021, 0x1842,
-  0x1043, 0x1043, 0x1043, 0x1062, 0x1042, 0x1042, 0x1842, 0x1043,
-  0x1043, 0x1062, 0x1062, 0x1042, 0x1042, 0x1062, 0x1043, 0x1062,
-  0x1042, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1042,
-  0x1062, 0x1022, 0x1001, 0x1042, 0x1021, 0x1002, 0x1022, 0x1042,
-  0x1062, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043, 0x1043,
-  0x1043, 0x1043, 0x1063, 0x1083, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1042,
-  0x1002, 0x1022, 0x1042, 0x1062, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1062, 0x1062, 0x1042, 0x1022,
-  0x1062, 0x1043, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1863, 0x1063, 0x1042, 0x1042, 0x1062, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1062, 0x1062, 0x1043, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1864, 0x1863, 0x1863, 0x1863,
-  0x1063, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1063, 0x1863, 0x1863, 0x1863, 0x1883, 0x1043, 0x1042, 0x1042,
-  0x1042, 0x1022, 0x1022, 0x1022, 0x1022, 0x1021, 0x1001, 0x1022,
-  0x1022, 0x1021, 0x1001, 0x1843, 0x1843, 0x1843, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x1064, 0x18a6, 0x1885, 0x1063, 0x1042, 0x1842,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1062, 0x1042,
-  0x1022, 0x1022, 0x1022, 0x1022, 0x1022, 0x1022, 0x1022, 0x1022,
-  0x1022, 0x1022, 0x1022, 0x1001, 0x1001, 0x1042, 0x1062, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1062, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1022, 0x1842, 0x1063, 0x1062, 0x1062, 0x1042, 0x1043,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1022, 0x1842, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1062, 0x1062,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1063, 0x1862, 0x1042,
-  0x1042, 0x1062, 0x1863, 0x1863, 0x1062, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1062, 0x1041, 0x1042, 0x1042, 0x1842,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1042, 0x1042, 0x1041, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1063, 0x1863, 0x1863, 0x1863, 0x1883, 0x2084, 0x1883, 0x1883,
-  0x1863, 0x1042, 0x1021, 0x1022, 0x1022, 0x1022, 0x1022, 0x1021,
-  0x1022, 0x1021, 0x1843, 0x2085, 0x1864, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x1885, 0x1886, 0x1085, 0x1063, 0x1042, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1062, 0x1042, 0x1042, 0x1042, 0x1863, 0x1062, 0x1022, 0x1042,
-  0x1062, 0x1001, 0x1022, 0x1042, 0x1062, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1842, 0x1042, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1063, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1042, 0x1062, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1042, 0x1041,
-  0x1042, 0x1062, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1042, 0x1042, 0x1042, 0x1042, 0x1062,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1082,
-  0x1042, 0x1042, 0x1042, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1063, 0x1863, 0x1863, 0x1863, 0x1883, 0x1883, 0x1883, 0x1864,
-  0x2064, 0x1843, 0x1021, 0x1042, 0x1864, 0x1842, 0x1021, 0x1843,
-  0x1863, 0x2084, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x1886,
-  0x1885, 0x1885, 0x1885, 0x1886, 0x1085, 0x1862, 0x1042, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1063, 0x1863, 0x1863, 0x1842, 0x1863,
-  0x1042, 0x1022, 0x1062, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1843, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1043, 0x1062, 0x1041, 0x1042, 0x1042, 0x1062,
-  0x1043, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1062, 0x1042, 0x1042, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1063, 0x1863, 0x1863, 0x1863, 0x1864, 0x1883, 0x1864, 0x1864,
-  0x2064, 0x2064, 0x1022, 0x1863, 0x2085, 0x1843, 0x1021, 0x2064,
-  0x2065, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x1885, 0x1886, 0x1884, 0x1062, 0x1843, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1863,
-  0x1062, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1863,
-  0x1062, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1863, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1062, 0x1863, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1042,
-  0x1042, 0x1062, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1043, 0x1042, 0x1042, 0x1843, 0x1863,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1843, 0x1863, 0x1863, 0x1863,
-  0x1063, 0x1062, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1063, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1864,
-  0x1864, 0x1864, 0x1843, 0x2064, 0x2084, 0x1843, 0x1843, 0x2084,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x1884, 0x1062, 0x1062,
-  0x1884, 0x1886, 0x1885, 0x1886, 0x1864, 0x1062, 0x1843, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1062, 0x1062, 0x1063, 0x1063, 0x1063,
-  0x1863, 0x1063, 0x1063, 0x1043, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1062,
-  0x1041, 0x1042, 0x1863, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1062, 0x1062,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1863, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1863, 0x1062, 0x1042, 0x1042, 0x1042, 0x1863, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1863, 0x1062, 0x1062, 0x1863, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1063, 0x1063, 0x1843, 0x1863, 0x1843,
-  0x1863, 0x1063, 0x1063, 0x1063, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1063,
-  0x1063, 0x1062, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1863,
-  0x1864, 0x1864, 0x1864, 0x2084, 0x2084, 0x1843, 0x1864, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x1864, 0x1042, 0x1041, 0x1041,
-  0x1863, 0x18a6, 0x1885, 0x18a6, 0x1064, 0x1842, 0x1863, 0x1063,
-  0x1063, 0x1063, 0x1042, 0x1042, 0x1042, 0x1062, 0x1063, 0x1863,
-  0x1863, 0x1062, 0x1062, 0x1043, 0x1863, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1042,
-  0x1041, 0x1041, 0x1062, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1863, 0x1843, 0x1863, 0x1063, 0x1842, 0x1042, 0x1041,
-  0x1042, 0x1863, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063, 0x1063,
-  0x1063, 0x1063, 0x1063, 0x1063, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1842, 0x1042, 0x1042, 0x1042, 0x1042, 0x1062, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1062, 0x1041, 0x1042, 0x1862, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1863, 0x1843, 0x1843, 0x1843, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1843, 0x1043, 0x1062, 0x1062,
-  0x1863, 0x1863, 0x1843, 0x1843, 0x1843, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1063,
-  0x1062, 0x1041, 0x1042, 0x1042, 0x1042, 0x1042, 0x1041, 0x1062,
-  0x1864, 0x2064, 0x1864, 0x2084, 0x2084, 0x2064, 0x2084, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x1864, 0x1062, 0x0841, 0x0841,
-  0x1063, 0x1886, 0x1886, 0x1886, 0x1064, 0x1863, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1042, 0x1042, 0x1042, 0x1042, 0x1863, 0x1843,
-  0x1042, 0x1041, 0x1041, 0x1042, 0x1062, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1041, 0x1042, 0x1863, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1842, 0x1863, 0x1843, 0x1842, 0x1042, 0x1042,
-  0x1042, 0x1863, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1863, 0x1863, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1043, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1062, 0x1041, 0x1042, 0x1063, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1062, 0x1062, 0x1843, 0x1843, 0x1843, 0x1062, 0x1042,
-  0x1042, 0x1042, 0x1062, 0x1843, 0x1043, 0x1042, 0x1041, 0x1042,
-  0x1863, 0x1843, 0x1843, 0x1843, 0x1843, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1041,
-  0x1863, 0x2084, 0x1864, 0x2084, 0x2084, 0x2084, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x1884, 0x1063, 0x1863,
-  0x1885, 0x1885, 0x1886, 0x1885, 0x1843, 0x1863, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1863, 0x1062, 0x1062, 0x1043, 0x1843, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1062, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1063, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1062, 0x1061, 0x1062, 0x1843, 0x1063, 0x1062, 0x1062,
-  0x1043, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1063, 0x1063, 0x1843, 0x1843, 0x1843, 0x1843,
-  0x1843, 0x1843, 0x1863, 0x1883, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1062, 0x1042, 0x1041, 0x1042, 0x1062, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1862, 0x1862, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1042, 0x1041, 0x1041, 0x1043, 0x1863, 0x1062, 0x1042, 0x1042,
-  0x1042, 0x1041, 0x1042, 0x1863, 0x1062, 0x1041, 0x1042, 0x1041,
-  0x1062, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1041,
-  0x1062, 0x1864, 0x2064, 0x2084, 0x2084, 0x2084, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x1886,
-  0x2085, 0x1885, 0x1886, 0x1885, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1062, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1062, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1062, 0x1042, 0x1042, 0x1042, 0x1062, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1883, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1062, 0x1062, 0x1843, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1062,
-  0x1042, 0x1042, 0x1041, 0x1062, 0x1863, 0x1042, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1863, 0x1863, 0x1042, 0x1041, 0x1041,
-  0x1842, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042,
-  0x1041, 0x1862, 0x2084, 0x2084, 0x2084, 0x2084, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x18a6, 0x1884, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1862, 0x1863, 0x1843,
-  0x1042, 0x1041, 0x1041, 0x1041, 0x1063, 0x1864, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1864,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1864, 0x1883, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1864, 0x1864, 0x1864, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1843,
-  0x1042, 0x1041, 0x1041, 0x1863, 0x1843, 0x1041, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1041, 0x1062, 0x1883, 0x1863, 0x1062, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1864, 0x2084, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x1886, 0x1884, 0x1843, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1864, 0x1843, 0x1061, 0x1041, 0x1863, 0x1863,
-  0x1863, 0x1842, 0x1863, 0x1863, 0x1843, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1062, 0x1042, 0x1862, 0x1863,
-  0x1863, 0x1863, 0x1864, 0x1863, 0x1062, 0x1042, 0x1062, 0x1862,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1864, 0x1864, 0x1864, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1864, 0x1864, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1864, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1862, 0x1863, 0x1863, 0x1863, 0x1041, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1041, 0x1061, 0x1863, 0x2064, 0x1863, 0x2063,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042,
-  0x1041, 0x1062, 0x1864, 0x2084, 0x1863, 0x1863, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1886, 0x1886, 0x2063, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1842, 0x1042, 0x1062, 0x1863, 0x1863,
-  0x1863, 0x1864, 0x2064, 0x2064, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x2064, 0x1862, 0x1041, 0x1041, 0x1041, 0x1843,
-  0x2064, 0x1863, 0x1864, 0x1842, 0x1041, 0x1042, 0x1041, 0x1041,
-  0x1863, 0x2064, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863, 0x1863,
-  0x1042, 0x1041, 0x1042, 0x1042, 0x1042, 0x1042, 0x1843, 0x1863,
-  0x1863, 0x1863, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1843, 0x1042, 0x1041, 0x1062, 0x2064, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x2064, 0x1864, 0x1864, 0x1864, 0x1864, 0x1063, 0x1041, 0x1042,
-  0x1042, 0x1042, 0x1041, 0x1862, 0x2063, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1061, 0x1042, 0x1042, 0x1062, 0x1062, 0x1063, 0x1082, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1041,
-  0x1062, 0x1883, 0x2064, 0x1864, 0x0861, 0x1041, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x18a6, 0x1885, 0x1863, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1863, 0x1863, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1862, 0x1041, 0x1041, 0x1041, 0x1843,
-  0x2064, 0x1864, 0x1863, 0x1042, 0x1041, 0x1042, 0x1042, 0x1042,
-  0x1863, 0x2064, 0x1864, 0x1843, 0x1041, 0x1041, 0x1041, 0x1863,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1063, 0x1041, 0x1042, 0x1042, 0x1042, 0x1042, 0x1863, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1884, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1063, 0x1061, 0x0861, 0x1062, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1063, 0x1041,
-  0x1041, 0x1062, 0x1863, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1863, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1062, 0x1062, 0x1063, 0x1082, 0x1063,
-  0x1062, 0x1042, 0x1042, 0x1042, 0x1042, 0x1042, 0x1041, 0x1042,
-  0x1863, 0x2064, 0x1864, 0x1864, 0x1061, 0x1042, 0x1864, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1886, 0x1884, 0x1883, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1883, 0x1863, 0x1063, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1862, 0x1062, 0x1063, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1862, 0x1041, 0x1041, 0x1041, 0x1041,
-  0x1863, 0x1884, 0x1864, 0x1062, 0x1041, 0x1042, 0x1041, 0x1062,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1042, 0x1041, 0x1041, 0x1062, 0x1063, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1884, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1082, 0x1062, 0x1863, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1863,
-  0x1863, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1883, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1061, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1063, 0x1863, 0x1062, 0x1042, 0x1041, 0x1042, 0x1062, 0x1864,
-  0x1884, 0x2064, 0x1864, 0x2084, 0x1864, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x1884, 0x1883, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1883, 0x1063, 0x1062, 0x1041, 0x1041, 0x1062, 0x1883,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1884, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1062, 0x1041, 0x1042, 0x1062,
-  0x1864, 0x1864, 0x1864, 0x1862, 0x1041, 0x1041, 0x1041, 0x1062,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x2064, 0x1864, 0x1063, 0x1862, 0x1863, 0x1864, 0x1864,
-  0x1864, 0x1863, 0x1863, 0x1863, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1884, 0x2064, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x2064, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1863,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1063, 0x1863, 0x1863, 0x1863, 0x1062, 0x1842, 0x2064, 0x1864,
-  0x1863, 0x1062, 0x1062, 0x1062, 0x1863, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x2063, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x2064, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x2064, 0x1843, 0x1041, 0x1042, 0x1042, 0x1042, 0x1041, 0x1062,
-  0x1864, 0x1864, 0x2064, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1863, 0x1863, 0x1863,
-  0x1862, 0x1863, 0x1864, 0x2064, 0x1864, 0x1863, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1842, 0x1061, 0x1062, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x2064, 0x2064, 0x1062, 0x1061, 0x1041, 0x1042, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x2064, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1884, 0x2064, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1863, 0x1061, 0x1863, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1863,
-  0x1063, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1082,
-  0x1062, 0x1862, 0x1863, 0x1863, 0x1884, 0x1864, 0x2064, 0x1863,
-  0x1041, 0x1041, 0x1041, 0x1041, 0x1061, 0x2064, 0x2084, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x2064, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1863, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x2064, 0x1062, 0x1042, 0x1042, 0x1042, 0x1042, 0x1041, 0x1041,
-  0x1863, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1063, 0x1042, 0x1041, 0x1041,
-  0x1061, 0x1042, 0x1883, 0x1864, 0x1864, 0x2064, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1864, 0x2064, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x2064, 0x1864, 0x1864, 0x2064, 0x1864, 0x1864,
-  0x1864, 0x1843, 0x1041, 0x1042, 0x1042, 0x1042, 0x1863, 0x2064,
-  0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864, 0x1864,
-  0x1864, 0x1864, 0x1884, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x1864,
-  0x1863, 0x1864, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x1061, 0x0861, 0x1843, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x1864,
-  0x1063, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1063, 0x1082, 0x1042,
-  0x1041, 0x1042, 0x1042, 0x1062, 0x1863, 0x1884, 0x1863, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1041, 0x1863, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1885, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x1864, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x1864, 0x1842, 0x0861, 0x1062, 0x1864, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x1063, 0x1041, 0x1042, 0x1042, 0x1042, 0x1041, 0x1062,
-  0x1864, 0x1863, 0x1041, 0x1842, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x1042, 0x1041, 0x1042, 0x1042,
-  0x1042, 0x1061, 0x1062, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x1843, 0x1863, 0x1863, 0x1062, 0x1863, 0x2064, 0x2064,
-  0x2064, 0x1864, 0x1042, 0x1041, 0x1041, 0x1061, 0x1843, 0x2065,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x1864, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x1863, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x1863, 0x1863, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x1864,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1863, 0x1062, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1063, 0x1864, 0x1062, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1041, 0x1062, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x1864, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x1863,
-  0x1042, 0x1062, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x1863, 0x0841, 0x1041, 0x1041, 0x1863, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x1843, 0x1061, 0x1041, 0x1042, 0x1042, 0x1041, 0x1863,
-  0x2064, 0x1062, 0x0841, 0x1042, 0x1864, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x1863, 0x1041, 0x1042, 0x1042, 0x1042,
-  0x1042, 0x1041, 0x1041, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x1863, 0x1863, 0x1864, 0x2084, 0x2064, 0x2064, 0x2064, 0x1864,
-  0x1062, 0x1041, 0x1041, 0x1041, 0x1041, 0x1061, 0x1863, 0x2064,
-  0x2064, 0x2064, 0x1864, 0x1061, 0x1062, 0x1863, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x1864, 0x1884, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2064, 0x2064, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2064, 0x2084, 0x2084, 0x2064, 0x1864, 0x1042, 0x1041,
-  0x1042, 0x1042, 0x1061, 0x1862, 0x2064, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2064, 0x2064, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x1863, 0x1063, 0x1082, 0x1063, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1863, 0x1884, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1042, 0x1042, 0x1041, 0x1061, 0x2064, 0x2064,
-  0x2064, 0x2064, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085, 0x2085,
-  0x1885, 0x2084, 0x2084, 0x2084, 0x2084, 0x2064, 0x1864, 0x1042,
-  0x1041, 0x1041, 0x1862, 0x2064, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x1864,
-  0x1864, 0x1061, 0x1041, 0x1041, 0x1883, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x1864, 0x1062, 0x1041, 0x1041, 0x1041, 0x1041, 0x1883,
-  0x2084, 0x1864, 0x1063, 0x1863, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x1862, 0x1041, 0x1042, 0x1042, 0x1042,
-  0x1042, 0x1042, 0x1041, 0x1062, 0x2084, 0x2084, 0x2064, 0x1864,
-  0x1061, 0x1041, 0x1061, 0x1062, 0x1863, 0x2064, 0x2064, 0x1842,
-  0x1041, 0x1042, 0x1042, 0x1042, 0x1042, 0x1041, 0x1062, 0x2064,
-  0x2064, 0x2084, 0x2084, 0x2064, 0x2064, 0x2064, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084, 0x2084,
-  0x2084, 0x2084, 0x1884,
-};
-
-#ifdef __cplusplus
-}
-#endif  /* __cplusplus */
-
-#endif  /* __IMAGE_background_H__ */
@@ -1,80 +0,0 @@
-// SKIP: 100
-#ifndef __IMAGE_pixie_H__
-#define __IMAGE_pixie_H__
-
-#ifdef __cplusplus
-extern "C" {
-#endif  /* __cplusplus */
-#include <stdint.h>
-
-const uint16_t image_pixie[] = {
-  0x0105, 0x0014, 0x0014, 0x0064, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0111, 0x0000, 0x0000, 0x0000, 0x0011, 0x1111, 0x1110, 0x0000,
-  0x0000, 0x0111, 0x1121, 0x1111, 0x0000, 0x0000, 0x1112, 0x2333,
-  0x2211, 0x1000, 0x0001, 0x1123, 0x3444, 0x3321, 0x1100, 0x0001,
-  0x1234, 0x5565, 0x5432, 0x1100, 0x0001, 0x1235, 0x6777, 0x6532,
-  0x1100, 0x0011, 0x1345, 0x79b9, 0x7543, 0x1110, 0x0011, 0x2346,
-  0x7bdb, 0x7643, 0x2110, 0x0011, 0x1345, 0x79b9, 0x7543, 0x1100,
-  0x0001, 0x1235, 0x6777, 0x6532, 0x1100, 0x0001, 0x1234, 0x5565,
-  0x5432, 0x1100, 0x0001, 0x1123, 0x3444, 0x3321, 0x1000, 0x0000,
-  0x1112, 0x2333, 0x2211, 0x1000, 0x0000, 0x0111, 0x1121, 0x1111,
-  0x0000, 0x0000, 0x0011, 0x1111, 0x1100, 0x0000, 0x0000, 0x0000,
-  0x0110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xffff, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xffff, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xffff, 0xffff, 0xffff, 0xffff, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed, 0xceed,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-};
-
-#ifdef __cplusplus
-}
-#endif  /* __cplusplus */
-
-#endif  /* __IMAGE_pixie_H__ */
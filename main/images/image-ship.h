@@ -1,232 +0,0 @@
-// SKIP: 342
-#ifndef __IMAGE_ship_H__
-#define __IMAGE_ship_H__
-
-#ifdef __cplusplus
-extern "C" {
-#endif  /* __cplusplus */
-#include <stdint.h>
-
-const uint16_t image_ship[] = {
-  0x0105, 0x0024, 0x0026, 0x0156, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0373, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0004, 0xdfff, 0x9000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x007f, 0xffff, 0xf300, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3cff, 0xffff, 0xf700, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0005, 0xffff, 0xffff, 0xf300, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x009f, 0xffff, 0xffff, 0xe000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cff, 0xffff, 0xffff,
-  0x5000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0005, 0xffff, 0xffff,
-  0xffff, 0xc33c, 0xfc30, 0x0000, 0x0000, 0x0000, 0x008f, 0xffff,
-  0xffff, 0xffff, 0xfcff, 0xffc0, 0x0000, 0x0000, 0x0000, 0x3cff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xfff1, 0x0000, 0x0000, 0x0004,
-  0xefff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfff0, 0x0000, 0x0000,
-  0x005f, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffc0, 0x0000,
-  0x0000, 0x07ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfd30,
-  0x0000, 0x0000, 0x8fff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xfc30, 0x0000, 0x0009, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffc0, 0x0000, 0x00af, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xfff3, 0x0000, 0x04ff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xf600, 0x0bff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xff00, 0x0eff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xff30, 0x0eff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xff00,
-  0x0bff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xf600, 0x04ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xfffd, 0x4000, 0x00af, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xfff0, 0x0000, 0x0009, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffc0, 0x0000, 0x0000, 0x8fff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xfc30, 0x0000, 0x0000, 0x07ff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xff30, 0x0000, 0x0000, 0x005f,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffc0, 0x0000, 0x0000,
-  0x0004, 0xefff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfff1, 0x0000,
-  0x0000, 0x0000, 0x3cff, 0xffff, 0xffff, 0xffff, 0xefff, 0xffc0,
-  0x0000, 0x0000, 0x0000, 0x008f, 0xffff, 0xffff, 0xfffe, 0x66ff,
-  0xfc30, 0x0000, 0x0000, 0x0000, 0x0005, 0xffff, 0xffff, 0xfffd,
-  0x0004, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3cff, 0xffff,
-  0xffff, 0x5000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x009f,
-  0xffff, 0xffff, 0xe000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0005, 0xffff, 0xffff, 0xf300, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3cff, 0xffff, 0xf700, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x008f, 0xffff, 0xf300, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0xdfff, 0x9000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0373, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0x738e, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0xe75c,
-  0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x94d2, 0xffff, 0x94d2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2965, 0xd69a, 0xffff, 0xf79e, 0x18c3,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632c, 0xf7be,
-  0xffff, 0xffff, 0x7bef, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa534, 0xffff, 0xffff, 0xffff, 0xe73c, 0x0841, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2965, 0xd6ba, 0xffff, 0xffff, 0xffff,
-  0xffff, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5aab, 0xf7be,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xce99, 0x0020, 0x0000, 0x0000,
-  0x3186, 0x18a3, 0x0000, 0x0000, 0x1062, 0x6b6d, 0x0821, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x8c71, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0x4228, 0x9cd3, 0x0020, 0x0020, 0x9cd3, 0x0000, 0x0000, 0x2965,
-  0xc618, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a2, 0xbdf7, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xb5b6, 0x4228, 0xffff, 0x528a, 0x738e,
-  0x8430, 0x0000, 0x6b2d, 0xf7be, 0x4a29, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xdedb,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x3166,
-  0xce79, 0xffff, 0xce59, 0xf7be, 0x73ae, 0xbe17, 0xffff, 0x8c71,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4a29, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x9cd3, 0x5aeb, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xdefb, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x62ec, 0xffdf, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf79e, 0x18c3, 0x3166,
-  0x630c, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0x5acb, 0x0861,
-  0x4228, 0x52aa, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-  0xf79e, 0xc638, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0x7bef, 0x1082, 0x0000, 0x0000, 0x18a3, 0xb5b6, 0xffff,
-  0xffff, 0xffff, 0xdedb, 0xe73c, 0x62ec, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7bcf, 0xffff, 0x9492, 0x0020, 0xdefb, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xe73c, 0x2104, 0xef7d, 0x9cd3,
-  0x2945, 0x0000, 0x4a69, 0xdefb, 0xffff, 0xffff, 0xf7be, 0x5aeb,
-  0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xffff,
-  0xffff, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0x630c, 0x94b2, 0xffff, 0xe75c, 0x52aa, 0x0020, 0x0000, 0x0020,
-  0x4208, 0xb5b6, 0xffff, 0xffff, 0xffff, 0xd6ba, 0xad75, 0x8c71,
-  0x6b4d, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xef7d, 0xffff, 0xffff, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x630c, 0x94d2, 0xffff, 0xffff,
-  0xffff, 0xad75, 0x0020, 0x0000, 0x4a29, 0xf7be, 0xffff, 0xef9d,
-  0xb5b6, 0x8410, 0x5acb, 0x31a6, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7bcf, 0xffff,
-  0x9492, 0x0020, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xe73c, 0x2104, 0xe73c, 0xb5b6, 0x528a, 0x0000, 0x2965, 0xa554,
-  0xffff, 0xffff, 0xd69a, 0x18a3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x73ae, 0xf79e, 0xc638, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x7bef, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0xb596, 0xffff, 0xffff, 0xd6ba, 0xdedb,
-  0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x630c, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xf79e, 0x18c3, 0x4208, 0x4208, 0x738e, 0xdefb, 0xffff,
-  0xffff, 0xffff, 0x8430, 0x0861, 0x528a, 0x4a49, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0xef9d, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9cd3, 0x5acb,
-  0xffff, 0xffff, 0xffff, 0xf7be, 0xd6ba, 0xffff, 0xf7be, 0x2945,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2945, 0xdefb, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffdf, 0x2965, 0xce59, 0xffff, 0xb5b6, 0xffdf,
-  0x10a2, 0x632c, 0xef9d, 0xc638, 0x0821, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2,
-  0xbdf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb5b6,
-  0x39e7, 0xffdf, 0x2104, 0x94b2, 0x4228, 0x0000, 0x18e3, 0xc618,
-  0x8c71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8c71, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x4228, 0x5aeb, 0x0000, 0x10a2,
-  0x738e, 0x0000, 0x0000, 0x0020, 0x8430, 0x4a69, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x5acb, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xce99, 0x0000, 0x0000, 0x0000, 0x3186, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4208, 0x1062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965,
-  0xd6ba, 0xffff, 0xffff, 0xffff, 0xffff, 0x630c, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xa554, 0xffff, 0xffff,
-  0xffff, 0xe73c, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x6b2d, 0xf7be, 0xffff, 0xffff, 0x7bef, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965,
-  0xd69a, 0xffff, 0xf79e, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x9cd3, 0xffff, 0x94d2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x52aa, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3,
-  0x738e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000,
-};
-
-#ifdef __cplusplus
-}
-#endif  /* __cplusplus */
-
-#endif  /* __IMAGE_ship_H__ */
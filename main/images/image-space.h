@@ -1,7217 +0,0 @@
-#ifndef __IMAGE_space_H__
-#define __IMAGE_space_H__
-
-#ifdef __cplusplus
-extern "C" {
-#endif  /* __cplusplus */
-#include <stdint.h>
-
-const uint16_t image_space[] = {
-  0x0104, 0x00f0, 0x00f0, 0x28a3, 0x28e4, 0x28c4, 0x30c4, 0x28c4,
-  0x30e5, 0x30e4, 0x28c4, 0x30e4, 0x30c4, 0x30e4, 0x3105, 0x3105,
-  0x3125, 0x3105, 0x30e4, 0x28e4, 0x28e4, 0x3105, 0x3105, 0x28e4,
-  0x30e5, 0x3105, 0x3105, 0x30e5, 0x30e5, 0x3105, 0x30e5, 0x3105,
-  0x3105, 0x3105, 0x30e5, 0x3105, 0x3125, 0x3105, 0x28e4, 0x28e4,
-  0x3105, 0x3105, 0x3125, 0x3105, 0x3104, 0x3104, 0x3104, 0x3105,
-  0x3105, 0x3125, 0x3125, 0x3145, 0x3125, 0x3145, 0x3125, 0x3125,
-  0x3146, 0x2925, 0x3146, 0x3146, 0x3145, 0x3146, 0x3145, 0x3146,
-  0x3145, 0x3986, 0x3166, 0x3986, 0x41e8, 0x41e8, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3145, 0x3166, 0x3166,
-  0x3986, 0x3986, 0x3986, 0x3166, 0x3966, 0x3166, 0x3166, 0x3986,
-  0x3146, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x3186, 0x41e8,
-  0x41e8, 0x39a7, 0x39a7, 0x39a7, 0x39c8, 0x39e8, 0x39a7, 0x39a7,
-  0x39a7, 0x39c7, 0x39c7, 0x39c8, 0x39c8, 0x39c8, 0x39c7, 0x4229,
-  0x4229, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a29,
-  0x3a08, 0x3a08, 0x426a, 0x4a6a, 0x3a08, 0x4249, 0x52ec, 0x4229,
-  0x3a09, 0x3a08, 0x3a09, 0x3a09, 0x3a29, 0x3a09, 0x3a09, 0x4229,
-  0x4249, 0x3a09, 0x4229, 0x3a29, 0x426a, 0x4249, 0x4249, 0x4229,
-  0x3a29, 0x3a29, 0x3a29, 0x426a, 0x424a, 0x3a49, 0x3a29, 0x4249,
-  0x3a29, 0x3a49, 0x3a49, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a8a,
-  0x428a, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cc,
-  0x42cc, 0x42ec, 0x4b0d, 0x4b0d, 0x4b2d, 0x4b2d, 0x4b4d, 0x536e,
-  0x53af, 0x53af, 0x5bcf, 0x5bf0, 0x5c10, 0x6431, 0x6451, 0x6472,
-  0x6cb2, 0x74f3, 0x7514, 0x7d75, 0x8dd6, 0x9617, 0x9e58, 0xa6b9,
-  0xb71a, 0xc75b, 0xcf9c, 0xdfdc, 0xf7fe, 0xf7fe, 0xdfdc, 0xcf9b,
-  0xbf3b, 0xc73b, 0xd75b, 0xb6fa, 0xae99, 0xdf9c, 0x95d6, 0xb678,
-  0xe73a, 0xffdc, 0xef5a, 0xdef8, 0xe759, 0xef5a, 0xf79b, 0xef5a,
-  0xe719, 0xe719, 0xd697, 0xa553, 0x9d54, 0xa554, 0xce77, 0xbe16,
-  0x8cf2, 0x7c51, 0x9d13, 0xadb5, 0xc657, 0x8cd2, 0x6bef, 0x5b8e,
-  0x4b4d, 0x4b2d, 0x6bcf, 0x8471, 0x7c50, 0x7c50, 0x7c50, 0x7c50,
-  0x7c50, 0x7c30, 0x7c30, 0x28c4, 0x28c4, 0x28c4, 0x30e5, 0x30e4,
-  0x28c4, 0x28c4, 0x30e4, 0x30e4, 0x30e4, 0x30e4, 0x28e4, 0x30e4,
-  0x3105, 0x3125, 0x3125, 0x3126, 0x28e4, 0x3105, 0x3105, 0x3125,
-  0x28e4, 0x28e4, 0x28e4, 0x30e4, 0x3105, 0x3105, 0x3105, 0x30e5,
-  0x3105, 0x3105, 0x3105, 0x3946, 0x3105, 0x3125, 0x3105, 0x3105,
-  0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x3125, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3105, 0x3125, 0x3105, 0x3125, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3146, 0x3146, 0x3146, 0x3146, 0x3145,
-  0x3145, 0x3146, 0x3145, 0x3166, 0x39c7, 0x41c7, 0x3146, 0x3146,
-  0x3166, 0x39a7, 0x3986, 0x3146, 0x3146, 0x3146, 0x3966, 0x3166,
-  0x3986, 0x3986, 0x3986, 0x3166, 0x3987, 0x3166, 0x3966, 0x3986,
-  0x3166, 0x3146, 0x3166, 0x3166, 0x3166, 0x3186, 0x31a7, 0x39c7,
-  0x39c7, 0x39a7, 0x39c7, 0x39e8, 0x39e8, 0x39c7, 0x39c7, 0x39c8,
-  0x39c7, 0x39c7, 0x41e8, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x4229,
-  0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x3a29,
-  0x3a29, 0x3a09, 0x3a29, 0x426a, 0x3a29, 0x4249, 0x4a8a, 0x3a09,
-  0x3a29, 0x39e8, 0x3a09, 0x4229, 0x4229, 0x3a29, 0x3a29, 0x4229,
-  0x4229, 0x4229, 0x3a29, 0x3a29, 0x4249, 0x426a, 0x4249, 0x4249,
-  0x3a49, 0x3a29, 0x3a49, 0x4249, 0x424a, 0x424a, 0x3a4a, 0x3a49,
-  0x424a, 0x3a4a, 0x3a4a, 0x3a6a, 0x4aec, 0x42ab, 0x3a6a, 0x428b,
-  0x42ab, 0x42ab, 0x42ab, 0x42cc, 0x42ab, 0x42ab, 0x42cb, 0x42cc,
-  0x42cc, 0x4aec, 0x4b0c, 0x4b2d, 0x4b2d, 0x4b4e, 0x536e, 0x538e,
-  0x538e, 0x53af, 0x5bcf, 0x5c10, 0x5c31, 0x6451, 0x6472, 0x6c92,
-  0x74d3, 0x74f3, 0x7d34, 0x8575, 0x8dd6, 0x9637, 0xa678, 0xaeb9,
-  0xb71a, 0xc77b, 0xd7bc, 0xdfdc, 0xf7fe, 0xf7fd, 0xdfdc, 0xcf7c,
-  0xc75b, 0xbf1a, 0xd75b, 0xb6da, 0xb6b9, 0xdf5c, 0x9df6, 0xced9,
-  0xef9b, 0xf7bb, 0xef5a, 0xdef8, 0xe739, 0xef59, 0xf79b, 0xef5a,
-  0xe719, 0xe719, 0xd697, 0x94d2, 0xa575, 0xadb5, 0xc616, 0xc616,
-  0x8492, 0x8cd2, 0x9d33, 0xbdf6, 0xb5d5, 0x8491, 0x6c10, 0x536d,
-  0x536d, 0x4b2d, 0x6bef, 0x8471, 0x7c50, 0x7c50, 0x7c50, 0x7c50,
-  0x7c50, 0x7c50, 0x7c30, 0x28c4, 0x28c4, 0x28e4, 0x28c4, 0x28e4,
-  0x28c4, 0x30c4, 0x28c4, 0x28c4, 0x28e4, 0x28e4, 0x3125, 0x3105,
-  0x28e4, 0x3925, 0x3125, 0x3105, 0x28e4, 0x28e4, 0x28e4, 0x3946,
-  0x3105, 0x3125, 0x3125, 0x3105, 0x28e4, 0x3104, 0x2904, 0x3105,
-  0x3125, 0x3105, 0x3105, 0x3125, 0x3105, 0x3125, 0x3105, 0x3105,
-  0x3105, 0x3105, 0x3105, 0x3105, 0x3146, 0x3125, 0x3105, 0x3125,
-  0x3125, 0x3105, 0x3125, 0x3105, 0x3105, 0x3125, 0x3125, 0x3125,
-  0x2905, 0x3125, 0x3125, 0x3125, 0x3166, 0x3145, 0x3146, 0x3166,
-  0x3166, 0x3145, 0x3145, 0x3166, 0x3146, 0x3146, 0x3166, 0x3166,
-  0x3987, 0x3987, 0x3166, 0x3146, 0x3166, 0x3166, 0x3146, 0x3146,
-  0x3166, 0x3966, 0x3166, 0x3166, 0x3986, 0x3166, 0x3966, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3146, 0x3986, 0x3186, 0x3186, 0x31a7,
-  0x39c7, 0x39a7, 0x39c7, 0x4208, 0x4208, 0x39c7, 0x39c7, 0x39c8,
-  0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x4a8a,
-  0x3a08, 0x3a08, 0x3a09, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x4269,
-  0x4229, 0x4229, 0x3a29, 0x3a09, 0x4229, 0x4229, 0x39e8, 0x3a09,
-  0x4229, 0x3a09, 0x3a29, 0x3a29, 0x3a09, 0x4229, 0x3a29, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x3a29, 0x3a29, 0x3a29, 0x3a49,
-  0x3a29, 0x3a29, 0x4249, 0x3a49, 0x426a, 0x426a, 0x426a, 0x3a4a,
-  0x3a6a, 0x426a, 0x3a6a, 0x3a6a, 0x4acb, 0x428a, 0x428a, 0x428a,
-  0x428b, 0x42ab, 0x42cc, 0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x42cc,
-  0x42ec, 0x4aec, 0x4b0c, 0x4b2d, 0x532d, 0x534e, 0x536e, 0x538e,
-  0x538f, 0x53af, 0x5bcf, 0x5bf0, 0x6431, 0x6471, 0x6c72, 0x6cb2,
-  0x74d3, 0x74f3, 0x7d34, 0x8595, 0x8dd6, 0x9e37, 0xa678, 0xaed9,
-  0xb71a, 0xc77b, 0xd7bc, 0xe7fc, 0xfffe, 0xeffd, 0xdfbc, 0xcf7c,
-  0xc73b, 0xb6fa, 0xdf7b, 0xb6b9, 0xb6fa, 0xcf1b, 0xae17, 0xd6f9,
-  0xf79b, 0xf79b, 0xe739, 0xe719, 0xe719, 0xef5a, 0xf7bb, 0xef7a,
-  0xe719, 0xe6f9, 0xce57, 0x8470, 0x9d74, 0xb5f6, 0xc636, 0xbdf6,
-  0x7c71, 0x9513, 0x9d33, 0xce97, 0xad95, 0x7430, 0x6bf0, 0x538e,
-  0x536e, 0x4b0d, 0x6bcf, 0x8471, 0x7c50, 0x8451, 0x8451, 0x8471,
-  0x8451, 0x8450, 0x7c50, 0x28c4, 0x28a4, 0x30e4, 0x30e4, 0x28c4,
-  0x28c4, 0x30c4, 0x28c4, 0x28e4, 0x30e4, 0x28c4, 0x3125, 0x3946,
-  0x28e4, 0x30e5, 0x3105, 0x3105, 0x28e4, 0x3104, 0x3104, 0x28e4,
-  0x3105, 0x3105, 0x28e4, 0x3104, 0x3104, 0x3104, 0x3145, 0x3125,
-  0x3105, 0x3125, 0x3105, 0x28e4, 0x3125, 0x3125, 0x3125, 0x3125,
-  0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3105, 0x3125, 0x3105, 0x3105,
-  0x3105, 0x3146, 0x3125, 0x3146, 0x3166, 0x3145, 0x3145, 0x3146,
-  0x3145, 0x3145, 0x3146, 0x3166, 0x3166, 0x3146, 0x3146, 0x3146,
-  0x3146, 0x3146, 0x3146, 0x3146, 0x3166, 0x3146, 0x3166, 0x3166,
-  0x3146, 0x3166, 0x3966, 0x3986, 0x3986, 0x3966, 0x3966, 0x3166,
-  0x3986, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x39c7,
-  0x39a7, 0x39c7, 0x39c7, 0x39c7, 0x4208, 0x4209, 0x39c8, 0x39e8,
-  0x39e8, 0x39e8, 0x39c8, 0x3a08, 0x3a08, 0x39c7, 0x39e8, 0x4a6a,
-  0x3a08, 0x3a08, 0x3a29, 0x4229, 0x3a29, 0x3a29, 0x428a, 0x6baf,
-  0x426a, 0x4229, 0x424a, 0x4a8a, 0x3a29, 0x4249, 0x3a09, 0x3a09,
-  0x3a09, 0x3a29, 0x3a29, 0x4229, 0x3a09, 0x3a29, 0x3a29, 0x52ec,
-  0x5b2d, 0x3a29, 0x3a29, 0x3a29, 0x4249, 0x3a09, 0x4249, 0x4249,
-  0x426a, 0x4249, 0x3a49, 0x3a29, 0x426a, 0x424a, 0x3a4a, 0x426a,
-  0x426a, 0x426a, 0x426a, 0x428a, 0x3a6a, 0x428a, 0x428a, 0x428b,
-  0x42ab, 0x42cc, 0x42cc, 0x42cc, 0x42cc, 0x42cc, 0x42cb, 0x42cc,
-  0x4b0c, 0x4aec, 0x4b0d, 0x4b2d, 0x4b2d, 0x536e, 0x536e, 0x536e,
-  0x5baf, 0x5bf0, 0x5bf0, 0x6410, 0x6451, 0x6c72, 0x6c92, 0x74b2,
-  0x74f3, 0x7d34, 0x7d54, 0x8595, 0x95f6, 0x9e38, 0xa698, 0xaed9,
-  0xbf1a, 0xc77b, 0xd7dc, 0xeffc, 0xfffe, 0xeffd, 0xdfbc, 0xcf7c,
-  0xbf3b, 0xb6da, 0xdf5c, 0xb6d9, 0xbefa, 0xc6d9, 0xbe78, 0xdf1a,
-  0xf7dc, 0xef7a, 0xe739, 0xdef8, 0xded8, 0xef5a, 0xffdb, 0xef5a,
-  0xe719, 0xded8, 0xa574, 0x7c71, 0xa5b5, 0xc657, 0xce97, 0xb5b5,
-  0x7c51, 0xa554, 0xa553, 0xd697, 0x9d53, 0x7c51, 0x5baf, 0x538e,
-  0x534e, 0x4b2d, 0x7410, 0x8471, 0x8451, 0x8471, 0x8471, 0x8471,
-  0x8471, 0x8471, 0x8450, 0x28c4, 0x20a3, 0x28c4, 0x28e4, 0x28e4,
-  0x28e4, 0x30e4, 0x30e4, 0x30e4, 0x30e4, 0x30e4, 0x30e4, 0x30e4,
-  0x3105, 0x3105, 0x3105, 0x3125, 0x3125, 0x3105, 0x2905, 0x28e4,
-  0x3105, 0x3105, 0x3105, 0x3125, 0x3105, 0x3105, 0x3125, 0x3105,
-  0x3105, 0x3105, 0x3125, 0x3105, 0x3105, 0x3105, 0x3105, 0x3125,
-  0x3966, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3105,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3145, 0x3146, 0x2905,
-  0x3125, 0x3125, 0x2925, 0x3125, 0x3146, 0x3987, 0x4a08, 0x3145,
-  0x3166, 0x3166, 0x3146, 0x3146, 0x3166, 0x3146, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3986, 0x3986, 0x3986, 0x3986,
-  0x3987, 0x3166, 0x3186, 0x3166, 0x3166, 0x3186, 0x31a7, 0x39a7,
-  0x39c7, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x4208, 0x39e8, 0x39e8,
-  0x4208, 0x4229, 0x39c7, 0x39c8, 0x39e8, 0x3a08, 0x3a08, 0x3a08,
-  0x3a29, 0x3a29, 0x4229, 0x4249, 0x4229, 0x4249, 0x4249, 0x4a8a,
-  0x426a, 0x4249, 0x4249, 0x4249, 0x3a29, 0x3a29, 0x3a08, 0x3a09,
-  0x3a29, 0x3a09, 0x4229, 0x4249, 0x3a09, 0x3a29, 0x3a29, 0x426a,
-  0x4249, 0x4249, 0x4249, 0x3a29, 0x4249, 0x3a29, 0x4249, 0x3a49,
-  0x426a, 0x3a49, 0x3a49, 0x3a4a, 0x3a4a, 0x426a, 0x428b, 0x428a,
-  0x3a6a, 0x426a, 0x428b, 0x42ab, 0x42ab, 0x42ab, 0x428a, 0x42ab,
-  0x42ab, 0x42ab, 0x42cb, 0x4acc, 0x4aec, 0x4b0c, 0x42cb, 0x42cc,
-  0x4aec, 0x4aec, 0x4b0c, 0x4b2d, 0x4b4d, 0x534d, 0x536e, 0x8514,
-  0x7492, 0x5bf0, 0x6410, 0x6451, 0x6471, 0x6c72, 0x6c92, 0x74d3,
-  0x7d13, 0x8555, 0x8554, 0x8db5, 0x95f6, 0x9e57, 0xa698, 0xaed9,
-  0xbf3a, 0xc77b, 0xd7dc, 0xeffd, 0xfffe, 0xeffd, 0xd7bc, 0xcf7c,
-  0xbf3b, 0xbf1a, 0xdf7b, 0xb6d9, 0xbefa, 0xbeb9, 0xbe78, 0xe73a,
-  0xffdc, 0xef5a, 0xef5a, 0xdef8, 0xd697, 0xef7a, 0xffdc, 0xef5a,
-  0xe6f9, 0xd697, 0x8cd2, 0x8491, 0xb616, 0xbe36, 0xce77, 0xa554,
-  0x7c50, 0xa574, 0xc636, 0xce77, 0x9513, 0x7c71, 0x536e, 0x536e,
-  0x534e, 0x534e, 0x7c51, 0x8471, 0x8471, 0x8471, 0x8471, 0x8471,
-  0x8c71, 0x8c91, 0x8450, 0x28c4, 0x28c4, 0x30e5, 0x4187, 0x28e4,
-  0x3105, 0x30e4, 0x30e4, 0x3105, 0x30e4, 0x30e5, 0x30e4, 0x30e4,
-  0x30e5, 0x30e5, 0x30e4, 0x3926, 0x3105, 0x3105, 0x3105, 0x3105,
-  0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x28e4, 0x3105,
-  0x3105, 0x3104, 0x3125, 0x3125, 0x3125, 0x3105, 0x3105, 0x3105,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3146, 0x3146, 0x3125, 0x3146,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3146, 0x3146, 0x3146, 0x3145,
-  0x3125, 0x3146, 0x3146, 0x3146, 0x3146, 0x3966, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3986, 0x3146, 0x3987, 0x3166, 0x3166,
-  0x3986, 0x3166, 0x39a7, 0x3166, 0x3145, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3966, 0x3966, 0x3166, 0x3986, 0x3966, 0x3987,
-  0x3986, 0x3186, 0x3166, 0x39a7, 0x3186, 0x3186, 0x39a7, 0x39a7,
-  0x39c8, 0x39e8, 0x4a8a, 0x4208, 0x3a08, 0x4208, 0x39e7, 0x39e8,
-  0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a09,
-  0x4229, 0x4229, 0x4249, 0x3a29, 0x4249, 0x4249, 0x428a, 0x4aaa,
-  0x428a, 0x426a, 0x4a6a, 0x4249, 0x4249, 0x3a28, 0x3a29, 0x3a29,
-  0x4229, 0x3a29, 0x3a29, 0x426a, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x4249, 0x4249, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x424a, 0x4249,
-  0x426a, 0x426a, 0x424a, 0x426a, 0x3a4a, 0x426a, 0x3a49, 0x530d,
-  0x5b2d, 0x3a49, 0x426a, 0x42ab, 0x4acb, 0x42cb, 0x428b, 0x42cb,
-  0x42cb, 0x42ab, 0x42ab, 0x42cc, 0x42cc, 0x42cb, 0x4aec, 0x4aec,
-  0x4aec, 0x4b0c, 0x4b2d, 0x4b4d, 0x4b2d, 0x534e, 0x538e, 0x8d35,
-  0x6c71, 0x5bcf, 0x6410, 0x6431, 0x6c92, 0x6c92, 0x6cb2, 0x74f3,
-  0x7d13, 0x8554, 0x8575, 0x8dd6, 0x9617, 0x9e58, 0xaeb8, 0xb6f9,
-  0xbf3a, 0xcf9b, 0xdfdc, 0xf7fd, 0xfffe, 0xe7fc, 0xdfbc, 0xcf7c,
-  0xbf3b, 0xbf1a, 0xdf3b, 0xae98, 0xbed9, 0xbeb9, 0xced9, 0xe75a,
-  0xf7bb, 0xef39, 0xef5a, 0xdef9, 0xd6b7, 0xef7a, 0xfffc, 0xf75a,
-  0xe6d8, 0xc636, 0x8cd2, 0x94f3, 0xce99, 0xbe36, 0xce97, 0x9513,
-  0x8471, 0xa553, 0xd697, 0xbe16, 0x8cd2, 0x6c10, 0x534e, 0x536e,
-  0x4b2d, 0x5b4e, 0x7c71, 0x8471, 0x8471, 0x8471, 0x8471, 0x8c91,
-  0x8c91, 0x8c91, 0x8c91, 0x28e4, 0x3105, 0x28e4, 0x3946, 0x30e4,
-  0x28c4, 0x28c4, 0x3946, 0x41a7, 0x28c4, 0x30e5, 0x3105, 0x30e5,
-  0x30e5, 0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x3125, 0x3125,
-  0x3105, 0x28e4, 0x41a7, 0x3966, 0x28e5, 0x3105, 0x3105, 0x3105,
-  0x3105, 0x3105, 0x3125, 0x3125, 0x3125, 0x3125, 0x3105, 0x3105,
-  0x3126, 0x3125, 0x3125, 0x3945, 0x3145, 0x3125, 0x3146, 0x3125,
-  0x3966, 0x3125, 0x3125, 0x3966, 0x3146, 0x3105, 0x3125, 0x3146,
-  0x3125, 0x3986, 0x3146, 0x3125, 0x3146, 0x3146, 0x3146, 0x3166,
-  0x3146, 0x3146, 0x3146, 0x3986, 0x3166, 0x3986, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3966, 0x3986, 0x3987, 0x3987, 0x3186,
-  0x39c7, 0x3186, 0x3186, 0x39a7, 0x3987, 0x3187, 0x31a7, 0x39a7,
-  0x39c7, 0x39c7, 0x4208, 0x4208, 0x39e8, 0x3a08, 0x4a49, 0x4229,
-  0x4208, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x4229,
-  0x3a29, 0x4229, 0x4249, 0x4249, 0x426a, 0x4aab, 0x4aec, 0x4acb,
-  0x4acb, 0x4aab, 0x4a8a, 0x4a6a, 0x426a, 0x4249, 0x3a08, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x4249, 0x4249, 0x3a29,
-  0x4249, 0x4249, 0x3a29, 0x3a29, 0x3a49, 0x3a49, 0x4249, 0x3a49,
-  0x424a, 0x4acb, 0x4249, 0x424a, 0x426a, 0x3a4a, 0x3a49, 0x42ab,
-  0x42ab, 0x3a6a, 0x428a, 0x428b, 0x428b, 0x428b, 0x42ab, 0x42ab,
-  0x42cb, 0x42ab, 0x42cb, 0x42cc, 0x42cc, 0x42ec, 0x4aec, 0x4b0c,
-  0x4b0d, 0x4b0d, 0x4b2d, 0x534d, 0x536e, 0x538e, 0x53af, 0x53ae,
-  0x5bcf, 0x5c10, 0x6430, 0x6451, 0x6c71, 0x6c92, 0x74b2, 0x74f3,
-  0x7d14, 0x8554, 0x8595, 0x8dd6, 0x9617, 0x9e58, 0xaeb9, 0xb6f9,
-  0xbf3a, 0xcf9b, 0xdfdc, 0xf7fd, 0xfffd, 0xe7dc, 0xdfbc, 0xcf7c,
-  0xbf3b, 0xbefa, 0xd73b, 0xae98, 0xb6b9, 0xc6d9, 0xd6f9, 0xf7bb,
-  0xf79b, 0xe739, 0xe739, 0xd6b8, 0xded8, 0xef5a, 0xffdc, 0xf75a,
-  0xe6d9, 0xbdf6, 0x7c71, 0xa555, 0xd6b9, 0xbe16, 0xceb8, 0x8cd2,
-  0x94d2, 0xb5b5, 0xded8, 0xb5d5, 0x7cb2, 0x5baf, 0x536e, 0x536e,
-  0x4b2d, 0x534e, 0x7c71, 0x7c50, 0x8471, 0x8c91, 0x8c91, 0x8c91,
-  0x8c91, 0x8c91, 0x9cf2, 0x28e4, 0x3105, 0x28e4, 0x28c4, 0x28e4,
-  0x28e4, 0x30e4, 0x30e4, 0x30e4, 0x30e4, 0x30e5, 0x3105, 0x30e4,
-  0x3105, 0x30e5, 0x3105, 0x3105, 0x3105, 0x3125, 0x3125, 0x3105,
-  0x3105, 0x3105, 0x3105, 0x3125, 0x3946, 0x3125, 0x3146, 0x3125,
-  0x3125, 0x3105, 0x3966, 0x3125, 0x3125, 0x3145, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3146, 0x3946, 0x3946, 0x3125,
-  0x3966, 0x3125, 0x3125, 0x3125, 0x3946, 0x3946, 0x3125, 0x3145,
-  0x3146, 0x3166, 0x3125, 0x3125, 0x3145, 0x3166, 0x3146, 0x3986,
-  0x3146, 0x3166, 0x3166, 0x3166, 0x3987, 0x3186, 0x3186, 0x3186,
-  0x3166, 0x3987, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x3166, 0x3166, 0x3166, 0x3987, 0x3186, 0x3987, 0x3987, 0x3987,
-  0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x31a7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x4209, 0x39e8, 0x3a08,
-  0x4229, 0x4209, 0x39e8, 0x39e8, 0x3a08, 0x3a09, 0x3a09, 0x3a29,
-  0x3a29, 0x4249, 0x424a, 0x426a, 0x428a, 0x4aab, 0x532d, 0x5b4d,
-  0x532d, 0x4aab, 0x4aaa, 0x426a, 0x4249, 0x3a29, 0x3a29, 0x4249,
-  0x4249, 0x4249, 0x3a29, 0x3a29, 0x3a29, 0x4249, 0x3a29, 0x3a29,
-  0x4229, 0x4249, 0x3a29, 0x3a29, 0x3a49, 0x3a29, 0x4249, 0x4249,
-  0x3a49, 0x426a, 0x426a, 0x3a29, 0x424a, 0x3a4a, 0x3a6a, 0x428a,
-  0x3a6a, 0x3a8a, 0x3a6a, 0x3a6a, 0x3a6a, 0x428a, 0x42ab, 0x42ab,
-  0x42cb, 0x42cc, 0x42cc, 0x4aec, 0x42cc, 0x42ec, 0x4aec, 0x4b0c,
-  0x4b2d, 0x4b2c, 0x4b4d, 0x534e, 0x5baf, 0x5baf, 0x5baf, 0x5bcf,
-  0x5bf0, 0x6410, 0x6430, 0x6451, 0x6c71, 0x6c92, 0x74d3, 0x7513,
-  0x7d34, 0x8555, 0x8d95, 0x95d6, 0x9e37, 0xa678, 0xaeb9, 0xb6f9,
-  0xbf5a, 0xcf9b, 0xdfdc, 0xf7fd, 0xf7fd, 0xe7dc, 0xdfbc, 0xcf7c,
-  0xb73b, 0xbefa, 0xd75b, 0xa678, 0xc6f9, 0xdf3a, 0xd719, 0xf7bb,
-  0xf79b, 0xef59, 0xe719, 0xce77, 0xded8, 0xef3a, 0xfffd, 0xf75a,
-  0xded8, 0xb5b5, 0x7c71, 0xad95, 0xd6f9, 0xbdd6, 0xc657, 0x7c71,
-  0x8491, 0xb5d5, 0xe719, 0xad95, 0x7471, 0x538e, 0x536e, 0x4b0d,
-  0x4b2d, 0x532d, 0x5b6e, 0x7410, 0x8491, 0x8c91, 0x8c91, 0x8c91,
-  0x8c91, 0x8c91, 0x94b1, 0x28c4, 0x28e4, 0x3105, 0x3105, 0x3105,
-  0x28e4, 0x30e4, 0x30e4, 0x30e5, 0x3105, 0x3105, 0x30e5, 0x30e5,
-  0x3125, 0x3105, 0x3105, 0x28e5, 0x3125, 0x3105, 0x3105, 0x3105,
-  0x3105, 0x3946, 0x3105, 0x3105, 0x3125, 0x3105, 0x3105, 0x3105,
-  0x3125, 0x3105, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125,
-  0x3146, 0x3125, 0x3125, 0x3145, 0x3125, 0x3125, 0x3125, 0x3125,
-  0x3146, 0x3125, 0x3125, 0x3145, 0x3946, 0x3966, 0x3125, 0x3145,
-  0x3145, 0x3146, 0x3125, 0x3166, 0x3987, 0x3146, 0x3146, 0x3146,
-  0x3145, 0x3146, 0x3146, 0x3166, 0x39a7, 0x3987, 0x3987, 0x3986,
-  0x3186, 0x39a7, 0x3186, 0x41c7, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x3986, 0x3186, 0x39a7, 0x3186, 0x3186, 0x3187, 0x39a7,
-  0x39a7, 0x39c7, 0x39a7, 0x39a7, 0x39a7, 0x39c7, 0x39c7, 0x39e8,
-  0x39c7, 0x39e7, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x4a8a, 0x5aec, 0x39c7, 0x39e8, 0x3a08, 0x3a08, 0x3a09, 0x3a09,
-  0x4229, 0x424a, 0x426a, 0x428a, 0x4acb, 0x52ec, 0x5b6e, 0x63cf,
-  0x638e, 0x534d, 0x4aec, 0x4aaa, 0x4a8a, 0x4249, 0x4249, 0x3a29,
-  0x3a49, 0x426a, 0x3a29, 0x4249, 0x4229, 0x4249, 0x4249, 0x4a8a,
-  0x4a8a, 0x426a, 0x3a29, 0x426a, 0x424a, 0x426a, 0x424a, 0x4249,
-  0x424a, 0x426a, 0x426a, 0x426a, 0x428a, 0x428b, 0x426a, 0x426a,
-  0x428a, 0x42ab, 0x428b, 0x428a, 0x42ab, 0x428a, 0x42ab, 0x42cb,
-  0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x4b0c, 0x4b2d,
-  0x4b4d, 0x4b4d, 0x536e, 0x536e, 0x538e, 0x5baf, 0x53af, 0x5bef,
-  0x5bf0, 0x5c10, 0x6430, 0x6c51, 0x6c72, 0x74b2, 0x74d3, 0x7d13,
-  0x7d34, 0x8575, 0x8db6, 0x95f6, 0x9e37, 0xa678, 0xaed9, 0xb71a,
-  0xc75b, 0xcf9b, 0xe7fc, 0xfffe, 0xf7fd, 0xe7dc, 0xdfbc, 0xcf5c,
-  0xbf3b, 0xc73a, 0xd75b, 0x9e37, 0xcf1b, 0xdf3b, 0xdf3a, 0xf7bb,
-  0xf7bb, 0xef5a, 0xe719, 0xd677, 0xded8, 0xe73a, 0xfffd, 0xf75a,
-  0xded8, 0xadd5, 0x84b2, 0xbe36, 0xd6d9, 0xc657, 0xb5f6, 0x7451,
-  0x7c71, 0xb5d5, 0xe718, 0x9d54, 0x6c30, 0x5b8e, 0x4b2d, 0x4b0d,
-  0x4b2d, 0x534d, 0x534d, 0x7c31, 0x8c91, 0x8c91, 0x8c91, 0x8c91,
-  0x8c91, 0x8c71, 0x9d12, 0x28e4, 0x3105, 0x3105, 0x3105, 0x3125,
-  0x3105, 0x3105, 0x3105, 0x28e4, 0x3104, 0x30e4, 0x30e4, 0x3105,
-  0x3105, 0x28e4, 0x3105, 0x30e5, 0x3105, 0x3105, 0x3105, 0x3105,
-  0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x2905, 0x3125, 0x3125,
-  0x3125, 0x3105, 0x3125, 0x3125, 0x3145, 0x3125, 0x3125, 0x3125,
-  0x3146, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3146, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3146, 0x3125, 0x3146, 0x3166,
-  0x3966, 0x3125, 0x3146, 0x3146, 0x3166, 0x3146, 0x3145, 0x3146,
-  0x3146, 0x3146, 0x3146, 0x3186, 0x3166, 0x41e8, 0x3987, 0x3166,
-  0x3186, 0x3166, 0x3166, 0x3987, 0x3166, 0x3166, 0x3186, 0x3166,
-  0x3186, 0x3186, 0x3987, 0x3987, 0x39a7, 0x39c7, 0x39a7, 0x39a7,
-  0x39a7, 0x39c7, 0x39c7, 0x39a7, 0x39c7, 0x39a7, 0x39e8, 0x39e8,
-  0x39e8, 0x4208, 0x39c7, 0x39e8, 0x39e8, 0x4208, 0x4208, 0x3a08,
-  0x3a08, 0x4249, 0x39e8, 0x3a08, 0x4229, 0x3a29, 0x4249, 0x4229,
-  0x4249, 0x426a, 0x428a, 0x42ab, 0x530d, 0x5b6e, 0x6bef, 0x6c10,
-  0x63ef, 0x5b8e, 0x4b0c, 0x4aab, 0x4a8a, 0x426a, 0x4249, 0x4269,
-  0x4249, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x4249, 0x4249, 0x4249,
-  0x3a49, 0x426a, 0x426a, 0x4249, 0x3a49, 0x428a, 0x3a49, 0x3a49,
-  0x3a49, 0x426a, 0x428a, 0x428a, 0x42ab, 0x428b, 0x426a, 0x428b,
-  0x428b, 0x428a, 0x42ab, 0x428b, 0x428b, 0x42ab, 0x42ab, 0x42cb,
-  0x4aec, 0x4b0d, 0x532d, 0x4aec, 0x4b2d, 0x534d, 0x4b2d, 0x4b4d,
-  0x534d, 0x536e, 0x536e, 0x538e, 0x53af, 0x5baf, 0x5baf, 0x5bef,
-  0x6410, 0x6430, 0x6431, 0x6451, 0x6c92, 0x74b2, 0x74f3, 0x7d13,
-  0x7d54, 0x8575, 0x8db5, 0x95f6, 0x9e37, 0xa698, 0xb6d9, 0xbf3a,
-  0xc75b, 0xcfbb, 0xefdd, 0xfffe, 0xf7fd, 0xe7bc, 0xdfbc, 0xcf5b,
-  0xb6fa, 0xd75a, 0xd73b, 0x9e17, 0xd75b, 0xdf3a, 0xe75a, 0xf7bb,
-  0xf7bb, 0xef5a, 0xe719, 0xd677, 0xd6b8, 0xef5a, 0xffdc, 0xf77a,
-  0xd6b8, 0xadb5, 0x94f2, 0xd6b8, 0xd6d9, 0xce77, 0xb5f6, 0x6c10,
-  0x7430, 0xbdd5, 0xe6f9, 0x9513, 0x6c30, 0x534d, 0x4b2d, 0x4b2d,
-  0x534d, 0x534d, 0x7430, 0x8471, 0x8c71, 0x8c91, 0x8c91, 0x8c91,
-  0x8c91, 0x8c91, 0x94b1, 0x28e4, 0x28e4, 0x28e4, 0x28e4, 0x28e4,
-  0x28e4, 0x30e5, 0x3105, 0x3104, 0x3104, 0x3105, 0x30e5, 0x3105,
-  0x3125, 0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x3105, 0x28e4,
-  0x3105, 0x3105, 0x3105, 0x3125, 0x3125, 0x3125, 0x3146, 0x3125,
-  0x3146, 0x3105, 0x3145, 0x3125, 0x3125, 0x3145, 0x3125, 0x3946,
-  0x3125, 0x3145, 0x3146, 0x3125, 0x3125, 0x3125, 0x3146, 0x3125,
-  0x3146, 0x3125, 0x3105, 0x3946, 0x3966, 0x3125, 0x3146, 0x3146,
-  0x3145, 0x3146, 0x3146, 0x3145, 0x3166, 0x3125, 0x3145, 0x3166,
-  0x3166, 0x3145, 0x3146, 0x3145, 0x3146, 0x3166, 0x3166, 0x3987,
-  0x3986, 0x3186, 0x3166, 0x3986, 0x3166, 0x3166, 0x39a7, 0x3187,
-  0x39a7, 0x3987, 0x3186, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x31a7,
-  0x39a7, 0x39c7, 0x39c7, 0x39c8, 0x39c8, 0x39c7, 0x39c7, 0x39e7,
-  0x39e8, 0x39e8, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x4208, 0x4a6a,
-  0x4229, 0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x3a08, 0x3a29, 0x4249,
-  0x4249, 0x4269, 0x42ab, 0x4b0c, 0x5b6e, 0x6bd0, 0x7c71, 0x7cb2,
-  0x7451, 0x63ef, 0x5b6d, 0x4aec, 0x428a, 0x428a, 0x426a, 0x4269,
-  0x4249, 0x4249, 0x4249, 0x426a, 0x3a29, 0x4249, 0x426a, 0x428a,
-  0x3a49, 0x424a, 0x428a, 0x4249, 0x426a, 0x426a, 0x426a, 0x3a4a,
-  0x426a, 0x428a, 0x428a, 0x426a, 0x428a, 0x428a, 0x428a, 0x426a,
-  0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x428b, 0x42ab, 0x42ab, 0x4acb,
-  0x4b0c, 0x4b0c, 0x4aec, 0x4aec, 0x4b2d, 0x4b0c, 0x4b2d, 0x4b4d,
-  0x534d, 0x534d, 0x536e, 0x5baf, 0x5baf, 0x5bcf, 0x5bcf, 0x5bef,
-  0x63f0, 0x6410, 0x6451, 0x6c51, 0x6c71, 0x74b2, 0x74f3, 0x7d13,
-  0x8554, 0x8d95, 0x8db6, 0x9616, 0xa657, 0xae99, 0xb6f9, 0xbf3a,
-  0xc77b, 0xcfbb, 0xeffd, 0xfffe, 0xf7fd, 0xe7bc, 0xe7bc, 0xc75b,
-  0xb6fa, 0xd75a, 0xcf1a, 0x9e17, 0xdf7b, 0xdf5b, 0xef7b, 0xf79b,
-  0xf7bb, 0xef5a, 0xdef9, 0xce37, 0xce76, 0xef5a, 0xffdc, 0xf79a,
-  0xd698, 0xad74, 0xa553, 0xdef9, 0xc657, 0xc677, 0xb5d6, 0x63ef,
-  0x84b2, 0xc636, 0xded8, 0x8cf2, 0x6c30, 0x4b2c, 0x4b2d, 0x4b4d,
-  0x536d, 0x534d, 0x7450, 0x7430, 0x8491, 0x8cb1, 0x8c91, 0x8c91,
-  0x8c91, 0x8c91, 0x8470, 0x28e4, 0x28c4, 0x28e4, 0x3105, 0x3105,
-  0x3105, 0x3105, 0x3125, 0x3104, 0x3105, 0x3105, 0x3125, 0x3105,
-  0x3105, 0x3125, 0x3105, 0x3105, 0x3105, 0x3125, 0x3105, 0x3105,
-  0x3105, 0x3125, 0x3125, 0x3105, 0x3125, 0x3125, 0x3146, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3145, 0x3125, 0x3125,
-  0x3145, 0x3966, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3146,
-  0x3146, 0x3125, 0x3125, 0x3146, 0x3145, 0x3125, 0x3146, 0x3146,
-  0x3125, 0x3145, 0x3125, 0x3146, 0x3145, 0x3146, 0x3166, 0x3166,
-  0x3186, 0x3146, 0x3146, 0x3166, 0x3166, 0x3186, 0x3166, 0x3186,
-  0x3986, 0x3186, 0x3166, 0x3186, 0x3186, 0x3186, 0x3187, 0x3187,
-  0x41e8, 0x31a7, 0x3186, 0x39a7, 0x3187, 0x39a7, 0x31a7, 0x31c7,
-  0x4249, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39e8, 0x39c7, 0x41e8,
-  0x39c7, 0x4208, 0x39e8, 0x39c7, 0x4208, 0x39e8, 0x39e8, 0x4229,
-  0x4229, 0x39e8, 0x3a08, 0x4229, 0x3a08, 0x3a09, 0x3a29, 0x3a29,
-  0x4249, 0x4a8a, 0x52ec, 0x5b6e, 0x6c10, 0x84d3, 0xb618, 0xb637,
-  0x8d13, 0x6c30, 0x5b8e, 0x530c, 0x4acb, 0x4aab, 0x426a, 0x3a49,
-  0x4249, 0x4249, 0x3a29, 0x3a29, 0x4249, 0x4249, 0x426a, 0x426a,
-  0x3a49, 0x4249, 0x424a, 0x424a, 0x426a, 0x426a, 0x426a, 0x426a,
-  0x428a, 0x426a, 0x426a, 0x3a6a, 0x4aec, 0x4acc, 0x426a, 0x428a,
-  0x428b, 0x42ab, 0x42ab, 0x4acb, 0x42ab, 0x4acb, 0x4aec, 0x4aec,
-  0x4b0d, 0x4b0c, 0x4b0c, 0x4b0c, 0x532d, 0x4b0d, 0x4b4d, 0x534d,
-  0x534d, 0x536e, 0x5baf, 0x5baf, 0x5bef, 0x5bef, 0x5bcf, 0x63f0,
-  0x6410, 0x6430, 0x6451, 0x6c71, 0x6c92, 0x74d3, 0x7cf3, 0x7d14,
-  0x8554, 0x8d95, 0x95d6, 0x9616, 0xa678, 0xaeb9, 0xb6f9, 0xbf3a,
-  0xcf7b, 0xd7bb, 0xeffd, 0xfffe, 0xefdd, 0xe7bc, 0xe7dc, 0xc75b,
-  0xb71a, 0xdf7b, 0xbed9, 0xa637, 0xe77b, 0xdf5a, 0xef9b, 0xf79b,
-  0xf7bb, 0xef39, 0xdeb9, 0xce57, 0xce97, 0xef7b, 0xffbc, 0xf79a,
-  0xce77, 0x9d13, 0xb5b5, 0xdef9, 0xc637, 0xbe16, 0x9d54, 0x5baf,
-  0x8cb2, 0xce77, 0xdeb8, 0x8cd2, 0x63cf, 0x4b2d, 0x4b4d, 0x4b4d,
-  0x536e, 0x534d, 0x63ae, 0x63ae, 0x8491, 0x8cb1, 0x8cb1, 0x8cb1,
-  0x8c91, 0x8c91, 0x8c70, 0x28e4, 0x3125, 0x28e4, 0x3105, 0x3105,
-  0x3105, 0x3105, 0x3105, 0x3105, 0x28e5, 0x3105, 0x3125, 0x3105,
-  0x3105, 0x3105, 0x3125, 0x3125, 0x3105, 0x3105, 0x3125, 0x3125,
-  0x2905, 0x3105, 0x3125, 0x3105, 0x3125, 0x3966, 0x3146, 0x3125,
-  0x3146, 0x3125, 0x3125, 0x3125, 0x3125, 0x3145, 0x3146, 0x3125,
-  0x3146, 0x41c7, 0x2925, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125,
-  0x3145, 0x3125, 0x3146, 0x3125, 0x3125, 0x3146, 0x3987, 0x3146,
-  0x3166, 0x3146, 0x3166, 0x3986, 0x3146, 0x3146, 0x3166, 0x3166,
-  0x3166, 0x3145, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x3186, 0x3166, 0x3166,
-  0x3166, 0x3186, 0x3186, 0x39a7, 0x31a7, 0x39a7, 0x39e8, 0x630d,
-  0x6b4d, 0x4a49, 0x39c8, 0x39e8, 0x39e8, 0x39c8, 0x39c7, 0x41e8,
-  0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x4229, 0x4249, 0x426a, 0x3a09, 0x3a29, 0x3a29,
-  0x4249, 0x4a8b, 0x5b2d, 0x63af, 0x84b2, 0xb617, 0xf7de, 0xf7de,
-  0xa5b5, 0x7471, 0x63af, 0x5b4d, 0x52ec, 0x428a, 0x4269, 0x4249,
-  0x428a, 0x4249, 0x3a49, 0x3a29, 0x424a, 0x424a, 0x4249, 0x426a,
-  0x3a49, 0x426a, 0x426a, 0x428a, 0x426a, 0x4aab, 0x4aab, 0x428a,
-  0x428a, 0x428b, 0x426a, 0x428b, 0x4b0c, 0x4acb, 0x428a, 0x42ab,
-  0x4acc, 0x4acc, 0x42cb, 0x4acc, 0x42ac, 0x42cc, 0x4aec, 0x4aec,
-  0x4aec, 0x4b0c, 0x4b2d, 0x4b0c, 0x532d, 0x532d, 0x536d, 0x534d,
-  0x536e, 0x538e, 0x5baf, 0x53ae, 0x5bcf, 0x5bcf, 0x5bf0, 0x6410,
-  0x6430, 0x6c51, 0x6c51, 0x6c71, 0x74b2, 0x74d3, 0x7cf3, 0x7d34,
-  0x8575, 0x8d95, 0x95d6, 0x9e37, 0xa678, 0xaeb9, 0xb6f9, 0xbf3a,
-  0xcf7b, 0xd7bb, 0xf7fe, 0xffde, 0xefdd, 0xe7bc, 0xe7bc, 0xbf3b,
-  0xb6fa, 0xd75b, 0xb6b9, 0xae78, 0xef9b, 0xe77a, 0xf79b, 0xf7bb,
-  0xf79b, 0xe719, 0xd6b8, 0xce97, 0xd697, 0xef7b, 0xf7bb, 0xf79a,
-  0xc637, 0x9d33, 0xc657, 0xdef9, 0xc657, 0xc637, 0x9513, 0x5b8e,
-  0x8cb2, 0xd697, 0xd697, 0x84b1, 0x6bef, 0x4b2d, 0x4b0d, 0x534d,
-  0x536e, 0x534d, 0x4b4d, 0x63ce, 0x8491, 0x8cb1, 0x8cb1, 0x94b2,
-  0x94b1, 0x9491, 0x8c91, 0x28c4, 0x28e5, 0x3105, 0x28e4, 0x3105,
-  0x28e4, 0x3105, 0x3105, 0x3125, 0x3105, 0x3105, 0x3105, 0x3105,
-  0x3105, 0x3105, 0x3105, 0x3125, 0x3145, 0x3125, 0x3125, 0x3125,
-  0x3105, 0x3105, 0x2905, 0x3105, 0x3105, 0x3966, 0x3146, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3145, 0x3125, 0x3145, 0x3125,
-  0x3145, 0x3125, 0x3125, 0x3125, 0x2925, 0x3146, 0x3125, 0x3146,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3146, 0x3146, 0x3966, 0x3166,
-  0x3146, 0x3987, 0x3986, 0x3166, 0x3166, 0x3166, 0x3987, 0x39a7,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x3166,
-  0x39a7, 0x41c7, 0x39a7, 0x3166, 0x3166, 0x3986, 0x3166, 0x3166,
-  0x3186, 0x39a7, 0x3187, 0x3187, 0x31a7, 0x31a7, 0x4a8a, 0x6b8e,
-  0x41e8, 0x4a6a, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e8, 0x39e8, 0x4208, 0x4229,
-  0x3a08, 0x4229, 0x3a29, 0x4249, 0x4a8a, 0x3a09, 0x4229, 0x4249,
-  0x4249, 0x4a8a, 0x530c, 0x63cf, 0x8cf3, 0xa5f6, 0xd73b, 0xdf7b,
-  0x9d95, 0x6c51, 0x5bae, 0x532d, 0x4acb, 0x428a, 0x426a, 0x426a,
-  0x4249, 0x4249, 0x426a, 0x3a49, 0x3a49, 0x424a, 0x4aab, 0x4a8a,
-  0x426a, 0x3a49, 0x428a, 0x428a, 0x426a, 0x428a, 0x4aab, 0x428a,
-  0x42ab, 0x4aab, 0x428a, 0x428b, 0x428a, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x4acc, 0x4b0d, 0x4acc, 0x4b0d, 0x4aec, 0x4b0c, 0x4b0c,
-  0x4b0c, 0x4b0c, 0x4b0c, 0x4b0c, 0x534d, 0x534d, 0x534d, 0x534d,
-  0x536e, 0x538e, 0x53af, 0x5bcf, 0x5bcf, 0x5bf0, 0x6410, 0x6410,
-  0x6431, 0x6c51, 0x6c71, 0x6c71, 0x7492, 0x74b2, 0x7d13, 0x7d34,
-  0x8575, 0x8db5, 0x95f6, 0x9e37, 0xa678, 0xaed9, 0xb71a, 0xc75b,
-  0xcf9b, 0xdfdb, 0xf7fe, 0xf7fe, 0xe7dd, 0xe7bc, 0xdfbc, 0xbf3a,
-  0xb6fa, 0xdf7b, 0xae98, 0xb6b8, 0xef9b, 0xe75a, 0xf7bb, 0xf7dc,
-  0xef7a, 0xe719, 0xd698, 0xce97, 0xd6b8, 0xef7b, 0xffbb, 0xf79a,
-  0xbdf6, 0x9d33, 0xd6b8, 0xdef9, 0xbdf6, 0xce78, 0x84d2, 0x5bcf,
-  0x9513, 0xde98, 0xce97, 0x84b2, 0x6c0f, 0x4b2d, 0x530d, 0x5b6d,
-  0x536e, 0x536e, 0x63cf, 0x6c0f, 0x8c91, 0x94b2, 0x94b2, 0x94b2,
-  0x94b1, 0x94b1, 0x8c91, 0x28e4, 0x28e4, 0x28e5, 0x28e4, 0x28e4,
-  0x2905, 0x3105, 0x3105, 0x2905, 0x3105, 0x3105, 0x3125, 0x3125,
-  0x3125, 0x3105, 0x3105, 0x3105, 0x3125, 0x3125, 0x3145, 0x3125,
-  0x3145, 0x3125, 0x3125, 0x3125, 0x3125, 0x3166, 0x3125, 0x3166,
-  0x3966, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3146, 0x3986,
-  0x2925, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125, 0x3125,
-  0x2925, 0x2925, 0x3145, 0x3125, 0x3145, 0x3146, 0x3146, 0x3166,
-  0x3146, 0x3166, 0x3146, 0x3166, 0x3166, 0x3166, 0x3186, 0x3186,
-  0x3166, 0x3166, 0x3186, 0x3186, 0x3166, 0x3186, 0x3166, 0x3186,
-  0x39a7, 0x39a7, 0x3186, 0x3987, 0x3186, 0x39a7, 0x3186, 0x3166,
-  0x3186, 0x3166, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x39c8, 0x7bef,
-  0x8c92, 0x4a6a, 0x31a7, 0x39c8, 0x39c7, 0x39c7, 0x39c7, 0x39c7,
-  0x39c7, 0x4208, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x39e8, 0x4229, 0x4229, 0x4229, 0x4249, 0x4229,
-  0x4249, 0x428a, 0x530c, 0x5b8e, 0x6c10, 0x84b2, 0x9d95, 0xadf6,
-  0x84d2, 0x63ef, 0x5b6d, 0x4b0c, 0x4acb, 0x42aa, 0x4269, 0x426a,
-  0x426a, 0x426a, 0x426a, 0x3a49, 0x424a, 0x424a, 0x426a, 0x4249,
-  0x428a, 0x426a, 0x426a, 0x428a, 0x428a, 0x426a, 0x4acb, 0x4acb,
-  0x428a, 0x428a, 0x426a, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x4acb,
-  0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x532d, 0x532d, 0x4b0d, 0x4b0c,
-  0x4b0d, 0x532d, 0x532d, 0x4b0c, 0x532d, 0x532d, 0x534d, 0x534d,
-  0x536e, 0x538e, 0x5baf, 0x5baf, 0x5bcf, 0x5bf0, 0x6430, 0x6430,
-  0x6c51, 0x6c71, 0x6c71, 0x7492, 0x74d2, 0x7cf3, 0x7d34, 0x8554,
-  0x8d95, 0x95d6, 0x9616, 0x9e37, 0xa698, 0xb6d9, 0xbf1a, 0xc75b,
-  0xcf9b, 0xe7fc, 0xf7fe, 0xf7de, 0xe7fd, 0xe7dc, 0xd79c, 0xbf1a,
-  0xb6f9, 0xdf7b, 0xa678, 0xc6f9, 0xef9b, 0xe75a, 0xf79b, 0xffdc,
-  0xe75a, 0xdf19, 0xce77, 0xce57, 0xd698, 0xf7bb, 0xf79b, 0xf79b,
-  0xb5b5, 0xa553, 0xd6d8, 0xd6d9, 0xb5d5, 0xc657, 0x7471, 0x63f0,
-  0xad95, 0xde97, 0xce77, 0x8cd2, 0x63af, 0x4b0d, 0x534d, 0x5b6d,
-  0x534d, 0x5b6e, 0x63cf, 0x7410, 0x8cb2, 0x94d2, 0x94d2, 0x94d2,
-  0x94b2, 0x94b1, 0x9491, 0x28e5, 0x3105, 0x3105, 0x2905, 0x2905,
-  0x2904, 0x2905, 0x2905, 0x2905, 0x3105, 0x3125, 0x3105, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3146, 0x3145, 0x3125, 0x2925, 0x3125,
-  0x39a7, 0x3145, 0x3125, 0x3125, 0x3145, 0x3146, 0x3146, 0x3125,
-  0x3145, 0x3125, 0x3125, 0x3125, 0x3146, 0x3125, 0x3125, 0x3146,
-  0x3145, 0x3125, 0x3145, 0x3125, 0x3145, 0x2925, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3146, 0x3145, 0x3146, 0x3125, 0x3145, 0x3986,
-  0x3166, 0x3166, 0x3986, 0x3166, 0x3966, 0x3966, 0x3166, 0x39a7,
-  0x3186, 0x3986, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3186, 0x3186, 0x39a7, 0x3186, 0x3166, 0x3186, 0x3186,
-  0x3166, 0x3166, 0x3186, 0x31a6, 0x3186, 0x39c7, 0x31a7, 0x39c7,
-  0x39e8, 0x3186, 0x39c7, 0x39e8, 0x39e8, 0x39c7, 0x39c7, 0x39c7,
-  0x39a7, 0x39e8, 0x39c7, 0x39c7, 0x39e7, 0x39e8, 0x3a08, 0x3a08,
-  0x3a08, 0x39e8, 0x39e8, 0x4208, 0x4229, 0x4249, 0x4249, 0x4249,
-  0x426a, 0x428a, 0x4aab, 0x530c, 0x5b6d, 0x6c10, 0x7c91, 0x84d3,
-  0x6bf0, 0x5b4d, 0x5b4d, 0x4acc, 0x4aaa, 0x428a, 0x428a, 0x426a,
-  0x426a, 0x4a8a, 0x4249, 0x4a8a, 0x426a, 0x4249, 0x424a, 0x4a8b,
-  0x4aab, 0x428a, 0x4aab, 0x4aab, 0x4aab, 0x426a, 0x428a, 0x428a,
-  0x426a, 0x428a, 0x428b, 0x42ab, 0x42ab, 0x428b, 0x42ab, 0x4acb,
-  0x4acc, 0x4aec, 0x4aec, 0x532d, 0x4b2d, 0x534d, 0x534d, 0x4b0c,
-  0x4b0d, 0x532d, 0x4b2d, 0x4b0d, 0x532d, 0x534d, 0x534d, 0x536e,
-  0x536e, 0x538e, 0x5baf, 0x5bcf, 0x5bcf, 0x63f0, 0x6410, 0x6431,
-  0x6c71, 0x6c71, 0x74b2, 0x74d2, 0x7cf2, 0x7cf3, 0x7d34, 0x8554,
-  0x8d95, 0x95d6, 0x9617, 0xa657, 0xae98, 0xb6d9, 0xbf1a, 0xc77b,
-  0xd7bb, 0xe7fc, 0xfffe, 0xf7fe, 0xe7dc, 0xdfbc, 0xd79c, 0xb71a,
-  0xb6f9, 0xdf5a, 0xa637, 0xcf3a, 0xef9b, 0xef7b, 0xef9b, 0xf7dc,
-  0xdf19, 0xe739, 0xce56, 0xce57, 0xd677, 0xf79b, 0xffbb, 0xef7b,
-  0xad74, 0xb5b5, 0xdef8, 0xce98, 0xc636, 0xb5d5, 0x5bef, 0x63f0,
-  0xb5d5, 0xded8, 0xc636, 0x8491, 0x638e, 0x4b0d, 0x5b6e, 0x5b6e,
-  0x534d, 0x534d, 0x5bae, 0x7c50, 0x94b2, 0x94d2, 0x9cd2, 0x9cd2,
-  0x94d2, 0x94b1, 0x94b1, 0x28e4, 0x28e4, 0x28e4, 0x3125, 0x3125,
-  0x3146, 0x3125, 0x2905, 0x2905, 0x3125, 0x3105, 0x3105, 0x3105,
-  0x3125, 0x3146, 0x3125, 0x3146, 0x3145, 0x3146, 0x3125, 0x3125,
-  0x3125, 0x3145, 0x3146, 0x3125, 0x3145, 0x3146, 0x3166, 0x3146,
-  0x3146, 0x3166, 0x3146, 0x3145, 0x3146, 0x3146, 0x3145, 0x2925,
-  0x3145, 0x3145, 0x3145, 0x3145, 0x3146, 0x2925, 0x3125, 0x3146,
-  0x3125, 0x3125, 0x3125, 0x3125, 0x3145, 0x3125, 0x3145, 0x3166,
-  0x3166, 0x3146, 0x3986, 0x3166, 0x3166, 0x3166, 0x3166, 0x39a7,
-  0x39a7, 0x3186, 0x3186, 0x3987, 0x39a7, 0x3987, 0x3166, 0x3186,
-  0x39a7, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3186, 0x3186, 0x31a7, 0x39c7, 0x31a7, 0x39a7,
-  0x31a7, 0x31a7, 0x39c7, 0x39a7, 0x39a7, 0x39c7, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x4208,
-  0x3a08, 0x3a08, 0x39e8, 0x4208, 0x4229, 0x3a29, 0x3a28, 0x4249,
-  0x4249, 0x426a, 0x4a8a, 0x52ec, 0x5b4d, 0x5b6d, 0x63cf, 0x6bef,
-  0x638e, 0x4aec, 0x52ec, 0x4acc, 0x4aab, 0x428a, 0x428a, 0x426a,
-  0x428a, 0x426a, 0x3a29, 0x428a, 0x426a, 0x424a, 0x426a, 0x426a,
-  0x4a8b, 0x428a, 0x428a, 0x428a, 0x426a, 0x428a, 0x428a, 0x428b,
-  0x428b, 0x426a, 0x4aab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x4aec,
-  0x530d, 0x4aec, 0x532d, 0x4b2d, 0x4b2d, 0x7451, 0x5b6e, 0x532d,
-  0x534d, 0x534e, 0x532d, 0x532d, 0x534d, 0x536e, 0x534e, 0x536e,
-  0x538e, 0x5baf, 0x538e, 0x5bcf, 0x63f0, 0x6430, 0x6410, 0x6431,
-  0x6c71, 0x6c92, 0x74d2, 0x74d2, 0x74d2, 0x7d13, 0x8534, 0x8575,
-  0x8d95, 0x95f6, 0x9e37, 0xa678, 0xaeb8, 0xb6f9, 0xbf3a, 0xcf7b,
-  0xd7bb, 0xeffd, 0xffff, 0xf7fd, 0xe7dc, 0xdfbc, 0xcf5b, 0xb6fa,
-  0xbef9, 0xd73a, 0x9e37, 0xdf7b, 0xe75b, 0xef9b, 0xef9b, 0xf7dc,
-  0xdef8, 0xe75a, 0xce77, 0xd697, 0xd698, 0xf77a, 0xffdb, 0xe719,
-  0xad73, 0xb595, 0xe73a, 0xce57, 0xd698, 0x9d74, 0x538f, 0x7431,
-  0xbdf6, 0xe6f8, 0xce77, 0x8cd2, 0x5b6e, 0x532d, 0x5b6e, 0x5b8d,
-  0x536d, 0x4b2d, 0x5bae, 0x8491, 0x94d2, 0x9cd2, 0x9cf2, 0x9cf2,
-  0x9cf2, 0x94d2, 0x94b1, 0x28c4, 0x3105, 0x28e4, 0x28e4, 0x3105,
-  0x3125, 0x2905, 0x3105, 0x3125, 0x3105, 0x3125, 0x3125, 0x2905,
-  0x3125, 0x3145, 0x3125, 0x3125, 0x3166, 0x3166, 0x3145, 0x3145,
-  0x3145, 0x3145, 0x3966, 0x3145, 0x3166, 0x3967, 0x3146, 0x3146,
-  0x3166, 0x3986, 0x3166, 0x3145, 0x3146, 0x3145, 0x3145, 0x3125,
-  0x3125, 0x3146, 0x3125, 0x2925, 0x3146, 0x2925, 0x2925, 0x3125,
-  0x3146, 0x3146, 0x3125, 0x3146, 0x3146, 0x3146, 0x3146, 0x3146,
-  0x3146, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3987, 0x39a7,
-  0x39a7, 0x39a7, 0x41e8, 0x3987, 0x3987, 0x3987, 0x3986, 0x3986,
-  0x3986, 0x3986, 0x3166, 0x3987, 0x39a7, 0x3987, 0x3186, 0x3186,
-  0x3166, 0x3166, 0x3187, 0x3186, 0x3186, 0x3186, 0x31a7, 0x39c7,
-  0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x31a7, 0x39c8, 0x39e8, 0x39c7,
-  0x39c7, 0x39c7, 0x39e7, 0x39c7, 0x39e7, 0x39e8, 0x39e8, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x4229, 0x4249, 0x4229, 0x4229,
-  0x4249, 0x4229, 0x4a6a, 0x4aab, 0x4aab, 0x530c, 0x532c, 0x532d,
-  0x530c, 0x4acb, 0x42ab, 0x428a, 0x428a, 0x428a, 0x426a, 0x426a,
-  0x426a, 0x4269, 0x4249, 0x3a49, 0x3a49, 0x426a, 0x426a, 0x4269,
-  0x4aaa, 0x428a, 0x428a, 0x4aab, 0x428a, 0x428b, 0x428b, 0x42ab,
-  0x428a, 0x42ab, 0x428b, 0x42ab, 0x42ab, 0x42cb, 0x42cb, 0x42cb,
-  0x532d, 0x4b2d, 0x4b0d, 0x532d, 0x532d, 0x63af, 0x536d, 0x534d,
-  0x534d, 0x534d, 0x534d, 0x536e, 0x536e, 0x534e, 0x534d, 0x536e,
-  0x538e, 0x63cf, 0x63f0, 0x5bcf, 0x63f0, 0x6410, 0x6430, 0x6c51,
-  0x6c71, 0x7492, 0x74b2, 0x7cf3, 0x7d13, 0x7d13, 0x8554, 0x8d75,
-  0x95b6, 0x95f6, 0x9e37, 0xa678, 0xaeb8, 0xb6f9, 0xbf3a, 0xcf9b,
-  0xd7db, 0xeffd, 0xffff, 0xf7fd, 0xe7dc, 0xdfbc, 0xc73b, 0xaefa,
-  0xc71a, 0xcef9, 0xa657, 0xe77c, 0xe75b, 0xef9c, 0xef7b, 0xf7bc,
-  0xdef9, 0xef5a, 0xd677, 0xd697, 0xdeb8, 0xf77a, 0xffbb, 0xe6f9,
-  0xbdd5, 0xb595, 0xe73a, 0xc616, 0xd698, 0x8d14, 0x538f, 0x8492,
-  0xc656, 0xdeb7, 0xbe16, 0x8cb1, 0x532d, 0x5b4e, 0x638e, 0x5b6d,
-  0x534d, 0x4b2c, 0x6bcf, 0x8cb2, 0x9cf2, 0x9cf2, 0xa512, 0x9cf2,
-  0x9cf2, 0x9cd2, 0x94d1, 0x3105, 0x3105, 0x28e4, 0x28e4, 0x3105,
-  0x3105, 0x2905, 0x3105, 0x3105, 0x2905, 0x3105, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3146, 0x3146, 0x3146, 0x3146, 0x3146,
-  0x3145, 0x3145, 0x3166, 0x3166, 0x3166, 0x39a7, 0x3987, 0x3146,
-  0x3166, 0x3166, 0x3987, 0x3986, 0x3166, 0x3145, 0x3145, 0x3125,
-  0x3125, 0x3125, 0x3145, 0x3125, 0x3125, 0x3145, 0x3125, 0x3125,
-  0x3145, 0x3145, 0x3125, 0x3125, 0x3145, 0x3166, 0x3146, 0x3166,
-  0x3166, 0x3166, 0x3186, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x41e8, 0x39a7, 0x3987, 0x3986, 0x39a7, 0x39a7, 0x3986, 0x3186,
-  0x39a7, 0x39a7, 0x3986, 0x3987, 0x39a7, 0x39a7, 0x3186, 0x3186,
-  0x3166, 0x3166, 0x3186, 0x3186, 0x3186, 0x3186, 0x3187, 0x39a7,
-  0x39c7, 0x39c7, 0x3186, 0x39c8, 0x39e8, 0x39c7, 0x39c8, 0x39e8,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x3a08,
-  0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x4229, 0x4229, 0x3a08, 0x3a08,
-  0x3a29, 0x4229, 0x426a, 0x426a, 0x4a8a, 0x4aab, 0x4acb, 0x4acb,
-  0x4acb, 0x428a, 0x428b, 0x428a, 0x4a8a, 0x426a, 0x428a, 0x4269,
-  0x426a, 0x4249, 0x3a49, 0x3a49, 0x4269, 0x426a, 0x426a, 0x428a,
-  0x428a, 0x4aab, 0x428a, 0x428a, 0x428a, 0x428b, 0x426a, 0x428b,
-  0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42cb, 0x4aec, 0x4aec,
-  0x4aec, 0x5b8e, 0x4b0c, 0x4b2d, 0x532d, 0x532d, 0x536e, 0x534d,
-  0x534d, 0x534d, 0x534d, 0x534e, 0x534e, 0x534e, 0x536e, 0x5b8f,
-  0x5b8f, 0x5baf, 0x5bcf, 0x5bcf, 0x6410, 0x6430, 0x6c31, 0x6c71,
-  0x7492, 0x74b2, 0x74d2, 0x7cf3, 0x8533, 0x8533, 0x8554, 0x8d95,
-  0x95d6, 0x9e17, 0x9e37, 0xa678, 0xaeb8, 0xb6f9, 0xc75a, 0xcf9b,
-  0xdfdc, 0xeffd, 0xfffe, 0xeffd, 0xe7dc, 0xd7bc, 0xbf1b, 0xaeda,
-  0xc73a, 0xbeb9, 0xae78, 0xef9c, 0xe75b, 0xef9c, 0xef9b, 0xf79b,
-  0xe719, 0xef5a, 0xce77, 0xd697, 0xdeb8, 0xf77a, 0xffbb, 0xe6f9,
-  0xc616, 0xc617, 0xe6f9, 0xce57, 0xc657, 0x7cb2, 0x5baf, 0x9513,
-  0xce77, 0xded8, 0xb5d6, 0x8491, 0x532d, 0x63af, 0x638e, 0x5b6e,
-  0x534d, 0x4b0c, 0x8451, 0x9cf2, 0x9d12, 0xa512, 0xa513, 0xa512,
-  0x9cf2, 0x9cf2, 0x9cd2, 0x28c4, 0x28e4, 0x28e4, 0x3125, 0x3105,
-  0x3125, 0x3105, 0x3125, 0x2905, 0x3105, 0x3125, 0x3125, 0x3145,
-  0x3145, 0x3125, 0x3145, 0x3166, 0x3146, 0x3166, 0x3145, 0x3986,
-  0x3145, 0x3145, 0x3186, 0x3186, 0x3186, 0x41c8, 0x3987, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3186, 0x3166, 0x3146, 0x3146, 0x3146,
-  0x3145, 0x3146, 0x3146, 0x3145, 0x3146, 0x3145, 0x3145, 0x3125,
-  0x3146, 0x3166, 0x3125, 0x3146, 0x3145, 0x3146, 0x3146, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x39a7, 0x39a7, 0x39a7, 0x3987, 0x39c7, 0x39c7, 0x39a7,
-  0x39a7, 0x39c7, 0x39a7, 0x3987, 0x3987, 0x39a7, 0x39c7, 0x3186,
-  0x3186, 0x3166, 0x3166, 0x3186, 0x3186, 0x39e8, 0x4229, 0x3186,
-  0x31a7, 0x31a7, 0x31a7, 0x4208, 0x39e8, 0x39c7, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x3a08,
-  0x4229, 0x4208, 0x3a08, 0x3a08, 0x4249, 0x4a6a, 0x3a08, 0x3a28,
-  0x4229, 0x4249, 0x4269, 0x4aaa, 0x4a8a, 0x428a, 0x52cc, 0x4aab,
-  0x428a, 0x4aab, 0x4aab, 0x428a, 0x4acb, 0x4aaa, 0x426a, 0x426a,
-  0x428a, 0x4269, 0x4249, 0x426a, 0x4249, 0x428a, 0x4aab, 0x4269,
-  0x428a, 0x428a, 0x428a, 0x428a, 0x428a, 0x42ab, 0x4aec, 0x428b,
-  0x428b, 0x428b, 0x42ab, 0x4aec, 0x42cb, 0x4acc, 0x4aec, 0x42ec,
-  0x4aec, 0x4aec, 0x4aec, 0x532d, 0x532d, 0x534d, 0x534d, 0x534d,
-  0x536e, 0x536e, 0x536e, 0x534d, 0x536e, 0x5b8e, 0x5b8e, 0x5b8e,
-  0x5baf, 0x5baf, 0x5bcf, 0x63f0, 0x6410, 0x6c31, 0x6c51, 0x6c71,
-  0x6c92, 0x74b2, 0x7cd3, 0x7cf3, 0x8513, 0x8534, 0x8d74, 0x8d95,
-  0x95f6, 0x9e37, 0xa657, 0xa698, 0xaed9, 0xbf19, 0xc75a, 0xd79b,
-  0xdfdc, 0xf7fd, 0xfffe, 0xeffd, 0xe7bc, 0xd79c, 0xb6fa, 0xaed9,
-  0xcf3a, 0xb699, 0xb6b8, 0xef9b, 0xef7b, 0xef9b, 0xf7bb, 0xef9b,
-  0xe73a, 0xe719, 0xce77, 0xce57, 0xded8, 0xef5a, 0xffbb, 0xe6f9,
-  0xb5b5, 0xce77, 0xded8, 0xd698, 0xb5f6, 0x6c30, 0x6c10, 0xa574,
-  0xc636, 0xdeb8, 0xb5d6, 0x7c71, 0x5b4d, 0x7c50, 0x532d, 0x5b6e,
-  0x5b4d, 0x5b8e, 0x8cd2, 0x9d13, 0xa512, 0xa533, 0xa533, 0xa533,
-  0xa512, 0xa4f2, 0x9cf2, 0x28e4, 0x28e4, 0x28e4, 0x28e4, 0x3105,
-  0x2905, 0x3105, 0x3125, 0x2905, 0x3125, 0x3125, 0x3125, 0x3125,
-  0x3166, 0x3145, 0x3146, 0x3146, 0x3145, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3145, 0x3166, 0x3187, 0x39a7, 0x39a7, 0x3166, 0x3187,
-  0x41e8, 0x39c7, 0x3166, 0x3986, 0x3166, 0x3146, 0x3166, 0x3146,
-  0x3166, 0x3146, 0x3145, 0x3145, 0x3166, 0x3987, 0x3145, 0x3145,
-  0x3146, 0x3146, 0x3146, 0x3146, 0x3166, 0x3146, 0x3166, 0x3166,
-  0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x3186,
-  0x3186, 0x39a7, 0x3186, 0x39a7, 0x39a7, 0x3186, 0x39a7, 0x39c7,
-  0x39a7, 0x39e7, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x3187,
-  0x3186, 0x3186, 0x3186, 0x3187, 0x3186, 0x39c7, 0x4228, 0x31a7,
-  0x31a7, 0x39a7, 0x39a7, 0x39c7, 0x39c8, 0x39c7, 0x39e8, 0x39c7,
-  0x39a7, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e7, 0x39e8, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x4229, 0x4208, 0x4209, 0x4229,
-  0x4229, 0x3a29, 0x3a29, 0x4a8a, 0x426a, 0x426a, 0x4a8a, 0x4a8a,
-  0x428a, 0x4aab, 0x4aaa, 0x4aab, 0x4aaa, 0x4acb, 0x428a, 0x4a8a,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x426a, 0x4249, 0x4aaa, 0x4aaa,
-  0x4aab, 0x428a, 0x428a, 0x428a, 0x42aa, 0x42aa, 0x42ab, 0x4aec,
-  0x42ab, 0x42cb, 0x4acb, 0x4aec, 0x42cb, 0x4aec, 0x4aec, 0x4aec,
-  0x4b0c, 0x4b0c, 0x4b2d, 0x534d, 0x532d, 0x534d, 0x534d, 0x5b6e,
-  0x534e, 0x536e, 0x536e, 0x5b6e, 0x5b8e, 0x5b8e, 0x5baf, 0x5baf,
-  0x63cf, 0x5bcf, 0x63ef, 0x6410, 0x6410, 0x6c51, 0x6c71, 0x7472,
-  0x7492, 0x74b2, 0x7cd2, 0x7cf3, 0x8513, 0x8554, 0x8d95, 0x95b5,
-  0x95f6, 0x9e37, 0xa677, 0xae98, 0xb6d9, 0xbf1a, 0xc77a, 0xd7bb,
-  0xdfdc, 0xf7fe, 0xfffe, 0xeffc, 0xe7bc, 0xd77c, 0xaefa, 0xa6d9,
-  0xc71a, 0xb698, 0xcf1a, 0xef7b, 0xe77a, 0xef7b, 0xf7bc, 0xef7b,
-  0xef5a, 0xe6f9, 0xdeb8, 0xce77, 0xe719, 0xef5a, 0xf79b, 0xd6b8,
-  0xb5b5, 0xe6f9, 0xded8, 0xdeb8, 0xadd6, 0x6c10, 0x8492, 0xb5b5,
-  0xb5d5, 0xd6b7, 0xad94, 0x7470, 0x638d, 0x740f, 0x5b6d, 0x5b8e,
-  0x534d, 0x5b4d, 0x6bef, 0x94f2, 0xa533, 0xad53, 0xad33, 0xad33,
-  0xa513, 0xa512, 0xa4f2, 0x28e4, 0x28e4, 0x28e4, 0x2904, 0x2905,
-  0x3125, 0x3105, 0x3125, 0x3125, 0x3145, 0x3125, 0x3166, 0x3145,
-  0x3145, 0x3166, 0x3986, 0x3166, 0x3166, 0x3166, 0x3166, 0x3987,
-  0x3166, 0x3186, 0x3186, 0x3187, 0x39a7, 0x39a7, 0x39a7, 0x39c7,
-  0x39c7, 0x39a7, 0x3166, 0x39a7, 0x3186, 0x3166, 0x3166, 0x3145,
-  0x3146, 0x3146, 0x3166, 0x3146, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3146, 0x3166, 0x3166, 0x3987, 0x3986, 0x39a7,
-  0x3987, 0x3166, 0x3166, 0x3186, 0x3186, 0x39a7, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x39c7,
-  0x39c7, 0x39c7, 0x39a7, 0x39a7, 0x39a7, 0x39c7, 0x39c8, 0x39a7,
-  0x39a7, 0x39a7, 0x39a7, 0x31a7, 0x31a7, 0x39c7, 0x39a7, 0x39c7,
-  0x31a7, 0x39c7, 0x31a7, 0x39a7, 0x41e8, 0x4208, 0x39c7, 0x39c7,
-  0x39c7, 0x39e8, 0x39c7, 0x39c7, 0x39e8, 0x3a08, 0x39e7, 0x4208,
-  0x4229, 0x4229, 0x4229, 0x3a08, 0x3a08, 0x3a08, 0x4229, 0x3a08,
-  0x3a28, 0x4229, 0x4249, 0x426a, 0x4269, 0x426a, 0x4a8a, 0x426a,
-  0x4269, 0x428a, 0x4a8a, 0x52ec, 0x42aa, 0x52ec, 0x4aab, 0x4a8a,
-  0x4a8a, 0x4a8a, 0x426a, 0x4249, 0x4269, 0x428a, 0x428a, 0x428a,
-  0x426a, 0x428a, 0x428a, 0x530c, 0x6bcf, 0x42ab, 0x4aec, 0x4acb,
-  0x4acb, 0x4acc, 0x42cb, 0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x4b0c,
-  0x4aec, 0x4b0d, 0x532d, 0x4b2d, 0x532d, 0x532d, 0x534e, 0x534d,
-  0x534e, 0x536e, 0x536e, 0x5b8e, 0x5b8e, 0x5b8e, 0x5baf, 0x5bcf,
-  0x5bcf, 0x63cf, 0x6410, 0x6430, 0x6c31, 0x6c51, 0x6c51, 0x7472,
-  0x74b2, 0x74b2, 0x7cd2, 0x8513, 0x8534, 0x8554, 0x8d75, 0x95b6,
-  0x95d6, 0x9e37, 0xa678, 0xaeb8, 0xb6f9, 0xbf1a, 0xcf7b, 0xd7bb,
-  0xe7fc, 0xf7fe, 0xf7fd, 0xe7fc, 0xdfbc, 0xd77c, 0xaefa, 0xa6d9,
-  0xbefa, 0xae98, 0xdf5b, 0xe75a, 0xef7a, 0xef7b, 0xffdc, 0xef7a,
-  0xef7a, 0xded8, 0xded8, 0xd677, 0xef3a, 0xef5a, 0xf79a, 0xce36,
-  0xbdf5, 0xef3b, 0xded8, 0xded8, 0xa595, 0x6c10, 0x94d3, 0xb5b5,
-  0xb5d4, 0xd6d8, 0xa594, 0x7470, 0x7c30, 0x63ae, 0x638e, 0x5b6d,
-  0x534d, 0x532d, 0x6bee, 0x9d13, 0xad53, 0xad54, 0xad53, 0xad33,
-  0xad33, 0xad13, 0xa512, 0x28e4, 0x28e4, 0x28e4, 0x2904, 0x2905,
-  0x3125, 0x2925, 0x2905, 0x3125, 0x3125, 0x3146, 0x3126, 0x3966,
-  0x3146, 0x3166, 0x3186, 0x3166, 0x3166, 0x3187, 0x3187, 0x4a49,
-  0x39c7, 0x3166, 0x3186, 0x39a7, 0x39c7, 0x39c7, 0x41e8, 0x41e8,
-  0x41e8, 0x39a7, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146,
-  0x3166, 0x3166, 0x3986, 0x3146, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3986, 0x39a7, 0x3186, 0x39c7, 0x3186, 0x39c7, 0x39a7, 0x39a7,
-  0x39a7, 0x39a7, 0x39a7, 0x3187, 0x39a7, 0x39a7, 0x3186, 0x3186,
-  0x3187, 0x39a7, 0x3187, 0x39a7, 0x39a7, 0x39c7, 0x39e8, 0x39c7,
-  0x39c7, 0x39a7, 0x39a7, 0x39c7, 0x39a7, 0x39a7, 0x31a7, 0x4208,
-  0x4208, 0x3187, 0x3187, 0x31a7, 0x39a7, 0x39c7, 0x39c7, 0x39c7,
-  0x39a7, 0x39a7, 0x39a7, 0x39c7, 0x39c8, 0x39e8, 0x39e8, 0x31c7,
-  0x39c7, 0x39e7, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x4209,
-  0x4229, 0x4208, 0x3a08, 0x3a08, 0x3a08, 0x4229, 0x3a28, 0x3a08,
-  0x3a29, 0x4229, 0x4249, 0x4269, 0x4249, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x426a, 0x428a, 0x4aab, 0x52ec, 0x530c, 0x4aab, 0x426a,
-  0x4aaa, 0x4a8a, 0x4a8a, 0x426a, 0x428a, 0x428a, 0x428a, 0x428a,
-  0x426a, 0x428a, 0x426a, 0x532d, 0x638e, 0x4acb, 0x4acb, 0x42ab,
-  0x4acc, 0x4aec, 0x42cb, 0x4b0c, 0x4b0c, 0x4aec, 0x4aec, 0x42cc,
-  0x4aec, 0x4b2d, 0x532d, 0x534d, 0x536d, 0x536e, 0x5b6e, 0x536e,
-  0x5b8e, 0x63cf, 0x5baf, 0x5b8e, 0x5b8e, 0x5baf, 0x5baf, 0x63cf,
-  0x6410, 0x63f0, 0x6410, 0x6c31, 0x6c51, 0x6c51, 0x6c71, 0x6c71,
-  0x7492, 0x74b2, 0x7cd3, 0x8513, 0x8534, 0x8d54, 0x8d95, 0x95b6,
-  0x9df6, 0x9e37, 0xa678, 0xaeb8, 0xb6f9, 0xbf3a, 0xcf7b, 0xd7bb,
-  0xe7fc, 0xfffe, 0xf7fd, 0xe7dc, 0xdfbc, 0xcf5b, 0xaeda, 0xaeda,
-  0xbf1a, 0xaed9, 0xe77b, 0xef5a, 0xef7b, 0xef9b, 0xffdc, 0xef5a,
-  0xe739, 0xd697, 0xded8, 0xd677, 0xef5a, 0xef5a, 0xf77a, 0xce57,
-  0xc616, 0xef5a, 0xd697, 0xd677, 0x9d54, 0x7431, 0xa554, 0xb5d5,
-  0xc636, 0xce77, 0x9513, 0x63ef, 0x8491, 0x8491, 0x5b8d, 0x4b0d,
-  0x532d, 0x636d, 0x9491, 0xad53, 0xb574, 0xb574, 0xad53, 0xad53,
-  0xad53, 0xad32, 0xa533, 0x28e4, 0x28e4, 0x28e4, 0x28e4, 0x2904,
-  0x2904, 0x2925, 0x2925, 0x3125, 0x3126, 0x3166, 0x39a7, 0x3146,
-  0x3166, 0x3187, 0x3186, 0x3987, 0x3186, 0x3187, 0x3187, 0x3187,
-  0x3187, 0x3166, 0x31a7, 0x31a7, 0x3187, 0x39c7, 0x39a7, 0x39a7,
-  0x41e8, 0x39a7, 0x3186, 0x3186, 0x3166, 0x3166, 0x39a7, 0x4a29,
-  0x3166, 0x3166, 0x3166, 0x3986, 0x3186, 0x39a7, 0x39c7, 0x39a7,
-  0x39a7, 0x41c7, 0x39c7, 0x3986, 0x3186, 0x39a7, 0x39a7, 0x39a7,
-  0x39c7, 0x3187, 0x39a7, 0x39a7, 0x39a7, 0x3987, 0x3186, 0x39a7,
-  0x39a7, 0x3187, 0x39a7, 0x39a7, 0x39c7, 0x39c7, 0x39c7, 0x39e7,
-  0x39e7, 0x39c7, 0x39a7, 0x39c8, 0x39a7, 0x39a7, 0x31a7, 0x39a7,
-  0x31a7, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x41e8, 0x41e8, 0x39c8,
-  0x31a7, 0x39a7, 0x31a7, 0x39c8, 0x39a7, 0x39c7, 0x39e8, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c8, 0x4208, 0x3a08, 0x39e8, 0x39e8,
-  0x4208, 0x4209, 0x3a08, 0x4229, 0x4229, 0x3a28, 0x3a28, 0x4229,
-  0x3a09, 0x4229, 0x4249, 0x4249, 0x4249, 0x4a8a, 0x52ec, 0x426a,
-  0x426a, 0x428a, 0x428a, 0x52ec, 0x7c51, 0x52ec, 0x4aab, 0x426a,
-  0x428a, 0x426a, 0x4aab, 0x428a, 0x428a, 0x426a, 0x428a, 0x426a,
-  0x426a, 0x428a, 0x428a, 0x42ab, 0x4acb, 0x4acb, 0x4acb, 0x530c,
-  0x4aec, 0x4aec, 0x4aec, 0x4b0c, 0x4b0c, 0x4acc, 0x4aec, 0x4aec,
-  0x532d, 0x4b0d, 0x536e, 0x534d, 0x534d, 0x536e, 0x536e, 0x5b8e,
-  0x5baf, 0x63cf, 0x5baf, 0x5b8e, 0x5b8f, 0x5baf, 0x5baf, 0x63cf,
-  0x6c31, 0x6c30, 0x6c10, 0x6c30, 0x6c51, 0x6c71, 0x7492, 0x74b2,
-  0x74b2, 0x7cd2, 0x7cf3, 0x8513, 0x8534, 0x8d54, 0x8d95, 0x95d6,
-  0x9e17, 0xa637, 0xa698, 0xaed8, 0xb719, 0xbf3a, 0xcf7b, 0xdfdb,
-  0xeffc, 0xfffe, 0xf7fd, 0xe7dc, 0xdfbb, 0xbf3a, 0xa6fa, 0xaed9,
-  0xb6f9, 0xaeb8, 0xe77b, 0xef7b, 0xef7b, 0xf79b, 0xf7bc, 0xef7a,
-  0xef39, 0xd697, 0xded8, 0xd677, 0xef3a, 0xef5a, 0xef3a, 0xc5f6,
-  0xd697, 0xef5a, 0xdeb7, 0xc636, 0x9513, 0x7430, 0xb5f5, 0xb5d5,
-  0xce76, 0xbe16, 0x8492, 0x7410, 0x8450, 0x7c30, 0x5b4d, 0x4b2d,
-  0x4b2d, 0x73ef, 0xad33, 0xb553, 0xb574, 0xb574, 0xb574, 0xb553,
-  0xad53, 0xad33, 0xad33, 0x28e4, 0x28e4, 0x28e4, 0x2904, 0x2905,
-  0x2904, 0x2905, 0x3125, 0x3145, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3987, 0x3987, 0x3187, 0x39a7, 0x3187, 0x3187, 0x41e8,
-  0x5acc, 0x4229, 0x3187, 0x39c7, 0x4209, 0x4229, 0x630d, 0x4a6a,
-  0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x3186, 0x3186, 0x39a7, 0x41e8,
-  0x3166, 0x39a7, 0x3166, 0x3186, 0x4208, 0x39a7, 0x3186, 0x3186,
-  0x3186, 0x39a7, 0x39c7, 0x3987, 0x3987, 0x39a7, 0x39a7, 0x3186,
-  0x3186, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x3187, 0x3186, 0x39a7,
-  0x31a7, 0x39a7, 0x3187, 0x39c7, 0x39e8, 0x39c7, 0x4a49, 0x4208,
-  0x39e7, 0x39c7, 0x39c7, 0x39a7, 0x31a7, 0x39c7, 0x39c7, 0x39c8,
-  0x39c8, 0x39a7, 0x4209, 0x39c8, 0x39c8, 0x39c7, 0x39c7, 0x39a7,
-  0x39c7, 0x39c7, 0x31a7, 0x39a7, 0x39c7, 0x39c7, 0x39c7, 0x39e8,
-  0x39c7, 0x39c7, 0x39e8, 0x4208, 0x4208, 0x39e8, 0x3a08, 0x4229,
-  0x4209, 0x4208, 0x4229, 0x4229, 0x4229, 0x4a6a, 0x4229, 0x4229,
-  0x3a29, 0x3a29, 0x4249, 0x4249, 0x426a, 0x52cb, 0x52ec, 0x4a8a,
-  0x4aab, 0x426a, 0x426a, 0x4aaa, 0x428a, 0x4acb, 0x4a8a, 0x426a,
-  0x426a, 0x426a, 0x426a, 0x4a8a, 0x426a, 0x428a, 0x42aa, 0x426a,
-  0x4aab, 0x428a, 0x42aa, 0x42ab, 0x42ab, 0x530c, 0x532d, 0x4acb,
-  0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x4b0d, 0x4b0c,
-  0x4b0c, 0x534d, 0x534d, 0x534d, 0x536e, 0x5b8e, 0x5b8e, 0x5b8e,
-  0x5b8e, 0x5b8e, 0x5baf, 0x5b8f, 0x5baf, 0x5b8f, 0x5bcf, 0x63f0,
-  0x7492, 0x6c51, 0x6c51, 0x6c31, 0x6c51, 0x6c71, 0x7492, 0x74b2,
-  0x74b2, 0x7cd2, 0x7cf3, 0x8534, 0x8d54, 0x8d54, 0x8d75, 0x95d6,
-  0x9e17, 0xa657, 0xa698, 0xaed8, 0xb6f9, 0xc73a, 0xcf9b, 0xdfdb,
-  0xeffc, 0xfffe, 0xeffd, 0xe7dc, 0xd7bb, 0xbf5b, 0xa6fa, 0xaeda,
-  0xbf1a, 0xb6b9, 0xef7b, 0xef5a, 0xef7b, 0xf79b, 0xf7bb, 0xef7a,
-  0xe739, 0xe6f9, 0xded8, 0xd697, 0xef5a, 0xf77b, 0xdef8, 0xc5f6,
-  0xded9, 0xe739, 0xdef8, 0xbe16, 0x9513, 0x8491, 0xbe36, 0xadb4,
-  0xc636, 0xb5b5, 0x7430, 0x8cb2, 0x8c91, 0x7c31, 0x4b0c, 0x4b4d,
-  0x532d, 0x73ef, 0xad53, 0xb574, 0xb574, 0xb574, 0xb574, 0xb574,
-  0xad53, 0xad33, 0xad33, 0x2905, 0x28e4, 0x2904, 0x28e4, 0x2904,
-  0x2905, 0x3105, 0x3105, 0x3125, 0x3125, 0x3145, 0x3166, 0x3187,
-  0x3187, 0x39a7, 0x3167, 0x39a7, 0x39c8, 0x31a7, 0x39a7, 0x3187,
-  0x5aec, 0x4a6a, 0x3187, 0x39e8, 0x4a4a, 0x94f4, 0x6b8f, 0x4a8a,
-  0x39a7, 0x39a7, 0x3186, 0x3186, 0x3186, 0x3186, 0x3166, 0x3987,
-  0x3166, 0x3166, 0x3146, 0x3166, 0x39c7, 0x3186, 0x3145, 0x3166,
-  0x3166, 0x3186, 0x3166, 0x3186, 0x3186, 0x3986, 0x39a7, 0x39a7,
-  0x39a7, 0x3186, 0x3186, 0x39a7, 0x31a7, 0x39c7, 0x3186, 0x39c7,
-  0x39a7, 0x39c7, 0x39a7, 0x39c7, 0x39c7, 0x39c8, 0x4229, 0x39e8,
-  0x4229, 0x39e7, 0x39a7, 0x39c7, 0x31c7, 0x39c7, 0x39a7, 0x31a7,
-  0x39a7, 0x39c7, 0x39a7, 0x31c7, 0x39c7, 0x31a7, 0x39a7, 0x31a7,
-  0x39c7, 0x31c7, 0x31c7, 0x31a7, 0x39c7, 0x39c7, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39e8, 0x39e7, 0x39e8, 0x39e8, 0x3a08, 0x4208,
-  0x3a08, 0x3a08, 0x4208, 0x4229, 0x4249, 0x4a6a, 0x4229, 0x3a29,
-  0x3a29, 0x4229, 0x4229, 0x426a, 0x428a, 0x428a, 0x426a, 0x426a,
-  0x428a, 0x426a, 0x428a, 0x428a, 0x4aaa, 0x4aab, 0x4aaa, 0x4a8a,
-  0x4aaa, 0x428a, 0x426a, 0x428a, 0x428a, 0x428a, 0x428a, 0x42ab,
-  0x42ab, 0x4aab, 0x428a, 0x4acb, 0x4acb, 0x530c, 0x4b0c, 0x4b0c,
-  0x4aec, 0x4aec, 0x4aec, 0x532d, 0x4b0c, 0x4b0d, 0x532d, 0x4b0c,
-  0x4b2d, 0x532d, 0x534d, 0x534d, 0x5b8e, 0x5b6e, 0x5b8e, 0x5b8e,
-  0x5baf, 0x5baf, 0x5baf, 0x5baf, 0x63cf, 0x5baf, 0x5bcf, 0x63cf,
-  0x63ef, 0x6410, 0x6c31, 0x6c51, 0x6c51, 0x7492, 0x6c91, 0x74b2,
-  0x7cd2, 0x7cf3, 0x7cf3, 0x8534, 0x8d54, 0x8d54, 0x9595, 0x95d6,
-  0x9e17, 0xa657, 0xae98, 0xb6d9, 0xbf19, 0xc75a, 0xcf9b, 0xdfdb,
-  0xf7fd, 0xfffd, 0xeffc, 0xe7dc, 0xd79c, 0xb73b, 0xa6fa, 0xb6fa,
-  0xc71a, 0xbef9, 0xef9b, 0xef5a, 0xef9b, 0xf79b, 0xffbc, 0xef5a,
-  0xe6f8, 0xe739, 0xdef8, 0xdeb7, 0xef7a, 0xef7a, 0xce56, 0xbdd5,
-  0xef3a, 0xe6f9, 0xded8, 0xad94, 0x9513, 0x9512, 0xc636, 0xb5b5,
-  0xc636, 0xb5b5, 0x7450, 0x8491, 0x8cd2, 0x5b8e, 0x532d, 0x4b4d,
-  0x532d, 0x7c30, 0xb574, 0xbd74, 0xb574, 0xbd74, 0xbd74, 0xb574,
-  0xb553, 0xad53, 0xad33, 0x3125, 0x3146, 0x2904, 0x2905, 0x2905,
-  0x2905, 0x3125, 0x3125, 0x2905, 0x3125, 0x3146, 0x3146, 0x3146,
-  0x4a2a, 0x73f1, 0x634d, 0x2946, 0x39a7, 0x39c8, 0x39c8, 0x39c8,
-  0x39a7, 0x3987, 0x41e9, 0x41e8, 0x4229, 0x5b2d, 0x31a7, 0x41e8,
-  0x39c7, 0x39c7, 0x39c7, 0x3186, 0x39a7, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3166, 0x3166,
-  0x3166, 0x3186, 0x3986, 0x3166, 0x3987, 0x3987, 0x3186, 0x39a7,
-  0x3186, 0x39a7, 0x39a7, 0x39a7, 0x31a7, 0x31a7, 0x3186, 0x31a7,
-  0x39a7, 0x39a7, 0x39c8, 0x39c7, 0x4229, 0x39e8, 0x4229, 0x39e8,
-  0x39e8, 0x4208, 0x39c7, 0x39c7, 0x31c7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x39a7, 0x39a7, 0x31a7, 0x31a7, 0x31a7, 0x39c7, 0x39a7,
-  0x39c7, 0x31c7, 0x31c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x31c7,
-  0x31c7, 0x39c7, 0x39c7, 0x39e7, 0x3a08, 0x3a08, 0x3a08, 0x39e8,
-  0x3a08, 0x3a08, 0x4208, 0x4229, 0x4249, 0x4249, 0x4229, 0x4229,
-  0x4269, 0x4249, 0x4249, 0x4249, 0x4249, 0x4269, 0x426a, 0x52ec,
-  0x4249, 0x426a, 0x428a, 0x428a, 0x4aab, 0x4aaa, 0x4aaa, 0x4a8a,
-  0x4a8a, 0x426a, 0x426a, 0x4a8a, 0x428a, 0x428a, 0x4aab, 0x4aab,
-  0x4acb, 0x4aab, 0x4aab, 0x4acb, 0x4aec, 0x530c, 0x4b0c, 0x4aec,
-  0x530d, 0x4b0c, 0x4aec, 0x532d, 0x4aec, 0x4b0c, 0x4aec, 0x4b0c,
-  0x532d, 0x534d, 0x4b2d, 0x536e, 0x5b8e, 0x5b8e, 0x5b8e, 0x5b8e,
-  0x5baf, 0x5baf, 0x5baf, 0x5bcf, 0x5b8f, 0x5baf, 0x63cf, 0x63f0,
-  0x63f0, 0x6410, 0x6c30, 0x6c31, 0x6c51, 0x6c71, 0x7492, 0x74b2,
-  0x7cd2, 0x7cf3, 0x8513, 0x8533, 0x8d54, 0x9575, 0x9595, 0x95f6,
-  0x9e17, 0xa657, 0xaeb8, 0xb6f9, 0xbf3a, 0xc75b, 0xd79b, 0xdfdc,
-  0xf7fd, 0xf7fd, 0xeffc, 0xe7dc, 0xd77b, 0xb71b, 0xa6d9, 0xb6fa,
-  0xc71a, 0xc719, 0xef9b, 0xef7b, 0xf79b, 0xf79b, 0xf7bb, 0xef7a,
-  0xdef8, 0xef39, 0xded8, 0xded8, 0xf79b, 0xe73a, 0xbdd4, 0xbdd5,
-  0xef5b, 0xdef9, 0xd677, 0x9d33, 0x8cf3, 0xadd5, 0xbe36, 0xbe16,
-  0xbdf6, 0xa554, 0x7c71, 0x6c10, 0x84b2, 0x534d, 0x534d, 0x534d,
-  0x532d, 0x8cb1, 0xbd94, 0xbd74, 0xbd94, 0xbd94, 0xbd94, 0xb574,
-  0xb553, 0xad53, 0xad53, 0x3146, 0x3986, 0x2925, 0x2905, 0x2905,
-  0x2905, 0x2905, 0x2925, 0x2925, 0x3125, 0x3125, 0x3146, 0x3166,
-  0x3987, 0x632e, 0x8c92, 0x2946, 0x39a8, 0x39c8, 0x39c8, 0x39e8,
-  0x39c7, 0x4209, 0x4229, 0x39c8, 0x4209, 0x4a6a, 0x39c7, 0x4a49,
-  0x4209, 0x4229, 0x4208, 0x3186, 0x3186, 0x3166, 0x3145, 0x3166,
-  0x3166, 0x3166, 0x3186, 0x3186, 0x3166, 0x3166, 0x3186, 0x3166,
-  0x3166, 0x3166, 0x3186, 0x3186, 0x3186, 0x3166, 0x3186, 0x3186,
-  0x3186, 0x31a7, 0x39a7, 0x31a7, 0x39a7, 0x39a7, 0x39c7, 0x39c7,
-  0x39c8, 0x39c8, 0x39c8, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39c8, 0x39c7, 0x39c8, 0x39c7, 0x31a7, 0x3187, 0x31a7,
-  0x39c7, 0x3187, 0x31a7, 0x31c7, 0x31c7, 0x31a7, 0x31a7, 0x31a7,
-  0x39c7, 0x31c7, 0x31a7, 0x39c7, 0x31c7, 0x39e8, 0x39e8, 0x31c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x3a08,
-  0x3a08, 0x3a28, 0x4229, 0x4229, 0x4a69, 0x4249, 0x4229, 0x4249,
-  0x4229, 0x4249, 0x4249, 0x426a, 0x4249, 0x4249, 0x426a, 0x426a,
-  0x426a, 0x4a8a, 0x428a, 0x428a, 0x428a, 0x426a, 0x4acb, 0x4aaa,
-  0x428a, 0x428a, 0x426a, 0x428a, 0x428b, 0x428a, 0x4acb, 0x4acb,
-  0x52ec, 0x530c, 0x4aec, 0x4acb, 0x4aec, 0x532d, 0x4b0c, 0x4aec,
-  0x532d, 0x4b0c, 0x4b0c, 0x4aec, 0x4b0c, 0x4b0c, 0x4b2d, 0x4b0c,
-  0x4b0d, 0x534d, 0x532d, 0x5b6e, 0x5b8e, 0x5b8e, 0x63cf, 0x63af,
-  0x63f0, 0x63cf, 0x5baf, 0x5b8e, 0x5baf, 0x63f0, 0x63cf, 0x63f0,
-  0x63ef, 0x6c31, 0x6c51, 0x6c31, 0x6c71, 0x6c71, 0x7492, 0x7cd2,
-  0x7cd3, 0x7cf3, 0x8513, 0x8554, 0x8d54, 0x9575, 0x95b6, 0x9df6,
-  0xa637, 0xae78, 0xb6b8, 0xb6f9, 0xbf3a, 0xc75a, 0xd79b, 0xdfdc,
-  0xf7fe, 0xf7fd, 0xefdc, 0xe7dc, 0xcf7b, 0xb71b, 0xa6da, 0xbefa,
-  0xbef9, 0xd71a, 0xf79c, 0xef7b, 0xf79b, 0xf79b, 0xf79b, 0xef5a,
-  0xded8, 0xef3a, 0xded8, 0xd6b7, 0xf79b, 0xded9, 0xc5f5, 0xce56,
-  0xef5a, 0xe6f9, 0xce57, 0xad74, 0x8cd2, 0xc637, 0xbe16, 0xce57,
-  0xc657, 0x8491, 0x6c30, 0x6bef, 0x63ef, 0x534d, 0x534d, 0x534d,
-  0x5b6e, 0xa533, 0xc5b4, 0xc594, 0xbd94, 0xc594, 0xc594, 0xbd74,
-  0xb553, 0xb553, 0xb553, 0x3126, 0x2905, 0x2905, 0x2905, 0x2905,
-  0x2905, 0x2905, 0x3126, 0x3125, 0x3126, 0x3146, 0x3146, 0x3146,
-  0x3187, 0x3a09, 0x424a, 0x39a7, 0x4209, 0x4a4a, 0x39c8, 0x4229,
-  0x39e8, 0x4249, 0x39e8, 0x39e8, 0x39e8, 0x632d, 0x630c, 0x4229,
-  0x4229, 0x39e8, 0x3186, 0x3186, 0x3186, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3186, 0x3166, 0x3166, 0x3186, 0x3166, 0x3166,
-  0x3986, 0x3166, 0x3166, 0x3186, 0x3986, 0x3166, 0x39a7, 0x3186,
-  0x39a7, 0x3187, 0x31a7, 0x31a7, 0x39c7, 0x39a7, 0x31c7, 0x31a7,
-  0x31a7, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x4229, 0x4a49,
-  0x39e8, 0x39c8, 0x39e8, 0x39c7, 0x4208, 0x39e8, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39c8, 0x31a7, 0x31a7, 0x31a7,
-  0x39c7, 0x31c7, 0x31a7, 0x31c7, 0x39c7, 0x39e8, 0x39e8, 0x39c8,
-  0x39e8, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x3a28, 0x4229, 0x3a08,
-  0x3a08, 0x4249, 0x4229, 0x4249, 0x4a6a, 0x4229, 0x4229, 0x4a6a,
-  0x4229, 0x4249, 0x426a, 0x4a8a, 0x4aab, 0x4249, 0x426a, 0x426a,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x428a, 0x4aaa, 0x428a, 0x426a,
-  0x4aaa, 0x426a, 0x426a, 0x428a, 0x428a, 0x4aab, 0x4aab, 0x42ab,
-  0x4aab, 0x4acb, 0x4aec, 0x4acb, 0x4acb, 0x4aec, 0x4b0c, 0x4aec,
-  0x4b0c, 0x4b0c, 0x4b0d, 0x4aec, 0x4b0c, 0x4aec, 0x4b0d, 0x4b0c,
-  0x4b0c, 0x534d, 0x5b6e, 0x5b8e, 0x5baf, 0x5b8e, 0x5baf, 0x63af,
-  0x63af, 0x63af, 0x63cf, 0x5bcf, 0x5baf, 0x5bcf, 0x63cf, 0x63cf,
-  0x6410, 0x6c31, 0x6c51, 0x6c51, 0x6c71, 0x6c91, 0x7492, 0x7cb2,
-  0x7cf3, 0x8513, 0x8533, 0x8d54, 0x8d74, 0x9595, 0x95b6, 0x9df6,
-  0xa657, 0xae98, 0xb6b9, 0xbef9, 0xc73a, 0xcf5b, 0xd7bb, 0xe7dc,
-  0xffde, 0xf7dd, 0xefdc, 0xe7dc, 0xc77b, 0xb71b, 0xa6da, 0xc71a,
-  0xbed9, 0xd73a, 0xf79c, 0xef7b, 0xf7bb, 0xf79b, 0xf79a, 0xef5a,
-  0xde97, 0xef5a, 0xdeb8, 0xd6b7, 0xffbb, 0xd698, 0xce36, 0xded8,
-  0xe719, 0xdeb8, 0xce57, 0xb5b5, 0x94d2, 0xc657, 0xb5d6, 0xd698,
-  0xce58, 0x7c91, 0x6c10, 0x94f3, 0x5baf, 0x534e, 0x536e, 0x5b6e,
-  0x5b6e, 0x9cd2, 0xc5b5, 0xc594, 0xc594, 0xc594, 0xc594, 0xc594,
-  0xbd74, 0xb574, 0xb573, 0x4a2a, 0x4a4a, 0x2926, 0x2925, 0x2925,
-  0x3125, 0x3125, 0x2925, 0x3125, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x3187, 0x4a8a, 0x39c8, 0x39c8, 0x39a7, 0x41e8, 0x4209,
-  0x39e8, 0x4208, 0x3a08, 0x4229, 0x4208, 0x4229, 0x4249, 0x4229,
-  0x4249, 0x39e8, 0x3186, 0x3187, 0x3186, 0x3186, 0x3186, 0x3146,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x3987, 0x3186, 0x3166, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x39a7, 0x3187, 0x3187, 0x3187, 0x3187, 0x31a7, 0x39c8, 0x39c8,
-  0x39e8, 0x39c7, 0x39c8, 0x39e8, 0x4229, 0x39e8, 0x52ab, 0x52ab,
-  0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x4209, 0x4208, 0x31a7, 0x31c7,
-  0x31a7, 0x31a7, 0x31c7, 0x39c7, 0x39c7, 0x39c7, 0x31a7, 0x39c7,
-  0x39c8, 0x31c7, 0x39c7, 0x39c7, 0x39c8, 0x31c7, 0x39e8, 0x4208,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a29, 0x4229,
-  0x3a29, 0x4249, 0x4229, 0x4249, 0x4a6a, 0x4229, 0x4249, 0x4a8a,
-  0x426a, 0x4249, 0x426a, 0x4249, 0x426a, 0x4249, 0x4249, 0x4269,
-  0x4269, 0x426a, 0x426a, 0x428a, 0x426a, 0x428a, 0x428a, 0x428a,
-  0x428a, 0x428a, 0x428a, 0x4aab, 0x4aab, 0x4aab, 0x4acb, 0x42ab,
-  0x4aec, 0x4acb, 0x4aec, 0x4aec, 0x4aec, 0x530c, 0x532d, 0x5b6e,
-  0x4aec, 0x532d, 0x532d, 0x4b0c, 0x532d, 0x4b0c, 0x4b0d, 0x532d,
-  0x534d, 0x534d, 0x5b6e, 0x5baf, 0x5b8e, 0x5b8e, 0x63af, 0x63f0,
-  0x7451, 0x5baf, 0x5baf, 0x5bcf, 0x63cf, 0x63f0, 0x63f0, 0x63ef,
-  0x6410, 0x6c30, 0x6c31, 0x6c51, 0x6c71, 0x7492, 0x74b2, 0x7cd2,
-  0x7cf3, 0x7cf3, 0x8533, 0x8d54, 0x8d75, 0x9595, 0x9dd6, 0x9e17,
-  0xa657, 0xae98, 0xb6d9, 0xbf19, 0xc73a, 0xcf7b, 0xd79b, 0xe7dc,
-  0xffde, 0xf7dd, 0xeffc, 0xe7bc, 0xc77b, 0xaefa, 0xa6d9, 0xc73a,
-  0xbed9, 0xdf5a, 0xf79c, 0xf79b, 0xf7bb, 0xf7bb, 0xef7a, 0xe739,
-  0xde97, 0xef3a, 0xdeb8, 0xdef8, 0xf7bb, 0xd698, 0xc636, 0xdef8,
-  0xe719, 0xd677, 0xc636, 0xb5b5, 0xa554, 0xce57, 0xb5b5, 0xd6b8,
-  0xbdf6, 0x7451, 0x7c50, 0xadb5, 0x536e, 0x536e, 0x538e, 0x5bae,
-  0x534d, 0x6bef, 0xb594, 0xc5b4, 0xc5b4, 0xc5b4, 0xc5b4, 0xc594,
-  0xbd73, 0xbd73, 0xb574, 0x4a29, 0x4a6a, 0x39c8, 0x2925, 0x2925,
-  0x2925, 0x3126, 0x3146, 0x3166, 0x3146, 0x2946, 0x3166, 0x3166,
-  0x3187, 0x39a7, 0x3186, 0x39a8, 0x39a7, 0x39c8, 0x4209, 0x41e8,
-  0x4209, 0x4229, 0x4208, 0x39e8, 0x4209, 0x4208, 0x39e8, 0x39e8,
-  0x52ab, 0x5acc, 0x2966, 0x3186, 0x3186, 0x3166, 0x3166, 0x3186,
-  0x3166, 0x3166, 0x3186, 0x3186, 0x3166, 0x3166, 0x3165, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3187, 0x3987, 0x3187, 0x31a7,
-  0x31a7, 0x31a7, 0x39a7, 0x39c7, 0x31a7, 0x31a7, 0x31a7, 0x39c7,
-  0x39c8, 0x3a08, 0x3a08, 0x4229, 0x4229, 0x4229, 0x4a8a, 0x3a08,
-  0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39c8,
-  0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x31c7, 0x39e8, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a28,
-  0x4229, 0x3a29, 0x4229, 0x4269, 0x4a8a, 0x4229, 0x4249, 0x4229,
-  0x4249, 0x4a6a, 0x426a, 0x4249, 0x426a, 0x426a, 0x426a, 0x426a,
-  0x424a, 0x3a49, 0x426a, 0x426a, 0x428a, 0x4aaa, 0x428a, 0x428a,
-  0x428a, 0x428a, 0x4aab, 0x428b, 0x4aab, 0x4aab, 0x4acb, 0x52ec,
-  0x4acb, 0x4acb, 0x4aec, 0x530d, 0x4aec, 0x530d, 0x4b0c, 0x530d,
-  0x532d, 0x534d, 0x532d, 0x4aec, 0x532d, 0x532d, 0x534d, 0x5b4d,
-  0x5b6e, 0x5b6e, 0x536d, 0x5bae, 0x5b8e, 0x5bae, 0x63ef, 0x63ef,
-  0x63ef, 0x63cf, 0x5baf, 0x63f0, 0x63d0, 0x63f0, 0x63f0, 0x63f0,
-  0x6410, 0x6c51, 0x6c71, 0x6c71, 0x6c71, 0x74b2, 0x74b2, 0x7cd2,
-  0x7cf3, 0x8513, 0x8534, 0x8d54, 0x8d75, 0x95b5, 0x9dd6, 0x9e17,
-  0xa658, 0xae98, 0xb6d9, 0xbf19, 0xc73a, 0xcf7b, 0xd7bb, 0xe7dd,
-  0xfffe, 0xf7fd, 0xefdc, 0xdfbc, 0xc75b, 0xaefa, 0xaed9, 0xcf1a,
-  0xbed8, 0xe75a, 0xf7bb, 0xf7bb, 0xf79b, 0xf7bb, 0xef5a, 0xe6f8,
-  0xd697, 0xe719, 0xd697, 0xe739, 0xf79b, 0xd677, 0xc616, 0xded8,
-  0xef19, 0xce57, 0xc616, 0xad94, 0xb5b5, 0xc657, 0xbdd6, 0xe6d9,
-  0xa554, 0x6410, 0x8492, 0x9513, 0x534d, 0x536e, 0x536e, 0x538e,
-  0x536e, 0x73ef, 0xbd94, 0xcdd4, 0xc5b4, 0xc5b4, 0xc5b4, 0xc5b4,
-  0xc594, 0xbd74, 0xbd73, 0x3187, 0x3187, 0x3146, 0x3146, 0x3146,
-  0x3146, 0x3966, 0x3166, 0x3987, 0x3166, 0x3166, 0x3146, 0x3987,
-  0x41e8, 0x3187, 0x39c7, 0x39e8, 0x41e8, 0x39e8, 0x41e8, 0x39c8,
-  0x4209, 0x39c8, 0x4209, 0x4208, 0x4229, 0x4209, 0x39e8, 0x3a09,
-  0x52ab, 0x52cc, 0x2966, 0x3186, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x3166, 0x3186, 0x39a7, 0x3186, 0x31a7, 0x3187, 0x3187, 0x2966,
-  0x3186, 0x3186, 0x3186, 0x39a7, 0x31a7, 0x39a7, 0x39a7, 0x31a7,
-  0x39c7, 0x39c7, 0x31a7, 0x39c7, 0x39c7, 0x39e8, 0x39c8, 0x39c8,
-  0x39e8, 0x39e8, 0x3a08, 0x4208, 0x3a08, 0x3a08, 0x4a49, 0x3a08,
-  0x3a08, 0x3a08, 0x4208, 0x4208, 0x3a08, 0x39e8, 0x39c8, 0x39c8,
-  0x39c7, 0x39c7, 0x31c7, 0x39c7, 0x39e8, 0x39c7, 0x39c8, 0x39c8,
-  0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a08,
-  0x4229, 0x3a28, 0x4249, 0x4269, 0x4249, 0x4249, 0x4229, 0x4249,
-  0x4269, 0x4249, 0x4a8a, 0x4269, 0x426a, 0x426a, 0x4a8a, 0x424a,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x428a, 0x426a, 0x428a, 0x428a,
-  0x428a, 0x428a, 0x428b, 0x4aab, 0x4aab, 0x4aab, 0x4aab, 0x52ec,
-  0x4acb, 0x4aec, 0x4aec, 0x4aec, 0x530c, 0x530d, 0x532d, 0x534d,
-  0x534d, 0x5b6e, 0x530d, 0x532d, 0x532d, 0x532d, 0x5b4e, 0x5b4e,
-  0x5b8e, 0x5b8e, 0x63cf, 0x6c30, 0x63cf, 0x63af, 0x63cf, 0x63cf,
-  0x63f0, 0x63ef, 0x63f0, 0x63f0, 0x63f0, 0x6c31, 0x6410, 0x6410,
-  0x6410, 0x6c31, 0x6c51, 0x6c51, 0x6c71, 0x7492, 0x74b2, 0x7cf3,
-  0x8513, 0x8534, 0x8534, 0x8d54, 0x9595, 0x95b6, 0x9dd6, 0xa617,
-  0xa658, 0xae98, 0xb6d9, 0xbf19, 0xc75a, 0xcf7b, 0xd7bb, 0xeffd,
-  0xfffe, 0xeffd, 0xefdc, 0xdfbc, 0xc75b, 0xaefa, 0xb6d9, 0xcf1a,
-  0xcef9, 0xe77a, 0xf79b, 0xf79b, 0xf79b, 0xf7bb, 0xef5a, 0xe739,
-  0xd697, 0xe6f9, 0xdeb8, 0xef39, 0xf77b, 0xce57, 0xc615, 0xdeb8,
-  0xef39, 0xce56, 0xce57, 0xad74, 0xbdf6, 0xc636, 0xc636, 0xe719,
-  0x8cd2, 0x63d0, 0x6c10, 0x6bcf, 0x538e, 0x536e, 0x5b8e, 0x5bae,
-  0x5b6e, 0x8c71, 0xcdf5, 0xcdf5, 0xcdd5, 0xcdd5, 0xcdd4, 0xcdb4,
-  0xc594, 0xbd94, 0xbd73, 0x3186, 0x39a7, 0x3166, 0x3146, 0x3146,
-  0x3146, 0x3966, 0x3967, 0x5aab, 0x3987, 0x3166, 0x3166, 0x3166,
-  0x39a7, 0x39c8, 0x39c8, 0x31a7, 0x4a6a, 0x41e8, 0x39e8, 0x39e8,
-  0x39e8, 0x4209, 0x4209, 0x4229, 0x4208, 0x4229, 0x4a4a, 0x3a08,
-  0x4249, 0x4aab, 0x31c7, 0x3186, 0x3187, 0x3186, 0x3186, 0x3186,
-  0x3166, 0x39a7, 0x3187, 0x3166, 0x31a7, 0x39e8, 0x31a7, 0x2966,
-  0x3186, 0x3186, 0x3186, 0x31a7, 0x31a7, 0x39c8, 0x39e8, 0x39e8,
-  0x39e8, 0x39c7, 0x39c8, 0x31a7, 0x39c7, 0x39c8, 0x39e8, 0x39e8,
-  0x4249, 0x3a08, 0x4a69, 0x4249, 0x4249, 0x4229, 0x4249, 0x39e8,
-  0x3a08, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x4208,
-  0x39e8, 0x39c8, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e7, 0x39c7,
-  0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x4229, 0x3a08, 0x3a08, 0x3a08, 0x3a29,
-  0x3a29, 0x3a29, 0x4249, 0x4269, 0x4249, 0x4229, 0x4249, 0x4a6a,
-  0x4a6a, 0x4269, 0x4a8a, 0x4269, 0x428a, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x428a, 0x428a, 0x428a, 0x428a,
-  0x428a, 0x52ec, 0x530c, 0x4acb, 0x4aab, 0x4aec, 0x532d, 0x5b2d,
-  0x52ec, 0x530c, 0x530c, 0x530c, 0x532d, 0x5b4d, 0x534d, 0x534d,
-  0x530d, 0x534d, 0x5b6e, 0x5b6e, 0x534d, 0x534d, 0x5b6e, 0x5b8e,
-  0x63af, 0x63af, 0x63ef, 0x63af, 0x5baf, 0x5bae, 0x63cf, 0x63ef,
-  0x63f0, 0x63f0, 0x6c30, 0x6c31, 0x6c30, 0x6c51, 0x6c30, 0x6410,
-  0x6c30, 0x6c30, 0x6c31, 0x6c51, 0x6c72, 0x6c71, 0x74b2, 0x7cf3,
-  0x8513, 0x8554, 0x8d54, 0x8d75, 0x9595, 0x95b5, 0x9df6, 0xa637,
-  0xae58, 0xae98, 0xb6d9, 0xbf19, 0xc75a, 0xcf7b, 0xd7bb, 0xeffd,
-  0xfffe, 0xeffc, 0xefdc, 0xdfbc, 0xbf5b, 0xaefa, 0xb6f9, 0xcf1a,
-  0xcf19, 0xef9b, 0xf79b, 0xf7bb, 0xf79b, 0xf7bb, 0xef5a, 0xef3a,
-  0xce56, 0xef3a, 0xded9, 0xef3a, 0xef5a, 0xce77, 0xc616, 0xdeb8,
-  0xef19, 0xce36, 0xce77, 0xb595, 0xbdf5, 0xbdf5, 0xd677, 0xded8,
-  0x6c31, 0x5bd0, 0x5b8e, 0x5b8e, 0x538e, 0x538e, 0x5b8e, 0x5b8e,
-  0x63ae, 0xb574, 0xde36, 0xd615, 0xd5f5, 0xd5f5, 0xd5d5, 0xcdd5,
-  0xcdb4, 0xc5b4, 0xbd94, 0x3187, 0x3987, 0x3146, 0x3146, 0x3146,
-  0x3146, 0x3166, 0x3987, 0x3987, 0x3146, 0x3166, 0x3186, 0x3186,
-  0x3187, 0x31a7, 0x39a7, 0x31a7, 0x39a7, 0x4209, 0x4209, 0x39e8,
-  0x4209, 0x39e8, 0x3a08, 0x4229, 0x39e8, 0x4229, 0x4a4a, 0x4228,
-  0x3a08, 0x73d0, 0x424a, 0x3187, 0x3187, 0x3186, 0x31a7, 0x3187,
-  0x3166, 0x3187, 0x3186, 0x3166, 0x3187, 0x3186, 0x2966, 0x2966,
-  0x3166, 0x3186, 0x3186, 0x3187, 0x39a7, 0x39c7, 0x39c7, 0x39c7,
-  0x39c8, 0x39c8, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x4229, 0x4229, 0x4209, 0x3a08, 0x4249, 0x4a8a, 0x52aa, 0x4229,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x4229,
-  0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x4208, 0x4228, 0x4a8a,
-  0x4208, 0x3a08, 0x4a49, 0x4249, 0x39e8, 0x39e8, 0x39e8, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x4229, 0x3a29, 0x3a08, 0x39e8, 0x3a08,
-  0x3a29, 0x3a29, 0x4229, 0x4249, 0x4249, 0x4229, 0x4249, 0x4249,
-  0x4249, 0x4269, 0x426a, 0x426a, 0x4a8a, 0x428a, 0x426a, 0x428a,
-  0x4aaa, 0x4a8a, 0x428a, 0x428a, 0x428a, 0x428a, 0x42ab, 0x42ab,
-  0x4aab, 0x42aa, 0x530c, 0x4acb, 0x4acb, 0x42aa, 0x5b2d, 0x5b4d,
-  0x4aab, 0x4aec, 0x5b4d, 0x4aec, 0x532d, 0x5b4d, 0x5b6e, 0x63af,
-  0x5b6e, 0x534d, 0x63af, 0x534d, 0x534d, 0x534d, 0x5b6e, 0x536d,
-  0x5b6d, 0x5b6e, 0x5b8e, 0x5b8e, 0x5baf, 0x63ef, 0x6c10, 0x63f0,
-  0x63f0, 0x6c10, 0x63f0, 0x6c31, 0x6c30, 0x6c31, 0x6c31, 0x6c31,
-  0x6c51, 0x6c31, 0x6c31, 0x6c71, 0x6c71, 0x7492, 0x74b2, 0x7cd3,
-  0x8513, 0x8554, 0x8d54, 0x9595, 0x95b5, 0x95b5, 0x9df6, 0xa617,
-  0xae58, 0xb698, 0xb6d9, 0xbf19, 0xc75a, 0xcf7b, 0xdfbb, 0xf7fd,
-  0xfffe, 0xeffd, 0xe7bc, 0xdfbc, 0xbf3b, 0xaefa, 0xbefa, 0xcf1a,
-  0xd71a, 0xef9b, 0xf7bb, 0xf7bb, 0xf79b, 0xf79b, 0xef5a, 0xe719,
-  0xc5f5, 0xe719, 0xe6f9, 0xf77a, 0xef3a, 0xce57, 0xce56, 0xded8,
-  0xe6d8, 0xce36, 0xce57, 0xbdd5, 0xc636, 0xbdd5, 0xdeb8, 0xc636,
-  0x63ef, 0x6410, 0x53ae, 0x538e, 0x5b8e, 0x5b8e, 0x5b8e, 0x5b8e,
-  0x6baf, 0xc5d5, 0xde56, 0xde15, 0xd615, 0xd615, 0xd5f5, 0xd5f5,
-  0xcdd5, 0xc5b4, 0xbd74, 0x39e8, 0x39c7, 0x3146, 0x3146, 0x3146,
-  0x3166, 0x3166, 0x3987, 0x528a, 0x736e, 0x3166, 0x3986, 0x39a7,
-  0x39a7, 0x3187, 0x39a7, 0x39c7, 0x39a7, 0x39a7, 0x39c8, 0x39e8,
-  0x4229, 0x4a49, 0x39e8, 0x39e8, 0x3a08, 0x3a09, 0x4a49, 0x4a6a,
-  0x4208, 0x3a29, 0x31c8, 0x39a7, 0x31a7, 0x3187, 0x3186, 0x3187,
-  0x3166, 0x3166, 0x3166, 0x39c7, 0x3187, 0x2946, 0x3186, 0x31a7,
-  0x3186, 0x3186, 0x3186, 0x31a7, 0x39e8, 0x39c8, 0x4208, 0x31a7,
-  0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x4208, 0x4209, 0x3a08, 0x3a08,
-  0x39e8, 0x3a08, 0x3a08, 0x4249, 0x4229, 0x4a8a, 0x4a6a, 0x3a08,
-  0x4229, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x4208, 0x3a08, 0x3a08,
-  0x4229, 0x4a49, 0x4208, 0x39e8, 0x39e8, 0x4a49, 0x4229, 0x52aa,
-  0x4a49, 0x4a69, 0x52ab, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a08, 0x3a28, 0x3a08, 0x3a28, 0x4249, 0x3a08, 0x3a28, 0x3a08,
-  0x3a29, 0x3a29, 0x3a29, 0x4249, 0x4249, 0x4249, 0x4249, 0x3a29,
-  0x4249, 0x426a, 0x428a, 0x426a, 0x4aab, 0x428a, 0x4a8a, 0x4acb,
-  0x428a, 0x428a, 0x428a, 0x4aab, 0x428b, 0x428a, 0x428b, 0x4aab,
-  0x4acc, 0x4acb, 0x4aab, 0x42aa, 0x42aa, 0x4aab, 0x4aec, 0x52ec,
-  0x4aec, 0x530c, 0x530c, 0x530c, 0x4b0c, 0x530c, 0x5b4d, 0x638f,
-  0x63cf, 0x5b6d, 0x63af, 0x638e, 0x5b4d, 0x5b8e, 0x5b8e, 0x536d,
-  0x5b6e, 0x5b6e, 0x5b6e, 0x63cf, 0x63ef, 0x63cf, 0x63cf, 0x63cf,
-  0x63cf, 0x6410, 0x6410, 0x6410, 0x6c31, 0x6c31, 0x6c31, 0x6c51,
-  0x6c51, 0x6c71, 0x7472, 0x7492, 0x7492, 0x74b2, 0x74b2, 0x7cf3,
-  0x8513, 0x8534, 0x8d54, 0x9595, 0x95b5, 0x9dd6, 0x9df6, 0xa637,
-  0xae58, 0xb6b8, 0xbed9, 0xbf1a, 0xc75a, 0xd79b, 0xdfbb, 0xf7fd,
-  0xfffe, 0xeffd, 0xe7bc, 0xdfbc, 0xbf5b, 0xaefa, 0xc6fa, 0xcef9,
-  0xdf3a, 0xf79b, 0xf7bb, 0xf79b, 0xf79b, 0xef7a, 0xef7a, 0xe719,
-  0xc616, 0xe6f9, 0xe6f9, 0xf77b, 0xef3a, 0xce57, 0xd677, 0xded8,
-  0xde97, 0xd677, 0xce36, 0xbdb5, 0xce77, 0xbdd5, 0xe6f8, 0xad95,
-  0x7451, 0x8d13, 0x536e, 0x536e, 0x536e, 0x5b8e, 0x63ae, 0x63cf,
-  0x63ae, 0xa512, 0xcdf5, 0xde15, 0xde35, 0xde35, 0xd615, 0xd5f5,
-  0xcdf5, 0xc5b4, 0xc594, 0x39a7, 0x39a7, 0x39a7, 0x3166, 0x3166,
-  0x3987, 0x3966, 0x3987, 0x41e8, 0x528a, 0x3166, 0x3187, 0x39a7,
-  0x3987, 0x3187, 0x31a7, 0x39e8, 0x39c7, 0x4229, 0x4208, 0x39c8,
-  0x41e8, 0x4a29, 0x4209, 0x39e8, 0x39e8, 0x4209, 0x4209, 0x4229,
-  0x4229, 0x39e8, 0x39c8, 0x39c7, 0x31a7, 0x31a7, 0x3187, 0x3186,
-  0x3186, 0x3166, 0x3186, 0x31a7, 0x3187, 0x3166, 0x3186, 0x3186,
-  0x3186, 0x3187, 0x3187, 0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31c7,
-  0x39e8, 0x39e8, 0x39e8, 0x3a09, 0x4209, 0x3a08, 0x3a08, 0x4229,
-  0x4229, 0x4249, 0x3a08, 0x4229, 0x3a08, 0x4249, 0x4229, 0x4208,
-  0x3a08, 0x39e8, 0x4229, 0x4208, 0x4229, 0x39e8, 0x4229, 0x4249,
-  0x4208, 0x3a08, 0x4228, 0x4249, 0x4249, 0x4a69, 0x52aa, 0x4a6a,
-  0x4a6a, 0x4249, 0x4229, 0x4229, 0x4229, 0x3a08, 0x3a08, 0x3a08,
-  0x3a29, 0x3a08, 0x3a08, 0x3a29, 0x4229, 0x4229, 0x3a28, 0x3a29,
-  0x4229, 0x3a08, 0x3a29, 0x3a29, 0x4229, 0x4229, 0x4229, 0x4249,
-  0x4249, 0x426a, 0x426a, 0x4a8a, 0x52ec, 0x426a, 0x428a, 0x4acb,
-  0x4aab, 0x428a, 0x4acb, 0x4aab, 0x428a, 0x4aaa, 0x428a, 0x428b,
-  0x428b, 0x4aaa, 0x4aab, 0x4aab, 0x4aab, 0x4acb, 0x4acb, 0x4acb,
-  0x4aec, 0x530c, 0x530c, 0x532d, 0x530c, 0x532d, 0x534d, 0x63af,
-  0x536e, 0x5b8e, 0x5b8e, 0x5b6d, 0x5b6e, 0x5b8e, 0x5b8e, 0x5b6e,
-  0x5b8e, 0x5b8e, 0x5bae, 0x63cf, 0x63cf, 0x5bae, 0x5bcf, 0x6410,
-  0x63cf, 0x63f0, 0x6410, 0x6c30, 0x6c31, 0x6c31, 0x6c51, 0x6c51,
-  0x6c51, 0x7492, 0x7492, 0x7492, 0x7492, 0x74b2, 0x7cd2, 0x7cf3,
-  0x8513, 0x8534, 0x8d75, 0x95b5, 0x95b5, 0x9dd5, 0xa616, 0xa637,
-  0xae78, 0xb6b8, 0xbef9, 0xc73a, 0xcf7b, 0xd79b, 0xdfdc, 0xf7fe,
-  0xfffe, 0xefdd, 0xe79c, 0xd79c, 0xbf3b, 0xb6fa, 0xc71a, 0xcef9,
-  0xdf3a, 0xf79b, 0xf7bb, 0xf79b, 0xf79b, 0xef7a, 0xef7a, 0xe719,
-  0xce56, 0xe6f9, 0xe719, 0xf79b, 0xef39, 0xd677, 0xd697, 0xde97,
-  0xd677, 0xded8, 0xc616, 0xb5b4, 0xce57, 0xbdd4, 0xe6f8, 0x9d33,
-  0x94d2, 0x8cf3, 0x536e, 0x534e, 0x532d, 0x536e, 0x63ae, 0x63ef,
-  0x63ce, 0x6bad, 0xa4d1, 0xde56, 0xde56, 0xde36, 0xde35, 0xd615,
-  0xd5f5, 0xcdd4, 0xc5b4, 0x4208, 0x4208, 0x41e8, 0x3166, 0x3166,
-  0x3966, 0x3966, 0x3987, 0x39a7, 0x3186, 0x3187, 0x3187, 0x3987,
-  0x3987, 0x62ec, 0x4229, 0x39a7, 0x39c8, 0x4229, 0x4229, 0x4a49,
-  0x39c8, 0x39c8, 0x4208, 0x4208, 0x39e8, 0x4229, 0x4249, 0x4229,
-  0x4a49, 0x39c8, 0x39e8, 0x31c7, 0x31a7, 0x31a7, 0x3187, 0x3187,
-  0x3187, 0x31a7, 0x39c7, 0x39c7, 0x39e8, 0x3187, 0x3187, 0x31a7,
-  0x3186, 0x31a7, 0x39a7, 0x39a7, 0x39a7, 0x39c8, 0x39c8, 0x39e8,
-  0x39e8, 0x39c8, 0x3a09, 0x3a09, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x3a08, 0x4269, 0x3a29, 0x4249, 0x4249, 0x4a6a, 0x4229, 0x3a08,
-  0x3a08, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x4249, 0x4208, 0x4249, 0x4a69, 0x52ab, 0x4228,
-  0x4249, 0x4228, 0x4229, 0x4229, 0x4229, 0x3a08, 0x3a08, 0x4229,
-  0x4269, 0x3a08, 0x3a29, 0x3a29, 0x4249, 0x4249, 0x3a08, 0x4229,
-  0x4229, 0x4229, 0x4229, 0x3a29, 0x4229, 0x4229, 0x4229, 0x4229,
-  0x4229, 0x426a, 0x4249, 0x4aab, 0x4a8a, 0x4a8a, 0x428a, 0x42aa,
-  0x4aab, 0x4acb, 0x52ec, 0x52ec, 0x530c, 0x4aab, 0x4aab, 0x4a8b,
-  0x4aab, 0x428a, 0x4aab, 0x4aab, 0x4acc, 0x4acb, 0x4acb, 0x4aec,
-  0x4aeb, 0x4aec, 0x530c, 0x530c, 0x530c, 0x4b0c, 0x532d, 0x534d,
-  0x5b6e, 0x5bae, 0x63af, 0x63ae, 0x63af, 0x5b8e, 0x63ae, 0x5b8e,
-  0x63af, 0x638f, 0x63f0, 0x5bcf, 0x5bae, 0x5baf, 0x63cf, 0x6c10,
-  0x63ef, 0x63f0, 0x6c30, 0x6c30, 0x6c51, 0x6c51, 0x6c51, 0x7471,
-  0x7492, 0x7492, 0x7492, 0x7492, 0x74b2, 0x7cd3, 0x7cf3, 0x8513,
-  0x8534, 0x8d54, 0x9575, 0x9595, 0x9db5, 0x9df6, 0xa616, 0xa657,
-  0xae78, 0xb6b8, 0xbef9, 0xc73a, 0xcf7b, 0xd79b, 0xe7dc, 0xf7fe,
-  0xf7fe, 0xefdd, 0xe79c, 0xd77b, 0xbf3a, 0xb6fa, 0xcf1a, 0xcef9,
-  0xdf5a, 0xf79b, 0xf7bb, 0xf79b, 0xf79b, 0xef7a, 0xf79b, 0xdef9,
-  0xd677, 0xe719, 0xe719, 0xf79a, 0xef3a, 0xd657, 0xd697, 0xce56,
-  0xd656, 0xde98, 0xc616, 0xc5f6, 0xce36, 0xc5f5, 0xe6f8, 0x8cb2,
-  0xa554, 0x84d3, 0x5b8f, 0x4b2d, 0x4b2d, 0x534d, 0x63ae, 0x6bef,
-  0x6bce, 0x73ce, 0xc594, 0xe677, 0xe656, 0xde56, 0xde36, 0xde15,
-  0xd5f5, 0xd5d5, 0xcdb4, 0x4a8a, 0x528a, 0x4229, 0x3146, 0x3166,
-  0x3187, 0x3166, 0x3166, 0x3987, 0x39a7, 0x3186, 0x3987, 0x3987,
-  0x3987, 0x4208, 0x4208, 0x39c7, 0x39c7, 0x39c7, 0x4208, 0x4a4a,
-  0x39c8, 0x39c8, 0x39e8, 0x4229, 0x4208, 0x3a08, 0x4208, 0x4229,
-  0x52ab, 0x4a49, 0x39e8, 0x39c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x39a7, 0x31a7, 0x41e8, 0x4a29, 0x39e8, 0x3186, 0x31a7, 0x39e8,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39c7, 0x39a7, 0x39c7, 0x39c7,
-  0x39c7, 0x39c8, 0x3a08, 0x3a08, 0x4a8a, 0x4229, 0x39e8, 0x3a08,
-  0x4229, 0x4229, 0x3a08, 0x3a08, 0x4229, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x4209, 0x39e8, 0x4208, 0x4208,
-  0x4249, 0x4228, 0x3a08, 0x4229, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x39e8, 0x3a28, 0x4249, 0x4229, 0x3a08, 0x4229, 0x3a29, 0x4229,
-  0x4249, 0x3a29, 0x4249, 0x3a29, 0x4249, 0x4249, 0x3a08, 0x4249,
-  0x4249, 0x4229, 0x4249, 0x4249, 0x426a, 0x4249, 0x4249, 0x4249,
-  0x3a29, 0x4249, 0x428a, 0x4269, 0x426a, 0x426a, 0x4aaa, 0x428a,
-  0x4aab, 0x52ec, 0x52ec, 0x530c, 0x5b2d, 0x4acb, 0x4aab, 0x4acb,
-  0x4acb, 0x4aab, 0x4aab, 0x4aab, 0x4acb, 0x4aab, 0x4acb, 0x4acb,
-  0x4aec, 0x532d, 0x532d, 0x532d, 0x5b4d, 0x4b0c, 0x530d, 0x530d,
-  0x534d, 0x5b8e, 0x5bae, 0x5bae, 0x5b8e, 0x63cf, 0x5bae, 0x63cf,
-  0x63cf, 0x63af, 0x63cf, 0x63cf, 0x63cf, 0x63cf, 0x63ef, 0x63ef,
-  0x6c10, 0x6c10, 0x6c31, 0x6c51, 0x6c51, 0x6c71, 0x7471, 0x7492,
-  0x7492, 0x7cb2, 0x74b2, 0x74b2, 0x74b2, 0x7cf3, 0x7cf3, 0x8513,
-  0x8534, 0x8d54, 0x9575, 0x9595, 0x9dd6, 0x9df6, 0xa617, 0xae57,
-  0xae78, 0xb6b8, 0xbef9, 0xc73a, 0xcf7b, 0xd7bb, 0xe7dc, 0xf7fe,
-  0xf7fe, 0xefdd, 0xe79c, 0xd75b, 0xc73a, 0xbf1a, 0xcf1a, 0xcef9,
-  0xe75a, 0xf79b, 0xf7bb, 0xf79b, 0xf79a, 0xef5a, 0xf79b, 0xdef8,
-  0xd697, 0xe6f9, 0xef39, 0xf77a, 0xef5a, 0xd677, 0xde97, 0xd657,
-  0xce56, 0xd656, 0xce36, 0xc616, 0xc636, 0xce36, 0xdeb8, 0x8491,
-  0x9d33, 0x7471, 0x63cf, 0x532d, 0x4b2d, 0x536e, 0x63cf, 0x6bae,
-  0x6bae, 0xa4b1, 0xee76, 0xee96, 0xe676, 0xe676, 0xde36, 0xde35,
-  0xddf5, 0xd5f5, 0xcdd5, 0x4a49, 0x52aa, 0x528a, 0x3166, 0x3166,
-  0x3167, 0x3166, 0x3166, 0x3986, 0x39a7, 0x39a7, 0x3987, 0x39a7,
-  0x39a7, 0x31a7, 0x31a7, 0x39a7, 0x39a7, 0x4a49, 0x4208, 0x39c7,
-  0x4209, 0x41e8, 0x39e8, 0x39e8, 0x4209, 0x39e8, 0x39e8, 0x4229,
-  0x4229, 0x4a6a, 0x4209, 0x39c7, 0x39c7, 0x39a7, 0x39a7, 0x39a7,
-  0x3187, 0x3166, 0x3186, 0x3166, 0x3166, 0x3187, 0x31a7, 0x3a08,
-  0x31c7, 0x31a7, 0x39c7, 0x31c7, 0x39e8, 0x39c7, 0x31a7, 0x39c7,
-  0x4229, 0x31c7, 0x39e8, 0x39e8, 0x4249, 0x39e8, 0x39e8, 0x4229,
-  0x4229, 0x4249, 0x4249, 0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e7,
-  0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x39e8, 0x3a08, 0x3a08, 0x4229, 0x4229, 0x3a29, 0x4249, 0x4249,
-  0x4249, 0x3a29, 0x4229, 0x4229, 0x4229, 0x3a29, 0x3a29, 0x4229,
-  0x4249, 0x4229, 0x4229, 0x4249, 0x4249, 0x3a28, 0x3a28, 0x3a29,
-  0x3a29, 0x4249, 0x428a, 0x4269, 0x4269, 0x426a, 0x4aaa, 0x4a8a,
-  0x4acb, 0x4aab, 0x52ec, 0x5b2d, 0x52eb, 0x4acb, 0x4aab, 0x4acb,
-  0x4aab, 0x4aab, 0x4acb, 0x4aab, 0x4acb, 0x4acb, 0x52ec, 0x4aec,
-  0x52ec, 0x52ec, 0x532d, 0x530c, 0x532d, 0x532d, 0x5b4d, 0x5b4d,
-  0x532d, 0x5b6d, 0x5b8e, 0x6bef, 0x6c10, 0x63ae, 0x63cf, 0x63af,
-  0x63cf, 0x6bef, 0x63cf, 0x6bf0, 0x63cf, 0x63f0, 0x6c10, 0x6c10,
-  0x6c31, 0x6c30, 0x6c10, 0x7471, 0x7451, 0x7472, 0x7492, 0x7492,
-  0x7cb2, 0x7cd3, 0x7cb2, 0x7cd2, 0x7cd3, 0x84f3, 0x8513, 0x8534,
-  0x8d54, 0x8d54, 0x9575, 0x9db6, 0x9db6, 0x9df6, 0xa637, 0xae57,
-  0xae78, 0xb6b8, 0xbef9, 0xc73a, 0xcf7b, 0xdfbb, 0xe7fc, 0xfffe,
-  0xf7fd, 0xefdd, 0xe79c, 0xd77b, 0xc73a, 0xc71a, 0xd71a, 0xd6f9,
-  0xef7b, 0xf79b, 0xffdc, 0xf79b, 0xf77a, 0xef5a, 0xef7a, 0xded8,
-  0xdeb8, 0xded8, 0xef39, 0xef5a, 0xef5a, 0xd697, 0xd697, 0xce36,
-  0xde97, 0xd697, 0xc616, 0xce16, 0xc5f6, 0xd656, 0xd697, 0x84b2,
-  0x9d53, 0x6c30, 0x5b8e, 0x532d, 0x532d, 0x536e, 0x63ae, 0x6bcf,
-  0x73ce, 0xc5b4, 0xf6d7, 0xeeb7, 0xee96, 0xe676, 0xe656, 0xde36,
-  0xde16, 0xd615, 0xd5f5, 0x4a6a, 0x52ab, 0x4208, 0x39a7, 0x39a7,
-  0x3987, 0x3166, 0x3166, 0x3986, 0x3987, 0x39a7, 0x3986, 0x39a7,
-  0x39a7, 0x39c7, 0x39c7, 0x39c7, 0x41e8, 0x4a6a, 0x4208, 0x41e8,
-  0x41e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x4229, 0x39e8, 0x3a08,
-  0x4229, 0x3a08, 0x4229, 0x4209, 0x39c7, 0x39a7, 0x31a7, 0x39a7,
-  0x31a7, 0x3187, 0x3187, 0x3187, 0x3187, 0x3187, 0x39c7, 0x31a7,
-  0x39c7, 0x39e8, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x4249,
-  0x4249, 0x31c7, 0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x4208, 0x4208,
-  0x4229, 0x4a49, 0x4249, 0x39e8, 0x39e8, 0x3a08, 0x4229, 0x39e8,
-  0x39e8, 0x31c7, 0x39e8, 0x3a08, 0x39e8, 0x39e7, 0x39c7, 0x39c7,
-  0x39e7, 0x39e7, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x39e8,
-  0x31e8, 0x39e8, 0x3a08, 0x3a28, 0x4229, 0x3a08, 0x3a28, 0x4a8a,
-  0x4249, 0x426a, 0x4a6a, 0x3a08, 0x4249, 0x4249, 0x4249, 0x4269,
-  0x4249, 0x4229, 0x4229, 0x4229, 0x4249, 0x4249, 0x3a28, 0x4249,
-  0x3a29, 0x3a29, 0x3a49, 0x428a, 0x4aab, 0x428a, 0x428a, 0x428a,
-  0x4acb, 0x52ec, 0x4aeb, 0x4acb, 0x4acb, 0x4aab, 0x4acb, 0x4acb,
-  0x4aab, 0x4aab, 0x4acb, 0x4acb, 0x4acb, 0x4acb, 0x4acb, 0x4acb,
-  0x4aec, 0x4aec, 0x532d, 0x530d, 0x5b4d, 0x532d, 0x532d, 0x532d,
-  0x532d, 0x534d, 0x5b8e, 0x5b6d, 0x63cf, 0x6bf0, 0x63cf, 0x6bf0,
-  0x63ef, 0x6bf0, 0x7431, 0x6c10, 0x6bf0, 0x6c10, 0x6c10, 0x6c30,
-  0x7451, 0x7451, 0x6c10, 0x6c51, 0x7471, 0x7492, 0x7492, 0x7cd2,
-  0x8d34, 0x84f3, 0x84f3, 0x7cf3, 0x8513, 0x7cf3, 0x84f3, 0x8534,
-  0x8d54, 0x8d75, 0x9595, 0x9db6, 0x9dd6, 0xa616, 0xa637, 0xae57,
-  0xb678, 0xb6b8, 0xbef9, 0xc75a, 0xd79b, 0xdfdc, 0xeffc, 0xfffe,
-  0xf7fd, 0xefdc, 0xe79c, 0xd75b, 0xc73b, 0xd71a, 0xd719, 0xd6f9,
-  0xef7b, 0xf77a, 0xffbc, 0xf79b, 0xef7a, 0xef5a, 0xf79a, 0xdeb8,
-  0xd698, 0xe6f8, 0xef5a, 0xef5a, 0xef3a, 0xe6f9, 0xdeb8, 0xc5f6,
-  0xd677, 0xd677, 0xce56, 0xce36, 0xbdb5, 0xd677, 0xce36, 0x8cb2,
-  0x9d54, 0x6c10, 0x4b2d, 0x534e, 0x534e, 0x536e, 0x5b6e, 0x63af,
-  0x7c0f, 0xd615, 0xf6f7, 0xeed7, 0xeeb7, 0xee97, 0xe676, 0xe656,
-  0xde36, 0xde15, 0xd5f5, 0x4249, 0x4a8a, 0x4a6a, 0x39a7, 0x3987,
-  0x3987, 0x3986, 0x3987, 0x3166, 0x3187, 0x39a7, 0x3986, 0x41e8,
-  0x41e8, 0x41e8, 0x39a7, 0x39c8, 0x39c8, 0x39c7, 0x39c8, 0x4208,
-  0x39e8, 0x39e8, 0x39c8, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x4208, 0x4229, 0x4209, 0x39c7, 0x39c7, 0x31a7, 0x31a7, 0x3187,
-  0x3186, 0x3186, 0x3187, 0x39a7, 0x39a7, 0x31a7, 0x39a7, 0x39a7,
-  0x39c7, 0x39c8, 0x39c8, 0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x4209,
-  0x4229, 0x39c8, 0x39c7, 0x31c7, 0x31c7, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39c8,
-  0x31c7, 0x31c7, 0x39c7, 0x31c7, 0x31c7, 0x31c7, 0x39e8, 0x31c7,
-  0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x31e8, 0x39e8, 0x31e8,
-  0x31c8, 0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x3a29, 0x3a28, 0x4229,
-  0x3a29, 0x4249, 0x4229, 0x4229, 0x4249, 0x4269, 0x4a6a, 0x4269,
-  0x4249, 0x4aaa, 0x4249, 0x3a08, 0x73ae, 0x73ae, 0x3a08, 0x3a29,
-  0x3a29, 0x4249, 0x4249, 0x426a, 0x426a, 0x4a8a, 0x4a8a, 0x4aaa,
-  0x52ec, 0x4acb, 0x4acb, 0x4acb, 0x4aab, 0x52cb, 0x52ec, 0x530c,
-  0x530c, 0x52ec, 0x4aab, 0x4acb, 0x4acb, 0x4aeb, 0x4acb, 0x4acb,
-  0x4aec, 0x530c, 0x532d, 0x5b4d, 0x5b4d, 0x534d, 0x532d, 0x532d,
-  0x532d, 0x534d, 0x5b8e, 0x5bae, 0x6c10, 0x7431, 0x6c10, 0x6c10,
-  0x6bf0, 0x7451, 0x6c31, 0x7431, 0x6c10, 0x6c10, 0x6c30, 0x7451,
-  0x6c30, 0x7451, 0x7c92, 0x7471, 0x7492, 0x74b2, 0x7cb2, 0x7cd3,
-  0x84f3, 0x8d14, 0x8513, 0x8513, 0x7cf3, 0x84f3, 0x8513, 0x8534,
-  0x8d54, 0x9575, 0x95b5, 0x9dd6, 0x9df6, 0xa637, 0xa637, 0xae78,
-  0xb698, 0xbed9, 0xc71a, 0xcf5a, 0xd79b, 0xdfdc, 0xeffc, 0xfffe,
-  0xf7fd, 0xefdc, 0xdf9c, 0xd75b, 0xcf5b, 0xdf3a, 0xdf19, 0xdf19,
-  0xef7a, 0xef7a, 0xf7bb, 0xf7bb, 0xf77a, 0xe739, 0xf77a, 0xded8,
-  0xdeb8, 0xe6f8, 0xef5a, 0xef5a, 0xe6f8, 0xef39, 0xdeb8, 0xce37,
-  0xd677, 0xd677, 0xd677, 0xce36, 0xbdd5, 0xd697, 0xc5f6, 0x84b2,
-  0x9513, 0x63f0, 0x4b2d, 0x5b6e, 0x5b6e, 0x5b6e, 0x638e, 0x6bce,
-  0x7bee, 0xde35, 0xf718, 0xf6d7, 0xeed7, 0xeeb7, 0xee96, 0xe656,
-  0xde56, 0xd615, 0xd5f5, 0x4a4a, 0x5aec, 0x39c8, 0x3987, 0x39a7,
-  0x3987, 0x3987, 0x3987, 0x3166, 0x3987, 0x39c7, 0x3987, 0x39a7,
-  0x39a7, 0x39a7, 0x39e8, 0x4a29, 0x4208, 0x4208, 0x4a6a, 0x41e8,
-  0x39e8, 0x31c7, 0x39e8, 0x39c8, 0x4208, 0x39c7, 0x4208, 0x39e8,
-  0x4228, 0x4208, 0x4a49, 0x3a08, 0x39c7, 0x39c7, 0x39c7, 0x39a7,
-  0x39a7, 0x3987, 0x3187, 0x3987, 0x3187, 0x3987, 0x39a7, 0x39a7,
-  0x39a7, 0x39c7, 0x39e8, 0x39e8, 0x39c7, 0x39c7, 0x39c8, 0x39c8,
-  0x31a7, 0x39c8, 0x39c7, 0x31c7, 0x39e8, 0x39e8, 0x39e8, 0x39c8,
-  0x31c7, 0x31c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x31c8, 0x31c8,
-  0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x39e8, 0x39e8, 0x31c7,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x31c8, 0x31c8, 0x31c8,
-  0x31c8, 0x31e8, 0x39e8, 0x3a08, 0x3a08, 0x4229, 0x3a28, 0x4229,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x3a29, 0x3a29, 0x4269, 0x4269,
-  0x4a8a, 0x4249, 0x4249, 0x4249, 0x4a69, 0x52aa, 0x3a29, 0x3a29,
-  0x4249, 0x426a, 0x4249, 0x4249, 0x4249, 0x426a, 0x4a8a, 0x4aab,
-  0x4aeb, 0x52ec, 0x4acb, 0x52ec, 0x4aab, 0x52ec, 0x530c, 0x530c,
-  0x530c, 0x4acb, 0x4acb, 0x4acb, 0x4aab, 0x4acb, 0x4acb, 0x52ec,
-  0x530c, 0x534d, 0x532d, 0x5b4d, 0x63cf, 0x6bef, 0x5b8e, 0x532d,
-  0x5b4d, 0x63af, 0x5b8e, 0x63cf, 0x6c10, 0x7431, 0x6bf0, 0x63cf,
-  0x6c10, 0x7431, 0x6c10, 0x6c10, 0x7471, 0x7451, 0x7451, 0x7451,
-  0x7451, 0x7451, 0x7492, 0x7c92, 0x7cb2, 0x7cb2, 0x7cf3, 0x84f3,
-  0x84f3, 0x8d34, 0x8514, 0x8513, 0x8513, 0x8513, 0x8534, 0x8d34,
-  0x8d54, 0x9575, 0x9db6, 0x9dd6, 0xa616, 0xa616, 0xae57, 0xae78,
-  0xb698, 0xbed9, 0xc71a, 0xcf5a, 0xd79b, 0xdfdb, 0xeffd, 0xfffe,
-  0xf7fd, 0xe7bc, 0xdf7c, 0xd75b, 0xcf5b, 0xdf5b, 0xdf19, 0xe739,
-  0xf79a, 0xef9a, 0xf7bb, 0xf7bb, 0xef5a, 0xe719, 0xf77a, 0xdef8,
-  0xded8, 0xe6f8, 0xef5a, 0xef5a, 0xe6f8, 0xe719, 0xdeb8, 0xc616,
-  0xd677, 0xce56, 0xd677, 0xc616, 0xc5f5, 0xd656, 0xbdd6, 0x84b2,
-  0x8cf2, 0x5baf, 0x534e, 0x5b8e, 0x5b6e, 0x5b8e, 0x6bce, 0x73ef,
-  0x842f, 0xd615, 0xff18, 0xf6f7, 0xf6d7, 0xeed7, 0xeeb7, 0xe676,
-  0xe656, 0xde15, 0xd615, 0x4a49, 0x4a49, 0x39a7, 0x39c8, 0x39c8,
-  0x39a7, 0x3987, 0x3987, 0x3987, 0x39a7, 0x39a7, 0x39a7, 0x39a7,
-  0x41e8, 0x41e8, 0x39c8, 0x39c7, 0x39c8, 0x4a49, 0x528a, 0x4208,
-  0x39e8, 0x39e8, 0x39e8, 0x39c7, 0x4209, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x4208, 0x4229, 0x4229, 0x39c7, 0x39e8, 0x39e8, 0x39c8,
-  0x39a7, 0x39c8, 0x39a7, 0x39a7, 0x3187, 0x39a7, 0x39a7, 0x39c7,
-  0x39c7, 0x4229, 0x4a6a, 0x31a7, 0x39c7, 0x39c7, 0x39c7, 0x31c7,
-  0x39c7, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x31c7, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x4209, 0x39c7, 0x39c7, 0x39c8, 0x39c8, 0x31c8,
-  0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7,
-  0x31c7, 0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x31c7, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x39e8, 0x39e8, 0x3a08, 0x3a29, 0x3a08, 0x3a29,
-  0x3a29, 0x426a, 0x4249, 0x4249, 0x4249, 0x4249, 0x426a, 0x4269,
-  0x4a8a, 0x4249, 0x4249, 0x4229, 0x4249, 0x3a49, 0x4249, 0x426a,
-  0x4249, 0x426a, 0x3a29, 0x4229, 0x426a, 0x428a, 0x428a, 0x428a,
-  0x4aab, 0x530c, 0x4acb, 0x4acb, 0x4aab, 0x52ec, 0x52ec, 0x52ec,
-  0x530c, 0x52ec, 0x4aab, 0x4acb, 0x4acb, 0x52ec, 0x52ec, 0x530c,
-  0x530c, 0x532c, 0x532c, 0x532d, 0x84b2, 0x7c72, 0x5b4d, 0x532d,
-  0x5b4d, 0x63af, 0x5b6e, 0x5b6e, 0x63cf, 0x6bef, 0x63cf, 0x6bef,
-  0x7431, 0x6bf0, 0x6c10, 0x6bf0, 0x6c10, 0x7431, 0x6c30, 0x6c30,
-  0x7471, 0x7492, 0x7cb2, 0x7492, 0x7492, 0x7492, 0x7cb2, 0x84f3,
-  0x8d34, 0x8513, 0x8d54, 0x8513, 0x84f3, 0x8534, 0x8d34, 0x8d54,
-  0x8d75, 0x9595, 0x9dd6, 0x9dd6, 0x9df6, 0xa637, 0xae58, 0xb678,
-  0xb6b8, 0xbed9, 0xc71a, 0xcf5a, 0xd79b, 0xdfdb, 0xf7fd, 0xfffe,
-  0xf7fd, 0xe7bc, 0xdf7c, 0xd75b, 0xd75b, 0xe75b, 0xdf19, 0xe75a,
-  0xf77b, 0xf79a, 0xf79b, 0xffdb, 0xef5a, 0xe719, 0xf77a, 0xe6f8,
-  0xdeb7, 0xe6f8, 0xef5a, 0xef5a, 0xe719, 0xef39, 0xded8, 0xbdd5,
-  0xd677, 0xce56, 0xd657, 0xc616, 0xc636, 0xce36, 0xbdf6, 0x8cf2,
-  0x84b2, 0x5b8e, 0x536e, 0x5b6e, 0x5b6e, 0x638e, 0x6bce, 0x73cf,
-  0x840f, 0xcdb4, 0xff39, 0xf6f7, 0xeeb7, 0xee96, 0xee96, 0xe676,
-  0xe676, 0xde56, 0xde36, 0x4249, 0x4a6a, 0x52ab, 0x426a, 0x39c8,
-  0x39a8, 0x3987, 0x3166, 0x3987, 0x3987, 0x3986, 0x39a7, 0x39a7,
-  0x39a7, 0x39a7, 0x41e8, 0x4a49, 0x39e8, 0x41e8, 0x39c7, 0x39c7,
-  0x39c8, 0x41e8, 0x39e8, 0x39e8, 0x39c7, 0x39e8, 0x39c7, 0x4209,
-  0x39e8, 0x3a08, 0x4208, 0x39e8, 0x39c7, 0x39c7, 0x39c7, 0x41e8,
-  0x4208, 0x41e8, 0x39c8, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x39c7,
-  0x39c7, 0x39e8, 0x4208, 0x31a7, 0x39c7, 0x31a7, 0x39c7, 0x39c8,
-  0x39e8, 0x39e8, 0x39c8, 0x31a7, 0x39e8, 0x39e8, 0x39c8, 0x39c8,
-  0x39c8, 0x39e8, 0x39c8, 0x31a7, 0x39c8, 0x39c8, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x31c7, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31c7,
-  0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x39c7, 0x31e8, 0x39e8, 0x31c7,
-  0x31c8, 0x31c8, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a49,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x3a29, 0x426a, 0x4a8a,
-  0x4a6a, 0x4269, 0x4249, 0x4249, 0x4269, 0x4269, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x426a, 0x426a, 0x426a, 0x4aab,
-  0x4aab, 0x4aab, 0x52ec, 0x4acb, 0x4aaa, 0x4acb, 0x4aab, 0x532c,
-  0x530c, 0x4aeb, 0x4aab, 0x4acb, 0x4acb, 0x52ec, 0x530c, 0x532d,
-  0x530c, 0x530c, 0x530c, 0x5b4d, 0x5b4d, 0x532d, 0x532d, 0x534d,
-  0x5b4d, 0x5b6d, 0x5b6e, 0x63cf, 0x6c10, 0x6c10, 0x63cf, 0x6c10,
-  0x63cf, 0x6c30, 0x7471, 0x7c72, 0x7451, 0x6c30, 0x6c10, 0x7451,
-  0x7471, 0x7c92, 0x7c92, 0x7c92, 0x7cb2, 0x7c92, 0x7cd3, 0x7cb2,
-  0x84d3, 0x7cd3, 0x84f3, 0x8513, 0x8d34, 0x8534, 0x8d34, 0x8d54,
-  0x8d75, 0x9595, 0x9db5, 0x9df6, 0xa5f6, 0xae37, 0xae57, 0xb678,
-  0xb6b8, 0xbef9, 0xc71a, 0xcf7a, 0xd79b, 0xdfdc, 0xf7fd, 0xfffe,
-  0xeffc, 0xe7bc, 0xdf7c, 0xd75b, 0xd75a, 0xe75b, 0xdf39, 0xef7b,
-  0xf79b, 0xf79b, 0xf79a, 0xffdb, 0xe739, 0xe739, 0xef7a, 0xef39,
-  0xdeb7, 0xe6f8, 0xef5a, 0xef5a, 0xe719, 0xef5a, 0xdeb7, 0xc5d5,
-  0xd657, 0xd677, 0xd677, 0xbdf5, 0xc5f5, 0xce16, 0xbdd5, 0x94f3,
-  0x7c71, 0x5b8e, 0x5b8e, 0x5b6e, 0x5b6e, 0x638e, 0x73cf, 0x73ef,
-  0x7bef, 0xb532, 0xff38, 0xf718, 0xeed7, 0xde55, 0xd5f4, 0xd5f4,
-  0xde35, 0xe656, 0xde56, 0x3a29, 0x424a, 0x3a09, 0x31a7, 0x39a7,
-  0x39a7, 0x3187, 0x3186, 0x3166, 0x39a7, 0x39a7, 0x41c7, 0x39a7,
-  0x39c7, 0x4208, 0x4209, 0x41e8, 0x41e8, 0x39c7, 0x41e8, 0x4a49,
-  0x4208, 0x39e8, 0x39c8, 0x39c7, 0x39e8, 0x4208, 0x39e8, 0x39e8,
-  0x4208, 0x4208, 0x4208, 0x39e8, 0x3a08, 0x39e8, 0x39c7, 0x39e7,
-  0x41e8, 0x39c7, 0x41e8, 0x41e8, 0x39c8, 0x39a7, 0x39c7, 0x39a7,
-  0x41e8, 0x39e8, 0x31a7, 0x39c7, 0x39c8, 0x31a7, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c8,
-  0x39e8, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39e8, 0x39c8, 0x39c7,
-  0x39c7, 0x31c7, 0x31c7, 0x31c7, 0x31a7, 0x31a7, 0x31c7, 0x31c7,
-  0x31c7, 0x31c7, 0x31c7, 0x39c7, 0x39c7, 0x31c7, 0x31e8, 0x31e7,
-  0x31c8, 0x31e8, 0x39e8, 0x39e8, 0x3a09, 0x3a29, 0x3a09, 0x3a49,
-  0x428a, 0x426a, 0x4249, 0x4249, 0x4a8a, 0x426a, 0x426a, 0x426a,
-  0x4269, 0x4249, 0x4249, 0x4249, 0x4249, 0x4a8a, 0x4249, 0x4269,
-  0x3a29, 0x4249, 0x4249, 0x424a, 0x4269, 0x426a, 0x426a, 0x4aab,
-  0x4aab, 0x4aab, 0x4aab, 0x4acb, 0x4aaa, 0x4aab, 0x4acb, 0x4acb,
-  0x4aaa, 0x4aab, 0x4aab, 0x4acb, 0x4aab, 0x4acb, 0x4acb, 0x530c,
-  0x530c, 0x532c, 0x530c, 0x532d, 0x530c, 0x532d, 0x5b4d, 0x5b6e,
-  0x63ae, 0x63cf, 0x63af, 0x63cf, 0x63af, 0x63cf, 0x63ef, 0x7431,
-  0x6c10, 0x7451, 0x7c72, 0x7471, 0x6c30, 0x7451, 0x7431, 0x7451,
-  0x7451, 0x7c92, 0x7c92, 0x7c92, 0x7c92, 0x7cb2, 0x7cd2, 0x7cb2,
-  0x7cd3, 0x8513, 0x8513, 0x8513, 0x8513, 0x8513, 0x8d34, 0x8d75,
-  0x9575, 0x9595, 0x9db6, 0x9dd6, 0xa616, 0xae37, 0xae57, 0xb698,
-  0xb6b9, 0xbef9, 0xc73a, 0xcf7b, 0xd7bb, 0xe7dc, 0xf7fd, 0xfffd,
-  0xeffc, 0xe79c, 0xdf7c, 0xd75b, 0xdf5a, 0xe75a, 0xe73a, 0xf77b,
-  0xf77b, 0xf79b, 0xf79a, 0xffdb, 0xe718, 0xe739, 0xef5a, 0xef5a,
-  0xded8, 0xe6f8, 0xe739, 0xf77a, 0xe6f8, 0xef39, 0xd697, 0xc616,
-  0xce36, 0xe6f8, 0xd677, 0xc616, 0xc5f5, 0xce16, 0xb594, 0x9513,
-  0x7451, 0x5b8e, 0x5b8e, 0x5b6e, 0x5b8e, 0x63ae, 0x73ef, 0x7bef,
-  0x842f, 0x942f, 0xeed7, 0xff58, 0xff18, 0xf6f8, 0xe676, 0xe676,
-  0xe696, 0xe676, 0xe656, 0x39e8, 0x31a7, 0x39c8, 0x39c8, 0x39c8,
-  0x3987, 0x3187, 0x3187, 0x3186, 0x3186, 0x39a7, 0x39a7, 0x39a7,
-  0x3186, 0x39e8, 0x4208, 0x39e8, 0x4208, 0x5b0c, 0x4208, 0x39c8,
-  0x39c8, 0x39c8, 0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x4209, 0x4229, 0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x4228, 0x3a08, 0x41e8, 0x39e8, 0x39c8, 0x39c8, 0x39c7, 0x39c8,
-  0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39c7, 0x31a7, 0x39c7, 0x39c7,
-  0x39e8, 0x39e8, 0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x39c8, 0x39c8,
-  0x39c8, 0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x39c7,
-  0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7,
-  0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x39c7, 0x31c7, 0x39e8,
-  0x31e8, 0x31e8, 0x3a08, 0x3a08, 0x3a28, 0x3a29, 0x3a29, 0x3a49,
-  0x5b4d, 0x4aaa, 0x426a, 0x428a, 0x426a, 0x4249, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4229, 0x3a29, 0x3a28,
-  0x4249, 0x4249, 0x4249, 0x426a, 0x426a, 0x426a, 0x428a, 0x4a8a,
-  0x4acb, 0x4acb, 0x4acb, 0x52ec, 0x4aab, 0x4acb, 0x4acb, 0x4aaa,
-  0x42aa, 0x4acb, 0x4aab, 0x4acb, 0x4aab, 0x4acb, 0x52ec, 0x52ec,
-  0x4aec, 0x530c, 0x532c, 0x532d, 0x532d, 0x530d, 0x532d, 0x532d,
-  0x5b4d, 0x5b8e, 0x6bf0, 0x63af, 0x63af, 0x6bf0, 0x6c30, 0x7451,
-  0x6c10, 0x6c10, 0x7c92, 0x6bf0, 0x63cf, 0x6c10, 0x6c10, 0x63ef,
-  0x7451, 0x84f3, 0x8d14, 0x7472, 0x7cb2, 0x7cb2, 0x7cb2, 0x84d3,
-  0x84f3, 0x7cf3, 0x8513, 0x8513, 0x84f3, 0x8534, 0x8d54, 0x9575,
-  0x9574, 0x9595, 0x9dd6, 0xa5f6, 0xa616, 0xae37, 0xae58, 0xb698,
-  0xbed9, 0xc719, 0xc73a, 0xcf7b, 0xd7bb, 0xe7dc, 0xf7fd, 0xfffd,
-  0xeffc, 0xe79c, 0xdf7c, 0xdf5b, 0xdf5a, 0xe75a, 0xe73a, 0xf79b,
-  0xf77a, 0xf79b, 0xf7bb, 0xffdb, 0xe719, 0xef59, 0xef39, 0xef59,
-  0xded8, 0xe6f8, 0xef5a, 0xef5a, 0xe719, 0xe739, 0xd697, 0xc616,
-  0xce56, 0xe6f9, 0xce56, 0xc616, 0xc5d5, 0xd657, 0xad74, 0x9d33,
-  0x7451, 0x5b8e, 0x5b6e, 0x5b6e, 0x63ae, 0x6bce, 0x73ef, 0x73ef,
-  0x842f, 0x9c6f, 0xf717, 0xff58, 0xff18, 0xf6f7, 0xf6f7, 0xf6d7,
-  0xeeb7, 0xe696, 0xe676, 0x424a, 0x3a09, 0x31a7, 0x39a8, 0x3187,
-  0x3187, 0x3187, 0x3187, 0x3986, 0x3987, 0x39a7, 0x39a7, 0x39a7,
-  0x31a6, 0x31a6, 0x39c7, 0x39c7, 0x4a49, 0x634d, 0x39c8, 0x39c8,
-  0x39e8, 0x39c8, 0x41e8, 0x39c8, 0x4208, 0x39e8, 0x4208, 0x4208,
-  0x4229, 0x4229, 0x4229, 0x4208, 0x4208, 0x4208, 0x4208, 0x3a08,
-  0x4249, 0x3a08, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x4208, 0x3a08,
-  0x39e8, 0x39e8, 0x39e8, 0x39c7, 0x31c7, 0x31a7, 0x39c7, 0x39e8,
-  0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39c7,
-  0x39c7, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x31c7, 0x31c7, 0x39e8,
-  0x39e8, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31a7, 0x39e8, 0x31c7,
-  0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x39c7, 0x39e8,
-  0x31e7, 0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x3a08, 0x3a29, 0x3a29,
-  0x3a49, 0x3a49, 0x4249, 0x426a, 0x4a8a, 0x4249, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4229, 0x4249, 0x4229, 0x3a08, 0x3a29,
-  0x4249, 0x4249, 0x426a, 0x4249, 0x4aaa, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x4aaa, 0x4acb, 0x4aab, 0x4a8a, 0x4a8a, 0x426a, 0x426a,
-  0x42aa, 0x4a8a, 0x4aaa, 0x4aab, 0x4acb, 0x52ec, 0x4aab, 0x4acb,
-  0x52ec, 0x52ec, 0x4aeb, 0x4aec, 0x530c, 0x532d, 0x4aec, 0x532d,
-  0x532d, 0x5b8e, 0x5b8e, 0x5b8e, 0x5bae, 0x6c10, 0x6c10, 0x6c10,
-  0x6c10, 0x6c10, 0x6bf0, 0x6bf0, 0x63ef, 0x6c10, 0x6c10, 0x6c10,
-  0x6c31, 0x7471, 0x7471, 0x7c92, 0x7cb2, 0x84d3, 0x84d3, 0x7cd3,
-  0x84f3, 0x84f3, 0x8513, 0x84f3, 0x8d54, 0x8d34, 0x8d54, 0x8d54,
-  0x9595, 0x95b5, 0x9db6, 0xa5f6, 0xa616, 0xae37, 0xb678, 0xb698,
-  0xbed9, 0xc719, 0xcf3a, 0xcf7b, 0xd7bb, 0xe7db, 0xf7fd, 0xf7fd,
-  0xeffc, 0xe79c, 0xe77b, 0xdf5a, 0xe75a, 0xe75a, 0xef5a, 0xf7bb,
-  0xf79b, 0xffbb, 0xf7bb, 0xf7bb, 0xe719, 0xf75a, 0xef39, 0xef39,
-  0xe6d8, 0xe6f8, 0xef7a, 0xef5a, 0xef39, 0xef3a, 0xd697, 0xc5f5,
-  0xd677, 0xe6f8, 0xce16, 0xc5f5, 0xb594, 0xce36, 0xa554, 0xa554,
-  0x7430, 0x5b8e, 0x638e, 0x5b8e, 0x63ae, 0x73ef, 0x7bef, 0x7bef,
-  0x842f, 0xacd0, 0xff38, 0xff58, 0xff18, 0xf6f7, 0xf6f7, 0xeed7,
-  0xeeb7, 0xee97, 0xe676, 0x3a09, 0x424a, 0x2966, 0x3187, 0x3987,
-  0x3167, 0x3987, 0x3187, 0x3166, 0x3187, 0x39a7, 0x41c7, 0x39a7,
-  0x39a7, 0x39a7, 0x39c7, 0x39c7, 0x39c8, 0x39c8, 0x39e8, 0x39c8,
-  0x39e8, 0x4208, 0x39e8, 0x41e8, 0x41e8, 0x39e8, 0x4208, 0x4208,
-  0x4229, 0x4229, 0x4a49, 0x4208, 0x4208, 0x3a08, 0x4229, 0x4249,
-  0x3a08, 0x39c7, 0x39c7, 0x39c8, 0x39e8, 0x39e8, 0x4229, 0x4208,
-  0x39c7, 0x4208, 0x39c8, 0x39e8, 0x39c7, 0x39c8, 0x39c8, 0x39e8,
-  0x39e8, 0x4229, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39c7, 0x31c7,
-  0x39e8, 0x39c7, 0x31c7, 0x31c7, 0x31a7, 0x31c7, 0x31c7, 0x31c7,
-  0x31c7, 0x31c7, 0x39c7, 0x31c7, 0x31c7, 0x39c7, 0x39c7, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x3a29, 0x4249, 0x4249, 0x426a, 0x4249, 0x3a29, 0x3a29, 0x4249,
-  0x4229, 0x4229, 0x4229, 0x3a29, 0x4229, 0x4249, 0x4229, 0x4229,
-  0x3a29, 0x4249, 0x4249, 0x4249, 0x4a8a, 0x426a, 0x426a, 0x426a,
-  0x4a8a, 0x4269, 0x428a, 0x428a, 0x426a, 0x428a, 0x426a, 0x428a,
-  0x428a, 0x428a, 0x4a8a, 0x4a8a, 0x4aab, 0x532c, 0x5b4d, 0x4aab,
-  0x4acb, 0x4acb, 0x530c, 0x530c, 0x4acb, 0x530c, 0x530c, 0x532d,
-  0x5b4d, 0x534d, 0x534d, 0x63af, 0x6bef, 0x63cf, 0x63ef, 0x63ef,
-  0x63cf, 0x6c10, 0x6c10, 0x6bf0, 0x6c10, 0x6c10, 0x63f0, 0x6c30,
-  0x6c30, 0x6c30, 0x6c30, 0x7471, 0x7c92, 0x84f3, 0x84f3, 0x84f3,
-  0x7cd2, 0x7cf3, 0x7cd3, 0x7cd3, 0x8513, 0x8d34, 0x8d54, 0x9575,
-  0x9595, 0x9595, 0x9dd6, 0xa5f6, 0xa616, 0xae37, 0xb678, 0xb698,
-  0xbed9, 0xc71a, 0xcf3a, 0xd77b, 0xd7bb, 0xe7dc, 0xf7fd, 0xf7fc,
-  0xeffc, 0xe79c, 0xe79b, 0xdf5b, 0xef7b, 0xef5a, 0xef7a, 0xf7bb,
-  0xf79b, 0xf7bb, 0xf7bb, 0xf79b, 0xef39, 0xf77a, 0xef59, 0xef5a,
-  0xe6d8, 0xe6d8, 0xef39, 0xef5a, 0xef5a, 0xe6f8, 0xd698, 0xc616,
-  0xd677, 0xded8, 0xce56, 0xc5f5, 0xb574, 0xc5f6, 0x9d13, 0xa554,
-  0x7430, 0x5bae, 0x63af, 0x638e, 0x6bce, 0x73cf, 0x7c0f, 0x7c0f,
-  0x842f, 0xb4f1, 0xff38, 0xff58, 0xf717, 0xf6f7, 0xf6f7, 0xee96,
-  0xe655, 0xe676, 0xe676, 0x39e9, 0x39c8, 0x2946, 0x3987, 0x3167,
-  0x3166, 0x3167, 0x3166, 0x3166, 0x3187, 0x39a7, 0x3987, 0x39a7,
-  0x39c8, 0x39a7, 0x39a7, 0x39c8, 0x39e8, 0x39c7, 0x4229, 0x4208,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x4208, 0x4209, 0x3a08, 0x3a08,
-  0x4209, 0x4209, 0x39e8, 0x4229, 0x4209, 0x3a08, 0x3a08, 0x39e8,
-  0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39e8, 0x39e8, 0x4209, 0x4208,
-  0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x4208, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x39e8, 0x3a08, 0x4229, 0x4229, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7,
-  0x31c7, 0x31c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c8, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x3a28, 0x4229, 0x4229, 0x4229, 0x4229,
-  0x3a29, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4229,
-  0x4249, 0x4249, 0x4249, 0x4229, 0x4229, 0x4249, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4269, 0x4249, 0x4269, 0x4269, 0x4269,
-  0x4269, 0x426a, 0x4a8a, 0x428a, 0x4269, 0x4aaa, 0x4269, 0x426a,
-  0x426a, 0x428a, 0x428a, 0x428a, 0x42aa, 0x4acb, 0x4aab, 0x4aaa,
-  0x4aab, 0x4aab, 0x4aeb, 0x4aec, 0x4aec, 0x530c, 0x4aec, 0x530c,
-  0x530c, 0x534d, 0x5b6e, 0x5b8e, 0x63ef, 0x6bf0, 0x6bf0, 0x6c30,
-  0x6bef, 0x6c10, 0x6bf0, 0x6c10, 0x6c10, 0x6bf0, 0x6c30, 0x6c30,
-  0x6c30, 0x6c30, 0x6c30, 0x7471, 0x7c92, 0x7cb2, 0x7c92, 0x7cd2,
-  0x7cd3, 0x7cd3, 0x7cd2, 0x84f3, 0x84f3, 0x8d34, 0x8d54, 0x9574,
-  0x9575, 0x9595, 0x9dd6, 0xa5f6, 0xae37, 0xae57, 0xb698, 0xb6b8,
-  0xbef9, 0xc71a, 0xcf5a, 0xd77b, 0xd7bb, 0xe7dc, 0xf7fd, 0xf7fc,
-  0xeffc, 0xdf9b, 0xe79b, 0xe75b, 0xef7b, 0xef5a, 0xf79b, 0xffbb,
-  0xf79a, 0xf79b, 0xffbb, 0xf79b, 0xef5a, 0xf75a, 0xef39, 0xf759,
-  0xe6d8, 0xe6f8, 0xe719, 0xef39, 0xef5a, 0xe6f8, 0xce56, 0xc616,
-  0xd677, 0xdeb7, 0xd677, 0xc5f5, 0xb594, 0xc5d5, 0x9cf3, 0x9d13,
-  0x7450, 0x63cf, 0x63cf, 0x5b8e, 0x6bce, 0x740f, 0x7bef, 0x7c0f,
-  0x8450, 0xc552, 0xff38, 0xff59, 0xeed7, 0xf6f7, 0xf6f7, 0xf6d7,
-  0xeeb7, 0xeeb7, 0xeeb7, 0x31c8, 0x3187, 0x3146, 0x3987, 0x3187,
-  0x3166, 0x3167, 0x3987, 0x3187, 0x3987, 0x39a7, 0x39c7, 0x39c7,
-  0x39a7, 0x39e8, 0x3987, 0x39c8, 0x39e8, 0x39e8, 0x4208, 0x4208,
-  0x39e8, 0x39e8, 0x4209, 0x3a08, 0x4208, 0x4229, 0x39e8, 0x39e8,
-  0x4209, 0x4229, 0x4209, 0x4209, 0x3a08, 0x3a08, 0x4229, 0x4229,
-  0x4a8a, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39e8, 0x39e8,
-  0x39e8, 0x39c7, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x39c8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39c7, 0x39c8,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x31c7, 0x39c7,
-  0x31c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7,
-  0x39e8, 0x3a08, 0x39e8, 0x3a08, 0x4249, 0x4229, 0x3a28, 0x3a28,
-  0x3a29, 0x3a29, 0x3a29, 0x4249, 0x4249, 0x4249, 0x3a29, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4229, 0x4229, 0x3a29, 0x4249,
-  0x4249, 0x4249, 0x4269, 0x4249, 0x4269, 0x428a, 0x426a, 0x4269,
-  0x428a, 0x4a8a, 0x426a, 0x428a, 0x428a, 0x428a, 0x4269, 0x426a,
-  0x426a, 0x428a, 0x428a, 0x4acb, 0x4a8a, 0x4acb, 0x4aab, 0x428a,
-  0x4aaa, 0x4aab, 0x4acb, 0x530c, 0x530c, 0x530c, 0x530c, 0x532d,
-  0x532d, 0x5b6e, 0x5b6e, 0x5b8e, 0x6c30, 0x6c10, 0x6c10, 0x6bf0,
-  0x63ef, 0x63cf, 0x63ef, 0x63ef, 0x6c10, 0x6c10, 0x6c30, 0x6c30,
-  0x7451, 0x7431, 0x7451, 0x7471, 0x7cb2, 0x84d2, 0x8513, 0x7cd2,
-  0x7cb2, 0x7cb2, 0x84f3, 0x84f3, 0x8d34, 0x9575, 0x8d54, 0x9575,
-  0x9595, 0x9dd6, 0xa5f6, 0xa617, 0xae37, 0xae77, 0xb698, 0xbed9,
-  0xbef9, 0xc739, 0xcf5a, 0xd77b, 0xd7bb, 0xe7dc, 0xf7fd, 0xf7fc,
-  0xefdc, 0xe79b, 0xef7b, 0xe75b, 0xef9b, 0xef7a, 0xf7bb, 0xf7ba,
-  0xf79a, 0xf79b, 0xffbb, 0xf77a, 0xf77a, 0xf75a, 0xef59, 0xf75a,
-  0xe6f8, 0xe6d8, 0xe719, 0xe719, 0xef5a, 0xe718, 0xd677, 0xc5f6,
-  0xdeb8, 0xde97, 0xce56, 0xbdf5, 0xbdb5, 0xbdd5, 0x8cb2, 0x8cb2,
-  0x7410, 0x7c91, 0x6bf0, 0x5b6e, 0x63ae, 0x73ef, 0x73ce, 0x7c0f,
-  0x8430, 0xc552, 0xff78, 0xff59, 0xf6f7, 0xf6f7, 0xf6f7, 0xf6f7,
-  0xf6d7, 0xf6d7, 0xf6b7, 0x39e9, 0x39e9, 0x3188, 0x31a7, 0x3187,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3987, 0x3987, 0x39c7,
-  0x39a7, 0x5aec, 0x4208, 0x39a7, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x4208, 0x3a08, 0x4209, 0x4209, 0x3a08, 0x3a08, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4209, 0x4208, 0x39e8, 0x3a08, 0x39e8, 0x3a08,
-  0x4229, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39e8,
-  0x39c8, 0x39c7, 0x39e8, 0x3a08, 0x4229, 0x4229, 0x39e8, 0x39e8,
-  0x39e8, 0x4229, 0x4a6a, 0x4208, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39c7, 0x39c7,
-  0x39c7, 0x31c7, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39e8, 0x39c8, 0x39c7, 0x39c8, 0x39c7, 0x39c8,
-  0x39e8, 0x39c7, 0x39e8, 0x3a08, 0x4a8a, 0x4229, 0x3a29, 0x4229,
-  0x4269, 0x4269, 0x4269, 0x4269, 0x4249, 0x4269, 0x3a29, 0x4229,
-  0x4229, 0x4229, 0x4249, 0x4249, 0x4249, 0x4249, 0x4269, 0x4249,
-  0x4229, 0x4249, 0x4a8a, 0x4249, 0x4249, 0x428a, 0x426a, 0x4269,
-  0x4269, 0x426a, 0x4a8a, 0x4aab, 0x426a, 0x428a, 0x428a, 0x426a,
-  0x4aaa, 0x428a, 0x426a, 0x4aab, 0x4acb, 0x4aaa, 0x428a, 0x4aab,
-  0x4acb, 0x4aab, 0x4acb, 0x52ec, 0x4aec, 0x5b4d, 0x530c, 0x532d,
-  0x534d, 0x532d, 0x534d, 0x5b6e, 0x5b8e, 0x5bae, 0x63ae, 0x63cf,
-  0x63cf, 0x6bf0, 0x6bef, 0x63ef, 0x6c30, 0x6c10, 0x6c30, 0x7451,
-  0x7451, 0x7430, 0x7471, 0x7492, 0x8d34, 0x84d3, 0x7cd2, 0x7491,
-  0x7cd2, 0x7cd2, 0x8513, 0x8513, 0x8d54, 0x9574, 0x9575, 0x9575,
-  0x9595, 0x9dd6, 0xa5d6, 0xa5f6, 0xae37, 0xb678, 0xb698, 0xbeb9,
-  0xbef9, 0xc73a, 0xcf5a, 0xd79b, 0xd7bb, 0xe7dc, 0xfffd, 0xf7fc,
-  0xefdc, 0xe77b, 0xef7b, 0xe75a, 0xf79b, 0xf77a, 0xffbb, 0xf79a,
-  0xff9a, 0xf7ba, 0xffbb, 0xf79a, 0xff9b, 0xf77a, 0xf75a, 0xef59,
-  0xef19, 0xe6d7, 0xe719, 0xe719, 0xef39, 0xded8, 0xded8, 0xc616,
-  0xd677, 0xde97, 0xce56, 0xbdb4, 0xb574, 0xb595, 0x8451, 0x8471,
-  0x7410, 0x84b2, 0x6bcf, 0x638e, 0x6bce, 0x73ef, 0x7bef, 0x7c30,
-  0x842f, 0xc5b3, 0xff99, 0xff59, 0xe696, 0xf6d7, 0xf6f7, 0xf6f7,
-  0xf6d7, 0xf6d7, 0xf6d7, 0x31c8, 0x31c9, 0x5b8f, 0x31c7, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3987, 0x3186, 0x39a7, 0x3987, 0x39a7,
-  0x39a7, 0x5aab, 0x52ab, 0x31a7, 0x39e8, 0x4208, 0x3a08, 0x39e8,
-  0x3a08, 0x4209, 0x4208, 0x41e8, 0x4209, 0x4208, 0x4208, 0x3a08,
-  0x4208, 0x4208, 0x4208, 0x4229, 0x4229, 0x39e8, 0x4208, 0x39e8,
-  0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08,
-  0x39e8, 0x3a08, 0x4a8a, 0x4229, 0x39c8, 0x39e8, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x31c7, 0x39c7, 0x39e8, 0x3a08, 0x4229, 0x3a08, 0x4249, 0x4249,
-  0x4249, 0x4269, 0x428a, 0x4a8a, 0x4a8a, 0x3a29, 0x3a29, 0x4229,
-  0x4249, 0x4249, 0x4269, 0x426a, 0x4a6a, 0x4269, 0x4229, 0x4229,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4269, 0x426a, 0x426a, 0x4269,
-  0x4269, 0x428a, 0x4aab, 0x4aab, 0x428a, 0x426a, 0x428a, 0x4aab,
-  0x428a, 0x4aaa, 0x428a, 0x428a, 0x428a, 0x4aab, 0x428a, 0x4aab,
-  0x4aab, 0x4aab, 0x4acc, 0x4acb, 0x4aec, 0x530c, 0x4b0c, 0x4b0c,
-  0x534d, 0x5b6d, 0x5b6e, 0x5b8e, 0x5bae, 0x5b8e, 0x63af, 0x63cf,
-  0x63cf, 0x6bf0, 0x6bf0, 0x6c30, 0x6c30, 0x6c30, 0x7450, 0x7451,
-  0x7471, 0x7c91, 0x7c92, 0x7cb2, 0x84f3, 0x84f3, 0x7cb2, 0x7cd2,
-  0x84d2, 0x84d3, 0x84f3, 0x8d34, 0x8d34, 0x8d34, 0x9575, 0x9595,
-  0x9dd6, 0x9dd6, 0xa5f6, 0xae17, 0xae37, 0xae77, 0xb698, 0xbed9,
-  0xbef9, 0xc73a, 0xcf5a, 0xd79b, 0xd7bb, 0xefdc, 0xfffd, 0xf7fc,
-  0xefdc, 0xe77b, 0xe77b, 0xe75a, 0xef7a, 0xf79a, 0xffdb, 0xf79a,
-  0xf79a, 0xf7ba, 0xffbb, 0xf79a, 0xffbb, 0xf77a, 0xf77a, 0xf759,
-  0xef19, 0xdeb7, 0xe6d8, 0xe719, 0xef59, 0xded8, 0xd6b7, 0xc5f5,
-  0xd677, 0xdeb8, 0xce56, 0xbdd5, 0xbdb5, 0xad33, 0x7c50, 0x7c51,
-  0x7410, 0x7450, 0x63ae, 0x638f, 0x6bef, 0x73ef, 0x73ef, 0x7c30,
-  0x842f, 0xcdf4, 0xffda, 0xef18, 0xa4d1, 0xeeb7, 0xf717, 0xf6d7,
-  0xf6d7, 0xf6d7, 0xf6d7, 0x3187, 0x31c8, 0x31e8, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3987, 0x3186, 0x3186, 0x39c7, 0x39a7, 0x39a7,
-  0x39a7, 0x4a49, 0x5aec, 0x31a7, 0x4208, 0x4229, 0x4229, 0x4a49,
-  0x4a49, 0x4229, 0x4229, 0x4229, 0x4a49, 0x4249, 0x4249, 0x4208,
-  0x4208, 0x4208, 0x4209, 0x4209, 0x4229, 0x3a08, 0x4208, 0x39e8,
-  0x39c7, 0x39c8, 0x39c8, 0x31c7, 0x39c8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x4229, 0x39e8, 0x39c7, 0x39e8, 0x39c8, 0x39c7,
-  0x39c7, 0x39c8, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x31e8,
-  0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x3a29, 0x4229, 0x4249,
-  0x4249, 0x426a, 0x4aab, 0x4a8a, 0x4aaa, 0x4269, 0x4249, 0x4249,
-  0x4249, 0x4269, 0x426a, 0x4269, 0x426a, 0x4249, 0x4229, 0x4249,
-  0x4249, 0x4249, 0x3a29, 0x4249, 0x4249, 0x426a, 0x4249, 0x4249,
-  0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4aab, 0x4a8a, 0x4acb, 0x428a,
-  0x428a, 0x42aa, 0x428a, 0x428a, 0x428a, 0x4aaa, 0x4acb, 0x4aab,
-  0x4aab, 0x4acb, 0x4acb, 0x52ec, 0x4b0c, 0x4aec, 0x4b0c, 0x534d,
-  0x532d, 0x5b6d, 0x5b6d, 0x5b8e, 0x63cf, 0x63ae, 0x63cf, 0x63cf,
-  0x6c10, 0x6bf0, 0x6c30, 0x6c30, 0x6c30, 0x7451, 0x7471, 0x7471,
-  0x7491, 0x7cb2, 0x7cb2, 0x7cd2, 0x7cd2, 0x84f3, 0x8d14, 0x8d34,
-  0x9534, 0x84f3, 0x8d34, 0x8d34, 0x9575, 0x9574, 0x9575, 0x9595,
-  0x95b5, 0x9dd6, 0xa5f6, 0xa617, 0xae57, 0xb678, 0xb6b8, 0xbed9,
-  0xc6f9, 0xc73a, 0xcf5a, 0xd79b, 0xd7bb, 0xefdc, 0xfffd, 0xf7fc,
-  0xefdc, 0xe79b, 0xe77b, 0xe75a, 0xef5a, 0xf79a, 0xffdb, 0xf79a,
-  0xf79a, 0xffba, 0xff9b, 0xf79a, 0xffbb, 0xf77a, 0xf77a, 0xf77a,
-  0xef39, 0xdeb7, 0xdeb7, 0xdeb8, 0xef5a, 0xe719, 0xdeb8, 0xc5f6,
-  0xd697, 0xdeb7, 0xc616, 0xbdd5, 0xbdb5, 0xa4f2, 0x7c30, 0x7c50,
-  0x73ef, 0x63ae, 0x638f, 0x63af, 0x6bef, 0x73ef, 0x73ce, 0x7c2f,
-  0x8c50, 0xd655, 0xffda, 0xe6d8, 0xa4f2, 0xf6f8, 0xff38, 0xf717,
-  0xf6f7, 0xf6d7, 0xf6d7, 0x2946, 0x2946, 0x2946, 0x3146, 0x3146,
-  0x3166, 0x3987, 0x3166, 0x3187, 0x3987, 0x39a7, 0x3186, 0x3986,
-  0x39a7, 0x39e8, 0x39e8, 0x39e8, 0x4208, 0x4229, 0x4a6a, 0x4a6a,
-  0x4229, 0x4209, 0x4a49, 0x4a49, 0x4a6a, 0x4a49, 0x4229, 0x4209,
-  0x4208, 0x4208, 0x4208, 0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39c8,
-  0x39c8, 0x39c8, 0x39c8, 0x39c7, 0x39e8, 0x39c8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39c8,
-  0x39e8, 0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a09, 0x4a6a, 0x3a08, 0x3a08,
-  0x3a28, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a29, 0x3a29,
-  0x3a29, 0x4a8a, 0x52cb, 0x4269, 0x4269, 0x4a8a, 0x4249, 0x4249,
-  0x4269, 0x4a6a, 0x4269, 0x4a8a, 0x4269, 0x3a29, 0x4249, 0x4269,
-  0x4249, 0x4249, 0x4269, 0x4269, 0x4249, 0x428a, 0x426a, 0x426a,
-  0x4a8a, 0x428a, 0x428a, 0x428a, 0x428a, 0x4aaa, 0x428a, 0x428a,
-  0x4aaa, 0x428a, 0x428a, 0x4aaa, 0x4aab, 0x4aab, 0x4acb, 0x4acb,
-  0x4acb, 0x532c, 0x4aec, 0x4aeb, 0x4aec, 0x4aec, 0x532d, 0x5b4d,
-  0x534d, 0x63ae, 0x5b8e, 0x5b8e, 0x63af, 0x63cf, 0x5baf, 0x63af,
-  0x63ef, 0x6c10, 0x6c30, 0x6c30, 0x7451, 0x7451, 0x7491, 0x7c92,
-  0x7c92, 0x7cb2, 0x84d2, 0x84d3, 0x84f3, 0x8d13, 0x8d34, 0x8d34,
-  0x8d54, 0x8d34, 0x8d34, 0x9554, 0x9575, 0x9554, 0x9575, 0x9595,
-  0x9db5, 0xa5f6, 0xa616, 0xae17, 0xae37, 0xb678, 0xb698, 0xbed9,
-  0xc6fa, 0xc73a, 0xcf5b, 0xd77b, 0xd79b, 0xefdc, 0xfffc, 0xf7fc,
-  0xefbc, 0xe79c, 0xe75b, 0xe73a, 0xef5a, 0xf79a, 0xffdb, 0xf79a,
-  0xf79a, 0xffba, 0xff9a, 0xf79a, 0xffdb, 0xf77a, 0xf77a, 0xf77a,
-  0xf77a, 0xe6f8, 0xdeb7, 0xde97, 0xef39, 0xef39, 0xdeb8, 0xc5f6,
-  0xd697, 0xdeb7, 0xbdd5, 0xbdb5, 0xbdd5, 0x9cd2, 0x7c50, 0x7c30,
-  0x6bef, 0x63ae, 0x6baf, 0x6baf, 0x73ef, 0x740f, 0x73ef, 0x8430,
-  0x9470, 0xe6d7, 0xffda, 0xb553, 0x7c0f, 0xd635, 0xff58, 0xf717,
-  0xf717, 0xf6f7, 0xf6f7, 0x2946, 0x2926, 0x2926, 0x2946, 0x3146,
-  0x3166, 0x3966, 0x3986, 0x3987, 0x39a7, 0x39a7, 0x3186, 0x39a7,
-  0x39c8, 0x4208, 0x4208, 0x41e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x4208, 0x4229, 0x4229, 0x4249, 0x4a6a, 0x4a49, 0x4249, 0x4a49,
-  0x4209, 0x41e8, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39c8,
-  0x39c8, 0x39c8, 0x39c8, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x39c8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x4208, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a09, 0x4a6a, 0x3a29, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a29, 0x4249,
-  0x4249, 0x4269, 0x52cb, 0x426a, 0x4269, 0x4249, 0x4229, 0x4249,
-  0x4269, 0x4269, 0x4269, 0x4269, 0x4269, 0x4269, 0x4a8a, 0x4a8a,
-  0x4249, 0x4269, 0x4249, 0x4249, 0x4249, 0x4269, 0x428a, 0x426a,
-  0x4a8a, 0x428a, 0x4aab, 0x4aab, 0x4aab, 0x4aaa, 0x42aa, 0x4aab,
-  0x4acb, 0x4aab, 0x4aab, 0x4acb, 0x52ec, 0x530c, 0x530c, 0x530c,
-  0x5b4d, 0x530c, 0x530c, 0x532d, 0x532d, 0x5b4d, 0x534d, 0x5b4d,
-  0x5b8e, 0x5b4d, 0x63af, 0x63af, 0x5b6e, 0x63ae, 0x63cf, 0x63ef,
-  0x63f0, 0x6c10, 0x7451, 0x7471, 0x7471, 0x7c92, 0x7cb2, 0x7cd2,
-  0x84b2, 0x84d2, 0x84f3, 0x8d13, 0x8d34, 0x8d54, 0x8d34, 0x8d13,
-  0x9554, 0x8d33, 0x9575, 0x9db6, 0x9554, 0x9575, 0x9d95, 0x9db5,
-  0x9dd6, 0x9dd6, 0xa5f6, 0xae37, 0xae57, 0xb678, 0xbeb8, 0xbed9,
-  0xc6fa, 0xc73a, 0xcf5b, 0xd77b, 0xd7bb, 0xefdc, 0xf7fc, 0xf7fc,
-  0xefbc, 0xe77b, 0xe75b, 0xe75a, 0xef5a, 0xf7ba, 0xffdb, 0xf79a,
-  0xff9a, 0xffba, 0xff9a, 0xffba, 0xffbb, 0xf77a, 0xf77a, 0xf77a,
-  0xf77a, 0xef39, 0xdeb8, 0xde97, 0xef39, 0xef39, 0xdeb8, 0xc5f6,
-  0xd697, 0xded8, 0xbdd5, 0xbdd5, 0xc5f6, 0x9cf2, 0x8470, 0x740f,
-  0x6bcf, 0x6baf, 0x73f0, 0x7c30, 0x740f, 0x7c50, 0x7c0f, 0x8c71,
-  0x94b1, 0xf758, 0xe719, 0x8450, 0x7c2f, 0xb552, 0xff58, 0xff38,
-  0xff18, 0xf717, 0xf6f7, 0x2946, 0x2926, 0x2946, 0x2946, 0x3146,
-  0x3166, 0x3166, 0x3987, 0x3987, 0x41c8, 0x41e8, 0x3186, 0x39a7,
-  0x41e8, 0x39c7, 0x39c7, 0x39c8, 0x41e8, 0x39c8, 0x39c8, 0x39e8,
-  0x4208, 0x4229, 0x4209, 0x4229, 0x4229, 0x4249, 0x4a49, 0x4229,
-  0x4208, 0x41e8, 0x39e8, 0x39c7, 0x39c8, 0x39c8, 0x39c8, 0x39c8,
-  0x39c8, 0x39c8, 0x39e8, 0x4249, 0x4aab, 0x39e8, 0x3a08, 0x4209,
-  0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x3a08, 0x4208,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a08, 0x4229, 0x4aab, 0x5b2d, 0x3a29, 0x3a29,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a29,
-  0x4249, 0x428a, 0x4249, 0x3a49, 0x4249, 0x4249, 0x4269, 0x4269,
-  0x428a, 0x426a, 0x4249, 0x4a6a, 0x4aab, 0x4a8a, 0x4aab, 0x4a8a,
-  0x426a, 0x4269, 0x4269, 0x4249, 0x4269, 0x428a, 0x4aaa, 0x426a,
-  0x4a8a, 0x4acb, 0x4acb, 0x4aaa, 0x4acb, 0x4aab, 0x52ec, 0x52eb,
-  0x4acb, 0x4acb, 0x4acb, 0x530c, 0x530c, 0x532d, 0x532c, 0x530c,
-  0x5b6d, 0x5b4d, 0x5b4d, 0x5b4d, 0x5b6d, 0x5b8e, 0x5b6d, 0x638e,
-  0x5b6e, 0x5b8e, 0x63ae, 0x63ae, 0x5b8e, 0x63cf, 0x6bef, 0x63ef,
-  0x6c10, 0x6c30, 0x7451, 0x7471, 0x7c92, 0x7c92, 0x84d2, 0x84d3,
-  0x84d2, 0x84f3, 0x8d13, 0x8d13, 0x9534, 0x9554, 0x9575, 0x9554,
-  0x8d34, 0x9554, 0x9575, 0x9574, 0x9575, 0x9574, 0x9d95, 0x9db6,
-  0x9dd6, 0xa5f6, 0xae17, 0xae37, 0xb678, 0xb698, 0xbeb8, 0xbed9,
-  0xc71a, 0xcf3a, 0xcf5b, 0xd77b, 0xdf9c, 0xefdd, 0xf7dc, 0xf7fc,
-  0xefbc, 0xe77b, 0xe75b, 0xe73a, 0xef5a, 0xffba, 0xffdb, 0xf79a,
-  0xf79a, 0xffba, 0xff9a, 0xffbb, 0xffbb, 0xf77a, 0xf759, 0xf77a,
-  0xf77a, 0xef19, 0xd697, 0xd697, 0xe719, 0xef39, 0xdeb8, 0xce17,
-  0xd697, 0xe6d8, 0xbdd5, 0xbdb4, 0xc5d5, 0x9cd2, 0x7c30, 0x73ef,
-  0x740f, 0x6bcf, 0x740f, 0x740f, 0x7c2f, 0x7c50, 0x7bef, 0x8430,
-  0x9cb1, 0xff7a, 0xc5d5, 0x8450, 0x7c0e, 0x9c90, 0xf738, 0xff58,
-  0xff38, 0xff17, 0xff17, 0x2926, 0x3166, 0x3146, 0x3146, 0x3146,
-  0x3166, 0x3966, 0x3987, 0x3966, 0x3966, 0x3987, 0x3987, 0x3187,
-  0x4209, 0x39a7, 0x39a7, 0x39c7, 0x39c8, 0x39e8, 0x39c8, 0x39c8,
-  0x41e8, 0x4208, 0x4209, 0x4229, 0x4229, 0x4a4a, 0x4a4a, 0x4229,
-  0x4208, 0x39e8, 0x39c8, 0x39c7, 0x39c8, 0x39c8, 0x39c7, 0x39c7,
-  0x39c7, 0x39c8, 0x39c8, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x4209, 0x528a,
-  0x4a49, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a08, 0x4229, 0x530d, 0x4acb, 0x3a28, 0x3a28,
-  0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a29, 0x4a8a, 0x4249, 0x4229, 0x4249, 0x4269, 0x426a, 0x4a8a,
-  0x4aaa, 0x4269, 0x4269, 0x4a8a, 0x426a, 0x4a8a, 0x4aab, 0x4aaa,
-  0x4aaa, 0x4aaa, 0x428a, 0x4aaa, 0x4aaa, 0x4a8a, 0x4acb, 0x4aaa,
-  0x4aab, 0x4a8a, 0x428a, 0x42aa, 0x52eb, 0x4aaa, 0x4acb, 0x4acb,
-  0x530c, 0x530c, 0x52ec, 0x4aeb, 0x532c, 0x5b4d, 0x532d, 0x5b4d,
-  0x5b8e, 0x5b6d, 0x5b4d, 0x5b8e, 0x63ae, 0x63ae, 0x5b6d, 0x5b6d,
-  0x5b8e, 0x5b8d, 0x5b8e, 0x63ae, 0x63cf, 0x6bef, 0x6c10, 0x6c10,
-  0x6c10, 0x6c30, 0x7451, 0x7cb2, 0x84d3, 0x7c91, 0x84d2, 0x7cb2,
-  0x8d13, 0x8d13, 0x8d33, 0x8d34, 0x9554, 0x9554, 0x8d33, 0x9554,
-  0x8d54, 0x9575, 0x9554, 0x9575, 0x9574, 0x9d95, 0x9dd6, 0xa5f6,
-  0xa5d6, 0xa5f6, 0xae37, 0xae57, 0xb678, 0xb698, 0xbed9, 0xbef9,
-  0xc71a, 0xcf5a, 0xcf7b, 0xd79b, 0xdfbc, 0xf7dd, 0xf7dc, 0xf7dc,
-  0xefbc, 0xe77b, 0xe73b, 0xe73a, 0xef5a, 0xf79a, 0xffbb, 0xf7ba,
-  0xf77a, 0xffbb, 0xf79a, 0xffbb, 0xffbb, 0xf77a, 0xf77a, 0xf79a,
-  0xf779, 0xef18, 0xdeb7, 0xd697, 0xe719, 0xe719, 0xde97, 0xd657,
-  0xd677, 0xdeb7, 0xbdb5, 0xbdb4, 0xc5f5, 0x8c71, 0x73ef, 0x73ef,
-  0x8470, 0x740f, 0x7c0f, 0x7c0f, 0x7c0f, 0x7bef, 0x8c71, 0x8430,
-  0x9cd2, 0xff9b, 0x9491, 0x7c0f, 0x7bee, 0x946f, 0xf718, 0xff58,
-  0xff38, 0xff38, 0xf718, 0x2926, 0x2946, 0x3146, 0x3146, 0x3146,
-  0x3166, 0x3966, 0x3966, 0x3986, 0x3986, 0x3186, 0x3166, 0x3187,
-  0x39c7, 0x39a7, 0x3187, 0x39a7, 0x3187, 0x39c8, 0x41e8, 0x41e8,
-  0x41e8, 0x4209, 0x4209, 0x4209, 0x4a29, 0x4a49, 0x4a6a, 0x4a49,
-  0x4208, 0x39e8, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39c7,
-  0x39a7, 0x39c7, 0x39c7, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a08, 0x4229, 0x4229, 0x3a09, 0x4a6a, 0x6bae,
-  0x4aab, 0x4269, 0x3a29, 0x3a28, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x426a, 0x426a, 0x3a28, 0x4229,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x3a08, 0x3a08, 0x3a08,
-  0x3a29, 0x3a29, 0x4269, 0x4249, 0x4249, 0x426a, 0x426a, 0x4aaa,
-  0x428a, 0x4269, 0x426a, 0x4269, 0x4269, 0x426a, 0x4269, 0x4a8a,
-  0x52ab, 0x4aab, 0x52eb, 0x4aaa, 0x4aaa, 0x4a8a, 0x4aab, 0x4aab,
-  0x4aab, 0x4a8a, 0x4aab, 0x4aab, 0x52eb, 0x4acb, 0x52ec, 0x5b2c,
-  0x530c, 0x5b2d, 0x530c, 0x532c, 0x5b2d, 0x638e, 0x638e, 0x5b6d,
-  0x6bef, 0x6bcf, 0x638e, 0x6bcf, 0x6bcf, 0x63ae, 0x5b8e, 0x63cf,
-  0x63cf, 0x63ae, 0x63cf, 0x6c10, 0x6bef, 0x6c10, 0x6bef, 0x7430,
-  0x7430, 0x7451, 0x7451, 0x7cb2, 0x84d3, 0x84d2, 0x84d2, 0x8d13,
-  0x8d13, 0x9554, 0x9554, 0x9554, 0x9554, 0x9554, 0x8d34, 0x9554,
-  0x8d34, 0x9554, 0x9554, 0x9595, 0x9d95, 0x9dd6, 0x9dd6, 0xa5f6,
-  0xa617, 0xae17, 0xae37, 0xae57, 0xb678, 0xb698, 0xbed9, 0xc719,
-  0xc73a, 0xcf5a, 0xd77b, 0xd79b, 0xdfbc, 0xf7dd, 0xf7dc, 0xf7dc,
-  0xef9c, 0xe75b, 0xdf3b, 0xe73a, 0xf77a, 0xf79a, 0xff9b, 0xf79a,
-  0xf79a, 0xf79a, 0xf77a, 0xffdb, 0xffbb, 0xf75a, 0xf79a, 0xf79a,
-  0xf779, 0xef38, 0xdeb7, 0xdeb7, 0xe739, 0xef39, 0xdeb7, 0xd677,
-  0xded8, 0xd677, 0xc5f5, 0xbdb5, 0xbdd6, 0x8471, 0x73ef, 0x740f,
-  0x8cb1, 0x7c0f, 0x8c71, 0x842f, 0x7c0f, 0x8430, 0x94b1, 0x8430,
-  0x94b1, 0xde77, 0xa4f2, 0x73ce, 0x7c0f, 0xa4b0, 0xff38, 0xff38,
-  0xff38, 0xff38, 0xff18, 0x2905, 0x2925, 0x3146, 0x3146, 0x3146,
-  0x3146, 0x3966, 0x3967, 0x3987, 0x3987, 0x3166, 0x3166, 0x3166,
-  0x3187, 0x3187, 0x39a7, 0x39a7, 0x39a7, 0x39c8, 0x4208, 0x4209,
-  0x4208, 0x4a29, 0x4229, 0x4208, 0x4209, 0x4a6a, 0x52ab, 0x630c,
-  0x4a6a, 0x4209, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39e8, 0x39c7,
-  0x39c8, 0x39c8, 0x39c8, 0x39e8, 0x3a08, 0x39e8, 0x3a09, 0x3a09,
-  0x3a09, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x4229, 0x3a08, 0x3a08, 0x4229, 0x4249, 0x4249, 0x4a8a,
-  0x6b8e, 0x4aeb, 0x4249, 0x3a29, 0x3a08, 0x3a08, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x3a08, 0x4229, 0x3a29, 0x3a29, 0x3a29, 0x4229,
-  0x3a09, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x3a08, 0x3a08, 0x3a08,
-  0x3a29, 0x3a49, 0x3a29, 0x3a49, 0x4249, 0x4249, 0x428a, 0x4a8a,
-  0x428a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4aaa,
-  0x4aaa, 0x52cb, 0x52ec, 0x4acb, 0x4acb, 0x4aab, 0x4acb, 0x4acb,
-  0x4acb, 0x4acb, 0x4acb, 0x4acb, 0x4aeb, 0x530c, 0x530c, 0x5b4d,
-  0x5b4d, 0x5b2d, 0x5b4d, 0x636d, 0x638e, 0x63ae, 0x6bcf, 0x6c10,
-  0x6bef, 0x6c10, 0x6bf0, 0x6bef, 0x63ae, 0x6bcf, 0x6bcf, 0x63cf,
-  0x6c10, 0x6bef, 0x6bef, 0x6bef, 0x6c10, 0x7430, 0x7451, 0x6c10,
-  0x6c30, 0x7451, 0x7cb2, 0x7cb2, 0x84d3, 0x84f3, 0x84d2, 0x8d13,
-  0x8d13, 0x8d33, 0x9534, 0x9534, 0x9554, 0x8d33, 0x9554, 0x9554,
-  0x9554, 0x9554, 0x9574, 0x9575, 0x9595, 0x9dd6, 0xa5d6, 0xa5f6,
-  0xa616, 0xae17, 0xae37, 0xae57, 0xb678, 0xbeb9, 0xbed9, 0xc6f9,
-  0xc73a, 0xcf5b, 0xd77b, 0xd79b, 0xdfbc, 0xefdd, 0xf7dc, 0xf7dc,
-  0xef9c, 0xdf5b, 0xe75b, 0xe75a, 0xf79a, 0xf79b, 0xf79b, 0xf77b,
-  0xf77a, 0xf79a, 0xf77a, 0xffdb, 0xffbb, 0xef39, 0xf79a, 0xf79a,
-  0xf77a, 0xef39, 0xd697, 0xd697, 0xe719, 0xef3a, 0xe6d8, 0xdeb8,
-  0xdeb7, 0xde97, 0xc616, 0xb574, 0xa513, 0x7c30, 0x7410, 0x73ef,
-  0x8c91, 0x7c0f, 0x8450, 0x8450, 0x8c50, 0x8c70, 0x94b1, 0x8450,
-  0x9cb1, 0xbd53, 0x9450, 0x73ce, 0x842f, 0x944f, 0xf6f8, 0xff58,
-  0xff38, 0xf718, 0xe696, 0x2925, 0x2925, 0x3125, 0x3146, 0x3146,
-  0x3146, 0x3166, 0x3966, 0x3987, 0x3987, 0x3166, 0x3166, 0x3166,
-  0x39a7, 0x39a7, 0x3187, 0x31a7, 0x39a7, 0x4a29, 0x4a29, 0x4a29,
-  0x4a29, 0x4a49, 0x4a49, 0x4a49, 0x52aa, 0x5aeb, 0x8c71, 0x8430,
-  0x4a4a, 0x4a49, 0x4209, 0x4208, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39c8, 0x39c8, 0x31c8, 0x39e8, 0x4249, 0x4229, 0x39e8, 0x39e8,
-  0x3a08, 0x4209, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08,
-  0x3a08, 0x3a09, 0x3a09, 0x426a, 0x4249, 0x4269, 0x4269, 0x4249,
-  0x634d, 0x7430, 0x4269, 0x3a29, 0x3a29, 0x3a08, 0x39e8, 0x3a08,
-  0x39e8, 0x3a08, 0x3a09, 0x3a29, 0x426a, 0x4acb, 0x3a29, 0x3a09,
-  0x3a09, 0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a08, 0x3a09, 0x3a09,
-  0x3a29, 0x3a49, 0x3a29, 0x3a49, 0x4249, 0x428a, 0x428a, 0x4aaa,
-  0x4a8a, 0x4aab, 0x4a8a, 0x4a6a, 0x426a, 0x4269, 0x4a8a, 0x4a8a,
-  0x52cb, 0x52cb, 0x530c, 0x5b2c, 0x5b2c, 0x532c, 0x52eb, 0x52ec,
-  0x52ec, 0x530c, 0x52ec, 0x52ec, 0x52ec, 0x5b2d, 0x5b4d, 0x638d,
-  0x5b6d, 0x636e, 0x638e, 0x6bcf, 0x6bef, 0x7410, 0x7450, 0x7430,
-  0x7430, 0x7451, 0x7c71, 0x7c71, 0x7c71, 0x6bf0, 0x7430, 0x7410,
-  0x7430, 0x7410, 0x7451, 0x6bef, 0x7451, 0x7c51, 0x7c71, 0x7471,
-  0x7451, 0x8cf3, 0x7c71, 0x7471, 0x84d3, 0x84d2, 0x84f3, 0x84f3,
-  0x8d13, 0x8d33, 0x9554, 0x9554, 0x9554, 0x9554, 0x8d33, 0x9554,
-  0x9554, 0x9574, 0x9574, 0x9595, 0x9db6, 0x9dd6, 0xa5f6, 0xa5f6,
-  0xae17, 0xae37, 0xae57, 0xb678, 0xb698, 0xbeb9, 0xbed9, 0xc6f9,
-  0xcf3a, 0xcf7b, 0xd79b, 0xdfbc, 0xdfdc, 0xf7dd, 0xf7bc, 0xf7dc,
-  0xe79c, 0xdf1a, 0xe73b, 0xe73a, 0xf79a, 0xff9b, 0xf79b, 0xf79b,
-  0xf79b, 0xf77a, 0xf77a, 0xffdb, 0xff9a, 0xef18, 0xf79a, 0xf79b,
-  0xf79a, 0xef39, 0xd697, 0xd697, 0xe719, 0xef3a, 0xdeb8, 0xdeb8,
-  0xd697, 0xd677, 0xce16, 0xa512, 0x8c91, 0x7c30, 0x7410, 0x7410,
-  0x8cb2, 0x7c10, 0x7c30, 0x7c0f, 0x8450, 0x840f, 0x8450, 0x8430,
-  0x9cf2, 0xbdb5, 0x83ef, 0x7c0f, 0x8c70, 0x8c0f, 0xe696, 0xff79,
-  0xff38, 0xf718, 0xe676, 0x2926, 0x2925, 0x2925, 0x3125, 0x3146,
-  0x3146, 0x3146, 0x3146, 0x3966, 0x3166, 0x3987, 0x3166, 0x3166,
-  0x41e8, 0x526a, 0x4a49, 0x39c8, 0x39a7, 0x4209, 0x526a, 0x526a,
-  0x528b, 0x526a, 0x62ec, 0x9cf3, 0x7c10, 0x52ab, 0x5aec, 0x7c10,
-  0x52ab, 0x4249, 0x4249, 0x4249, 0x4229, 0x4208, 0x3a08, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a09, 0x4229, 0x3a08, 0x3a09,
-  0x3a08, 0x3a08, 0x3a08, 0x4208, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08,
-  0x3a08, 0x4229, 0x4249, 0x4249, 0x4249, 0x426a, 0x426a, 0x426a,
-  0x4aab, 0x4acb, 0x4269, 0x4249, 0x3a29, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a09, 0x424a, 0x42ab, 0x4acb, 0x3a29, 0x3a09,
-  0x3a09, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x4249,
-  0x4249, 0x3a29, 0x3a49, 0x4249, 0x426a, 0x428a, 0x428a, 0x4aab,
-  0x4acb, 0x4aab, 0x4a8a, 0x426a, 0x426a, 0x428a, 0x4aaa, 0x4aaa,
-  0x4acb, 0x4acb, 0x52ec, 0x530c, 0x5b2d, 0x5b4d, 0x530c, 0x530c,
-  0x52ec, 0x52ec, 0x530c, 0x52ec, 0x530c, 0x5b4d, 0x5b6d, 0x5b6d,
-  0x638e, 0x6bef, 0x6bcf, 0x6c10, 0x7430, 0x7c51, 0x7c51, 0x7430,
-  0x7c71, 0x7c71, 0x8cd2, 0x84b2, 0x7c71, 0x7c51, 0x84d2, 0x84b2,
-  0x7c71, 0x7c71, 0x7c91, 0x7451, 0x7c51, 0x7c71, 0x7c92, 0x84b2,
-  0x7c92, 0x84d2, 0xa5d6, 0x7c91, 0x84d2, 0x7cb2, 0x84d2, 0x84d2,
-  0x84f2, 0x8d13, 0x9554, 0x9555, 0x9534, 0x9554, 0x9554, 0x8d34,
-  0x8d54, 0x9575, 0x9d95, 0x9d95, 0xa5d6, 0xa5d6, 0xa5f6, 0xa5f6,
-  0xae37, 0xae17, 0xae57, 0xb678, 0xb698, 0xbeb9, 0xbed9, 0xc719,
-  0xcf3a, 0xd77b, 0xd79b, 0xdfbc, 0xdfdc, 0xf7dc, 0xf7bc, 0xf7dc,
-  0xe77b, 0xdf1b, 0xdf5b, 0xe73a, 0xff9b, 0xff9b, 0xff9b, 0xf79b,
-  0xf79b, 0xf79a, 0xff9a, 0xffdb, 0xffbb, 0xf759, 0xf79a, 0xffbb,
-  0xf77a, 0xef39, 0xdeb7, 0xd677, 0xef19, 0xef39, 0xe6d8, 0xdeb7,
-  0xdeb8, 0xd656, 0xce36, 0x9d12, 0x8450, 0x7410, 0x7430, 0x7c0f,
-  0x8c71, 0x740f, 0x7c30, 0x8450, 0x8430, 0x7c0f, 0x7c0f, 0x8450,
-  0xa4f2, 0x9cb1, 0x8c50, 0x73ce, 0x842f, 0x8c0e, 0xde35, 0xff79,
-  0xff39, 0xf6d8, 0xeed7, 0x2946, 0x2925, 0x2905, 0x3125, 0x3126,
-  0x3146, 0x3146, 0x3146, 0x3146, 0x3146, 0x3166, 0x3187, 0x3987,
-  0x39a7, 0x41e8, 0x5aec, 0x62ec, 0x5acb, 0x6b4d, 0x7bcf, 0x6b4d,
-  0x5acb, 0x5249, 0x630c, 0xd6ba, 0x8cb2, 0x3a08, 0x4229, 0x4229,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4229, 0x3a08, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x4229, 0x3a09, 0x3a09, 0x4209,
-  0x4229, 0x3a08, 0x4229, 0x4208, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a09,
-  0x3a29, 0x4249, 0x4249, 0x4249, 0x426a, 0x4a6a, 0x4a8a, 0x4a8a,
-  0x4a8a, 0x4a8a, 0x426a, 0x426a, 0x4229, 0x3a29, 0x3a08, 0x39e8,
-  0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x4269, 0x3a29, 0x3a08, 0x3a09,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x4229, 0x3a09, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x4249, 0x3a4a, 0x426a, 0x428a, 0x428a, 0x4acb,
-  0x530c, 0x4aeb, 0x4aab, 0x4aab, 0x4acb, 0x4acb, 0x4aab, 0x42aa,
-  0x4aaa, 0x4aeb, 0x52ec, 0x52ec, 0x530c, 0x530c, 0x532c, 0x5b4d,
-  0x530c, 0x5b2d, 0x530c, 0x532c, 0x5b6d, 0x5b6d, 0x5b6d, 0x5b8d,
-  0x63ae, 0x6bef, 0x6c0f, 0x6bef, 0x7410, 0x7430, 0x7c71, 0x8491,
-  0x84b2, 0x8cf3, 0x8cf3, 0x9513, 0x9534, 0x9513, 0x9534, 0x8cf3,
-  0x84b2, 0x8cd2, 0x8491, 0x8cd3, 0x84b2, 0x84b2, 0x8d13, 0x7c71,
-  0x7471, 0x84b2, 0x84b2, 0x7c71, 0x84b2, 0x84b2, 0x84d2, 0x84d2,
-  0x8d13, 0x9533, 0x9534, 0x8d13, 0x8d34, 0x9534, 0x9554, 0x9554,
-  0x9554, 0x9575, 0x9595, 0x9db5, 0x9dd6, 0xa5d6, 0xa5f6, 0xa617,
-  0xae17, 0xae37, 0xae57, 0xb678, 0xb698, 0xbeb9, 0xbed9, 0xc71a,
-  0xcf3a, 0xd77b, 0xd79c, 0xdfbc, 0xe7bc, 0xffbc, 0xf7bc, 0xf7dc,
-  0xe77b, 0xd71b, 0xdf3b, 0xe73a, 0xffbb, 0xffbb, 0xff9b, 0xff9b,
-  0xff9b, 0xff9a, 0xffbb, 0xffbb, 0xff9a, 0xef38, 0xf79a, 0xffba,
-  0xf77a, 0xef39, 0xded8, 0xde97, 0xef19, 0xef39, 0xe6d8, 0xe6d8,
-  0xde97, 0xde97, 0xc615, 0x94f2, 0x8c91, 0x73ef, 0x7c30, 0x7c50,
-  0x8471, 0x7c10, 0x8c91, 0x8c91, 0x8430, 0x7c10, 0x7bef, 0x8410,
-  0x9491, 0x9490, 0x8c70, 0x7bce, 0x844f, 0x840e, 0xc593, 0xff79,
-  0xff38, 0xff18, 0xf6f8, 0x2925, 0x2925, 0x2925, 0x3125, 0x3126,
-  0x3126, 0x3146, 0x3146, 0x3146, 0x3146, 0x3146, 0x3166, 0x3166,
-  0x3987, 0x39c7, 0x52ab, 0x6b4d, 0x738e, 0x94b2, 0x8471, 0x52cb,
-  0x4a29, 0x5249, 0x62cb, 0x8430, 0x634d, 0x39e8, 0x4229, 0x4249,
-  0x4229, 0x4249, 0x4269, 0x4249, 0x4a6a, 0x4249, 0x4208, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x4229, 0x4229, 0x3a09, 0x4209,
-  0x4209, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x3a08, 0x3a08, 0x39e8,
-  0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x3a08, 0x3a29,
-  0x4249, 0x52cb, 0x4aab, 0x426a, 0x426a, 0x4a8a, 0x426a, 0x4a8a,
-  0x4aab, 0x4aab, 0x4a8a, 0x426a, 0x426a, 0x4249, 0x3a08, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x428a, 0x3a29, 0x3a08, 0x3a09,
-  0x3a08, 0x4229, 0x3a08, 0x3a08, 0x4249, 0x4229, 0x4229, 0x4249,
-  0x3a49, 0x3a49, 0x3a49, 0x426a, 0x426a, 0x428a, 0x4aab, 0x4aeb,
-  0x530c, 0x532d, 0x530c, 0x530c, 0x52ec, 0x52ec, 0x52ec, 0x4acb,
-  0x4aaa, 0x4acb, 0x4acb, 0x52ec, 0x5b2d, 0x5b6d, 0x63ae, 0x5b4d,
-  0x636e, 0x636e, 0x638e, 0x5b6d, 0x638e, 0x638e, 0x63ae, 0x6bef,
-  0x6bef, 0x7430, 0x6c10, 0x7c71, 0x7c51, 0x7c71, 0x84b2, 0x84b2,
-  0x8cf3, 0x9513, 0x8cd3, 0x8cf3, 0x9513, 0x9d34, 0x9513, 0x8cd2,
-  0x8cf3, 0x9534, 0x9513, 0x9534, 0x94f3, 0x8cd2, 0x84d2, 0x84b2,
-  0x84b2, 0x84b2, 0x7471, 0x7450, 0x7c92, 0x84f3, 0x7c92, 0x8cf3,
-  0x9554, 0x8cf3, 0x9d95, 0x8d13, 0x8d14, 0x9534, 0x9554, 0x9554,
-  0x9555, 0x9575, 0x9d95, 0x9db5, 0x9dd6, 0xa5d6, 0xa5f6, 0xa617,
-  0xae17, 0xae37, 0xae57, 0xb678, 0xb698, 0xbeb9, 0xc6f9, 0xc71a,
-  0xcf5a, 0xd77b, 0xdf9c, 0xdfbc, 0xe7bc, 0xffbc, 0xf7bc, 0xf7dc,
-  0xe75b, 0xd71b, 0xd73b, 0xe75a, 0xffbb, 0xffbb, 0xffbb, 0xffbb,
-  0xffbb, 0xff9a, 0xffbb, 0xffdb, 0xff9a, 0xef17, 0xf7ba, 0xffba,
-  0xf77a, 0xf759, 0xe6d8, 0xdeb8, 0xef19, 0xef39, 0xe6f8, 0xe6f9,
-  0xdeb7, 0xd677, 0xbdd5, 0x8cb2, 0x7c30, 0x7c30, 0x7c30, 0x8450,
-  0x8cb1, 0x8470, 0x8470, 0x8c91, 0x7c10, 0x8430, 0x7bef, 0x8430,
-  0x94b1, 0x9490, 0x9491, 0x7bee, 0x844f, 0x840e, 0xc593, 0xff99,
-  0xff58, 0xff19, 0xf6f8, 0x2926, 0x2925, 0x2925, 0x3125, 0x3125,
-  0x3125, 0x3126, 0x3126, 0x3146, 0x3146, 0x3146, 0x3146, 0x3166,
-  0x3166, 0x3166, 0x3187, 0x31a7, 0x39c8, 0x39e8, 0x3a08, 0x4229,
-  0x4a29, 0x526a, 0x5aab, 0x528a, 0x52aa, 0x4229, 0x4209, 0x4229,
-  0x4229, 0x4229, 0x4229, 0x4249, 0x4a8a, 0x632d, 0x4229, 0x3a08,
-  0x39e8, 0x39e8, 0x39e8, 0x4209, 0x4229, 0x3a09, 0x3a09, 0x4229,
-  0x4229, 0x4229, 0x4228, 0x4208, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x3a08, 0x4249,
-  0x4a6a, 0x4aab, 0x4a8a, 0x4269, 0x4249, 0x4a8a, 0x4a6a, 0x4aab,
-  0x52ab, 0x4aab, 0x4aab, 0x426a, 0x426a, 0x4249, 0x4229, 0x3a08,
-  0x3a29, 0x3a08, 0x3a08, 0x4a8a, 0x3a49, 0x3a08, 0x3a08, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x4249, 0x426a, 0x426a, 0x5b2d,
-  0x426a, 0x3a49, 0x3a49, 0x3a6a, 0x426a, 0x428a, 0x42aa, 0x4acb,
-  0x52ec, 0x530c, 0x530c, 0x530c, 0x52ec, 0x4acb, 0x4acb, 0x4aab,
-  0x4acb, 0x4aab, 0x4acb, 0x52ec, 0x530c, 0x530c, 0x5b4d, 0x5b6d,
-  0x5b4d, 0x5b2d, 0x5b2d, 0x5b4d, 0x5b4d, 0x638e, 0x7410, 0x7430,
-  0x7410, 0x7430, 0x7c51, 0x7c91, 0x7c71, 0x84b2, 0x8492, 0x9513,
-  0x9513, 0x9513, 0x9513, 0x9513, 0x94f3, 0x9534, 0x9513, 0x9d54,
-  0x9d54, 0x9533, 0x9d54, 0x9d54, 0x8cf3, 0x8cd2, 0x8492, 0x8cf3,
-  0x9534, 0x84d2, 0x8492, 0x7c92, 0x84d2, 0x84b2, 0x84d3, 0x8cf3,
-  0x8d13, 0x8cf3, 0x8d13, 0x8d13, 0x8d34, 0x9554, 0x9575, 0x9554,
-  0x9575, 0x9d75, 0x9d95, 0x9db6, 0xa5d6, 0xa5f6, 0xa616, 0xa616,
-  0xae17, 0xae37, 0xb657, 0xb678, 0xbe98, 0xbeb9, 0xc6f9, 0xc71a,
-  0xcf5a, 0xd77b, 0xdf9c, 0xe7bc, 0xefbc, 0xf7bc, 0xf7bc, 0xf7dc,
-  0xe77b, 0xd73b, 0xd73b, 0xe75a, 0xffbb, 0xffbb, 0xffbb, 0xffbb,
-  0xffba, 0xff9a, 0xffbb, 0xffdb, 0xff9a, 0xef18, 0xffba, 0xffba,
-  0xff9a, 0xef59, 0xe6d8, 0xded8, 0xef19, 0xef39, 0xe6d8, 0xef39,
-  0xdeb8, 0xc616, 0xb574, 0x8471, 0x7c30, 0x7c50, 0x7c50, 0x8470,
-  0x94d2, 0x94d2, 0x8430, 0x8470, 0x7c0f, 0x8430, 0x8410, 0x8c50,
-  0x9cb2, 0x8c70, 0x840f, 0x73ad, 0x840f, 0x8c2f, 0xbd73, 0xff79,
-  0xff38, 0xf6f8, 0xf6f7, 0x2926, 0x2925, 0x3125, 0x3125, 0x3125,
-  0x3125, 0x3126, 0x3126, 0x3146, 0x3146, 0x3146, 0x3145, 0x3166,
-  0x3146, 0x3166, 0x3186, 0x3187, 0x39a7, 0x39a7, 0x39c7, 0x41e8,
-  0x4208, 0x4a29, 0x4a49, 0x4229, 0x4229, 0x4229, 0x4208, 0x4208,
-  0x3a08, 0x3a08, 0x3a08, 0x4229, 0x4229, 0x4a6a, 0x4229, 0x4208,
-  0x3a08, 0x3a08, 0x39e8, 0x4209, 0x4229, 0x3a09, 0x3a08, 0x4229,
-  0x4229, 0x4208, 0x4208, 0x4208, 0x4208, 0x3a08, 0x39e8, 0x3a08,
-  0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x4229,
-  0x4249, 0x4249, 0x3a49, 0x426a, 0x4a6a, 0x426a, 0x426a, 0x4a8a,
-  0x4aab, 0x530c, 0x5b2d, 0x94f4, 0x5b0c, 0x4229, 0x4229, 0x3a08,
-  0x3a09, 0x3a08, 0x3a29, 0x426a, 0x4249, 0x3a08, 0x3a08, 0x3a29,
-  0x3a09, 0x3a29, 0x3a09, 0x3a29, 0x426a, 0x4a8a, 0x4a8a, 0x5b2d,
-  0x426a, 0x3a4a, 0x3a6a, 0x3a6a, 0x3a6a, 0x428a, 0x42ab, 0x42ab,
-  0x4aec, 0x532d, 0x530c, 0x5b2d, 0x532d, 0x52ec, 0x4acb, 0x4aaa,
-  0x4aab, 0x4aab, 0x4acb, 0x4acb, 0x4acb, 0x530c, 0x530c, 0x532c,
-  0x530c, 0x532c, 0x532c, 0x5b2d, 0x5b6d, 0x5b6d, 0x63ae, 0x63ae,
-  0x7410, 0x7430, 0x7c51, 0x7c71, 0x8492, 0x84b2, 0x8cd2, 0x9513,
-  0x94f3, 0x9513, 0x9d54, 0x9534, 0x9533, 0x8cf3, 0x9d54, 0x9d55,
-  0xadd6, 0xadb6, 0x9d33, 0xa575, 0x9d34, 0x8cf3, 0x9d54, 0x9d95,
-  0x8d13, 0x7c71, 0x7c71, 0x84b2, 0x8d13, 0x84d2, 0x84d2, 0x84d2,
-  0x8d13, 0x8d13, 0x84f2, 0x8d34, 0x8d34, 0x9554, 0x9574, 0x9575,
-  0x9575, 0x9d75, 0x9d95, 0x9db6, 0xa5d6, 0xa5f6, 0xa5f6, 0xae17,
-  0xae17, 0xae37, 0xb658, 0xb678, 0xbeb9, 0xbed9, 0xc6f9, 0xcf1a,
-  0xcf5b, 0xd79b, 0xdf9b, 0xe7bc, 0xefbc, 0xf7bc, 0xf7bc, 0xf7dc,
-  0xefbc, 0xd75b, 0xd73b, 0xef7b, 0xffbb, 0xffbb, 0xf7bb, 0xff9b,
-  0xff9a, 0xff99, 0xffdb, 0xffdb, 0xf77a, 0xef38, 0xffbb, 0xf79a,
-  0xff9a, 0xef39, 0xe6f8, 0xe6d8, 0xe6f8, 0xef39, 0xe6d8, 0xef19,
-  0xe6d8, 0xc5f6, 0xad74, 0x7c30, 0x7c30, 0x8451, 0x8cb1, 0x8491,
-  0x94f2, 0x94f2, 0x8451, 0x8450, 0x7c0f, 0x7c0f, 0x8c70, 0x9491,
-  0xa512, 0x8c50, 0x840f, 0x7bce, 0x842f, 0x8c2f, 0xbd73, 0xff79,
-  0xff59, 0xeed8, 0xeeb8, 0x2926, 0x2925, 0x2925, 0x3125, 0x3125,
-  0x3125, 0x3126, 0x3126, 0x3146, 0x3146, 0x3146, 0x3146, 0x3146,
-  0x3146, 0x3166, 0x3166, 0x3166, 0x3166, 0x39a7, 0x39a7, 0x39c8,
-  0x41e8, 0x4208, 0x4a29, 0x4208, 0x4208, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x4249, 0x4aaa, 0x52aa, 0x4249,
-  0x4229, 0x4208, 0x39e8, 0x39e8, 0x3a09, 0x4229, 0x3a09, 0x4229,
-  0x4229, 0x4229, 0x4229, 0x4229, 0x3a08, 0x3a08, 0x4229, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a28, 0x3a29, 0x4229, 0x4229, 0x4a6a,
-  0x4a6a, 0x4249, 0x4a8a, 0x426a, 0x424a, 0x426a, 0x426a, 0x4aaa,
-  0x5b2d, 0x634d, 0x7c51, 0xceba, 0x636e, 0x4229, 0x4229, 0x3a08,
-  0x39e8, 0x3a08, 0x3a09, 0x4249, 0x52cb, 0x4249, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x4229, 0x4249, 0x426a, 0x428a, 0x428a,
-  0x4aab, 0x428b, 0x426a, 0x426a, 0x426a, 0x428a, 0x42aa, 0x42ab,
-  0x4acb, 0x4aec, 0x530d, 0x5b2d, 0x532d, 0x530c, 0x4acb, 0x4aeb,
-  0x52ec, 0x52ec, 0x530c, 0x52eb, 0x52ec, 0x530c, 0x5b4d, 0x532d,
-  0x5b2d, 0x5b4d, 0x5b2d, 0x5b4d, 0x638e, 0x636e, 0x636e, 0x638e,
-  0x7c51, 0x7c51, 0x84b2, 0x84b2, 0x8cb2, 0x9533, 0x9513, 0x9533,
-  0x9513, 0x9d54, 0x9533, 0x9533, 0x9534, 0x9513, 0xa575, 0xa575,
-  0xadb5, 0xadb6, 0x9d54, 0x9d54, 0xa575, 0x9d54, 0x9513, 0x8cf3,
-  0x8491, 0x84d2, 0x84b2, 0x7c92, 0x84f3, 0x84d2, 0x7c92, 0x84b2,
-  0x84f3, 0x84f2, 0x8d13, 0x9554, 0x9554, 0x9575, 0x9574, 0x9575,
-  0x9575, 0x9db6, 0x9db6, 0x9db6, 0xa5b6, 0xa5d6, 0xa5f6, 0xae17,
-  0xae37, 0xb657, 0xb678, 0xb678, 0xbe98, 0xbed9, 0xc6f9, 0xcf1a,
-  0xcf5b, 0xd77b, 0xdf9c, 0xe7bd, 0xefbc, 0xffbc, 0xf7bc, 0xf7dc,
-  0xefbc, 0xd73c, 0xd75b, 0xef7b, 0xff9b, 0xffbc, 0xf7bb, 0xff9b,
-  0xf759, 0xff99, 0xffdb, 0xffdb, 0xf779, 0xef39, 0xffdb, 0xf79a,
-  0xffba, 0xef59, 0xef19, 0xe6f8, 0xdeb7, 0xef39, 0xe6f8, 0xe6f8,
-  0xe6d8, 0xb5b5, 0xa553, 0x7c51, 0x7430, 0x8471, 0x8471, 0x8471,
-  0x94d2, 0x94d2, 0x7c30, 0x8c71, 0x8450, 0x7c0f, 0x9d12, 0x9491,
-  0x9cd2, 0x842f, 0x8c30, 0x7bee, 0x842f, 0x8c2f, 0xb512, 0xff38,
-  0xff59, 0xde16, 0xc574, 0x2926, 0x2926, 0x2925, 0x3125, 0x3125,
-  0x3125, 0x3126, 0x3126, 0x3146, 0x3146, 0x3146, 0x3146, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3187, 0x3987, 0x39a7,
-  0x39c8, 0x41e8, 0x41e8, 0x41e8, 0x39e8, 0x39e8, 0x39c8, 0x39e8,
-  0x3a08, 0x4229, 0x4229, 0x4249, 0x4a6a, 0x4aab, 0x634d, 0x4a6a,
-  0x4229, 0x4209, 0x3a08, 0x3a28, 0x4208, 0x4229, 0x4249, 0x4229,
-  0x4229, 0x4249, 0x3a29, 0x4229, 0x4229, 0x3a29, 0x3a08, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x3a08, 0x3a29, 0x4249, 0x4a8a,
-  0x4269, 0x4249, 0x4a6a, 0x4249, 0x4249, 0x4a6a, 0x4249, 0x4a8a,
-  0x52eb, 0x52cb, 0x638e, 0x9514, 0x6bcf, 0x426a, 0x4269, 0x3a29,
-  0x3a09, 0x4229, 0x3a29, 0x4249, 0x4269, 0x426a, 0x426a, 0x3a49,
-  0x4249, 0x3a49, 0x3a29, 0x3a29, 0x4249, 0x4249, 0x426a, 0x4aaa,
-  0x530c, 0x5b8e, 0x532d, 0x428a, 0x428a, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x4acb, 0x4acb, 0x530d, 0x530c, 0x532d, 0x5b2d, 0x530c,
-  0x52ec, 0x52ec, 0x4acb, 0x530c, 0x532d, 0x5b2d, 0x5b4d, 0x5b2d,
-  0x5b4d, 0x5b4d, 0x532c, 0x5b6d, 0x63ae, 0x5b6d, 0x5b6d, 0x63ae,
-  0x6bf0, 0x7430, 0x84b2, 0x84b1, 0x8cd2, 0x8cd2, 0x9533, 0x9d54,
-  0x9d54, 0x9d54, 0x94f2, 0x94f2, 0x9d54, 0x9d34, 0xa574, 0xa574,
-  0xadb5, 0xa575, 0x9d34, 0xa595, 0x9513, 0x9513, 0x9534, 0x9533,
-  0x8491, 0x7c91, 0x7c91, 0x7cb2, 0x84d2, 0x84d2, 0x84b2, 0x8cf3,
-  0x84d2, 0x8d13, 0x8d33, 0x8d33, 0x9574, 0x9d75, 0x9d75, 0x9d75,
-  0x9d95, 0x9d95, 0x9db5, 0x9db6, 0x9dd6, 0xa5f6, 0xa616, 0xae17,
-  0xae37, 0xae58, 0xb678, 0xb678, 0xb698, 0xbed9, 0xc6fa, 0xcf3a,
-  0xcf5b, 0xd77b, 0xdf9c, 0xefbd, 0xf7bc, 0xffbc, 0xffbc, 0xf7dc,
-  0xefbc, 0xcf3c, 0xd73b, 0xef7b, 0xff9b, 0xff9c, 0xff9b, 0xf79a,
-  0xf779, 0xf779, 0xffdb, 0xffdb, 0xf779, 0xf759, 0xffdb, 0xf77a,
-  0xffbb, 0xf77a, 0xef39, 0xeef9, 0xd656, 0xef39, 0xe6f9, 0xe719,
-  0xe6d8, 0xbdd5, 0xad74, 0x7430, 0x7451, 0x7c71, 0x8471, 0x8471,
-  0x94d2, 0x8cb2, 0x7c30, 0x8471, 0x7c2f, 0x94d2, 0x8471, 0x8c70,
-  0x9470, 0x840f, 0x7bce, 0x7c0f, 0x842f, 0x8c2f, 0xacd1, 0xe656,
-  0xf718, 0xe697, 0xde56, 0x2926, 0x2926, 0x2926, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3126, 0x3146, 0x3146, 0x3146, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3187, 0x3987, 0x39a7,
-  0x39a7, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08,
-  0x4208, 0x4229, 0x4249, 0x4269, 0x4249, 0x4aab, 0x73af, 0x4a6a,
-  0x4229, 0x4229, 0x3a28, 0x3a29, 0x4229, 0x4229, 0x4229, 0x4229,
-  0x4249, 0x4229, 0x4229, 0x4229, 0x4229, 0x3a28, 0x3a08, 0x4229,
-  0x3a28, 0x4229, 0x4229, 0x3a29, 0x4229, 0x4229, 0x4a6a, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4229, 0x4249, 0x4249, 0x4249, 0x4269,
-  0x4a8a, 0x4aaa, 0x52cb, 0x5b2c, 0x5b2c, 0x52cb, 0x428a, 0x4249,
-  0x4229, 0x4249, 0x4269, 0x4a8a, 0x4269, 0x4aaa, 0x426a, 0x426a,
-  0x426a, 0x426a, 0x4249, 0x4249, 0x426a, 0x426a, 0x4a8a, 0x4a8a,
-  0x530c, 0x638f, 0x4aec, 0x4acb, 0x4acb, 0x42ab, 0x42ab, 0x42ab,
-  0x4acb, 0x42ab, 0x42ab, 0x530c, 0x532d, 0x5b6e, 0x5b4d, 0x530c,
-  0x4acb, 0x530c, 0x5b2d, 0x52ec, 0x52ec, 0x532d, 0x5b6d, 0x5b2d,
-  0x532c, 0x5b4d, 0x5b4d, 0x5b6d, 0x5b4d, 0x5b6d, 0x638e, 0x6baf,
-  0x6bcf, 0x6bef, 0x84b1, 0x84b1, 0x8cd2, 0x94f3, 0x9d54, 0x9d33,
-  0x9512, 0x9d33, 0xa554, 0x9513, 0xa575, 0x9d33, 0x9d54, 0xadb5,
-  0xadd6, 0xa595, 0x9d54, 0xa595, 0x9d54, 0x9533, 0xa595, 0x9554,
-  0x8cf3, 0x7c92, 0x7c92, 0x7471, 0x84d2, 0x8d13, 0x8d13, 0x84d2,
-  0x84f3, 0x8d13, 0x8d13, 0x8d33, 0x9554, 0x9574, 0x9d95, 0x9d95,
-  0x9db5, 0x9db5, 0xa5d6, 0x9dd6, 0xa5d6, 0xa5f6, 0xa5f6, 0xa616,
-  0xae37, 0xae58, 0xb678, 0xb698, 0xbeb9, 0xbed9, 0xc6fa, 0xcf3a,
-  0xd75b, 0xd77b, 0xdfbc, 0xefdd, 0xf79c, 0xffbc, 0xffbc, 0xffdc,
-  0xefbc, 0xc73c, 0xdf5b, 0xf79b, 0xf79b, 0xff9c, 0xf7bb, 0xffbb,
-  0xf779, 0xff9a, 0xffdb, 0xffdb, 0xf759, 0xef59, 0xf7bb, 0xef59,
-  0xffbb, 0xf79a, 0xef39, 0xeef9, 0xce56, 0xe718, 0xef19, 0xe6f8,
-  0xde97, 0xc5f6, 0xb5b5, 0x7430, 0x7451, 0x7c51, 0x8491, 0x8471,
-  0x8471, 0x7c51, 0x8471, 0x8471, 0x7c30, 0x8450, 0x7c30, 0x8c91,
-  0x8c50, 0x840f, 0x7bce, 0x7bef, 0x7c0f, 0x8c50, 0xa4b1, 0xf6f8,
-  0xff38, 0xf738, 0xf718, 0x2926, 0x2925, 0x2925, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3126, 0x3146, 0x3146, 0x3146, 0x3166, 0x3166,
-  0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3987,
-  0x39a7, 0x39a7, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x4208, 0x39e8,
-  0x4208, 0x4229, 0x4249, 0x4249, 0x4249, 0x4a8a, 0x636d, 0x73f0,
-  0x4249, 0x4249, 0x4229, 0x3a28, 0x4249, 0x4229, 0x4229, 0x4229,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4229, 0x4229, 0x4229, 0x4229,
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4249, 0x4249, 0x4269, 0x4249,
-  0x426a, 0x4aab, 0x4249, 0x4229, 0x4229, 0x4229, 0x4229, 0x4249,
-  0x4a6a, 0x4a8a, 0x4a8a, 0x52ec, 0x52eb, 0x428a, 0x4aab, 0x4a8a,
-  0x3a29, 0x3a29, 0x3a29, 0x4acb, 0x52ec, 0x428a, 0x428a, 0x428a,
-  0x428a, 0x426a, 0x428a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4aab,
-  0x530c, 0x530d, 0x4aab, 0x4acc, 0x4aec, 0x42ab, 0x42ab, 0x4acb,
-  0x4acb, 0x42ab, 0x42ab, 0x530c, 0x5b4d, 0x532d, 0x5b4d, 0x532c,
-  0x4aeb, 0x4acb, 0x4acb, 0x4acb, 0x52ec, 0x636e, 0x638e, 0x638e,
-  0x5b4d, 0x5b4d, 0x5b4d, 0x5b4d, 0x638e, 0x63ae, 0x63af, 0x636e,
-  0x638e, 0x6bef, 0x7450, 0x8cd2, 0x8cd2, 0x84b2, 0x94f2, 0x9d54,
-  0xadb6, 0xadd6, 0x9513, 0x8cd2, 0x9d54, 0x9d74, 0xa574, 0xa575,
-  0xa595, 0xa575, 0xa595, 0xadd6, 0xbe38, 0x8cf2, 0x84b2, 0x84d2,
-  0x8d13, 0x7c71, 0x7c92, 0x7c71, 0x84d3, 0x84f3, 0x84d2, 0x84d2,
-  0x84f3, 0x84f3, 0x8d13, 0x8d54, 0x9574, 0x9574, 0x9d95, 0x9d95,
-  0x9db5, 0x9db6, 0x9db6, 0x9dd6, 0xa5f6, 0xa5d6, 0xa5f6, 0xa616,
-  0xae37, 0xae57, 0xb678, 0xb698, 0xbeb9, 0xbef9, 0xc71a, 0xcf3a,
-  0xd75b, 0xd77b, 0xdfbc, 0xefdd, 0xf7bc, 0xffbc, 0xf7bc, 0xf7dc,
-  0xe7bc, 0xc73b, 0xdf7b, 0xf77b, 0xf79b, 0xff9b, 0xff9b, 0xffbb,
-  0xf759, 0xff9a, 0xffdb, 0xffdb, 0xef39, 0xf759, 0xffbb, 0xef18,
-  0xffbb, 0xf77a, 0xef5a, 0xef39, 0xce56, 0xe719, 0xef39, 0xded8,
-  0xd657, 0xc616, 0xb5b5, 0x7c30, 0x7430, 0x8471, 0x8491, 0x7c51,
-  0x7451, 0x7430, 0x8491, 0x7c71, 0x7c50, 0x7c0f, 0x8471, 0x8c91,
-  0x8c70, 0x840f, 0x7c0f, 0x840f, 0x7bce, 0x8c4f, 0x9c90, 0xf6f8,
-  0xff38, 0xeef7, 0xf718, 0x2925, 0x3146, 0x3125, 0x3125, 0x3125,
-  0x3125, 0x3125, 0x3125, 0x3146, 0x3146, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x3186, 0x3186, 0x3166, 0x3186, 0x3186, 0x3186, 0x3987,
-  0x39a7, 0x39c7, 0x39e8, 0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x3a08,
-  0x4229, 0x4229, 0x4229, 0x4249, 0x426a, 0x4a8a, 0x634d, 0x52cb,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4229, 0x4249, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x424a, 0x426a, 0x426a,
-  0x4a8a, 0x5b0c, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4249,
-  0x4249, 0x4a6a, 0x4a8a, 0x428a, 0x4aab, 0x4acb, 0x4aaa, 0x428a,
-  0x4249, 0x426a, 0x428a, 0x426a, 0x4acb, 0x4aab, 0x42aa, 0x4aab,
-  0x4aab, 0x4acb, 0x52ec, 0x52ec, 0x52ec, 0x52cb, 0x4aab, 0x4aab,
-  0x4aec, 0x530c, 0x5b4d, 0x5b2d, 0x4acc, 0x4aec, 0x4acc, 0x4acb,
-  0x42ab, 0x42ab, 0x4aab, 0x4aab, 0x4acc, 0x4aec, 0x5b6d, 0x6bcf,
-  0x530c, 0x530c, 0x530c, 0x530c, 0x4acb, 0x52ec, 0x530c, 0x5b4d,
-  0x638e, 0x5b4d, 0x63ae, 0x5b4d, 0x63ae, 0x6baf, 0x636e, 0x5b6d,
-  0x5b6d, 0x6bcf, 0x6bcf, 0x7c51, 0x7c71, 0x7c71, 0x84b2, 0x94f3,
-  0x9534, 0x94f3, 0x8cd2, 0x8cf2, 0x9513, 0x9533, 0x9d54, 0x9534,
-  0xa575, 0x9d34, 0x9513, 0x8cd2, 0xa595, 0x8cd2, 0x7c71, 0x7471,
-  0x7430, 0x6c30, 0x84b2, 0x84d2, 0x84d2, 0x7cb2, 0x7c92, 0x84d3,
-  0x84d2, 0x8d34, 0x8d33, 0x9554, 0x9574, 0x9595, 0x9575, 0x9d95,
-  0x9db6, 0x9db5, 0x9db5, 0x9dd6, 0xa5f6, 0xa5f6, 0xa616, 0xa616,
-  0xae37, 0xae57, 0xb678, 0xb698, 0xbeb8, 0xbef9, 0xc71a, 0xcf3a,
-  0xd75b, 0xd77b, 0xdfbc, 0xefdd, 0xf79c, 0xf7bc, 0xf7bc, 0xf7dc,
-  0xe7bc, 0xbf3b, 0xdf5b, 0xf79b, 0xf7bb, 0xffbb, 0xffbb, 0xffbb,
-  0xf759, 0xf779, 0xffdb, 0xffbb, 0xf759, 0xf77a, 0xffbb, 0xe718,
-  0xffbb, 0xf77a, 0xef39, 0xef59, 0xce57, 0xded9, 0xef39, 0xdeb8,
-  0xd677, 0xce57, 0xb574, 0x7c30, 0x7410, 0x8471, 0x8cb2, 0x7430,
-  0x6c10, 0x8472, 0x8cb2, 0x7c50, 0x7430, 0x7c30, 0x8450, 0x8430,
-  0x8c71, 0x840f, 0x7bef, 0x7bce, 0x7bef, 0x9470, 0x944f, 0xe676,
-  0xff59, 0xde56, 0xde15, 0x2925, 0x2925, 0x2925, 0x3125, 0x3126,
-  0x3125, 0x3125, 0x3125, 0x3146, 0x3146, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3986, 0x3987,
-  0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e8, 0x3a08, 0x4208, 0x4229,
-  0x4229, 0x4229, 0x4249, 0x426a, 0x426a, 0x4a8a, 0x4a8a, 0x426a,
-  0x426a, 0x4249, 0x4229, 0x4249, 0x4249, 0x4249, 0x426a, 0x4269,
-  0x4269, 0x4a6a, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x426a, 0x4249, 0x4a6a, 0x4a8a, 0x52ec, 0x4249,
-  0x4a8a, 0x426a, 0x4249, 0x4229, 0x3a28, 0x4229, 0x4249, 0x4229,
-  0x4249, 0x4249, 0x426a, 0x4269, 0x4249, 0x4a8a, 0x4a8a, 0x426a,
-  0x4aaa, 0x428a, 0x5b6d, 0x73f0, 0x638e, 0x532c, 0x530c, 0x530c,
-  0x530c, 0x4aeb, 0x52cb, 0x4acb, 0x4acb, 0x52cb, 0x52ec, 0x5b2d,
-  0x52ec, 0x532d, 0x5b6e, 0x5b4d, 0x532d, 0x530c, 0x4aec, 0x4acb,
-  0x4acb, 0x42ab, 0x42ab, 0x428b, 0x4acc, 0x4b0c, 0x5b6e, 0x7c51,
-  0x5b6d, 0x5b4d, 0x5b4d, 0x530c, 0x52eb, 0x530c, 0x5b2c, 0x5b4d,
-  0x636e, 0x638e, 0x5b6d, 0x636e, 0x5b6d, 0x530c, 0x530c, 0x5b6d,
-  0x636e, 0x638e, 0x7410, 0x7410, 0x7410, 0x7c71, 0x8492, 0x8492,
-  0x8492, 0x7c51, 0x7c51, 0x84b2, 0x94f3, 0x9513, 0x9d54, 0x9513,
-  0x9513, 0x9513, 0x7c71, 0x7c71, 0x8492, 0x84b2, 0x7451, 0x7451,
-  0x6c10, 0x63ef, 0x7c92, 0x7c92, 0x7471, 0x7471, 0x7cb2, 0x7cd2,
-  0x84f2, 0x8513, 0x8d13, 0x8d33, 0x8d54, 0x9575, 0x9d95, 0x9d95,
-  0x9db5, 0x9db5, 0x9db6, 0x9dd6, 0xa5f6, 0xa5f6, 0xa5f6, 0xae17,
-  0xae37, 0xae57, 0xb678, 0xb698, 0xbeb8, 0xc6f9, 0xc71a, 0xcf3a,
-  0xd75b, 0xd77b, 0xdfbc, 0xf7dd, 0xf79c, 0xf79c, 0xf7bc, 0xffdc,
-  0xe7bc, 0xbf3b, 0xdf5b, 0xf79b, 0xf7bb, 0xffdb, 0xffbb, 0xffdb,
-  0xf759, 0xf779, 0xffdb, 0xffbb, 0xef39, 0xff9b, 0xffbb, 0xef39,
-  0xffbb, 0xf77a, 0xef19, 0xe719, 0xce57, 0xded8, 0xef39, 0xded8,
-  0xd677, 0xd677, 0xb574, 0x7c50, 0x7430, 0x8451, 0x8451, 0x7430,
-  0x6c10, 0x8cf3, 0x94f3, 0x7c50, 0x740f, 0x8471, 0x8470, 0x8c50,
-  0x8c71, 0x7bef, 0x7bce, 0x73ae, 0x840f, 0x7bce, 0x7bee, 0xbd52,
-  0xff7a, 0xe697, 0xcd93, 0x2925, 0x2925, 0x3125, 0x3125, 0x3126,
-  0x3126, 0x3126, 0x3146, 0x3146, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x3986, 0x3986, 0x39a7, 0x39a7,
-  0x39c7, 0x39c7, 0x39e7, 0x39e8, 0x4208, 0x4208, 0x3a08, 0x4229,
-  0x3a08, 0x4229, 0x4249, 0x4a6a, 0x426a, 0x426a, 0x426a, 0x4249,
-  0x4a8a, 0x4249, 0x4229, 0x4249, 0x4249, 0x4249, 0x4249, 0x426a,
-  0x426a, 0x4a8a, 0x4a6a, 0x4249, 0x4269, 0x4249, 0x4269, 0x4269,
-  0x4249, 0x426a, 0x4249, 0x4a8a, 0x4a8a, 0x4aab, 0x426a, 0x4249,
-  0x426a, 0x4249, 0x4229, 0x4229, 0x3a29, 0x3a29, 0x4208, 0x4229,
-  0x4229, 0x3a29, 0x4229, 0x4229, 0x4249, 0x3a49, 0x428a, 0x4aeb,
-  0x4aab, 0x428a, 0x530d, 0x5b4d, 0x5b4d, 0x5b6e, 0x5b6d, 0x638e,
-  0x63cf, 0x5b6e, 0x530d, 0x530c, 0x4acb, 0x52ec, 0x52ec, 0x530c,
-  0x5b2d, 0x638e, 0x5b6e, 0x63af, 0x638e, 0x5b4d, 0x5b4d, 0x532d,
-  0x4acb, 0x42ab, 0x4aab, 0x42ab, 0x4acc, 0x530c, 0x5b6d, 0x6bcf,
-  0x7c51, 0x7430, 0x6bae, 0x5b4d, 0x530c, 0x5b2d, 0x5b6d, 0x636e,
-  0x6baf, 0x5b6d, 0x5b6d, 0x63ae, 0x5b6d, 0x5b4d, 0x638e, 0x6bce,
-  0x5b4d, 0x6bef, 0x638e, 0x6baf, 0x6c0f, 0x7410, 0x7c51, 0x7410,
-  0x7c30, 0x7c51, 0x7c71, 0x7c71, 0x8cb2, 0x9513, 0x9513, 0x9513,
-  0x8cd2, 0x8471, 0x7430, 0x7430, 0x7451, 0x6c10, 0x6bef, 0x6c10,
-  0x6bef, 0x63ef, 0x6c10, 0x7471, 0x6c10, 0x7451, 0x7cb2, 0x7cb2,
-  0x84d2, 0x84f3, 0x8d34, 0x8d13, 0x8d13, 0x9554, 0x9595, 0x9595,
-  0x9db5, 0x9dd6, 0x9db5, 0xa5f6, 0xa5f6, 0xa5f6, 0xa5f6, 0xa616,
-  0xae37, 0xae57, 0xb678, 0xb698, 0xbeb9, 0xc6f9, 0xc71a, 0xcf3a,
-  0xd77b, 0xd77b, 0xdfbc, 0xf7bd, 0xf79c, 0xf7bc, 0xf7bc, 0xffdc,
-  0xe7bc, 0xb75b, 0xdf7b, 0xf79b, 0xffbb, 0xffdb, 0xffdb, 0xffdb,
-  0xf759, 0xf779, 0xffdb, 0xff9a, 0xef39, 0xffbb, 0xf79a, 0xf75a,
-  0xffdb, 0xf77a, 0xe719, 0xe739, 0xd677, 0xded8, 0xef19, 0xded8,
-  0xce56, 0xce57, 0xad54, 0x7c50, 0x7430, 0x8c92, 0x8471, 0x7430,
-  0x7430, 0x7c71, 0x8491, 0x7c50, 0x7c50, 0x8491, 0x8430, 0x8c71,
-  0x8c70, 0x7c0f, 0x7bee, 0x840f, 0x83ef, 0x738d, 0x7bef, 0xc594,
-  0xff59, 0xf718, 0xf6d8, 0x2925, 0x3125, 0x3125, 0x3125, 0x3126,
-  0x3146, 0x3146, 0x3146, 0x3166, 0x3166, 0x3186, 0x3166, 0x3186,
-  0x3186, 0x3986, 0x3986, 0x3986, 0x3986, 0x39a7, 0x39a7, 0x39a7,
-  0x39c7, 0x39e7, 0x39e8, 0x3a08, 0x4208, 0x4208, 0x4229, 0x4229,
-  0x4a6a, 0x4249, 0x4269, 0x4269, 0x4a8a, 0x4a8a, 0x4a6a, 0x4a8a,
-  0x426a, 0x4249, 0x424a, 0x426a, 0x4249, 0x4249, 0x426a, 0x426a,
-  0x4a8a, 0x4a6a, 0x4249, 0x424a, 0x4a6a, 0x4249, 0x4269, 0x4249,
-  0x4269, 0x426a, 0x4269, 0x426a, 0x4a6a, 0x4a8a, 0x4249, 0x426a,
-  0x4249, 0x4229, 0x3a09, 0x3a09, 0x3a29, 0x3a09, 0x3a28, 0x3a08,
-  0x3a08, 0x3a29, 0x3a28, 0x4229, 0x4229, 0x3a29, 0x4249, 0x4aab,
-  0x530c, 0x428a, 0x428a, 0x4acb, 0x532d, 0x530c, 0x4b0c, 0x534d,
-  0x63ae, 0x7c92, 0x7c72, 0x6bcf, 0x63ae, 0x5b0c, 0x5b2c, 0x5b4d,
-  0x636e, 0x636e, 0x638e, 0x63af, 0x6bcf, 0x63ae, 0x5b6e, 0x5b4d,
-  0x4aec, 0x4acb, 0x42ab, 0x42ab, 0x4acb, 0x4aec, 0x532d, 0x63ae,
-  0x63cf, 0x740f, 0x6bce, 0x6bcf, 0x6bae, 0x6b8e, 0x636e, 0x6bae,
-  0x6bcf, 0x638e, 0x6baf, 0x6bcf, 0x7410, 0x7410, 0x6bcf, 0x5b4d,
-  0x5b6d, 0x638e, 0x638e, 0x636e, 0x63ae, 0x7430, 0x6bce, 0x7430,
-  0x7c50, 0x8492, 0x8491, 0x7c50, 0x8cd2, 0x9514, 0x8cf3, 0x8cf3,
-  0x7c51, 0x7430, 0x7450, 0x7c71, 0x6bef, 0x6c10, 0x6bef, 0x6bef,
-  0x63cf, 0x6bef, 0x6c0f, 0x7451, 0x7450, 0x7451, 0x7cb2, 0x84d2,
-  0x84f3, 0x84f3, 0x8d13, 0x8d33, 0x9554, 0x9575, 0x9595, 0x9d95,
-  0x9595, 0x9db5, 0x9db6, 0x9dd6, 0x9dd6, 0xa5f6, 0xa5f6, 0xa617,
-  0xa637, 0xae57, 0xae78, 0xb698, 0xbeb8, 0xc6f9, 0xc71a, 0xcf3a,
-  0xd77b, 0xd77b, 0xdfbc, 0xf7bd, 0xf79c, 0xf79c, 0xf7bc, 0xf7dc,
-  0xe7bc, 0xb73b, 0xe79b, 0xef9a, 0xf7bb, 0xffdc, 0xfffb, 0xffdc,
-  0xef39, 0xf779, 0xffdb, 0xf79a, 0xf75a, 0xffbb, 0xf77a, 0xf75a,
-  0xffdb, 0xf77a, 0xe739, 0xef39, 0xd697, 0xd677, 0xe719, 0xdeb7,
-  0xce56, 0xce16, 0x9d13, 0x7c50, 0x7430, 0x8cb2, 0x7c51, 0x7451,
-  0x6c30, 0x7430, 0x7c71, 0x7c71, 0x8470, 0x7c50, 0x8450, 0x8450,
-  0x8450, 0x7c0f, 0x840f, 0x8c50, 0x7bee, 0x73ae, 0x73ae, 0xbd74,
-  0xff79, 0xe676, 0xe656, 0x2925, 0x2925, 0x3125, 0x3125, 0x3146,
-  0x3146, 0x3146, 0x3146, 0x3146, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x3987, 0x3987, 0x3986, 0x3986, 0x3987, 0x39a7, 0x39c7, 0x39c7,
-  0x39c7, 0x39e7, 0x39e7, 0x39e8, 0x4228, 0x3a08, 0x4229, 0x4229,
-  0x4229, 0x4269, 0x4a8a, 0x4269, 0x4a8a, 0x4a8a, 0x4aab, 0x4a8a,
-  0x426a, 0x4249, 0x4229, 0x4249, 0x426a, 0x426a, 0x4a8a, 0x426a,
-  0x4aab, 0x426a, 0x426a, 0x426a, 0x426a, 0x4269, 0x4a6a, 0x4a6a,
-  0x4a8a, 0x4a8a, 0x426a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x426a,
-  0x4249, 0x4229, 0x3a29, 0x3a09, 0x3a09, 0x3a29, 0x3a08, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a29, 0x3a29, 0x4249, 0x3a29,
-  0x3a29, 0x3a49, 0x3a49, 0x428a, 0x4aab, 0x4aab, 0x4b0c, 0x530c,
-  0x534d, 0x63ae, 0x7c51, 0x8cd3, 0x6bf0, 0x73f0, 0x636e, 0x5b4d,
-  0x6bf0, 0x63ae, 0x638e, 0x6bcf, 0x7410, 0x6bef, 0x7431, 0x6c10,
-  0x5b4d, 0x4b0c, 0x4acc, 0x428b, 0x42ab, 0x42ab, 0x532d, 0x532d,
-  0x532d, 0x63ae, 0x63ae, 0x6bef, 0x73f0, 0x6baf, 0x6bef, 0x63ae,
-  0x636e, 0x6bcf, 0x7431, 0x6bcf, 0x6bef, 0x7410, 0x6bcf, 0x5b4d,
-  0x5b4d, 0x63ae, 0x63ae, 0x7c51, 0x6bcf, 0x5b6e, 0x5b4d, 0x6bef,
-  0x7c71, 0x7430, 0x7c51, 0x7c71, 0x84b2, 0x8cb2, 0x9513, 0x7c71,
-  0x7c71, 0x7c51, 0x84b2, 0x7450, 0x63ce, 0x6bef, 0x63cf, 0x63ae,
-  0x63cf, 0x63cf, 0x6c30, 0x7451, 0x7451, 0x7c91, 0x7cb2, 0x7cd2,
-  0x8513, 0x8d13, 0x8d13, 0x8d13, 0x8d54, 0x9574, 0x9574, 0x9554,
-  0x9575, 0x9db5, 0x9db5, 0x9db6, 0x9dd6, 0xa5f6, 0xa5f6, 0xa617,
-  0xa617, 0xae57, 0xae58, 0xb698, 0xbeb9, 0xbef9, 0xc71a, 0xcf3a,
-  0xd75b, 0xd77b, 0xdfbc, 0xf7bd, 0xf79c, 0xf7bc, 0xf7bc, 0xf7dc,
-  0xdfbc, 0xb73a, 0xe79b, 0xef7a, 0xf7ba, 0xffdc, 0xfffb, 0xffdb,
-  0xef39, 0xf779, 0xffdb, 0xf77a, 0xf77a, 0xffdb, 0xf77a, 0xef59,
-  0xffdb, 0xf77a, 0xef19, 0xe739, 0xded8, 0xce56, 0xef19, 0xdeb8,
-  0xd676, 0xc616, 0x94d2, 0x7c30, 0x7410, 0x7c51, 0x7410, 0x6c10,
-  0x6c10, 0x6c10, 0x7451, 0x7c71, 0x8470, 0x8471, 0x8451, 0x8c71,
-  0x94b1, 0x842f, 0x8450, 0x8c50, 0x73ad, 0x7bee, 0x738d, 0xb532,
-  0xff59, 0xe676, 0xe656, 0x2925, 0x2925, 0x3125, 0x3126, 0x3146,
-  0x3145, 0x3146, 0x3146, 0x3166, 0x3186, 0x3186, 0x3186, 0x3987,
-  0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x31a7, 0x39a7, 0x39a7, 0x39c7,
-  0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x4229, 0x3a08, 0x4229, 0x4249,
-  0x4269, 0x4249, 0x4a8a, 0x52cb, 0x4a8a, 0x52cb, 0x52cb, 0x52cb,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x426a, 0x426a, 0x4a6a, 0x4a8a,
-  0x4a6a, 0x4a8a, 0x426a, 0x4a8a, 0x426a, 0x426a, 0x426a, 0x4a8a,
-  0x426a, 0x4269, 0x426a, 0x4269, 0x426a, 0x426a, 0x426a, 0x4249,
-  0x3a29, 0x4229, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a09, 0x3a09,
-  0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x4229, 0x3a29, 0x3a49, 0x3a29,
-  0x3a29, 0x3a29, 0x3a49, 0x426a, 0x426a, 0x3a6a, 0x4acb, 0x532d,
-  0x4b0c, 0x534d, 0x5b4d, 0x84b2, 0x7430, 0x6bef, 0x7c31, 0x6baf,
-  0x6bef, 0x6bef, 0x7430, 0x6bcf, 0x7431, 0x7430, 0x7410, 0x6c10,
-  0x5b8e, 0x532d, 0x4aec, 0x42ab, 0x42ab, 0x42ab, 0x42cc, 0x5b6e,
-  0x532d, 0x5b4d, 0x638e, 0x6bcf, 0x638e, 0x6bcf, 0x6bf0, 0x6bef,
-  0x5b2d, 0x63ae, 0x6bcf, 0x638e, 0x6bef, 0x6bcf, 0x7410, 0x638e,
-  0x5b6e, 0x6bef, 0x6bcf, 0x5b4d, 0x5b8e, 0x5b4d, 0x5b4d, 0x638e,
-  0x7410, 0x7430, 0x7410, 0x8cd2, 0x84b2, 0x8cf3, 0x8cf2, 0x7c91,
-  0x7c70, 0x7c71, 0x9d95, 0x8d13, 0x6bef, 0x6bcf, 0x6bef, 0x63af,
-  0x63ef, 0x63ef, 0x6c30, 0x6c10, 0x7471, 0x7c92, 0x84d3, 0x84f3,
-  0x8513, 0x8d13, 0x8d13, 0x8514, 0x8d34, 0x8d34, 0x8d34, 0x8d54,
-  0x9575, 0x9595, 0x9595, 0x9db6, 0x9db6, 0x9dd6, 0x9df6, 0xa616,
-  0xa637, 0xae37, 0xae78, 0xb698, 0xbeb8, 0xbef9, 0xc71a, 0xcf5b,
-  0xd75b, 0xd77b, 0xdfbc, 0xf7bd, 0xf79c, 0xf7bc, 0xf7bc, 0xf7dc,
-  0xdf9b, 0xb73a, 0xe79c, 0xef7b, 0xf7bb, 0xffdb, 0xffdc, 0xffdb,
-  0xef19, 0xf77a, 0xffbb, 0xf75a, 0xf77a, 0xffdb, 0xf79a, 0xf77a,
-  0xffdb, 0xf77a, 0xef19, 0xe719, 0xded9, 0xd657, 0xe6d8, 0xd657,
-  0xd697, 0xc616, 0x94d2, 0x7430, 0x6bef, 0x7c51, 0x7410, 0x6bf0,
-  0x6c10, 0x7430, 0x7430, 0x7450, 0x8471, 0x8c91, 0x8c71, 0x8c91,
-  0x8450, 0x8450, 0x842f, 0x7c0f, 0x6b8d, 0x7bee, 0x7bce, 0xa4b0,
-  0xe696, 0xde55, 0xde15, 0x2946, 0x3125, 0x3125, 0x3126, 0x3126,
-  0x3146, 0x3145, 0x3146, 0x3166, 0x3166, 0x3986, 0x3986, 0x39a7,
-  0x39c7, 0x39c7, 0x39c7, 0x39a7, 0x39a7, 0x39a7, 0x39c7, 0x39c8,
-  0x39c8, 0x39c8, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x4229, 0x4249,
-  0x4269, 0x426a, 0x4aab, 0x4a8a, 0x4a8a, 0x4a8a, 0x4aab, 0x4aab,
-  0x426a, 0x4aab, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a6a,
-  0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x426a, 0x426a, 0x426a,
-  0x4249, 0x4269, 0x4269, 0x426a, 0x4249, 0x426a, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x4229, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a09,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a09, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a49, 0x428a, 0x42ab, 0x426a, 0x42ab, 0x4acc,
-  0x4aec, 0x4aec, 0x4acb, 0x4aec, 0x63ae, 0x8cf3, 0x9514, 0x6c10,
-  0x63ae, 0x7c51, 0x7431, 0x6bf0, 0x7c51, 0x7c92, 0x7410, 0x5b6e,
-  0x5b6e, 0x63af, 0x534d, 0x530d, 0x4acc, 0x42ab, 0x4acc, 0x4aec,
-  0x532d, 0x532d, 0x5b8e, 0x63af, 0x638e, 0x6bef, 0x6bcf, 0x7410,
-  0x638e, 0x63ae, 0x6bef, 0x6bef, 0x6bcf, 0x7c31, 0x6bef, 0x638e,
-  0x6bf0, 0x63ae, 0x638e, 0x6bcf, 0x5b6d, 0x5b2d, 0x5b4d, 0x63af,
-  0x740f, 0x6c0f, 0x8491, 0x84b2, 0x7c70, 0x8cd2, 0x7450, 0x7c91,
-  0x7c91, 0x6c30, 0x7c71, 0x84f2, 0x6c0f, 0x63cf, 0x6bf0, 0x63cf,
-  0x63cf, 0x6c30, 0x7450, 0x7451, 0x7c92, 0x7cb2, 0x84f3, 0x8d14,
-  0x9554, 0x8d34, 0x8d54, 0x8d34, 0x8d54, 0x8d34, 0x8d33, 0x8d54,
-  0x9575, 0x9575, 0x9595, 0x9db5, 0x9db5, 0x9dd6, 0x9dd6, 0xa5f6,
-  0xa636, 0xae57, 0xae78, 0xb698, 0xbed9, 0xbef9, 0xc71a, 0xcf5b,
-  0xd77b, 0xd77b, 0xe7bc, 0xf7bd, 0xf79c, 0xf7bc, 0xf7bc, 0xf7dc,
-  0xdf9b, 0xbf5b, 0xe79c, 0xe77a, 0xf7bb, 0xffbb, 0xffdc, 0xf7bb,
-  0xe718, 0xf77a, 0xff9b, 0xf75a, 0xf75a, 0xf7ba, 0xf7ba, 0xffbb,
-  0xffdb, 0xf77a, 0xef39, 0xe6f9, 0xde98, 0xd698, 0xce36, 0xc5f6,
-  0xd698, 0xc5f6, 0x8c91, 0x6bef, 0x6bcf, 0x7c71, 0x6c10, 0x63cf,
-  0x6bf0, 0x7431, 0x7c71, 0x7430, 0x8491, 0x8471, 0x8470, 0x94b1,
-  0x8450, 0x8430, 0x7bef, 0x6b8d, 0x6b6d, 0x73ad, 0x7bce, 0xa4b0,
-  0xf739, 0xeeb7, 0xe656, 0x2946, 0x3146, 0x3146, 0x3145, 0x3145,
-  0x3145, 0x3145, 0x3146, 0x3166, 0x3186, 0x39a7, 0x39a7, 0x39a7,
-  0x39c7, 0x39e8, 0x4a89, 0x6b8e, 0x5acb, 0x4249, 0x39a7, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x4229, 0x4209, 0x4229, 0x3a29, 0x4249,
-  0x4249, 0x4a8a, 0x4a8a, 0x4aab, 0x4aab, 0x52cb, 0x52cb, 0x4a8a,
-  0x4aaa, 0x4aab, 0x4a8a, 0x4aab, 0x4aab, 0x4a8a, 0x4aab, 0x4aab,
-  0x4acb, 0x4aab, 0x4a8a, 0x426a, 0x4a8a, 0x4a8a, 0x426a, 0x426a,
-  0x4249, 0x426a, 0x426a, 0x4269, 0x4249, 0x426a, 0x4249, 0x4249,
-  0x4249, 0x424a, 0x424a, 0x4aab, 0x428a, 0x4aab, 0x3a29, 0x39e8,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a29, 0x3a29, 0x3a29,
-  0x3a29, 0x424a, 0x426a, 0x426a, 0x428a, 0x4aab, 0x4aab, 0x4aab,
-  0x4acb, 0x42ab, 0x428a, 0x42ab, 0x532d, 0x7410, 0x6bf0, 0x6bf0,
-  0x7430, 0x8cd3, 0x8cf3, 0x8492, 0x7c71, 0x84b2, 0x7c92, 0x6bf0,
-  0x63cf, 0x6bf0, 0x5b6e, 0x5b4e, 0x4aec, 0x42cc, 0x42ab, 0x42ab,
-  0x4aec, 0x4aec, 0x532d, 0x638e, 0x638e, 0x63ae, 0x6c10, 0x63ae,
-  0x63ae, 0x6bef, 0x7430, 0x63ae, 0x638e, 0x6bcf, 0x5b6d, 0x5b4d,
-  0x6bf0, 0x5b6e, 0x638e, 0x5b6e, 0x5b6e, 0x532d, 0x638e, 0x6c10,
-  0x6bef, 0x7c51, 0x7c51, 0x7450, 0x7c91, 0x7c71, 0x7430, 0x6c10,
-  0x7451, 0x7430, 0x7471, 0x7450, 0x6c30, 0x63ef, 0x63cf, 0x63ae,
-  0x63cf, 0x7430, 0x7450, 0x7491, 0x84d2, 0x7cb2, 0x84f3, 0x8d34,
-  0x9554, 0x8d54, 0x9574, 0x9575, 0x8d54, 0x8d34, 0x8d34, 0x8d54,
-  0x9554, 0x9554, 0x9595, 0x95b5, 0x9595, 0x9db5, 0x9dd6, 0xa5f6,
-  0xa637, 0xae57, 0xae78, 0xb6b8, 0xbed8, 0xbef9, 0xc73a, 0xcf5b,
-  0xd77b, 0xd77b, 0xe7bc, 0xffbd, 0xff9c, 0xf7bc, 0xf7bc, 0xffdc,
-  0xdfbc, 0xbf7b, 0xe79b, 0xe75a, 0xf7bb, 0xffdb, 0xfffc, 0xf79b,
-  0xe6f8, 0xf75a, 0xf77a, 0xef59, 0xf75a, 0xf79a, 0xffbb, 0xf7ba,
-  0xffbb, 0xf77a, 0xef5a, 0xe6f9, 0xd677, 0xce57, 0xc616, 0xbdd6,
-  0xd698, 0xbdd5, 0x8471, 0x6bef, 0x63af, 0x7c51, 0x6bcf, 0x63cf,
-  0x63ef, 0x7451, 0x8cf3, 0x7450, 0x8471, 0x8471, 0x8471, 0x842f,
-  0x8450, 0x8430, 0x7bef, 0x73ae, 0x738e, 0x7bee, 0x73ad, 0xa4d1,
-  0xff59, 0xeef7, 0xe696, 0x3146, 0x3146, 0x3146, 0x3145, 0x3145,
-  0x3146, 0x3166, 0x3166, 0x3186, 0x3186, 0x3186, 0x39a7, 0x39a7,
-  0x39c7, 0x39e8, 0x4208, 0x5b2c, 0xa575, 0x636d, 0x3186, 0x39e8,
-  0x3a08, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x4229, 0x4249, 0x4a8a,
-  0x4a8a, 0x4aab, 0x4aab, 0x52ab, 0x52cb, 0x4aab, 0x52cb, 0x52cb,
-  0x4aaa, 0x4aab, 0x4aab, 0x4aab, 0x4a8a, 0x4aab, 0x4aab, 0x4aab,
-  0x4acb, 0x52ec, 0x4aab, 0x4a8a, 0x426a, 0x426a, 0x4a6a, 0x4a8a,
-  0x426a, 0x426a, 0x4249, 0x4249, 0x426a, 0x4249, 0x4249, 0x4249,
-  0x4249, 0x424a, 0x426a, 0x426a, 0x4a6a, 0x426a, 0x31e8, 0x3a08,
-  0x3a08, 0x3a29, 0x3208, 0x3a08, 0x3a08, 0x3a08, 0x3a09, 0x3a29,
-  0x4acb, 0x4aec, 0x3a49, 0x426a, 0x428b, 0x42ab, 0x4aab, 0x4acc,
-  0x4acb, 0x4acb, 0x4acb, 0x4acb, 0x4acc, 0x532d, 0x6bcf, 0x6bd0,
-  0x7410, 0x7c51, 0x84b2, 0x84b2, 0x7c71, 0x9514, 0xa596, 0x84d3,
-  0x7c71, 0x7c72, 0x63cf, 0x63af, 0x5b4e, 0x4b0d, 0x42ab, 0x4acc,
-  0x42ab, 0x42ac, 0x4acc, 0x532d, 0x5b6e, 0x638e, 0x6bef, 0x6bcf,
-  0x6bef, 0x7c51, 0x8492, 0x6c10, 0x6bcf, 0x5b4d, 0x5b4d, 0x636e,
-  0x5b6e, 0x5b4d, 0x638e, 0x534d, 0x5b4d, 0x5b6d, 0x63ae, 0x638e,
-  0x63ae, 0x6bef, 0x6bef, 0x7410, 0x7431, 0x7430, 0x7430, 0x7451,
-  0x7451, 0x7430, 0x7450, 0x7430, 0x6bef, 0x63ef, 0x6c10, 0x63af,
-  0x6bef, 0x7471, 0x7450, 0x7491, 0x7cd2, 0x7cd2, 0x84f3, 0x8d54,
-  0x9575, 0x9554, 0x9554, 0x8d54, 0x8d34, 0x8d34, 0x8d34, 0x8d54,
-  0x8d54, 0x9575, 0x9595, 0x9595, 0x9595, 0x9db5, 0x9dd6, 0x9dd6,
-  0xa616, 0xa637, 0xae78, 0xb6b8, 0xb6d8, 0xbef9, 0xc73a, 0xcf5b,
-  0xd77b, 0xd77b, 0xe7bc, 0xffbd, 0xf79c, 0xf79c, 0xf7bb, 0xf7bc,
-  0xdfbc, 0xc77b, 0xe77b, 0xe75a, 0xf7bb, 0xffbb, 0xffdc, 0xef7b,
-  0xded8, 0xf75a, 0xef59, 0xef59, 0xf75a, 0xf79a, 0xffbb, 0xf7bb,
-  0xffbb, 0xf77a, 0xf77a, 0xe6f9, 0xd677, 0xc5f6, 0xc636, 0xbdd5,
-  0xd677, 0xbdd5, 0x8451, 0x6bcf, 0x63ae, 0x6bf0, 0x63cf, 0x63cf,
-  0x63f0, 0x7430, 0x8491, 0x7430, 0x7c50, 0x8491, 0x8491, 0x7c2f,
-  0x8430, 0x7c0f, 0x8430, 0x73ce, 0x73ad, 0x7bce, 0x6b6d, 0x944f,
-  0xe6b7, 0xe6b7, 0xde56, 0x3146, 0x3146, 0x3146, 0x3146, 0x3146,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x39a7, 0x39a7, 0x39c7,
-  0x4208, 0x39e8, 0x39e8, 0x3a08, 0x5aec, 0x52ab, 0x39c7, 0x39e8,
-  0x3a08, 0x3a08, 0x3a08, 0x4229, 0x4249, 0x4249, 0x426a, 0x4aab,
-  0x4a8a, 0x4a8a, 0x52cb, 0x5b0c, 0x52cb, 0x52cb, 0x4a8a, 0x52cb,
-  0x4aab, 0x4aaa, 0x4aab, 0x4aab, 0x52cb, 0x4a8a, 0x4aab, 0x4acb,
-  0x4aab, 0x52cb, 0x52ec, 0x4aab, 0x4aab, 0x4a8a, 0x426a, 0x4a8a,
-  0x4a8a, 0x426a, 0x426a, 0x4249, 0x4249, 0x4249, 0x426a, 0x426a,
-  0x426a, 0x426a, 0x426a, 0x428a, 0x428a, 0x3a49, 0x31e8, 0x3a09,
-  0x3208, 0x3208, 0x3208, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a29,
-  0x428a, 0x4aab, 0x4aec, 0x4b0c, 0x42ec, 0x4aec, 0x4acc, 0x52ec,
-  0x4acb, 0x4acb, 0x4aab, 0x42ab, 0x4acc, 0x4aec, 0x5b4d, 0x638e,
-  0x6bcf, 0x84b2, 0x9d75, 0xadf7, 0x8cf3, 0x9d75, 0x9534, 0x84d3,
-  0x9535, 0x9555, 0x84b3, 0x7431, 0x5b6e, 0x4b0d, 0x4b0d, 0x4acc,
-  0x4acc, 0x42ab, 0x4acc, 0x534d, 0x5b4d, 0x63ae, 0x6bcf, 0x6bef,
-  0x6baf, 0x638e, 0x638e, 0x63af, 0x638e, 0x638e, 0x5b4d, 0x636e,
-  0x5b4d, 0x532d, 0x532d, 0x5b4d, 0x5b6e, 0x5b6e, 0x5b6d, 0x5b4d,
-  0x63af, 0x5b8d, 0x63ae, 0x6c10, 0x6c10, 0x7430, 0x6c10, 0x7430,
-  0x7451, 0x6c10, 0x7451, 0x7cb2, 0x6c0f, 0x63ef, 0x6c10, 0x63cf,
-  0x6bef, 0x7c91, 0x7c91, 0x7cb2, 0x84f3, 0x84f3, 0x8d33, 0x8d54,
-  0x9575, 0x9575, 0x8d54, 0x8d54, 0x9575, 0x9554, 0x9575, 0x8d54,
-  0x9575, 0x9595, 0x95b5, 0x95b5, 0x9595, 0x9595, 0x9db6, 0x9dd6,
-  0xa616, 0xa637, 0xae78, 0xb6b8, 0xb6d8, 0xbef9, 0xc73a, 0xcf5b,
-  0xd77b, 0xd77b, 0xe7bc, 0xf7bd, 0xf79c, 0xf79b, 0xf7bb, 0xf7bb,
-  0xd7bc, 0xcf7b, 0xe77b, 0xe75a, 0xf7bb, 0xffbb, 0xffdc, 0xe75a,
-  0xded9, 0xef59, 0xef39, 0xf77a, 0xf77a, 0xf77a, 0xff9b, 0xf79b,
-  0xf7bb, 0xf79b, 0xf77a, 0xded8, 0xce57, 0xbdd5, 0xd677, 0xc5f6,
-  0xd677, 0xbdd5, 0x7c31, 0x6baf, 0x63ae, 0x6bcf, 0x6bef, 0x63cf,
-  0x6410, 0x7430, 0x7c50, 0x6c0f, 0x7c71, 0x8491, 0x7c50, 0x7c2f,
-  0x8450, 0x7c0f, 0x7c0f, 0x73ce, 0x73ae, 0x73cf, 0x6b6d, 0x83ee,
-  0xd615, 0xe676, 0xe676, 0x2946, 0x2945, 0x3166, 0x3146, 0x3166,
-  0x3166, 0x3146, 0x3166, 0x3166, 0x3186, 0x39c7, 0x39c8, 0x39c8,
-  0x39e8, 0x39c7, 0x39c8, 0x39e8, 0x3a08, 0x3a29, 0x3a08, 0x3a08,
-  0x3a29, 0x3a08, 0x3a09, 0x4229, 0x4249, 0x4249, 0x426a, 0x426a,
-  0x4aab, 0x4aab, 0x52cb, 0x530c, 0x52ec, 0x4acb, 0x4aab, 0x4aab,
-  0x4acb, 0x4acb, 0x4aab, 0x4aab, 0x4aab, 0x4acb, 0x52cb, 0x4acb,
-  0x52cb, 0x52cb, 0x52cb, 0x52cb, 0x4aab, 0x52ab, 0x4a8a, 0x428a,
-  0x428a, 0x4a8a, 0x428a, 0x426a, 0x426a, 0x4249, 0x426a, 0x426a,
-  0x428a, 0x428a, 0x4a8a, 0x4aab, 0x4aab, 0x84b3, 0x6baf, 0x31e8,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x3a29, 0x3a29,
-  0x426a, 0x52ec, 0x63af, 0x9535, 0xa5b6, 0x6bef, 0x636e, 0x636e,
-  0x5b2c, 0x530c, 0x4acc, 0x4acb, 0x4acc, 0x4acc, 0x4aec, 0x63af,
-  0x8cd3, 0xa5b6, 0xadd6, 0xb638, 0xadf7, 0x9d34, 0xa596, 0xadd7,
-  0xb617, 0xc6ba, 0xb618, 0x84d3, 0x7472, 0x63af, 0x532d, 0x4acc,
-  0x4acc, 0x42ac, 0x4aec, 0x530c, 0x530d, 0x638e, 0x63ae, 0x7430,
-  0x6bcf, 0x5b6d, 0x63cf, 0x5b6e, 0x5b4d, 0x6bcf, 0x5b6e, 0x638e,
-  0x5b4d, 0x5b4d, 0x530c, 0x5b4d, 0x6bcf, 0x63ae, 0x5b4d, 0x638e,
-  0x638e, 0x5b6e, 0x638e, 0x63ae, 0x6bef, 0x6bcf, 0x63ae, 0x7430,
-  0x7430, 0x7451, 0x7451, 0x6c30, 0x7451, 0x63cf, 0x6bef, 0x6c0f,
-  0x7450, 0x7c91, 0x7cd2, 0x84f3, 0x84d2, 0x8d13, 0x8d33, 0x9554,
-  0x9575, 0x8d54, 0x8d54, 0x9575, 0x9575, 0x9575, 0x8d75, 0x9575,
-  0x9575, 0x9575, 0x9595, 0x9595, 0x9595, 0x9db6, 0x9dd6, 0x9dd6,
-  0xa616, 0xa637, 0xae78, 0xb698, 0xbed9, 0xbef9, 0xc73a, 0xcf5b,
-  0xd77b, 0xd79b, 0xe7bc, 0xffbd, 0xf79b, 0xf79b, 0xf7bb, 0xefbb,
-  0xd7bc, 0xcf7b, 0xdf5b, 0xdf3a, 0xf7bb, 0xf7bb, 0xffdc, 0xe73a,
-  0xd6b8, 0xef39, 0xe6f9, 0xf75a, 0xf77a, 0xf77a, 0xf79a, 0xf77a,
-  0xf7bb, 0xffbb, 0xef5a, 0xde98, 0xce57, 0xc5f6, 0xd657, 0xce57,
-  0xd677, 0xc616, 0x8471, 0x6bcf, 0x63af, 0x6c10, 0x6bf0, 0x63cf,
-  0x63ef, 0x7450, 0x7c50, 0x7430, 0x8471, 0x8471, 0x7c2f, 0x7c2f,
-  0x8470, 0x7c0f, 0x7c0f, 0x73ce, 0x7bef, 0x73ae, 0x6b8e, 0x7bce,
-  0xde96, 0xe6b6, 0xde56, 0x2946, 0x3166, 0x3146, 0x3146, 0x3166,
-  0x3166, 0x3186, 0x3186, 0x3166, 0x3186, 0x31a7, 0x39c7, 0x39c7,
-  0x39a7, 0x39c7, 0x39c7, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x4229,
-  0x4229, 0x4249, 0x4229, 0x3a09, 0x4229, 0x426a, 0x4a8a, 0x4aab,
-  0x4aaa, 0x4acb, 0x530c, 0x52ec, 0x4aab, 0x4aab, 0x4aab, 0x4aab,
-  0x4aab, 0x4acb, 0x4acb, 0x4acb, 0x52cb, 0x4acb, 0x52ec, 0x530c,
-  0x52cc, 0x530c, 0x530c, 0x52ec, 0x52ec, 0x4aab, 0x4aab, 0x4aab,
-  0x4a8a, 0x4aab, 0x4aaa, 0x426a, 0x426a, 0x426a, 0x428a, 0x428a,
-  0x4a8a, 0x4aaa, 0x4aaa, 0x4acb, 0x5b4d, 0xb618, 0xa596, 0x3a08,
-  0x3a29, 0x3a29, 0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x4249, 0x4249,
-  0x4a8a, 0x530c, 0x638e, 0x9d75, 0xdf3c, 0xa5b6, 0xc679, 0x9d34,
-  0x6bae, 0x530c, 0x530c, 0x530c, 0x4acb, 0x4aab, 0x530c, 0x7410,
-  0x9555, 0x9514, 0xa595, 0x9534, 0x9513, 0xad95, 0xe75c, 0xefbd,
-  0xe79d, 0xef9d, 0xefbe, 0xd71b, 0xd73c, 0xa5b6, 0x5b6e, 0x4b0d,
-  0x4acc, 0x4acc, 0x4aec, 0x4acb, 0x532d, 0x636e, 0x6bcf, 0x7430,
-  0x63ae, 0x63ae, 0x63ae, 0x5b4d, 0x63af, 0x638e, 0x638e, 0x636e,
-  0x638e, 0x5b4d, 0x532d, 0x5b4d, 0x5b4d, 0x5b6d, 0x5b6e, 0x636e,
-  0x6bcf, 0x638e, 0x63ae, 0x6bf0, 0x6bcf, 0x6bcf, 0x63cf, 0x7431,
-  0x7430, 0x6c30, 0x6c10, 0x6bef, 0x6bef, 0x6c10, 0x6c10, 0x7450,
-  0x7471, 0x84d2, 0x84f3, 0x8d13, 0x8cf3, 0x8d34, 0x8d34, 0x9554,
-  0x9575, 0x9575, 0x9595, 0x8d54, 0x8d75, 0x9575, 0x9575, 0x9575,
-  0x8d75, 0x9575, 0x9595, 0x9db6, 0x9db6, 0x9db6, 0x9dd6, 0x9df6,
-  0xa617, 0xa637, 0xae58, 0xb698, 0xbed9, 0xbef9, 0xc73a, 0xcf5b,
-  0xcf7b, 0xcf9b, 0xe7bd, 0xffbd, 0xf79b, 0xf79b, 0xf7bb, 0xe79b,
-  0xcf9b, 0xd79b, 0xdf5b, 0xe75b, 0xf7bb, 0xf7bb, 0xffdc, 0xdf19,
-  0xd698, 0xded8, 0xdeb8, 0xef5a, 0xf75a, 0xf779, 0xf77a, 0xef5a,
-  0xf79b, 0xffbb, 0xef39, 0xd697, 0xce57, 0xce36, 0xd657, 0xd677,
-  0xde97, 0xc5f6, 0x7c31, 0x6baf, 0x63af, 0x6c10, 0x7410, 0x6bcf,
-  0x6c10, 0x6c30, 0x7c71, 0x7430, 0x8491, 0x8471, 0x7c50, 0x7c50,
-  0x8c70, 0x8c70, 0x73ae, 0x73ae, 0x73ce, 0x6bae, 0x6b6d, 0x736d,
-  0xcdf5, 0xe696, 0xde35, 0x2966, 0x3146, 0x3166, 0x3146, 0x3146,
-  0x3166, 0x3166, 0x3186, 0x3186, 0x3186, 0x31a7, 0x39a7, 0x39c7,
-  0x39a7, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39e8, 0x3a08, 0x4229,
-  0x4229, 0x424a, 0x426a, 0x4249, 0x4a8a, 0x4aab, 0x4a8a, 0x4aab,
-  0x4acb, 0x4acb, 0x52ec, 0x530c, 0x4aab, 0x4aab, 0x52ec, 0x52cb,
-  0x4acb, 0x52ec, 0x52ec, 0x52ec, 0x52ec, 0x4acb, 0x52ec, 0x4acb,
-  0x52ec, 0x52ec, 0x52ec, 0x52cc, 0x52ec, 0x52ec, 0x52cb, 0x4aab,
-  0x4acb, 0x4aab, 0x4aab, 0x428a, 0x4a8a, 0x4a8a, 0x428a, 0x4aaa,
-  0x4aab, 0x5b0c, 0x52cb, 0x5b4d, 0x5b2c, 0x5b4d, 0x638e, 0x4acb,
-  0x4269, 0x3a49, 0x3a29, 0x3a09, 0x3a08, 0x3a29, 0x4249, 0x426a,
-  0x52ec, 0x5b2d, 0x6bcf, 0x8492, 0x9d54, 0xe77c, 0xceda, 0x7410,
-  0x638e, 0x5b2d, 0x530d, 0x530c, 0x530c, 0x52ec, 0x52ec, 0x63af,
-  0x7c72, 0x84b2, 0x9513, 0xbe38, 0xce9a, 0xe77d, 0xe79d, 0xae17,
-  0xb638, 0xe77d, 0xdf5d, 0xa5d7, 0x9d96, 0x84d3, 0x63af, 0x530d,
-  0x4acc, 0x42ab, 0x428b, 0x42ab, 0x530c, 0x5b6e, 0x636e, 0x6bef,
-  0x638e, 0x638e, 0x5b2d, 0x5b6d, 0x636e, 0x636e, 0x63af, 0x530d,
-  0x5b6e, 0x5b4d, 0x63ae, 0x5b4d, 0x532d, 0x532d, 0x5b6d, 0x5b8e,
-  0x63af, 0x5b8e, 0x5b6d, 0x6bef, 0x7451, 0x6c10, 0x6c10, 0x7451,
-  0x7430, 0x6c10, 0x7430, 0x6c10, 0x7451, 0x7450, 0x7451, 0x7471,
-  0x7cb2, 0x8d33, 0x8d33, 0x8d34, 0x8d34, 0x8d54, 0x9575, 0x9575,
-  0x9555, 0x8d54, 0x9575, 0x8d55, 0x8d55, 0x9575, 0x8d75, 0x8d54,
-  0x9575, 0x9595, 0x9595, 0x9db5, 0x9db5, 0x9db6, 0x9db6, 0x9dd6,
-  0xa5f6, 0xa637, 0xae57, 0xb698, 0xbed9, 0xbef9, 0xc71a, 0xcf5a,
-  0xcf7b, 0xcf9b, 0xe7bd, 0xffbd, 0xf79c, 0xf79b, 0xf7bb, 0xe7bc,
-  0xd79b, 0xd79b, 0xdf5b, 0xe75b, 0xf79b, 0xffdb, 0xffdc, 0xdf1a,
-  0xceb8, 0xd698, 0xd698, 0xef5a, 0xef59, 0xef59, 0xf77a, 0xf75a,
-  0xf79b, 0xffbb, 0xef59, 0xd697, 0xc616, 0xd677, 0xce36, 0xd657,
-  0xdeb8, 0xbdd5, 0x7410, 0x63af, 0x638e, 0x6c10, 0x7430, 0x6bef,
-  0x6c10, 0x6c10, 0x7430, 0x7410, 0x7c50, 0x7c50, 0x7c50, 0x8450,
-  0x9491, 0x7c2f, 0x6b6d, 0x6b8d, 0x73ae, 0x73ae, 0x6b8d, 0x630b,
-  0xbd73, 0xe696, 0xde35, 0x2946, 0x2925, 0x3166, 0x3145, 0x3145,
-  0x3166, 0x3166, 0x3166, 0x3187, 0x3187, 0x31a7, 0x39a7, 0x39a7,
-  0x39a7, 0x39c7, 0x39c8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x3a29,
-  0x4249, 0x4249, 0x426a, 0x426a, 0x4aab, 0x4aab, 0x4aab, 0x4aab,
-  0x52ec, 0x52ec, 0x52ec, 0x52ec, 0x4acb, 0x5b0c, 0x52cb, 0x52cb,
-  0x52ec, 0x52ec, 0x52ec, 0x52ec, 0x530c, 0x530c, 0x530c, 0x530c,
-  0x52ec, 0x5b2d, 0x530c, 0x5b2d, 0x634d, 0x5b0c, 0x5b0c, 0x5b2d,
-  0x530c, 0x52ec, 0x52ec, 0x4a8a, 0x4aab, 0x4a8b, 0x4acb, 0x530c,
-  0x5b2d, 0x5b4d, 0x634d, 0x634d, 0x52eb, 0x52ec, 0x4acb, 0x4aab,
-  0x428a, 0x4249, 0x3a29, 0x4249, 0x3a29, 0x4249, 0x4a6a, 0x4a8a,
-  0x5b0c, 0x636e, 0x63ae, 0x6bef, 0x8cd3, 0xc679, 0x7c71, 0x5b6e,
-  0x6baf, 0x6baf, 0x530c, 0x636e, 0x8492, 0x7c72, 0x6bf0, 0x6bef,
-  0x6bcf, 0x7c72, 0xc6ba, 0xceba, 0x8cd3, 0x9d55, 0x7c91, 0x5bce,
-  0x8d14, 0x63f0, 0x5baf, 0x4aec, 0x4b0c, 0x4aab, 0x4aab, 0x428a,
-  0x4acb, 0x42ab, 0x3a4a, 0x426a, 0x5b2d, 0x532d, 0x636e, 0x7410,
-  0x5b6d, 0x5b4d, 0x636e, 0x532d, 0x532d, 0x5b4d, 0x5b4d, 0x5b4d,
-  0x5b6e, 0x5b4d, 0x638e, 0x6baf, 0x532c, 0x5b4d, 0x5b6d, 0x63ae,
-  0x63af, 0x638e, 0x5b8e, 0x5b6d, 0x6bcf, 0x7c71, 0x7430, 0x7471,
-  0x84d3, 0x8cf3, 0x6c10, 0x7450, 0x7cb2, 0x7471, 0x7cb2, 0x84d2,
-  0x8d13, 0x8d33, 0x9554, 0x8d54, 0x8d34, 0x8d54, 0x8d54, 0x8d33,
-  0x8d34, 0x8d54, 0x9575, 0x8d54, 0x8d55, 0x8d54, 0x8d54, 0x9575,
-  0x8d75, 0x9575, 0x9595, 0x9595, 0x9595, 0x95b5, 0x95b6, 0x9dd6,
-  0xa616, 0xa637, 0xae57, 0xb698, 0xb6d8, 0xbef9, 0xc71a, 0xcf5a,
-  0xcf7b, 0xd79c, 0xe7bd, 0xf7bd, 0xf79c, 0xf79b, 0xf79b, 0xe79c,
-  0xcf7b, 0xd77b, 0xdf5b, 0xdf3a, 0xf79b, 0xf7db, 0xffdc, 0xdf19,
-  0xc697, 0xce98, 0xdeb8, 0xef5a, 0xef5a, 0xef59, 0xef59, 0xf75a,
-  0xf79a, 0xffbb, 0xef7a, 0xdeb8, 0xc5f6, 0xce57, 0xd677, 0xce36,
-  0xdeb8, 0xbdf6, 0x7430, 0x63cf, 0x638f, 0x7410, 0x7450, 0x6bf0,
-  0x6bf0, 0x7430, 0x7430, 0x6bef, 0x7410, 0x7c51, 0x7c30, 0x8450,
-  0x8c91, 0x740f, 0x636d, 0x73cf, 0x73ae, 0x73ae, 0x73ae, 0x632c,
-  0xbd52, 0xe676, 0xde35, 0x2925, 0x2925, 0x2925, 0x2945, 0x3145,
-  0x3146, 0x3166, 0x3166, 0x3186, 0x3187, 0x31a7, 0x31a7, 0x31a7,
-  0x39c7, 0x39c7, 0x39c8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x3a09,
-  0x426a, 0x4a6a, 0x426a, 0x4aab, 0x52ab, 0x4a8a, 0x4acb, 0x4acb,
-  0x530c, 0x530c, 0x530c, 0x530c, 0x52ec, 0x530c, 0x52ec, 0x52ec,
-  0x530c, 0x530c, 0x530c, 0x52ec, 0x5b2d, 0x530c, 0x5b2d, 0x530c,
-  0x5b4d, 0x5b4d, 0x5b4d, 0x634d, 0x636e, 0x636e, 0x638e, 0x6b8e,
-  0x5b2d, 0x634d, 0x5b0c, 0x52cb, 0x52ec, 0x52ec, 0x5b2d, 0x636e,
-  0x638e, 0x73f0, 0x6bcf, 0x638e, 0x52cb, 0x4acb, 0x4aab, 0x4aaa,
-  0x4a8a, 0x426a, 0x4249, 0x4249, 0x426a, 0x426a, 0x4a8a, 0x52cb,
-  0x5b0c, 0x634d, 0x6bce, 0x7410, 0x8471, 0x8471, 0x5b6e, 0x5b6e,
-  0x638e, 0x638e, 0x7430, 0x8cf3, 0xa596, 0x9d55, 0x8cf3, 0xa596,
-  0x9d76, 0x9d96, 0xb638, 0x8cd3, 0x63ae, 0x5b8e, 0x536d, 0x5b8e,
-  0x5b6e, 0x4aec, 0x4aed, 0x4aac, 0x428b, 0x426a, 0x4aab, 0x4acc,
-  0x4acb, 0x4acb, 0x428a, 0x4aec, 0x532d, 0x5b4d, 0x636e, 0x638e,
-  0x5b6d, 0x532c, 0x636d, 0x5b6d, 0x5b6d, 0x5b6d, 0x636e, 0x530c,
-  0x530c, 0x532c, 0x638e, 0x7410, 0x5b4d, 0x5b6d, 0x5b4d, 0x5b6e,
-  0x5b6e, 0x638e, 0x5b6e, 0x5b8e, 0x63ae, 0x63ae, 0x6bef, 0x7451,
-  0x84b2, 0x7c71, 0x7c71, 0x7c91, 0x84d2, 0x84d2, 0x84f2, 0x9554,
-  0x9554, 0x9554, 0x9554, 0x9554, 0x9554, 0x9554, 0x8d34, 0x8d34,
-  0x8513, 0x8d34, 0x8d54, 0x8d34, 0x8d54, 0x8d34, 0x8d34, 0x8d54,
-  0x8d54, 0x9575, 0x8d75, 0x8d74, 0x9595, 0x95b5, 0x9db6, 0x9dd6,
-  0xa616, 0xa637, 0xae57, 0xb698, 0xb6d8, 0xbef9, 0xc71a, 0xcf5a,
-  0xcf7b, 0xcf9c, 0xe7bd, 0xf7bd, 0xf79c, 0xf79b, 0xf79b, 0xe79b,
-  0xcf7b, 0xd77b, 0xdf5b, 0xdf3a, 0xf79b, 0xffdc, 0xffdc, 0xdf19,
-  0xbe57, 0xceb8, 0xe719, 0xef39, 0xef5a, 0xef5a, 0xef39, 0xef59,
-  0xf77a, 0xffbb, 0xef39, 0xd697, 0xc616, 0xce57, 0xdeb8, 0xce36,
-  0xded8, 0xc5f6, 0x6c10, 0x63cf, 0x638e, 0x6c0f, 0x7c71, 0x7410,
-  0x63cf, 0x6c10, 0x6c10, 0x63cf, 0x6bef, 0x7c50, 0x7c50, 0x8450,
-  0x8450, 0x73ef, 0x6bcf, 0x73ef, 0x6b8d, 0x6bae, 0x73ce, 0x6b4c,
-  0xb532, 0xe676, 0xde15, 0x2925, 0x2905, 0x2945, 0x2945, 0x3145,
-  0x3146, 0x3166, 0x3166, 0x3166, 0x3187, 0x39a7, 0x31a7, 0x31a7,
-  0x31c7, 0x31a7, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x4229,
-  0x4249, 0x4a8a, 0x4aab, 0x4aab, 0x52ec, 0x4aab, 0x4acb, 0x52ec,
-  0x52eb, 0x4acb, 0x530c, 0x530c, 0x52ec, 0x52ec, 0x530c, 0x530c,
-  0x530c, 0x5b2d, 0x5b2d, 0x5b2c, 0x532c, 0x532d, 0x5b2d, 0x5b4d,
-  0x638e, 0x638e, 0x638e, 0x638e, 0x634d, 0x6baf, 0x6b8e, 0x636e,
-  0x5b4d, 0x638e, 0x636d, 0x5b4d, 0x638e, 0x638e, 0x638e, 0x6bcf,
-  0x6bae, 0x7410, 0x73ef, 0x6bcf, 0x5b2d, 0x52eb, 0x52ec, 0x4aab,
-  0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4aab, 0x52ab, 0x52eb,
-  0x634d, 0x636d, 0x6bef, 0x7c51, 0x8471, 0x73ef, 0x73f0, 0x638e,
-  0x638e, 0x5b6e, 0x5b4d, 0x532d, 0x7431, 0x6bcf, 0x5b4d, 0x6baf,
-  0x7c71, 0x9d76, 0x7c72, 0x5b6e, 0x5b6e, 0x5b6e, 0x5b4e, 0x5b6e,
-  0x530d, 0x4aec, 0x4acc, 0x4aab, 0x428b, 0x4aab, 0x428b, 0x4aab,
-  0x4acb, 0x4aeb, 0x4aec, 0x52ec, 0x530c, 0x5b4d, 0x638e, 0x532c,
-  0x638e, 0x636e, 0x6bcf, 0x638e, 0x530c, 0x530c, 0x636d, 0x530c,
-  0x532c, 0x5b4d, 0x5b6d, 0x530c, 0x5b4d, 0x5b6d, 0x5b4d, 0x63ae,
-  0x5b6e, 0x638e, 0x638e, 0x63ae, 0x63ae, 0x63ce, 0x6bef, 0x7451,
-  0x7c71, 0x7c91, 0x84d2, 0x7c91, 0x84d2, 0x8d13, 0x9574, 0x9574,
-  0x9574, 0x9d95, 0x9554, 0x9554, 0x9554, 0x8d34, 0x8d34, 0x8513,
-  0x8513, 0x8533, 0x8513, 0x8514, 0x8534, 0x8d54, 0x8534, 0x8d54,
-  0x8d55, 0x8d75, 0x8d75, 0x9595, 0x9595, 0x95b5, 0x95b5, 0x9dd6,
-  0x9df6, 0xa637, 0xae77, 0xb698, 0xbed9, 0xbef9, 0xc73a, 0xcf5b,
-  0xcf7b, 0xd79c, 0xe7dd, 0xf7bd, 0xf79c, 0xf79c, 0xf7bc, 0xdf9b,
-  0xc75b, 0xcf7b, 0xd75b, 0xdf3a, 0xf79b, 0xfffc, 0xf7dc, 0xd6f9,
-  0xb616, 0xceb8, 0xef3a, 0xe719, 0xef39, 0xef39, 0xe718, 0xf75a,
-  0xf77a, 0xffbb, 0xef39, 0xd677, 0xc616, 0xce57, 0xde98, 0xd657,
-  0xe6f9, 0xc636, 0x7430, 0x63cf, 0x63af, 0x7430, 0x8cf2, 0x7410,
-  0x63af, 0x6c10, 0x63ae, 0x5bae, 0x6bef, 0x7c50, 0x7c71, 0x8450,
-  0x7c2f, 0x6bae, 0x7c50, 0x73ef, 0x636d, 0x73ce, 0x6b8d, 0x73ad,
-  0xb552, 0xde55, 0xd615, 0x2925, 0x2905, 0x2925, 0x2945, 0x3145,
-  0x3146, 0x3166, 0x3166, 0x3166, 0x3187, 0x39a7, 0x39a7, 0x31a7,
-  0x39c8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x3a09, 0x3a09, 0x4249,
-  0x426a, 0x52ab, 0x52cb, 0x52eb, 0x52ab, 0x52ec, 0x52ec, 0x530c,
-  0x530c, 0x532c, 0x530c, 0x5b2d, 0x5b2c, 0x5b2d, 0x532c, 0x5b4d,
-  0x5b2d, 0x5b4d, 0x530c, 0x5b4d, 0x5b4d, 0x5b4d, 0x63ae, 0x5b4d,
-  0x638e, 0x638e, 0x63ae, 0x638e, 0x636e, 0x636e, 0x6bae, 0x6baf,
-  0x73f0, 0x7410, 0x6baf, 0x6bcf, 0x6bcf, 0x7430, 0x7c30, 0x73ef,
-  0x740f, 0x7410, 0x7c30, 0x6bae, 0x636d, 0x5b0c, 0x52ec, 0x52cb,
-  0x4aab, 0x4aab, 0x4aab, 0x52cb, 0x4aab, 0x52eb, 0x632c, 0x5b2c,
-  0x6b8e, 0x73cf, 0x7c51, 0x8492, 0x7c30, 0x636d, 0x73ef, 0x6bae,
-  0x638e, 0x5b4d, 0x5b2d, 0x530c, 0x530c, 0x52ec, 0x4acc, 0x52ec,
-  0x530c, 0x4aec, 0x532d, 0x532d, 0x534d, 0x532d, 0x534d, 0x532d,
-  0x4aec, 0x4acc, 0x4acc, 0x428b, 0x428b, 0x428a, 0x428a, 0x42ab,
-  0x4acb, 0x52ec, 0x532d, 0x63ae, 0x5b6d, 0x5b6d, 0x638e, 0x5b4d,
-  0x5b2d, 0x5b4d, 0x6bcf, 0x5b4d, 0x52ec, 0x530c, 0x530c, 0x5b4d,
-  0x63ae, 0x530c, 0x5b4d, 0x5b6d, 0x5b4d, 0x534d, 0x5b4d, 0x5b6d,
-  0x5b4d, 0x532d, 0x5b4d, 0x5b6d, 0x5b8e, 0x63ae, 0x7430, 0x7c91,
-  0x8cf3, 0x8d13, 0x8d13, 0x8d13, 0x9534, 0x9d75, 0x9db5, 0x9574,
-  0x9574, 0x9574, 0x9554, 0x9574, 0x9554, 0x8d34, 0x8d54, 0x8d34,
-  0x8513, 0x8513, 0x7cf3, 0x7cf3, 0x8514, 0x8534, 0x8534, 0x8534,
-  0x8d55, 0x8d55, 0x8d75, 0x9595, 0x9595, 0x95b5, 0x95b5, 0x9dd6,
-  0x9df6, 0xa637, 0xae77, 0xb698, 0xbed9, 0xbef9, 0xc73a, 0xcf5b,
-  0xcf9b, 0xd79c, 0xe7dd, 0xf7bd, 0xf79c, 0xf7bc, 0xefbc, 0xdf7c,
-  0xc77c, 0xc75b, 0xcf3b, 0xdf3b, 0xf77b, 0xffdc, 0xffdc, 0xd6f9,
-  0xb637, 0xce98, 0xef3a, 0xe719, 0xe739, 0xe719, 0xe6f8, 0xef39,
-  0xf77a, 0xffbb, 0xef39, 0xd657, 0xc616, 0xce57, 0xdeb8, 0xd677,
-  0xded8, 0xc616, 0x7430, 0x63af, 0x6bd0, 0x8491, 0x9534, 0x63af,
-  0x5b8e, 0x63cf, 0x5bae, 0x5b8e, 0x63cf, 0x7430, 0x7c30, 0x8450,
-  0x7c2f, 0x6bef, 0x8450, 0x6bae, 0x6b8e, 0x73ce, 0x6b6d, 0x73cd,
-  0xb532, 0xde35, 0xd5f5, 0x2945, 0x2925, 0x2945, 0x2945, 0x2946,
-  0x3146, 0x3166, 0x3166, 0x3186, 0x3186, 0x31a7, 0x39c8, 0x39c8,
-  0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x3a09, 0x3a09, 0x4229,
-  0x428a, 0x52cb, 0x530c, 0x52ec, 0x4acb, 0x52ec, 0x52ec, 0x52eb,
-  0x530c, 0x530c, 0x530d, 0x5b4d, 0x530c, 0x5b2d, 0x530c, 0x5b2d,
-  0x5b4d, 0x532c, 0x5b4d, 0x5b6d, 0x636e, 0x636e, 0x638e, 0x636e,
-  0x6bcf, 0x638e, 0x5b6d, 0x63ae, 0x6bef, 0x6bef, 0x6bef, 0x6bef,
-  0x7410, 0x7410, 0x73ef, 0x7410, 0x7410, 0x8471, 0x8471, 0x7c30,
-  0x8451, 0x8471, 0x8471, 0x740f, 0x73cf, 0x634d, 0x52ec, 0x52eb,
-  0x52cb, 0x52cb, 0x4aab, 0x52cb, 0x52ec, 0x5b0c, 0x6b6d, 0x636d,
-  0x73cf, 0x8471, 0x8472, 0x7c51, 0x7c31, 0x6bae, 0x73ef, 0x7c50,
-  0x8cb2, 0x6bcf, 0x5b0c, 0x5b2d, 0x5b2d, 0x4acb, 0x52ec, 0x530c,
-  0x4aec, 0x4acb, 0x4acc, 0x4aec, 0x532d, 0x4aec, 0x532d, 0x5b4d,
-  0x4aec, 0x4acc, 0x4aab, 0x426a, 0x428a, 0x428a, 0x42ab, 0x4aab,
-  0x4aab, 0x4acb, 0x530c, 0x532c, 0x5b2d, 0x5b4d, 0x5b6d, 0x530c,
-  0x5b4d, 0x638e, 0x5b6d, 0x6bef, 0x6bcf, 0x5b4d, 0x5b4d, 0x532d,
-  0x5b4d, 0x5b2d, 0x636e, 0x5b4d, 0x530c, 0x638e, 0x532d, 0x532d,
-  0x530c, 0x5b4d, 0x63ae, 0x63cf, 0x5b8d, 0x63cf, 0x6c30, 0x84d2,
-  0x8cf3, 0x8d13, 0x8d13, 0x9554, 0x9d74, 0x9d95, 0x9d74, 0x9d75,
-  0x9574, 0x9574, 0x9575, 0x9554, 0x9554, 0x9554, 0x8d55, 0x8d55,
-  0x8513, 0x84f3, 0x7cf3, 0x8513, 0x8513, 0x8513, 0x8513, 0x8534,
-  0x8d54, 0x8d75, 0x8d75, 0x8d75, 0x9575, 0x9595, 0x95b5, 0x9dd6,
-  0x9df6, 0xa637, 0xae77, 0xb698, 0xbed9, 0xbef9, 0xc73a, 0xcf5b,
-  0xd79c, 0xd79c, 0xefdd, 0xf7bd, 0xf7bc, 0xf7bc, 0xefbc, 0xdf7c,
-  0xc77b, 0xbf5b, 0xc73a, 0xdf1a, 0xef7b, 0xffdc, 0xf7bc, 0xced9,
-  0xae17, 0xd6d9, 0xef5a, 0xef3a, 0xef39, 0xef39, 0xded8, 0xe719,
-  0xf77a, 0xffbb, 0xe719, 0xce36, 0xb5b5, 0xd677, 0xe6b8, 0xde97,
-  0xd676, 0xc636, 0x7431, 0x5bae, 0x84b2, 0x9d34, 0x8491, 0x63ae,
-  0x5bae, 0x5b8e, 0x5b8e, 0x5bae, 0x6bef, 0x7c30, 0x740f, 0x7c0f,
-  0x7c30, 0x7430, 0x73ef, 0x6b8d, 0x636d, 0x6bce, 0x73ae, 0x73ad,
-  0x9cb0, 0xd635, 0xcdd4, 0x2966, 0x2945, 0x2945, 0x2946, 0x2946,
-  0x3146, 0x3146, 0x3166, 0x3186, 0x31a7, 0x31c7, 0x39c8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a09, 0x3a09, 0x3a09, 0x4249,
-  0x428a, 0x52cb, 0x52ec, 0x5b0c, 0x530c, 0x530c, 0x5b2d, 0x5b2d,
-  0x530c, 0x5b2d, 0x5b2d, 0x5b4d, 0x5b2d, 0x5b2d, 0x5b2d, 0x5b6d,
-  0x5b4d, 0x5b6d, 0x5b6d, 0x5b6d, 0x638e, 0x636d, 0x638e, 0x63ae,
-  0x6baf, 0x63ae, 0x638e, 0x6bcf, 0x7410, 0x7430, 0x7410, 0x7410,
-  0x73ef, 0x7410, 0x7c30, 0x7c71, 0x7c30, 0x8450, 0x8451, 0x7c50,
-  0x8471, 0x8471, 0x8450, 0x73cf, 0x6b8e, 0x634d, 0x5b2c, 0x530c,
-  0x52eb, 0x52ab, 0x52cb, 0x5b0c, 0x5b0c, 0x5b0c, 0x73ce, 0x6b6d,
-  0x6bae, 0x7410, 0x7c51, 0x7410, 0x7c52, 0x84b3, 0x8471, 0x8471,
-  0x73cf, 0x6bcf, 0x636d, 0x638e, 0x634d, 0x52cb, 0x52ec, 0x52ec,
-  0x4acc, 0x4acb, 0x530c, 0x532d, 0x4aec, 0x52ec, 0x5b4d, 0x4aec,
-  0x4aab, 0x428a, 0x428a, 0x4aab, 0x4aab, 0x4aab, 0x4acb, 0x42aa,
-  0x4acb, 0x4acb, 0x4aec, 0x530c, 0x532c, 0x5b4d, 0x638e, 0x52ec,
-  0x530c, 0x5b2c, 0x6bcf, 0x636e, 0x636d, 0x52ec, 0x5b2d, 0x636e,
-  0x5b2d, 0x5b2d, 0x52ec, 0x5b4d, 0x530c, 0x5b6d, 0x532c, 0x4aec,
-  0x5b4d, 0x532c, 0x5b4d, 0x5b4d, 0x5b8d, 0x6c10, 0x7430, 0x7cb1,
-  0x84b2, 0x9554, 0x9533, 0x9554, 0x9d74, 0x9db5, 0x9d95, 0x9d95,
-  0x9d95, 0x9db5, 0x9575, 0x9554, 0x9574, 0x8d54, 0x8534, 0x8533,
-  0x84f3, 0x7cf3, 0x8513, 0x8513, 0x7cf3, 0x7cf3, 0x8513, 0x8514,
-  0x8534, 0x8d54, 0x8d54, 0x8d74, 0x8d75, 0x8d95, 0x9595, 0x95d6,
-  0x9df6, 0xa637, 0xae77, 0xb698, 0xbed9, 0xbf19, 0xc73a, 0xcf7b,
-  0xd79c, 0xd79c, 0xefdd, 0xf7bd, 0xf7bc, 0xf7bc, 0xef9c, 0xdf7c,
-  0xc75b, 0xb73a, 0xbf1a, 0xd6fa, 0xef7b, 0xffdc, 0xf7bc, 0xceb9,
-  0xae17, 0xdef9, 0xef5a, 0xe719, 0xe719, 0xef3a, 0xd677, 0xe719,
-  0xf77a, 0xffbb, 0xef19, 0xce36, 0xb5b5, 0xd656, 0xe6b8, 0xd697,
-  0xc636, 0xce57, 0x7430, 0x5bcf, 0xb5f6, 0xa595, 0x6c0f, 0x6bef,
-  0x63af, 0x5b8e, 0x5b8e, 0x63cf, 0x6bef, 0x7c30, 0x7410, 0x73ef,
-  0x7c30, 0x73ef, 0x6bce, 0x6b8d, 0x6b8d, 0x6bad, 0x73ce, 0x6b4d,
-  0x840e, 0xcdd5, 0xcdb4, 0x2966, 0x2945, 0x2945, 0x2946, 0x2966,
-  0x3146, 0x3166, 0x3166, 0x3186, 0x31a7, 0x31c7, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x4229, 0x3a29, 0x4249,
-  0x4a8a, 0x52ec, 0x52ec, 0x5b2d, 0x5b4d, 0x532c, 0x5b4d, 0x5b4d,
-  0x5b4d, 0x5b2d, 0x5b4d, 0x5b4d, 0x636d, 0x5b4d, 0x5b4d, 0x5b6d,
-  0x5b4d, 0x636e, 0x636e, 0x638e, 0x6baf, 0x638e, 0x636e, 0x63ae,
-  0x638e, 0x63ae, 0x6bcf, 0x6bef, 0x7410, 0x7430, 0x7451, 0x7c71,
-  0x8471, 0x8471, 0x7c51, 0x8cb2, 0x7c50, 0x8471, 0x8c91, 0x8c91,
-  0x8471, 0x8471, 0x7c30, 0x7c0f, 0x7c0f, 0x6b8e, 0x634d, 0x5b0c,
-  0x52ec, 0x52cb, 0x52ec, 0x5b2c, 0x5b0c, 0x634d, 0x8430, 0x840f,
-  0x634d, 0x6baf, 0x7410, 0x7410, 0x8492, 0x9514, 0x8cd3, 0x8cd2,
-  0x94d2, 0x6bcf, 0x6bae, 0x6b8e, 0x5b4d, 0x4acb, 0x52ec, 0x4acb,
-  0x428a, 0x426a, 0x428b, 0x4aec, 0x4aec, 0x4acc, 0x532d, 0x532d,
-  0x4aec, 0x4aec, 0x4acb, 0x42ab, 0x426a, 0x4aab, 0x4aab, 0x4aab,
-  0x4acb, 0x4aab, 0x530c, 0x530c, 0x532c, 0x636e, 0x636e, 0x5b4d,
-  0x638e, 0x638e, 0x63ae, 0x636d, 0x5b2d, 0x530c, 0x52ec, 0x532c,
-  0x5b4d, 0x530c, 0x638e, 0x532c, 0x5b4d, 0x5b2d, 0x5b4d, 0x530c,
-  0x532c, 0x532c, 0x532c, 0x5b6d, 0x63ae, 0x7450, 0x84b2, 0x8cf2,
-  0x9533, 0x9574, 0x9d74, 0x9574, 0x9554, 0xa5b5, 0x9d95, 0x9d95,
-  0x9d95, 0x9575, 0x9574, 0x9574, 0x8d54, 0x8d33, 0x8513, 0x7cf3,
-  0x84f3, 0x8513, 0x8513, 0x7cd3, 0x7cd3, 0x7cf3, 0x7cf3, 0x8513,
-  0x8513, 0x8514, 0x8d54, 0x8d54, 0x8d75, 0x9595, 0x95b5, 0x95d6,
-  0x9df6, 0xa637, 0xae57, 0xb698, 0xbed9, 0xbf19, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefbd, 0xf7bd, 0xf7bc, 0xf7bc, 0xe79c, 0xdf5b,
-  0xc75b, 0xb73a, 0xbf1a, 0xcefa, 0xef7b, 0xffdc, 0xf79b, 0xc6b9,
-  0xb637, 0xdef9, 0xef5a, 0xdef9, 0xe719, 0xef3a, 0xce57, 0xdef8,
-  0xf77a, 0xffbb, 0xe719, 0xce57, 0xc616, 0xce56, 0xe6b8, 0xce56,
-  0xc616, 0xce57, 0x6bef, 0x6c10, 0xceb9, 0x9554, 0x63cf, 0x5b6e,
-  0x63af, 0x63af, 0x63cf, 0x63ef, 0x6bef, 0x7430, 0x6bef, 0x6bef,
-  0x740f, 0x73ef, 0x6bce, 0x6bae, 0x6bae, 0x6b8d, 0x6bad, 0x738d,
-  0x7b8d, 0xbd74, 0xc5b4, 0x426b, 0x5b4e, 0x31e8, 0x2946, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3187, 0x31c7, 0x3a09, 0x4a6a, 0x4209,
-  0x3a08, 0x3a08, 0x3a08, 0x4aab, 0x4aab, 0x3a29, 0x4249, 0x426a,
-  0x4aab, 0x4aab, 0x530c, 0x530c, 0x5b2d, 0x530c, 0x532d, 0x5b2d,
-  0x532d, 0x5b4d, 0x532d, 0x5b4d, 0x636e, 0x5b6e, 0x638e, 0x638e,
-  0x638e, 0x638e, 0x63ae, 0x6baf, 0x638e, 0x6bae, 0x63ae, 0x63ae,
-  0x63ae, 0x6bcf, 0x6bcf, 0x6bef, 0x6bcf, 0x7410, 0x7410, 0x7410,
-  0x8492, 0x8492, 0x8471, 0x8491, 0x8491, 0x8cb1, 0x8c91, 0x8470,
-  0x8471, 0x8471, 0x94d2, 0x8430, 0x7c30, 0x73cf, 0x6b6d, 0x634d,
-  0x5b0c, 0x5b0c, 0x5aec, 0x5b0c, 0x5aec, 0x636d, 0x94b2, 0x9491,
-  0x6b6d, 0x634d, 0x6bcf, 0x7431, 0x8492, 0x9534, 0xbdf7, 0xd6da,
-  0xceba, 0x7c30, 0x6bae, 0x636e, 0x52ec, 0x4aab, 0x530c, 0x428a,
-  0x426a, 0x3a29, 0x426a, 0x42ab, 0x4acc, 0x4aec, 0x534d, 0x534d,
-  0x532d, 0x532c, 0x4acb, 0x42aa, 0x4acb, 0x4aab, 0x4aab, 0x42aa,
-  0x4aab, 0x4aeb, 0x4aeb, 0x4aec, 0x5b4d, 0x5b4d, 0x5b2d, 0x5b2d,
-  0x5b4d, 0x5b4d, 0x5b4d, 0x63ae, 0x5b4d, 0x5b4d, 0x5b4d, 0x5b6d,
-  0x638e, 0x5b6d, 0x5b6d, 0x532d, 0x4aec, 0x530c, 0x532c, 0x532c,
-  0x5b6d, 0x5b6d, 0x5b6d, 0x5b8e, 0x7430, 0x8cf2, 0x8d13, 0x9533,
-  0x9d74, 0x9d74, 0x9d74, 0x9d95, 0x9d74, 0xa5b5, 0xa5b5, 0x9db5,
-  0x9db5, 0x9574, 0x9d95, 0x8d54, 0x8d34, 0x8513, 0x8513, 0x7cf3,
-  0x7cf3, 0x7cf3, 0x7cd3, 0x7cd3, 0x7cd3, 0x7cd3, 0x7cf3, 0x7cd3,
-  0x7d13, 0x8514, 0x8534, 0x8554, 0x8d75, 0x8d75, 0x95b5, 0x95d6,
-  0x9df6, 0xa636, 0xae77, 0xb698, 0xbed9, 0xbef9, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefde, 0xf7bd, 0xf7bc, 0xf7bc, 0xe79c, 0xdf5b,
-  0xc75b, 0xb73b, 0xb71a, 0xcefa, 0xef7b, 0xffbc, 0xf79b, 0xbe78,
-  0xb658, 0xdef9, 0xef5a, 0xdef9, 0xdef9, 0xe73a, 0xc636, 0xd697,
-  0xef3a, 0xffbb, 0xe6f9, 0xce36, 0xce77, 0xce36, 0xdeb7, 0xce36,
-  0xbdf6, 0xce77, 0x63ef, 0x7451, 0xc678, 0x84b2, 0x5bae, 0x536e,
-  0x5b8e, 0x63cf, 0x6c10, 0x63ae, 0x6bef, 0x7430, 0x6bef, 0x6bcf,
-  0x7410, 0x740f, 0x6bae, 0x6bae, 0x6bae, 0x6bae, 0x6b8d, 0x73ad,
-  0x7bae, 0xb532, 0xc594, 0x3a6b, 0x63af, 0xb659, 0x52ec, 0x2965,
-  0x3166, 0x2966, 0x3186, 0x31a7, 0x4229, 0x426a, 0x4229, 0x4249,
-  0x3a29, 0x3a08, 0x428a, 0x5b2d, 0x530c, 0x3a49, 0x426a, 0x4a8a,
-  0x4aab, 0x4acb, 0x4acb, 0x532c, 0x5b2d, 0x5b4d, 0x532d, 0x5b6e,
-  0x532d, 0x5b4d, 0x5b4d, 0x5b6d, 0x5b4d, 0x638e, 0x638e, 0x636e,
-  0x638e, 0x63ae, 0x63ae, 0x6bcf, 0x6bef, 0x6bcf, 0x6bcf, 0x6bef,
-  0x6bcf, 0x6bcf, 0x63ae, 0x63ae, 0x6bcf, 0x6bcf, 0x7410, 0x7c51,
-  0x8491, 0x8492, 0x8cb2, 0x8cb2, 0x94f3, 0x94d2, 0x8c91, 0x8471,
-  0x8450, 0x8c91, 0x9d12, 0x8430, 0x6b8d, 0x73ce, 0x73ce, 0x73ce,
-  0x634d, 0x5b0c, 0x5aeb, 0x52eb, 0x5b0c, 0x6bae, 0x94d2, 0x73ce,
-  0x6bae, 0x73ef, 0x7410, 0x7c51, 0x8cf3, 0xa5b6, 0xc699, 0xdf1a,
-  0x9d33, 0x7c10, 0x6bae, 0x6b8e, 0x52ec, 0x4aab, 0x4acb, 0x428a,
-  0x426a, 0x3a29, 0x3a49, 0x428b, 0x530d, 0x5b8e, 0x63af, 0x63af,
-  0x532d, 0x532d, 0x4acb, 0x4aec, 0x4acb, 0x42aa, 0x4acb, 0x4acb,
-  0x4acb, 0x4acb, 0x4aec, 0x4acb, 0x530c, 0x5b4d, 0x5b4d, 0x532c,
-  0x636e, 0x5b4d, 0x636d, 0x5b2d, 0x5b4d, 0x6bef, 0x63ae, 0x63ae,
-  0x636e, 0x5b4d, 0x6baf, 0x6bcf, 0x5b2d, 0x532d, 0x532d, 0x638e,
-  0x5b6d, 0x63ae, 0x638d, 0x7430, 0x84d2, 0x9533, 0x9554, 0x9d74,
-  0x9d95, 0x9574, 0x9553, 0x9574, 0x9d95, 0x9d74, 0x9554, 0x9574,
-  0x9574, 0x9554, 0x9554, 0x8d54, 0x8d34, 0x8513, 0x8513, 0x8513,
-  0x7cf3, 0x7cf3, 0x7cf3, 0x74d3, 0x74b2, 0x74d2, 0x74d2, 0x7cf3,
-  0x7cf3, 0x7cf3, 0x8514, 0x8554, 0x8d75, 0x8d75, 0x95b5, 0x95d6,
-  0x9df6, 0xa636, 0xae77, 0xb698, 0xbed9, 0xbef9, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefde, 0xf7bd, 0xf7bc, 0xf7bc, 0xe77b, 0xdf7b,
-  0xc75b, 0xaf1a, 0xb71a, 0xcefa, 0xef7b, 0xffbb, 0xef9b, 0xbe77,
-  0xae37, 0xd6f9, 0xef5a, 0xdef9, 0xdef9, 0xef3a, 0xc636, 0xce77,
-  0xe719, 0xffbb, 0xe6f9, 0xce36, 0xce57, 0xc5f6, 0xd677, 0xc5f6,
-  0xbe16, 0xd6b8, 0x6c0f, 0x8492, 0xc678, 0x6c30, 0x5b8e, 0x536e,
-  0x536e, 0x63cf, 0x7451, 0x63ae, 0x6bef, 0x7430, 0x740f, 0x6bef,
-  0x740f, 0x73ef, 0x6bae, 0x6bce, 0x6bce, 0x73ef, 0x6b8d, 0x73ad,
-  0x634c, 0xa4f1, 0xbd74, 0x31e8, 0x31c7, 0x4acb, 0x428a, 0x2986,
-  0x2966, 0x3166, 0x3186, 0x39c7, 0x3a09, 0x52cb, 0x52ec, 0x4249,
-  0x3a29, 0x4229, 0x3a09, 0x4249, 0x4a8a, 0x4249, 0x4249, 0x4aab,
-  0x42aa, 0x52ec, 0x4acb, 0x4aeb, 0x636e, 0x5b6d, 0x5b4d, 0x532c,
-  0x5b4d, 0x638e, 0x5b6e, 0x5b6e, 0x638e, 0x5b4d, 0x636e, 0x638e,
-  0x63ae, 0x63cf, 0x6bcf, 0x6bcf, 0x6bf0, 0x6bcf, 0x6bcf, 0x6bef,
-  0x6bef, 0x6bef, 0x63ae, 0x7410, 0x6bcf, 0x638e, 0x6baf, 0x7c71,
-  0x8492, 0x8cd2, 0x94d2, 0x94f3, 0x94f3, 0x94d2, 0x94f2, 0x8c91,
-  0x8470, 0x8c71, 0x94d2, 0x8430, 0x73ae, 0x7bef, 0x8c70, 0x842f,
-  0x6b6d, 0x630c, 0x52cb, 0x5aec, 0x636d, 0x7c10, 0x7c0f, 0x5b0c,
-  0x6bce, 0x7c31, 0x8472, 0x7c71, 0x8cd3, 0x9d55, 0x8cd2, 0x8471,
-  0x73ee, 0x740f, 0x7410, 0x634d, 0x52ec, 0x4aab, 0x4aab, 0x428a,
-  0x426a, 0x3a29, 0x3a29, 0x426a, 0x5b4e, 0x7c52, 0x5b4e, 0x6bcf,
-  0x63cf, 0x532d, 0x4aeb, 0x4aec, 0x4acb, 0x4aab, 0x4aab, 0x4aeb,
-  0x4acb, 0x4aab, 0x5b4d, 0x636e, 0x532d, 0x532d, 0x532d, 0x5b4d,
-  0x5b2c, 0x636d, 0x6bae, 0x5b2c, 0x532c, 0x5b6d, 0x6bcf, 0x638e,
-  0x636e, 0x638e, 0x5b4d, 0x530c, 0x530c, 0x5b4d, 0x532c, 0x532d,
-  0x532c, 0x5b6d, 0x7430, 0x7450, 0x8cf2, 0x8d12, 0x9533, 0x9554,
-  0x9d95, 0x9554, 0x9533, 0x9d95, 0x9d95, 0x9554, 0x9575, 0x9575,
-  0x9574, 0x9574, 0x9554, 0x8d33, 0x8513, 0x8513, 0x7cf3, 0x7cf3,
-  0x7cf3, 0x7cd3, 0x7d13, 0x74d3, 0x74d2, 0x74d2, 0x74d3, 0x7cd3,
-  0x74d3, 0x7cf3, 0x8534, 0x8d75, 0x8d75, 0x8d75, 0x95b5, 0x95d6,
-  0x9dd6, 0xa616, 0xae57, 0xb698, 0xb6d9, 0xbef9, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefde, 0xf7bd, 0xf7bc, 0xefbc, 0xdf7b, 0xdf7b,
-  0xc75b, 0xaf3a, 0xbefa, 0xcefa, 0xef9b, 0xffbc, 0xef7b, 0xb657,
-  0xae37, 0xd6d8, 0xef5a, 0xded9, 0xdef9, 0xe73a, 0xb5f5, 0xce77,
-  0xdef9, 0xff9b, 0xe6f9, 0xce57, 0xbdf6, 0xad74, 0xce57, 0xc5f6,
-  0xad54, 0xd6b8, 0x6c30, 0x8492, 0xc657, 0x63ef, 0x538e, 0x536e,
-  0x536e, 0x5baf, 0x6bf0, 0x63cf, 0x6bef, 0x7c50, 0x7430, 0x740f,
-  0x73ef, 0x6bce, 0x73ef, 0x73ee, 0x6bce, 0x73ee, 0x6bad, 0x73ce,
-  0x634c, 0x9470, 0xbd73, 0x29a7, 0x2987, 0x2986, 0x2987, 0x3187,
-  0x3166, 0x3166, 0x3186, 0x39c7, 0x3a08, 0x4229, 0x426a, 0x3a09,
-  0x3a29, 0x426a, 0x3a09, 0x3a09, 0x4229, 0x4249, 0x4249, 0x4aaa,
-  0x52cb, 0x52ec, 0x532d, 0x5b4d, 0x5b2d, 0x532c, 0x5b6d, 0x636e,
-  0x5b6d, 0x5b4d, 0x5b6e, 0x638e, 0x5b6e, 0x638e, 0x63af, 0x63af,
-  0x6bcf, 0x6bcf, 0x6bef, 0x6bef, 0x7410, 0x7410, 0x6bef, 0x7410,
-  0x7410, 0x6bef, 0x6bef, 0x73f0, 0x638e, 0x6bae, 0x6b8e, 0x73f0,
-  0x7c51, 0x8c92, 0x8cb2, 0x94d2, 0x94d2, 0x9d13, 0x94d2, 0x8c91,
-  0x8450, 0x94b2, 0x94b1, 0x8450, 0x8430, 0x9491, 0x9cd1, 0x840f,
-  0x6b8d, 0x632d, 0x632c, 0x634d, 0x73af, 0x7c30, 0x6b8e, 0x6b8e,
-  0x7410, 0x7410, 0x84b2, 0x9534, 0x8cb2, 0x94f3, 0x94f3, 0x8c91,
-  0x8471, 0x7c10, 0x636d, 0x52ec, 0x5b0c, 0x52cb, 0x4a8a, 0x4a8a,
-  0x426a, 0x4249, 0x3a49, 0x3a6a, 0x4aec, 0x5b4e, 0x5b4e, 0x5b6e,
-  0x7c71, 0x63af, 0x530c, 0x5b4d, 0x530c, 0x4acb, 0x4aeb, 0x4acb,
-  0x4acb, 0x5b2d, 0x5b4d, 0x4aec, 0x530c, 0x638e, 0x638e, 0x636d,
-  0x638e, 0x6bcf, 0x5b4d, 0x5b4d, 0x5b4d, 0x638e, 0x638e, 0x6bcf,
-  0x5b6d, 0x63ae, 0x638e, 0x636e, 0x638e, 0x5b4d, 0x5b6d, 0x5b8e,
-  0x5b4d, 0x63ae, 0x84b2, 0x7c70, 0x84d2, 0x9553, 0x9533, 0x9554,
-  0x9533, 0x9554, 0x9d75, 0x9d75, 0x9574, 0x9554, 0x9554, 0x9554,
-  0x9554, 0x9554, 0x9554, 0x8533, 0x8513, 0x7cf3, 0x7cd2, 0x7cf3,
-  0x7cd3, 0x74d3, 0x74b2, 0x74b2, 0x74d2, 0x74b2, 0x74d3, 0x74d2,
-  0x7cf3, 0x7d13, 0x8534, 0x8534, 0x8554, 0x8d75, 0x95b5, 0x9dd6,
-  0x9df6, 0xa616, 0xae57, 0xb698, 0xb6d9, 0xbef9, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7dd, 0xf7bc, 0xefbc, 0xdf7b, 0xdf7b,
-  0xc75b, 0xaf1a, 0xbf1a, 0xcf1a, 0xef9b, 0xffbc, 0xe75b, 0xae37,
-  0xae37, 0xceb8, 0xef5a, 0xded9, 0xdef9, 0xe719, 0xb5d5, 0xc677,
-  0xded9, 0xff9b, 0xe6f9, 0xce77, 0xb5f6, 0x94f2, 0xce57, 0xc617,
-  0x9cf3, 0xd698, 0x7451, 0x9533, 0xc677, 0x5bf0, 0x5b8f, 0x536e,
-  0x5b8e, 0x5b8e, 0x63af, 0x6bef, 0x6c0f, 0x7430, 0x6bef, 0x6bcf,
-  0x6bef, 0x6bce, 0x740f, 0x73ee, 0x73ce, 0x6bad, 0x6b8d, 0x73ae,
-  0x6b4d, 0x8c0f, 0xb553, 0x2986, 0x2966, 0x3166, 0x3166, 0x3187,
-  0x3166, 0x3166, 0x3186, 0x31a7, 0x39e8, 0x4249, 0x52ab, 0x4249,
-  0x3a29, 0x4a6a, 0x4aab, 0x4aaa, 0x426a, 0x4aab, 0x5b2c, 0x428a,
-  0x52ec, 0x52eb, 0x4acb, 0x530c, 0x5b4d, 0x5b6d, 0x5b4d, 0x5b6d,
-  0x5b6d, 0x5b6d, 0x5b6e, 0x638e, 0x63af, 0x6baf, 0x6baf, 0x63ae,
-  0x6bcf, 0x7410, 0x6c10, 0x7410, 0x6bf0, 0x7430, 0x7410, 0x7410,
-  0x7430, 0x7430, 0x6bef, 0x6bcf, 0x6bcf, 0x73ef, 0x6baf, 0x73ef,
-  0x7c30, 0x8451, 0x8c92, 0x94d2, 0x94d2, 0x94d2, 0x94b2, 0x8c91,
-  0x8cb1, 0x8c91, 0x8450, 0x8450, 0x8c91, 0x9491, 0x842f, 0x738d,
-  0x73ae, 0x73ae, 0x7bef, 0x840f, 0x8430, 0x7bef, 0x6b8e, 0x73ef,
-  0x6bef, 0x7430, 0x9513, 0x9514, 0x8492, 0x8492, 0x8471, 0x8471,
-  0x7c0f, 0x6b8e, 0x634d, 0x52ec, 0x52cb, 0x52cb, 0x4aaa, 0x4aab,
-  0x52ec, 0x4a8a, 0x426a, 0x3a29, 0x3a49, 0x4acc, 0x5b2d, 0x7410,
-  0x6bf0, 0x5b4d, 0x5b4d, 0x5b2d, 0x52ec, 0x4acb, 0x4aeb, 0x530c,
-  0x530c, 0x530c, 0x532d, 0x530c, 0x532d, 0x5b4d, 0x638e, 0x5b4d,
-  0x6bcf, 0x740f, 0x5b4d, 0x530c, 0x63ae, 0x6bae, 0x636e, 0x5b4d,
-  0x5b4d, 0x5b4d, 0x6bcf, 0x63ae, 0x5b6d, 0x5b6d, 0x5b4d, 0x5b6d,
-  0x63ae, 0x7410, 0x7c70, 0x84b1, 0x84b1, 0x8d12, 0x9553, 0x9554,
-  0x9533, 0x9554, 0x9554, 0x9554, 0x8d33, 0x8d34, 0x9554, 0x8d54,
-  0x9554, 0x8d34, 0x8513, 0x8513, 0x8513, 0x7cd3, 0x7cf3, 0x7cd2,
-  0x74b2, 0x74b2, 0x7492, 0x74b2, 0x74d2, 0x74b2, 0x74d3, 0x74d3,
-  0x7cf3, 0x7d13, 0x8534, 0x8513, 0x8d54, 0x8d95, 0x95b5, 0x95b6,
-  0x9df6, 0xa636, 0xa657, 0xae98, 0xb6d9, 0xbef9, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7dd, 0xf7bc, 0xefbc, 0xe79b, 0xd77b,
-  0xc75b, 0xa71a, 0xbf1a, 0xd71a, 0xef9b, 0xf7bc, 0xdf3a, 0xa617,
-  0xae58, 0xd6d9, 0xef5a, 0xd6d9, 0xdf19, 0xe719, 0xb5d5, 0xce98,
-  0xd6b8, 0xf77b, 0xe6f9, 0xd677, 0xb5f6, 0x84b2, 0xc637, 0xce37,
-  0xa533, 0xce78, 0x7c71, 0xa595, 0xc678, 0x5bef, 0x538f, 0x5baf,
-  0x5baf, 0x5baf, 0x63cf, 0x6bef, 0x6c10, 0x7430, 0x7430, 0x6bef,
-  0x6bae, 0x6bce, 0x740f, 0x73ee, 0x6bce, 0x73ce, 0x6b8d, 0x6b8d,
-  0x634c, 0x8c50, 0xad33, 0x2987, 0x2966, 0x2966, 0x3166, 0x3167,
-  0x3166, 0x3187, 0x3187, 0x39a7, 0x39c7, 0x4229, 0x3a29, 0x426a,
-  0x4229, 0x3a29, 0x4a8a, 0x4aab, 0x4acb, 0x4aab, 0x8c92, 0xadd7,
-  0x532c, 0x4aab, 0x52ec, 0x532d, 0x5b6e, 0x63af, 0x5b6e, 0x638e,
-  0x638e, 0x638e, 0x63af, 0x5b8e, 0x63af, 0x63af, 0x63af, 0x63af,
-  0x7430, 0x6bf0, 0x7451, 0x6c10, 0x7410, 0x7410, 0x7410, 0x6c10,
-  0x7410, 0x7410, 0x73f0, 0x7c51, 0x6bcf, 0x7410, 0x73cf, 0x6bcf,
-  0x7c10, 0x8cd2, 0x9d13, 0x94d2, 0x94f2, 0x94d2, 0x8cb1, 0x94b2,
-  0x94d2, 0x8c91, 0x8450, 0x8c50, 0x8c50, 0x840f, 0x7bce, 0x73ae,
-  0x7c0f, 0x8c50, 0x94d2, 0x94b1, 0x8c50, 0x6b6d, 0x5b0c, 0x636d,
-  0x73ef, 0x7c30, 0x7430, 0x638e, 0x7c30, 0x73ef, 0x7c30, 0x6bce,
-  0x6bce, 0x636d, 0x5b0c, 0x5b0c, 0x5b0c, 0x52cb, 0x52ab, 0x5b0c,
-  0x4acb, 0x4aab, 0x4a8a, 0x3a29, 0x3a29, 0x424a, 0x4acc, 0x5b2d,
-  0x530c, 0x530c, 0x530c, 0x530c, 0x52ec, 0x5b4d, 0x638e, 0x6baf,
-  0x5b2d, 0x4acb, 0x4aab, 0x4aeb, 0x5b4d, 0x5b4d, 0x638d, 0x6bcf,
-  0x6bcf, 0x7410, 0x7c30, 0x6bef, 0x73ef, 0x6bcf, 0x638e, 0x5b2d,
-  0x5b4d, 0x5b4d, 0x638e, 0x5b6d, 0x5b4d, 0x532c, 0x534d, 0x5b4d,
-  0x6c10, 0x6bef, 0x7470, 0x84d2, 0x84f2, 0x8cf2, 0x8d13, 0x8d13,
-  0x9534, 0x9554, 0x8d13, 0x9554, 0x8d13, 0x8d34, 0x8d54, 0x8d13,
-  0x8d54, 0x8d34, 0x7cf3, 0x7cf3, 0x7cd2, 0x7cd2, 0x74d2, 0x74d2,
-  0x74b2, 0x6c92, 0x74b2, 0x74d3, 0x74b2, 0x74d2, 0x74d3, 0x7cf3,
-  0x7cf3, 0x7cf3, 0x7d14, 0x8534, 0x8554, 0x8d75, 0x95b5, 0x95d6,
-  0x9df6, 0x9e16, 0xa657, 0xae98, 0xb6b9, 0xbef9, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7bd, 0xf7bc, 0xefbc, 0xe79c, 0xd77b,
-  0xc75b, 0xaf3a, 0xbf1a, 0xd73a, 0xef7b, 0xf7bc, 0xd71a, 0xa616,
-  0xae58, 0xd6f9, 0xef5a, 0xceb8, 0xdf19, 0xdef9, 0xb5f6, 0xc677,
-  0xc677, 0xef3a, 0xe71a, 0xc656, 0xbe16, 0x8492, 0xc637, 0xce57,
-  0xa554, 0xce77, 0x7c92, 0xb616, 0xbe57, 0x53af, 0x5baf, 0x63f0,
-  0x63cf, 0x63cf, 0x63cf, 0x7450, 0x7430, 0x740f, 0x7410, 0x7410,
-  0x740f, 0x6bef, 0x740f, 0x73ef, 0x6bce, 0x73ee, 0x6b8d, 0x6b6d,
-  0x6b8d, 0x8c50, 0xad12, 0x2987, 0x3187, 0x2966, 0x2966, 0x2966,
-  0x3166, 0x3187, 0x3187, 0x31a7, 0x39c7, 0x39e8, 0x4249, 0x4a8a,
-  0x4229, 0x4249, 0x4aab, 0x5b0c, 0x5b2c, 0x5b0c, 0x6bae, 0xb638,
-  0x5b0c, 0x426a, 0x4aec, 0x5b4d, 0x5b6e, 0x63af, 0x5b4d, 0x63af,
-  0x63ae, 0x63af, 0x6bcf, 0x6bf0, 0x6bcf, 0x6bcf, 0x6bf0, 0x63cf,
-  0x6bf0, 0x6bcf, 0x6c10, 0x7410, 0x7451, 0x7430, 0x7430, 0x7430,
-  0x7410, 0x7430, 0x6bcf, 0x73ef, 0x73ef, 0x73ef, 0x8451, 0x8c92,
-  0x8471, 0x94d2, 0x8c91, 0x8c71, 0xa534, 0x94f2, 0x94b2, 0x8c91,
-  0x9491, 0x8c71, 0x8450, 0x8450, 0x840f, 0x7c0f, 0x7bef, 0x8410,
-  0x8c91, 0xa533, 0xa534, 0x94b2, 0x73cf, 0x52ec, 0x4aaa, 0x530c,
-  0x6bcf, 0x6baf, 0x530c, 0x5b2d, 0x638e, 0x6bcf, 0x7410, 0x7410,
-  0x6b8e, 0x5b4d, 0x52eb, 0x52ec, 0x52ec, 0x5b0c, 0x5b0c, 0x5b2d,
-  0x5b2c, 0x52cb, 0x426a, 0x4249, 0x4229, 0x4249, 0x426a, 0x428a,
-  0x4acb, 0x52ec, 0x634d, 0x530c, 0x5b2d, 0x5b4d, 0x6bcf, 0x8492,
-  0x5b2d, 0x5b4d, 0x5b2d, 0x530c, 0x530c, 0x5b4d, 0x6bce, 0x6bae,
-  0x7c71, 0x8491, 0x7c71, 0x8491, 0x6bef, 0x6bce, 0x636d, 0x638d,
-  0x5b4d, 0x5b4d, 0x638e, 0x638e, 0x532d, 0x5b6d, 0x5b6d, 0x63ae,
-  0x6bcf, 0x6bef, 0x7c91, 0x84d2, 0x84d2, 0x9553, 0x8d33, 0x84f3,
-  0x8d34, 0x8d34, 0x8513, 0x8d33, 0x8513, 0x8513, 0x8513, 0x8513,
-  0x8534, 0x8513, 0x7cf3, 0x7cd2, 0x74b2, 0x74b2, 0x7492, 0x74b2,
-  0x7cd3, 0x7492, 0x6c92, 0x74b2, 0x74b2, 0x74d2, 0x74d2, 0x74d3,
-  0x7cf3, 0x7cf3, 0x7d13, 0x8534, 0x8554, 0x8555, 0x8d95, 0x95d6,
-  0x9df6, 0x9e36, 0xa657, 0xae78, 0xb6b9, 0xbef9, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7bd, 0xf7bc, 0xefbc, 0xe79c, 0xd77b,
-  0xc75b, 0xaf1a, 0xbf1a, 0xd73a, 0xef7b, 0xf7bc, 0xd73a, 0xa636,
-  0xae37, 0xd6d9, 0xef5a, 0xceb8, 0xdef9, 0xdef8, 0xb5f6, 0xc677,
-  0xc657, 0xded9, 0xe71a, 0xbe36, 0xadb5, 0x7451, 0xbdf6, 0xbe16,
-  0xa575, 0xce77, 0x84d2, 0xbe57, 0xc678, 0x5baf, 0x5baf, 0x63af,
-  0x63cf, 0x5bae, 0x6bef, 0x7c91, 0x7410, 0x7430, 0x6bcf, 0x7410,
-  0x7430, 0x6bef, 0x740f, 0x6bae, 0x73ee, 0x73ce, 0x6b8d, 0x634c,
-  0x6bad, 0x73ae, 0xa4f2, 0x2987, 0x3186, 0x3187, 0x2986, 0x2966,
-  0x3166, 0x3166, 0x3167, 0x31a7, 0x39c7, 0x39e8, 0x4a8a, 0x4aab,
-  0x4249, 0x4249, 0x4aab, 0x4acb, 0x636e, 0x63ae, 0x5b4d, 0x4acb,
-  0x3a49, 0x428a, 0x530d, 0x5b4d, 0x6c10, 0x5b8e, 0x5b8e, 0x63ae,
-  0x63ae, 0x63af, 0x8492, 0x6bcf, 0x63af, 0x63af, 0x6bef, 0x63af,
-  0x63af, 0x63cf, 0x6c10, 0x7430, 0x7430, 0x7410, 0x7c31, 0x7c31,
-  0x7c51, 0x7c51, 0x73ef, 0x7c10, 0x740f, 0x73ef, 0x8c91, 0x9d34,
-  0x9d33, 0x8cb2, 0x8cb2, 0x8c91, 0x94b2, 0x94b1, 0x94b2, 0x9491,
-  0x9491, 0x9491, 0x8c50, 0x842f, 0x840f, 0x840f, 0x7c0f, 0x8c71,
-  0x94b1, 0xa513, 0xa533, 0x8451, 0x5b0d, 0x4aab, 0x4aab, 0x4aab,
-  0x428a, 0x4aab, 0x52ec, 0x5b2d, 0x52ec, 0x6bae, 0x6bcf, 0x638e,
-  0x6bae, 0x5b4d, 0x530c, 0x530c, 0x5b0c, 0x5b2d, 0x5b4d, 0x6bae,
-  0x638e, 0x634d, 0x4aab, 0x424a, 0x4229, 0x4229, 0x424a, 0x428a,
-  0x5b0c, 0x636d, 0x5b2d, 0x5b0c, 0x5b2d, 0x5b4d, 0x638e, 0xadb6,
-  0x8cd3, 0x5b2d, 0x5b6d, 0x5b4d, 0x5b6d, 0x5b4d, 0x638d, 0x740f,
-  0x8471, 0x7c51, 0x7c30, 0x7c50, 0x7410, 0x6bcf, 0x5b6d, 0x5b4d,
-  0x532d, 0x5b4d, 0x532d, 0x638e, 0x5b6d, 0x5b4d, 0x5b8e, 0x6c10,
-  0x63ae, 0x6bef, 0x7c71, 0x84d2, 0x8d13, 0x8d13, 0x8d13, 0x84f2,
-  0x84f3, 0x84f3, 0x84f3, 0x8d14, 0x8513, 0x84f3, 0x84f3, 0x8513,
-  0x7cd3, 0x74b2, 0x74b2, 0x74b2, 0x7492, 0x74b2, 0x74b2, 0x7492,
-  0x7492, 0x6c92, 0x6c92, 0x6c92, 0x74b2, 0x74b2, 0x74b2, 0x74d2,
-  0x74d3, 0x7cf3, 0x7cf3, 0x8534, 0x8554, 0x8d75, 0x8db5, 0x95b6,
-  0x9df6, 0x9e16, 0xae57, 0xae98, 0xb6b9, 0xbef9, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7bd, 0xf7bc, 0xefbc, 0xe79c, 0xd77b,
-  0xc75b, 0xaf3a, 0xbf1a, 0xd73a, 0xef7b, 0xf7bc, 0xd71a, 0xae57,
-  0xae57, 0xd6f9, 0xef5a, 0xceb9, 0xded9, 0xd6b8, 0xb5d5, 0xbe37,
-  0xbe36, 0xc657, 0xdef9, 0xce77, 0x8cf3, 0x6c51, 0xadd5, 0xbe16,
-  0xad95, 0xc657, 0x84b2, 0xce98, 0xc678, 0x5baf, 0x5baf, 0x63cf,
-  0x63ef, 0x5bcf, 0x7c71, 0x84b2, 0x6bef, 0x7c71, 0x6bcf, 0x6bef,
-  0x6bce, 0x63ae, 0x6bce, 0x638d, 0x73ef, 0x6b8d, 0x636d, 0x6bad,
-  0x6bad, 0x5b0c, 0x8c70, 0x3187, 0x2986, 0x3187, 0x31a7, 0x3167,
-  0x3186, 0x3187, 0x3187, 0x3987, 0x39a7, 0x41e8, 0x4229, 0x4aab,
-  0x5b4d, 0x4acb, 0x4aaa, 0x530c, 0x5b2d, 0x638e, 0x52ec, 0x428a,
-  0x426a, 0x428a, 0x530c, 0x5b4d, 0x63af, 0x5b8e, 0x5b8e, 0x5b8e,
-  0x63cf, 0x7451, 0x7410, 0x63af, 0x63ae, 0x638e, 0x5b8e, 0x638e,
-  0x63af, 0x6bcf, 0x7430, 0x7451, 0x7450, 0x7430, 0x7c51, 0x7c51,
-  0x7c51, 0x8471, 0x7410, 0x7410, 0x73ef, 0x7c50, 0x8cb2, 0x94d2,
-  0x9513, 0x94d2, 0x94d2, 0x94b2, 0x8c71, 0x8c71, 0x9491, 0x9491,
-  0x94b1, 0x94b1, 0x8c50, 0x840f, 0x840f, 0x7c0f, 0x7bcf, 0x73ce,
-  0x8430, 0x9d13, 0x94d2, 0x636d, 0x426a, 0x426a, 0x426a, 0x3a29,
-  0x3a29, 0x3a49, 0x428a, 0x4aab, 0x4acc, 0x530c, 0x638e, 0x636d,
-  0x73ef, 0x7430, 0x5b4d, 0x634d, 0x5b4d, 0x52ec, 0x52ec, 0x5b2d,
-  0x7c31, 0x73ef, 0x5b0c, 0x4aaa, 0x4249, 0x4249, 0x4249, 0x426a,
-  0x4aab, 0x52ec, 0x4acb, 0x5b2d, 0x5b2d, 0x5b4d, 0x5b4d, 0x63ae,
-  0x8472, 0x6bae, 0x532c, 0x5b4d, 0x636e, 0x636d, 0x6bef, 0x6bef,
-  0x7c30, 0x7430, 0x7c50, 0x8491, 0x7c51, 0x6bcf, 0x638e, 0x5b4d,
-  0x5b4d, 0x6baf, 0x638e, 0x63cf, 0x63cf, 0x63cf, 0x5b6e, 0x63cf,
-  0x6bef, 0x6c0f, 0x7c91, 0x8cf2, 0x84f3, 0x84f3, 0x84d2, 0x84d2,
-  0x84f3, 0x84f3, 0x84f3, 0x84f3, 0x7cd3, 0x84f3, 0x7cd3, 0x7cb2,
-  0x7cd2, 0x7492, 0x7492, 0x7492, 0x74b2, 0x7492, 0x74b2, 0x6c91,
-  0x6c71, 0x6c91, 0x6c92, 0x6c92, 0x6c92, 0x6cb2, 0x74d2, 0x74d3,
-  0x74f3, 0x7cf3, 0x7d34, 0x7d34, 0x8554, 0x8d95, 0x95b5, 0x95d6,
-  0x95f6, 0x9e16, 0xa657, 0xb698, 0xbeb9, 0xbefa, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7bd, 0xf7bc, 0xefbc, 0xdf9c, 0xd77b,
-  0xc75b, 0xaf3b, 0xb71a, 0xcf3a, 0xef9b, 0xf7bc, 0xcf1a, 0xae78,
-  0xa657, 0xced9, 0xe73a, 0xc698, 0xd6b9, 0xd698, 0xad95, 0xadf6,
-  0xb616, 0xb5d5, 0xd6b8, 0xd6b9, 0x7cb2, 0x6c71, 0xadb4, 0xbe16,
-  0xa554, 0xc636, 0x84b2, 0xdef9, 0xbe57, 0x536e, 0x63ef, 0x7451,
-  0x63cf, 0x63cf, 0x7c71, 0x8491, 0x63cf, 0x6bef, 0x6bcf, 0x6bef,
-  0x63ae, 0x63ce, 0x6bcf, 0x638d, 0x6bee, 0x6bad, 0x636d, 0x73ae,
-  0x6b8d, 0x530b, 0x73ae, 0x31a7, 0x3187, 0x3187, 0x3187, 0x3167,
-  0x3187, 0x39a7, 0x39a7, 0x39a7, 0x39a7, 0x39c8, 0x4208, 0x4aaa,
-  0x532c, 0x636e, 0x638e, 0x530c, 0x5b4d, 0x5b4d, 0x4acb, 0x4a8a,
-  0x4aab, 0x4aec, 0x532d, 0x5b6d, 0x638e, 0x63af, 0x63af, 0x63cf,
-  0x7431, 0x84b2, 0x638e, 0x638e, 0x63cf, 0x5b8e, 0x5b8e, 0x638e,
-  0x638e, 0x6bcf, 0x7430, 0x7430, 0x7c51, 0x7c30, 0x7c30, 0x7c30,
-  0x8471, 0x7c51, 0x7c50, 0x7c30, 0x7c51, 0x7c30, 0x8430, 0x8c71,
-  0x94b2, 0x94d2, 0x94d2, 0x94b2, 0x9491, 0x9491, 0x94d2, 0x94b1,
-  0x94b1, 0x9491, 0x8c4f, 0x840f, 0x840f, 0x73ae, 0x738e, 0x6b8e,
-  0x7bf0, 0x8451, 0x6bae, 0x4aaa, 0x426a, 0x4249, 0x3a29, 0x31e8,
-  0x3a09, 0x4249, 0x424a, 0x428a, 0x4acc, 0x530c, 0x5b2d, 0x636e,
-  0x530d, 0x5b4d, 0x63ae, 0x636e, 0x532c, 0x52ec, 0x52ec, 0x530c,
-  0x8cb3, 0x9d14, 0x73ef, 0x636d, 0x4a8a, 0x4249, 0x4249, 0x426a,
-  0x4aaa, 0x52cb, 0x52cb, 0x52ec, 0x636e, 0x636e, 0x636e, 0x638e,
-  0x636e, 0x6baf, 0x63ae, 0x5b4d, 0x638e, 0x638e, 0x7c50, 0x742f,
-  0x8471, 0x7c71, 0x84b2, 0x84b2, 0x84b2, 0x638e, 0x5b4d, 0x63ae,
-  0x636e, 0x638e, 0x5b4d, 0x63ae, 0x63cf, 0x63cf, 0x63cf, 0x7430,
-  0x7410, 0x7c91, 0x84b2, 0x8d13, 0x84d2, 0x84d2, 0x8d14, 0x84d2,
-  0x7cd2, 0x7cb2, 0x7cd2, 0x7cd2, 0x7cd2, 0x7cd3, 0x7cb2, 0x7cd2,
-  0x7cd3, 0x74b2, 0x74b2, 0x7492, 0x7492, 0x7492, 0x7492, 0x6c91,
-  0x6c91, 0x6c71, 0x6c71, 0x6c92, 0x74b2, 0x6c92, 0x6cb2, 0x74d2,
-  0x74f3, 0x7d13, 0x7d34, 0x7d34, 0x8575, 0x8d96, 0x95b6, 0x95b6,
-  0x95f6, 0x9e16, 0xa657, 0xb698, 0xbeb9, 0xbefa, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7bd, 0xf7bc, 0xefdc, 0xe7bc, 0xcf7b,
-  0xc77b, 0xaf3a, 0xb71a, 0xd73a, 0xef9b, 0xf7bc, 0xcf1a, 0xb698,
-  0xae58, 0xced9, 0xe75a, 0xb637, 0xceb9, 0xd6d9, 0xa5b5, 0x9d95,
-  0xae16, 0xa5b5, 0xc677, 0xce98, 0x84f3, 0x7cd3, 0xad94, 0xbdf6,
-  0x9d34, 0xc657, 0x9513, 0xe75a, 0xadb5, 0x4b6e, 0x7471, 0x7c92,
-  0x5bcf, 0x6c10, 0x7c30, 0x7c91, 0x63ef, 0x6bef, 0x63af, 0x63af,
-  0x5b8e, 0x63ae, 0x63cf, 0x638e, 0x6bae, 0x636d, 0x636d, 0x6bad,
-  0x6bae, 0x634c, 0x632c, 0x31c8, 0x31a7, 0x3187, 0x3187, 0x39a7,
-  0x41e8, 0x41c8, 0x39a7, 0x39a7, 0x39c7, 0x41c8, 0x4209, 0x4a8a,
-  0x5b4d, 0x5b4d, 0x5b2d, 0x4aeb, 0x4aeb, 0x4acb, 0x52ec, 0x52cc,
-  0x52ec, 0x530c, 0x534d, 0x534d, 0x5b8e, 0x63ae, 0x5b8e, 0x63af,
-  0x63af, 0x63cf, 0x5b8e, 0x5b4d, 0x638e, 0x5b6e, 0x534d, 0x5b6d,
-  0x638e, 0x7430, 0x8492, 0x7c51, 0x7430, 0x7c50, 0x7c71, 0x8491,
-  0x8491, 0x8491, 0x8cd2, 0x8491, 0x8cb2, 0x8471, 0x94b2, 0x8c92,
-  0x8c71, 0x8c91, 0x94b2, 0x94b2, 0x8c50, 0x94b2, 0xa512, 0xa512,
-  0x9cf2, 0x9490, 0x9470, 0x8c50, 0x8c50, 0x8c70, 0x73ae, 0x5b0c,
-  0x5b2d, 0x636d, 0x52eb, 0x426a, 0x4249, 0x3a09, 0x31e8, 0x3a08,
-  0x3a09, 0x3a09, 0x3a29, 0x426a, 0x426a, 0x52cc, 0x5b4d, 0x530c,
-  0x530d, 0x6bcf, 0x6bcf, 0x5b2d, 0x5b4d, 0x5b2d, 0x530c, 0x5b2d,
-  0x6bf0, 0xa576, 0x8cb2, 0x8471, 0x634d, 0x4a8a, 0x4249, 0x4249,
-  0x4aab, 0x52cb, 0x5b0c, 0x5b2d, 0x634d, 0x636e, 0x638e, 0x638e,
-  0x6bae, 0x638e, 0x63ae, 0x638e, 0x6bcf, 0x7c50, 0x8492, 0x8cb2,
-  0x8cd2, 0x8cd2, 0x94f3, 0x8491, 0x7c71, 0x6bce, 0x5b4d, 0x63cf,
-  0x6bef, 0x6bef, 0x638e, 0x63ae, 0x6bef, 0x6bef, 0x6bcf, 0x7430,
-  0x7430, 0x7450, 0x7cb1, 0x84d2, 0x7c92, 0x7cb2, 0x84d2, 0x7cb2,
-  0x7491, 0x7492, 0x7cd2, 0x84f3, 0x7cb2, 0x7c92, 0x7cb2, 0x7cd2,
-  0x7492, 0x7492, 0x74b2, 0x6c92, 0x7492, 0x7492, 0x6c51, 0x6c51,
-  0x6c71, 0x6c71, 0x6c71, 0x6c92, 0x6cb2, 0x6c92, 0x6c92, 0x6cb2,
-  0x74f3, 0x7d14, 0x7d13, 0x7d34, 0x8554, 0x8d75, 0x8db6, 0x95b5,
-  0x95f6, 0x9e36, 0xae58, 0xb698, 0xbeb9, 0xc6fa, 0xc73b, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7bd, 0xf7dc, 0xefdc, 0xe7bc, 0xcf9b,
-  0xc77b, 0xa71a, 0xb71a, 0xcf3b, 0xef9b, 0xef9b, 0xcefa, 0xbeb9,
-  0xae58, 0xd6d9, 0xe75a, 0xadf6, 0xceb9, 0xdef9, 0xadd6, 0x8533,
-  0x9575, 0x9575, 0xbe57, 0xc677, 0x8d34, 0x7cb2, 0xa574, 0xbdf7,
-  0x8cb3, 0xb5f6, 0xa574, 0xef9b, 0x9d53, 0x538e, 0x7450, 0x7471,
-  0x5bcf, 0x7c91, 0xadb5, 0x6c30, 0x5bcf, 0x63ef, 0x534d, 0x536e,
-  0x536e, 0x5b8e, 0x5b8e, 0x638e, 0x7430, 0x636d, 0x636d, 0x73ef,
-  0x6bad, 0x5b2c, 0x52eb, 0x4acd, 0x3a4a, 0x29a7, 0x3186, 0x39c7,
-  0x4208, 0x41c8, 0x39c7, 0x39a7, 0x3186, 0x3186, 0x39a7, 0x4229,
-  0x4acb, 0x52cc, 0x4acb, 0x52cb, 0x4aab, 0x4acb, 0x52ec, 0x52ec,
-  0x52ec, 0x532d, 0x63af, 0x7431, 0x5b8e, 0x63cf, 0x63af, 0x5bae,
-  0x6bf0, 0x63cf, 0x5b6d, 0x534d, 0x532d, 0x5b4d, 0x532d, 0x532d,
-  0x7430, 0x8cf3, 0x84b2, 0x7c51, 0x7c50, 0x7c50, 0x7c50, 0x7c51,
-  0x7c50, 0x8451, 0x94f3, 0x9d54, 0x7c30, 0x8c71, 0x8c91, 0x8c71,
-  0x8c91, 0x94b1, 0x8c91, 0x8c91, 0x8c51, 0x9491, 0x9cf2, 0xa533,
-  0xa512, 0x9cb1, 0x9cb1, 0x94b0, 0x8c70, 0x8450, 0x73ef, 0x5b0d,
-  0x52cc, 0x52cc, 0x428a, 0x424a, 0x3a49, 0x3a49, 0x3a29, 0x3208,
-  0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x428a, 0x4aab, 0x4aec, 0x534d,
-  0x6bcf, 0x6bcf, 0x5b4d, 0x5b2d, 0x5b2d, 0x636e, 0x5b4d, 0x636e,
-  0x636e, 0x8472, 0x8492, 0x740f, 0x7c10, 0x5aec, 0x4249, 0x4249,
-  0x4aab, 0x52ec, 0x5b0d, 0x5b0c, 0x636e, 0x636d, 0x636d, 0x6bcf,
-  0x6bcf, 0x638d, 0x638d, 0x63ae, 0x73ef, 0x8471, 0x84b2, 0x7c70,
-  0x84b2, 0x8cd2, 0x94f3, 0x8491, 0x73ef, 0x6bef, 0x6bef, 0x7451,
-  0x6bef, 0x6bef, 0x6bce, 0x5b6d, 0x63ae, 0x63cf, 0x6c10, 0x6c10,
-  0x7430, 0x7471, 0x7cb2, 0x7cb2, 0x7cb2, 0x7cb2, 0x7cb2, 0x7cb2,
-  0x7491, 0x7cd2, 0x7492, 0x7492, 0x74b2, 0x7492, 0x7472, 0x7492,
-  0x6c92, 0x6c71, 0x7492, 0x6c71, 0x6c92, 0x6c71, 0x6c71, 0x6c51,
-  0x6c51, 0x6c51, 0x6c71, 0x6c71, 0x6c71, 0x6c92, 0x6cb2, 0x6cb2,
-  0x74d3, 0x7cf3, 0x7d13, 0x7d34, 0x8534, 0x8575, 0x8d95, 0x95b6,
-  0x95f6, 0x9e16, 0xa657, 0xb698, 0xbed9, 0xc6fa, 0xc73b, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7dd, 0xf7dc, 0xefdc, 0xdfbc, 0xcf7b,
-  0xc77b, 0xa71a, 0xbf3a, 0xcf1b, 0xef9b, 0xef9b, 0xc6d9, 0xbeb9,
-  0xae38, 0xd6f9, 0xef7b, 0xae17, 0xce98, 0xdef9, 0xbe37, 0x8554,
-  0x6cb2, 0x8514, 0xb616, 0xc678, 0x8d34, 0x7492, 0x9d54, 0xc637,
-  0x7c92, 0xadf6, 0x9d54, 0xef7b, 0xa594, 0x538e, 0x7c91, 0x7c91,
-  0x63cf, 0x94d2, 0xd6b8, 0x7410, 0x4b6d, 0x538e, 0x4b0d, 0x4b0d,
-  0x534e, 0x5b8e, 0x536d, 0x636e, 0x73ef, 0x636d, 0x638d, 0x6b8d,
-  0x636d, 0x5b2c, 0x530c, 0x6390, 0x8d15, 0x63cf, 0x4a8a, 0x4a8a,
-  0x4a6a, 0x39c8, 0x39c7, 0x3186, 0x3166, 0x3186, 0x31a7, 0x3a28,
-  0x4249, 0x4a8a, 0x4aab, 0x52ab, 0x52ab, 0x52ec, 0x5b2d, 0x52ec,
-  0x636e, 0x63af, 0x7c72, 0x6bf0, 0x4b2d, 0x63ae, 0x63cf, 0x6bf0,
-  0x63cf, 0x63cf, 0x6bf0, 0x63cf, 0x5b8e, 0x532d, 0x532d, 0x6bcf,
-  0x8492, 0x8492, 0x8cb2, 0x7430, 0x6bef, 0x6bef, 0x6bcf, 0x6bcf,
-  0x6bce, 0x6bae, 0x73ef, 0x8450, 0x8471, 0x8450, 0x7c0f, 0x8450,
-  0x8c71, 0x8c91, 0x8c91, 0x8c51, 0x8430, 0x8c71, 0xa533, 0xad73,
-  0xad53, 0x9cd1, 0x9c90, 0x9cb1, 0x94d1, 0x94d2, 0x73cf, 0x52ec,
-  0x52cc, 0x4acb, 0x4a8b, 0x426a, 0x3a49, 0x428a, 0x530c, 0x4acc,
-  0x3a49, 0x3a49, 0x424a, 0x424a, 0x426a, 0x4acc, 0x530c, 0x4b0c,
-  0x530c, 0x530d, 0x5b2d, 0x5b6e, 0x5b2d, 0x636e, 0x636e, 0x636e,
-  0x638e, 0x7c51, 0x8471, 0x73ef, 0x73ae, 0x632d, 0x4a6a, 0x4269,
-  0x4aab, 0x5b0c, 0x636e, 0x634d, 0x6b8e, 0x6bce, 0x6bae, 0x73ef,
-  0x73cf, 0x636d, 0x638e, 0x6bae, 0x7c30, 0x7c51, 0x8492, 0x7c50,
-  0x84b2, 0x9513, 0x8cd2, 0x7c50, 0x7430, 0x740f, 0x7430, 0x7430,
-  0x6bef, 0x6bcf, 0x63ae, 0x63ae, 0x5b8e, 0x5b8e, 0x6bef, 0x6c10,
-  0x6bef, 0x6c30, 0x7451, 0x7c92, 0x7c92, 0x7c92, 0x7c92, 0x7492,
-  0x7492, 0x7491, 0x7471, 0x7471, 0x6c71, 0x6c51, 0x6c51, 0x6c51,
-  0x7492, 0x6c51, 0x6c71, 0x6c71, 0x6c51, 0x6c71, 0x6c72, 0x6451,
-  0x6c51, 0x6451, 0x6c51, 0x6451, 0x6c71, 0x6c92, 0x6c92, 0x74b2,
-  0x74b2, 0x74d3, 0x7d13, 0x7d34, 0x8555, 0x8575, 0x8d75, 0x95b6,
-  0x95f6, 0x9e16, 0xa657, 0xae98, 0xbed9, 0xbefa, 0xc73b, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7dd, 0xf7dc, 0xefdc, 0xdfbc, 0xcf9b,
-  0xc77b, 0xa719, 0xcf5b, 0xd73a, 0xe77a, 0xef7b, 0xc6b9, 0xbeb9,
-  0xb658, 0xdf1a, 0xe77a, 0xae17, 0xce98, 0xded9, 0xc698, 0x8555,
-  0x6492, 0x8d35, 0xb5d6, 0xc657, 0xa575, 0x74b2, 0x9533, 0xb616,
-  0x7c71, 0xadd5, 0x9d54, 0xe71a, 0xadd6, 0x5baf, 0x84b2, 0x7c71,
-  0x6c10, 0xbe16, 0xce57, 0x7431, 0x4b4e, 0x534e, 0x4b0d, 0x42ed,
-  0x532d, 0x5b8e, 0x5b6e, 0x638e, 0x6bce, 0x63ae, 0x638d, 0x636d,
-  0x636d, 0x5b0c, 0x634d, 0x42ab, 0x4b0c, 0x534d, 0x5b4d, 0x52ec,
-  0x4269, 0x39c7, 0x39a7, 0x3186, 0x3186, 0x3186, 0x39c7, 0x3a08,
-  0x4249, 0x4a6a, 0x52ab, 0x4aaa, 0x52ec, 0x52ec, 0x532c, 0x530d,
-  0x5b4e, 0x5b6e, 0x6bcf, 0x42cb, 0x4b0c, 0x63af, 0x63ae, 0x63cf,
-  0x63cf, 0x6bf0, 0x6bef, 0x5b8e, 0x532d, 0x4acb, 0x4aec, 0x638e,
-  0x5b4d, 0x5b4d, 0x638e, 0x6bce, 0x6bae, 0x6bce, 0x6bef, 0x6bcf,
-  0x638e, 0x5b4d, 0x636d, 0x6b8d, 0x634d, 0x634d, 0x6b8e, 0x73cf,
-  0x8430, 0x8c51, 0x8c71, 0x8410, 0x7bef, 0x9492, 0xad54, 0xbdd5,
-  0xad53, 0xa512, 0xa4f2, 0x8c70, 0x8c50, 0x8c70, 0x6bae, 0x5b0d,
-  0x4aab, 0x4a8b, 0x426a, 0x426a, 0x3a4a, 0x428b, 0x6b8f, 0x428b,
-  0x3a49, 0x3a29, 0x3a49, 0x426a, 0x426a, 0x4aab, 0x4aab, 0x4acc,
-  0x4acb, 0x530c, 0x5b4d, 0x5b4d, 0x5b4d, 0x5b4d, 0x638e, 0x6bae,
-  0x73ef, 0x8cb2, 0x8cb2, 0x8451, 0x7c10, 0x6bae, 0x4a8a, 0x4249,
-  0x4a8a, 0x52eb, 0x73cf, 0x6b8d, 0x6bae, 0x8451, 0x7c50, 0x73cf,
-  0x6bce, 0x636d, 0x638e, 0x6bae, 0x7c50, 0x84b2, 0x8cd2, 0x7c71,
-  0x8492, 0x8cd2, 0x8cd2, 0x9513, 0x8492, 0x7c71, 0x7c91, 0x7c71,
-  0x6c10, 0x63ae, 0x63ae, 0x6bcf, 0x6bef, 0x63ae, 0x63ce, 0x7451,
-  0x6c0f, 0x7451, 0x6c30, 0x7451, 0x7c92, 0x7c92, 0x7491, 0x7491,
-  0x7491, 0x6c51, 0x7471, 0x7492, 0x6c71, 0x7471, 0x7471, 0x6c51,
-  0x6c51, 0x6c31, 0x6c51, 0x6c31, 0x6430, 0x6c51, 0x6430, 0x6451,
-  0x6431, 0x6431, 0x6451, 0x6c71, 0x6c71, 0x6c71, 0x6c92, 0x6c92,
-  0x6cb2, 0x74b2, 0x74f3, 0x7d14, 0x8534, 0x8554, 0x8d75, 0x95b6,
-  0x95f6, 0x9e17, 0xa678, 0xb698, 0xbed9, 0xbf1a, 0xc73a, 0xcf7b,
-  0xd79c, 0xd7bc, 0xefdd, 0xf7dd, 0xf7dc, 0xefdc, 0xdfbc, 0xcf7b,
-  0xc77b, 0xa6f9, 0xcf5a, 0xdf5a, 0xe77a, 0xe75a, 0xbeb9, 0xbeb9,
-  0xbe79, 0xdf19, 0xe75a, 0xae17, 0xceb8, 0xd6d8, 0xce98, 0x8d54,
-  0x5c72, 0x7d14, 0xadd6, 0xbe16, 0xb616, 0x84f3, 0x84f3, 0xadb6,
-  0x7451, 0xb5d5, 0x9d74, 0xd6d8, 0xc657, 0x7451, 0x8cb2, 0x7430,
-  0x7430, 0xd6d8, 0xb5d5, 0x5baf, 0x536e, 0x534e, 0x42ec, 0x42cc,
-  0x4b2d, 0x5b6e, 0x534d, 0x5b8e, 0x63ae, 0x638d, 0x636d, 0x636d,
-  0x636d, 0x5b0b, 0x5b2c, 0x3a8a, 0x3229, 0x3a4a, 0x3a4a, 0x3a29,
-  0x31a7, 0x31a7, 0x3186, 0x3186, 0x3186, 0x39a7, 0x39e7, 0x3a08,
-  0x4249, 0x4a8a, 0x4aaa, 0x52ab, 0x52cb, 0x52cb, 0x52ec, 0x5b2d,
-  0x532c, 0x532d, 0x5b6e, 0x63af, 0x6c30, 0x7c92, 0x6c30, 0x63f0,
-  0x6c10, 0x7431, 0x7410, 0x636e, 0x4aab, 0x4acb, 0x4aab, 0x426a,
-  0x4acb, 0x4acb, 0x52eb, 0x638d, 0x7410, 0x7c51, 0x7c30, 0x7c30,
-  0x740f, 0x7c0f, 0x73ef, 0x636d, 0x634d, 0x634c, 0x5b2d, 0x632d,
-  0x6b6d, 0x7bcf, 0x8430, 0x8410, 0x7bef, 0x840f, 0x94b1, 0xa533,
-  0xa533, 0xa512, 0x9cb1, 0x8c50, 0x8470, 0x8471, 0x6b8e, 0x6b8e,
-  0x52ec, 0x4a8b, 0x4aab, 0x426a, 0x3a4a, 0x530d, 0x5b4e, 0x3a29,
-  0x424a, 0x3a29, 0x4249, 0x426a, 0x426a, 0x426a, 0x4aab, 0x4aab,
-  0x42ab, 0x638e, 0x63af, 0x5b4d, 0x638e, 0x638e, 0x73ef, 0x8cd3,
-  0x9514, 0x8cb2, 0x7c30, 0x7c30, 0x7c30, 0x6b8e, 0x52eb, 0x52eb,
-  0x5b2c, 0x6bae, 0x8c91, 0x7c50, 0x73ef, 0x7c30, 0x7c30, 0x73ef,
-  0x7c51, 0x6bef, 0x6bce, 0x6bef, 0x7c30, 0x8491, 0x7c71, 0x7c51,
-  0x8cd2, 0x9513, 0x8cf3, 0x9513, 0x8cd2, 0x7c50, 0x84d2, 0x84b2,
-  0x7c92, 0x7c71, 0x7450, 0x7430, 0x6c10, 0x6bef, 0x6c0f, 0x6bef,
-  0x6c10, 0x7430, 0x7430, 0x7450, 0x7471, 0x7471, 0x7491, 0x7cb2,
-  0x7471, 0x6c51, 0x6c51, 0x7471, 0x6c71, 0x6c51, 0x6c51, 0x6c51,
-  0x6c30, 0x6c30, 0x6c30, 0x6430, 0x6430, 0x6410, 0x6410, 0x6431,
-  0x6451, 0x6431, 0x6c71, 0x6451, 0x6c71, 0x6c92, 0x6471, 0x6c92,
-  0x6cb2, 0x74d3, 0x74f3, 0x7d14, 0x8534, 0x8554, 0x8d95, 0x95b6,
-  0x95f6, 0x9e17, 0xa657, 0xaeb8, 0xb6f9, 0xc71a, 0xc75b, 0xcf7b,
-  0xd79c, 0xdfbc, 0xefdd, 0xf7dd, 0xf7dc, 0xefdc, 0xdfbc, 0xcf7b,
-  0xc77b, 0xa6f9, 0xcf5b, 0xdf7b, 0xe77a, 0xdf5a, 0xae78, 0xc6fa,
-  0xc699, 0xdf3a, 0xe75a, 0xbe78, 0xd6d9, 0xd698, 0xbe37, 0x9555,
-  0x6492, 0x7d14, 0xa5d6, 0xbe37, 0xbe17, 0x8d13, 0x7471, 0xa575,
-  0x7430, 0xb5d6, 0xa595, 0xceb8, 0xdef9, 0x8d13, 0x9513, 0x8cb2,
-  0xa553, 0xdf18, 0xadb5, 0x5baf, 0x6c11, 0x5baf, 0x3aab, 0x42cc,
-  0x4b2d, 0x534d, 0x5b6e, 0x5b6d, 0x63ae, 0x638d, 0x638e, 0x636d,
-  0x5b4d, 0x5b4c, 0x5b2c, 0x42ab, 0x29a8, 0x3a2a, 0x3a2a, 0x31e8,
-  0x39c8, 0x39a7, 0x3186, 0x3186, 0x3186, 0x39c7, 0x39e8, 0x4a69,
-  0x4a8a, 0x4a8a, 0x52cb, 0x52ab, 0x4aaa, 0x530c, 0x5b2c, 0x530c,
-  0x530c, 0x530c, 0x532d, 0x8cf3, 0x9d75, 0x7431, 0x5b8e, 0x63af,
-  0x638e, 0x63ae, 0x7431, 0x5b4d, 0x3a09, 0x3a09, 0x3a29, 0x4249,
-  0x530c, 0x8cd2, 0x636d, 0x638d, 0x7c30, 0x7c50, 0x7c50, 0x7c50,
-  0x7c50, 0x8cb2, 0x8471, 0x8471, 0x8c91, 0x73ef, 0x6bae, 0x632d,
-  0x5aeb, 0x632c, 0x6b6d, 0x738e, 0x738e, 0x6b8d, 0x8430, 0x9491,
-  0xa513, 0xa513, 0x94b1, 0x8450, 0x8450, 0x73ef, 0x73cf, 0x634d,
-  0x4aab, 0x4aac, 0x4aab, 0x428b, 0x4acc, 0x532d, 0x3a49, 0x3a49,
-  0x3a29, 0x3a08, 0x3a29, 0x426a, 0x426a, 0x426a, 0x428b, 0x4aab,
-  0x530c, 0x7c72, 0x7410, 0x5b4d, 0x638e, 0x7410, 0x8492, 0x8cd3,
-  0x94f3, 0x8471, 0x740f, 0x73ef, 0x6bae, 0x634d, 0x632d, 0x6b8e,
-  0x6bae, 0x8471, 0x8cb2, 0x8cb1, 0x7c30, 0x7c0f, 0x7c2f, 0x8450,
-  0x8471, 0x7c50, 0x7410, 0x740f, 0x7c71, 0x84b1, 0x84b2, 0x7c50,
-  0x8cf2, 0x8cf2, 0x8cf2, 0x8d12, 0x8cd2, 0x7c91, 0x84d2, 0x84b2,
-  0x84b2, 0x7c71, 0x7430, 0x6bef, 0x6bef, 0x6c10, 0x7450, 0x7450,
-  0x6c30, 0x7451, 0x7430, 0x7451, 0x7471, 0x7cb2, 0x6c51, 0x7471,
-  0x6c51, 0x7492, 0x7492, 0x7492, 0x6c51, 0x6c30, 0x6c30, 0x6c30,
-  0x6c31, 0x6c31, 0x6430, 0x6430, 0x6430, 0x6430, 0x6410, 0x6410,
-  0x6431, 0x6431, 0x6431, 0x6451, 0x6451, 0x6471, 0x6c71, 0x6c92,
-  0x6cb2, 0x74b2, 0x74f3, 0x7d13, 0x7d34, 0x8554, 0x8d75, 0x8d96,
-  0x95d6, 0x9e17, 0xa658, 0xae98, 0xb6d9, 0xc71a, 0xc75b, 0xcf7b,
-  0xd79c, 0xdfbc, 0xefdd, 0xf7dd, 0xf7dc, 0xefdc, 0xdfbc, 0xcf7b,
-  0xc77b, 0xa71a, 0xc73a, 0xdf5b, 0xe77b, 0xdf5b, 0x9e57, 0xc6d9,
-  0xc6b9, 0xdf1a, 0xdf3a, 0xbe78, 0xd6d9, 0xd6b8, 0xb5f6, 0x9575,
-  0x74d4, 0x7cd4, 0x9554, 0xbe16, 0xbe16, 0x8d13, 0x7471, 0xa575,
-  0x7451, 0xa575, 0xa595, 0xc657, 0xe71a, 0x8cd2, 0x9d54, 0xa595,
-  0xce77, 0xad94, 0x9513, 0x63cf, 0x534e, 0x42ed, 0x3aab, 0x3acc,
-  0x4b0d, 0x534d, 0x534d, 0x5b6d, 0x6c0f, 0x5b8d, 0x5b4d, 0x5b4d,
-  0x5b2d, 0x5b2c, 0x5b4d, 0x3a6a, 0x29a8, 0x3a2a, 0x424a, 0x31e8,
-  0x39c8, 0x39c7, 0x3186, 0x3186, 0x31a7, 0x39a7, 0x4208, 0x4a6a,
-  0x4a8a, 0x4a8a, 0x4aaa, 0x52cb, 0x52cb, 0x52ec, 0x52ec, 0x530c,
-  0x530c, 0x52ec, 0x5b2d, 0x6bcf, 0x5b6e, 0x5b4d, 0x5b2d, 0x5b6e,
-  0x638e, 0x5b2d, 0x4acb, 0x52ec, 0x426a, 0x4249, 0x424a, 0x426a,
-  0x52eb, 0x7430, 0x6bcf, 0x636d, 0x6bae, 0x73ce, 0x7c50, 0x7c50,
-  0x8c91, 0x8491, 0x8c91, 0x8c91, 0x8471, 0x8451, 0x6bae, 0x634d,
-  0x5b2c, 0x5aec, 0x632c, 0x6b4d, 0x6b6d, 0x6b6d, 0x738e, 0x8410,
-  0x9492, 0x8c71, 0x8c71, 0x8471, 0x73cf, 0x6b8e, 0x5b0c, 0x52ec,
-  0x52cc, 0x426a, 0x3a4a, 0x52ec, 0x4acc, 0x424a, 0x3a09, 0x4249,
-  0x4249, 0x4249, 0x428a, 0x428a, 0x428a, 0x4aab, 0x4aab, 0x42ab,
-  0x532d, 0x7431, 0x6baf, 0x636e, 0x6baf, 0x7c51, 0x8471, 0x7c30,
-  0x8451, 0x7c30, 0x73ef, 0x7c30, 0x6bae, 0x5b2d, 0x5b2c, 0x5b0c,
-  0x634d, 0x7c30, 0x94d2, 0x8cd2, 0x8450, 0x7c30, 0x8471, 0x8471,
-  0x7c50, 0x7c50, 0x7c50, 0x73ef, 0x7430, 0x8491, 0x84b2, 0x7c70,
-  0x8cd2, 0x8cf2, 0x8d12, 0x8d13, 0x8cf3, 0x84d2, 0x7c91, 0x8cf3,
-  0x9534, 0x84b2, 0x7450, 0x7450, 0x6c0f, 0x7471, 0x7471, 0x7c92,
-  0x7471, 0x7431, 0x7451, 0x7451, 0x6c30, 0x7471, 0x7471, 0x6c51,
-  0x6c51, 0x6c30, 0x6c71, 0x6c31, 0x6c51, 0x6c51, 0x6430, 0x6410,
-  0x63f0, 0x6410, 0x6410, 0x6410, 0x5bf0, 0x6410, 0x5c10, 0x6410,
-  0x6430, 0x6c51, 0x6c51, 0x6c51, 0x6451, 0x6c72, 0x6c71, 0x6c92,
-  0x6c92, 0x74b2, 0x74d3, 0x7d13, 0x7d34, 0x8554, 0x8d75, 0x8d96,
-  0x95d6, 0x9e17, 0xa658, 0xae99, 0xb6d9, 0xc71a, 0xcf5b, 0xcf7b,
-  0xd79c, 0xdfbc, 0xefdd, 0xf7dd, 0xefdc, 0xefdc, 0xdfbc, 0xcf7b,
-  0xbf5b, 0xaf1a, 0xc73a, 0xdf5b, 0xef9b, 0xd73a, 0x9e58, 0xb699,
-  0xc6b9, 0xdf19, 0xdf19, 0xb658, 0xdef9, 0xd6d9, 0xb616, 0x8d54,
-  0x7cf4, 0x84f4, 0x9d75, 0xbdf6, 0xc637, 0xa5b5, 0x7cb1, 0x9534,
-  0x7451, 0x8cd3, 0xadb5, 0xbe57, 0xe71a, 0x9512, 0x8cf2, 0x7430,
-  0xb5f5, 0xad73, 0xadb5, 0x6bf0, 0x3aab, 0x3aab, 0x3aac, 0x3aac,
-  0x532d, 0x5b6e, 0x4aec, 0x4b0c, 0x63ae, 0x532d, 0x4aeb, 0x532c,
-  0x5b2d, 0x5b0c, 0x530c, 0x428b, 0x31c8, 0x3a2a, 0x3a29, 0x4229,
-  0x3a08, 0x39c7, 0x31a6, 0x31a6, 0x31a7, 0x39c7, 0x4229, 0x4a8a,
-  0x4a8a, 0x4a8a, 0x52ab, 0x52cb, 0x52cb, 0x52ec, 0x5b4d, 0x5b0c,
-  0x52eb, 0x530c, 0x5b2d, 0x4aab, 0x52ec, 0x52ec, 0x4acb, 0x4acb,
-  0x52cb, 0x4aab, 0x5b0d, 0x634d, 0x424a, 0x424a, 0x4249, 0x426a,
-  0x4acb, 0x530c, 0x5b2c, 0x530c, 0x5b4c, 0x638d, 0x73ef, 0x8491,
-  0x8471, 0x7c50, 0x8471, 0x94f2, 0x94d2, 0x8c91, 0x73ef, 0x73ae,
-  0x634d, 0x5aeb, 0x5aec, 0x6b4d, 0x6b4d, 0x632d, 0x6b4d, 0x73ae,
-  0x7bef, 0x8430, 0x7c10, 0x5b2d, 0x5b0c, 0x634d, 0x4aab, 0x4aab,
-  0x428a, 0x3a29, 0x424a, 0x426a, 0x3a2a, 0x3a29, 0x4229, 0x3a29,
-  0x4249, 0x4249, 0x426a, 0x426a, 0x428a, 0x4aab, 0x4acc, 0x4acb,
-  0x530c, 0x7410, 0x638e, 0x63ae, 0x6bcf, 0x6bef, 0x8472, 0x73f0,
-  0x7410, 0x73ef, 0x73ef, 0x7c10, 0x7c10, 0x6b6e, 0x6b8e, 0x6b8e,
-  0x634d, 0x6bae, 0x7c30, 0x8451, 0x740f, 0x7c30, 0x8cb2, 0x7c50,
-  0x7c50, 0x8471, 0x7c71, 0x740f, 0x742f, 0x7c50, 0x8491, 0x84b1,
-  0x8cf2, 0x8cf3, 0x84d2, 0x8d13, 0x8cf3, 0x8cf3, 0x8cf2, 0x8d13,
-  0x9534, 0x7c91, 0x6c50, 0x7471, 0x7491, 0x7491, 0x7471, 0x7c92,
-  0x7451, 0x7451, 0x6c30, 0x6c10, 0x6c30, 0x6c30, 0x6c30, 0x6c30,
-  0x6c51, 0x6410, 0x6c51, 0x6410, 0x6c30, 0x6410, 0x6410, 0x6410,
-  0x5bcf, 0x5bf0, 0x6410, 0x63f0, 0x5bf0, 0x6410, 0x5c10, 0x6410,
-  0x6410, 0x6430, 0x6431, 0x6451, 0x6451, 0x6c71, 0x6c71, 0x6c92,
-  0x6c92, 0x6cb2, 0x7cf3, 0x7d14, 0x7d34, 0x8555, 0x8d75, 0x9596,
-  0x95d6, 0x9e17, 0xa657, 0xae99, 0xb6d9, 0xc71a, 0xc75b, 0xcf7b,
-  0xd79c, 0xdfbc, 0xefdd, 0xf7dd, 0xefdc, 0xefdc, 0xdfbc, 0xcf7b,
-  0xbf5b, 0xaf3b, 0xc73a, 0xdf5a, 0xefbb, 0xd73a, 0x9e58, 0xb678,
-  0xbe58, 0xd719, 0xdf19, 0xb637, 0xdf19, 0xd6d9, 0xb5d6, 0x8d55,
-  0x8d34, 0x9d96, 0xa595, 0xc637, 0xbe37, 0xb5f6, 0x8cf3, 0x7c72,
-  0x6c92, 0x8d14, 0xad75, 0xbe36, 0xe719, 0xadb5, 0x6c30, 0x53af,
-  0xad94, 0xce56, 0xb5f6, 0x4b2d, 0x3acc, 0x3aac, 0x3a8b, 0x3aac,
-  0x532d, 0x740f, 0x42ab, 0x3a6a, 0x42cb, 0x42eb, 0x4aec, 0x4b0c,
-  0x52ec, 0x530c, 0x52ec, 0x3209, 0x31e8, 0x31c8, 0x3a29, 0x424a,
-  0x31c8, 0x39a7, 0x31a7, 0x3186, 0x39a7, 0x39e8, 0x4a6a, 0x4a8a,
-  0x4a8a, 0x4aaa, 0x4aab, 0x52cb, 0x52ec, 0x52ec, 0x52ec, 0x530c,
-  0x52ec, 0x4aab, 0x4aab, 0x4aab, 0x4a8a, 0x4aab, 0x4aab, 0x4aab,
-  0x52cb, 0x7c10, 0x7c30, 0x634d, 0x3a08, 0x4249, 0x4249, 0x4249,
-  0x530c, 0x73ef, 0x5b2d, 0x5b2c, 0x636d, 0x6b8e, 0x6bce, 0x7c30,
-  0x8471, 0x8c91, 0x9491, 0x8c91, 0x94b1, 0x94d2, 0x8450, 0x73ce,
-  0x636d, 0x632c, 0x7bef, 0x7bef, 0x738e, 0x6b4d, 0x6b6d, 0x634d,
-  0x6b6d, 0x8c71, 0x636d, 0x5b2d, 0x52cb, 0x4a8b, 0x4a8a, 0x426a,
-  0x424a, 0x3a29, 0x3a29, 0x3a29, 0x3209, 0x3a09, 0x3a29, 0x3a29,
-  0x426a, 0x428a, 0x426a, 0x428b, 0x428b, 0x428a, 0x4acc, 0x4acb,
-  0x6bf0, 0x6bf0, 0x534d, 0x638e, 0x6baf, 0x6bcf, 0x7c10, 0x636e,
-  0x638e, 0x740f, 0x7c10, 0x7c30, 0x7c30, 0x6bae, 0x73cf, 0x6bce,
-  0x636d, 0x6b8e, 0x6b8e, 0x73ef, 0x7c10, 0x7c50, 0x8491, 0x8491,
-  0x8491, 0x7c50, 0x7c70, 0x8491, 0x8491, 0x8471, 0x7c71, 0x84b1,
-  0x8cd2, 0x84d2, 0x9534, 0x84d2, 0x8d13, 0x8cf2, 0x7c91, 0x84d2,
-  0x84d2, 0x84d2, 0x7471, 0x7450, 0x7451, 0x7cb2, 0x7cb2, 0x7471,
-  0x7471, 0x7471, 0x7451, 0x6c30, 0x6c10, 0x6c30, 0x6c30, 0x6c30,
-  0x6c30, 0x6410, 0x6410, 0x6410, 0x63f0, 0x5bef, 0x5bcf, 0x63ef,
-  0x5bcf, 0x5bcf, 0x63f0, 0x63f0, 0x5bef, 0x5bcf, 0x5bf0, 0x5bf0,
-  0x5c10, 0x5c10, 0x5c10, 0x6430, 0x6431, 0x6451, 0x6c71, 0x6c92,
-  0x6c92, 0x74b2, 0x74f3, 0x7cf3, 0x7d34, 0x8554, 0x8d75, 0x8d95,
-  0x95d6, 0x9e17, 0xa657, 0xae98, 0xb6d9, 0xc71a, 0xc73b, 0xcf7b,
-  0xd79c, 0xdfdc, 0xeffd, 0xf7dd, 0xefdc, 0xefdc, 0xdfbc, 0xcf9c,
-  0xbf5b, 0xaf3b, 0xc73a, 0xd75a, 0xefbc, 0xd75b, 0x9e57, 0xbeb8,
-  0xb658, 0xd6f9, 0xdf19, 0xb637, 0xdf19, 0xce98, 0x9db5, 0x7d34,
-  0x9575, 0xbe58, 0x9596, 0xc657, 0xb5f6, 0xbe16, 0x8d14, 0x5bf0,
-  0x6c72, 0x84b2, 0xb5f6, 0xc678, 0xded8, 0xbe37, 0x5bf0, 0x53d0,
-  0xb616, 0xef59, 0x84b1, 0x3aac, 0x42cc, 0x42ac, 0x3a8b, 0x3a8b,
-  0x4b0c, 0x7c71, 0x42cb, 0x3a6a, 0x3a8a, 0x3aab, 0x4aec, 0x4b0c,
-  0x4aeb, 0x530c, 0x532c, 0x4a8b, 0x426a, 0x424a, 0x31e9, 0x3a09,
-  0x31c7, 0x31a7, 0x39c7, 0x31a7, 0x31a7, 0x4229, 0x52aa, 0x4a8a,
-  0x4a8a, 0x4aaa, 0x4aab, 0x52cb, 0x52ec, 0x52cb, 0x52ec, 0x530c,
-  0x52cb, 0x4a8a, 0x4aab, 0x4aab, 0x4aab, 0x52ec, 0x73cf, 0x5b4d,
-  0x52ec, 0x73ef, 0xadb6, 0x73ce, 0x39e8, 0x31c8, 0x3a08, 0x4249,
-  0x52cb, 0x52cb, 0x4acb, 0x52ec, 0x5b4d, 0x6b8e, 0x6b8e, 0x73ce,
-  0x8c91, 0x9491, 0x9491, 0x94b1, 0x94d2, 0x8c71, 0x634c, 0x52aa,
-  0x73ae, 0x6bae, 0x8c92, 0x8430, 0x8c71, 0x7bef, 0x7bef, 0x5b2c,
-  0x52cb, 0x632d, 0x52ec, 0x52cb, 0x52cb, 0x424a, 0x426a, 0x4249,
-  0x3a29, 0x3a4a, 0x3a29, 0x3209, 0x31e9, 0x3a09, 0x4aab, 0x532d,
-  0x4aec, 0x428a, 0x428a, 0x428a, 0x42ab, 0x530c, 0x42ab, 0x530d,
-  0x638e, 0x4aab, 0x532d, 0x5b4d, 0x532d, 0x5b4d, 0x5b6d, 0x5b4d,
-  0x6bce, 0x7c2f, 0x8c70, 0x94b2, 0x8470, 0x8c91, 0x8471, 0x7c0f,
-  0x73cf, 0x6bae, 0x73cf, 0x73ef, 0x7c10, 0x7c50, 0x84b1, 0x8491,
-  0x8cb2, 0x84b1, 0x7c50, 0x84b1, 0x84b1, 0x8471, 0x8471, 0x8cd2,
-  0x8cf3, 0x8cd2, 0x9513, 0x8cf3, 0x8cf3, 0x8cf3, 0x84d2, 0x7c91,
-  0x84d2, 0x7c92, 0x7c71, 0x6c30, 0x7451, 0x7471, 0x7c92, 0x7c91,
-  0x7c92, 0x7492, 0x6c30, 0x6c30, 0x6c30, 0x6c30, 0x6c30, 0x6c50,
-  0x6410, 0x6c30, 0x63f0, 0x5bef, 0x5bef, 0x5bef, 0x63ef, 0x5bcf,
-  0x5bcf, 0x63f0, 0x5bcf, 0x5bcf, 0x5bcf, 0x5bcf, 0x5bcf, 0x5bf0,
-  0x5bf0, 0x5c10, 0x5c10, 0x6430, 0x6430, 0x6451, 0x6451, 0x6c71,
-  0x6c72, 0x6cb2, 0x74d2, 0x74f3, 0x7d34, 0x8534, 0x8575, 0x8d95,
-  0x95b6, 0x9e17, 0xa657, 0xae98, 0xb6d9, 0xc71a, 0xc75b, 0xcf7b,
-  0xd79c, 0xdfdc, 0xeffd, 0xf7dd, 0xefdc, 0xefdc, 0xdfbc, 0xcf9c,
-  0xbf5b, 0xaf3b, 0xcf3b, 0xd75a, 0xf7bb, 0xdf5b, 0xa658, 0xbed9,
-  0xae58, 0xc6b9, 0xd6f9, 0xae57, 0xdef9, 0xce98, 0x9db6, 0x7513,
-  0xa5f6, 0xbe57, 0x8554, 0xc657, 0x9d74, 0xd6f9, 0x9554, 0x5bf0,
-  0x6431, 0x84b2, 0xadd6, 0xbe57, 0xe719, 0xd6b8, 0x7492, 0x5bf1,
-  0x9513, 0xef59, 0x9512, 0x4b4e, 0x42ec, 0x42cc, 0x42cb, 0x42cb,
-  0x42cc, 0x63ae, 0x4b2d, 0x42cb, 0x42ab, 0x42ab, 0x42cb, 0x4aeb,
-  0x4aec, 0x4aeb, 0x530c, 0x4aab, 0x426a, 0x4aab, 0x31c8, 0x3a29,
-  0x3a29, 0x39c7, 0x31a7, 0x31a7, 0x39c7, 0x4a69, 0x52cb, 0x4a8a,
-  0x4a8a, 0x4aab, 0x4aab, 0x4aab, 0x4aab, 0x52ec, 0x5b2d, 0x52ec,
-  0x4aab, 0x4249, 0x426a, 0x4a8b, 0x52ec, 0x634e, 0x52cc, 0x4acc,
-  0x530c, 0x638f, 0x9d34, 0x634c, 0x39e8, 0x39e8, 0x3a08, 0x3a09,
-  0x3a29, 0x4249, 0x4a8a, 0x52cb, 0x5b2c, 0x638d, 0x6bae, 0x8c70,
-  0x94d1, 0x94b1, 0x94b2, 0x9491, 0x7c0f, 0x52cb, 0x4a8a, 0x4a69,
-  0x52cb, 0x5aeb, 0x632d, 0x630c, 0x6b6d, 0x5b0c, 0x5b0c, 0x4aab,
-  0x4249, 0x4249, 0x426a, 0x426a, 0x4a8a, 0x3a29, 0x424a, 0x4249,
-  0x4249, 0x3a29, 0x3209, 0x3209, 0x5b4e, 0x7411, 0x4aab, 0x426a,
-  0x3a4a, 0x3a49, 0x428b, 0x3a6a, 0x426a, 0x4acc, 0x42ab, 0x530d,
-  0x4aab, 0x428b, 0x530c, 0x5b4d, 0x532d, 0x638e, 0x6bcf, 0x7410,
-  0x8c71, 0x9cf2, 0x94f2, 0x94f2, 0x9d13, 0x9d12, 0x94f2, 0x8cb1,
-  0x7c30, 0x6b8e, 0x73ef, 0x7410, 0x7c10, 0x8471, 0x8cb2, 0x8491,
-  0x8491, 0x8cd2, 0x8491, 0x84b2, 0x84b1, 0x7c71, 0x8491, 0x84d2,
-  0x8cd2, 0x84d2, 0x8cf3, 0x8cf3, 0x8d13, 0x84d2, 0x8d13, 0x84b2,
-  0x7c91, 0x7450, 0x7cb2, 0x7c91, 0x7c92, 0x7471, 0x7cd2, 0x7cb2,
-  0x7451, 0x7471, 0x6c51, 0x7471, 0x6c30, 0x6c30, 0x6430, 0x6430,
-  0x6410, 0x6410, 0x6410, 0x5bef, 0x5bef, 0x5bcf, 0x5bcf, 0x6410,
-  0x63f0, 0x63f0, 0x63f0, 0x5baf, 0x5bcf, 0x5baf, 0x5bcf, 0x5bef,
-  0x5c10, 0x6430, 0x6410, 0x6410, 0x6430, 0x6451, 0x6451, 0x6c72,
-  0x6c92, 0x6cb2, 0x74d2, 0x74d3, 0x7d13, 0x8554, 0x8575, 0x8d95,
-  0x95d6, 0x9e17, 0xa657, 0xae98, 0xb6d9, 0xbf1a, 0xcf5b, 0xd77b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7dd, 0xefdc, 0xefdc, 0xdfbc, 0xcf9b,
-  0xbf7b, 0xb73b, 0xcf5b, 0xd75a, 0xf7db, 0xd75b, 0xa678, 0xbeb9,
-  0x9e17, 0xbe78, 0xd6f9, 0xae37, 0xd6d9, 0xc678, 0x9595, 0x7d34,
-  0xadf6, 0xc6b8, 0x6cf3, 0x9d95, 0x9534, 0xceb9, 0x9554, 0x6411,
-  0x6431, 0x84d3, 0x9d54, 0xad94, 0xded8, 0xc637, 0x7cb2, 0x5c11,
-  0x7c92, 0xdf18, 0xadd5, 0x6c31, 0x4b2d, 0x4b0c, 0x5b4d, 0x5b8e,
-  0x42cc, 0x6bcf, 0x5b8e, 0x534d, 0x532d, 0x4aec, 0x4aeb, 0x530c,
-  0x4aeb, 0x4aec, 0x532c, 0x4aab, 0x4a8b, 0x4a8a, 0x3a29, 0x4249,
-  0x31a7, 0x3187, 0x3187, 0x31a7, 0x3a08, 0x52ab, 0x52cb, 0x4a8a,
-  0x4a6a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4aab, 0x4acb, 0x4acb, 0x4aab,
-  0x424a, 0x426a, 0x428a, 0x4acb, 0x4acc, 0x4aab, 0x426a, 0x428b,
-  0x4acc, 0x52ec, 0x8451, 0x5b2c, 0x3a09, 0x39e8, 0x39e8, 0x3a09,
-  0x4249, 0x4a8a, 0x52ec, 0x636d, 0x6b8e, 0x6bae, 0x73ef, 0x9cf2,
-  0x9cf2, 0x94d2, 0x94d2, 0x94d2, 0x8471, 0x6b6d, 0x4a8a, 0x4a6a,
-  0x4209, 0x4a49, 0x4a49, 0x4229, 0x4229, 0x4229, 0x4209, 0x4209,
-  0x4229, 0x4229, 0x4269, 0x4a6a, 0x424a, 0x424a, 0x424a, 0x424a,
-  0x3a29, 0x3a29, 0x3208, 0x530d, 0x7451, 0x4aac, 0x3a4a, 0x428a,
-  0x426a, 0x3a4a, 0x3a4a, 0x3a6a, 0x3a6a, 0x3a6a, 0x4acc, 0x4acc,
-  0x4aab, 0x428b, 0x530d, 0x530c, 0x5b4d, 0x6bcf, 0x7c51, 0x8492,
-  0x94f3, 0x9d13, 0x9d13, 0x94f2, 0x9d33, 0xa554, 0x94d2, 0x8c91,
-  0x8c71, 0x7c0f, 0x740f, 0x8451, 0x73ef, 0x7c30, 0x8cd2, 0x8cd2,
-  0x8cd2, 0x8cd2, 0x8491, 0x84b2, 0x7c71, 0x84b2, 0x84b2, 0x84d2,
-  0x84d2, 0x84b2, 0x8cf3, 0x8cf3, 0x8d13, 0x84d2, 0x7c91, 0x7c92,
-  0x7c91, 0x7471, 0x7cb2, 0x7471, 0x7471, 0x7471, 0x7471, 0x7471,
-  0x6c30, 0x6c51, 0x6c30, 0x6410, 0x6c51, 0x6c51, 0x6c31, 0x6410,
-  0x6410, 0x63f0, 0x6410, 0x5bef, 0x63f0, 0x5baf, 0x5bcf, 0x5bcf,
-  0x5bcf, 0x5baf, 0x5baf, 0x5baf, 0x5baf, 0x5baf, 0x5bcf, 0x5bf0,
-  0x6410, 0x5bf0, 0x5bf0, 0x5c10, 0x6430, 0x6431, 0x6471, 0x6c71,
-  0x6c71, 0x6c92, 0x6cb2, 0x74d3, 0x7cf3, 0x7d34, 0x8555, 0x8d95,
-  0x95b6, 0x9df6, 0xa637, 0xae98, 0xb6d9, 0xbf1a, 0xcf5b, 0xd77b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7dd, 0xefdc, 0xefdc, 0xe7dc, 0xcf9b,
-  0xbf5b, 0xb73a, 0xd75b, 0xdf5a, 0xf7dc, 0xd73a, 0xa678, 0xb6b9,
-  0x9e38, 0xb678, 0xcef9, 0xa617, 0xd6d9, 0xbe57, 0x9dd6, 0x7d54,
-  0xa5d6, 0xced9, 0x6cf3, 0x7d14, 0x9575, 0xc637, 0x9514, 0x7472,
-  0x7472, 0x84d3, 0xa574, 0xadb4, 0xc636, 0x9533, 0x8d13, 0x6c31,
-  0x8cf2, 0xc656, 0xad74, 0x7431, 0x536e, 0x63ae, 0x8c92, 0x63af,
-  0x4aec, 0x84b2, 0x5b8e, 0x536e, 0x5b8e, 0x530c, 0x530c, 0x530c,
-  0x530c, 0x530c, 0x532c, 0x52ec, 0x426a, 0x636e, 0x428a, 0x4aab,
-  0x31a7, 0x3187, 0x3187, 0x31a7, 0x4208, 0x528a, 0x4a6a, 0x4229,
-  0x4229, 0x426a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4aaa, 0x4a8b, 0x4aab,
-  0x4acc, 0x52ed, 0x4aab, 0x428b, 0x426a, 0x424a, 0x426a, 0x4aab,
-  0x4aab, 0x52ec, 0x73cf, 0x5b0c, 0x3a09, 0x39e8, 0x39e8, 0x3a09,
-  0x4aab, 0x6baf, 0x8492, 0x7c30, 0x73ef, 0x73cf, 0x7c0f, 0x7c30,
-  0x73ae, 0x6bae, 0x634d, 0x632d, 0x634d, 0x4a8a, 0x4229, 0x4a49,
-  0x4229, 0x4208, 0x39c7, 0x4208, 0x39e8, 0x4229, 0x4249, 0x4249,
-  0x4229, 0x4a6a, 0x4249, 0x4a8a, 0x424a, 0x4a8b, 0x426a, 0x3a4a,
-  0x426a, 0x426a, 0x4acc, 0x530d, 0x42ab, 0x3a4a, 0x426a, 0x426a,
-  0x3a29, 0x3a29, 0x424a, 0x3a4a, 0x3a6a, 0x42ab, 0x42ab, 0x42ab,
-  0x532d, 0x63af, 0x638e, 0x5b4d, 0x5b2d, 0x5b4d, 0x638e, 0x73ef,
-  0x94b2, 0xa533, 0x94b2, 0x94d2, 0x94d2, 0x9d13, 0x94d2, 0x8c91,
-  0x8471, 0x7c30, 0x6bae, 0x7c30, 0x7c50, 0x7c50, 0x8cb1, 0x94f3,
-  0x8cd2, 0x8491, 0x8491, 0x8cd2, 0x9513, 0x8d13, 0x8d13, 0x8cd2,
-  0x8d13, 0x84d2, 0x8cd2, 0x8cf3, 0x84d3, 0x8cf3, 0x7cb2, 0x7c92,
-  0x7cb2, 0x7cb2, 0x7c91, 0x7cb2, 0x7491, 0x7471, 0x7471, 0x6c50,
-  0x7451, 0x6c51, 0x6c51, 0x6c30, 0x6c30, 0x6410, 0x6c51, 0x6410,
-  0x6410, 0x5bef, 0x63ef, 0x5bcf, 0x5baf, 0x5baf, 0x5bcf, 0x5bae,
-  0x5bae, 0x5baf, 0x538e, 0x5bcf, 0x5bcf, 0x5bcf, 0x5bcf, 0x5bcf,
-  0x5bcf, 0x5bcf, 0x5bef, 0x5c10, 0x6430, 0x6430, 0x6451, 0x6c92,
-  0x6c92, 0x6c92, 0x6cb2, 0x74d2, 0x7cf3, 0x7d14, 0x8555, 0x8d95,
-  0x95b6, 0x9df6, 0xa637, 0xae98, 0xb6d9, 0xbf1a, 0xcf5b, 0xd77b,
-  0xdfbc, 0xe7dc, 0xf7fe, 0xf7dd, 0xefdc, 0xefdc, 0xe7dc, 0xcf9b,
-  0xbf5b, 0xb73b, 0xcf5b, 0xd75b, 0xf7dc, 0xcf1a, 0xa678, 0xaeb9,
-  0x8df7, 0xb678, 0xc6b9, 0x9e17, 0xd6f9, 0xc677, 0xa5f6, 0x8d55,
-  0x9d95, 0xc6b8, 0x7574, 0x6cf3, 0x9d75, 0xb5f6, 0x8cd2, 0x9514,
-  0x84d3, 0x84d3, 0xa5b5, 0xb5f6, 0xbe36, 0x7cb1, 0x7c92, 0x84b2,
-  0xadd5, 0xb5d5, 0xc637, 0x8492, 0x536e, 0x7c71, 0xadb5, 0x5b8e,
-  0x534d, 0x740f, 0x63cf, 0x5b6d, 0x5b6d, 0x532c, 0x5b8e, 0x5b4d,
-  0x532c, 0x5b4d, 0x530c, 0x52ec, 0x3a29, 0x428a, 0x3a49, 0x4aab,
-  0x31e8, 0x3187, 0x3187, 0x31a7, 0x4229, 0x4a8a, 0x4a6a, 0x4208,
-  0x4229, 0x4249, 0x4a6a, 0x4269, 0x4249, 0x426a, 0x4a8a, 0x42ab,
-  0x8d97, 0x63f0, 0x3a29, 0x424a, 0x3a4a, 0x3a4a, 0x424a, 0x428b,
-  0x42ab, 0x4acc, 0x73ef, 0x634c, 0x3a29, 0x39e8, 0x39e8, 0x3a29,
-  0x636d, 0x9d55, 0x73ef, 0x5b4d, 0x638e, 0x638d, 0x636d, 0x634d,
-  0x52cb, 0x52cb, 0x4a8a, 0x4269, 0x4229, 0x4229, 0x4229, 0x4a6a,
-  0x4a6a, 0x4209, 0x39e8, 0x4209, 0x4a49, 0x4229, 0x4209, 0x4249,
-  0x39e8, 0x3a08, 0x3a08, 0x4a6a, 0x424a, 0x3a09, 0x424a, 0x428b,
-  0x426a, 0x3a4a, 0x426a, 0x428b, 0x3a4a, 0x424a, 0x3a4a, 0x3a29,
-  0x3a29, 0x3a49, 0x3a4a, 0x428b, 0x4aab, 0x42ab, 0x4acc, 0x4aec,
-  0x7472, 0x9d76, 0x638f, 0x532d, 0x6bae, 0x7410, 0x6bcf, 0x73ef,
-  0x8cd2, 0x9513, 0x8cb1, 0x8cb2, 0x94f2, 0x94d2, 0x94d2, 0x94f2,
-  0x8491, 0x7c30, 0x73ef, 0x7c30, 0x8471, 0x8471, 0x8cb2, 0x8cd2,
-  0x8cd2, 0x84b2, 0x84b2, 0x9534, 0x9d75, 0xadd6, 0xa595, 0x8cd2,
-  0x84d2, 0x84d2, 0x84d2, 0x84b2, 0x84f3, 0x7cb2, 0x7cb2, 0x8cf3,
-  0x9534, 0x7c92, 0x7491, 0x7c92, 0x7451, 0x7451, 0x7471, 0x7471,
-  0x6c10, 0x6410, 0x6c10, 0x6c30, 0x63f0, 0x63f0, 0x6410, 0x63f0,
-  0x5bcf, 0x5bf0, 0x5bef, 0x5baf, 0x5baf, 0x5baf, 0x538e, 0x538e,
-  0x538e, 0x5baf, 0x5baf, 0x53af, 0x53ae, 0x53af, 0x5bcf, 0x53af,
-  0x5bcf, 0x5bcf, 0x5bf0, 0x5bf0, 0x6410, 0x6431, 0x6451, 0x6c72,
-  0x6c71, 0x6c92, 0x6cb2, 0x74d3, 0x74f3, 0x7d34, 0x8554, 0x8d75,
-  0x8db6, 0x95f6, 0xa638, 0xae98, 0xb6d9, 0xbf1a, 0xcf5b, 0xd79b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7dd, 0xefdd, 0xefdd, 0xe7bc, 0xc79b,
-  0xbf7b, 0xb73b, 0xc73a, 0xcf3a, 0xefbb, 0xcf3a, 0xa678, 0xae98,
-  0x7596, 0x9e17, 0xb678, 0x95f6, 0xced9, 0xced8, 0xa5f6, 0x9d95,
-  0x9db6, 0xbe77, 0x7d75, 0x64d3, 0xadd6, 0xbe16, 0x9513, 0x9d54,
-  0x8d13, 0x84f2, 0x9553, 0xb5f6, 0xbe37, 0x7cb2, 0x7430, 0x8cf3,
-  0x9d53, 0x9d53, 0xc636, 0x7c92, 0x536e, 0x9513, 0xbe16, 0x536e,
-  0x5b8e, 0x534d, 0x5b8e, 0x534d, 0x5b8e, 0x5b6d, 0x63ae, 0x534d,
-  0x532c, 0x5b4d, 0x532c, 0x4aab, 0x426a, 0x424a, 0x424a, 0x3a29,
-  0x31a7, 0x3187, 0x31a7, 0x4209, 0x4a8a, 0x52aa, 0x52aa, 0x4229,
-  0x3a08, 0x4229, 0x4229, 0x4229, 0x4249, 0x4249, 0x4269, 0x3a49,
-  0x53cf, 0x74d4, 0x31e9, 0x3a4a, 0x428b, 0x426b, 0x424a, 0x426a,
-  0x4aab, 0x530c, 0x6bae, 0x5b2c, 0x3a29, 0x31e8, 0x39e8, 0x4229,
-  0x52ab, 0x4a6a, 0x4229, 0x4aaa, 0x4a8a, 0x5b2c, 0x52cb, 0x4a8a,
-  0x4aaa, 0x52cb, 0x4a8a, 0x52ec, 0x73ef, 0x6b8e, 0x5b0c, 0x52cb,
-  0x4a4a, 0x4a49, 0x4a49, 0x4209, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x4229, 0x3a29, 0x3a09, 0x3a29, 0x3a49,
-  0x3a09, 0x3a09, 0x3a4a, 0x3a6a, 0x3a49, 0x3a4a, 0x3a29, 0x3a4a,
-  0x3a29, 0x424a, 0x3a49, 0x424a, 0x4aac, 0x4aec, 0x532d, 0x6bf0,
-  0x8d34, 0x7451, 0x5b4e, 0x6bcf, 0x8492, 0x7c51, 0x7431, 0x7410,
-  0x84b2, 0x8cd2, 0x8cd2, 0x8471, 0x8cb2, 0x8491, 0x7c30, 0x7c30,
-  0x6bce, 0x6bce, 0x63ae, 0x6bef, 0x8491, 0x7c51, 0x8471, 0x8cf3,
-  0x8cd2, 0x8492, 0x9513, 0x8cd2, 0xa575, 0xdf3b, 0xbe58, 0x8d13,
-  0x84b2, 0x8cf3, 0x84d2, 0x84d2, 0x84f2, 0x84b2, 0x84d2, 0x8d13,
-  0x9d75, 0x7c71, 0x7451, 0x7471, 0x7471, 0x7c92, 0x7471, 0x7471,
-  0x6410, 0x6c30, 0x63ef, 0x63f0, 0x5bcf, 0x5bef, 0x63f0, 0x63ef,
-  0x63ef, 0x5bf0, 0x53af, 0x538e, 0x5baf, 0x538e, 0x538e, 0x538e,
-  0x538e, 0x538e, 0x5bcf, 0x53ae, 0x538e, 0x53af, 0x53cf, 0x5bcf,
-  0x5bcf, 0x5bf0, 0x5bf0, 0x5c10, 0x6431, 0x6410, 0x6431, 0x6451,
-  0x6471, 0x6c71, 0x74b2, 0x74d3, 0x7d13, 0x7d34, 0x8554, 0x8d75,
-  0x8db6, 0x95f6, 0xa658, 0xae99, 0xb6d9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7dd, 0xefdd, 0xefdd, 0xdfbc, 0xc79b,
-  0xbf7b, 0xbf3b, 0xcf3a, 0xcf3a, 0xef9b, 0xcf1a, 0x9e58, 0xae99,
-  0x7596, 0x8dd7, 0xae58, 0x95d7, 0xc6b9, 0xceb8, 0xa5f6, 0xb616,
-  0xadf6, 0xa5f7, 0x7d35, 0x6cd3, 0xa5b5, 0xbe36, 0x9d74, 0x9533,
-  0x9513, 0x9533, 0x9d53, 0xb5b5, 0xb5f6, 0x8d13, 0x7471, 0x9534,
-  0x8cd1, 0xb5b5, 0xc656, 0x6bef, 0x538e, 0xa573, 0xa594, 0x4b4d,
-  0x84b2, 0x6c10, 0x5b6d, 0x532c, 0x532d, 0x5b6d, 0x638e, 0x5b6d,
-  0x532c, 0x5b4d, 0x5b2c, 0x428a, 0x3a49, 0x426a, 0x3a49, 0x3a29,
-  0x31c8, 0x31a7, 0x31a7, 0x4249, 0x52cb, 0x52ab, 0x52aa, 0x4229,
-  0x3a08, 0x4229, 0x4229, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249,
-  0x3a29, 0x4b2d, 0x6c92, 0x5b8f, 0x530d, 0x42ab, 0x424a, 0x426a,
-  0x4aab, 0x52ec, 0x6bce, 0x740f, 0x4a6a, 0x3a09, 0x3a29, 0x4269,
-  0x634d, 0x7c50, 0x634d, 0x6b8d, 0x6b6d, 0x630c, 0x634d, 0x632c,
-  0x5b0c, 0x632d, 0x634d, 0x6b6d, 0x94f3, 0x9d34, 0x5b2c, 0x4a8a,
-  0x4a4a, 0x4229, 0x4a6a, 0x4a8a, 0x4249, 0x39e8, 0x39c8, 0x31c7,
-  0x39e8, 0x39e8, 0x39e8, 0x4229, 0x3a08, 0x3a09, 0x3a09, 0x3a4a,
-  0x3a29, 0x31e9, 0x3a29, 0x3a4a, 0x3a6a, 0x3a6a, 0x4aab, 0x3a29,
-  0x3a29, 0x3a29, 0x426a, 0x428b, 0x42ab, 0x534e, 0x5b8f, 0x6c32,
-  0xa5f7, 0xbe38, 0x63cf, 0x534d, 0x7451, 0x7430, 0x7410, 0x6c10,
-  0x6bcf, 0x6bef, 0x7c51, 0x7430, 0x7410, 0x6c10, 0x6bef, 0x7410,
-  0x6bae, 0x636d, 0x636d, 0x740f, 0x8491, 0x8cd2, 0x84b2, 0x84b2,
-  0x7c71, 0x7430, 0x9534, 0x8d14, 0xc679, 0xffff, 0xbe58, 0x84d2,
-  0x84b2, 0x84d2, 0x7c92, 0x84b2, 0x84d2, 0x7cb2, 0x84d2, 0x7c92,
-  0x7c92, 0x7c91, 0x6c30, 0x7471, 0x7471, 0x7471, 0x7471, 0x6c30,
-  0x63ef, 0x6410, 0x63ef, 0x63ef, 0x5bcf, 0x63f0, 0x63f0, 0x5bcf,
-  0x5bcf, 0x5baf, 0x5baf, 0x5baf, 0x5bae, 0x538e, 0x536e, 0x538e,
-  0x538e, 0x538e, 0x538e, 0x53ae, 0x538e, 0x53af, 0x53af, 0x53af,
-  0x5bcf, 0x5bef, 0x5bef, 0x5c10, 0x5bf0, 0x5c10, 0x6451, 0x6451,
-  0x6c72, 0x6c72, 0x6c92, 0x74b2, 0x7cf3, 0x7d34, 0x8554, 0x8d75,
-  0x8db6, 0x95f6, 0xa637, 0xae98, 0xb6d9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7de, 0xf7dd, 0xefdd, 0xefdd, 0xdfbc, 0xcf9b,
-  0xc77b, 0xc75b, 0xd75b, 0xcf1a, 0xef9b, 0xcf1a, 0x9638, 0xae99,
-  0x7576, 0x8dd7, 0xa638, 0x8db6, 0xbe99, 0xd6d8, 0xb637, 0xadf6,
-  0xb637, 0x8d54, 0x6cd3, 0x7555, 0xa5d5, 0xbe16, 0x9d54, 0x9d74,
-  0x9d74, 0xa5b5, 0xadb4, 0xbe16, 0xa574, 0x9533, 0x6411, 0x7c71,
-  0x9d54, 0xad94, 0xc636, 0x7430, 0x63ef, 0xb5d5, 0x9d53, 0x538e,
-  0xc698, 0x84b2, 0x7430, 0x5b2d, 0x530c, 0x534d, 0x5b4d, 0x5b4d,
-  0x532c, 0x530c, 0x52eb, 0x424a, 0x3a29, 0x3a49, 0x3a69, 0x3a29,
-  0x31c7, 0x31a7, 0x3187, 0x39e8, 0x4249, 0x4a49, 0x4208, 0x39e8,
-  0x3a08, 0x4229, 0x4269, 0x4a8a, 0x4a8a, 0x52ab, 0x4a8a, 0x4269,
-  0x4249, 0x3a4a, 0x7cb3, 0xc6db, 0x9576, 0x638f, 0x426a, 0x428b,
-  0x4a8b, 0x5b0d, 0x8491, 0x7c2f, 0x4249, 0x39e8, 0x39e8, 0x3a29,
-  0x634d, 0x8cb2, 0x7c0f, 0x7c0f, 0x6b8d, 0x634d, 0x630c, 0x632c,
-  0x634c, 0x632c, 0x634d, 0x6b8e, 0x8450, 0xad96, 0x73af, 0x52ab,
-  0x4a6a, 0x4229, 0x4a6a, 0x4aab, 0x4a6a, 0x4a6a, 0x3a08, 0x39e8,
-  0x39e8, 0x39e8, 0x39c8, 0x31e8, 0x31e8, 0x3a09, 0x3a29, 0x3a4a,
-  0x532d, 0x4aed, 0x428b, 0x428b, 0x4aec, 0x4aab, 0x426a, 0x3a29,
-  0x3a29, 0x3a29, 0x424a, 0x426a, 0x4aab, 0x530d, 0x5b6f, 0x5bf3,
-  0xb65a, 0xe75c, 0x6bf0, 0x4b2d, 0x532d, 0x6c10, 0x8492, 0x7410,
-  0x63ae, 0x5b8e, 0x5b8e, 0x63af, 0x6bcf, 0x6bcf, 0x63af, 0x638e,
-  0x638e, 0x7410, 0x7c51, 0x8491, 0x8491, 0x84b1, 0x8cd2, 0x7c71,
-  0x7450, 0x84b2, 0x84b2, 0x8513, 0xcefb, 0xffff, 0xc699, 0x84b2,
-  0x8cf3, 0x84b2, 0x84d2, 0x7c92, 0x7cb2, 0x7c91, 0x7c92, 0x7c71,
-  0x7471, 0x7c92, 0x6c51, 0x6c31, 0x7471, 0x6c30, 0x7471, 0x7491,
-  0x6410, 0x63ef, 0x5bcf, 0x5bcf, 0x63ef, 0x63ef, 0x63cf, 0x63d0,
-  0x5bcf, 0x5bcf, 0x5baf, 0x5bae, 0x538e, 0x536e, 0x536e, 0x536e,
-  0x536e, 0x538e, 0x536e, 0x538e, 0x53af, 0x538e, 0x53af, 0x53af,
-  0x5bcf, 0x5bcf, 0x5bf0, 0x5c10, 0x5bf0, 0x5c10, 0x6451, 0x6451,
-  0x6c71, 0x6c72, 0x6c92, 0x6cb2, 0x74f3, 0x7d14, 0x8554, 0x8d75,
-  0x8db5, 0x95f6, 0xa637, 0xae98, 0xb6d9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7dd, 0xeffc, 0xe7dc, 0xdfbc, 0xcf9b,
-  0xc77b, 0xcf5b, 0xe77b, 0xcf3a, 0xef9b, 0xcf1a, 0x9618, 0xae79,
-  0x7576, 0x85b7, 0x9e18, 0x8db6, 0xbe99, 0xd6d8, 0xbe77, 0xa5d6,
-  0xadf6, 0x7d53, 0x64d3, 0x7534, 0xadd5, 0xb5d5, 0x9554, 0x9d74,
-  0x9d54, 0xadd5, 0xbe37, 0xb5d6, 0x8cd2, 0x8cf3, 0x63f0, 0x84d2,
-  0x9d53, 0xad94, 0xad75, 0x7450, 0x7471, 0xb5d5, 0x84b1, 0x63ef,
-  0xbe15, 0xa594, 0x6bef, 0x5b4d, 0x4aec, 0x5b6d, 0x5b4d, 0x530c,
-  0x532c, 0x5b4d, 0x52eb, 0x3a49, 0x3a49, 0x428a, 0x3a49, 0x3a09,
-  0x31e8, 0x31a7, 0x3187, 0x31a7, 0x39e8, 0x4208, 0x39e8, 0x39e8,
-  0x4228, 0x4249, 0x4aaa, 0x52cb, 0x5aeb, 0x5b0c, 0x52cb, 0x4aaa,
-  0x4a69, 0x4249, 0x42cc, 0x5baf, 0x7cd3, 0x8cf4, 0x4aec, 0x428b,
-  0x52cc, 0x7c31, 0x9513, 0x636d, 0x4a6a, 0x31c8, 0x31a7, 0x3a29,
-  0x6b8f, 0x8471, 0x7c2f, 0x6bae, 0x7c0f, 0x8451, 0x52cb, 0x5aeb,
-  0x5b0b, 0x634d, 0x5b0c, 0x634d, 0x7bf0, 0xad76, 0x8431, 0x4a8a,
-  0x426a, 0x426a, 0x4a8a, 0x4a8a, 0x52cc, 0x426a, 0x4a8a, 0x4249,
-  0x4229, 0x3a29, 0x3a09, 0x3a29, 0x4249, 0x3a29, 0x426a, 0x426a,
-  0x7431, 0x63cf, 0x534d, 0x6c31, 0x7451, 0x428b, 0x426a, 0x3a29,
-  0x3a29, 0x426a, 0x424a, 0x426a, 0x4aab, 0x530d, 0x532e, 0x7cd5,
-  0xd71d, 0x7c92, 0x6c31, 0x5b8e, 0x5b6e, 0x638e, 0x7c72, 0x7c72,
-  0x6c10, 0x534d, 0x4b0c, 0x532d, 0x638f, 0x638e, 0x638e, 0x638e,
-  0x7c71, 0x8cd3, 0x8cb2, 0x8cb2, 0x84b1, 0x8cd2, 0x84b2, 0x7c71,
-  0x7c71, 0x84b2, 0x7c71, 0x7cb2, 0xa5f7, 0xdf5c, 0x9d75, 0x84d3,
-  0x84d3, 0x8d14, 0x84d3, 0x84f3, 0x9555, 0x7c92, 0x7471, 0x7471,
-  0x7471, 0x7472, 0x7471, 0x6c31, 0x6c51, 0x6c51, 0x6410, 0x6410,
-  0x6410, 0x63f0, 0x63ef, 0x63ef, 0x63f0, 0x5bcf, 0x5bcf, 0x63cf,
-  0x5baf, 0x5bcf, 0x5bcf, 0x538e, 0x538e, 0x536e, 0x538e, 0x538e,
-  0x536e, 0x4b4d, 0x536e, 0x53ae, 0x538e, 0x53ae, 0x53ae, 0x53af,
-  0x53cf, 0x5bcf, 0x5bcf, 0x53cf, 0x5bf0, 0x5c10, 0x6431, 0x6451,
-  0x6451, 0x6c71, 0x6c92, 0x6cb2, 0x74d3, 0x7d13, 0x8534, 0x8d75,
-  0x8db6, 0x95f6, 0xa657, 0xae98, 0xb6d9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7dd, 0xefdc, 0xe7dc, 0xdfbc, 0xcf9b,
-  0xc77b, 0xc75a, 0xdf7b, 0xd75b, 0xe79c, 0xcf3b, 0x9e38, 0xae99,
-  0x7596, 0x7db6, 0x9617, 0x8dd7, 0xb678, 0xd6d8, 0xbe77, 0xb617,
-  0xadd6, 0x9dd6, 0x6d14, 0x7514, 0xae16, 0xb5f6, 0x9d95, 0x8d13,
-  0xa574, 0xbdf6, 0xce57, 0xadb6, 0x6c31, 0x7c92, 0x7451, 0x9534,
-  0x84b2, 0x9512, 0x8471, 0x84d2, 0x6c10, 0xb5d5, 0x84b1, 0x7492,
-  0xd6f8, 0xa574, 0x530c, 0x42ab, 0x428a, 0x5b6e, 0x4aeb, 0x4aec,
-  0x532d, 0x5b6d, 0x530c, 0x3a49, 0x424a, 0x426a, 0x3a49, 0x3a09,
-  0x31e8, 0x3a08, 0x39a7, 0x3186, 0x31c7, 0x39c7, 0x39c7, 0x39e8,
-  0x4269, 0x634c, 0x7c30, 0x8450, 0x73ef, 0x636d, 0x634c, 0x632c,
-  0x6b8d, 0x52cb, 0x42ab, 0x530d, 0x5b8f, 0x63f0, 0x6bcf, 0x530d,
-  0x638e, 0x7410, 0x7c30, 0x4a8a, 0x4229, 0x31a7, 0x2987, 0x31c8,
-  0x4a8b, 0x5b0c, 0x6b8e, 0x5b0c, 0x6b6d, 0x73cf, 0x6b8d, 0x6b4d,
-  0x630c, 0x632c, 0x634d, 0x6b8e, 0xadb6, 0xffff, 0xad96, 0x52ec,
-  0x4aab, 0x52cb, 0x4aab, 0x4a8b, 0x4a8b, 0x4a8a, 0x52cc, 0x4a8a,
-  0x3a49, 0x4249, 0x4249, 0x4249, 0x426a, 0x426a, 0x428a, 0x530c,
-  0x52ec, 0x4aab, 0x6c10, 0x7431, 0x4aab, 0x4aab, 0x4aab, 0x4269,
-  0x426a, 0x426a, 0x426a, 0x4a8a, 0x4aab, 0x530d, 0x5b6e, 0x84f4,
-  0xa5b6, 0x63cf, 0x638e, 0x5b8e, 0x63af, 0x63af, 0x6c10, 0x7c92,
-  0x7431, 0x534d, 0x532d, 0x532d, 0x6bf0, 0x6bef, 0x6c0f, 0x8492,
-  0x9513, 0x94f3, 0x8cf3, 0x9513, 0x8cd2, 0x8cd2, 0x84b2, 0x7c71,
-  0x7c71, 0x7c71, 0x7c91, 0x7c92, 0x84f3, 0x9d75, 0x8d34, 0x84d3,
-  0x84f3, 0x84d3, 0x7c92, 0x8d14, 0x84d3, 0x7c92, 0x6c30, 0x7451,
-  0x6c30, 0x6c51, 0x6c10, 0x6410, 0x6c10, 0x6c30, 0x6410, 0x6c51,
-  0x6c51, 0x6410, 0x63f0, 0x5bcf, 0x5bcf, 0x63ef, 0x5baf, 0x5bcf,
-  0x5baf, 0x5baf, 0x5baf, 0x538e, 0x538e, 0x536e, 0x4b4e, 0x536e,
-  0x536e, 0x534d, 0x536e, 0x538e, 0x538e, 0x538e, 0x538e, 0x53ae,
-  0x5bcf, 0x53af, 0x5bcf, 0x5bcf, 0x5bf0, 0x5bf0, 0x6430, 0x6431,
-  0x6451, 0x6c72, 0x6c92, 0x6cb2, 0x74d2, 0x74f3, 0x7d34, 0x8575,
-  0x8db5, 0x95f6, 0xa657, 0xae98, 0xb6d9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7dd, 0xefdc, 0xe7dc, 0xdfbc, 0xcf9b,
-  0xc79c, 0xc73a, 0xe77b, 0xd75b, 0xdf7b, 0xcf1a, 0x9e58, 0xae78,
-  0x7db6, 0x7db6, 0x8dd6, 0x8df7, 0xa637, 0xced8, 0xbe36, 0xbe58,
-  0xadf6, 0x9dd6, 0x6cd4, 0x7d35, 0xadf5, 0xb5f5, 0xa595, 0x7cd2,
-  0xadd6, 0xce78, 0xc657, 0xa595, 0x6410, 0x7c92, 0x7471, 0x7cd2,
-  0x6c0f, 0x7c51, 0x6c10, 0x6c30, 0x6bcf, 0xb5d5, 0x9534, 0x7471,
-  0xdf3a, 0x8471, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a6a, 0x3229, 0x3249,
-  0x428b, 0x4aab, 0x4acb, 0x3a4a, 0x3a6a, 0x426a, 0x424a, 0x3a4a,
-  0x424a, 0x4a6a, 0x4a49, 0x3186, 0x31c7, 0x39c7, 0x39e7, 0x4229,
-  0x5b2c, 0x636d, 0x73ef, 0x94d3, 0x94f3, 0x6bae, 0x632c, 0x632c,
-  0x7bee, 0x52eb, 0x4acb, 0x4aec, 0x532d, 0x5b8e, 0x5b4d, 0x532d,
-  0x5b4d, 0x5b2d, 0x632d, 0x634e, 0x4249, 0x2987, 0x2987, 0x3187,
-  0x31c7, 0x4249, 0x4249, 0x4a8a, 0x5aec, 0x73ae, 0x7bcf, 0x8c71,
-  0x73ae, 0x7bcf, 0x8410, 0x6b6d, 0x740f, 0xa575, 0x94f3, 0x6bae,
-  0x5b2d, 0x52ec, 0x4a8b, 0x4aab, 0x4aab, 0x4aab, 0x52cc, 0x52ec,
-  0x636e, 0x5b4d, 0x4aab, 0x3a49, 0x426a, 0x4aab, 0x428b, 0x6bef,
-  0x5b4d, 0x52cb, 0x634d, 0x5b0d, 0x52cc, 0x52ec, 0x4aaa, 0x4aaa,
-  0x4aaa, 0x4a8a, 0x4a8b, 0x4acb, 0x4aab, 0x530c, 0x530c, 0x532d,
-  0x4b2d, 0x5b6e, 0x63af, 0x638e, 0x6bf0, 0x8d14, 0xa5b6, 0x8cd3,
-  0x638e, 0x63cf, 0x638e, 0x5b4d, 0x7c51, 0x84d2, 0x9533, 0x9553,
-  0x9d54, 0x9d54, 0xa574, 0x9d34, 0x9533, 0x8cf2, 0x8491, 0x7c91,
-  0x84b2, 0x7c91, 0x7c71, 0x7c92, 0x7c72, 0x7c92, 0x84d3, 0x7cb2,
-  0x7cb2, 0x84f3, 0x7471, 0x7492, 0x7471, 0x6c31, 0x6c30, 0x6c30,
-  0x6c10, 0x63cf, 0x63ef, 0x63ef, 0x6410, 0x63ef, 0x63cf, 0x63ef,
-  0x6c51, 0x5bcf, 0x5bcf, 0x5bae, 0x5bcf, 0x5bcf, 0x5baf, 0x5baf,
-  0x5bcf, 0x5baf, 0x538e, 0x538e, 0x538e, 0x538e, 0x4b4d, 0x536e,
-  0x4b4d, 0x536e, 0x536e, 0x538e, 0x4b6e, 0x538e, 0x53ae, 0x53ae,
-  0x53af, 0x53af, 0x53af, 0x5bcf, 0x5bd0, 0x5c10, 0x5c10, 0x6430,
-  0x6451, 0x6471, 0x6c92, 0x74b2, 0x74f3, 0x7513, 0x7d34, 0x8575,
-  0x8db5, 0x95f6, 0xa657, 0xae98, 0xb6f9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7de, 0xefdd, 0xe7dc, 0xdfbc, 0xcf9b,
-  0xc77b, 0xc75b, 0xe79b, 0xdf7b, 0xcf5b, 0xcf3a, 0xb6b9, 0xae79,
-  0x85f6, 0x7db6, 0x9e37, 0x95f7, 0x9e17, 0xc6b8, 0xc677, 0xbe57,
-  0xa5d6, 0x9595, 0x6cd4, 0x7d34, 0xb636, 0xadf5, 0x9d95, 0x8513,
-  0x9d54, 0xbe16, 0xce78, 0x8cf2, 0x6410, 0x7c92, 0x7472, 0x63ef,
-  0x63ef, 0x7430, 0x7c71, 0x63cf, 0x6bf0, 0xc657, 0x84b2, 0x6c30,
-  0xc657, 0x7c30, 0x3a6a, 0x3a6a, 0x4acc, 0x3a8a, 0x3229, 0x3229,
-  0x3209, 0x3209, 0x3a4a, 0x426a, 0x52ab, 0x52ab, 0x4aac, 0x42ab,
-  0x532d, 0x7410, 0x6bae, 0x31c7, 0x39c8, 0x3a08, 0x3a28, 0x4a8a,
-  0x4aaa, 0x5b0c, 0x634d, 0x7410, 0x6bcf, 0x52ec, 0x4a6a, 0x528a,
-  0x5aeb, 0x8491, 0x638d, 0x4acb, 0x532d, 0x5b8e, 0x5b2d, 0x532d,
-  0x530d, 0x634e, 0x6baf, 0x636e, 0x426a, 0x2987, 0x2987, 0x39e8,
-  0x52cb, 0x4a8a, 0x4249, 0x4a69, 0x5aeb, 0x6b4d, 0x738e, 0x634c,
-  0x7c0f, 0x7c0f, 0x73ae, 0x8430, 0x7bef, 0x73ef, 0x8cb2, 0x73ef,
-  0x6b8e, 0x52cb, 0x4aab, 0x428a, 0x4aab, 0x4aab, 0x4aab, 0x5b4d,
-  0x5b2d, 0x7c31, 0x5b0c, 0x428a, 0x4a8a, 0x52cc, 0x5b2d, 0x7410,
-  0x6bcf, 0x5b0c, 0x6b8e, 0x6bae, 0x632d, 0x52cb, 0x5aeb, 0x5b0c,
-  0x52cb, 0x52ec, 0x52ec, 0x52ec, 0x52cc, 0x530c, 0x532d, 0x534d,
-  0x532d, 0x5b6e, 0x5b8e, 0x7c51, 0x7431, 0x6bef, 0x63af, 0x638e,
-  0x5b8e, 0x6c10, 0x7c71, 0x7c71, 0x8492, 0x8cf3, 0x9554, 0xa594,
-  0xadb5, 0xadd5, 0x9d33, 0x9533, 0x9513, 0x8cf3, 0x84d2, 0x84b1,
-  0x84b2, 0x8492, 0x7c91, 0x7c92, 0x7c71, 0x7c92, 0x7cb2, 0x7c91,
-  0x7c92, 0x7cb2, 0x7451, 0x6c31, 0x6c30, 0x6c30, 0x6c51, 0x63f0,
-  0x6c30, 0x6410, 0x6410, 0x63ef, 0x63ef, 0x63cf, 0x63cf, 0x5bcf,
-  0x63ef, 0x5baf, 0x5baf, 0x5bcf, 0x5bcf, 0x5bae, 0x538e, 0x538e,
-  0x5baf, 0x538e, 0x536e, 0x538e, 0x538e, 0x5b8e, 0x536e, 0x538e,
-  0x534e, 0x534d, 0x536e, 0x538e, 0x536e, 0x538e, 0x538e, 0x53af,
-  0x53ae, 0x53cf, 0x5bcf, 0x53af, 0x5bcf, 0x5bf0, 0x5c10, 0x5c30,
-  0x6451, 0x6471, 0x6c92, 0x74b2, 0x74f3, 0x7d13, 0x7d54, 0x8575,
-  0x8db5, 0x95f6, 0xa657, 0xae98, 0xb6f9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7de, 0xf7fd, 0xeffd, 0xe7dc, 0xdf9c, 0xcf9b,
-  0xc77b, 0xc75b, 0xdf9b, 0xcf3b, 0xcf5b, 0xc71a, 0xb6b9, 0xae58,
-  0x8df7, 0x85b6, 0xa638, 0x9e17, 0x9e37, 0xb678, 0xbe77, 0xadf6,
-  0xa5f6, 0xa617, 0x64d3, 0x7513, 0xb636, 0xa5b5, 0x9d95, 0x8513,
-  0xa595, 0xbe16, 0xd6b8, 0x8d13, 0x6c30, 0x63ef, 0x6c30, 0x6410,
-  0x63cf, 0x7c71, 0x9d53, 0x7410, 0x7430, 0x8cb2, 0x7430, 0x5baf,
-  0xe73b, 0xa595, 0x3a4a, 0x3a6a, 0x42ab, 0x3a6a, 0x3229, 0x3229,
-  0x3229, 0x3229, 0x3229, 0x632d, 0x5b0c, 0x5b0c, 0x5b4d, 0x530d,
-  0x5b6e, 0x7451, 0x84b2, 0x632d, 0x4229, 0x4229, 0x4249, 0x4a8a,
-  0x4a8a, 0x4aaa, 0x52cb, 0x52cb, 0x636d, 0x52cb, 0x4a69, 0x52aa,
-  0x73ae, 0xa554, 0x8cf2, 0x6bce, 0x6bef, 0x532d, 0x52cc, 0x4acc,
-  0x638e, 0x5b4d, 0x52ec, 0x422a, 0x39e9, 0x31c8, 0x39c8, 0x530d,
-  0x636e, 0x3a09, 0x4249, 0x4a6a, 0x5b0c, 0x630c, 0x6b4d, 0x632c,
-  0x7baf, 0x6b8d, 0x6b6d, 0x7bef, 0x8c71, 0x7bef, 0x8c71, 0x7c10,
-  0x634d, 0x4a8a, 0x4a8b, 0x426a, 0x4249, 0x4aab, 0x4acb, 0x52cc,
-  0x52ec, 0x530c, 0x5b2d, 0x4a8a, 0x426a, 0x52ec, 0x6bcf, 0x530c,
-  0x530c, 0x530c, 0x634d, 0x634d, 0x632d, 0x52ec, 0x634d, 0x6b6d,
-  0x6b6d, 0x634d, 0x634d, 0x5b2d, 0x52ec, 0x4acb, 0x52ec, 0x532d,
-  0x532c, 0x5b2d, 0x532d, 0x5b4d, 0x636d, 0x5b4d, 0x530c, 0x638e,
-  0x63cf, 0x6c10, 0xadd7, 0xb638, 0x63ef, 0x84b2, 0x9513, 0x9533,
-  0x9d53, 0x9533, 0x94f2, 0x9513, 0x9513, 0x8cf2, 0x8cf2, 0x8cf2,
-  0x84d2, 0x7c92, 0x7c71, 0x7c71, 0x7c71, 0x7c92, 0x7c71, 0x7c92,
-  0x7c92, 0x7451, 0x7451, 0x7451, 0x63f0, 0x63ef, 0x6c30, 0x6c10,
-  0x6410, 0x6410, 0x6410, 0x6c10, 0x63cf, 0x63cf, 0x5bcf, 0x5bcf,
-  0x5baf, 0x5bae, 0x5baf, 0x5bae, 0x5b8e, 0x5baf, 0x63f0, 0x538e,
-  0x536e, 0x536e, 0x536e, 0x534e, 0x536e, 0x536e, 0x536e, 0x536e,
-  0x534d, 0x4b4d, 0x536e, 0x536e, 0x536e, 0x536e, 0x538e, 0x53af,
-  0x538e, 0x53af, 0x53ae, 0x53af, 0x5bcf, 0x5bf0, 0x5c10, 0x6410,
-  0x6431, 0x6471, 0x6c92, 0x6cb2, 0x74d3, 0x7d13, 0x7d34, 0x8575,
-  0x8db6, 0x95f6, 0xa637, 0xae98, 0xb6d9, 0xbf3a, 0xc77b, 0xd79c,
-  0xd7bc, 0xe7dc, 0xfffe, 0xf7fe, 0xeffd, 0xe7dd, 0xdfbc, 0xcf9b,
-  0xc77b, 0xc75a, 0xdf7b, 0xc73a, 0xcf5b, 0xcf1b, 0xb6b9, 0xa618,
-  0x8dd6, 0x85d6, 0xa638, 0x9e37, 0x95f6, 0xae57, 0xbe37, 0xb657,
-  0x9595, 0xae37, 0x6cf3, 0x7533, 0xb637, 0x9554, 0x9554, 0x7c92,
-  0x9534, 0xd6b9, 0xe719, 0x9513, 0x84d2, 0x6bf0, 0x5baf, 0x63f0,
-  0x63cf, 0xa553, 0x8491, 0x6c10, 0x63af, 0xb5b6, 0x9513, 0x4b2d,
-  0x9513, 0x9513, 0x42ab, 0x4acc, 0x42ab, 0x3a6a, 0x3a4a, 0x3229,
-  0x3229, 0x3229, 0x3209, 0x636e, 0x5b4d, 0x5b4d, 0x5b4d, 0x530c,
-  0x5b0c, 0x530c, 0x530c, 0x5b0c, 0x4a49, 0x39e8, 0x3a08, 0x3a08,
-  0x31c7, 0x31c7, 0x39e8, 0x39c7, 0x39e8, 0x4229, 0x4249, 0x4269,
-  0x6b6d, 0x8491, 0x5b8d, 0x5b6d, 0x638e, 0x638e, 0x7c31, 0x9d75,
-  0x5b8e, 0x3a4a, 0x2989, 0x2988, 0x2987, 0x31a8, 0x31a8, 0x31c8,
-  0x31e8, 0x4249, 0x4a6a, 0x630c, 0x6b4d, 0x5aeb, 0x62ec, 0x5aeb,
-  0x6b8e, 0x6b4d, 0x6b6d, 0x5b0c, 0x6b8d, 0x73cf, 0x5b0c, 0x73ae,
-  0x634d, 0x634d, 0x530c, 0x4a8a, 0x4249, 0x3a49, 0x4aab, 0x52ec,
-  0x52ec, 0x63ae, 0x638e, 0x638e, 0x6b8e, 0x6bae, 0x638e, 0x52ec,
-  0x636d, 0x636d, 0x5b2c, 0x634d, 0x632d, 0x5acb, 0x7bcf, 0x7bcf,
-  0x7bef, 0x8c50, 0x8c50, 0x73ce, 0x636d, 0x52eb, 0x5b0c, 0x5b0d,
-  0x5b0c, 0x5b4d, 0x636e, 0x636d, 0x636e, 0x5b2d, 0x52ec, 0x63ae,
-  0x7450, 0x7430, 0xcefc, 0xae59, 0x6c31, 0x84b1, 0x8491, 0x8cd2,
-  0x84b2, 0x84b2, 0x8cd2, 0x8cf2, 0x9513, 0x8d13, 0x84b2, 0x84d2,
-  0x84d2, 0x84d2, 0x7c71, 0x7c71, 0x7c71, 0x7c71, 0x7451, 0x7c72,
-  0x7471, 0x7431, 0x7451, 0x6c30, 0x6c10, 0x6c10, 0x6c10, 0x6c10,
-  0x6410, 0x63cf, 0x6c30, 0x63f0, 0x5bae, 0x5b8e, 0x5b8e, 0x5bae,
-  0x5bcf, 0x5b8e, 0x5b8e, 0x538e, 0x538e, 0x5bcf, 0x538e, 0x536e,
-  0x4b4d, 0x4b4d, 0x536e, 0x4b2d, 0x534d, 0x536e, 0x536e, 0x534e,
-  0x534d, 0x536e, 0x534d, 0x536e, 0x538e, 0x536e, 0x538e, 0x538f,
-  0x53af, 0x53ae, 0x538e, 0x53af, 0x5bcf, 0x5bf0, 0x5bf0, 0x5c10,
-  0x6431, 0x6472, 0x6c92, 0x6cb2, 0x74d3, 0x7d13, 0x7d34, 0x8555,
-  0x8db6, 0x95f6, 0x9e37, 0xae98, 0xb6d9, 0xbf1a, 0xc77b, 0xd79b,
-  0xd7bc, 0xe7dc, 0xffde, 0xf7fe, 0xeffd, 0xe7dd, 0xdfbc, 0xd79b,
-  0xc75b, 0xc75b, 0xef9c, 0xc75b, 0xc73b, 0xcf1b, 0xae99, 0x9617,
-  0x8df7, 0x8df7, 0xa617, 0x95f7, 0x8dd6, 0xa637, 0xb617, 0xae17,
-  0x9dd6, 0xae17, 0x7d34, 0x6cf3, 0xb637, 0x9534, 0x9575, 0x84f3,
-  0x8cf3, 0xc637, 0xdef9, 0x9d53, 0x8491, 0x6bef, 0x536e, 0x5bcf,
-  0x7c50, 0xa574, 0x7430, 0x6c10, 0x5b8e, 0x94f3, 0x9514, 0x536e,
-  0x6bef, 0x6bef, 0x534d, 0x7430, 0x63af, 0x530d, 0x4acb, 0x428a,
-  0x3a4a, 0x3229, 0x3229, 0x636d, 0x52eb, 0x4acb, 0x4a8a, 0x4aaa,
-  0x5aec, 0x5b0c, 0x52cb, 0x5b0c, 0x52ab, 0x31a7, 0x31a7, 0x31a7,
-  0x3187, 0x31a7, 0x31c7, 0x39e8, 0x3a08, 0x4209, 0x4249, 0x4269,
-  0x52eb, 0x31e8, 0x3a08, 0x3a08, 0x3a29, 0x428a, 0x4aab, 0x7c51,
-  0x52ec, 0x2988, 0x29a8, 0x2988, 0x2987, 0x2987, 0x3187, 0x31a7,
-  0x31a7, 0x39e8, 0x3a08, 0x52aa, 0x630c, 0x630c, 0x738e, 0x6b4d,
-  0x630c, 0x6b8e, 0x6b4d, 0x6b8e, 0x634d, 0x73cf, 0x73ae, 0x6b6d,
-  0x73cf, 0x7410, 0x634d, 0x52cc, 0x3a29, 0x3a29, 0x4aab, 0x4a8b,
-  0x52ec, 0x52ec, 0x5b2d, 0x7410, 0x6bae, 0x636d, 0x5b2d, 0x4a8a,
-  0x5b2c, 0x6bae, 0x5b0c, 0x5b2c, 0x632c, 0x6b4d, 0x6b6d, 0x7b8e,
-  0x94b1, 0xad54, 0x9491, 0x7bee, 0x73ae, 0x7bef, 0x632c, 0x5b0c,
-  0x634d, 0x634d, 0x5b2d, 0x5b4e, 0x636e, 0x636e, 0x5b4d, 0x6bef,
-  0x84b2, 0x6c30, 0xae39, 0xae39, 0x7431, 0x84d2, 0x84b1, 0x84b2,
-  0x8cf2, 0x9513, 0x8cf2, 0x8cd2, 0x8cd2, 0x8cd2, 0x8cd2, 0x84b2,
-  0x84b2, 0x84d2, 0x84b2, 0x7451, 0x7c71, 0x7c71, 0x7c92, 0x7451,
-  0x7430, 0x7471, 0x7471, 0x6c31, 0x6c10, 0x6c10, 0x6c10, 0x63cf,
-  0x5baf, 0x5b8e, 0x6c10, 0x6c10, 0x5baf, 0x536e, 0x5b8e, 0x5b8e,
-  0x536e, 0x536e, 0x536e, 0x538e, 0x538e, 0x536d, 0x538e, 0x536e,
-  0x534d, 0x534d, 0x534d, 0x4b4d, 0x4b4d, 0x534d, 0x536e, 0x4b4d,
-  0x4b2d, 0x4b4d, 0x4b4d, 0x534d, 0x4b4d, 0x536e, 0x4b4e, 0x4b6e,
-  0x538e, 0x53af, 0x538e, 0x5bcf, 0x53af, 0x5bcf, 0x5bf0, 0x5c10,
-  0x6431, 0x6451, 0x6c92, 0x6cb2, 0x74d3, 0x74f3, 0x7d34, 0x8555,
-  0x8db6, 0x95f6, 0x9e37, 0xae98, 0xb6d9, 0xbf1a, 0xc75a, 0xd79b,
-  0xd7bc, 0xe7dc, 0xfffe, 0xf7fe, 0xeffd, 0xe7dd, 0xdfbc, 0xd79c,
-  0xc75b, 0xcf7b, 0xefbc, 0xc71a, 0xc71a, 0xcf3b, 0xa699, 0x9637,
-  0x85d7, 0x8df7, 0x9e17, 0x9e17, 0x8df6, 0x9e16, 0xae37, 0x9db6,
-  0x95b5, 0xa5d5, 0x8554, 0x64d3, 0xb616, 0x9554, 0x84f3, 0x9574,
-  0x9d54, 0xbdf6, 0xef7a, 0xc677, 0x8cf2, 0x7c91, 0x5b8e, 0x5bae,
-  0x9513, 0x9d53, 0x5b6e, 0x6bf0, 0x63af, 0x6bcf, 0x7c71, 0x6bef,
-  0x5b6d, 0x534d, 0x536d, 0x8cf3, 0x63af, 0x4aec, 0x5b4d, 0x4b0c,
-  0x42ab, 0x3a6a, 0x428a, 0x4acb, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a6a,
-  0x52cb, 0x52cb, 0x52cb, 0x52eb, 0x4249, 0x31a7, 0x3186, 0x2966,
-  0x3187, 0x39c8, 0x3a08, 0x4229, 0x4a69, 0x4a6a, 0x4249, 0x4269,
-  0x4a8a, 0x39e8, 0x39e8, 0x31e8, 0x29c8, 0x31e8, 0x29c8, 0x2167,
-  0x2987, 0x2987, 0x29a7, 0x2988, 0x2167, 0x2988, 0x2987, 0x2986,
-  0x31a7, 0x31a7, 0x39c8, 0x4208, 0x4a69, 0x5aeb, 0x5aeb, 0x632c,
-  0x5aeb, 0x6b6d, 0x630c, 0x632c, 0x632c, 0x7bef, 0x6b6d, 0x6b8e,
-  0x73cf, 0x5b0c, 0x6bcf, 0x5b2d, 0x4249, 0x4249, 0x4a8b, 0x428a,
-  0x4a8a, 0x4aab, 0x4acc, 0x5b2d, 0x5b2c, 0x52eb, 0x5b0c, 0x52ec,
-  0x634d, 0x6b6d, 0x636d, 0x8450, 0x7bef, 0x73ae, 0x840f, 0x8c2f,
-  0xa4f2, 0xb594, 0xa513, 0x9491, 0x842f, 0x8c50, 0x7bce, 0x7c0f,
-  0x73af, 0x636e, 0x9514, 0x6bcf, 0x5b4d, 0x5b4d, 0x6baf, 0x7410,
-  0x7c71, 0x6c30, 0x8514, 0x7d14, 0x7c71, 0x84b2, 0x7450, 0x7c91,
-  0x8cd2, 0x9533, 0x9513, 0x8cd2, 0x8491, 0x8cd2, 0x8cd2, 0x8cf3,
-  0x7c91, 0x7c71, 0x7c71, 0x7c71, 0x7430, 0x7451, 0x7431, 0x7451,
-  0x7451, 0x7471, 0x6c30, 0x6c30, 0x63f0, 0x63cf, 0x63ef, 0x5baf,
-  0x63cf, 0x5bae, 0x5b8e, 0x5bae, 0x5baf, 0x5b8e, 0x5b8e, 0x536e,
-  0x5b8e, 0x536e, 0x536e, 0x538e, 0x536e, 0x536d, 0x536e, 0x536d,
-  0x4b4d, 0x4b2d, 0x4b4d, 0x4b4d, 0x4b4d, 0x4b4d, 0x4b4d, 0x536e,
-  0x4b2d, 0x534e, 0x534d, 0x4b4d, 0x4b4d, 0x4b6d, 0x4b6e, 0x538e,
-  0x538e, 0x538e, 0x538e, 0x53af, 0x53cf, 0x5bcf, 0x5bf0, 0x5c10,
-  0x5c10, 0x6451, 0x6c72, 0x6cb2, 0x74d3, 0x74f3, 0x7d34, 0x8554,
-  0x8d95, 0x95f6, 0x9e37, 0xae78, 0xb6d9, 0xbf1a, 0xc75b, 0xd79b,
-  0xdfbc, 0xe7dc, 0xf7fe, 0xf7fe, 0xeffc, 0xe7dc, 0xdfbc, 0xd79c,
-  0xc75b, 0xcf7b, 0xefbc, 0xc73a, 0xc71a, 0xc71a, 0x9e58, 0x9e58,
-  0x8df6, 0x85b6, 0x9df7, 0xa637, 0x8e17, 0x95f6, 0xa617, 0x9df6,
-  0x9dd6, 0xa5d5, 0x8554, 0x6492, 0xb616, 0xae17, 0x84d2, 0x9d74,
-  0xa595, 0xbe57, 0xef59, 0xd6d8, 0x94f2, 0x84b2, 0x63f0, 0x5b6e,
-  0x8491, 0x7450, 0x5b6e, 0x6bd0, 0x5b8e, 0x6bcf, 0x7410, 0x7c71,
-  0x7c92, 0x532d, 0x63ae, 0xadd6, 0x5b4d, 0x4aec, 0x532c, 0x530c,
-  0x4aec, 0x4aec, 0x4aec, 0x52ec, 0x4a8a, 0x4a8a, 0x4a8a, 0x4249,
-  0x4a8a, 0x4a69, 0x52cb, 0x634d, 0x5b0c, 0x31c7, 0x2966, 0x2966,
-  0x31a7, 0x39c8, 0x3a09, 0x4229, 0x4249, 0x426a, 0x4249, 0x4a6a,
-  0x4aab, 0x4249, 0x3a09, 0x3a09, 0x3a08, 0x31c8, 0x29a7, 0x2967,
-  0x2967, 0x2987, 0x2987, 0x2187, 0x638f, 0x9515, 0x31c8, 0x2966,
-  0x3186, 0x3187, 0x39e8, 0x4229, 0x4a49, 0x52aa, 0x5aeb, 0x5aeb,
-  0x4aaa, 0x5aeb, 0x632d, 0x5aeb, 0x6b6d, 0x634d, 0x52eb, 0x636d,
-  0x636d, 0x6b8e, 0x5b4d, 0x4269, 0x4249, 0x3a29, 0x3a29, 0x3a29,
-  0x4269, 0x3a6a, 0x428b, 0x4aed, 0x52ec, 0x6b8e, 0x6b8e, 0x636d,
-  0x73cf, 0x8450, 0x632c, 0x73ce, 0x842f, 0x840f, 0x8c30, 0x9cd1,
-  0xad33, 0xb554, 0xbd94, 0xc616, 0xb553, 0x94b1, 0x9470, 0x8c50,
-  0x7c0f, 0x740f, 0x9534, 0x740f, 0x638e, 0x52eb, 0x6bcf, 0x8492,
-  0x84b2, 0x84b2, 0x7c91, 0x7491, 0x84d2, 0x84d2, 0x7c91, 0x8cd2,
-  0x8cd2, 0x8cd2, 0x94f3, 0x9533, 0x8cf2, 0x9554, 0x84d2, 0x84b2,
-  0x7c71, 0x7c51, 0x7451, 0x7430, 0x7451, 0x7430, 0x7451, 0x7430,
-  0x6c10, 0x6c10, 0x6c10, 0x63ef, 0x63cf, 0x5b8e, 0x63cf, 0x5b8e,
-  0x5baf, 0x5b8e, 0x5bae, 0x5b8e, 0x538e, 0x538e, 0x538e, 0x5b8e,
-  0x536e, 0x536e, 0x536e, 0x536d, 0x536d, 0x536e, 0x536e, 0x536d,
-  0x536e, 0x536e, 0x4b4d, 0x4b4d, 0x4b4d, 0x4b4d, 0x4b4d, 0x536e,
-  0x4b2d, 0x4b4d, 0x4b4d, 0x4b2d, 0x536e, 0x538e, 0x538e, 0x538e,
-  0x538e, 0x538e, 0x538e, 0x538f, 0x53af, 0x5bef, 0x5bf0, 0x5c10,
-  0x6431, 0x6451, 0x6c92, 0x6cb2, 0x6cd2, 0x74f3, 0x7d34, 0x8555,
-  0x8d95, 0x95d6, 0x9e37, 0xae98, 0xb6d9, 0xbf1a, 0xc75b, 0xd79b,
-  0xdfbc, 0xe7dc, 0xf7fe, 0xf7fe, 0xeffc, 0xe7dc, 0xdfbc, 0xd79c,
-  0xc75b, 0xcf5b, 0xefbc, 0xcf3a, 0xc73b, 0xbefa, 0x8e58, 0xa678,
-  0xa638, 0x85b6, 0x9617, 0xae57, 0x9e17, 0x95f6, 0xa617, 0x9595,
-  0xa5d6, 0xadf7, 0x9595, 0x74f3, 0xb657, 0x9554, 0x8cf3, 0x9d74,
-  0x9554, 0xc678, 0xf77a, 0xce77, 0x9d53, 0x6c10, 0x63af, 0x63cf,
-  0x740f, 0x6bce, 0x63af, 0x63af, 0x5b8e, 0x63cf, 0x7430, 0x7430,
-  0x7451, 0x5b8e, 0x8cd2, 0xbe36, 0x5b4d, 0x4aec, 0x534d, 0x4b0c,
-  0x5b4d, 0x530c, 0x4aec, 0x4acb, 0x4a8a, 0x4249, 0x4229, 0x4229,
-  0x4a8a, 0x4a8a, 0x4a6a, 0x4a6a, 0x4a8a, 0x39e8, 0x2966, 0x3186,
-  0x31a7, 0x39c8, 0x3a08, 0x4229, 0x4249, 0x4249, 0x4a6a, 0x4a8a,
-  0x52cb, 0x4a8a, 0x4229, 0x3a29, 0x3a49, 0x31e8, 0x2987, 0x2987,
-  0x2167, 0x2967, 0x2167, 0x2166, 0x4aec, 0x7451, 0x39e8, 0x39e8,
-  0x39e8, 0x39c8, 0x39e8, 0x4229, 0x4229, 0x4a69, 0x52aa, 0x52aa,
-  0x4a6a, 0x4a6a, 0x4a8a, 0x52cb, 0x52cb, 0x4aaa, 0x52eb, 0x52ec,
-  0x4aaa, 0x52ec, 0x4a8a, 0x3a29, 0x3a08, 0x3a08, 0x3a08, 0x31e8,
-  0x3a29, 0x426a, 0x532e, 0x9556, 0x5b8f, 0x4aab, 0x5b0c, 0x73cf,
-  0x634d, 0x634d, 0x5b2c, 0x6b8d, 0x8430, 0x9470, 0x9470, 0xb574,
-  0xb594, 0xb574, 0xbdd5, 0xce36, 0xbdb4, 0xb574, 0x9cf2, 0x8c50,
-  0x7bef, 0x7c0f, 0x73ee, 0x8471, 0x8471, 0x8450, 0x7c30, 0x8cd2,
-  0x9d54, 0x9d54, 0x94d2, 0x8492, 0x84d2, 0x7450, 0x7c71, 0x9554,
-  0xb657, 0x84b1, 0x8491, 0x8cd2, 0x9513, 0x8cd2, 0x84d2, 0x7c91,
-  0x7450, 0x7c71, 0x7c91, 0x6bef, 0x7450, 0x6c30, 0x7451, 0x63cf,
-  0x63cf, 0x63af, 0x63af, 0x5b8e, 0x5bae, 0x5bae, 0x536e, 0x536e,
-  0x5bae, 0x5b8e, 0x5b8e, 0x534d, 0x536e, 0x5b8e, 0x536e, 0x536e,
-  0x534d, 0x4b4d, 0x534d, 0x536d, 0x534d, 0x4b2d, 0x536e, 0x4b4d,
-  0x4b4d, 0x4b2d, 0x534d, 0x4b2d, 0x4b4d, 0x4b2d, 0x4b4d, 0x4b2d,
-  0x4b2d, 0x4b4d, 0x4b2d, 0x4b2d, 0x4b4d, 0x536e, 0x4b6e, 0x538e,
-  0x538e, 0x538e, 0x538e, 0x53af, 0x53af, 0x5bcf, 0x5bf0, 0x5c10,
-  0x6431, 0x6451, 0x6c72, 0x6cb2, 0x74d3, 0x74f3, 0x7d34, 0x8555,
-  0x8d95, 0x95f6, 0x9e37, 0xae78, 0xb6d9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xffde, 0xf7de, 0xeffc, 0xe7dc, 0xdfbc, 0xd7bc,
-  0xcf7b, 0xcf5b, 0xef9c, 0xcf3b, 0xbefa, 0xbefa, 0x8e37, 0x9638,
-  0xb679, 0x8db6, 0x85d6, 0xa637, 0x9e17, 0x8dd6, 0x95d6, 0x8d96,
-  0x9db6, 0xa5d7, 0xa5d6, 0x8513, 0xc697, 0x9533, 0xa575, 0xadb5,
-  0x9512, 0xc637, 0xef7a, 0xadb4, 0xc656, 0x9513, 0x5b8e, 0x6bef,
-  0x8471, 0x6bcf, 0x5b6e, 0x5b4e, 0x5b8f, 0x5bae, 0x7c91, 0x7450,
-  0x63af, 0x7410, 0xa595, 0xbe36, 0x530c, 0x4b0c, 0x532c, 0x5b6d,
-  0x5b4d, 0x530c, 0x530c, 0x428a, 0x4a8a, 0x4269, 0x4229, 0x4229,
-  0x4229, 0x4229, 0x3a08, 0x4229, 0x4249, 0x39c7, 0x2966, 0x3187,
-  0x31a7, 0x39c7, 0x39c8, 0x4209, 0x4249, 0x4a49, 0x4a49, 0x4228,
-  0x52eb, 0x5b4d, 0x3a09, 0x3a09, 0x3a08, 0x31e8, 0x39e8, 0x2987,
-  0x2966, 0x2946, 0x2146, 0x2166, 0x2167, 0x3a4a, 0x424a, 0x4a8a,
-  0x4a6a, 0x4a6a, 0x4229, 0x4249, 0x4a49, 0x52aa, 0x528a, 0x4a69,
-  0x4249, 0x4269, 0x4269, 0x4a6a, 0x426a, 0x4269, 0x52cb, 0x4aab,
-  0x4a8a, 0x426a, 0x3a29, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x3a08,
-  0x3a08, 0x428a, 0x5bb0, 0xe79e, 0x8d14, 0x530c, 0x52eb, 0x636d,
-  0x5b2c, 0x634d, 0x8c91, 0x73ce, 0x8c2f, 0xa4f2, 0xad33, 0xbd94,
-  0xb594, 0xb573, 0xce57, 0xc5f5, 0xc616, 0xc616, 0xad53, 0x9491,
-  0x8450, 0x7c0f, 0x8450, 0x94f2, 0x9d12, 0x9d33, 0x9d13, 0xa574,
-  0xb5d5, 0xa554, 0xa575, 0x8cd2, 0x7c91, 0x7c71, 0x7c92, 0x7c71,
-  0xadf6, 0xa5b6, 0x7c71, 0x7c70, 0x8d13, 0x8cf2, 0x7c91, 0x7c91,
-  0x84d2, 0x7450, 0x7450, 0x7430, 0x6c0f, 0x6c30, 0x6bef, 0x63cf,
-  0x6c10, 0x6c30, 0x63cf, 0x5b6d, 0x63cf, 0x5b8e, 0x536e, 0x536e,
-  0x534d, 0x534d, 0x536d, 0x534d, 0x536e, 0x536e, 0x536d, 0x534d,
-  0x536e, 0x4b4d, 0x534d, 0x536e, 0x4b4d, 0x4b4d, 0x536d, 0x534d,
-  0x4b4d, 0x4b2d, 0x534e, 0x4b4d, 0x534d, 0x4b2d, 0x4b2d, 0x4b2d,
-  0x4b2d, 0x4b2d, 0x4b2d, 0x4b0d, 0x4b4d, 0x4b4e, 0x4b6e, 0x4b4e,
-  0x4b6e, 0x4b6e, 0x536e, 0x538f, 0x53af, 0x5bf0, 0x5bf0, 0x5c30,
-  0x6431, 0x6472, 0x6c92, 0x6cb2, 0x74d3, 0x74f3, 0x7d34, 0x8555,
-  0x8d95, 0x95d6, 0x9e37, 0xa677, 0xb6b9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7de, 0xeffc, 0xe7dc, 0xdfbc, 0xdfbc,
-  0xcf7c, 0xcf7b, 0xe79c, 0xd73b, 0xb6fa, 0xaeda, 0xa699, 0x8618,
-  0x9638, 0x8df7, 0x7d75, 0xa637, 0xa637, 0x95f7, 0x9df7, 0x8d96,
-  0x8d96, 0x9596, 0x9575, 0x8554, 0xc698, 0xadd6, 0xbe17, 0xb5f6,
-  0x9d74, 0xb5f5, 0xe73a, 0x94b1, 0xce97, 0xbe16, 0x63cf, 0x7430,
-  0x94f3, 0x6bef, 0x5b4d, 0x5b4e, 0x5b8f, 0x5b8e, 0x8cb2, 0x7c71,
-  0x5b6e, 0x740f, 0x8491, 0xb5f5, 0x534d, 0x532d, 0x532c, 0x534d,
-  0x532d, 0x530c, 0x532d, 0x428a, 0x4aab, 0x426a, 0x4249, 0x3a28,
-  0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x4a6a, 0x39e8, 0x2945, 0x2966,
-  0x3187, 0x31a7, 0x39c8, 0x39e8, 0x4249, 0x4a6a, 0x4249, 0x39e8,
-  0x5b4d, 0xb69a, 0x4acc, 0x31c8, 0x4249, 0x4249, 0x5acb, 0x41e8,
-  0x2946, 0x2946, 0x2146, 0x2146, 0x2166, 0x29a7, 0x426a, 0x4a8a,
-  0x528a, 0x4a8a, 0x4a49, 0x4a49, 0x4a69, 0x528a, 0x528a, 0x4a49,
-  0x4249, 0x4a8a, 0x4a6a, 0x4269, 0x4a8a, 0x4249, 0x4aab, 0x426a,
-  0x3a29, 0x3a29, 0x3a29, 0x4a8a, 0x3a29, 0x31c8, 0x31c7, 0x3a08,
-  0x3a29, 0x4269, 0x4b0c, 0x6410, 0x63ef, 0x6bae, 0x52eb, 0x6bae,
-  0x7c30, 0x6bae, 0x73ce, 0x7bee, 0x9cd2, 0xb594, 0xbdb5, 0xbdb4,
-  0xc5f6, 0xbdd5, 0xc616, 0xc616, 0xce36, 0xce56, 0xc616, 0xad53,
-  0x94b1, 0x73ef, 0x8470, 0xad73, 0xad74, 0xa574, 0xadb5, 0xadb5,
-  0xa554, 0xa574, 0x9d13, 0x84b2, 0x84b2, 0x84b2, 0x8492, 0x84d2,
-  0x84b1, 0x8d13, 0x8cd2, 0x84b1, 0x8cd2, 0x9d54, 0x84b1, 0x7c91,
-  0x7c91, 0x7471, 0x6c10, 0x63cf, 0x63cf, 0x6c0f, 0x6c10, 0x63cf,
-  0x63af, 0x63ef, 0x63cf, 0x5b6e, 0x5baf, 0x534d, 0x536d, 0x536d,
-  0x534d, 0x536d, 0x536d, 0x536d, 0x534d, 0x534d, 0x534d, 0x534d,
-  0x536e, 0x536d, 0x4b2d, 0x4b4d, 0x4b4d, 0x4b4d, 0x536e, 0x4b4d,
-  0x4b2d, 0x4b2d, 0x4b4d, 0x4b2d, 0x4b4d, 0x63f0, 0x534d, 0x4b0c,
-  0x4b2d, 0x4b2d, 0x4b2d, 0x4b2d, 0x4b4d, 0x4b4d, 0x4b4e, 0x4b6e,
-  0x4b6e, 0x536e, 0x536e, 0x4b6e, 0x53af, 0x5bcf, 0x5bf0, 0x5c31,
-  0x6431, 0x6451, 0x6471, 0x6c92, 0x6cd3, 0x74f3, 0x7d34, 0x8575,
-  0x8595, 0x95d6, 0x9e37, 0xa678, 0xb6b9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7fd, 0xeffd, 0xe7dc, 0xdfbc, 0xdfbc,
-  0xcf7b, 0xcf7b, 0xe7bc, 0xd73b, 0xaed9, 0xa699, 0xb6fa, 0x7df7,
-  0x8e18, 0x9618, 0x7575, 0x9e17, 0xb678, 0x9e17, 0x9df7, 0x8575,
-  0x7d34, 0x9595, 0x8555, 0x8d95, 0xae16, 0xadd6, 0xc637, 0xadb5,
-  0x9533, 0xbe15, 0xded8, 0x94d2, 0xce78, 0xdefa, 0x7c91, 0x7430,
-  0x94f3, 0x6bcf, 0x5b6e, 0x534e, 0x5b8f, 0x534e, 0x94f2, 0x9d13,
-  0x636e, 0xc636, 0xa534, 0x8491, 0x63ae, 0x532d, 0x5b4d, 0x5b8e,
-  0x530c, 0x4b0c, 0x530c, 0x4249, 0x426a, 0x4269, 0x4249, 0x3a08,
-  0x31a7, 0x3187, 0x31a7, 0x31a7, 0x39e8, 0x39c8, 0x2966, 0x2966,
-  0x2966, 0x31a7, 0x39e8, 0x4229, 0x4249, 0x4269, 0x4249, 0x4229,
-  0x426a, 0xb618, 0x6bf0, 0x3a09, 0x4aaa, 0x5b0b, 0x632c, 0x528a,
-  0x2966, 0x2125, 0x2146, 0x2146, 0x2946, 0x2987, 0x3a09, 0x4249,
-  0x4a8a, 0x4a8a, 0x4a69, 0x52aa, 0x52aa, 0x52aa, 0x4a6a, 0x4a49,
-  0x4a6a, 0x4269, 0x4a69, 0x4249, 0x4229, 0x3a29, 0x3a28, 0x3a28,
-  0x4249, 0x3a29, 0x3a29, 0x3a29, 0x3a08, 0x3a08, 0x31c8, 0x3208,
-  0x3229, 0x3a49, 0x3a29, 0x3a28, 0x4aaa, 0x4aaa, 0x532c, 0x5b4d,
-  0x632c, 0x6b8d, 0x73ad, 0xa4f1, 0xb594, 0xbdb5, 0xce37, 0xc5f6,
-  0xce37, 0xc636, 0xb5b4, 0xbdb5, 0xce57, 0xce36, 0xce36, 0xb5d5,
-  0x94d2, 0x8470, 0xa574, 0xbe16, 0xc678, 0xbe37, 0xb5d5, 0xb5d5,
-  0xad95, 0xadb5, 0x9513, 0x8cf3, 0x8cf3, 0x8d13, 0x84d2, 0x8491,
-  0x8491, 0x8491, 0x84b1, 0x84d2, 0x8d13, 0x9554, 0x8cd2, 0x7c71,
-  0x7450, 0x7450, 0x6c30, 0x6bef, 0x63ef, 0x63cf, 0x63cf, 0x63ef,
-  0x5b8e, 0x5b8e, 0x5b8e, 0x536d, 0x536d, 0x5b8e, 0x5b6e, 0x534d,
-  0x534d, 0x536e, 0x536d, 0x534d, 0x534d, 0x534d, 0x534d, 0x534d,
-  0x4b2d, 0x534d, 0x534d, 0x534d, 0x534d, 0x4b2d, 0x4b2d, 0x4b2c,
-  0x4b2d, 0x4b2d, 0x4b2d, 0x4b0c, 0x6410, 0x7cd3, 0x4b2d, 0x4b2d,
-  0x4b2d, 0x4b0d, 0x4b2d, 0x4b2d, 0x4b2d, 0x4b4d, 0x4b4d, 0x534e,
-  0x4b4e, 0x4b6e, 0x538e, 0x538e, 0x538f, 0x53af, 0x5bf0, 0x5bf0,
-  0x5c10, 0x6451, 0x6471, 0x6c92, 0x6cb3, 0x74f3, 0x7d34, 0x8555,
-  0x8595, 0x95d6, 0x9e37, 0xa678, 0xb6b9, 0xbf1a, 0xc75a, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7fd, 0xe7fd, 0xe7dc, 0xdfbc, 0xdfbc,
-  0xcf7b, 0xcf7b, 0xe79c, 0xd75b, 0xaeb9, 0x9e79, 0xa699, 0x7617,
-  0x8618, 0x95f7, 0x7db6, 0x95f6, 0xbeb9, 0xae37, 0x8db5, 0x7d54,
-  0x7514, 0x8575, 0x8d76, 0x8555, 0x9574, 0xadd5, 0xce57, 0xa595,
-  0x7cb2, 0xbe16, 0xdef9, 0x7c91, 0xa554, 0xef7b, 0x84b2, 0x7c71,
-  0x7c50, 0x63ae, 0x536e, 0x536e, 0x5b6e, 0x5b6e, 0xa552, 0xa532,
-  0x6bae, 0xd6f8, 0xceb8, 0x638e, 0x532d, 0x63af, 0x5b6d, 0x5b6d,
-  0x4acb, 0x4acc, 0x4aec, 0x4249, 0x4229, 0x3a29, 0x3a08, 0x39e7,
-  0x3187, 0x2966, 0x2966, 0x2966, 0x2966, 0x2966, 0x2986, 0x3187,
-  0x3a08, 0x4249, 0x4a6a, 0x424a, 0x426a, 0x4a8a, 0x4269, 0x4269,
-  0x5aeb, 0x636d, 0x4aab, 0x4a8a, 0x4aaa, 0x5aeb, 0x5aaa, 0x528a,
-  0x39c7, 0x2125, 0x2126, 0x2146, 0x2146, 0x2987, 0x31a8, 0x3a09,
-  0x4a8a, 0x52ab, 0x52ab, 0x52ab, 0x5aec, 0x5acb, 0x4a69, 0x4a49,
-  0x4a8a, 0x4269, 0x4aaa, 0x52ec, 0x4269, 0x4249, 0x4aaa, 0x4269,
-  0x4249, 0x4249, 0x3a29, 0x3a08, 0x3a08, 0x39e8, 0x31e8, 0x31e8,
-  0x3a29, 0x3209, 0x3209, 0x31e8, 0x426a, 0x426a, 0x428a, 0x52cb,
-  0x8450, 0x6b8d, 0x9490, 0xbd94, 0xb533, 0xbdb4, 0xd677, 0xd6b8,
-  0xded9, 0xded9, 0xd698, 0xc616, 0xce57, 0xce36, 0xc616, 0xbe16,
-  0xad54, 0x94d2, 0xb5d6, 0xe75c, 0xe77c, 0xc678, 0xb5d5, 0xb5d6,
-  0xadb5, 0xa575, 0x9d33, 0x9512, 0x9533, 0x9554, 0x9513, 0x8cf2,
-  0x84b2, 0x8491, 0x84b2, 0x7c71, 0x9513, 0x8cf2, 0x7c71, 0x7c91,
-  0x7430, 0x7430, 0x6c0f, 0x63ae, 0x63ef, 0x63ef, 0x63ce, 0x5bae,
-  0x5bae, 0x5bae, 0x5bae, 0x536e, 0x5b6d, 0x534d, 0x4b0c, 0x4b2d,
-  0x532d, 0x4b2d, 0x534d, 0x4b2d, 0x4b2d, 0x4b0c, 0x4b2d, 0x4b2d,
-  0x4b2d, 0x4b0c, 0x532d, 0x4b0d, 0x4b2d, 0x532d, 0x4b4d, 0x4b4d,
-  0x4b2d, 0x4b0d, 0x4b2d, 0x4b0c, 0x4b0c, 0x4b0c, 0x42ec, 0x536e,
-  0x536e, 0x42ec, 0x4b2d, 0x4b2d, 0x4b2d, 0x4b2d, 0x4b2d, 0x4b4d,
-  0x4b4d, 0x4b4e, 0x536e, 0x538e, 0x53af, 0x53af, 0x53cf, 0x5bf0,
-  0x6431, 0x6451, 0x6c72, 0x6c92, 0x6cb2, 0x74f3, 0x7d34, 0x8555,
-  0x8595, 0x95d6, 0x9e17, 0xa678, 0xb6d9, 0xbf1a, 0xc75a, 0xcf9b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7fd, 0xe7fd, 0xe7dc, 0xdfbc, 0xdfbc,
-  0xcf7b, 0xc75b, 0xdf9c, 0xdf5b, 0xb6b9, 0xa699, 0x8657, 0x7e17,
-  0x7dd7, 0x85b6, 0x7d96, 0x8db5, 0xbe98, 0xbe98, 0x95b6, 0x7555,
-  0x6cf4, 0x6d14, 0x8575, 0x8d75, 0x9574, 0xadb5, 0xd697, 0xa5d6,
-  0x74b2, 0xbe16, 0xd697, 0x7c71, 0xc677, 0xdef9, 0x8cf3, 0x6bcf,
-  0x5b6d, 0x638e, 0x5b6e, 0x534d, 0x638e, 0x5b6e, 0xb5f6, 0xbe16,
-  0x5b6d, 0x63ee, 0xa594, 0x532d, 0x42ec, 0x534d, 0x7430, 0x6bf0,
-  0x4acb, 0x4aab, 0x428b, 0x426a, 0x3a29, 0x31c8, 0x31a7, 0x31c7,
-  0x3187, 0x2146, 0x2125, 0x2125, 0x2146, 0x2966, 0x2966, 0x2966,
-  0x52cc, 0x8c92, 0x8c92, 0x6b8e, 0x4a8a, 0x4aaa, 0x52eb, 0x632c,
-  0x634d, 0x634d, 0x5aeb, 0x4a89, 0x4a8a, 0x52ca, 0x528a, 0x5269,
-  0x39c8, 0x2946, 0x2126, 0x2126, 0x2146, 0x2967, 0x2987, 0x39e8,
-  0x4229, 0x4a49, 0x4a8a, 0x52ab, 0x5aeb, 0x4aaa, 0x52aa, 0x4a8a,
-  0x4a8a, 0x4aaa, 0x52eb, 0x52eb, 0x426a, 0x4a8a, 0x4269, 0x4249,
-  0x4249, 0x4249, 0x3a08, 0x3a29, 0x31e8, 0x31c8, 0x31e8, 0x31e8,
-  0x3209, 0x3209, 0x31e9, 0x3a2a, 0x3a29, 0x3a29, 0x426a, 0x4289,
-  0x5b2c, 0x6b4d, 0x9cd1, 0xacf1, 0xb553, 0xc5f5, 0xce57, 0xd6b8,
-  0xef9c, 0xe73a, 0xd6b8, 0xc636, 0xce77, 0xd698, 0xd698, 0xd698,
-  0xbdf6, 0xa554, 0xbe17, 0xdf1b, 0xbe37, 0xb5f6, 0xb5f6, 0xb5d5,
-  0xad95, 0xa574, 0x9d54, 0x9d54, 0x9d54, 0x8cf2, 0x8cf2, 0x8cd2,
-  0x8cd2, 0x84b2, 0x7c91, 0x7c91, 0x7c91, 0x8d13, 0x7c71, 0x7450,
-  0x84b2, 0x6c10, 0x6c0f, 0x5bae, 0x63cf, 0x5bae, 0x5b8e, 0x63cf,
-  0x5b6e, 0x5b8e, 0x5b8e, 0x5b8e, 0x534d, 0x532d, 0x4b0d, 0x4b0d,
-  0x4b0c, 0x4b2d, 0x4b0c, 0x4b0c, 0x534d, 0x532d, 0x4b0d, 0x532d,
-  0x532d, 0x4b0c, 0x532d, 0x4b0c, 0x4b2c, 0x4b2c, 0x534d, 0x534d,
-  0x4b0c, 0x4b0d, 0x4b0d, 0x4b2d, 0x4b0c, 0x430c, 0x430c, 0x4b0c,
-  0x4b0c, 0x4b0c, 0x4b0d, 0x4b0d, 0x4b2d, 0x4b2d, 0x4b2d, 0x4b2d,
-  0x4b6e, 0x538e, 0x4b6e, 0x538e, 0x538e, 0x53af, 0x53cf, 0x53d0,
-  0x5c10, 0x6431, 0x6451, 0x6472, 0x6cb2, 0x74f3, 0x7d34, 0x7d55,
-  0x8d95, 0x95d6, 0x9e17, 0xa678, 0xb6b9, 0xbefa, 0xc75a, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fd, 0xf7fd, 0xe7fd, 0xe7dc, 0xdfbc, 0xdfbc,
-  0xcf7b, 0xc75b, 0xe79c, 0xdf5b, 0xaeb9, 0xaeb9, 0x8e57, 0x9659,
-  0x7dd7, 0x8e17, 0x7d96, 0x95d6, 0xbe77, 0xcef9, 0x95d6, 0x8596,
-  0x64b3, 0x64d4, 0x7d34, 0x9595, 0xa5d5, 0xbe16, 0xd677, 0x9534,
-  0x6472, 0xadd5, 0xce77, 0x8cb2, 0xef5b, 0xce36, 0x7c50, 0x534d,
-  0x63af, 0x63af, 0x5b8e, 0x6bce, 0x84b2, 0x532d, 0xa553, 0xd6b8,
-  0x6bcf, 0x42ec, 0x532c, 0x4aec, 0x430d, 0x534d, 0x8450, 0x638e,
-  0x5b2d, 0x4aab, 0x3209, 0x426a, 0x4249, 0x31e8, 0x2966, 0x3187,
-  0x2966, 0x2125, 0x2125, 0x2125, 0x2966, 0x3a08, 0x4a8a, 0x4229,
-  0x52cb, 0x8471, 0x8451, 0x73ae, 0x6b6d, 0x6b8e, 0x6b4d, 0x6b4d,
-  0x6b6d, 0x6b4d, 0x632c, 0x5acb, 0x52aa, 0x5aeb, 0x5acb, 0x4a69,
-  0x4229, 0x4249, 0x4229, 0x31c8, 0x2987, 0x2966, 0x2987, 0x39e8,
-  0x39e8, 0x4229, 0x4249, 0x4a8a, 0x52ab, 0x52cb, 0x52aa, 0x52cb,
-  0x4aaa, 0x4a8a, 0x5b2c, 0x4aaa, 0x428a, 0x3a49, 0x3a29, 0x4229,
-  0x4249, 0x3a08, 0x31e8, 0x31e8, 0x3208, 0x31e8, 0x31e8, 0x3208,
-  0x31e8, 0x31e8, 0x31e8, 0x3a09, 0x3a2a, 0x3209, 0x3a4a, 0x52cb,
-  0x52eb, 0x73ae, 0x9c90, 0xb512, 0xbd94, 0xc615, 0xd697, 0xdefa,
-  0xef7c, 0xdefa, 0xce77, 0xc5f6, 0xd697, 0xd6b8, 0xd698, 0xce77,
-  0xc637, 0xb5b5, 0xa553, 0xa553, 0xb5b5, 0xad94, 0xb5f6, 0xb5f6,
-  0xad94, 0xadb5, 0xa554, 0x9d33, 0x9d54, 0x9513, 0x94f3, 0x8cd2,
-  0x84b2, 0x7c71, 0x7450, 0x7c91, 0x7c71, 0x7c71, 0x7c92, 0x7450,
-  0x7471, 0x6c30, 0x63ef, 0x63cf, 0x5b8e, 0x63cf, 0x5b8e, 0x5b8e,
-  0x534d, 0x534d, 0x5b6e, 0x534d, 0x532d, 0x532d, 0x4b0d, 0x532d,
-  0x4b0c, 0x532d, 0x4b0c, 0x4b0c, 0x532d, 0x4b2d, 0x532d, 0x534d,
-  0x4b0d, 0x4b0c, 0x4b0c, 0x4b0c, 0x4b0c, 0x4b0c, 0x4b2d, 0x4b0c,
-  0x4b0c, 0x4b0d, 0x4b2d, 0x4b0d, 0x4b0c, 0x4b0c, 0x42ec, 0x42ec,
-  0x42ec, 0x4b0c, 0x4b0d, 0x430c, 0x430c, 0x430d, 0x4b2d, 0x4b2d,
-  0x4b4d, 0x53af, 0x53af, 0x538e, 0x538e, 0x53af, 0x53d0, 0x53f0,
-  0x5c10, 0x5c10, 0x6451, 0x6472, 0x6cb2, 0x74f3, 0x7d34, 0x7d55,
-  0x8d95, 0x95d6, 0x9e37, 0xa678, 0xb6b9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fd, 0xf7fd, 0xe7fc, 0xe7dd, 0xdfbc, 0xdfdc,
-  0xd77c, 0xc73b, 0xe79c, 0xdf7b, 0xaed9, 0xaeb9, 0x9e78, 0x9658,
-  0x75b6, 0x8df7, 0x8db6, 0xa5f7, 0xd719, 0xdf39, 0x95b5, 0x7514,
-  0x6cd4, 0x64b3, 0x7534, 0x9595, 0xb657, 0xadb5, 0xce57, 0x8d14,
-  0x5c31, 0xa594, 0xe719, 0x8471, 0xce77, 0xdf19, 0x6bef, 0x532d,
-  0x63cf, 0x7430, 0x5b4d, 0x63cf, 0x6bef, 0x5b4d, 0xbdf5, 0xbdb4,
-  0x534d, 0x3a8b, 0x42ab, 0x42ec, 0x42ec, 0x4aec, 0xa554, 0xad75,
-  0x636e, 0x3209, 0x29c8, 0x428a, 0x428a, 0x4249, 0x3a08, 0x39e8,
-  0x2966, 0x2146, 0x2966, 0x31c7, 0x4249, 0x4aaa, 0x6b8e, 0x8451,
-  0x7c30, 0x8450, 0x5aeb, 0x4a69, 0x6b6d, 0x6b2c, 0x632c, 0x6b6d,
-  0x6b4d, 0x634d, 0x6b6d, 0x634c, 0x5aeb, 0x6b4c, 0x630c, 0x52aa,
-  0x4a8a, 0x5b2c, 0x6b8e, 0x6b8e, 0x5b0c, 0x4249, 0x3a08, 0x3a08,
-  0x3a08, 0x3a09, 0x4229, 0x4a6a, 0x52ab, 0x52cb, 0x4a8a, 0x52ab,
-  0x4aab, 0x4aab, 0x4acb, 0x4269, 0x4a8a, 0x428a, 0x3a29, 0x4249,
-  0x4249, 0x3a49, 0x3a29, 0x3a29, 0x3208, 0x31e8, 0x3208, 0x31e8,
-  0x31c8, 0x31e8, 0x31e9, 0x31e9, 0x3a29, 0x3229, 0x426a, 0x4a8a,
-  0x52cb, 0x9470, 0xa4d0, 0xacf2, 0xbdb4, 0xc615, 0xd698, 0xf79c,
-  0xf7bd, 0xf79c, 0xd6b8, 0xce37, 0xce77, 0xce57, 0xc636, 0xce57,
-  0xc616, 0xb5b5, 0x9d13, 0x9cf2, 0xa553, 0xb5d6, 0xb5b5, 0xb5d6,
-  0xad94, 0xa574, 0xa595, 0xa595, 0x9d54, 0x9533, 0x9533, 0x8cf2,
-  0x8492, 0x7450, 0x7451, 0x7c91, 0x7450, 0x7430, 0x6c0f, 0x6c30,
-  0x6c10, 0x6c10, 0x6c30, 0x5b8e, 0x5b6d, 0x5b8e, 0x5b6e, 0x5b8e,
-  0x534d, 0x536d, 0x534d, 0x4b0d, 0x4b2d, 0x534d, 0x4b0c, 0x4b0c,
-  0x4aec, 0x4b0c, 0x532d, 0x534d, 0x4b0c, 0x4b0c, 0x4aec, 0x4aec,
-  0x4b0c, 0x4b0c, 0x4aec, 0x4b0c, 0x4aec, 0x4b0c, 0x4b0c, 0x42ec,
-  0x4b0d, 0x4b0c, 0x42ec, 0x4b0d, 0x42ec, 0x42ec, 0x4b0c, 0x42ec,
-  0x430c, 0x4b0d, 0x42ec, 0x4b0c, 0x4b0c, 0x430d, 0x4b2d, 0x4b2d,
-  0x4b2d, 0x4b6e, 0x53af, 0x53af, 0x538e, 0x53af, 0x53cf, 0x5bf0,
-  0x5c11, 0x5c10, 0x6451, 0x6472, 0x6c92, 0x6cd2, 0x7513, 0x7d54,
-  0x8d95, 0x95d6, 0x9e37, 0xa678, 0xb6b9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7fd, 0xeffc, 0xe7dd, 0xdfdc, 0xdfbc,
-  0xd79c, 0xbf1a, 0xdf7c, 0xe7bc, 0xaed9, 0xaeb9, 0xa698, 0x7dd7,
-  0x75d6, 0x8e17, 0x8dd6, 0xae37, 0xe75a, 0xe75a, 0xadf6, 0x74f3,
-  0x64b3, 0x64b3, 0x6cd3, 0x9d95, 0xb636, 0x9553, 0xc657, 0x84f3,
-  0x5c32, 0x9513, 0xef5a, 0x9533, 0xb5d5, 0xe739, 0x7410, 0x534d,
-  0x536e, 0x8492, 0x636e, 0x534d, 0x4b0c, 0x5b6e, 0xce97, 0xadb4,
-  0x4aed, 0x3a8b, 0x4aec, 0x42cc, 0x3acc, 0x5b4d, 0xbdf5, 0x8c91,
-  0x4aec, 0x29e8, 0x29a8, 0x530c, 0x4acb, 0x426a, 0x4229, 0x39e8,
-  0x39e8, 0x4249, 0x4aab, 0x5b0c, 0x6b8e, 0x7c0f, 0x7c30, 0x8c91,
-  0x9cf2, 0x94b1, 0x7bee, 0x6b4c, 0x736d, 0x736d, 0x6b4c, 0x6b4c,
-  0x6b6d, 0x73ae, 0x7bef, 0x738d, 0x6b6d, 0x7bce, 0x6b6c, 0x5aca,
-  0x528a, 0x52ab, 0x52ec, 0x636e, 0x6bae, 0x6b8d, 0x5b0c, 0x4a8a,
-  0x4249, 0x4229, 0x4249, 0x4a6a, 0x52ab, 0x4a8a, 0x4a8a, 0x426a,
-  0x428a, 0x428a, 0x4aab, 0x3a49, 0x3a49, 0x3a49, 0x426a, 0x4249,
-  0x4249, 0x4aab, 0x4269, 0x3a08, 0x3208, 0x3208, 0x31e8, 0x31e8,
-  0x31e8, 0x29c8, 0x3a8c, 0x42ac, 0x3229, 0x3a6a, 0x426a, 0x634d,
-  0x73ae, 0x7bce, 0x9c8f, 0xacf1, 0xb573, 0xc616, 0xd698, 0xe71b,
-  0xef7c, 0xef7c, 0xdef9, 0xd6b8, 0xce77, 0xce77, 0xce37, 0xc637,
-  0xc636, 0xb5b5, 0x94f2, 0x9cf2, 0x94d1, 0xa553, 0xadb5, 0xad94,
-  0xb5d6, 0xb5f6, 0xa595, 0x9d74, 0x9d54, 0x8d12, 0x84b1, 0x84b2,
-  0x84b2, 0x7c50, 0x7c51, 0x7430, 0x7451, 0x6c10, 0x6bef, 0x6c30,
-  0x6bef, 0x6bf0, 0x63cf, 0x5b8e, 0x5b8e, 0x63ae, 0x5b8e, 0x5b6e,
-  0x4b0c, 0x4b2d, 0x4b2d, 0x536e, 0x532d, 0x4b0d, 0x4aec, 0x4aec,
-  0x4aec, 0x4b0c, 0x534d, 0x4b2d, 0x4b0c, 0x4b0c, 0x4aec, 0x4b0c,
-  0x4b0c, 0x4aec, 0x42cb, 0x4aec, 0x4aec, 0x4aec, 0x4b0c, 0x4aec,
-  0x4b0c, 0x42ec, 0x4b0c, 0x4b0c, 0x42ec, 0x42ec, 0x4b0c, 0x42ec,
-  0x42ec, 0x430c, 0x4b0c, 0x4b0d, 0x4b0c, 0x4b0d, 0x4b2d, 0x4b2d,
-  0x4b4d, 0x4b4d, 0x4b6e, 0x4b6e, 0x538e, 0x53af, 0x53cf, 0x5bcf,
-  0x5bf0, 0x5c10, 0x6431, 0x6492, 0x6cb2, 0x6cd3, 0x74f3, 0x7d54,
-  0x8595, 0x95d6, 0x9e37, 0xa678, 0xaeb9, 0xbf1a, 0xc75b, 0xcf9b,
-  0xd7bc, 0xe7dc, 0xf7fe, 0xf7fd, 0xeffc, 0xe7dc, 0xdfdc, 0xd7bc,
-  0xdf9c, 0xbf1a, 0xdf7c, 0xefbc, 0xaed9, 0xae99, 0xa698, 0x85f7,
-  0x7df7, 0x8e17, 0x95d6, 0xae36, 0xe77a, 0xe739, 0xdf3a, 0x74f3,
-  0x5c72, 0x64b3, 0x6493, 0xd6f9, 0xadd5, 0x9d54, 0xb5f5, 0x7cf2,
-  0x5c52, 0x9553, 0xce97, 0xa573, 0x9d54, 0xd6b8, 0x7c50, 0x536e,
-  0x534d, 0x94f3, 0x7410, 0x4aec, 0x4aec, 0x4aec, 0xbdf5, 0x94d2,
-  0x3a8b, 0x3a8b, 0x42ac, 0x42ac, 0x42cc, 0x638d, 0xad74, 0x6bae,
-  0x3209, 0x29c9, 0x21c8, 0x6c10, 0x63af, 0x532d, 0x4229, 0x39e8,
-  0x4249, 0x4acb, 0x532c, 0x638e, 0x7c0f, 0x8430, 0x8c70, 0xa533,
-  0xad33, 0x9cb1, 0x8c2f, 0x83ee, 0x738d, 0x7bad, 0x736d, 0x6b8d,
-  0x73ad, 0x738d, 0x7bce, 0x73ce, 0x840f, 0x840f, 0x73ad, 0x6b2c,
-  0x5aeb, 0x4228, 0x2967, 0x3187, 0x4a8b, 0x5b2d, 0x6b8e, 0x632c,
-  0x52ab, 0x52ab, 0x4a8a, 0x52cb, 0x52cb, 0x4a8a, 0x4aab, 0x5b4d,
-  0x4aab, 0x42aa, 0x428a, 0x3a4a, 0x428a, 0x3a49, 0x3a49, 0x3a29,
-  0x3a29, 0x3a49, 0x3a29, 0x3a29, 0x3a08, 0x3a08, 0x4aab, 0x3a29,
-  0x3a09, 0x29e9, 0x5b90, 0x7cd4, 0x3229, 0x3a49, 0x3a49, 0x632c,
-  0x73ce, 0x7bce, 0x942f, 0xa4d1, 0xad32, 0xc616, 0xdefa, 0xef9d,
-  0xffde, 0xef9c, 0xded9, 0xce77, 0xce57, 0xce77, 0xce37, 0xc616,
-  0xc636, 0xad94, 0x8470, 0x94b1, 0x8cb1, 0x94f2, 0xad95, 0xb5d6,
-  0xadb5, 0xb5d5, 0xadb5, 0x9d54, 0x9513, 0x9533, 0x8cd2, 0x8491,
-  0x8492, 0x7c71, 0x7c71, 0x7410, 0x6c10, 0x6bef, 0x6bef, 0x63ef,
-  0x63ef, 0x63af, 0x5b8e, 0x5b6e, 0x63cf, 0x5b8e, 0x5b6e, 0x532d,
-  0x536d, 0x4b2d, 0x534d, 0x5b6e, 0x532d, 0x4aec, 0x4aec, 0x4b0c,
-  0x4b0c, 0x4b0c, 0x4b0c, 0x4b0c, 0x4aec, 0x4b0c, 0x4b0c, 0x4b0c,
-  0x4b0c, 0x42cb, 0x4aec, 0x4aec, 0x4b0c, 0x4aec, 0x42ec, 0x4aec,
-  0x42cc, 0x4aec, 0x4b0c, 0x430c, 0x42ec, 0x42ec, 0x42ec, 0x42cc,
-  0x42ec, 0x42ec, 0x430c, 0x4b2d, 0x4b2d, 0x4b0d, 0x4b2d, 0x4b4d,
-  0x4b4d, 0x4b4e, 0x538e, 0x4b6e, 0x4b6e, 0x538e, 0x53cf, 0x5bf0,
-  0x5bf0, 0x5c10, 0x6451, 0x6471, 0x6c92, 0x6cd3, 0x74f3, 0x7d54,
-  0x8595, 0x95d6, 0x9e37, 0xa678, 0xaeb9, 0xb6fa, 0xc75b, 0xcf9b,
-  0xd7bc, 0xdfdc, 0xf7fe, 0xf7fd, 0xeffc, 0xe7fc, 0xdfdc, 0xd79b,
-  0xdf9c, 0xbf3b, 0xcf5b, 0xef9b, 0xb6d9, 0xae99, 0xa698, 0x75d6,
-  0x85f7, 0x8df7, 0x95f6, 0xae17, 0xdf19, 0xef7a, 0xd719, 0x8555,
-  0x5c72, 0x64d3, 0x6472, 0xb657, 0xadb5, 0x9d53, 0x9d53, 0x9d95,
-  0x6472, 0x9554, 0xb5d5, 0xb5f6, 0x9512, 0xce77, 0xb5b5, 0x63cf,
-  0x536e, 0x94f2, 0x73ef, 0x4b0d, 0x42ec, 0x6bef, 0xd6b7, 0x9d53,
-  0x326a, 0x3a8b, 0x3a6b, 0x3a8b, 0x4acc, 0x3249, 0xb5d5, 0xce78,
-  0x3a8b, 0x21c8, 0x21a8, 0x7451, 0x63af, 0x63ae, 0x4269, 0x4229,
-  0x52ec, 0x530c, 0x5b6d, 0x6bcf, 0x7c10, 0x8c70, 0x94d2, 0x9cb1,
-  0x9450, 0x8c0f, 0x9490, 0x842f, 0x738d, 0x73ad, 0x6b6d, 0x6b4c,
-  0x630c, 0x738d, 0x842f, 0x842f, 0x842f, 0x8c6f, 0x842e, 0x73ad,
-  0x52aa, 0x2966, 0x2126, 0x31a8, 0x4a8b, 0x52ab, 0x6b6d, 0x6b8d,
-  0x630c, 0x6b6d, 0x634d, 0x634d, 0x52eb, 0x4aab, 0x4acb, 0x5b4d,
-  0x4acb, 0x428a, 0x3a49, 0x428a, 0x3a49, 0x3a29, 0x3a49, 0x4aab,
-  0x4aab, 0x4a8a, 0x3a49, 0x3a49, 0x4269, 0x4acb, 0x5b2d, 0x52eb,
-  0x52ab, 0x4acc, 0x2aad, 0x22ad, 0x3a8b, 0x426a, 0x52eb, 0x73ce,
-  0x944f, 0x944f, 0x8bee, 0xa4b0, 0xb553, 0xce57, 0xe71b, 0xffff,
-  0xffff, 0xef9c, 0xd6b8, 0xce57, 0xce57, 0xc637, 0xc616, 0xbdf5,
-  0xc616, 0xbdf6, 0xad74, 0x94f2, 0x9d12, 0xa553, 0xad94, 0xadb5,
-  0xadb5, 0xadb5, 0xa574, 0x9d54, 0x9513, 0x9533, 0x84b2, 0x84b2,
-  0x84b2, 0x7c51, 0x7450, 0x7430, 0x6bef, 0x63cf, 0x63cf, 0x63ae,
-  0x5bae, 0x5b8e, 0x5bae, 0x5b8e, 0x5bae, 0x5b6e, 0x534d, 0x534d,
-  0x534d, 0x532d, 0x4b0d, 0x4aec, 0x4aec, 0x4aec, 0x4b0c, 0x4aec,
-  0x4b0c, 0x4b0d, 0x4b0c, 0x4b0c, 0x4b0c, 0x4aec, 0x42cc, 0x42cb,
-  0x4aec, 0x42cb, 0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x42ec, 0x4aec,
-  0x4aec, 0x4aec, 0x42ec, 0x42ec, 0x4b0c, 0x42ec, 0x42ec, 0x42ec,
-  0x42cc, 0x42ec, 0x42ec, 0x42ec, 0x4b0c, 0x4b0d, 0x4b2d, 0x4b2d,
-  0x4b2d, 0x4b4e, 0x4b6e, 0x4b6e, 0x538e, 0x538e, 0x53af, 0x5bcf,
-  0x5bd0, 0x5c10, 0x6431, 0x6451, 0x6c92, 0x6cd2, 0x74f3, 0x7d54,
-  0x8595, 0x95d6, 0x9e37, 0xa678, 0xaeb9, 0xb6fa, 0xc75b, 0xcf7b,
-  0xd7bc, 0xdfdc, 0xf7fe, 0xf7fd, 0xeffd, 0xe7dc, 0xdfdc, 0xdfbc,
-  0xe7dc, 0xbf3b, 0xc73b, 0xe79b, 0xbef9, 0xa6b9, 0x9e78, 0x75f7,
-  0x75d6, 0x8e17, 0x8dd6, 0xae37, 0xc677, 0xdf18, 0xdf5a, 0x8575,
-  0x64d3, 0x7d34, 0x6cb2, 0xa5b5, 0xadd5, 0x9d94, 0x8d13, 0x9574,
-  0x7492, 0x9533, 0xa574, 0xadb5, 0x9d54, 0xa574, 0xc637, 0x63ce,
-  0x63cf, 0xbe36, 0x9d33, 0x5b8e, 0x42ec, 0x7430, 0xded7, 0x94f2,
-  0x3aab, 0x326b, 0x324a, 0x3a6b, 0x42cc, 0x29e9, 0x9d33, 0xce99,
-  0x5b4e, 0x29e9, 0x29e8, 0x6bcf, 0x4aab, 0x426a, 0x428a, 0x3a08,
-  0x31c7, 0x31c7, 0x4229, 0x5b2d, 0x73ef, 0x8c91, 0x9491, 0x9470,
-  0x8bef, 0x840f, 0x94b1, 0x8c50, 0x7bce, 0x738d, 0x6b6d, 0x5aeb,
-  0x6b4c, 0x8450, 0x8c70, 0x8c4f, 0x842f, 0x94b0, 0x8c6f, 0x6b8d,
-  0x39e9, 0x2967, 0x424a, 0x632d, 0x634d, 0x5b0c, 0x6b6d, 0x738d,
-  0x5b0b, 0x5aeb, 0x5aeb, 0x5b0c, 0x530c, 0x4aaa, 0x3a6a, 0x3a6a,
-  0x42cb, 0x3a6a, 0x3a49, 0x3a29, 0x3a49, 0x428b, 0x3a49, 0x426a,
-  0x4acb, 0x5b4d, 0x4aaa, 0x52eb, 0x4acb, 0x636d, 0x8c91, 0x8c50,
-  0x9490, 0xad74, 0x434e, 0x3b2d, 0x73f0, 0x7bef, 0x9490, 0x9cb0,
-  0xacf1, 0xa4b0, 0x9c6f, 0xad12, 0xad32, 0xc616, 0xe73a, 0xf79c,
-  0xef5b, 0xe73b, 0xd698, 0xce57, 0xce57, 0xc637, 0xc616, 0xc616,
-  0xc636, 0xc616, 0xb595, 0xa553, 0xa554, 0xa574, 0x9d33, 0xadb5,
-  0xa575, 0xa574, 0x9d54, 0x9d54, 0x9513, 0x8cf2, 0x84b2, 0x84b2,
-  0x84b2, 0x7c71, 0x7450, 0x6c30, 0x63cf, 0x63cf, 0x63ce, 0x63ae,
-  0x5b8e, 0x534d, 0x536d, 0x5b8e, 0x5b6e, 0x536e, 0x534d, 0x5b6e,
-  0x4b0d, 0x4b0d, 0x4b0d, 0x4b0c, 0x42cc, 0x4b0d, 0x4aec, 0x4aec,
-  0x42cc, 0x42cb, 0x4aec, 0x4b0c, 0x42cb, 0x4aec, 0x42cc, 0x4aec,
-  0x4aec, 0x42cb, 0x42cc, 0x4aec, 0x4aec, 0x42cb, 0x42cc, 0x42cb,
-  0x4aec, 0x42ec, 0x42ec, 0x42cc, 0x4aec, 0x42ec, 0x42cc, 0x42cc,
-  0x42cb, 0x42ec, 0x42ec, 0x4b0c, 0x42ec, 0x4b0d, 0x4b0d, 0x4b2d,
-  0x4b2d, 0x4b4e, 0x4b4e, 0x536e, 0x538e, 0x538e, 0x53af, 0x53cf,
-  0x5bd0, 0x5bf0, 0x5c31, 0x6451, 0x6472, 0x6cb2, 0x74f3, 0x7d34,
-  0x8575, 0x8dd6, 0x9617, 0xa658, 0xaeb9, 0xb6fa, 0xc75b, 0xcf9b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7dd, 0xdfdc, 0xdfbc,
-  0xe7dc, 0xbf1a, 0xbf1b, 0xe79c, 0xbed9, 0xa6b9, 0x9e99, 0x75f7,
-  0x75d6, 0x8df7, 0x7dd6, 0x9e17, 0xb657, 0xdf39, 0xf7bb, 0x95b5,
-  0x8574, 0x8554, 0x7d14, 0x9d74, 0x9533, 0x84f2, 0x84f3, 0x9534,
-  0x7cb2, 0x8cd2, 0x9d13, 0xad94, 0xa574, 0x8cd2, 0x9d13, 0x7450,
-  0x63cf, 0xdf3a, 0xad94, 0x63ce, 0x4b0d, 0x5b6d, 0xe719, 0x94f2,
-  0x326a, 0x324a, 0x324a, 0x324a, 0x324a, 0x29e9, 0x7c30, 0xa554,
-  0x42ab, 0x322a, 0x3a4a, 0x530c, 0x4a8a, 0x4a6a, 0x4249, 0x39e8,
-  0x3186, 0x2966, 0x2966, 0x4a8a, 0x7c10, 0x8cb1, 0x9cd2, 0x9470,
-  0x8c30, 0x83ee, 0x842f, 0x842f, 0x7bce, 0x738d, 0x632c, 0x6b4c,
-  0x840f, 0x9491, 0x9490, 0x8c4f, 0x9470, 0x8c6f, 0x7bee, 0x5aeb,
-  0x52ab, 0x632d, 0x73ae, 0x73ce, 0x73ce, 0x6b8d, 0x6b4d, 0x6b6d,
-  0x5aeb, 0x52ab, 0x52eb, 0x5b2c, 0x4acb, 0x3a49, 0x3a6a, 0x4b4e,
-  0x3acc, 0x42ac, 0x4aab, 0x428a, 0x428a, 0x4aab, 0x42ab, 0x428a,
-  0x530c, 0x5b6d, 0x6bae, 0x636d, 0x4aab, 0x7c30, 0xad75, 0xa4f2,
-  0xa4d1, 0xa512, 0x7c51, 0x8450, 0x9c91, 0xa4f1, 0xad32, 0xad52,
-  0xb553, 0xb553, 0xb553, 0xad32, 0xad53, 0xbdf6, 0xce77, 0xded9,
-  0xdf19, 0xd6b9, 0xce57, 0xc637, 0xce37, 0xc636, 0xc616, 0xbe16,
-  0xc616, 0xbdf6, 0xb594, 0xb5d5, 0xad95, 0xadb5, 0xa574, 0xad95,
-  0xad95, 0xb5d6, 0xa554, 0x9d54, 0x9513, 0x8cd2, 0x8cd2, 0x84b2,
-  0x8492, 0x7450, 0x6c10, 0x6bcf, 0x63ce, 0x63cf, 0x63ce, 0x5b8e,
-  0x536d, 0x5b8e, 0x5b6e, 0x5b8e, 0x534d, 0x532d, 0x534d, 0x536e,
-  0x4b0d, 0x4b2d, 0x4b0c, 0x4aec, 0x42cc, 0x42cc, 0x42cc, 0x42ab,
-  0x42cc, 0x42cb, 0x4aec, 0x42cc, 0x4aec, 0x42ec, 0x4aec, 0x42cb,
-  0x42cb, 0x42ab, 0x42cb, 0x42cc, 0x4aec, 0x42cb, 0x42cb, 0x4aec,
-  0x42ec, 0x42ec, 0x42ec, 0x42ec, 0x42cc, 0x4b0d, 0x42cc, 0x42cc,
-  0x4aec, 0x42ec, 0x42cc, 0x4b0c, 0x42ec, 0x430c, 0x4b2d, 0x4b2d,
-  0x4b2d, 0x4b4d, 0x536e, 0x4b6e, 0x536e, 0x538e, 0x53af, 0x53cf,
-  0x5bf0, 0x5c10, 0x6431, 0x6451, 0x6c72, 0x6cb2, 0x74f3, 0x7534,
-  0x8575, 0x8db6, 0x9e17, 0xa658, 0xaeb9, 0xb6fa, 0xc75b, 0xcf7b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfdc, 0xd7bb,
-  0xe7dc, 0xb71a, 0xbf1b, 0xdf9c, 0xbef9, 0xaed9, 0x9678, 0x75f7,
-  0x75d6, 0x8df7, 0x75b5, 0x85b6, 0xb657, 0xf7bc, 0xf79b, 0x8d95,
-  0x8d74, 0x74d3, 0x8534, 0x9d75, 0x9554, 0x7cd2, 0x84f3, 0xadb5,
-  0x9534, 0x9d54, 0x9d33, 0xb616, 0x9d33, 0x8cd2, 0x94f2, 0x6c50,
-  0x63ef, 0xdf19, 0x9d12, 0x534c, 0x4b2d, 0x532d, 0xd698, 0xa554,
-  0x326a, 0x326b, 0x324a, 0x324a, 0x322a, 0x2a09, 0x7410, 0x9d13,
-  0x3a6a, 0x3a4a, 0x3a6a, 0x52eb, 0x4a8a, 0x4229, 0x4228, 0x4208,
-  0x3186, 0x2945, 0x3186, 0x630c, 0x7c10, 0x8450, 0x842f, 0x8c50,
-  0x9470, 0x83ee, 0x7bee, 0x83ef, 0x7bcf, 0x73ae, 0x6b4c, 0x7bef,
-  0x8c70, 0x8c4f, 0x8c4f, 0x8c70, 0x8c4f, 0x842e, 0x73ad, 0x73ae,
-  0x7bef, 0x7bef, 0x73ae, 0x6b8e, 0x6b8d, 0x634d, 0x6b6d, 0x6b6d,
-  0x632c, 0x52aa, 0x52cb, 0x52ec, 0x530d, 0x3208, 0x2a09, 0x434e,
-  0x6452, 0x324a, 0x3a6a, 0x4acc, 0x428a, 0x42cb, 0x532d, 0x534e,
-  0x536d, 0x534d, 0x63ae, 0x6bce, 0x740f, 0x8c92, 0xbdd6, 0xc5f5,
-  0xbd94, 0x9cd1, 0xad32, 0xad32, 0xad52, 0xbdb4, 0xbdb4, 0xbdb4,
-  0xb594, 0xb574, 0xb553, 0xbdb4, 0xb594, 0xbdd5, 0xce57, 0xd678,
-  0xd698, 0xce57, 0xce57, 0xc616, 0xc636, 0xc657, 0xbdf6, 0xbdf6,
-  0xbe16, 0xbdf6, 0xb5d5, 0xb5d6, 0xad95, 0xadb5, 0xadb5, 0xadb5,
-  0xad94, 0xa574, 0xa574, 0x9d33, 0x8cf2, 0x8cf2, 0x8cd2, 0x8491,
-  0x7450, 0x7451, 0x7430, 0x6bcf, 0x63cf, 0x63ae, 0x63ae, 0x5b8e,
-  0x536d, 0x536d, 0x536d, 0x5b6d, 0x534d, 0x4b2d, 0x4b2d, 0x532d,
-  0x4b0c, 0x4b0d, 0x4b2d, 0x532d, 0x42cc, 0x4aec, 0x42cb, 0x42cc,
-  0x42cc, 0x42ab, 0x42cc, 0x42cb, 0x4aec, 0x42cb, 0x42cc, 0x4aec,
-  0x42cc, 0x4aec, 0x42cb, 0x42ab, 0x42cb, 0x42ab, 0x42ab, 0x4aec,
-  0x42cc, 0x4aec, 0x42cc, 0x42ec, 0x42cc, 0x42cb, 0x42cc, 0x42cc,
-  0x4aec, 0x42ec, 0x4aec, 0x42ec, 0x42ec, 0x430c, 0x430d, 0x430d,
-  0x4b2d, 0x4b4d, 0x536e, 0x538e, 0x536e, 0x538e, 0x53af, 0x53af,
-  0x5bcf, 0x5bf0, 0x6431, 0x6451, 0x6c72, 0x6cb2, 0x74f3, 0x7534,
-  0x8575, 0x8db6, 0x9617, 0xa658, 0xae99, 0xb6fa, 0xbf5a, 0xcf7b,
-  0xd79c, 0xdfdc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfdc, 0xd7bb,
-  0xdfbc, 0xb71b, 0xb71b, 0xdf7b, 0xbefa, 0xaed9, 0x9658, 0x7e17,
-  0x7df7, 0x85f7, 0x7596, 0x7db6, 0xae37, 0xe77a, 0xdf39, 0x8d75,
-  0x9595, 0x6cb3, 0x9575, 0x9d75, 0xadf6, 0x8534, 0x7cd2, 0xadb4,
-  0xa595, 0x9d53, 0x9d13, 0xad94, 0xb595, 0x8cd2, 0x9d74, 0x6c0f,
-  0x6c30, 0xd6d8, 0x8cd1, 0x536d, 0x42ec, 0x8c91, 0x94d1, 0x7431,
-  0x3aac, 0x326b, 0x326b, 0x324a, 0x324a, 0x2a2a, 0x3a8a, 0x5b4d,
-  0x428a, 0x4aec, 0x428b, 0x52cb, 0x4a6a, 0x4249, 0x4228, 0x39c7,
-  0x2986, 0x31c7, 0x5b0c, 0x8450, 0x8c50, 0x7c0f, 0x8c50, 0x9490,
-  0x9470, 0xa513, 0x9491, 0x73ae, 0x738d, 0x73ce, 0x7bee, 0x840f,
-  0x840e, 0x83ee, 0x7bee, 0x73ad, 0x8c70, 0x9490, 0x8c4f, 0x8450,
-  0x73cf, 0x5aeb, 0x4228, 0x5b0d, 0x6bae, 0x632d, 0x6b6d, 0x6b8d,
-  0x5b0c, 0x632c, 0x5aec, 0x52ec, 0x4aec, 0x3229, 0x2a09, 0x432d,
-  0x53af, 0x3a8b, 0x324a, 0x3a8a, 0x428a, 0x530d, 0x532d, 0x63af,
-  0x6bef, 0x5b6d, 0x6bae, 0x9d12, 0xa513, 0xad33, 0xc5f6, 0xde98,
-  0xce36, 0xc5d4, 0xb573, 0xc5f5, 0xce36, 0xce57, 0xc5f6, 0xbdb5,
-  0xb574, 0xb553, 0xb594, 0xc5f6, 0xbdd5, 0xce36, 0xce37, 0xce57,
-  0xce37, 0xc616, 0xc616, 0xc616, 0xc616, 0xbdf5, 0xbdf6, 0xbe16,
-  0xbe17, 0xb5f6, 0xb5d5, 0xad95, 0xad95, 0xad95, 0xad95, 0xa574,
-  0xa574, 0x9d54, 0x9533, 0x8cf2, 0x8cd2, 0x8cf2, 0x7c91, 0x7c71,
-  0x7451, 0x7430, 0x7430, 0x6c10, 0x63cf, 0x5bae, 0x5b8e, 0x5b8e,
-  0x5b6e, 0x5b8e, 0x5b6e, 0x5b6e, 0x534d, 0x534d, 0x4b0c, 0x532d,
-  0x4b0c, 0x534d, 0x534d, 0x4b0d, 0x42cc, 0x42cb, 0x42ab, 0x42ab,
-  0x42cc, 0x4aec, 0x42cb, 0x42cc, 0x42cb, 0x42ec, 0x42cb, 0x4aec,
-  0x42cb, 0x42cb, 0x42ab, 0x42cb, 0x4acc, 0x42ab, 0x42ab, 0x42ab,
-  0x42cb, 0x42ab, 0x42ab, 0x42cc, 0x42cc, 0x42cb, 0x42cb, 0x42cc,
-  0x42cc, 0x42cb, 0x4aec, 0x42ec, 0x42ec, 0x42ec, 0x430d, 0x4b0d,
-  0x4b2d, 0x4b2d, 0x4b4d, 0x4b6e, 0x538e, 0x538f, 0x53af, 0x53af,
-  0x5bcf, 0x5c10, 0x6430, 0x6451, 0x6c72, 0x6c92, 0x74d3, 0x7514,
-  0x7d75, 0x8db6, 0x95f7, 0x9e57, 0xae99, 0xb6f9, 0xbf3a, 0xcf7b,
-  0xd79c, 0xdfdc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfdc, 0xd7bc,
-  0xdf9c, 0xb71b, 0xb6fa, 0xdf7b, 0xc6f9, 0xaed9, 0x9e78, 0x7df7,
-  0x7df7, 0x85b6, 0x7596, 0x7db6, 0xa617, 0xe75a, 0xef9a, 0x9596,
-  0xae16, 0x74d3, 0x9575, 0x9534, 0x9574, 0x8d54, 0x84f3, 0xa595,
-  0x9d95, 0x94f2, 0x9d53, 0xa574, 0xb5b5, 0x7c71, 0x8cf3, 0x7471,
-  0x6c30, 0xd6b8, 0x8491, 0x4b4e, 0x5b6d, 0xce77, 0x94d2, 0x5b8e,
-  0x42cd, 0x3a8c, 0x3aab, 0x42ab, 0x4aec, 0x3a8b, 0x324a, 0x3a6a,
-  0x530c, 0x5b4d, 0x5b4d, 0x4aab, 0x4a8a, 0x4249, 0x3a08, 0x31c7,
-  0x3a08, 0x634d, 0x7c0f, 0x7c0f, 0x73ad, 0x73ae, 0x7c0f, 0x8c30,
-  0x9cd2, 0xc637, 0xf7de, 0xbdf7, 0x8c91, 0x94b1, 0x94b1, 0x842f,
-  0x7bcd, 0x7bcd, 0x6b6c, 0x7bee, 0x9cd1, 0xa512, 0x94d1, 0x7bef,
-  0x4a69, 0x39e8, 0x39e8, 0x634d, 0x634d, 0x5b2d, 0x5b2d, 0x634d,
-  0x632c, 0x634d, 0x5b0c, 0x4aab, 0x534d, 0x536e, 0x3aab, 0x3a6b,
-  0x3aab, 0x4acc, 0x532d, 0x536e, 0x532d, 0x6bef, 0x8c92, 0x8c92,
-  0x9cf3, 0x7c30, 0x7bef, 0xb5b5, 0xce57, 0xce36, 0xb553, 0xad32,
-  0xc615, 0xce15, 0xce36, 0xd677, 0xce56, 0xce36, 0xce16, 0xc5f5,
-  0xb573, 0xc5f5, 0xbdd5, 0xbdd5, 0xc5f6, 0xc5f6, 0xbdb5, 0xbdd5,
-  0xbdd5, 0xbdb5, 0xb5b4, 0xbdb5, 0xbdf6, 0xbdf6, 0xbdf6, 0xbdf6,
-  0xbdf6, 0xb5d6, 0xadb5, 0xb5d6, 0xad95, 0xb5b6, 0xa575, 0x9d54,
-  0x9d54, 0x9533, 0x8cf2, 0x8cd2, 0x8cd2, 0x84b1, 0x8491, 0x7c71,
-  0x6c30, 0x6bef, 0x6bef, 0x63cf, 0x63cf, 0x5b8e, 0x5b8e, 0x5b8e,
-  0x5b8e, 0x534d, 0x532d, 0x532d, 0x534d, 0x4b2d, 0x4b0c, 0x534d,
-  0x5b6e, 0x534d, 0x4b0c, 0x4aec, 0x42cb, 0x42ab, 0x42ab, 0x4aec,
-  0x42cc, 0x42cc, 0x42ab, 0x4acc, 0x42ab, 0x42cb, 0x42cb, 0x42ab,
-  0x42cb, 0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42cb, 0x42cc, 0x3aab, 0x42cc, 0x42cc, 0x42cc,
-  0x42cc, 0x42cb, 0x42cc, 0x42ec, 0x536e, 0x536e, 0x42ec, 0x430d,
-  0x430d, 0x4b2d, 0x4b4d, 0x4b6e, 0x536e, 0x538e, 0x53af, 0x53cf,
-  0x5c10, 0x5c10, 0x5c10, 0x6451, 0x6c72, 0x6cb2, 0x74d3, 0x7514,
-  0x7d75, 0x8db6, 0x95f7, 0x9e37, 0xae98, 0xb6fa, 0xbf3a, 0xc77b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfdc, 0xcf9b,
-  0xdf9c, 0xb71b, 0xb6fa, 0xdf5b, 0xc719, 0xb6d9, 0xa6b9, 0x8617,
-  0x7dd7, 0x8dd7, 0x7596, 0x85d6, 0x95d6, 0xdf5a, 0xef9b, 0x8d54,
-  0xb637, 0x9575, 0xadf6, 0x9513, 0x8d13, 0x8d54, 0x8d34, 0x8d13,
-  0x8d33, 0xad95, 0x9d54, 0x84b2, 0x84b1, 0x7c91, 0x7c71, 0x7451,
-  0x7430, 0xd6b8, 0x8491, 0x4b4e, 0x7450, 0xdf19, 0x8491, 0x4b0c,
-  0x42ed, 0x3aac, 0x42ec, 0x532d, 0x636e, 0x42ab, 0x3a8a, 0x4b0c,
-  0x63ae, 0x5b4d, 0x5b2c, 0x52cb, 0x4aaa, 0x4229, 0x41e8, 0x39e7,
-  0x528a, 0x632c, 0x73ce, 0x73ce, 0x632c, 0x630b, 0x5aeb, 0x632c,
-  0x8c50, 0xad74, 0xd6fa, 0xdf5b, 0xadb5, 0xa513, 0x9cf2, 0x94d1,
-  0x9cf2, 0x73cd, 0x73ad, 0x9490, 0xa512, 0xa552, 0x94b1, 0x52ab,
-  0x3a09, 0x424a, 0x4aab, 0x73cf, 0x6bae, 0x52aa, 0x4249, 0x52cb,
-  0x5aeb, 0x4a69, 0x4249, 0x3a29, 0x3a4a, 0x4acc, 0x3aab, 0x42cc,
-  0x4acc, 0x4aec, 0x63af, 0x6bcf, 0x7c51, 0x94d2, 0xad54, 0xad54,
-  0xa512, 0x94d2, 0xad33, 0xde98, 0xf77b, 0xd6b8, 0xa4f2, 0x9c90,
-  0xbd94, 0xdeb8, 0xd697, 0xd677, 0xce36, 0xc5f5, 0xc5f6, 0xc5f6,
-  0xbdd5, 0xce36, 0xbdb5, 0xb594, 0xb594, 0xb5b4, 0xa512, 0xa532,
-  0xb594, 0xbdd5, 0xb594, 0xb574, 0xb5d5, 0xb5f6, 0xb5b5, 0xb5b5,
-  0xadb5, 0xb5f6, 0xb5b5, 0xad95, 0xadb6, 0xad95, 0x9d54, 0x9534,
-  0x9533, 0x94f3, 0x8cd2, 0x8cd2, 0x8cd2, 0x8cd2, 0x7c71, 0x7450,
-  0x6c30, 0x63cf, 0x63ef, 0x63cf, 0x5bae, 0x5b6e, 0x5bae, 0x536d,
-  0x534d, 0x534d, 0x534d, 0x532d, 0x532d, 0x4b0c, 0x4b0c, 0x534d,
-  0x534d, 0x4b0c, 0x4aec, 0x42cb, 0x42cb, 0x42cc, 0x42ec, 0x42cb,
-  0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x42cb, 0x42ab,
-  0x42ab, 0x42cb, 0x42ab, 0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42cc, 0x4aec, 0x42cc, 0x42cc, 0x4b2d, 0x4b0d, 0x42ec, 0x4b0c,
-  0x430d, 0x4b2d, 0x4b4d, 0x4b4d, 0x4b4e, 0x4b6e, 0x53af, 0x53af,
-  0x5bef, 0x5bf0, 0x6431, 0x6451, 0x6c72, 0x6cb2, 0x74d3, 0x7d34,
-  0x7d54, 0x8db6, 0x95f6, 0x9e37, 0xae98, 0xb6fa, 0xbf3a, 0xc77b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7fd, 0xeffd, 0xeffd, 0xdfdd, 0xcf9b,
-  0xd79c, 0xaefa, 0xaefa, 0xdf7b, 0xcf3a, 0xbef9, 0xa678, 0x8e38,
-  0x7dd6, 0x9637, 0x7596, 0x85d6, 0x8db6, 0xd719, 0xef9a, 0x9575,
-  0xae17, 0xa5d5, 0xb616, 0x9d75, 0x8d33, 0x8514, 0x8cf3, 0x9535,
-  0x8d13, 0xbe37, 0x9d54, 0x538e, 0x536e, 0x63f0, 0x6c30, 0x6c30,
-  0x7430, 0xce98, 0x9d54, 0x536e, 0x4b6d, 0x84b1, 0x7c71, 0x5b8e,
-  0x42ec, 0x4b0c, 0x532d, 0x5b4d, 0x636d, 0x4aeb, 0x532c, 0x534d,
-  0x63ae, 0x636e, 0x636d, 0x52eb, 0x4aaa, 0x4a69, 0x4a28, 0x4a69,
-  0x4a69, 0x5aaa, 0x6b2c, 0x6b4c, 0x52aa, 0x5289, 0x5289, 0x5289,
-  0x632b, 0x8450, 0x8470, 0x8470, 0x8cb1, 0x94d1, 0x94b1, 0x8c90,
-  0x73ad, 0x632c, 0x94b1, 0x94b1, 0x8c70, 0xa512, 0x9cd1, 0x73ae,
-  0x424a, 0x5b0d, 0x6b8e, 0x6bce, 0x5b2c, 0x4a8a, 0x4249, 0x31e8,
-  0x31c7, 0x39e8, 0x39e8, 0x3a08, 0x31e8, 0x4aec, 0x42ab, 0x4b0d,
-  0x4aec, 0x532d, 0x638e, 0x7c50, 0x9d33, 0xad53, 0xbdb4, 0xbdb4,
-  0xc5d5, 0xbdb5, 0xd697, 0xef7b, 0xffbc, 0xe71a, 0xad53, 0xa4f1,
-  0xb573, 0xd697, 0xd677, 0xd656, 0xce36, 0xb574, 0xad53, 0xbdb5,
-  0xbdb5, 0xbdb5, 0xb573, 0xad73, 0xa512, 0xa532, 0xb594, 0xb5b4,
-  0xad74, 0xbdd5, 0xbdd5, 0xbdf6, 0xbdf6, 0xb5d5, 0xb5d5, 0xb5b5,
-  0xad95, 0xadb5, 0xadb5, 0xb5d6, 0xadd6, 0x9d54, 0x9d54, 0x9534,
-  0x8cf2, 0x9513, 0x8cf3, 0x8491, 0x8cf3, 0x7c71, 0x7451, 0x6c30,
-  0x63ef, 0x63cf, 0x6bef, 0x63af, 0x5b8e, 0x63af, 0x534d, 0x5b6e,
-  0x5b6e, 0x534d, 0x532d, 0x534d, 0x4b0c, 0x4aec, 0x4b0d, 0x534d,
-  0x4b2d, 0x4aec, 0x4aec, 0x42cc, 0x42cc, 0x42ec, 0x42cb, 0x42cb,
-  0x42ab, 0x42cc, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x42cc,
-  0x42cc, 0x42cc, 0x42cc, 0x42cc, 0x42cc, 0x42ec, 0x4b0c, 0x4b2d,
-  0x430d, 0x4b0d, 0x4b4e, 0x4b4e, 0x4b4d, 0x4b6e, 0x538e, 0x53af,
-  0x5bf0, 0x5bf0, 0x5c11, 0x6431, 0x6c72, 0x6cb2, 0x74f3, 0x7d34,
-  0x8555, 0x8db6, 0x95f6, 0x9e37, 0xae98, 0xb6d9, 0xbf3a, 0xc77b,
-  0xd7bc, 0xdfdc, 0xf7fd, 0xf7fd, 0xeffd, 0xeffd, 0xdfdd, 0xd79c,
-  0xdfbc, 0xb71a, 0xb71a, 0xdf5b, 0xd73a, 0xbef9, 0xae78, 0x8e18,
-  0x85d6, 0x9e38, 0x7595, 0x7db6, 0x8dd6, 0xd719, 0xf7bb, 0x9575,
-  0x8d55, 0xa5d5, 0xc697, 0x9d74, 0x8d34, 0x7cd3, 0x9d34, 0xbdf6,
-  0x94f2, 0xdeb8, 0xa554, 0x4b6e, 0x4b2d, 0x4b6e, 0x5baf, 0x6c11,
-  0x7431, 0xce97, 0x8470, 0x6bf0, 0x4b2d, 0x4b4d, 0x7430, 0x63cf,
-  0x4b0c, 0x4b0c, 0x5b8e, 0x636d, 0x740f, 0x638e, 0x5b6d, 0x5b8d,
-  0x638e, 0x638e, 0x636e, 0x52eb, 0x52cb, 0x4a8a, 0x5289, 0x4a49,
-  0x4a69, 0x5289, 0x5a89, 0x528a, 0x4a49, 0x5269, 0x62cb, 0x5289,
-  0x5aa9, 0x73ce, 0x634c, 0x634c, 0x6bae, 0x6bce, 0x6b6d, 0x630b,
-  0x6b4c, 0xbdd6, 0xd6b8, 0xad73, 0x842e, 0x6b6c, 0x7bee, 0x8c70,
-  0x6b8d, 0x5b2c, 0x5b0c, 0x5aeb, 0x4228, 0x39e7, 0x31e7, 0x31e7,
-  0x4229, 0x4a8a, 0x4249, 0x31e8, 0x3a49, 0x3a49, 0x3a4a, 0x4acc,
-  0x428a, 0x4acc, 0x638e, 0x94d2, 0xa533, 0xc5f5, 0xd676, 0xe719,
-  0xef3a, 0xef3a, 0xef5a, 0xef5b, 0xf79b, 0xef3a, 0xd677, 0xbdb4,
-  0xad32, 0xc636, 0xd6b8, 0xc5f6, 0xad33, 0xa512, 0xad53, 0xbdd5,
-  0xbdd5, 0xb594, 0xb594, 0xa532, 0xa4f1, 0xad73, 0xbdb5, 0xb5b5,
-  0xb5b5, 0xbdd5, 0xbdf6, 0xbe16, 0xbdf6, 0xb5b5, 0xb5b5, 0xad95,
-  0xadb5, 0xad94, 0xad95, 0xadd6, 0xa595, 0x9513, 0x8cf2, 0x8d13,
-  0x84b2, 0x84b2, 0x84b2, 0x7cb2, 0x7c91, 0x7471, 0x7430, 0x6bef,
-  0x63cf, 0x63cf, 0x63af, 0x5b8e, 0x5b8e, 0x5b6e, 0x536d, 0x536e,
-  0x5b6e, 0x532d, 0x4b0c, 0x4b2d, 0x4b0c, 0x4b0d, 0x4b0c, 0x4aec,
-  0x4b2c, 0x4aec, 0x4b0d, 0x42cc, 0x42cc, 0x42cc, 0x3aab, 0x4b0c,
-  0x42cb, 0x42ab, 0x42ab, 0x42cb, 0x4acc, 0x42ab, 0x42cc, 0x42cb,
-  0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x42ab,
-  0x4aec, 0x42ab, 0x42cc, 0x42cc, 0x42ab, 0x42ab, 0x42ab, 0x42cb,
-  0x42cc, 0x42ec, 0x42ec, 0x42cc, 0x4aec, 0x42ec, 0x4b2d, 0x4b0c,
-  0x42ec, 0x4b0d, 0x4b2d, 0x4b2d, 0x4b4d, 0x4b6e, 0x538e, 0x53af,
-  0x5bcf, 0x5bf0, 0x6410, 0x6431, 0x6471, 0x6cb2, 0x74f3, 0x7d34,
-  0x8575, 0x8d96, 0x95f6, 0x9e37, 0xae98, 0xb6d9, 0xbf1a, 0xc75b,
-  0xcf9c, 0xdfdc, 0xeffd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfdd, 0xd79b,
-  0xdfbc, 0xb71b, 0xb71a, 0xd75b, 0xd73a, 0xc6f9, 0xc6fb, 0x8df7,
-  0x85d6, 0x9e37, 0x7d95, 0x85b6, 0x95f6, 0xd719, 0xefbb, 0x95d6,
-  0x8534, 0xb616, 0xe73a, 0x9533, 0x84f3, 0x7cd2, 0xc656, 0xd6d7,
-  0x9d53, 0xef7b, 0x94d2, 0x538e, 0x432d, 0x4b6e, 0x536e, 0x5baf,
-  0x63af, 0xb616, 0x7c70, 0x8cf3, 0x534e, 0x4b4e, 0x6bef, 0x63ef,
-  0x5bae, 0x63ae, 0x6bce, 0x7c50, 0x8450, 0x6bce, 0x5b6d, 0x5b6d,
-  0x5b4d, 0x636d, 0x5b4d, 0x52eb, 0x52eb, 0x4aaa, 0x52aa, 0x5aeb,
-  0x630b, 0x62eb, 0x62ca, 0x5aaa, 0x5269, 0x62ca, 0x734c, 0x736d,
-  0x7bcd, 0x83ee, 0x5aca, 0x530b, 0x63ad, 0x73ef, 0x8450, 0xad94,
-  0xe73a, 0xfffc, 0xef5a, 0xb5b4, 0x8c6f, 0x6b2c, 0x6b2c, 0x842f,
-  0x8c71, 0x52eb, 0x4a69, 0x4a49, 0x39e7, 0x31c7, 0x4228, 0x4249,
-  0x4a8a, 0x4a8a, 0x4a8a, 0x4249, 0x3a09, 0x3a49, 0x42ab, 0x3a4a,
-  0x3a6a, 0x530d, 0x638e, 0x8c92, 0xb5b5, 0xce56, 0xef19, 0xff9b,
-  0xf79b, 0xf79b, 0xef5a, 0xef3a, 0xef1a, 0xef3a, 0xded8, 0xc636,
-  0x9cb1, 0xa512, 0xb594, 0xad33, 0xad53, 0xbdb4, 0xc5f6, 0xc5f5,
-  0xbdd5, 0xbdb4, 0xbdb4, 0xa4f2, 0xa4f1, 0xad53, 0xb594, 0xbdd5,
-  0xbdd5, 0xbdf5, 0xb5d5, 0xbe16, 0xb5d5, 0xb5d5, 0xad95, 0xa574,
-  0xa595, 0xa574, 0xa574, 0xadb6, 0xa575, 0x9d54, 0x8cf2, 0x84b2,
-  0x84b2, 0x84b2, 0x84d2, 0x84b2, 0x7c71, 0x7430, 0x6c0f, 0x63cf,
-  0x63cf, 0x63af, 0x5b8e, 0x63cf, 0x63ae, 0x5b6d, 0x536e, 0x536d,
-  0x5b8e, 0x4b2d, 0x4b0c, 0x4b0c, 0x4aec, 0x4b0d, 0x4b0c, 0x4b0c,
-  0x4b0c, 0x4aec, 0x4acc, 0x42cc, 0x4acc, 0x4aec, 0x4aec, 0x42ab,
-  0x42cb, 0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cc, 0x42ab,
-  0x42ab, 0x3aab, 0x42ab, 0x3a8b, 0x42ab, 0x42ab, 0x42ec, 0x4b0c,
-  0x42cc, 0x4b0c, 0x42cc, 0x42ec, 0x42ec, 0x42ec, 0x42ec, 0x42ec,
-  0x4b0c, 0x4b0d, 0x4b2d, 0x4b2d, 0x4b4e, 0x536e, 0x538e, 0x53af,
-  0x5bcf, 0x5bef, 0x5c10, 0x6431, 0x6c71, 0x6cb2, 0x74f3, 0x7d34,
-  0x8575, 0x8db6, 0x95f6, 0x9e57, 0xae99, 0xb6d9, 0xbf1a, 0xc75b,
-  0xcf9c, 0xdfbc, 0xeffd, 0xf7fd, 0xeffc, 0xe7fd, 0xdffc, 0xd79b,
-  0xdfbc, 0xb71a, 0xb6fa, 0xd75b, 0xcf3a, 0xc6fa, 0xa659, 0x9e58,
-  0x8dd7, 0xa658, 0x8dd7, 0x7d96, 0xa638, 0xd719, 0xf7bb, 0x9dd6,
-  0x7d13, 0xc698, 0xd6d9, 0x9d74, 0x84f3, 0x84d2, 0xd6d7, 0xceb7,
-  0x9513, 0xd6d8, 0x94d2, 0x6c10, 0x3aed, 0x434e, 0x4b4e, 0x5b6e,
-  0x5b6e, 0x7430, 0x6bcf, 0x6bef, 0x5b6e, 0x5b6e, 0x7410, 0x6c0f,
-  0x6c0f, 0x6bef, 0x8491, 0xa574, 0x740f, 0x6bef, 0x5b4d, 0x532d,
-  0x52ec, 0x638d, 0x530c, 0x530b, 0x5b0b, 0x52cb, 0x52aa, 0x62eb,
-  0x62eb, 0x62ca, 0x62a9, 0x6aea, 0x6aea, 0x6b0b, 0x734c, 0x83cd,
-  0x944f, 0x8c4f, 0x6b2c, 0x4a89, 0x5b2c, 0x6bce, 0x8cb1, 0xce77,
-  0xef7a, 0xef59, 0xbe15, 0x9cf1, 0xb573, 0x9cb0, 0x8c2f, 0x73cd,
-  0x634d, 0x4a8a, 0x4a69, 0x39e7, 0x31e7, 0x3a28, 0x4aaa, 0x4a8a,
-  0x4a8a, 0x52ec, 0x4aab, 0x4249, 0x3a08, 0x3a29, 0x3209, 0x3209,
-  0x3a4a, 0x4aac, 0x52ed, 0x73f0, 0xa575, 0xd698, 0xe719, 0xf77b,
-  0xf77b, 0xef5b, 0xe719, 0xd697, 0xd677, 0xdeb8, 0xded8, 0xc636,
-  0xa512, 0xa4f2, 0xad53, 0xbdd5, 0xc616, 0xbdf5, 0xbdd5, 0xb5b4,
-  0xbdb5, 0xbdb5, 0xbdb5, 0xa512, 0x9cd1, 0xa512, 0xb594, 0xb5b5,
-  0xbdd5, 0xb5b5, 0xad74, 0xbdf5, 0xb5d5, 0xadb5, 0xad94, 0xad95,
-  0xa574, 0x9d54, 0x9d54, 0xa575, 0x9d54, 0x9513, 0x8cd2, 0x84b2,
-  0x8491, 0x7c91, 0x7c71, 0x7471, 0x7451, 0x6bef, 0x6bef, 0x6c10,
-  0x63cf, 0x63ae, 0x63cf, 0x5bae, 0x534d, 0x532d, 0x4b2d, 0x4b2d,
-  0x534d, 0x4b0d, 0x4aec, 0x4b2d, 0x4b0c, 0x42ec, 0x42ec, 0x4aec,
-  0x4b0c, 0x4aec, 0x4aec, 0x4aec, 0x4aec, 0x42cc, 0x4b0d, 0x42cc,
-  0x42cb, 0x42ab, 0x42cb, 0x42cb, 0x42ab, 0x42cb, 0x42ab, 0x42ab,
-  0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x3aab, 0x42ab, 0x42cb, 0x42ab,
-  0x3a8b, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cc, 0x4b0d,
-  0x42cc, 0x42cc, 0x42cc, 0x42ec, 0x42cc, 0x42ec, 0x42ec, 0x42ec,
-  0x42ec, 0x42ec, 0x4b2d, 0x4b2d, 0x4b4d, 0x4b4e, 0x536e, 0x538f,
-  0x5bcf, 0x5bcf, 0x5c10, 0x6431, 0x6471, 0x6cb2, 0x6cd3, 0x7513,
-  0x7d54, 0x8d96, 0x95f7, 0x9e37, 0xa698, 0xb6d9, 0xbf1a, 0xc75b,
-  0xcf9c, 0xd7bc, 0xeffd, 0xf7fd, 0xeffc, 0xe7fd, 0xdffc, 0xd79b,
-  0xd79c, 0xb71a, 0xaefa, 0xd73b, 0xd73a, 0xbed9, 0x9658, 0xa679,
-  0x9e38, 0x8dd6, 0x7d96, 0x7d76, 0x9e17, 0xd6f9, 0xf7bb, 0x9dd6,
-  0x7d13, 0xd6d8, 0xbe17, 0xa595, 0x84f3, 0x9554, 0xd696, 0xd6d8,
-  0x8cb2, 0xad53, 0xad94, 0x7430, 0x3aec, 0x430d, 0x4b4e, 0x5b8f,
-  0x5b8e, 0x5b6e, 0x5b8e, 0x63cf, 0x5b8e, 0x6bf0, 0x6bef, 0x6bef,
-  0x638e, 0x73ef, 0x94b1, 0xad94, 0x7c30, 0x7431, 0x4b0c, 0x4aec,
-  0x4aab, 0x6bae, 0x530c, 0x5b2c, 0x5aeb, 0x5aeb, 0x52ca, 0x5acb,
-  0x52aa, 0x5aaa, 0x6b0b, 0x62ca, 0x62ea, 0x6b2b, 0x6b0b, 0x734b,
-  0x7bad, 0x840e, 0x738d, 0x4249, 0x4269, 0x52eb, 0x7c0f, 0x9d12,
-  0xb5b4, 0xa512, 0x738c, 0x842e, 0xb593, 0x9cf1, 0xa532, 0x6b6c,
-  0x52cb, 0x4a6a, 0x3a08, 0x31c7, 0x4229, 0x4a8a, 0x4aaa, 0x4a8a,
-  0x4aaa, 0x52cb, 0x52ec, 0x426a, 0x3a08, 0x3208, 0x3208, 0x3208,
-  0x3208, 0x3a29, 0x426a, 0x4aab, 0x6bcf, 0xad75, 0xdeb8, 0xdeb8,
-  0xded8, 0xd697, 0xc5f5, 0xb573, 0xbdb4, 0xdef9, 0xf77b, 0xded8,
-  0xce37, 0xad33, 0xb553, 0xc5f6, 0xc5f6, 0xbdd5, 0xbdd5, 0xb594,
-  0xb5b5, 0xbdd5, 0xbdb5, 0xad73, 0xa532, 0xa512, 0xad74, 0xb594,
-  0xb5b5, 0xb5d5, 0xb594, 0xb5b5, 0xad95, 0xad95, 0xad95, 0xa574,
-  0x9d33, 0x9513, 0x9513, 0x94f3, 0x9d54, 0x8cf3, 0x7c71, 0x7c71,
-  0x7c71, 0x7430, 0x7450, 0x6c10, 0x6c10, 0x6c0f, 0x63cf, 0x63cf,
-  0x63cf, 0x63cf, 0x5baf, 0x5b6e, 0x534d, 0x534d, 0x534d, 0x4b2d,
-  0x532d, 0x4b0c, 0x4b0c, 0x4aec, 0x42ec, 0x42cb, 0x42ec, 0x4b0c,
-  0x4b0c, 0x532d, 0x4aec, 0x42cb, 0x4aec, 0x4aec, 0x42cb, 0x42cb,
-  0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x3a8b, 0x42ab, 0x42ab, 0x42ab, 0x428b, 0x3a8b, 0x42ab,
-  0x42ab, 0x428b, 0x428b, 0x3aab, 0x42ab, 0x42ab, 0x42cc, 0x42cc,
-  0x42cb, 0x4aec, 0x42cc, 0x42ec, 0x42cc, 0x42ec, 0x4aec, 0x42ec,
-  0x42ec, 0x42ec, 0x4b0c, 0x4b2d, 0x4b2d, 0x4b4d, 0x4b6e, 0x538e,
-  0x53af, 0x5bcf, 0x5c10, 0x5c31, 0x6451, 0x6c92, 0x6cd3, 0x7514,
-  0x7d54, 0x8595, 0x95f7, 0x9e57, 0xa698, 0xb6d9, 0xbf1a, 0xc75b,
-  0xcf9b, 0xd7bc, 0xeffd, 0xf7fd, 0xeffc, 0xe7fd, 0xdffd, 0xd79c,
-  0xd79c, 0xbf3b, 0xaefa, 0xcf3a, 0xcf19, 0xbef9, 0xa679, 0x9617,
-  0xae79, 0x85b6, 0x7596, 0x7575, 0x8df7, 0xced8, 0xef7a, 0xb658,
-  0x8d54, 0xd6d8, 0xb5d6, 0xa596, 0x7cd3, 0x9d95, 0xc615, 0xb5d4,
-  0xc616, 0xad74, 0xc616, 0x6c0f, 0x3acc, 0x430d, 0x534e, 0x5b8e,
-  0x536e, 0x536e, 0x5b8e, 0x5baf, 0x63cf, 0x6bef, 0x63cf, 0x6bcf,
-  0x6baf, 0x7c31, 0xb595, 0xd698, 0x7c30, 0x5b0c, 0x42ab, 0x42aa,
-  0x42ab, 0x52ec, 0x428a, 0x5b2c, 0x5b0c, 0x52ca, 0x52aa, 0x52aa,
-  0x52aa, 0x52aa, 0x5aca, 0x6b0b, 0x5aaa, 0x62ca, 0x62ca, 0x5aca,
-  0x62ca, 0x6b6d, 0x5aeb, 0x3a08, 0x3a08, 0x4249, 0x4aaa, 0x4aaa,
-  0x5aca, 0x52ca, 0x5aca, 0x83ee, 0x9cb1, 0x8c2f, 0x94b0, 0x73ee,
-  0x5aeb, 0x4229, 0x31e8, 0x4269, 0x4aaa, 0x4a8a, 0x428a, 0x4aaa,
-  0x52eb, 0x4aaa, 0x4aab, 0x5b0c, 0x4aaa, 0x31e8, 0x3a28, 0x428a,
-  0x4a8a, 0x4249, 0x4249, 0x52aa, 0x738e, 0x94b1, 0xad53, 0xce36,
-  0xe6f8, 0xe739, 0xded8, 0xbdb4, 0xc5f5, 0xef7b, 0xf77b, 0xdeb8,
-  0xd697, 0xc5f5, 0x9cd1, 0xad33, 0xa512, 0xad33, 0xad73, 0xbdb5,
-  0xbdd5, 0xbdd5, 0xbdd5, 0xb594, 0x9cd1, 0xa532, 0xad53, 0xb5b4,
-  0xb5b5, 0xad94, 0xb5b5, 0xb5b5, 0xa574, 0xa574, 0xa574, 0x9d33,
-  0x9d54, 0x9513, 0x9533, 0x84b2, 0x8cd2, 0x84b1, 0x84b1, 0x84b2,
-  0x7450, 0x7430, 0x6c0f, 0x6bef, 0x6c10, 0x6c10, 0x6c10, 0x63af,
-  0x63cf, 0x63cf, 0x5b8e, 0x534d, 0x534d, 0x536e, 0x536d, 0x534d,
-  0x5b6e, 0x4b0c, 0x4aec, 0x4acc, 0x4b0c, 0x4b0c, 0x42cb, 0x4b0c,
-  0x4b2d, 0x532d, 0x42ab, 0x42ec, 0x4aec, 0x42cb, 0x534d, 0x534d,
-  0x42ab, 0x42ab, 0x42cb, 0x42cc, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x428b, 0x428b, 0x3a8b, 0x42ab, 0x428b, 0x42ab, 0x3aab,
-  0x42cc, 0x3a8b, 0x42ab, 0x3a8b, 0x3aab, 0x42ab, 0x42ab, 0x42ab,
-  0x42cb, 0x42cc, 0x42cc, 0x42cc, 0x42cc, 0x42ec, 0x42ec, 0x4aec,
-  0x42ec, 0x4b0c, 0x4b0c, 0x4b2d, 0x4b2d, 0x4b4d, 0x4b8e, 0x538e,
-  0x53af, 0x5bcf, 0x5c10, 0x5c30, 0x6471, 0x6c92, 0x6cd3, 0x7514,
-  0x7d54, 0x8595, 0x95f6, 0x9e57, 0xa698, 0xb6d9, 0xbf1a, 0xc75b,
-  0xcf9b, 0xd7bc, 0xe7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdffc, 0xd7bc,
-  0xd79b, 0xc75b, 0xaefa, 0xc73a, 0xcf1a, 0xbed9, 0xae78, 0x8e17,
-  0xb678, 0x9618, 0x7d96, 0x7575, 0x8dd6, 0xbe98, 0xbe57, 0xd6d9,
-  0x9d74, 0xd6d8, 0xc657, 0x84f3, 0x7cd3, 0x9554, 0xc657, 0x8cd2,
-  0xc657, 0xb5b4, 0xc636, 0x6c0f, 0x3acc, 0x430d, 0x5baf, 0x63af,
-  0x5b8e, 0x536e, 0x5bae, 0x536e, 0x63af, 0x6bef, 0x6bef, 0x7430,
-  0x7430, 0x8491, 0xc637, 0xbdd5, 0x9cf2, 0x94b2, 0x4aab, 0x426a,
-  0x426a, 0x4aab, 0x424a, 0x5b4d, 0x5b0c, 0x4a8a, 0x52aa, 0x4a69,
-  0x4228, 0x4228, 0x4a28, 0x4a69, 0x4a69, 0x5269, 0x5289, 0x5269,
-  0x4a69, 0x4228, 0x39c7, 0x39e7, 0x4a69, 0x52ca, 0x52aa, 0x4a49,
-  0x5acb, 0x630c, 0x7bce, 0x840e, 0x8c0f, 0x842f, 0x7bee, 0x6b6d,
-  0x4269, 0x31c7, 0x3a28, 0x4aaa, 0x530c, 0x4acb, 0x4aaa, 0x52cb,
-  0x530c, 0x4aaa, 0x52cb, 0x52eb, 0x4a8a, 0x3a09, 0x52cb, 0x5b0c,
-  0x52cb, 0x632c, 0x738e, 0x8c50, 0xb573, 0xb573, 0xd677, 0xef3a,
-  0xf7bb, 0xf79b, 0xef3a, 0xdeb8, 0xd677, 0xdeb8, 0xf79b, 0xe6f9,
-  0xdeb8, 0xce77, 0x9cd1, 0x840f, 0x8c2f, 0xa512, 0xbdd5, 0xbdd5,
-  0xbdd5, 0xbdd5, 0xbdf5, 0xa532, 0x9470, 0x9d12, 0xad53, 0xad74,
-  0xb594, 0xb5b5, 0xad94, 0xadb5, 0xa594, 0x9d53, 0xa574, 0x9d33,
-  0x9512, 0x9513, 0x8cd2, 0x84b1, 0x84b2, 0x8491, 0x7c71, 0x7c50,
-  0x7430, 0x7430, 0x6bef, 0x6bef, 0x63af, 0x63af, 0x7431, 0x6bef,
-  0x5b8e, 0x5b6e, 0x5b6e, 0x534d, 0x534d, 0x4b2d, 0x532d, 0x534d,
-  0x534d, 0x534e, 0x4aec, 0x42ec, 0x42cc, 0x42cc, 0x42ab, 0x42cb,
-  0x4b0c, 0x4b0c, 0x42cb, 0x42ec, 0x42cb, 0x42cc, 0x4aec, 0x4aec,
-  0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x428b, 0x42ab, 0x42ab, 0x42ab, 0x3aab,
-  0x3a8b, 0x3a8b, 0x42ab, 0x3a8a, 0x3a8b, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42cc, 0x42cb, 0x42cc, 0x4b0c, 0x4b2d, 0x4aec,
-  0x42ec, 0x4b0c, 0x4b0d, 0x4b2d, 0x4b2d, 0x4b4d, 0x538e, 0x538e,
-  0x5bcf, 0x5bef, 0x5bf0, 0x5c10, 0x6451, 0x6c92, 0x6cd2, 0x74f3,
-  0x7d54, 0x8595, 0x95d6, 0x9e57, 0xa698, 0xaed9, 0xb71a, 0xc75b,
-  0xcf9b, 0xd7bc, 0xe7fc, 0xf7fd, 0xeffd, 0xe7fd, 0xdffd, 0xd7bc,
-  0xd77b, 0xc75b, 0xb6fa, 0xc71a, 0xc6f9, 0xb6b9, 0xb6ba, 0x8e17,
-  0xae78, 0x9e58, 0x85b6, 0x7555, 0x95f6, 0xb677, 0xadf6, 0xdf19,
-  0x9d94, 0xc677, 0xd6b8, 0x7cd3, 0x8514, 0x84f3, 0xa574, 0x84b2,
-  0xa574, 0xbdd5, 0xb5b5, 0x63cf, 0x3b0d, 0x534e, 0x6c30, 0x7430,
-  0x5bae, 0x5baf, 0x5baf, 0x5b8e, 0x63ef, 0x6c10, 0x63ae, 0x8cb2,
-  0x8c91, 0x94d2, 0xa573, 0xad53, 0x9d12, 0x8cd2, 0x52ec, 0x3a49,
-  0x3208, 0x428b, 0x426a, 0x5b4d, 0x5b0c, 0x4a8a, 0x4a69, 0x4228,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39e7, 0x4a48, 0x4a89,
-  0x52aa, 0x4a69, 0x4a49, 0x52aa, 0x630b, 0x6b2c, 0x6b6c, 0x738d,
-  0x83ee, 0x7bcd, 0x842f, 0x8c2f, 0x7bce, 0x6b8d, 0x5b2c, 0x4a89,
-  0x3207, 0x3a28, 0x4269, 0x530c, 0x636d, 0x530b, 0x5b2c, 0x5b2c,
-  0x4acb, 0x530c, 0x5b2c, 0x52eb, 0x3a49, 0x4249, 0x4229, 0x3a09,
-  0x634d, 0x8430, 0x94b1, 0xad53, 0xd6b7, 0xe719, 0xef7b, 0xf79b,
-  0xf79b, 0xef3a, 0xef3a, 0xe73a, 0xded9, 0xd6b8, 0xdef9, 0xdef9,
-  0xce77, 0xbdb5, 0x9470, 0x8c2f, 0x8c50, 0x9491, 0xad74, 0xbdd5,
-  0xbdd5, 0xb5b5, 0xbdd5, 0xad74, 0x94b1, 0xa532, 0xad53, 0xad73,
-  0xa553, 0xad94, 0xad74, 0xad74, 0xa574, 0xa574, 0x9d33, 0x94f2,
-  0x8cf2, 0x8cb1, 0x8491, 0x8491, 0x8491, 0x7c71, 0x7c71, 0x7450,
-  0x6c0f, 0x6c0f, 0x6bef, 0x6bcf, 0x63ae, 0x63ae, 0x63cf, 0x6bef,
-  0x5b6e, 0x5b4d, 0x5b6e, 0x536e, 0x534d, 0x532d, 0x4b0c, 0x4b0d,
-  0x536e, 0x534d, 0x42cc, 0x42cc, 0x4b0d, 0x42ab, 0x42cb, 0x42cb,
-  0x4aec, 0x4b0d, 0x4aec, 0x42cc, 0x3aab, 0x42cc, 0x42cb, 0x42cb,
-  0x4aec, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x3aab,
-  0x42ab, 0x428a, 0x42ab, 0x3a8a, 0x428b, 0x42ab, 0x42ab, 0x42ab,
-  0x3a8b, 0x3a8b, 0x3a8b, 0x3a8a, 0x42ab, 0x42ab, 0x42ab, 0x42cb,
-  0x42ab, 0x42cc, 0x42cc, 0x42ec, 0x4aec, 0x42ec, 0x4b2d, 0x4b2d,
-  0x4b0c, 0x4b0c, 0x4b2d, 0x4b4d, 0x4b4d, 0x4b6e, 0x536e, 0x538e,
-  0x53af, 0x5bcf, 0x5bf0, 0x5c31, 0x6451, 0x6c92, 0x6cb2, 0x7513,
-  0x7d54, 0x8595, 0x95d6, 0x9e37, 0xa698, 0xaed9, 0xbf1a, 0xc75b,
-  0xcf9b, 0xd7bc, 0xe7fc, 0xf7fd, 0xeffd, 0xe7fd, 0xdffd, 0xd7bc,
-  0xd77b, 0xc75b, 0xb71a, 0xc71a, 0xc71a, 0xae99, 0xa679, 0x8e38,
-  0xa658, 0x9617, 0x8dd7, 0x6d34, 0x9df6, 0xd6f9, 0xc677, 0xdf5a,
-  0x9db5, 0xc677, 0xce78, 0x8514, 0x7cf3, 0x8d13, 0xa574, 0x9513,
-  0x9533, 0xc657, 0x9d13, 0x63cf, 0x432d, 0x5bcf, 0x740f, 0x6bf0,
-  0x5b8e, 0x5baf, 0x536e, 0x5baf, 0x63cf, 0x63cf, 0x6bef, 0x8471,
-  0x94d2, 0x8491, 0x6bcf, 0xad94, 0x94d1, 0x52cb, 0x5b2c, 0x3a49,
-  0x29c7, 0x31e8, 0x3a49, 0x5b2c, 0x52eb, 0x4aaa, 0x4228, 0x4208,
-  0x4208, 0x3a08, 0x39e7, 0x4207, 0x39c7, 0x41e7, 0x4a48, 0x52aa,
-  0x5aca, 0x5aca, 0x52a9, 0x62ea, 0x736c, 0x736c, 0x736c, 0x73ad,
-  0x7bce, 0x738d, 0x6b8d, 0x6b4c, 0x5aeb, 0x4a89, 0x4269, 0x3208,
-  0x3a08, 0x3a49, 0x4aaa, 0x530c, 0x530c, 0x5b2c, 0x5b4d, 0x636d,
-  0x634d, 0x5b2d, 0x52cb, 0x52cb, 0x4249, 0x426a, 0x4aaa, 0x4229,
-  0x738e, 0x8430, 0x8c4f, 0xbdb5, 0xe719, 0xef3a, 0xef39, 0xf77b,
-  0xef5a, 0xe73a, 0xef3a, 0xe73a, 0xe719, 0xdeb8, 0xde98, 0xd677,
-  0xce36, 0xbdb4, 0xad53, 0x9cf2, 0x8c2f, 0x842f, 0xad33, 0xb5b4,
-  0xbdd5, 0xb5b5, 0xb5b4, 0xad53, 0x94b1, 0x9cf2, 0x9d12, 0xa553,
-  0xa553, 0xad74, 0xad74, 0xa574, 0x9d53, 0x9d33, 0x94f2, 0x94f2,
-  0x8cb1, 0x8471, 0x8491, 0x8491, 0x7c50, 0x7c70, 0x7c50, 0x6c0f,
-  0x7430, 0x7430, 0x63ce, 0x63ae, 0x638e, 0x5b6e, 0x63cf, 0x7430,
-  0x63cf, 0x534d, 0x534d, 0x534d, 0x4b2d, 0x530d, 0x4b0c, 0x4aec,
-  0x4b0c, 0x4aec, 0x42cc, 0x42cc, 0x4aec, 0x42ab, 0x42ab, 0x42ab,
-  0x42cb, 0x4aec, 0x4aec, 0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x42cb,
-  0x42ab, 0x42ab, 0x42cb, 0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42cb, 0x3a8a, 0x42ab, 0x42ab, 0x3a6a, 0x3a6a, 0x3a8a, 0x428b,
-  0x42ab, 0x3aab, 0x3a8b, 0x3a8a, 0x42ab, 0x42cb, 0x42ab, 0x42ab,
-  0x42ab, 0x42cb, 0x42cb, 0x4b0c, 0x4b0c, 0x42ec, 0x42ec, 0x42ec,
-  0x4b0c, 0x4b0c, 0x4b0d, 0x4b2d, 0x4b4d, 0x536e, 0x536e, 0x538e,
-  0x53af, 0x5bcf, 0x5bf0, 0x5c31, 0x6451, 0x6c92, 0x6cd2, 0x74f3,
-  0x7d54, 0x8575, 0x8db6, 0x9617, 0xa678, 0xaed9, 0xbf1a, 0xc75b,
-  0xcf9b, 0xd7bc, 0xe7fc, 0xf7fd, 0xeffd, 0xe7fd, 0xdffd, 0xd7bc,
-  0xd77b, 0xcf7b, 0xb71a, 0xc71a, 0xc6fa, 0xa6b9, 0x9658, 0x9e59,
-  0x9e17, 0x8dd6, 0x95f7, 0x6d14, 0x95b6, 0xd6d9, 0xbe57, 0xdf3a,
-  0xa5b5, 0xced8, 0xc657, 0x8cf3, 0x8d13, 0xa5b5, 0xc616, 0x9d54,
-  0x8cb2, 0xc636, 0x7430, 0x63d0, 0x538f, 0x6c10, 0x8491, 0x63cf,
-  0x536d, 0x63af, 0x534d, 0x534e, 0x5b8e, 0x63cf, 0x7431, 0x8cb1,
-  0x94f2, 0x7c51, 0x5b4d, 0x7c10, 0xa533, 0x9490, 0xa554, 0x3a49,
-  0x29c8, 0x2987, 0x31e8, 0x5b2c, 0x5b2c, 0x4aaa, 0x4229, 0x4a69,
-  0x52aa, 0x6b8e, 0x6bae, 0x6b6d, 0x6b4d, 0x630c, 0x736d, 0x52aa,
-  0x5aca, 0x5aea, 0x630b, 0x736c, 0x734b, 0x736c, 0x630b, 0x630b,
-  0x632b, 0x52ca, 0x4aaa, 0x4a8a, 0x4a8a, 0x4249, 0x3a49, 0x3a28,
-  0x3a49, 0x3a49, 0x4acb, 0x4aab, 0x530c, 0x4aeb, 0x5b2c, 0x638e,
-  0x5b4d, 0x530c, 0x530c, 0x4249, 0x31e8, 0x426a, 0x52ab, 0x52ab,
-  0x6b8e, 0x7bee, 0x73ad, 0x842f, 0xb573, 0xce15, 0xe6d8, 0xef5a,
-  0xef5a, 0xef3a, 0xe719, 0xe6f9, 0xe6f9, 0xde98, 0xce36, 0xc5f5,
-  0xce36, 0xdeb8, 0xe71a, 0x9cf2, 0x8c70, 0x9cf2, 0xad53, 0xb594,
-  0xb594, 0xb594, 0xb594, 0xa512, 0x9cd1, 0x9cf2, 0xa532, 0xa553,
-  0xa553, 0xa574, 0xa553, 0xa553, 0x9d53, 0x9512, 0x94f2, 0x8cd2,
-  0x8cb1, 0x8491, 0x7c50, 0x7450, 0x7c50, 0x740f, 0x740f, 0x6c0f,
-  0x7450, 0x6bef, 0x63ae, 0x63ae, 0x63ae, 0x5b6e, 0x63ae, 0x63ae,
-  0x5b4d, 0x532d, 0x534d, 0x4b2d, 0x4b0c, 0x42cb, 0x42ab, 0x4aec,
-  0x42cb, 0x42cb, 0x4aec, 0x4aec, 0x42ab, 0x42cb, 0x42ab, 0x42ab,
-  0x4aec, 0x4aec, 0x42cb, 0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x4aec, 0x3a8a, 0x3a8a, 0x42ab, 0x42ab,
-  0x42ab, 0x428b, 0x428b, 0x42ab, 0x6c10, 0x6c10, 0x42cc, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x3a8b, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42cb, 0x42ab, 0x42cb, 0x42ec, 0x42cc, 0x42ec, 0x4b0c, 0x430c,
-  0x4b2d, 0x4b0d, 0x4b2d, 0x4b4d, 0x4b4d, 0x53ae, 0x53ae, 0x538e,
-  0x5bcf, 0x5bcf, 0x5bf0, 0x6430, 0x6451, 0x6c72, 0x6cb2, 0x74f3,
-  0x7d34, 0x8575, 0x8db6, 0x9617, 0xa678, 0xaed9, 0xb71a, 0xc75b,
-  0xcf9b, 0xd7bc, 0xe7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdffd, 0xd7bc,
-  0xd79b, 0xcf7b, 0xb71a, 0xc71a, 0xc71a, 0xb6da, 0x9e79, 0xa658,
-  0x9e37, 0x8df7, 0x9617, 0x7534, 0x95d6, 0xced8, 0xb5f6, 0xc677,
-  0xb616, 0xd6b8, 0xded9, 0x9534, 0xa595, 0xb5b5, 0xb5d5, 0x9513,
-  0x8471, 0xbe36, 0x6c10, 0x63f0, 0x5baf, 0x6bf0, 0x8492, 0x6c10,
-  0x5bae, 0x6bef, 0x4b2d, 0x4b0d, 0x534d, 0x63ef, 0x6bef, 0x8470,
-  0x8cb2, 0x7c71, 0x636e, 0x636e, 0xad53, 0xef59, 0x9cd2, 0x3a49,
-  0x29c8, 0x2987, 0x2987, 0x530c, 0x530b, 0x52aa, 0x4249, 0x4a69,
-  0x528a, 0x5acb, 0x52aa, 0x5acb, 0x632c, 0x73ae, 0x7bce, 0x5aca,
-  0x4a29, 0x5aca, 0x6b6c, 0x7b8c, 0x736b, 0x6b2b, 0x5aca, 0x52a9,
-  0x52aa, 0x52ca, 0x52ca, 0x4aaa, 0x3a29, 0x4249, 0x3a49, 0x3a49,
-  0x3a29, 0x4269, 0x3a49, 0x4acb, 0x4acb, 0x5b2c, 0x5b4d, 0x532c,
-  0x52ec, 0x5b2d, 0x6baf, 0x4249, 0x31e8, 0x426a, 0x4249, 0x634c,
-  0x842f, 0x7bee, 0x8c70, 0xa4f2, 0xbd94, 0xde97, 0xe6f9, 0xe719,
-  0xef5a, 0xef3a, 0xe73a, 0xef3a, 0xd698, 0xd677, 0xc5f5, 0xce16,
-  0xd698, 0xffde, 0xded8, 0xa512, 0x9490, 0x94b0, 0xad53, 0xb594,
-  0xb594, 0xad94, 0xad94, 0xa512, 0x9cf2, 0x9d12, 0xa553, 0xa553,
-  0xa574, 0x9d33, 0x9d13, 0x9d33, 0x9513, 0x94f2, 0x9513, 0x94f2,
-  0x84b1, 0x8491, 0x7c50, 0x740f, 0x6c0f, 0x6bef, 0x740f, 0x6bce,
-  0x9534, 0x8492, 0x638e, 0x5b6d, 0x638e, 0x5b8e, 0x5b6d, 0x5b8e,
-  0x5b6e, 0x534d, 0x532d, 0x532d, 0x532d, 0x4aec, 0x4aec, 0x4aec,
-  0x4acb, 0x4acc, 0x4aec, 0x42cb, 0x4aec, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x42cc, 0x4b0d, 0x4aec, 0x428a, 0x3a8a, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x428b, 0x42ab,
-  0x42ab, 0x42ab, 0x428b, 0x42ab, 0x5b8e, 0x4aec, 0x42ab, 0x42ab,
-  0x3a8b, 0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42ec, 0x42cc, 0x4aec, 0x4aec, 0x42ec, 0x4b0c, 0x430c, 0x430c,
-  0x4b0c, 0x4b0d, 0x4b2d, 0x4b4d, 0x4b4d, 0x538e, 0x538e, 0x53af,
-  0x5bcf, 0x5bd0, 0x5c10, 0x6431, 0x6451, 0x6c72, 0x6c92, 0x74f3,
-  0x7d34, 0x8575, 0x8db6, 0x9617, 0x9e78, 0xaed9, 0xb71a, 0xbf3a,
-  0xcf7b, 0xd7bc, 0xe7dc, 0xf7fd, 0xf7fd, 0xe7fd, 0xdffd, 0xdfbc,
-  0xd79c, 0xcf5b, 0xbf3b, 0xc71a, 0xc71a, 0xb6da, 0x9e79, 0xa678,
-  0x9e37, 0x8df7, 0x9617, 0x8575, 0x95b6, 0xced8, 0xbe57, 0xc678,
-  0xb617, 0xd6b9, 0xd6b9, 0x84d2, 0xadd5, 0xb595, 0xad74, 0x8491,
-  0x8c91, 0xadd5, 0x7430, 0x6c30, 0x538f, 0x7410, 0x94d2, 0x6bef,
-  0x6c10, 0x8cd2, 0x4aec, 0x4b0c, 0x534d, 0x63af, 0x5b8e, 0x8491,
-  0x7430, 0x6bef, 0x6bae, 0x6b8e, 0xc5f5, 0xe739, 0x5b2b, 0x426a,
-  0x29e8, 0x29a7, 0x2967, 0x530b, 0x52eb, 0x5b0c, 0x4a69, 0x39c7,
-  0x39a7, 0x39a7, 0x39a6, 0x39a7, 0x39e8, 0x528a, 0x6b2c, 0x5269,
-  0x4a48, 0x632b, 0x738d, 0x7bad, 0x734b, 0x6b2b, 0x62ea, 0x5289,
-  0x5aeb, 0x5b0c, 0x52eb, 0x3a28, 0x3a08, 0x3a08, 0x3a29, 0x428a,
-  0x3a6a, 0x4aab, 0x4acb, 0x426a, 0x4aab, 0x530c, 0x636d, 0x530c,
-  0x5b2d, 0x52ec, 0x4a8a, 0x3a29, 0x3a29, 0x4249, 0x5b2c, 0x94d2,
-  0x94d1, 0x9cb0, 0xad52, 0xc5f5, 0xbdb4, 0xdeb8, 0xef19, 0xef3a,
-  0xef3a, 0xef3a, 0xef3a, 0xe719, 0xd697, 0xce56, 0xb594, 0xb574,
-  0xd677, 0xef3a, 0xc5f4, 0xb594, 0x9cf2, 0x9cf2, 0xad74, 0xb5b4,
-  0xb5d5, 0xad94, 0xad74, 0x9d12, 0x9d12, 0x9d12, 0x9d13, 0xa553,
-  0x9d13, 0x94f2, 0x94f2, 0x9513, 0x94f3, 0x8cd2, 0x8cd2, 0x8491,
-  0x7c70, 0x7c30, 0x740f, 0x6bee, 0x6bce, 0x6bef, 0x6bcf, 0x63ae,
-  0x7430, 0x6bef, 0x636e, 0x5b8e, 0x5b6d, 0x5b8e, 0x5b6e, 0x63af,
-  0x9d75, 0x63af, 0x532d, 0x530c, 0x4b0c, 0x4acc, 0x4aec, 0x4acc,
-  0x4acc, 0x4acc, 0x4aec, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42ab,
-  0x42ab, 0x42ab, 0x4aec, 0x42ab, 0x42ab, 0x3a8a, 0x3a8a, 0x42ab,
-  0x428a, 0x4acc, 0x4acb, 0x428b, 0x42ab, 0x3a8a, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a8b,
-  0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42ab,
-  0x42ab, 0x42cc, 0x42ec, 0x42ec, 0x4b0c, 0x4b0c, 0x4b0c, 0x4b0c,
-  0x4b2d, 0x4b2d, 0x4b2d, 0x4b4d, 0x536e, 0x538e, 0x538e, 0x53af,
-  0x53af, 0x5bd0, 0x6410, 0x6431, 0x6451, 0x6471, 0x6c92, 0x74d3,
-  0x7d14, 0x8555, 0x8db6, 0x95f7, 0x9e78, 0xaed9, 0xb71a, 0xbf3a,
-  0xcf7b, 0xd7bc, 0xe7dc, 0xf7fd, 0xf7fd, 0xe7fd, 0xdffd, 0xdfbc,
-  0xd79c, 0xcf5b, 0xbf3a, 0xc71a, 0xc6fa, 0xaeb9, 0x9e58, 0xae99,
-  0xa658, 0x95f7, 0x8dd6, 0x8d96, 0x8d95, 0xced8, 0xbe57, 0xa5b6,
-  0xadb6, 0xdf19, 0xb5d6, 0x7cb2, 0xbe36, 0xb5f6, 0xb5d5, 0x84b1,
-  0x8492, 0x94f2, 0x7c70, 0x6c30, 0x536e, 0x7c71, 0x8c91, 0x7c71,
-  0x6c0f, 0x9d33, 0x4aec, 0x7471, 0x6bcf, 0x5b6e, 0x5b8e, 0x73ef,
-  0x7c50, 0x6bee, 0xad94, 0x9cf3, 0xce56, 0xc615, 0x4aaa, 0x3a4a,
-  0x3229, 0x29c8, 0x2987, 0x52eb, 0x52cb, 0x4aaa, 0x4a69, 0x4228,
-  0x39c7, 0x39a7, 0x39a7, 0x3186, 0x3186, 0x41e7, 0x4a49, 0x41e7,
-  0x5aca, 0x6b4c, 0x738d, 0x7bad, 0x7b8c, 0x736c, 0x6b2b, 0x5aca,
-  0x4a69, 0x4249, 0x3a08, 0x31c7, 0x31e8, 0x31e8, 0x428a, 0x3208,
-  0x3a8a, 0x3a4a, 0x4acc, 0x4aab, 0x4aab, 0x5b6d, 0x532c, 0x530c,
-  0x5b0c, 0x3a29, 0x3a08, 0x4249, 0x426a, 0x4a8a, 0x632c, 0x8c91,
-  0xb594, 0xad53, 0xbd94, 0xce36, 0xce56, 0xe6d9, 0xef5b, 0xf77b,
-  0xef3a, 0xe6f9, 0xded9, 0xded9, 0xd698, 0xbdb4, 0xbdd5, 0xa532,
-  0xb573, 0xc636, 0xbdb4, 0xa532, 0xb574, 0xad53, 0xb594, 0xb5b4,
-  0xb5b5, 0xad94, 0xa553, 0x94f2, 0x9cf2, 0x9d12, 0x9d13, 0xa533,
-  0xa533, 0x9d13, 0x94f2, 0x8cd2, 0x8cd2, 0x8cd2, 0x84b1, 0x7c71,
-  0x8471, 0x7c30, 0x740f, 0x6bce, 0x6bcf, 0x63ae, 0x63ae, 0x5b8e,
-  0x63cf, 0x63cf, 0x6bf0, 0x5b8e, 0x5b6d, 0x63ae, 0x5b6e, 0x63cf,
-  0x7430, 0x4aeb, 0x4b0c, 0x4b0c, 0x4aec, 0x4aec, 0x4acc, 0x4acc,
-  0x4acc, 0x42ab, 0x4aec, 0x4acb, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x4aec, 0x532d, 0x3a8a, 0x428b, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x3a8a, 0x428a, 0x3a8a, 0x42ab, 0x428a,
-  0x42ab, 0x3aab, 0x42ab, 0x3a8a, 0x3a8a, 0x3aab, 0x42ab, 0x3a8a,
-  0x428a, 0x428a, 0x42ab, 0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x42cb, 0x42ec, 0x42ec, 0x4b0c, 0x4b2d, 0x4b0d, 0x4b2d, 0x4b0c,
-  0x4b2d, 0x4b2d, 0x4b4d, 0x4b6e, 0x536e, 0x536e, 0x538f, 0x53af,
-  0x5bcf, 0x5bd0, 0x5bf0, 0x5c10, 0x6431, 0x6471, 0x6c92, 0x74d3,
-  0x7d14, 0x8555, 0x8db6, 0x95f7, 0x9e58, 0xaeb9, 0xb71a, 0xbf5b,
-  0xcf7b, 0xd7bc, 0xe7fc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfbc,
-  0xd79c, 0xc75b, 0xb71b, 0xbefa, 0xbef9, 0xaed9, 0x9e58, 0xa658,
-  0x9e17, 0x9617, 0x8db6, 0xa617, 0x8d96, 0xbe58, 0xb617, 0x9d95,
-  0x9d54, 0xe75a, 0xa595, 0x8d13, 0xc698, 0xbe36, 0xbe36, 0x7cb1,
-  0x7450, 0x8491, 0x9513, 0x5bae, 0x536e, 0x84b2, 0x8471, 0x7c71,
-  0x6bce, 0x740f, 0x536e, 0x6c0f, 0x7410, 0x7430, 0x6bce, 0x7c51,
-  0x8492, 0x6bae, 0xc615, 0xad53, 0x94b1, 0xd697, 0x7bef, 0x3a29,
-  0x3a29, 0x3209, 0x31c8, 0x4aaa, 0x4269, 0x4269, 0x4a8a, 0x740f,
-  0x5b2c, 0x4208, 0x41e8, 0x3186, 0x3186, 0x31a6, 0x39c7, 0x4a49,
-  0x6b2b, 0x736c, 0x73ae, 0x7bce, 0x83ee, 0x73ad, 0x630b, 0x5acb,
-  0x4a49, 0x31c7, 0x29a7, 0x29a7, 0x31c7, 0x3a29, 0x428a, 0x42cb,
-  0x6bf0, 0x6c11, 0x3a4a, 0x428a, 0x4acc, 0x5b4d, 0x4aec, 0x636e,
-  0x5b2d, 0x426a, 0x4a6a, 0x52ec, 0x4a6a, 0x52cb, 0x632c, 0x73ae,
-  0xa4f2, 0xc5d5, 0xd698, 0xe6f9, 0xded8, 0xe719, 0xef5b, 0xf77b,
-  0xef5a, 0xd697, 0xd697, 0xded8, 0xbdd5, 0xc616, 0xbdd5, 0xa532,
-  0xa512, 0xbdb5, 0xb553, 0xad53, 0xbdd5, 0xbdd5, 0xb5d5, 0xb5b5,
-  0xb5b5, 0xad94, 0xa553, 0x9cf2, 0x9d12, 0x9d12, 0xa533, 0xa554,
-  0xa553, 0x94f2, 0x8cf2, 0x8cf2, 0x8cb2, 0x84b1, 0x7c70, 0x7c71,
-  0x7c50, 0x7410, 0x6bcf, 0x638e, 0x63ae, 0x636e, 0x63cf, 0x5b6e,
-  0x5b6e, 0x6c10, 0x63cf, 0x5b6d, 0x5b6d, 0x5b6e, 0x534d, 0x5b4d,
-  0x4aec, 0x4aec, 0x4aec, 0x4acb, 0x4acb, 0x4aec, 0x4acb, 0x4acb,
-  0x4acc, 0x4b0c, 0x4acb, 0x42cb, 0x42ab, 0x42ab, 0x4acc, 0x42ab,
-  0x3aaa, 0x4aec, 0x638e, 0x3a8a, 0x42ab, 0x428b, 0x42ab, 0x3a8a,
-  0x428a, 0x3a6a, 0x428b, 0x4aec, 0x3a8a, 0x3a6a, 0x428a, 0x42cb,
-  0x42ab, 0x3aab, 0x42ab, 0x42ab, 0x3aab, 0x3a8a, 0x3a8a, 0x3a8a,
-  0x3a8a, 0x428b, 0x42ab, 0x3a8a, 0x42ab, 0x42ab, 0x42ab, 0x42cc,
-  0x4aec, 0x42ec, 0x4aec, 0x4b0c, 0x4b0c, 0x4b2d, 0x4b2d, 0x534d,
-  0x4b2d, 0x4b2d, 0x4b2d, 0x4b4e, 0x534e, 0x536e, 0x538e, 0x538f,
-  0x5baf, 0x5bd0, 0x5bf0, 0x6410, 0x6451, 0x6471, 0x6c92, 0x74d3,
-  0x7d34, 0x8575, 0x8d96, 0x95f6, 0x9e58, 0xa6b9, 0xb6fa, 0xbf3b,
-  0xcf7b, 0xd7bc, 0xe7fc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfdc,
-  0xd79c, 0xc75b, 0xb71b, 0xbf1a, 0xb6f9, 0xaed9, 0x9e78, 0xa658,
-  0xa658, 0x9637, 0x8dd6, 0x95b6, 0x95b6, 0xb617, 0xadd7, 0xbe58,
-  0xa575, 0xe73a, 0xa574, 0x8d33, 0xc677, 0xb5b4, 0xce77, 0x7c51,
-  0x7430, 0x9513, 0x9553, 0x6c10, 0x5bae, 0x8cd2, 0x7c51, 0x7c71,
-  0x7430, 0x84b2, 0x538e, 0x6bef, 0x94f2, 0x7c30, 0x7c30, 0x6bcf,
-  0x7c71, 0x8470, 0x94b1, 0xb594, 0x840f, 0xad74, 0x8c71, 0x3a6a,
-  0x324a, 0x3209, 0x3208, 0x4a8a, 0x3a28, 0x4aaa, 0x4aaa, 0x73ef,
-  0xa575, 0x5b0b, 0x5aab, 0x4a49, 0x39e7, 0x4208, 0x39e7, 0x5aaa,
-  0x736c, 0x7bcd, 0x7bce, 0x6b2c, 0x6b4c, 0x6b6d, 0x52cb, 0x4a8a,
-  0x39e8, 0x4249, 0x4aab, 0x31c7, 0x3a29, 0x3a49, 0x428a, 0x532d,
-  0x532d, 0x6bf0, 0x3a6a, 0x4acc, 0x530c, 0x4aec, 0x5b4d, 0x638e,
-  0x4aab, 0x3a29, 0x3a08, 0x31c8, 0x4aab, 0x52cb, 0x6bad, 0x73ae,
-  0x9491, 0xd677, 0xe71a, 0xef3a, 0xef1a, 0xef3a, 0xef5b, 0xf77b,
-  0xef3a, 0xce36, 0xbdf5, 0xdeb8, 0xbdd5, 0xbdf5, 0xad33, 0xa532,
-  0xbdd5, 0xa533, 0xa533, 0xa532, 0xb5d5, 0xc616, 0xb5b5, 0xbdd5,
-  0xad94, 0xad74, 0x94f2, 0x94f2, 0x9cf2, 0x9d12, 0x9d13, 0x9d13,
-  0x94f2, 0x8cb2, 0x8cb2, 0x8cb2, 0x8491, 0x7c50, 0x7c71, 0x7430,
-  0x740f, 0x6bae, 0x638e, 0x5b6d, 0x5b6e, 0x5b8e, 0x5b8e, 0x5b6e,
-  0x5b4d, 0x6bf0, 0x5b6d, 0x532d, 0x536d, 0x534d, 0x5b6d, 0x534d,
-  0x5b4d, 0x5b4d, 0x5b6e, 0x530c, 0x4acb, 0x42ab, 0x4acc, 0x42ab,
-  0x42cb, 0x42ab, 0x42ab, 0x42ab, 0x42aa, 0x42ab, 0x42ab, 0x42ab,
-  0x428b, 0x42ab, 0x4aec, 0x428b, 0x42ab, 0x4acc, 0x530d, 0x3a6a,
-  0x428b, 0x3a6a, 0x3a6a, 0x42ab, 0x3a6a, 0x428b, 0x3a8a, 0x42ab,
-  0x42ab, 0x3a8b, 0x3aab, 0x42ab, 0x42cb, 0x3a8b, 0x3a8b, 0x428b,
-  0x42ab, 0x3a8b, 0x3a8b, 0x3a8a, 0x3aab, 0x42ab, 0x42ab, 0x42ab,
-  0x42cc, 0x42ec, 0x42ec, 0x4aec, 0x4b2d, 0x4b4e, 0x4b2d, 0x4b4d,
-  0x5b6d, 0x63ae, 0x6bef, 0x740f, 0x740f, 0x6bef, 0x63cf, 0x5baf,
-  0x5baf, 0x5bcf, 0x5bf0, 0x6410, 0x6451, 0x6c71, 0x6cb2, 0x74d3,
-  0x7d14, 0x8555, 0x8596, 0x8df6, 0x9e58, 0xa6b9, 0xb6fa, 0xbf3a,
-  0xcf7b, 0xd7bc, 0xdffc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfdc,
-  0xdf9c, 0xc75b, 0xb71a, 0xbefa, 0xbef9, 0xa6b9, 0x9658, 0xa678,
-  0x9e58, 0x9e17, 0x95d6, 0xa637, 0xae37, 0xb658, 0xb5f6, 0xa5b5,
-  0xb5f6, 0xe71a, 0xc657, 0x9d33, 0xc656, 0xad94, 0xd697, 0x8cd2,
-  0xa553, 0xa574, 0x8491, 0x63ef, 0x5baf, 0x63f0, 0x6bf0, 0x7430,
-  0x7c30, 0x8491, 0x536e, 0x6c0f, 0xb5d5, 0x73ee, 0x7430, 0x5b6e,
-  0x6bef, 0xdf19, 0x9cd2, 0x8c71, 0x7c10, 0x4acb, 0x5b4d, 0x4b0d,
-  0x3a6a, 0x3a2a, 0x31e8, 0x4269, 0x4249, 0x4aaa, 0x4aaa, 0x6bcf,
-  0xbe79, 0x73ef, 0x4249, 0x4228, 0x39e7, 0x4a69, 0x4a49, 0x632c,
-  0x83ee, 0x83ee, 0x7bad, 0x630c, 0x5b0c, 0x52aa, 0x4a6a, 0x31c8,
-  0x31a7, 0x3a08, 0x426a, 0x4a8a, 0x31e8, 0x426a, 0x3a6a, 0x3a69,
-  0x4acb, 0x3209, 0x4acb, 0x5b4e, 0x530c, 0x4aec, 0x5b4d, 0x4aec,
-  0x4aaa, 0x31e8, 0x31a7, 0x4229, 0x634d, 0x73cf, 0x7c0f, 0x842f,
-  0x9cd2, 0xd677, 0xef3a, 0xef3a, 0xef3a, 0xef3a, 0xde98, 0xded9,
-  0xce36, 0xce57, 0xb5b4, 0xd6b8, 0xbdd5, 0xc636, 0xb5b4, 0xad53,
-  0xad33, 0xa533, 0x9cf2, 0xa533, 0xb5b5, 0xb5b5, 0xb5b5, 0xb5d5,
-  0xadb5, 0xa574, 0x9d13, 0x94d2, 0x94d2, 0x94f2, 0x94f2, 0x94f2,
-  0x94d2, 0x8491, 0x8471, 0x8491, 0x7c50, 0x7c71, 0x7c51, 0x740f,
-  0x6bef, 0x63ae, 0x5b6d, 0x5b6d, 0x5b4d, 0x5b4d, 0x5b6e, 0x5b6d,
-  0x638e, 0x63ae, 0x534d, 0x534d, 0x534d, 0x534d, 0x5b6d, 0x534d,
-  0x5b8e, 0x5b4d, 0x63ae, 0x532d, 0x4acb, 0x42ab, 0x42ab, 0x428a,
-  0x42ab, 0x42ab, 0x42aa, 0x42ab, 0x428a, 0x42ab, 0x428a, 0x428a,
-  0x428b, 0x42ab, 0x4acb, 0x42ab, 0x4aab, 0x3a6a, 0x428a, 0x428a,
-  0x428a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a6a, 0x428a, 0x3a6a, 0x3a8a,
-  0x42ab, 0x42ab, 0x42cb, 0x42ab, 0x3a8b, 0x3aab, 0x3a8b, 0x3a8b,
-  0x3a8b, 0x3a8b, 0x42cb, 0x42cb, 0x42cb, 0x42ab, 0x42ab, 0x42ab,
-  0x42cb, 0x42ec, 0x4b0d, 0x4b2d, 0x4b0d, 0x4b0c, 0x63cf, 0x94f3,
-  0xc678, 0xe73b, 0xef7b, 0xe77c, 0xe77c, 0xdf5b, 0xcefa, 0xbe78,
-  0xa5d6, 0x8d34, 0x74b2, 0x6c71, 0x6c71, 0x6c71, 0x6cb2, 0x74d3,
-  0x7d14, 0x7d54, 0x8596, 0x8dd6, 0x9e38, 0xa699, 0xb6f9, 0xbf3a,
-  0xc77b, 0xd7bc, 0xdffc, 0xf7fd, 0xf7fd, 0xeffd, 0xe7fd, 0xdfdc,
-  0xdfbc, 0xc75b, 0xb71b, 0xb6fa, 0xbefa, 0xa699, 0x9e79, 0x9e58,
-  0x9e38, 0x9df7, 0x95b6, 0xae38, 0xbe78, 0xae17, 0xc698, 0x9575,
-  0xceb8, 0xef5a, 0xc677, 0xadb5, 0xd6d8, 0xb5b5, 0xce77, 0xad95,
-  0xa573, 0x9d33, 0x7c92, 0x63af, 0x6bf0, 0x63af, 0x6c0f, 0x6bef,
-  0x8491, 0x8c91, 0x534e, 0x63cf, 0xc636, 0x8c91, 0x638d, 0x5b6d,
-  0x532d, 0xc677, 0x7c0f, 0x630c, 0x6b6d, 0x42ab, 0x638e, 0x5b6d,
-  0x42ab, 0x3a4a, 0x31e8, 0x4269, 0x4a8a, 0x4aaa, 0x52cb, 0x4269,
-  0x8cd3, 0x9d55, 0x638d, 0x4249, 0x39e7, 0x39e7, 0x4a48, 0x6b4c,
-  0x840e, 0x73ad, 0x6b4c, 0x630c, 0x52cb, 0x3a08, 0x31a7, 0x2987,
-  0x31a7, 0x3a29, 0x31e8, 0x31c8, 0x31c7, 0x428a, 0x428a, 0x3a6a,
-  0x3209, 0x4acb, 0x63cf, 0x9534, 0x9535, 0x5b6d, 0x530c, 0x530c,
-  0x426a, 0x3a29, 0x4249, 0x52cc, 0x52cb, 0x7bcf, 0x8c91, 0xb574,
-  0xd698, 0xd698, 0xef3a, 0xef3a, 0xef3a, 0xef3a, 0xd698, 0xce57,
-  0xd678, 0xd6b9, 0xb5b4, 0xbdb5, 0xc616, 0xce37, 0xad74, 0xad53,
-  0xad33, 0xa553, 0xad53, 0xb595, 0xb5b5, 0xad95, 0xb5b5, 0xb5d5,
-  0xad94, 0xa554, 0x9d33, 0x8cb1, 0x8c91, 0x8cb1, 0x94f2, 0x94f2,
-  0x8cb1, 0x7c50, 0x7c70, 0x8491, 0x8471, 0x7430, 0x6bcf, 0x6bcf,
-  0x6bef, 0x63ae, 0x638e, 0x5b2d, 0x5b2d, 0x534d, 0x534d, 0x63cf,
-  0x5b6d, 0x63ae, 0x5b6d, 0x532d, 0x532d, 0x532d, 0x532d, 0x532d,
-  0x4aec, 0x4b0c, 0x532d, 0x4aec, 0x42ab, 0x428a, 0x428a, 0x42ab,
-  0x428a, 0x428a, 0x428a, 0x42ab, 0x428a, 0x42ab, 0x42ab, 0x428a,
-  0x428a, 0x428a, 0x428b, 0x42ab, 0x42ab, 0x532d, 0x42ab, 0x42ab,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a6a, 0x3a8a,
-  0x3a8a, 0x3a8b, 0x3a8b, 0x3a8b, 0x42ab, 0x42ab, 0x42ab, 0x3a8b,
-  0x3a8b, 0x3a8a, 0x3a8b, 0x42ab, 0x42cb, 0x42ab, 0x42ab, 0x42cc,
-  0x4b0d, 0x4b2d, 0x430c, 0x5bae, 0x9513, 0xce99, 0xf7be, 0xffff,
-  0xffff, 0xefdd, 0xdf9b, 0xd75a, 0xcf1a, 0xc6f9, 0xbed9, 0xbed9,
-  0xb698, 0xae37, 0x9575, 0x7cf3, 0x74d3, 0x74d2, 0x74d2, 0x74d3,
-  0x74f3, 0x7d34, 0x8575, 0x8dd6, 0x9637, 0xa699, 0xaed9, 0xbf3a,
-  0xc77b, 0xd7bc, 0xdffc, 0xf7fd, 0xfffe, 0xeffd, 0xe7fd, 0xdfdc,
-  0xdfbc, 0xc75b, 0xb73b, 0xaefa, 0xb6f9, 0xa699, 0x9658, 0x9e38,
-  0xa658, 0x95f7, 0x95f7, 0xae38, 0xc698, 0xa5d6, 0xd6d9, 0x9575,
-  0xbe37, 0xef5a, 0xadb4, 0xb5f6, 0xd6b8, 0xadb5, 0xb5d6, 0x94f2,
-  0xad94, 0xa554, 0x534e, 0x63af, 0x73f0, 0x5b6d, 0x7c70, 0x63ae,
-  0x8cf2, 0x8cb2, 0x538f, 0x6bf0, 0xbdf5, 0x9d33, 0x532c, 0x532c,
-  0x532d, 0x9513, 0x94d1, 0x6b8e, 0xa554, 0x4aec, 0x4aeb, 0x634d,
-  0x4acc, 0x428a, 0x3a29, 0x4aca, 0x634d, 0x52eb, 0x52cb, 0x4a8a,
-  0x4aaa, 0x6bcf, 0x7c51, 0x52ec, 0x39e8, 0x39e7, 0x4248, 0x630b,
-  0x7bce, 0x73ad, 0x5b0b, 0x4a6a, 0x4229, 0x2986, 0x2966, 0x2986,
-  0x31e8, 0x426a, 0x4aab, 0x424a, 0x29a7, 0x428a, 0x428a, 0x42aa,
-  0x428b, 0x5b4e, 0x8d13, 0xefbe, 0xffff, 0xb638, 0x6baf, 0x52ec,
-  0x52ec, 0x4aab, 0x426a, 0x4aaa, 0x73ae, 0x9491, 0xad74, 0xd677,
-  0xe71a, 0xef3a, 0xef5a, 0xef3a, 0xe6f9, 0xdeb8, 0xce57, 0xbdb4,
-  0xad53, 0xbdb5, 0xc5f6, 0xad74, 0xb5b5, 0xc5f6, 0xb574, 0xb594,
-  0xc616, 0xce78, 0xc616, 0xb5d5, 0xb5d6, 0xad94, 0xad95, 0xad95,
-  0xa574, 0xa554, 0x9d13, 0x8cb1, 0x8cb1, 0x8cb1, 0x8cd2, 0x8cd2,
-  0x8471, 0x7c70, 0x7c71, 0x7c50, 0x7450, 0x7430, 0x7410, 0x7410,
-  0x6bef, 0x638e, 0x5b4d, 0x532d, 0x530d, 0x5b4d, 0x5b4d, 0x6bef,
-  0x532d, 0x5b6d, 0x532d, 0x532d, 0x530c, 0x4b0c, 0x532c, 0x534d,
-  0x4b0c, 0x4b0c, 0x4aec, 0x42ab, 0x428a, 0x428a, 0x428a, 0x428a,
-  0x428a, 0x428a, 0x428a, 0x428a, 0x428a, 0x3a6a, 0x4aab, 0x42ab,
-  0x42ab, 0x4acc, 0x42ab, 0x42ab, 0x3a8a, 0x5b8e, 0x534d, 0x3a6a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x428a, 0x3a8a, 0x3a6a, 0x3a8a, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x3aab, 0x42ab, 0x3aab, 0x3a8a, 0x42ec, 0x42ec, 0x42cb, 0x42cc,
-  0x430c, 0x6c0f, 0xb637, 0xef9d, 0xffff, 0xffff, 0xe7dd, 0xdf9c,
-  0xcf5b, 0xbed9, 0xb6b8, 0xae77, 0xa616, 0x95b5, 0x8d74, 0x8d54,
-  0x8533, 0x8d34, 0x7cd2, 0x7492, 0x74b2, 0x74d2, 0x74d2, 0x74f3,
-  0x7d14, 0x7d34, 0x8575, 0x8dd6, 0x9637, 0xa679, 0xaed9, 0xb73a,
-  0xc77b, 0xd7bc, 0xdffc, 0xf7fd, 0xfffe, 0xeffd, 0xe7fd, 0xdfdc,
-  0xdfbc, 0xc75b, 0xb73b, 0x9ed9, 0xb6da, 0xaeb9, 0x8e38, 0x8e18,
-  0xa638, 0xa637, 0x9617, 0xa618, 0xcefa, 0xae17, 0xc657, 0xadf6,
-  0xb616, 0xe73a, 0xce78, 0xadb5, 0xb5b5, 0xb5d6, 0x9d34, 0x7c70,
-  0xbdf6, 0xbe37, 0x4b2d, 0x536e, 0x8471, 0x5b8e, 0x5b6d, 0x534e,
-  0x84d2, 0x84b1, 0x5bcf, 0x7430, 0xce56, 0xb5d5, 0x63ae, 0x4b0d,
-  0x534d, 0x638e, 0xa553, 0x634d, 0x7c10, 0x5b6d, 0x4acc, 0x6bae,
-  0x530d, 0x4acc, 0x4aab, 0x6bae, 0x7c30, 0x740f, 0x5b2c, 0x4249,
-  0x3a29, 0x3a28, 0x3a08, 0x3a29, 0x3a08, 0x4249, 0x4a69, 0x5aeb,
-  0x632c, 0x5aeb, 0x4a8a, 0x39e8, 0x31c7, 0x31a7, 0x2946, 0x2966,
-  0x31c7, 0x428b, 0x5b4e, 0x63af, 0x7c93, 0x42ac, 0x3229, 0x3a49,
-  0x5b6e, 0x6bf0, 0x84d3, 0xd6fb, 0xffff, 0xef9d, 0x8cd2, 0x6bae,
-  0x6b8e, 0x4a8a, 0x52eb, 0x8430, 0x94d2, 0xad53, 0xce37, 0xdeb8,
-  0xded8, 0xef5a, 0xe71a, 0xded9, 0xce77, 0xdeb8, 0xbdf5, 0xad52,
-  0x9cf2, 0xad33, 0xb594, 0xb5b5, 0xbdd5, 0xc636, 0xbdf6, 0xb5d5,
-  0xbe16, 0xce98, 0xce78, 0xbe16, 0xb5d5, 0xad95, 0xb5d6, 0xa574,
-  0xa554, 0x9d33, 0x94d2, 0x8c91, 0x8cd2, 0x8cb1, 0x94d2, 0x94d2,
-  0x8471, 0x7c50, 0x7410, 0x7430, 0x7430, 0x7410, 0x7410, 0x6c10,
-  0x63ef, 0x63cf, 0x5b6e, 0x530d, 0x532d, 0x5b4d, 0x63ae, 0x63ae,
-  0x5b6e, 0x534d, 0x4acb, 0x530c, 0x532d, 0x4b0c, 0x4b0c, 0x532d,
-  0x4aec, 0x4b0c, 0x4acc, 0x4acc, 0x42ab, 0x4acb, 0x42ab, 0x428a,
-  0x428a, 0x42ab, 0x426a, 0x428a, 0x428a, 0x42ab, 0x428a, 0x428a,
-  0x428a, 0x4aec, 0x42ab, 0x428a, 0x3a8a, 0x42ab, 0x42ab, 0x3a6a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3aaa, 0x42ab, 0x4aec, 0x42cb,
-  0x3aab, 0x3aab, 0x3aaa, 0x3a8a, 0x42ec, 0x42ec, 0x3acb, 0x42eb,
-  0x9d55, 0xf7de, 0xffff, 0xf7fe, 0xdf9c, 0xcf5b, 0xc71a, 0xbef9,
-  0xae98, 0x95f6, 0x8d95, 0x8554, 0x7cf3, 0x6c91, 0x6430, 0x6430,
-  0x6430, 0x6450, 0x6451, 0x6451, 0x6c91, 0x6cb2, 0x74d2, 0x74f3,
-  0x7d34, 0x7d55, 0x8575, 0x8dd6, 0x9637, 0xa678, 0xaed9, 0xb73a,
-  0xc77b, 0xd7bc, 0xdffc, 0xf7fd, 0xfffe, 0xeffd, 0xe7fd, 0xdfdc,
-  0xdfbc, 0xc75b, 0xaf3a, 0x9eda, 0xb6d9, 0xb6da, 0x8e58, 0x85f7,
-  0x9e38, 0xae57, 0x95f7, 0x9dd6, 0xd6fa, 0xae16, 0xceb9, 0xce99,
-  0xadd5, 0xe719, 0xce98, 0xbe16, 0xce77, 0x9d33, 0x8471, 0x7c92,
-  0xc658, 0x94d2, 0x4b0c, 0x534d, 0x8cd2, 0x63af, 0x5b6e, 0x536f,
-  0x84d2, 0x9d33, 0x63f0, 0x7450, 0xc635, 0xb594, 0x6bef, 0x42cb,
-  0x532c, 0x73ef, 0xbdf6, 0x7c30, 0x8450, 0x7c50, 0x4acb, 0x534d,
-  0x5b4d, 0x4aec, 0x530c, 0x7430, 0x7c50, 0x5b4c, 0x4aaa, 0x4229,
-  0x4a8a, 0x39e8, 0x39e8, 0x29a7, 0x31c7, 0x4229, 0x52ab, 0x52ab,
-  0x52eb, 0x52cb, 0x4a8a, 0x4249, 0x39e8, 0x2966, 0x2145, 0x2966,
-  0x2987, 0x3a29, 0x3209, 0x63d0, 0xc6fc, 0x536f, 0x29c8, 0x428b,
-  0x6bcf, 0x7c51, 0x7c51, 0x9533, 0xe79d, 0xbe58, 0x7c30, 0x73ef,
-  0x52ec, 0x5b0c, 0x9d13, 0xa574, 0xa533, 0xbdd5, 0xdeb8, 0xd678,
-  0xd677, 0xded8, 0xded9, 0xc5f5, 0xad53, 0xb5b5, 0xc616, 0xc636,
-  0xc616, 0xce78, 0xbdd5, 0xce57, 0xd698, 0xd6b9, 0xbdf6, 0xb5b5,
-  0xb5d5, 0xce57, 0xce77, 0xb5b5, 0xa594, 0xa595, 0xa574, 0x9d54,
-  0x9d33, 0x9d13, 0x94d2, 0x8470, 0x8491, 0x8491, 0x8cb1, 0x8471,
-  0x7c50, 0x7430, 0x7410, 0x7410, 0x7430, 0x6bef, 0x6c10, 0x63cf,
-  0xa596, 0xc69a, 0x7431, 0x530d, 0x532d, 0x5b8e, 0x5b6d, 0x5b8e,
-  0x5b6e, 0x534d, 0x532d, 0x4aec, 0x4aec, 0x4aec, 0x530c, 0x530c,
-  0x4aec, 0x532d, 0x4aec, 0x52ec, 0x4aab, 0x4aab, 0x4acb, 0x42ab,
-  0x42ab, 0x3a6a, 0x428a, 0x4aab, 0x428a, 0x428a, 0x428a, 0x428a,
-  0x428a, 0x428a, 0x428b, 0x4aab, 0x4acb, 0x42ab, 0x3a6a, 0x3a6a,
-  0x428a, 0x428a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a4a, 0x3a6a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8b, 0x3aab, 0x42ec, 0x42cb,
-  0x3a8a, 0x42ab, 0x3a8b, 0x3aab, 0x3aab, 0x3aab, 0x4b0c, 0xc679,
-  0xffff, 0xf7fe, 0xe7dc, 0xd77b, 0xc73a, 0xbf1a, 0xae98, 0x9e16,
-  0x8575, 0x74d2, 0x6471, 0x5c10, 0x53cf, 0x53ae, 0x4b8e, 0x4b6e,
-  0x538e, 0x53af, 0x5bef, 0x5c10, 0x6451, 0x6c92, 0x6cd2, 0x74d3,
-  0x7d34, 0x8575, 0x8575, 0x8db6, 0x9617, 0x9e78, 0xaed9, 0xb71a,
-  0xc77b, 0xd7bc, 0xdffc, 0xf7fe, 0xfffe, 0xeffd, 0xe7fd, 0xdfdc,
-  0xdfbc, 0xcf7b, 0xaf1a, 0x9ed9, 0xb6d9, 0xb6b9, 0x8e58, 0x7df7,
-  0x9e37, 0xc6d9, 0x95d6, 0x9df6, 0xd71a, 0xa5b5, 0xc698, 0xce99,
-  0x9d54, 0xdef9, 0xc657, 0xc656, 0xded8, 0xadd6, 0x8471, 0x84d3,
-  0xb5d6, 0x8491, 0x4b0c, 0x4b2d, 0x73f0, 0x63cf, 0x6bef, 0x5b8e,
-  0x7c50, 0xadb4, 0x6c10, 0x84b1, 0xd696, 0xb5d5, 0x5b6d, 0x42cb,
-  0x530c, 0x5b4d, 0x73ae, 0x94f2, 0x6bad, 0x94f2, 0x5b4d, 0x42ab,
-  0x5b4d, 0x532c, 0x530d, 0x8492, 0x8491, 0x8471, 0x5b2c, 0x3a08,
-  0x3a08, 0x31a7, 0x31c7, 0x29a7, 0x2987, 0x3a29, 0x424a, 0x3a08,
-  0x3208, 0x4acb, 0x4249, 0x3a29, 0x39e8, 0x31c7, 0x31a7, 0x2987,
-  0x2987, 0x31c8, 0x29e8, 0x8514, 0xd79e, 0x4b0d, 0x31c8, 0x532d,
-  0x6bcf, 0x7c30, 0x7c50, 0x7c50, 0x8cd2, 0x8471, 0x7c10, 0x73ce,
-  0x5b0c, 0xa574, 0xc657, 0xa553, 0xb5b5, 0xd698, 0xdeb8, 0xd677,
-  0xce57, 0xce57, 0xbdd5, 0xad33, 0x9491, 0xa512, 0xce56, 0xdef9,
-  0xd698, 0xce77, 0xce57, 0xc637, 0xce77, 0xc636, 0xbdf6, 0xbdd6,
-  0xbe16, 0xc637, 0xd6b9, 0xbe16, 0xa594, 0x9d33, 0xa574, 0xa554,
-  0x94f2, 0x94f2, 0x8cd2, 0x7c50, 0x7c2f, 0x8470, 0x8cd2, 0x7c71,
-  0x7430, 0x7430, 0x740f, 0x6c0f, 0x6bef, 0x63ae, 0x6bcf, 0x63cf,
-  0x8d34, 0xcf1c, 0x5b8e, 0x5b4d, 0x5b4d, 0x534d, 0x532d, 0x534d,
-  0x4aeb, 0x532d, 0x530c, 0x4aec, 0x530c, 0x4aec, 0x4aec, 0x4acc,
-  0x4acc, 0x4b0c, 0x4aec, 0x4aec, 0x42ab, 0x428a, 0x42ab, 0x4aab,
-  0x4aab, 0x42ab, 0x426a, 0x426a, 0x3a6a, 0x426a, 0x4aab, 0x4acb,
-  0x4acb, 0x42ab, 0x428a, 0x428a, 0x428a, 0x3a6a, 0x3a6a, 0x426a,
-  0x3a6a, 0x3a6a, 0x428a, 0x428b, 0x428b, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a8b, 0x3a8a, 0x3a8a,
-  0x3a8a, 0x3a8a, 0x3a8a, 0x3aab, 0x3a8a, 0x5b8e, 0xdf1b, 0xffff,
-  0xf7de, 0xdfbc, 0xdf9c, 0xcf3a, 0xbefa, 0xa678, 0x8db5, 0x7513,
-  0x6492, 0x5bef, 0x4b8e, 0x4b4d, 0x432d, 0x430c, 0x432c, 0x4b2d,
-  0x4b4d, 0x4b8e, 0x53ae, 0x5bef, 0x5c30, 0x6471, 0x6cb2, 0x74f3,
-  0x7513, 0x7d34, 0x8575, 0x8db6, 0x9617, 0x9e78, 0xaeb9, 0xb71a,
-  0xc77b, 0xcfbc, 0xdffc, 0xf7fd, 0xfffe, 0xeffd, 0xe7fd, 0xdfdc,
-  0xdfbc, 0xcf7b, 0xa71a, 0x96d9, 0xb6d9, 0xaeb9, 0x9658, 0x8617,
-  0xa658, 0xced9, 0x95d6, 0x9e37, 0xd6f9, 0xb617, 0xce99, 0xce98,
-  0xa594, 0xd6b7, 0xce98, 0xce77, 0xbe16, 0x7c30, 0x9533, 0x8492,
-  0xa575, 0x94f3, 0x430c, 0x532d, 0x6b8e, 0x5b8e, 0x7451, 0x5b6e,
-  0x7c50, 0xb5f5, 0x7430, 0x9d33, 0xbdf4, 0x94f2, 0x4aec, 0x4aec,
-  0x532d, 0x530c, 0x5b4c, 0x8490, 0x6bae, 0x8450, 0x6bcf, 0x42cb,
-  0x5b4d, 0x5b4d, 0x5b2d, 0x7430, 0x6bee, 0x6bae, 0x428a, 0x31c7,
-  0x2986, 0x2966, 0x31a7, 0x4a8a, 0x39e8, 0x4a6a, 0x3a08, 0x31e7,
-  0x3a28, 0x4249, 0x4249, 0x3a28, 0x4a8a, 0x3a08, 0x31e8, 0x2987,
-  0x29a7, 0x29a7, 0x3209, 0x6bf0, 0x63f0, 0x3a4a, 0x426a, 0x5b6d,
-  0x63cf, 0x7c30, 0x8491, 0x73cf, 0x73cf, 0x5b2c, 0x4acb, 0x6b8d,
-  0xa574, 0xc678, 0xadb4, 0xa532, 0xd698, 0xd677, 0xc636, 0xd677,
-  0xce36, 0xc5f6, 0xb5b5, 0xad74, 0xb595, 0xbe16, 0xd698, 0xd6b8,
-  0xce57, 0xd698, 0xd698, 0xce57, 0xc637, 0xce77, 0xc637, 0xbe16,
-  0xbe36, 0xc677, 0xe75b, 0xb616, 0xa574, 0x9d33, 0x9d54, 0x9d33,
-  0x9513, 0x8cd2, 0x8491, 0x8491, 0x740f, 0x7c2f, 0x8cb1, 0x7c71,
-  0x740f, 0x6bef, 0x6bef, 0x6bcf, 0x63ae, 0x6bef, 0x63af, 0x63ae,
-  0x6c10, 0x63ef, 0x5b8e, 0x5b6d, 0x5b4d, 0x5b6e, 0x534d, 0x5b4d,
-  0x4aec, 0x532d, 0x4aeb, 0x4acb, 0x4acb, 0x4aec, 0x4acb, 0x4aec,
-  0x4acc, 0x4acc, 0x42cb, 0x5b6e, 0x7c92, 0x530c, 0x426a, 0x5b4d,
-  0x638e, 0x530c, 0x428a, 0x3a6a, 0x428a, 0x426a, 0x426a, 0x3a6a,
-  0x3a6a, 0x428a, 0x428a, 0x428a, 0x426a, 0x3a6a, 0x428a, 0x3a8a,
-  0x4aec, 0x3a8a, 0x3a6a, 0x3a6a, 0x3a8a, 0x428b, 0x3a6a, 0x3a4a,
-  0x3a4a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a8a, 0x3a8a,
-  0x3a8a, 0x3a8a, 0x3aab, 0x3aab, 0x534d, 0xdf3c, 0xffff, 0xefdd,
-  0xdfbb, 0xd79b, 0xc71a, 0xa678, 0x95f6, 0x7d54, 0x6cb2, 0x4bcf,
-  0x4b4d, 0x42ec, 0x3acb, 0x3acb, 0x3acb, 0x3acb, 0x42ec, 0x430c,
-  0x4b2d, 0x4b6e, 0x4b8e, 0x53cf, 0x5c10, 0x6471, 0x6c92, 0x74f3,
-  0x7513, 0x7d54, 0x8575, 0x8db6, 0x9617, 0x9e78, 0xaeb9, 0xb71a,
-  0xc77b, 0xcfbc, 0xdffc, 0xf7fd, 0xfffe, 0xf7fd, 0xe7fd, 0xdfdc,
-  0xdfbc, 0xd79c, 0xaf1a, 0x9eba, 0xc73a, 0xa698, 0x9e78, 0x8e38,
-  0x9e38, 0xced9, 0x95f6, 0x9e37, 0xd6f9, 0xc678, 0xbe77, 0xc657,
-  0xa5b5, 0xce77, 0xce78, 0xd6b9, 0xb5f6, 0x6c0f, 0x8cd2, 0x7430,
-  0x94f2, 0x7c71, 0x430c, 0x4b2d, 0x6bcf, 0x5b6e, 0x6c10, 0x63cf,
-  0x6bef, 0xb5b4, 0x8491, 0xbdd4, 0xb5b4, 0x4aec, 0x4aac, 0x4acc,
-  0x532d, 0x532d, 0x4b2c, 0x6bce, 0x5b4d, 0x73ef, 0x638d, 0x4aec,
-  0x530c, 0x5b4d, 0x5b4d, 0x740f, 0x6bce, 0x4249, 0x31c7, 0x29a7,
-  0x2987, 0x29a7, 0x31c8, 0x31c7, 0x31c7, 0x39e8, 0x3a08, 0x3a08,
-  0x31e8, 0x3a29, 0x4aab, 0x426a, 0x52cb, 0x4249, 0x3a08, 0x29a7,
-  0x2987, 0x29a7, 0x31c8, 0x29a7, 0x31c8, 0x52cc, 0x5b2d, 0x530c,
-  0x638e, 0x740f, 0x8c92, 0x5b2c, 0x4aaa, 0x4a8a, 0x4aaa, 0x5b0c,
-  0x8c91, 0xad94, 0x9d33, 0xbdf6, 0xd678, 0xc5f6, 0xbdd5, 0xbdd5,
-  0xbdf5, 0xc616, 0xce57, 0xce37, 0xc637, 0xce57, 0xd698, 0xded9,
-  0xded9, 0xded9, 0xdeb9, 0xce77, 0xd698, 0xd6b8, 0xc636, 0xbe16,
-  0xbe16, 0xb5f6, 0xc678, 0xadd6, 0x9513, 0x8cf2, 0x9533, 0x8cf3,
-  0x9513, 0x8cd2, 0x7c50, 0x7c50, 0x7c30, 0x740f, 0x7430, 0x7c71,
-  0x7430, 0x6bef, 0x6bcf, 0x6bef, 0x63ce, 0x63ae, 0x63ae, 0x63cf,
-  0x63af, 0x5b4d, 0x5b6d, 0x5b6e, 0x5b4d, 0x532d, 0x534d, 0x4b0c,
-  0x4aec, 0x4aec, 0x42ab, 0x4aec, 0x4aab, 0x4acb, 0x42ab, 0x42ab,
-  0x4acb, 0x42ab, 0x4aec, 0x534d, 0x6c10, 0x42ab, 0x426a, 0x4aab,
-  0x42ab, 0x3a6a, 0x428a, 0x428a, 0x428a, 0x426a, 0x426a, 0x3a4a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x428a, 0x3a6a, 0x3a6a,
-  0x42ab, 0x3a6a, 0x3a4a, 0x3a8a, 0x4acc, 0x426a, 0x3a4a, 0x3a6a,
-  0x3a6a, 0x3a8a, 0x3a4a, 0x3a6a, 0x3a8a, 0x3a8a, 0x3a8a, 0x3a8a,
-  0x3a8a, 0x3a8a, 0x32aa, 0x3aaa, 0xce9a, 0xffff, 0xe7dd, 0xd79b,
-  0xd79b, 0xbef9, 0x9e16, 0x7d34, 0x6491, 0x4b8e, 0x432c, 0x3aab,
-  0x3a8a, 0x326a, 0x326a, 0x3a8a, 0x3a8a, 0x3aab, 0x3acb, 0x42ec,
-  0x430c, 0x4b4d, 0x4b8e, 0x53cf, 0x5c10, 0x6451, 0x6492, 0x6cd2,
-  0x74f3, 0x7d54, 0x8596, 0x8db6, 0x95f7, 0x9e58, 0xa6b9, 0xb71a,
-  0xc75b, 0xcfbc, 0xdffc, 0xeffd, 0xfffe, 0xf7fd, 0xeffd, 0xdfdc,
-  0xdfbc, 0xd79b, 0xa71a, 0x9e99, 0xd77b, 0xa699, 0x9658, 0x8637,
-  0x9617, 0xcefa, 0xa637, 0x95d6, 0xdf1a, 0xc699, 0x9dd5, 0xc678,
-  0x9d74, 0xbdf6, 0xce78, 0xc637, 0xbe16, 0x7c91, 0x6bf0, 0x9513,
-  0x7c50, 0x5b6e, 0x4b2d, 0x536d, 0x63af, 0x63cf, 0x5b8e, 0x5b8e,
-  0x6bcf, 0xad73, 0xa574, 0xdeb7, 0xc657, 0x42cc, 0x428b, 0x42ac,
-  0x42cc, 0x4b0c, 0x532c, 0x73ee, 0x638d, 0x638d, 0x5b2c, 0x4b0c,
-  0x4b0c, 0x636e, 0x636e, 0x6bef, 0x4269, 0x2986, 0x29a7, 0x2986,
-  0x2987, 0x3a29, 0x4249, 0x4229, 0x31c7, 0x31e8, 0x3a28, 0x3a08,
-  0x52ec, 0x4249, 0x31c8, 0x636e, 0x636e, 0x4acb, 0x4acb, 0x428a,
-  0x3a09, 0x31a7, 0x31a7, 0x31e8, 0x426a, 0x52ec, 0x4acc, 0x5b2d,
-  0x7410, 0x7c30, 0x634d, 0x5aeb, 0x4229, 0x4228, 0x4a6a, 0x4a6a,
-  0x52cb, 0x5b2c, 0x94d2, 0xb5b6, 0xbdb5, 0xb595, 0xad53, 0xad54,
-  0xb574, 0xc616, 0xc637, 0xce37, 0xc5f6, 0xce77, 0xd6b9, 0xded9,
-  0xded9, 0xdeb9, 0xded9, 0xdeb9, 0xd698, 0xce98, 0xce57, 0xc617,
-  0xb5d6, 0xadb5, 0xad95, 0xa575, 0x8cf3, 0x8cd2, 0x8cd2, 0x8cd2,
-  0x8491, 0x8491, 0x7c70, 0x740f, 0x7430, 0x740f, 0x740f, 0x7430,
-  0x6bef, 0x6bce, 0x6bcf, 0x6bef, 0x63ce, 0x63ae, 0x638e, 0x63cf,
-  0x6bcf, 0x5b6d, 0x5b4d, 0x5b6e, 0x532d, 0x5b4d, 0x532d, 0x4aec,
-  0x4acb, 0x4acb, 0x42aa, 0x4aec, 0x42ab, 0x42ab, 0x42ab, 0x42ab,
-  0x4acb, 0x42ab, 0x4acb, 0x42cb, 0x3a8a, 0x426a, 0x428a, 0x426a,
-  0x426a, 0x426a, 0x3a6a, 0x426a, 0x426a, 0x426a, 0x426a, 0x426a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x426a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x428a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x428a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3aaa, 0x3a8a,
-  0x3aab, 0x3aaa, 0x3269, 0x9534, 0xffff, 0xeffd, 0xd79c, 0xcf5b,
-  0xbed9, 0x9e16, 0x7d34, 0x5c50, 0x4b6d, 0x32ab, 0x324a, 0x3229,
-  0x3249, 0x324a, 0x3249, 0x3249, 0x3a6a, 0x3a8a, 0x3aab, 0x42cb,
-  0x430c, 0x4b2d, 0x4b6e, 0x53af, 0x5bf0, 0x6451, 0x6492, 0x6cb2,
-  0x6cf3, 0x7534, 0x8595, 0x8db6, 0x95f7, 0x9e58, 0xa6b9, 0xb71a,
-  0xbf5a, 0xcfbb, 0xdfdc, 0xeffd, 0xfffe, 0xf7fd, 0xeffd, 0xdfdd,
-  0xdfbc, 0xdfbc, 0xaf1a, 0x9699, 0xcf3a, 0xa678, 0x9638, 0x8e37,
-  0x9df7, 0xd71a, 0xae37, 0x8d95, 0xdefa, 0xc698, 0x95b5, 0xc6b8,
-  0xadd6, 0xc637, 0xce58, 0xbe17, 0xb5f6, 0xa595, 0x8492, 0x94f3,
-  0xa554, 0x6bd0, 0x4b0d, 0x536e, 0x63af, 0x63ef, 0x63af, 0x5b6e,
-  0x6bcf, 0xb5f5, 0x9d12, 0xded7, 0xb5d5, 0x42ab, 0x3a6b, 0x42ab,
-  0x42ab, 0x42ab, 0x4aec, 0x8470, 0x6bce, 0x6bae, 0x73cf, 0x5b2d,
-  0x4aec, 0x638e, 0x6b8e, 0x638e, 0x29a7, 0x2146, 0x2146, 0x2966,
-  0x29a7, 0x39e8, 0x39e8, 0x424a, 0x4a6a, 0x4aab, 0x3a08, 0x31e8,
-  0x3a08, 0x4aab, 0x4a8b, 0x426a, 0x4a8a, 0x3a49, 0x428a, 0x4aab,
-  0x530c, 0x4249, 0x3a08, 0x3a29, 0x3a29, 0x4a8b, 0x63af, 0x6bcf,
-  0x73cf, 0x634d, 0x632c, 0x73ae, 0x4a49, 0x3a08, 0x3a08, 0x4229,
-  0x4228, 0x39e7, 0x4a8a, 0x7bef, 0x9491, 0x94d1, 0xa512, 0x9cf2,
-  0x8c70, 0xad54, 0xbdf6, 0xc636, 0xbdf6, 0xce57, 0xd698, 0xded9,
-  0xdeb9, 0xd6b9, 0xded9, 0xd6b9, 0xd698, 0xd698, 0xce77, 0xc637,
-  0xb5d6, 0xa574, 0xa575, 0x9d54, 0x8471, 0x8471, 0x7c51, 0x7c50,
-  0x7c50, 0x7c71, 0x7430, 0x6bef, 0x740f, 0x6bce, 0x6bef, 0x6c0f,
-  0x63ce, 0x63ae, 0x63ae, 0x63ae, 0x63ae, 0x6bcf, 0x63ae, 0x63ae,
-  0x5b6d, 0x5b4d, 0x5b4d, 0x534d, 0x534d, 0x530c, 0x530c, 0x530c,
-  0x4aec, 0x4acb, 0x428a, 0x42ab, 0x4acb, 0x42ab, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x42aa, 0x3a6a, 0x426a, 0x428a, 0x3a49,
-  0x3a6a, 0x426a, 0x426a, 0x3a6a, 0x3a6a, 0x3a4a, 0x3a4a, 0x3a6a,
-  0x3a49, 0x3a4a, 0x428a, 0x3a6a, 0x426a, 0x3a6a, 0x426a, 0x3a6a,
-  0x3a6a, 0x3a6a, 0x3a4a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x428a, 0x42ab, 0x428a, 0x42ab, 0x3a8a, 0x3a6a, 0x3a8a, 0x3a8b,
-  0x3a8b, 0x326a, 0x5b6d, 0xf7be, 0xf7fe, 0xdfbb, 0xc73a, 0xbefa,
-  0x95d6, 0x7d13, 0x6450, 0x4b8d, 0x3aab, 0x324a, 0x3229, 0x3209,
-  0x3209, 0x3209, 0x3229, 0x3249, 0x3a6a, 0x3a8a, 0x3aab, 0x3acb,
-  0x42ec, 0x432d, 0x4b6e, 0x53af, 0x53ef, 0x5c30, 0x6471, 0x6c92,
-  0x6cd3, 0x7534, 0x7d75, 0x85b6, 0x95f7, 0x9e57, 0xa699, 0xb6fa,
-  0xbf5b, 0xcf9b, 0xd7dc, 0xeffd, 0xfffe, 0xf7fd, 0xeffd, 0xdfdd,
-  0xdfbc, 0xe7dc, 0xb73b, 0x96b9, 0xcf3a, 0x9e78, 0x9637, 0xa678,
-  0xae37, 0xceb9, 0xa637, 0x95b6, 0xdefa, 0xae16, 0x95b5, 0xced9,
-  0xb5f6, 0xd6b8, 0xb5d6, 0xa594, 0xb5f6, 0x9d54, 0x8cb2, 0x6bcf,
-  0xadb5, 0x8492, 0x536e, 0x5b6e, 0x63af, 0x534d, 0x6bcf, 0x6bf0,
-  0x638e, 0x94f2, 0x94d2, 0xded7, 0xbe15, 0x4b0c, 0x324a, 0x428b,
-  0x42ab, 0x428b, 0x42ab, 0x8490, 0x638d, 0x6bae, 0x8450, 0x5b4d,
-  0x530c, 0x6bae, 0x6bce, 0x428a, 0x2125, 0x31a7, 0x29a7, 0x31e8,
-  0x3a09, 0x4249, 0x3a29, 0x3a08, 0x426a, 0x426a, 0x4269, 0x3a08,
-  0x3a29, 0x426a, 0x428a, 0x31e8, 0x3208, 0x3a49, 0x4acb, 0x4acb,
-  0x638e, 0x8c92, 0x634d, 0x4aaa, 0x4a8a, 0x4aab, 0x636e, 0x73ef,
-  0x6b6d, 0x5b0c, 0x5aec, 0x5aeb, 0x4229, 0x3a08, 0x4a69, 0x3a08,
-  0x3a08, 0x3a08, 0x39c7, 0x39c8, 0x5acb, 0x8c4f, 0x9490, 0x8c50,
-  0x9491, 0x9491, 0xad74, 0xb594, 0xc636, 0xce57, 0xd698, 0xe71a,
-  0xded9, 0xd6b8, 0xd6b8, 0xd698, 0xd6d9, 0xd6d9, 0xbe16, 0xa574,
-  0xa594, 0xad95, 0xa574, 0x8cb2, 0x8c92, 0x7c30, 0x7c30, 0x740f,
-  0x7410, 0x740f, 0x6bce, 0x6bce, 0x6bce, 0x63ae, 0x638e, 0x63ae,
-  0x638d, 0x63ae, 0x638e, 0x63ae, 0x6bcf, 0x5b8d, 0x5b6d, 0x5b8e,
-  0x5b8e, 0x5b6e, 0x5b4d, 0x530c, 0x52ec, 0x530c, 0x4acb, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42aa, 0x42aa, 0x428a,
-  0x428a, 0x3a6a, 0x42ab, 0x42aa, 0x42ab, 0x428a, 0x428a, 0x428a,
-  0x428a, 0x426a, 0x3a6a, 0x3a49, 0x3a6a, 0x3a4a, 0x426a, 0x426a,
-  0x3a69, 0x3a4a, 0x3a6a, 0x3a4a, 0x3a49, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x426a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a,
-  0x3a6a, 0x428a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a8a, 0x3a8a, 0x3aab,
-  0x3aab, 0x328a, 0xb617, 0xffff, 0xdfbc, 0xcf5b, 0xbed9, 0x9df6,
-  0x7d13, 0x6c91, 0x4b8e, 0x3acb, 0x3249, 0x3209, 0x31e8, 0x3208,
-  0x3208, 0x3209, 0x3229, 0x3229, 0x3a6a, 0x3a8a, 0x3a8b, 0x3aab,
-  0x42ec, 0x430d, 0x4b4d, 0x538e, 0x53ef, 0x5c30, 0x6451, 0x6c92,
-  0x6cd3, 0x7534, 0x7d75, 0x8595, 0x8df6, 0x9e57, 0xa698, 0xb6fa,
-  0xbf5b, 0xc79b, 0xd7dc, 0xeffd, 0xfffe, 0xf7fd, 0xeffd, 0xdfdd,
-  0xdfbc, 0xe7bc, 0xb73b, 0x9698, 0xcf3a, 0x9e78, 0x8e17, 0xa638,
-  0xceda, 0xceb9, 0xae57, 0x9df6, 0xd6fa, 0xae16, 0x9594, 0xd6b9,
-  0x9534, 0xd6b8, 0xadb5, 0x9d53, 0xb5f5, 0x9d54, 0x9513, 0x6bf0,
-  0xadb5, 0x94f3, 0x5b8e, 0x63ae, 0x63af, 0x4aec, 0x532d, 0x6bf0,
-  0x5b6e, 0x7430, 0x94d1, 0xdef7, 0xad93, 0x63ae, 0x324a, 0x428b,
-  0x42ab, 0x428b, 0x42ab, 0x5b4d, 0x530c, 0x63ae, 0x7c71, 0x530c,
-  0x5b4d, 0x5b4d, 0x5b2c, 0x3a29, 0x2166, 0x3208, 0x31e8, 0x31e8,
-  0x3a08, 0x4249, 0x4a8a, 0x4aaa, 0x52cb, 0x52ec, 0x4a6a, 0x3a29,
-  0x4249, 0x428a, 0x424a, 0x31c8, 0x29c8, 0x3209, 0x3a4a, 0x530d,
-  0x634d, 0x8cb2, 0x6b8e, 0x52eb, 0x4a8a, 0x52cb, 0x6b8e, 0x6bae,
-  0x8450, 0x73ce, 0x634c, 0x73ae, 0x5acb, 0x39e8, 0x4228, 0x39c7,
-  0x41e8, 0x4a6a, 0x52aa, 0x6b0c, 0x83ef, 0x8c50, 0x9cb1, 0xad53,
-  0xa533, 0x94b2, 0x9491, 0xad74, 0xce57, 0xce77, 0xdeb9, 0xded9,
-  0xdeb8, 0xd6b8, 0xd6b9, 0xce78, 0xb5f6, 0xadb5, 0xad95, 0x94f2,
-  0x9513, 0x9d33, 0x9512, 0xd6da, 0xe75c, 0x7c30, 0x7410, 0x740f,
-  0x6bef, 0x73ef, 0x73ee, 0x6bce, 0x6bce, 0x638d, 0x6bae, 0x63ae,
-  0x63ae, 0x5b8d, 0x638e, 0x6bcf, 0x5b6d, 0x63ae, 0x63cf, 0x5b8e,
-  0x5b6e, 0x532d, 0x530c, 0x4aec, 0x4aec, 0x4acb, 0x4acb, 0x42ab,
-  0x428a, 0x42ab, 0x42aa, 0x428a, 0x428a, 0x428a, 0x42ab, 0x3a8a,
-  0x42ab, 0x428b, 0x42ab, 0x42ab, 0x42ab, 0x426a, 0x428a, 0x426a,
-  0x428a, 0x3a6a, 0x428a, 0x3a6a, 0x426a, 0x3a6a, 0x3a4a, 0x3a49,
-  0x3a49, 0x3a6a, 0x3a6a, 0x428a, 0x3a49, 0x3a49, 0x426a, 0x3a4a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x42ab, 0x42ab, 0x42ab, 0x3a6a, 0x3a8a, 0x3a8a, 0x3a8b, 0x3aab,
-  0x3aab, 0x538d, 0xf7de, 0xeffe, 0xd79b, 0xbf1a, 0xa637, 0x8554,
-  0x6cb2, 0x53cf, 0x3aec, 0x324a, 0x3209, 0x31e8, 0x31e8, 0x31e8,
-  0x31e8, 0x3209, 0x3229, 0x3229, 0x3249, 0x3a6a, 0x3a8b, 0x3aab,
-  0x3aec, 0x430d, 0x434d, 0x4b8e, 0x53cf, 0x5c10, 0x5c31, 0x6492,
-  0x6cd3, 0x7514, 0x7d55, 0x8595, 0x8df6, 0x9e37, 0xae98, 0xb6fa,
-  0xbf5b, 0xc79b, 0xd7dc, 0xeffd, 0xfffe, 0xf7fe, 0xeffd, 0xdffd,
-  0xdf9c, 0xefbc, 0xbf5b, 0x9699, 0xbef9, 0x9e58, 0x8e17, 0xa638,
-  0xc6b9, 0xd73a, 0xb657, 0x95b5, 0xd73a, 0xc6b9, 0x9595, 0xceb8,
-  0x84f3, 0xb636, 0xc657, 0xa554, 0xb5f5, 0x9553, 0xa5b5, 0x63af,
-  0xa534, 0x9d54, 0x4b2d, 0x9d34, 0x7410, 0x3a8b, 0x42ab, 0x4aec,
-  0x638f, 0x8c91, 0xbdd4, 0xded7, 0x846f, 0x7430, 0x3a6a, 0x3a6b,
-  0x42ab, 0x428b, 0x42ab, 0x530d, 0x5b4d, 0x5b4d, 0x8471, 0x4aab,
-  0x530c, 0x4aab, 0x636d, 0x3a49, 0x29a7, 0x31e8, 0x29c7, 0x3a49,
-  0x428a, 0x52cb, 0x5b4d, 0x52cb, 0x5b2c, 0x52ec, 0x4aab, 0x3a29,
-  0x3a09, 0x3a08, 0x4aab, 0x3a09, 0x31e8, 0x29c7, 0x29c8, 0x4acc,
-  0x6bcf, 0xad96, 0x6bae, 0x632d, 0x52ec, 0x5b0c, 0x636d, 0x8451,
-  0x6b8e, 0x5aeb, 0x6b6d, 0x6b6d, 0x4a69, 0x4228, 0x4a49, 0x52aa,
-  0x5acb, 0x6b6d, 0x7bce, 0x83cf, 0x9450, 0xa4d2, 0xb594, 0xc616,
-  0xb595, 0x9cf2, 0x9d13, 0xb5b5, 0xb5b5, 0xc616, 0xce78, 0xd6b9,
-  0xce78, 0xd698, 0xce77, 0xc657, 0xb5f6, 0xa533, 0x94d2, 0x8470,
-  0x8cb2, 0x94d2, 0x8cd2, 0xb5f6, 0xb5d6, 0x73ee, 0x740f, 0x7430,
-  0x6bee, 0x73ee, 0x73ee, 0x6bce, 0x63ae, 0x638d, 0x638e, 0x638e,
-  0x5b6d, 0x636d, 0x5b6d, 0x5b6d, 0x638e, 0x63af, 0x5b6d, 0x5b4d,
-  0x534d, 0x530d, 0x4aec, 0x4acb, 0x4aec, 0x4acb, 0x4acb, 0x42ab,
-  0x428a, 0x42aa, 0x428a, 0x426a, 0x428a, 0x428b, 0x3a8a, 0x428b,
-  0x426a, 0x426a, 0x42ab, 0x428a, 0x428a, 0x4aec, 0x42ab, 0x426a,
-  0x426a, 0x428a, 0x428a, 0x3a49, 0x3a49, 0x3a6a, 0x3a4a, 0x3a49,
-  0x3a4a, 0x3a49, 0x3a49, 0x426a, 0x3a49, 0x3a49, 0x3a6a, 0x3a6a,
-  0x3a4a, 0x428a, 0x4aec, 0x3a6a, 0x3a6a, 0x3a4a, 0x3a4a, 0x3a6a,
-  0x428a, 0x3a6a, 0x428a, 0x428b, 0x3a6a, 0x3a8a, 0x3a8a, 0x42ab,
-  0x326a, 0x84f3, 0xffff, 0xe7dc, 0xc73b, 0xae99, 0x8d95, 0x74d2,
-  0x53ef, 0x430c, 0x326a, 0x3209, 0x31e8, 0x29c8, 0x29c8, 0x31e8,
-  0x31e8, 0x3208, 0x3209, 0x3229, 0x3249, 0x3a6a, 0x3a8a, 0x3aab,
-  0x42cc, 0x430d, 0x4b4d, 0x4b8e, 0x53cf, 0x53f0, 0x5c10, 0x6471,
-  0x6cd2, 0x7514, 0x7d54, 0x8595, 0x8dd6, 0x9e37, 0xa698, 0xb6f9,
-  0xbf3a, 0xc79b, 0xd7dc, 0xe7fd, 0xf7fe, 0xf7fe, 0xeffd, 0xdfdd,
-  0xd79c, 0xe7bc, 0xcf7b, 0x8e99, 0xaed9, 0xa678, 0x9638, 0x9e17,
-  0xae38, 0xcefa, 0xb678, 0x8d95, 0xced9, 0xbe78, 0x9574, 0xd6d9,
-  0x8d54, 0x9db5, 0xce58, 0x9d13, 0xbe16, 0x7c92, 0x9d54, 0x6bcf,
-  0x94d2, 0x9513, 0x534d, 0xd6b9, 0x7c50, 0x3a6b, 0x3aac, 0x42cc,
-  0x532d, 0x8c91, 0xce55, 0xded7, 0x740e, 0x5b8e, 0x4acc, 0x3a6a,
-  0x42cc, 0x42ab, 0x428b, 0x530d, 0x73ef, 0x52ec, 0x6bce, 0x3a6a,
-  0x42ab, 0x530c, 0x6bae, 0x4aeb, 0x426a, 0x31e8, 0x3a49, 0x4a8a,
-  0x4acb, 0x5b2d, 0x6bae, 0x6bae, 0x6bae, 0x5b2d, 0x428a, 0x3a09,
-  0x632d, 0x3208, 0x636e, 0x52ec, 0x29a7, 0x31c8, 0x31e8, 0x3a49,
-  0x5b4e, 0x7c30, 0x632d, 0x52eb, 0x5b0c, 0x52ab, 0x634d, 0x73ef,
-  0x634d, 0x52cb, 0x6b8d, 0x73ae, 0x6b6d, 0x52aa, 0x632c, 0x6b6c,
-  0x6b6c, 0x7bce, 0x8c50, 0x9cb1, 0xad13, 0xb574, 0xdeb8, 0xd698,
-  0xb5b5, 0xad95, 0xa554, 0xa533, 0xa554, 0xb5d6, 0xadb5, 0xb5d6,
-  0xb5b5, 0xadb5, 0xa574, 0x9d33, 0x94f2, 0x94d2, 0x8c70, 0x8c91,
-  0x8c91, 0x8cb1, 0x8c91, 0x8491, 0x7c50, 0x740f, 0x742f, 0x7c50,
-  0x740f, 0x73ee, 0x73ee, 0x63ae, 0x638d, 0x638d, 0x5b6d, 0x5b6d,
-  0x5b6d, 0x638e, 0x5b4d, 0x5b4d, 0x638e, 0x638e, 0x5b6e, 0x5b6e,
-  0x532d, 0x4acc, 0x4acc, 0x4aec, 0x4acb, 0x4acb, 0x42ab, 0x428a,
-  0x428a, 0x428a, 0x426a, 0x428a, 0x428a, 0x3a6a, 0x3a8a, 0x428a,
-  0x3a4a, 0x3a6a, 0x3a4a, 0x428a, 0x3a6a, 0x5b6e, 0x536e, 0x4aab,
-  0x3a49, 0x530c, 0x7c51, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x3a49,
-  0x3a29, 0x424a, 0x3a29, 0x3a49, 0x3a49, 0x3a49, 0x3a6a, 0x3a4a,
-  0x426a, 0x428a, 0x42ab, 0x3a6a, 0x3a4a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a, 0x428a, 0x3a8a, 0x42ab,
-  0x328a, 0xb638, 0xffff, 0xd7bc, 0xbeda, 0x9e17, 0x7d13, 0x5c31,
-  0x4b4d, 0x328a, 0x3209, 0x31e8, 0x29c8, 0x29c8, 0x29c8, 0x31e8,
-  0x31e8, 0x31e8, 0x3209, 0x3229, 0x3249, 0x3a6a, 0x3a8a, 0x3aab,
-  0x42cc, 0x430c, 0x432d, 0x4b6e, 0x53af, 0x53f0, 0x5c30, 0x6471,
-  0x6cb2, 0x6cf3, 0x7534, 0x8575, 0x8dd6, 0x9637, 0xa698, 0xb6d9,
-  0xbf3a, 0xc79b, 0xd7dc, 0xe7fd, 0xf7fe, 0xf7fe, 0xeffd, 0xe7dd,
-  0xd79c, 0xe7bc, 0xd77b, 0x9699, 0xaeb9, 0xa699, 0x8e38, 0x9e38,
-  0xae58, 0xc6b9, 0xae37, 0x95d6, 0xc699, 0xbe77, 0x9594, 0xd6f9,
-  0x9574, 0x8d54, 0xc678, 0xadb6, 0xbe16, 0x6c10, 0x8cf2, 0x84b2,
-  0x94d3, 0x7c50, 0x6bcf, 0xc657, 0x534c, 0x3aab, 0x3acc, 0x42cc,
-  0x42cc, 0x8471, 0xded8, 0xb593, 0x7c30, 0x4b0c, 0x4b0d, 0x42ac,
-  0x4aec, 0x42cc, 0x428b, 0x52ec, 0x7c0f, 0x52ec, 0x6bce, 0x3a6a,
-  0x428b, 0x530c, 0x740f, 0x4aeb, 0x4269, 0x31e8, 0x4aab, 0x4aeb,
-  0x5b4d, 0x5b6d, 0x638e, 0x5b6d, 0x6bce, 0x73ef, 0x4aab, 0x3a29,
-  0x4249, 0x4249, 0x52ec, 0x530d, 0x426a, 0x3a49, 0x3a29, 0x4aab,
-  0x6b8f, 0x6bae, 0x5aec, 0x5aec, 0x6b8e, 0x5b0c, 0x6b8e, 0x73ef,
-  0x6b6d, 0x73ce, 0x632c, 0x6b4c, 0x73ce, 0x73ad, 0x738d, 0x7bee,
-  0x9490, 0x94b1, 0xad53, 0xad53, 0xad54, 0xbdb5, 0xd677, 0xce57,
-  0xc637, 0xad74, 0x9d13, 0x9d13, 0x9cf3, 0x9d33, 0xa554, 0xa533,
-  0xa533, 0x9d13, 0x9d13, 0x94f2, 0x94b1, 0x8450, 0x8c91, 0x8c91,
-  0x8470, 0x8470, 0x8471, 0x8471, 0x7c50, 0x6bce, 0x6bef, 0x7430,
-  0x6bcf, 0x6bae, 0x6bce, 0x638e, 0x638d, 0x638d, 0x5b6d, 0x5b4d,
-  0x5b4d, 0x530c, 0x532c, 0x5b4d, 0x5b6d, 0x6c10, 0x530c, 0x4aec,
-  0x4aec, 0x4aab, 0x4aab, 0x4acb, 0x42ab, 0x428a, 0x428a, 0x428a,
-  0x428b, 0x42ab, 0x426a, 0x428a, 0x428a, 0x428a, 0x428a, 0x3a6a,
-  0x426a, 0x42ab, 0x3a6a, 0x428a, 0x4acb, 0x4b0c, 0x532d, 0x4aab,
-  0x426a, 0x4acb, 0x5b6d, 0x428a, 0x4aab, 0x4aab, 0x3a49, 0x3a49,
-  0x3a29, 0x3a49, 0x426a, 0x4aab, 0x428a, 0x428a, 0x426a, 0x426a,
-  0x426a, 0x428a, 0x426a, 0x426a, 0x3a6a, 0x3a6a, 0x426a, 0x426a,
-  0x3a6a, 0x428a, 0x3a6a, 0x428b, 0x428b, 0x428a, 0x42ab, 0x42ab,
-  0x3a8a, 0xce99, 0xfffe, 0xcf5b, 0xae79, 0x8575, 0x6492, 0x4b8e,
-  0x3aab, 0x3209, 0x31e8, 0x31e8, 0x29c8, 0x29c8, 0x31c8, 0x31e8,
-  0x31e8, 0x31e8, 0x3209, 0x3229, 0x3249, 0x3a6a, 0x3a8a, 0x3aab,
-  0x42cc, 0x42ec, 0x432d, 0x4b6e, 0x4baf, 0x53cf, 0x5c10, 0x5c51,
-  0x6492, 0x6cf3, 0x7534, 0x7d75, 0x8dd6, 0x9637, 0xa678, 0xb6d9,
-  0xbf3a, 0xc77b, 0xcfdc, 0xe7fc, 0xf7fe, 0xfffe, 0xeffd, 0xe7dd,
-  0xd79c, 0xe7bc, 0xdf9b, 0x96b9, 0xa699, 0xa678, 0x8e37, 0xa638,
-  0xae38, 0xc6da, 0xb678, 0x95f6, 0xae37, 0xc698, 0x95b4, 0xd6d9,
-  0x9575, 0x8d54, 0xbe37, 0xadd6, 0xbdf6, 0x6c10, 0x9513, 0x8cf2,
-  0x94b2, 0xad95, 0x5b8e, 0xb5d5, 0x534d, 0x42cc, 0x42ec, 0x42cc,
-  0x42ec, 0x63af, 0xc656, 0xb594, 0x6bce, 0x42ab, 0x532d, 0x4b0d,
-  0x4b0d, 0x4aec, 0x42ab, 0x530c, 0x7c0f, 0x52ec, 0x530c, 0x426a,
-  0x428b, 0x428a, 0x6b8e, 0x530c, 0x3a69, 0x3a69, 0x532c, 0x532c,
-  0x638e, 0x6bef, 0x7410, 0x6bcf, 0x740f, 0x8471, 0x52ec, 0x4269,
-  0x3a08, 0x424a, 0x4aab, 0x4acb, 0x3a4a, 0x4a8b, 0x3a49, 0x426a,
-  0x6bcf, 0x8471, 0x6b6d, 0x73ce, 0x6bad, 0x632c, 0x634c, 0x6b6d,
-  0x73ae, 0x8450, 0x8c71, 0x94b1, 0x9d12, 0x844f, 0x842f, 0x9490,
-  0xa532, 0xb594, 0xb574, 0xb574, 0xad54, 0xbdd5, 0xdeb8, 0xd678,
-  0xb5b5, 0x9d13, 0x94b2, 0x94d2, 0xa533, 0x9d13, 0xa533, 0x9d13,
-  0x9d12, 0x94d2, 0x9cf2, 0x8c91, 0x9491, 0x8c70, 0x8c91, 0x8c91,
-  0x8470, 0x8470, 0x7c30, 0x7430, 0x73ef, 0x73cf, 0x6bef, 0x7430,
-  0x740f, 0x8491, 0x6bcf, 0x638e, 0x636d, 0x638e, 0x5b4d, 0x530c,
-  0x532c, 0x530c, 0x530c, 0x5b4d, 0x5b4d, 0x6bf0, 0x530c, 0x4acb,
-  0x4aec, 0x4aab, 0x4aab, 0x42ab, 0x428a, 0x428a, 0x428a, 0x426a,
-  0x428a, 0x428a, 0x428a, 0x3a6a, 0x428a, 0x428b, 0x3a6a, 0x428a,
-  0x3a8a, 0x3a6a, 0x426a, 0x426a, 0x42ab, 0x42ab, 0x42ab, 0x4aab,
-  0x426a, 0x428a, 0x426a, 0x426a, 0x636e, 0x7410, 0x4aab, 0x428a,
-  0x4acb, 0x428a, 0x4aab, 0x426a, 0x428a, 0x426a, 0x3a49, 0x3a4a,
-  0x3a6a, 0x426a, 0x3a6a, 0x3a4a, 0x3a4a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x426a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a,
-  0x42ab, 0xd6fb, 0xeffe, 0xbf1a, 0x9e17, 0x7513, 0x5410, 0x3b0c,
-  0x324a, 0x2a09, 0x29e8, 0x29c8, 0x29c8, 0x29c8, 0x31c8, 0x31e8,
-  0x31e8, 0x3208, 0x3209, 0x3229, 0x3a49, 0x3a6a, 0x3a8a, 0x3aab,
-  0x3acb, 0x42ec, 0x432d, 0x4b4d, 0x4bae, 0x53cf, 0x5c10, 0x5c31,
-  0x6492, 0x6cd3, 0x7534, 0x7d75, 0x85d6, 0x9617, 0xa678, 0xaed9,
-  0xbf3a, 0xc77b, 0xcfbc, 0xdfdc, 0xf7fe, 0xfffe, 0xeffd, 0xe7dd,
-  0xd79c, 0xe7bc, 0xdf9c, 0x9eb9, 0xa699, 0xa678, 0x8e17, 0x9e38,
-  0xb678, 0xd71b, 0xbeb9, 0x9616, 0xae16, 0xceb8, 0x9d94, 0xbe57,
-  0x8d34, 0x9575, 0xb5f6, 0x9d54, 0xceb8, 0x7c92, 0x7c71, 0x9513,
-  0xbdd6, 0xded8, 0x5b8e, 0x63ae, 0x5b6e, 0x42cc, 0x4b0c, 0x42ec,
-  0x42cc, 0x63ae, 0xa532, 0xb5b5, 0x634d, 0x4acb, 0x530d, 0x4b0d,
-  0x4aec, 0x4b2d, 0x42cc, 0x5b2d, 0x8cb1, 0x4aab, 0x426a, 0x4aab,
-  0x428b, 0x42ab, 0x4aaa, 0x530c, 0x42ab, 0x4acb, 0x5b6d, 0x6bcf,
-  0x7430, 0x8492, 0x7c51, 0x7430, 0x8471, 0x7c30, 0x4aaa, 0x4249,
-  0x4a8a, 0x426a, 0x4a8b, 0x424a, 0x424a, 0x4aac, 0x428a, 0x428a,
-  0x6bcf, 0x9d14, 0x8c92, 0x8471, 0x8450, 0x6b6d, 0x6b6d, 0x6b8d,
-  0x7bef, 0x73ae, 0x8450, 0x9d13, 0xa553, 0x9cd1, 0x9cf2, 0x9cd1,
-  0xb594, 0xbdf6, 0xb5b5, 0xad33, 0xad54, 0xc637, 0xded9, 0xc5f6,
-  0xad74, 0x9d13, 0x8c91, 0x73ee, 0x8450, 0x8450, 0x844f, 0x844f,
-  0x842f, 0x8c50, 0x9491, 0x94b1, 0x94b1, 0x8c91, 0x8c91, 0x8470,
-  0x7c50, 0x740f, 0x73ef, 0x73ef, 0x6bcf, 0x73ef, 0x7430, 0x73ef,
-  0x8491, 0x8471, 0x6bce, 0x636d, 0x636d, 0x636d, 0x5b4d, 0x532c,
-  0x532c, 0x4aeb, 0x5b2d, 0x532d, 0x530c, 0x7410, 0x5b2d, 0x4aab,
-  0x4aab, 0x42ab, 0x4aab, 0x428a, 0x428a, 0x426a, 0x426a, 0x426a,
-  0x428a, 0x428a, 0x426a, 0x426a, 0x426a, 0x428b, 0x3a6a, 0x3a6a,
-  0x3a6a, 0x3a6a, 0x42ab, 0x42ab, 0x426a, 0x428b, 0x3a6a, 0x426a,
-  0x428a, 0x426a, 0x3a4a, 0x426a, 0x426a, 0x52ec, 0x428a, 0x426a,
-  0x3a49, 0x3a49, 0x424a, 0x3a49, 0x3a49, 0x3a49, 0x3a6a, 0x3a4a,
-  0x3a4a, 0x428a, 0x426a, 0x3a4a, 0x3a4a, 0x426a, 0x3a6a, 0x428a,
-  0x3a6a, 0x3a6a, 0x3a4a, 0x426a, 0x428a, 0x3a8a, 0x3a6a, 0x3a8a,
-  0x42cb, 0xdf1b, 0xe7dd, 0xb6b9, 0x8dd6, 0x6cb2, 0x4b8e, 0x328b,
-  0x2a09, 0x29e8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31e8,
-  0x31e8, 0x3208, 0x3209, 0x3229, 0x3a49, 0x326a, 0x3a8a, 0x3a8b,
-  0x3aab, 0x42ec, 0x430d, 0x434d, 0x4b8e, 0x53cf, 0x5c10, 0x6492,
-  0x6492, 0x6cd3, 0x7514, 0x7d75, 0x85b6, 0x9617, 0xa678, 0xaed9,
-  0xb71a, 0xc77b, 0xcfbc, 0xdffc, 0xf7fe, 0xfffe, 0xeffd, 0xe7dd,
-  0xd79c, 0xdfbc, 0xe7bc, 0xaed9, 0xa698, 0x9e58, 0x8e38, 0x9e37,
-  0xb678, 0xd71a, 0xcef9, 0xa636, 0xb636, 0xd6d9, 0xa5d5, 0xae16,
-  0x8d54, 0xa5d6, 0xa5b5, 0x9d74, 0xdf19, 0x7c91, 0x6c10, 0xad95,
-  0x9d53, 0xd697, 0x6c10, 0x3aab, 0x4b0c, 0x534d, 0x42ec, 0x4b2d,
-  0x4aec, 0x6bce, 0x8470, 0x634c, 0x8c91, 0x6bcf, 0x4aec, 0x4b0d,
-  0x532d, 0x4b2d, 0x532d, 0x636d, 0x9512, 0x4acc, 0x3a4a, 0x5b2c,
-  0x5b2c, 0x52ec, 0xb5b5, 0x5b4e, 0x4acc, 0x4acb, 0x638e, 0x7430,
-  0x84d2, 0x8492, 0x7c51, 0x84b2, 0x8cf3, 0x8cd2, 0x636d, 0x4a8a,
-  0x4a8a, 0x4249, 0x52ec, 0x3a49, 0x3a29, 0x424a, 0x3a29, 0x4a8a,
-  0x8472, 0x7c30, 0xbe17, 0x8430, 0x6bae, 0x73ae, 0x7c30, 0x6bae,
-  0x6b6d, 0x7c0f, 0x8c91, 0xad74, 0xb5b5, 0xad73, 0xa532, 0xad53,
-  0xc616, 0xbdd5, 0xb594, 0xad53, 0xb594, 0xd698, 0xce78, 0xad74,
-  0xa554, 0x8c71, 0x8430, 0x7bef, 0x842f, 0x842f, 0x7c0e, 0x844f,
-  0x8c90, 0x8c90, 0x8cb1, 0x8c91, 0x8490, 0x8470, 0x8450, 0x7c30,
-  0x7c2f, 0x7c2f, 0x73ef, 0x6bef, 0x6bef, 0x6bef, 0x6bef, 0x7c50,
-  0x7c71, 0x73ef, 0x6bae, 0x63ae, 0x5b6d, 0x5b6d, 0x532c, 0x532c,
-  0x4aeb, 0x4aeb, 0x4aec, 0x4aec, 0x530c, 0x6bef, 0x63af, 0x428a,
-  0x4aab, 0x4aab, 0x4aab, 0x428a, 0x428a, 0x428a, 0x428a, 0x428a,
-  0x426a, 0x428a, 0x426a, 0x4acc, 0x428a, 0x428a, 0x428b, 0x428a,
-  0x3a4a, 0x428a, 0x3a6a, 0x3a6a, 0x3a49, 0x3a6a, 0x3a4a, 0x3a49,
-  0x426a, 0x426a, 0x426a, 0x428a, 0x426a, 0x4249, 0x4249, 0x426a,
-  0x3a49, 0x3a49, 0x424a, 0x3a29, 0x3a49, 0x3a29, 0x426a, 0x3a4a,
-  0x3a6a, 0x3a6a, 0x3a6a, 0x3a4a, 0x426a, 0x3a4a, 0x3a4a, 0x42ab,
-  0x3a6a, 0x3a49, 0x3a49, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a8a, 0x3a8a,
-  0x42ab, 0xcefa, 0xe7dc, 0xaeb9, 0x7d75, 0x5c51, 0x432d, 0x324a,
-  0x2a09, 0x29e8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31e8,
-  0x31e8, 0x3208, 0x3209, 0x3209, 0x3249, 0x3a6a, 0x3a8a, 0x3a8b,
-  0x3aab, 0x3acc, 0x430c, 0x434d, 0x4b6e, 0x53af, 0x5410, 0x6451,
-  0x6472, 0x6cb2, 0x6d13, 0x7d55, 0x85b6, 0x9617, 0xa678, 0xaed9,
-  0xb71a, 0xbf7b, 0xcfbc, 0xdfdc, 0xf7fd, 0xffde, 0xeffd, 0xe7dc,
-  0xd79c, 0xdf9c, 0xdfbc, 0xaef9, 0xa699, 0x9e58, 0x8e18, 0x9e38,
-  0xae37, 0xd719, 0xd6f9, 0x9db5, 0xbe37, 0xc699, 0xa5b5, 0xa595,
-  0x8514, 0xadf6, 0xa5b5, 0x9d73, 0xe739, 0x7c71, 0x534e, 0xb5b6,
-  0x8471, 0xa553, 0x7c51, 0x3aac, 0x4b0d, 0x532d, 0x4b0d, 0x4b2d,
-  0x638e, 0x7c2f, 0x8450, 0x8cb1, 0xa574, 0x5b6d, 0x4aec, 0x4b0d,
-  0x4b0d, 0x4b0d, 0x534e, 0x6b8e, 0xbdf6, 0x532d, 0x3a6a, 0x5b4d,
-  0x636e, 0x52cb, 0xce78, 0x5b4f, 0x42ab, 0x4aec, 0x63ae, 0x7451,
-  0x8492, 0x84d2, 0x8cd2, 0x8cd2, 0x9d75, 0xa595, 0xa575, 0x6bae,
-  0x52eb, 0x4aab, 0x52eb, 0x5b2d, 0x4a8a, 0x4249, 0x4249, 0x73ef,
-  0x7c51, 0x73ef, 0x8471, 0x73ce, 0x7c0f, 0x94d2, 0x8c91, 0x7bef,
-  0x6b8d, 0x73ce, 0x9d13, 0xb5b5, 0xbdf6, 0xbdd5, 0xb5b5, 0xbdd5,
-  0xc616, 0xbdd5, 0xad74, 0xa512, 0xc616, 0xce98, 0xb5d5, 0x9cf2,
-  0x94b2, 0x8c71, 0x8450, 0x8c70, 0x94d2, 0x94d2, 0x8c91, 0x8c91,
-  0x8491, 0x8491, 0x8490, 0x8470, 0x8470, 0x7c50, 0x7c50, 0x7c0f,
-  0x740f, 0x7430, 0x740f, 0x6bce, 0x63ae, 0x638e, 0x6bef, 0x7c71,
-  0x6bef, 0x6bae, 0x63ae, 0x638d, 0x5b4d, 0x5b4d, 0x5b2c, 0x4aeb,
-  0x4acb, 0x4aeb, 0x530c, 0x4aeb, 0x4aec, 0x5b6d, 0x636e, 0x4aab,
-  0x4aab, 0x4aab, 0x42ab, 0x42ab, 0x4aab, 0x426a, 0x3a6a, 0x428a,
-  0x426a, 0x428a, 0x42ab, 0x4aab, 0x3a49, 0x426a, 0x4acc, 0x42ab,
-  0x428b, 0x42ab, 0x3a6a, 0x3a49, 0x426a, 0x3a49, 0x424a, 0x3a49,
-  0x3a4a, 0x3a49, 0x424a, 0x426a, 0x4249, 0x4269, 0x3a49, 0x426a,
-  0x426a, 0x3a49, 0x4249, 0x424a, 0x426a, 0x3a49, 0x3a49, 0x3229,
-  0x3a4a, 0x426a, 0x426a, 0x3a6a, 0x3a6a, 0x3a6a, 0x426a, 0x3a49,
-  0x3a49, 0x3a49, 0x426a, 0x3a6a, 0x3a6a, 0x3a8a, 0x3a6a, 0x428a,
-  0x3aab, 0xc699, 0xe7dd, 0xae99, 0x7534, 0x53f0, 0x3acc, 0x3229,
-  0x29e8, 0x29c8, 0x29c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31e8,
-  0x31e8, 0x3208, 0x3209, 0x3209, 0x3249, 0x3a4a, 0x3a6a, 0x3a8b,
-  0x3aab, 0x3acc, 0x430c, 0x434d, 0x4b6e, 0x4bae, 0x53cf, 0x5c10,
-  0x5c71, 0x64b2, 0x74f3, 0x7d55, 0x85b6, 0x95f7, 0x9e58, 0xaeb9,
-  0xb71a, 0xbf5b, 0xcfbc, 0xd7dc, 0xeffd, 0xfffe, 0xeffd, 0xe7dd,
-  0xd7bc, 0xd79c, 0xdfbc, 0xb6fa, 0x9e98, 0x9e79, 0x8e18, 0x9617,
-  0xae37, 0xd719, 0xdf3a, 0xa5f6, 0xb637, 0xae17, 0xa5b5, 0x9574,
-  0x7cd3, 0xb637, 0xa5d5, 0xadb4, 0xef5a, 0x7470, 0x430d, 0x9533,
-  0x7c51, 0xad95, 0x84b2, 0x3aac, 0x532d, 0x5b6e, 0x4b0d, 0x4b2d,
-  0x6bcf, 0x8450, 0x8471, 0x7430, 0x8450, 0x6bcf, 0x4b0d, 0x4b0d,
-  0x4aec, 0x4b0d, 0x534d, 0x73ef, 0xbdf5, 0x530c, 0x42ec, 0x4aec,
-  0x4acb, 0x5b0c, 0x7c0f, 0x63af, 0x42ab, 0x5b4d, 0x6bf0, 0x7430,
-  0x9534, 0x9534, 0x9d54, 0x9d54, 0xa595, 0xb5f6, 0xa595, 0x7c30,
-  0x636d, 0x4a8a, 0x636d, 0x94d3, 0x636e, 0x428a, 0x6bcf, 0x9d75,
-  0x8cb2, 0x636d, 0x73ef, 0x6b8d, 0x8450, 0x94d2, 0x94b1, 0x8470,
-  0x6b8d, 0x7c0f, 0x9d13, 0xbdf6, 0xc657, 0xc636, 0xce57, 0xbdf6,
-  0xb5b5, 0xb594, 0xad54, 0xa553, 0xbe16, 0xc637, 0xa533, 0x8450,
-  0x8430, 0x73ce, 0x842f, 0x94f2, 0x9d12, 0x9d13, 0x94b2, 0x8c71,
-  0x8491, 0x8491, 0x7c70, 0x7c50, 0x7c30, 0x7c30, 0x740f, 0x6bce,
-  0x73ef, 0x6bef, 0x6bce, 0x63ae, 0x63ae, 0x84b2, 0x7430, 0x6bcf,
-  0x6bae, 0x638d, 0x638d, 0x5b6d, 0x5b2c, 0x530c, 0x52ec, 0x4aeb,
-  0x4acb, 0x4acb, 0x4aec, 0x4aeb, 0x4acb, 0x532d, 0x5b6d, 0x42aa,
-  0x4aab, 0x4aab, 0x428a, 0x428a, 0x428a, 0x42ab, 0x428a, 0x426a,
-  0x426a, 0x428a, 0x428a, 0x63af, 0x6bf0, 0x52ec, 0x4acc, 0x428b,
-  0x428a, 0x426a, 0x3a49, 0x3a49, 0x3a49, 0x3a29, 0x3a29, 0x3a29,
-  0x3a49, 0x3a49, 0x3a29, 0x424a, 0x4249, 0x4249, 0x426a, 0x3a49,
-  0x3a29, 0x3a29, 0x426a, 0x426a, 0x426a, 0x3a49, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a4a, 0x426a, 0x3a6a, 0x428a, 0x3a6a, 0x3a49,
-  0x3a49, 0x426a, 0x3a49, 0x3a49, 0x3a6a, 0x3a6a, 0x3a6a, 0x428a,
-  0x3a6a, 0xbe58, 0xe7dd, 0x9e78, 0x7513, 0x538f, 0x3a8b, 0x3209,
-  0x29e8, 0x29c8, 0x31c8, 0x31c7, 0x31c8, 0x31c8, 0x31c8, 0x31e8,
-  0x31e8, 0x3208, 0x3209, 0x3229, 0x3249, 0x324a, 0x3a6a, 0x3a8b,
-  0x3aab, 0x3acc, 0x430c, 0x434d, 0x4b6e, 0x4bae, 0x53cf, 0x5c10,
-  0x5c51, 0x64b2, 0x6cf3, 0x7534, 0x8596, 0x95f6, 0x9e58, 0xaeb9,
-  0xb6fa, 0xbf5b, 0xc79b, 0xd7dc, 0xeffd, 0xfffe, 0xeffd, 0xe7fd,
-  0xd7bc, 0xd77b, 0xe7bc, 0xc73a, 0xa6b9, 0x9658, 0x85f8, 0x9617,
-  0xae57, 0xced9, 0xe75a, 0xb657, 0xb617, 0x9d95, 0x9d95, 0x9555,
-  0x7492, 0xb637, 0xa595, 0xb5d5, 0xe739, 0x6c50, 0x434d, 0x7451,
-  0x8492, 0xa574, 0x6bef, 0x4b0d, 0x4b0c, 0x5b6e, 0x532d, 0x534d,
-  0x63ae, 0x7c30, 0x740f, 0x5b6d, 0x6bae, 0x73ef, 0x532d, 0x4b0d,
-  0x4b0d, 0x4b0d, 0x534d, 0x8c71, 0xb594, 0x532c, 0x4b2d, 0x4aec,
-  0x636d, 0xb5b5, 0x632c, 0x63cf, 0x42ab, 0x5b6e, 0x63af, 0x7c92,
-  0x8d14, 0x8cf3, 0xa575, 0xb5f6, 0xadd6, 0xbe57, 0xb5f6, 0x94f3,
-  0x634d, 0x52eb, 0x9d34, 0x73f0, 0x31e8, 0x426a, 0x52eb, 0x7410,
-  0x636d, 0x52cb, 0x636d, 0x6bae, 0x7c0f, 0x7c0f, 0x8c90, 0x94b1,
-  0x8450, 0x8450, 0xa554, 0xb5d6, 0xc637, 0xc657, 0xbdf6, 0xb5b5,
-  0xad53, 0xad54, 0xad74, 0xad74, 0xb5d5, 0xad53, 0x8c91, 0x73ae,
-  0x634d, 0x634c, 0x8430, 0x94d2, 0xa553, 0xa554, 0x9d33, 0x94f2,
-  0x8470, 0x7c51, 0x7c30, 0x7c50, 0x740f, 0x740f, 0x6bef, 0x6bce,
-  0x6c0f, 0x6bce, 0x638e, 0x638e, 0x7410, 0x9513, 0x6bef, 0x638e,
-  0x638e, 0x638e, 0x636d, 0x5b4d, 0x5b2d, 0x530c, 0x4acb, 0x4aab,
-  0x4aab, 0x4aab, 0x4acb, 0x4aab, 0x4aec, 0x5b2d, 0x5b6e, 0x42ab,
-  0x42ab, 0x428a, 0x428a, 0x4aab, 0x4aab, 0x4aab, 0x426a, 0x3a4a,
-  0x426a, 0x3a4a, 0x4aab, 0x4acc, 0x4acc, 0x4aab, 0x428a, 0x426a,
-  0x428a, 0x3a49, 0x3a29, 0x3a49, 0x3a09, 0x3a29, 0x3a09, 0x3a09,
-  0x3a29, 0x3a29, 0x3a29, 0x4249, 0x4249, 0x3a29, 0x4249, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3209, 0x3a29, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a4a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a49, 0x3a49,
-  0x3a49, 0x3a29, 0x3a49, 0x3a49, 0x3a6a, 0x3a6a, 0x3a6a, 0x426a,
-  0x3249, 0x9534, 0xe7de, 0x9e58, 0x6cf3, 0x4b6e, 0x326b, 0x3209,
-  0x29e8, 0x29c8, 0x31c8, 0x31a7, 0x31c7, 0x31c8, 0x31c8, 0x31e8,
-  0x31e8, 0x3208, 0x3209, 0x3209, 0x3249, 0x3a4a, 0x3a6a, 0x3a8a,
-  0x3aab, 0x3acc, 0x430c, 0x432d, 0x4b6e, 0x4b8e, 0x53cf, 0x5c10,
-  0x6451, 0x6492, 0x6cd3, 0x7534, 0x8595, 0x95f6, 0x9e57, 0xa6b9,
-  0xb6fa, 0xbf5b, 0xc79b, 0xd7bc, 0xeffd, 0xfffe, 0xf7fd, 0xeffd,
-  0xdfbc, 0xd77b, 0xdf9c, 0xcf5a, 0xb6da, 0x8e38, 0x85f7, 0x9618,
-  0xae58, 0xc6b8, 0xe77b, 0xae17, 0xb5f6, 0x9d55, 0x9d75, 0x9554,
-  0x6cb2, 0x9d75, 0xad95, 0xbdf6, 0xdf39, 0x7c90, 0x4b4d, 0x63af,
-  0x7c51, 0x5b4d, 0x6bf0, 0x536e, 0x5b8e, 0x5b6e, 0x5b6e, 0x534d,
-  0x63ae, 0x7c50, 0x6bef, 0x7430, 0x7c30, 0x6bcf, 0x532d, 0x4b0c,
-  0x6baf, 0x6baf, 0x4b0d, 0x8450, 0x9cd2, 0x532d, 0x42ab, 0x532d,
-  0x52eb, 0x632c, 0xa553, 0x6bf0, 0x7c93, 0x7c72, 0x6c10, 0x7471,
-  0x8d34, 0xa5b6, 0xadd6, 0xb617, 0xbe37, 0xced9, 0xc678, 0x7c30,
-  0x4269, 0x6b8e, 0x6bae, 0x4269, 0x3a08, 0x52ab, 0x52cb, 0x4a6a,
-  0x3a08, 0x52cb, 0x5b2c, 0x73cf, 0x73ef, 0x73ce, 0x842f, 0x9cf2,
-  0x8c91, 0x94d2, 0xa554, 0xad94, 0xc657, 0xbdf6, 0xa554, 0xa533,
-  0xa554, 0xa533, 0x9d12, 0xad74, 0xbe16, 0xad74, 0x842f, 0x73ae,
-  0x6b4d, 0x73ae, 0x8450, 0x94d2, 0x9d33, 0xad94, 0xbe16, 0x9d13,
-  0x7c30, 0x7c30, 0x7410, 0x7410, 0x73ef, 0x6bae, 0x6bce, 0x63ae,
-  0x638d, 0x63ae, 0x5b6d, 0x638e, 0x9514, 0x8cd2, 0x6bce, 0x638e,
-  0x638e, 0x636d, 0x5b4d, 0x530c, 0x530c, 0x530c, 0x4aeb, 0x4acb,
-  0x4aab, 0x42aa, 0x4acb, 0x4acb, 0x4acb, 0x532d, 0x5b6e, 0x4aec,
-  0x4aab, 0x4aab, 0x42ab, 0x428a, 0x4aab, 0x4aab, 0x428a, 0x4a8b,
-  0x428b, 0x426a, 0x428b, 0x428b, 0x428b, 0x428a, 0x428a, 0x4aab,
-  0x428a, 0x426a, 0x426a, 0x3a49, 0x3a29, 0x3a29, 0x3a09, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a09, 0x3a29,
-  0x3a29, 0x3a29, 0x3a09, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x3a09, 0x3a49, 0x3a49, 0x3a49, 0x3a6a, 0x3a6a, 0x3a4a, 0x3a29,
-  0x3a49, 0x3a29, 0x3a49, 0x3a49, 0x3a6a, 0x3a49, 0x3a6a, 0x3a49,
-  0x3a6a, 0x6bef, 0xdfbd, 0x9e78, 0x64f3, 0x4b4e, 0x326b, 0x2a09,
-  0x29e8, 0x29c8, 0x31c8, 0x31a7, 0x31c7, 0x31c8, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x3208, 0x3209, 0x3249, 0x324a, 0x3a6a, 0x3a8a,
-  0x3aab, 0x3acc, 0x430c, 0x432d, 0x4b6e, 0x4b8e, 0x53cf, 0x5c10,
-  0x5c51, 0x6492, 0x6cd3, 0x7514, 0x7d75, 0x8dd6, 0x9e57, 0xa699,
-  0xaefa, 0xbf3a, 0xc77b, 0xcfbc, 0xe7fd, 0xfffe, 0xf7fd, 0xeffd,
-  0xe7dc, 0xdf9c, 0xdf7b, 0xd77b, 0xaeb9, 0x8e38, 0x8618, 0x8df8,
-  0xa617, 0xceb9, 0xe79b, 0x9db5, 0xc698, 0xa5b6, 0x9d96, 0xb638,
-  0x6c92, 0x84f3, 0xb5d6, 0xce58, 0xdf39, 0x7cb1, 0x536e, 0x5b8e,
-  0x63cf, 0x534e, 0x63f0, 0x5b8e, 0x5b8f, 0x5b8e, 0x5baf, 0x5b8e,
-  0x638e, 0x7430, 0x73ef, 0x8c92, 0x8c91, 0x7410, 0x63ae, 0x5b4d,
-  0x9491, 0x8c92, 0x4aec, 0x5b4d, 0x7c0f, 0x638e, 0x4aec, 0x532d,
-  0x52ec, 0x52cb, 0xb5d4, 0x638f, 0x84f4, 0x7452, 0x7cb3, 0x7c92,
-  0x9d74, 0xadd6, 0xbe37, 0xbe57, 0xc678, 0xced9, 0xbe38, 0x4aaa,
-  0x4229, 0x4aab, 0x4229, 0x31c7, 0x31e7, 0x4a8a, 0x4a6a, 0x4a49,
-  0x39e8, 0x4a49, 0x5b0c, 0x634d, 0x6b6d, 0x7c0f, 0x9cf2, 0xa513,
-  0x9cf2, 0x9cf3, 0x9d13, 0xa554, 0xa534, 0xa554, 0x9d13, 0x94b1,
-  0x94b1, 0x8c91, 0x94d1, 0xb5b5, 0xb5d5, 0xa533, 0x840f, 0x8450,
-  0x7bef, 0x740f, 0x7c30, 0x94d2, 0x9cf2, 0xa553, 0xbe16, 0xb5d5,
-  0x8c91, 0x7c30, 0x740f, 0x73ef, 0x6bcf, 0x6bae, 0x638e, 0x63ae,
-  0x636d, 0x5b6d, 0x5b4d, 0x5b4d, 0x7410, 0x7410, 0x638e, 0x5b4d,
-  0x5b2c, 0x5b2c, 0x530c, 0x530c, 0x4aeb, 0x530c, 0x4aec, 0x4acb,
-  0x4aab, 0x4acb, 0x4acb, 0x42ab, 0x4aab, 0x532d, 0x532d, 0x4acb,
-  0x4aab, 0x428a, 0x426a, 0x3a4a, 0x426a, 0x428a, 0x426a, 0x428b,
-  0x426a, 0x426a, 0x426a, 0x4a8b, 0x4aab, 0x426a, 0x4aab, 0x426a,
-  0x426a, 0x426a, 0x3a49, 0x3a49, 0x3a49, 0x3a09, 0x3a09, 0x3a09,
-  0x3a29, 0x3a29, 0x3208, 0x3a08, 0x3a29, 0x3a29, 0x3a09, 0x3a09,
-  0x3a29, 0x3a09, 0x3208, 0x3208, 0x3209, 0x3229, 0x3209, 0x3209,
-  0x3a29, 0x3a29, 0x3a49, 0x3a4a, 0x426a, 0x3a49, 0x3a29, 0x3a49,
-  0x3a4a, 0x3a49, 0x3a4a, 0x3a49, 0x3a49, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x428a, 0x3a8a, 0xbeba, 0xaefa, 0x64f3, 0x436e, 0x326b, 0x2a09,
-  0x29e8, 0x31c8, 0x31c8, 0x31a7, 0x31c7, 0x31c8, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x3208, 0x3209, 0x3229, 0x324a, 0x3a6a, 0x3a8a,
-  0x3aab, 0x3acc, 0x42ec, 0x432d, 0x4b4d, 0x4b8e, 0x53cf, 0x5bf0,
-  0x5c51, 0x6471, 0x6cb2, 0x7514, 0x7d75, 0x8dd6, 0x9637, 0xa699,
-  0xaed9, 0xb73a, 0xc77b, 0xcfbb, 0xe7fc, 0xffde, 0xf7fd, 0xeffd,
-  0xefdd, 0xdf9c, 0xdf9b, 0xdf7b, 0xaeb9, 0x9658, 0x8617, 0x85d7,
-  0x9df7, 0xced9, 0xef7a, 0xa5b6, 0xbe78, 0x9d75, 0x9574, 0xb5f6,
-  0x7492, 0x84f3, 0xc657, 0xce78, 0xd6d8, 0x8d12, 0x536e, 0x63ef,
-  0x7c91, 0x536e, 0x63f0, 0x5b6e, 0x536e, 0x5baf, 0x5baf, 0x5baf,
-  0x63cf, 0x740f, 0x6bce, 0x8c70, 0x7bef, 0x73ef, 0x63ae, 0x8450,
-  0xbdd4, 0x9491, 0x4acb, 0x428b, 0x530c, 0x638e, 0x4b0d, 0x52ec,
-  0x738e, 0x5aec, 0x8c2f, 0x4b2d, 0x532d, 0x5b8e, 0x63ae, 0x8d34,
-  0xadf6, 0xb616, 0xc678, 0xce98, 0xce99, 0xc678, 0x73ef, 0x4229,
-  0x424a, 0x4249, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x31c7, 0x39c7,
-  0x4229, 0x39c7, 0x4a69, 0x6b6d, 0x7c0f, 0x8c71, 0xa533, 0xbdd6,
-  0xb595, 0xa513, 0xa554, 0x94d2, 0x94b2, 0x94d2, 0x9d13, 0x7c2f,
-  0x7bef, 0x73ce, 0xa554, 0xad95, 0xad74, 0x7c0f, 0x8c71, 0x8430,
-  0x6b8e, 0x6b8e, 0x7c0f, 0x8450, 0x94d2, 0x9513, 0xa554, 0xbe17,
-  0x9d34, 0x7c50, 0x6bce, 0x6bae, 0x6bcf, 0x638e, 0x636d, 0x638e,
-  0x5b4d, 0x5b4d, 0x5b2d, 0x5b2c, 0x638e, 0x5b6d, 0x532c, 0x52eb,
-  0x530c, 0x530c, 0x530c, 0x530c, 0x52ec, 0x52ec, 0x4aeb, 0x4acb,
-  0x4aab, 0x4acb, 0x42ab, 0x42ab, 0x428a, 0x4aab, 0x4aab, 0x4aab,
-  0x428a, 0x426a, 0x426a, 0x428a, 0x426a, 0x428b, 0x428b, 0x428b,
-  0x426a, 0x428b, 0x426a, 0x4aab, 0x426a, 0x4aab, 0x428b, 0x426a,
-  0x3a49, 0x3a49, 0x3a49, 0x3a49, 0x3a29, 0x4249, 0x3a29, 0x3a29,
-  0x3a29, 0x3208, 0x3a29, 0x3a08, 0x3a29, 0x3a09, 0x3a09, 0x3a09,
-  0x31e8, 0x3208, 0x3a09, 0x31e8, 0x3209, 0x3209, 0x3208, 0x3209,
-  0x3a29, 0x3229, 0x3a49, 0x3a49, 0x3a49, 0x3a29, 0x3a49, 0x3a49,
-  0x3a49, 0x3a29, 0x3a29, 0x424a, 0x3a49, 0x426a, 0x3a6a, 0x3a6a,
-  0x426a, 0x3a4a, 0x7471, 0xcf9d, 0x7574, 0x438e, 0x326b, 0x3209,
-  0x29e8, 0x31c8, 0x31c8, 0x31a7, 0x31c8, 0x31c8, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x3208, 0x3209, 0x3229, 0x324a, 0x326a, 0x3a8a,
-  0x3aab, 0x3acc, 0x3aec, 0x432d, 0x4b4d, 0x4b8e, 0x53cf, 0x5bf0,
-  0x5c31, 0x6471, 0x6cb2, 0x7514, 0x7d75, 0x8db6, 0x9617, 0xa678,
-  0xaed9, 0xb71a, 0xbf5b, 0xcf9b, 0xe7fc, 0xfffe, 0xf7fe, 0xeffd,
-  0xefdd, 0xdf9c, 0xdf7b, 0xdf7b, 0xb6da, 0x9658, 0x8618, 0x85d7,
-  0x9dd7, 0xc6b8, 0xf7bb, 0xb657, 0xb617, 0xa5d6, 0x8d54, 0x9d75,
-  0x7cb3, 0x84d3, 0xc677, 0xc677, 0xceb8, 0xbe36, 0x6bf0, 0x6c10,
-  0x9d54, 0x63cf, 0x53ae, 0x5baf, 0x5b8e, 0x5baf, 0x5b8e, 0x638e,
-  0x6bef, 0x6bef, 0x6bae, 0x94d1, 0x8471, 0x6bef, 0x740f, 0xb5d4,
-  0xd696, 0x8c90, 0x4aec, 0x428b, 0x4acc, 0x5b2c, 0x42ab, 0x5b2d,
-  0x8c51, 0x6b6d, 0xce76, 0x4b0c, 0x42cb, 0x7cb2, 0x84b2, 0x9d54,
-  0xb637, 0xbe58, 0xc678, 0xceb9, 0xceb9, 0x94f2, 0x52aa, 0x4a8a,
-  0x4249, 0x4229, 0x52ab, 0x4249, 0x39e8, 0x31c7, 0x31c7, 0x39c7,
-  0x39c7, 0x4229, 0x6b6d, 0x73cf, 0x8cb2, 0x8c70, 0x9cd1, 0xad54,
-  0xad33, 0xa513, 0x9d13, 0x8c91, 0x8c70, 0x8c91, 0x94b2, 0x7c0f,
-  0x634d, 0x6b6d, 0x94d2, 0xa553, 0x9cf2, 0x73cf, 0x7c30, 0x94d2,
-  0x8c91, 0x5b0c, 0x8491, 0x8cb2, 0x8471, 0x8cb2, 0x8451, 0x9d33,
-  0xb5f6, 0x7c51, 0x6bce, 0x6bae, 0x638e, 0x636d, 0x636d, 0x636d,
-  0x636d, 0x5b2c, 0x530c, 0x5b2d, 0x532c, 0x530c, 0x4aeb, 0x4acb,
-  0x530c, 0x530c, 0x52eb, 0x530c, 0x530c, 0x52ec, 0x4acb, 0x4aec,
-  0x4aeb, 0x4aab, 0x4aab, 0x42ab, 0x428a, 0x428a, 0x428a, 0x4aab,
-  0x428a, 0x3a49, 0x426a, 0x3a4a, 0x4aab, 0x4aab, 0x428b, 0x426a,
-  0x428b, 0x428a, 0x426a, 0x3a49, 0x426a, 0x426a, 0x424a, 0x3a49,
-  0x3a49, 0x3a49, 0x426a, 0x3a49, 0x3a49, 0x424a, 0x3a09, 0x3a09,
-  0x3a08, 0x3a09, 0x3208, 0x3a08, 0x3208, 0x3a09, 0x3a09, 0x3a09,
-  0x31e8, 0x31c8, 0x31e8, 0x3209, 0x31e8, 0x31e8, 0x3209, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x426a, 0x428a, 0x3a29, 0x3a49, 0x3a49,
-  0x3a49, 0x3a29, 0x3a29, 0x3a49, 0x3a4a, 0x426a, 0x3a6a, 0x3a49,
-  0x428a, 0x424a, 0x3a49, 0xa617, 0x9e79, 0x4bef, 0x328b, 0x3229,
-  0x31e8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x3208, 0x3209, 0x3229, 0x3249, 0x3a6a, 0x3a8a,
-  0x3aab, 0x3acc, 0x3aec, 0x432d, 0x4b4d, 0x4b8e, 0x53cf, 0x5bf0,
-  0x5c31, 0x6471, 0x6cb2, 0x7513, 0x7d55, 0x8db6, 0x9617, 0x9e78,
-  0xaeb9, 0xb71a, 0xbf5b, 0xcf9b, 0xe7fc, 0xfffe, 0xf7fe, 0xeffd,
-  0xeffd, 0xdfbc, 0xdf7b, 0xdf7b, 0xb6fa, 0x9658, 0x8e18, 0x85d7,
-  0x95d7, 0xbe98, 0xf7bb, 0xbe77, 0xadd6, 0xae17, 0x84f3, 0x9534,
-  0x74b3, 0x7cd3, 0xb5d6, 0xc656, 0xceb7, 0xc677, 0x6bcf, 0x638e,
-  0x94f3, 0x6c10, 0x4b4d, 0x5baf, 0x5baf, 0x5baf, 0x63ae, 0x63cf,
-  0x6bef, 0x6bef, 0x740f, 0x7c30, 0x73ef, 0x5b8e, 0x7451, 0xb5f6,
-  0xc614, 0x636d, 0x530d, 0x42ab, 0x4acc, 0x52eb, 0x42ab, 0x4acb,
-  0x73ae, 0x632d, 0xb5b4, 0x42cb, 0x3a69, 0x532c, 0x9514, 0xa595,
-  0xb5f6, 0xc658, 0xc678, 0xc678, 0xbe17, 0x73ee, 0x5b0c, 0x632c,
-  0x5b0c, 0x4a8a, 0x31c7, 0x39e8, 0x3a08, 0x39e7, 0x3a08, 0x39e8,
-  0x4229, 0x52ab, 0x73cf, 0x8cb2, 0x9cf2, 0x94b1, 0xa4f2, 0xbd95,
-  0xad54, 0xa513, 0x94d2, 0x8c71, 0x7c2f, 0x7c0f, 0x6b8e, 0x632c,
-  0x5aec, 0x636d, 0x73ef, 0x8470, 0x8c91, 0x7c0f, 0x8450, 0xc658,
-  0xef9e, 0x94f3, 0x8cb2, 0x9d54, 0x8c91, 0x7c10, 0x7c50, 0x7c30,
-  0x8cd2, 0x7c30, 0x6bae, 0x6b8e, 0x638d, 0x5b4d, 0x5b4d, 0x5b4d,
-  0x530c, 0x530c, 0x530c, 0x530c, 0x530c, 0x4acb, 0x52ec, 0x530c,
-  0x5b2d, 0x530c, 0x52ec, 0x530c, 0x52ec, 0x4aeb, 0x4aeb, 0x4aeb,
-  0x4acb, 0x4aab, 0x4acc, 0x428a, 0x428a, 0x428a, 0x428b, 0x426a,
-  0x424a, 0x424a, 0x428b, 0x3a49, 0x426a, 0x426a, 0x426a, 0x428a,
-  0x4aab, 0x3a29, 0x426a, 0x3a4a, 0x3a29, 0x3a29, 0x3a29, 0x3a49,
-  0x4249, 0x424a, 0x426a, 0x3a29, 0x3a09, 0x3a29, 0x3a09, 0x31e8,
-  0x39e8, 0x3a09, 0x31e8, 0x39e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x31e9, 0x31e9, 0x3208, 0x3209, 0x3208, 0x3209,
-  0x3209, 0x3a29, 0x4acc, 0x426a, 0x426a, 0x3a49, 0x3a29, 0x3a49,
-  0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x426a, 0x426a, 0x3a4a, 0x3a4a,
-  0x428a, 0x3a4a, 0x3a49, 0x42cb, 0xa678, 0x64d3, 0x32ec, 0x322a,
-  0x31e9, 0x31c8, 0x31a8, 0x31a8, 0x31c8, 0x31c8, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x3208, 0x3209, 0x3229, 0x3249, 0x3a6a, 0x3a8a,
-  0x3aab, 0x3acc, 0x42ec, 0x432d, 0x4b4d, 0x4b6e, 0x53cf, 0x5bf0,
-  0x5c31, 0x6471, 0x6cb2, 0x74f3, 0x7d55, 0x8596, 0x9617, 0x9e58,
-  0xa6b9, 0xb71a, 0xbf5b, 0xcf9b, 0xe7dc, 0xfffe, 0xf7fe, 0xeffd,
-  0xeffd, 0xdfbc, 0xdf9b, 0xdf7b, 0xbefa, 0x9e58, 0x9618, 0x7dd7,
-  0x9df7, 0xbe78, 0xf7bb, 0xc6b8, 0xb658, 0x9554, 0x7cf3, 0x8514,
-  0x74d3, 0x8514, 0xadb5, 0xc636, 0xceb7, 0xadb4, 0x7451, 0x5b8f,
-  0x9534, 0x9533, 0x4b2d, 0x5b8f, 0x5baf, 0x5b8e, 0x6c30, 0x6c10,
-  0x63ae, 0x6bcf, 0x73ef, 0x8471, 0x5b6d, 0x5b4e, 0x7410, 0x94d2,
-  0xad33, 0x73cf, 0x530d, 0x428b, 0x52cc, 0x638e, 0x4acb, 0x428a,
-  0x634d, 0x7c0f, 0x634d, 0x6c10, 0x3a6a, 0x532d, 0x8cd2, 0xadb6,
-  0xbe37, 0xbe37, 0xce98, 0xceb9, 0x9d33, 0x6b8d, 0x634d, 0x5aec,
-  0x5aeb, 0x4a6a, 0x4a8a, 0x4a6a, 0x4a6a, 0x4229, 0x4249, 0x4228,
-  0x4228, 0x5b0c, 0x8430, 0x9cd2, 0x9d13, 0xad54, 0xbdb5, 0xbdb5,
-  0xad54, 0xa533, 0x94b1, 0x9491, 0x8c70, 0x7bef, 0x5aeb, 0x4a89,
-  0x52aa, 0x5b0b, 0x6bae, 0x8450, 0x8c71, 0x8450, 0x8c91, 0xbe38,
-  0xef7d, 0xa575, 0x8471, 0x8491, 0x8cd2, 0x73ef, 0x73ef, 0x7410,
-  0x7c50, 0x8491, 0x7410, 0x6bae, 0x5b4d, 0x638e, 0x5b4d, 0x532c,
-  0x530c, 0x530c, 0x530c, 0x530c, 0x530c, 0x638e, 0x7410, 0x638e,
-  0x530c, 0x5b4d, 0x530c, 0x52ec, 0x4acb, 0x4aec, 0x4acb, 0x4acb,
-  0x4aab, 0x4acb, 0x4aab, 0x42ab, 0x42ab, 0x4aab, 0x426a, 0x42ab,
-  0x426a, 0x426a, 0x428a, 0x3a49, 0x428a, 0x426a, 0x426a, 0x428a,
-  0x428a, 0x426a, 0x3a4a, 0x3a29, 0x3a29, 0x3a49, 0x3a29, 0x4249,
-  0x4249, 0x424a, 0x4249, 0x3a29, 0x3a49, 0x426a, 0x3a09, 0x3a29,
-  0x39e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31e9, 0x3209, 0x31e9, 0x3208,
-  0x3209, 0x3a4a, 0x3a4a, 0x428a, 0x3a49, 0x3a49, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x426a, 0x3a6a, 0x3a49, 0x426a, 0x3a49,
-  0x3a49, 0x3a49, 0x3a69, 0x3229, 0x4b2c, 0x8575, 0x438e, 0x324a,
-  0x3209, 0x31e9, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x3208, 0x3209, 0x3229, 0x3249, 0x3a6a, 0x3a8a,
-  0x3aab, 0x3acc, 0x430c, 0x432d, 0x4b4d, 0x538e, 0x53af, 0x5bf0,
-  0x5c31, 0x6471, 0x6cb2, 0x6cf3, 0x7d34, 0x8595, 0x95f7, 0x9e58,
-  0xa6b9, 0xb6fa, 0xbf5b, 0xcf9b, 0xdfdc, 0xfffe, 0xf7fe, 0xeffd,
-  0xeffd, 0xdfbc, 0xdf9b, 0xdf7b, 0xcf3b, 0x9e58, 0x9638, 0x75b6,
-  0x8df6, 0xbe78, 0xef9b, 0xd6f9, 0xa5b5, 0x9d95, 0x8555, 0x84f4,
-  0x7cd3, 0x8d54, 0xa574, 0xc637, 0xd6b7, 0xc616, 0x9d74, 0x4b2d,
-  0x7c71, 0x94f2, 0x4acc, 0x534e, 0x536e, 0x5b8e, 0x63ef, 0x6c10,
-  0x63af, 0x6bcf, 0x6bd0, 0x8472, 0x6bcf, 0x636e, 0x7c30, 0x7c0f,
-  0x6b6d, 0x7c10, 0x636e, 0x52ec, 0x4a8b, 0x530c, 0x4aec, 0x4aab,
-  0x52ec, 0x636d, 0x52eb, 0x6c10, 0x532d, 0x530c, 0x9533, 0xa594,
-  0xad74, 0xb5d6, 0xc637, 0xb5f6, 0x8471, 0x6b8d, 0x5b0c, 0x4a8a,
-  0x52ab, 0x52ab, 0x4a8a, 0x4a49, 0x4a6a, 0x4a69, 0x4a69, 0x4249,
-  0x4a69, 0x6b4d, 0x8c71, 0x9cd2, 0xad53, 0xb595, 0xb574, 0xad53,
-  0xa533, 0xa512, 0x9cf2, 0x9d12, 0x8c50, 0x73ce, 0x632c, 0x4a8a,
-  0x4aaa, 0x5b0b, 0x73ce, 0x7c0f, 0x73ef, 0x8c91, 0xa575, 0xb617,
-  0x7c50, 0x6bce, 0x6bae, 0x73ef, 0x7c50, 0x8491, 0x6bce, 0x7c51,
-  0x7410, 0x6bcf, 0x6bae, 0x638d, 0x5b2d, 0x5b6d, 0x5b2d, 0x5b4d,
-  0x5b4d, 0x530c, 0x5b2c, 0x52ec, 0x530c, 0x5b4d, 0x5b2d, 0x5b4d,
-  0x52ec, 0x52ec, 0x532d, 0x530c, 0x4aec, 0x4aab, 0x4acb, 0x4acb,
-  0x4aab, 0x42aa, 0x42ab, 0x428a, 0x42ab, 0x428a, 0x428b, 0x428a,
-  0x426a, 0x426a, 0x426a, 0x3a4a, 0x428a, 0x426a, 0x426a, 0x4aab,
-  0x426a, 0x426a, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a49, 0x426a, 0x3a29, 0x3a49, 0x3a29, 0x3a08,
-  0x3a08, 0x3a09, 0x31c8, 0x31c8, 0x31e8, 0x31e8, 0x31c7, 0x31c8,
-  0x31e8, 0x31c8, 0x31c8, 0x31c8, 0x31e9, 0x3209, 0x29e8, 0x3229,
-  0x42ab, 0x426a, 0x3a29, 0x3a49, 0x426a, 0x3a29, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x3a49, 0x3a49, 0x3a29,
-  0x3a49, 0x3a49, 0x3a6a, 0x426a, 0x3a29, 0x4b0c, 0x6451, 0x42ec,
-  0x3229, 0x31e8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x3208, 0x3209, 0x3229, 0x324a, 0x3a6a, 0x3a8a,
-  0x3aab, 0x3acc, 0x42ec, 0x432d, 0x4b4d, 0x538e, 0x53cf, 0x5bf0,
-  0x6431, 0x6472, 0x6c92, 0x74f3, 0x7d34, 0x8595, 0x8df6, 0x9e58,
-  0xa699, 0xaefa, 0xbf3b, 0xc79b, 0xdffc, 0xf7fe, 0xfffe, 0xeffd,
-  0xefdd, 0xdf9b, 0xdf9c, 0xdf7b, 0xd75b, 0x9e38, 0x9637, 0x75b6,
-  0x85b6, 0xb678, 0xe75a, 0xdf39, 0xadf6, 0xadd6, 0x8534, 0x7cf3,
-  0x84f3, 0x8d34, 0x9533, 0xc636, 0xd6b8, 0xce97, 0x8d12, 0x3aac,
-  0x5b8e, 0x9d33, 0x5b2d, 0x536e, 0x534e, 0x63af, 0x63ef, 0x6bf0,
-  0x7410, 0x63af, 0x63af, 0x73f0, 0x8491, 0x73ef, 0x740f, 0x7c50,
-  0x8450, 0x8450, 0x5b4d, 0x5b4d, 0x636e, 0x636d, 0x4aab, 0x4aab,
-  0x5b2d, 0x8c70, 0x52ca, 0x530c, 0x3a6a, 0x5b4d, 0x9d34, 0x94f2,
-  0xa554, 0xb5d6, 0xb5d6, 0x94f2, 0x73ef, 0x636d, 0x52cb, 0x4249,
-  0x3a08, 0x4249, 0x4249, 0x4249, 0x5aec, 0x4a8a, 0x4249, 0x52ca,
-  0x632c, 0x738d, 0x8430, 0x94d2, 0xad54, 0xa553, 0xb574, 0xad53,
-  0x9cf2, 0xa532, 0x9491, 0x8c70, 0x844f, 0x73ce, 0x5b0c, 0x52aa,
-  0x52aa, 0x634d, 0x6b8d, 0x6b8d, 0x8450, 0x94f2, 0x94f3, 0x8470,
-  0x6bae, 0x6bce, 0x636d, 0x5b4d, 0x7c30, 0x7c30, 0x6b8e, 0x6bcf,
-  0x6bae, 0x6b8e, 0x6b8e, 0x636d, 0x5b4d, 0x5b4d, 0x530c, 0x636d,
-  0x5b4d, 0x530c, 0x4aeb, 0x52ec, 0x4aeb, 0x530c, 0x52eb, 0x52ec,
-  0x5b2d, 0x4aeb, 0x4acb, 0x4acb, 0x4acb, 0x4acb, 0x4aab, 0x42aa,
-  0x428a, 0x42ab, 0x4acb, 0x4aec, 0x426a, 0x428a, 0x428a, 0x426a,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x426a, 0x428a, 0x426a, 0x3a4a,
-  0x3a49, 0x3a29, 0x3a29, 0x3a49, 0x3a29, 0x3a29, 0x3a09, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x426a, 0x428a, 0x52ec, 0x39e8, 0x39e8,
-  0x31e8, 0x31e8, 0x31c7, 0x31e8, 0x31e8, 0x31c8, 0x31c8, 0x29a7,
-  0x29a7, 0x31e8, 0x31e8, 0x31e8, 0x31e9, 0x31e9, 0x29e9, 0x4b0d,
-  0x4b0d, 0x3a49, 0x3a49, 0x3a49, 0x3a29, 0x3a49, 0x3a49, 0x3a29,
-  0x3a09, 0x3a29, 0x3a29, 0x3a09, 0x3a29, 0x3a49, 0x3a49, 0x3a49,
-  0x3a49, 0x426a, 0x426a, 0x3a49, 0x4269, 0x3a29, 0x428b, 0x536e,
-  0x3aab, 0x3209, 0x31e9, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8,
-  0x31e8, 0x31e8, 0x3208, 0x3209, 0x3229, 0x324a, 0x3a6a, 0x3a8a,
-  0x3aab, 0x3acc, 0x42ec, 0x432d, 0x4b4d, 0x538e, 0x53cf, 0x5bf0,
-  0x6451, 0x6471, 0x6c92, 0x74d3, 0x7d34, 0x8595, 0x8df6, 0x9e58,
-  0xa698, 0xaefa, 0xbf3b, 0xc79b, 0xd7db, 0xf7fd, 0xfffe, 0xf7fd,
-  0xefdd, 0xdfbc, 0xdf9c, 0xdf7b, 0xd75b, 0x9637, 0x9617, 0x75b6,
-  0x7d96, 0xb657, 0xdf19, 0xe75a, 0xb616, 0xadf6, 0x8534, 0x6c92,
-  0x84d3, 0x7cd3, 0x9534, 0xce77, 0xded8, 0xc676, 0x6c4f, 0x42ed,
-  0x3acc, 0x8cd2, 0x5b8e, 0x538e, 0x536e, 0x5b8e, 0x63cf, 0x63af,
-  0x6c10, 0x5b8e, 0x5b6e, 0x6bcf, 0x740f, 0x7c30, 0x6bef, 0x8450,
-  0x94b1, 0x8430, 0x638d, 0x5b4c, 0x73ce, 0x9492, 0x52eb, 0x4aab,
-  0x634d, 0xbdd5, 0x9491, 0x530b, 0x4aeb, 0x4aec, 0x9513, 0x9d13,
-  0x9d13, 0xad95, 0xb5f6, 0x9512, 0x73ef, 0x632c, 0x52aa, 0x3a08,
-  0x4228, 0x4249, 0x52cb, 0x4aaa, 0x73ae, 0x6b6e, 0x5b0c, 0x632c,
-  0x7bef, 0x7c0f, 0x94d2, 0x94d2, 0x9d12, 0x9cf2, 0xb594, 0xad94,
-  0xa512, 0x9cf2, 0x9cf2, 0x9491, 0x94b1, 0x8c70, 0x6bae, 0x52cb,
-  0x4aaa, 0x5aeb, 0x5b0b, 0x636d, 0x7c0f, 0x8c91, 0x8cb2, 0x8cb2,
-  0x73ef, 0x742f, 0x5b0c, 0x52eb, 0x636d, 0x6b8e, 0x636d, 0x6b8e,
-  0x5b2c, 0x5b2c, 0x5b0c, 0x5b2c, 0x5b4d, 0x5b2c, 0x532c, 0x5b4d,
-  0x52eb, 0x4acb, 0x4acb, 0x52ec, 0x4acb, 0x4acb, 0x52ec, 0x5b2d,
-  0x530c, 0x4aeb, 0x4aab, 0x4acb, 0x4aab, 0x42aa, 0x42aa, 0x4acb,
-  0x428a, 0x42ab, 0x428a, 0x42ab, 0x428a, 0x428a, 0x428a, 0x426a,
-  0x428b, 0x3a6a, 0x428a, 0x3a49, 0x3a49, 0x426a, 0x426a, 0x426a,
-  0x3a49, 0x3a4a, 0x3a29, 0x3a29, 0x3a09, 0x3a09, 0x3a29, 0x3a29,
-  0x3a09, 0x3a29, 0x3a49, 0x3a4a, 0x428a, 0x428a, 0x31e8, 0x3a08,
-  0x31e8, 0x31e8, 0x31c7, 0x31c7, 0x31c8, 0x31c8, 0x31e8, 0x31c8,
-  0x31c8, 0x31e8, 0x31c8, 0x31e8, 0x29e9, 0x29e9, 0x3a4a, 0x428b,
-  0x3a4a, 0x3a29, 0x3a29, 0x3a49, 0x3a29, 0x3a29, 0x426a, 0x3a29,
-  0x3a09, 0x3a09, 0x3a29, 0x3a09, 0x3a29, 0x3a49, 0x3a49, 0x3a29,
-  0x3a29, 0x3a49, 0x3a29, 0x3a49, 0x426a, 0x3a69, 0x3a29, 0x3a69,
-  0x42ec, 0x3acc, 0x3229, 0x31e9, 0x31e8, 0x31e8, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x3209, 0x3209, 0x3229, 0x324a, 0x3a6a, 0x3a8b,
-  0x3aab, 0x3acc, 0x42ec, 0x430d, 0x4b4d, 0x4b8e, 0x53af, 0x5bef,
-  0x6430, 0x6451, 0x6c92, 0x74d3, 0x7d34, 0x8575, 0x8dd6, 0x9637,
-  0xa698, 0xaed9, 0xb73a, 0xc77b, 0xd7db, 0xf7fe, 0xfffe, 0xeffd,
-  0xeffd, 0xdfbc, 0xdf7b, 0xdf7c, 0xdf7b, 0x9e58, 0x9638, 0x7db6,
-  0x6d55, 0xae37, 0xceb8, 0xef7b, 0xadd6, 0xadf6, 0x8d55, 0x6472,
-  0x84f3, 0x7d14, 0x84f3, 0xbe16, 0xd6b8, 0xce97, 0x6c0f, 0x42ec,
-  0x3aed, 0x5b8e, 0x6bcf, 0x536e, 0x538e, 0x638f, 0x7410, 0x63ae,
-  0x63cf, 0x638e, 0x5b6e, 0x6bf0, 0x8471, 0x740f, 0x6bce, 0x8450,
-  0x8c90, 0x8450, 0x6bae, 0x8450, 0x7bef, 0x634d, 0x532c, 0x4aab,
-  0x73ad, 0xb553, 0x73ce, 0x4aeb, 0x3a49, 0x42aa, 0x740f, 0x8cb1,
-  0x8cb1, 0x9d33, 0xbe37, 0x94d2, 0x634c, 0x632c, 0x52cb, 0x4229,
-  0x4a69, 0x5aec, 0x5acb, 0x630c, 0x630c, 0x6b4d, 0x8430, 0xa534,
-  0x7c0f, 0x73ce, 0x7c0f, 0x842f, 0x8c50, 0x94b1, 0xa553, 0xa553,
-  0x9cd2, 0x9cd2, 0x9cd2, 0x94b1, 0x8c70, 0x8c70, 0x7c10, 0x6b8d,
-  0x6b6d, 0x634c, 0x634c, 0x636d, 0x73ef, 0x8450, 0x8c91, 0x94f2,
-  0x8cb2, 0x6b8d, 0x4aaa, 0x4a8a, 0x52ec, 0x636d, 0x530c, 0x5b0c,
-  0x52eb, 0x4acb, 0x52eb, 0x52ec, 0x4acb, 0x532c, 0x52eb, 0x4acb,
-  0x4acb, 0x4acb, 0x4acb, 0x52ec, 0x4acb, 0x4aab, 0x4aab, 0x4acb,
-  0x4aab, 0x4acb, 0x42aa, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x4aab,
-  0x428a, 0x42ab, 0x426a, 0x426a, 0x4aab, 0x428a, 0x428a, 0x3a6a,
-  0x426a, 0x426a, 0x428a, 0x4249, 0x3a49, 0x3a49, 0x3a49, 0x3a29,
-  0x3a49, 0x3a49, 0x3a29, 0x3a09, 0x3a09, 0x3a29, 0x3a09, 0x3a29,
-  0x3a09, 0x3a29, 0x3a29, 0x4249, 0x426a, 0x3a08, 0x31e8, 0x31e8,
-  0x31c8, 0x31e8, 0x31c8, 0x31c8, 0x31e8, 0x31e8, 0x31e8, 0x31c8,
-  0x31c8, 0x31c8, 0x29c8, 0x29c8, 0x29c8, 0x3a4a, 0x426b, 0x3a4a,
-  0x3a4a, 0x3a4a, 0x3a29, 0x3a49, 0x3a29, 0x3a08, 0x3208, 0x3a29,
-  0x3208, 0x3a09, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x3a29, 0x3a49, 0x3a49, 0x3a49, 0x3a4a, 0x426a, 0x426a, 0x4249,
-  0x428a, 0x536e, 0x3aab, 0x3229, 0x3209, 0x3209, 0x31e9, 0x31e9,
-  0x3208, 0x3208, 0x3209, 0x3209, 0x3229, 0x324a, 0x3a6a, 0x3a8b,
-  0x42ab, 0x42cb, 0x42ec, 0x4b2d, 0x4b4d, 0x4b8e, 0x53af, 0x5bef,
-  0x5c10, 0x6451, 0x6492, 0x6cd3, 0x7534, 0x7d75, 0x8dd6, 0x9637,
-  0xa699, 0xaed9, 0xb73b, 0xc77b, 0xd7db, 0xf7fe, 0xfffe, 0xeffd,
-  0xeffd, 0xe7bc, 0xdf7b, 0xdf7b, 0xdf9b, 0xa678, 0x9617, 0x7dd6,
-  0x6d56, 0xa5f7, 0xc698, 0xef9b, 0xadd6, 0xae17, 0x8d75, 0x6492,
-  0x7cd3, 0x7cf3, 0x7cd3, 0xc637, 0xd697, 0xce97, 0x6c30, 0x3acc,
-  0x42ed, 0x42ed, 0x638e, 0x534e, 0x538e, 0x6bcf, 0xb5d5, 0x532d,
-  0x42ac, 0x534e, 0x534e, 0x6bcf, 0x8c91, 0x740f, 0x5b4d, 0x740e,
-  0x844f, 0x8471, 0x636d, 0xa4f2, 0x8430, 0x52eb, 0x530c, 0x4acb,
-  0x8c70, 0xb553, 0x630c, 0x530c, 0x428a, 0x52ec, 0x5b4d, 0x740f,
-  0x8470, 0x8c91, 0x8470, 0x7c0f, 0x632c, 0x632c, 0x5aeb, 0x5aeb,
-  0x5aeb, 0x5b0c, 0x632c, 0x632c, 0x5b0c, 0x5b0c, 0x632c, 0xa554,
-  0x7c10, 0x7bef, 0x7bef, 0x73ae, 0x7bef, 0x8c50, 0x9491, 0x9d12,
-  0xa533, 0x94b1, 0x9491, 0xa513, 0x9cf2, 0x8c70, 0x73ee, 0x7c30,
-  0x8450, 0x7c0f, 0x73ce, 0x5b2c, 0x73ce, 0x7c0f, 0x8471, 0x8c91,
-  0x7c0f, 0x5b0c, 0x4269, 0x426a, 0x4a8a, 0x52cb, 0x52eb, 0x4aaa,
-  0x4aaa, 0x4269, 0x4a8a, 0x4aab, 0x4aab, 0x4aab, 0x4aab, 0x4acb,
-  0x4acb, 0x4aab, 0x4acb, 0x4acb, 0x4aab, 0x4aab, 0x4aaa, 0x428a,
-  0x4aab, 0x4aab, 0x4acb, 0x42ab, 0x4aab, 0x42ab, 0x42ab, 0x428a,
-  0x4aab, 0x428a, 0x42ab, 0x428a, 0x428a, 0x3a69, 0x426a, 0x3a6a,
-  0x426a, 0x3a6a, 0x424a, 0x4249, 0x424a, 0x3a49, 0x3a6a, 0x3a49,
-  0x3a49, 0x3a29, 0x3a29, 0x3a49, 0x3a29, 0x3a09, 0x3208, 0x3a09,
-  0x3209, 0x3a29, 0x3a29, 0x3a29, 0x426a, 0x4aec, 0x3a29, 0x3208,
-  0x31e8, 0x39e8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8,
-  0x29a8, 0x29a8, 0x29a8, 0x29c8, 0x42ac, 0x4acc, 0x3a4a, 0x3a29,
-  0x424a, 0x3a49, 0x3a29, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a08,
-  0x3a08, 0x3a09, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a09,
-  0x3a09, 0x3a49, 0x3a49, 0x3a49, 0x3a49, 0x3a49, 0x4269, 0x4269,
-  0x3a69, 0x3aaa, 0x42ec, 0x42ab, 0x3a4a, 0x3209, 0x3209, 0x3209,
-  0x3209, 0x3209, 0x3209, 0x3229, 0x3249, 0x3a6a, 0x3a6a, 0x3a8b,
-  0x3aab, 0x42ec, 0x430c, 0x4b2d, 0x4b4d, 0x538e, 0x53af, 0x53f0,
-  0x5c10, 0x6451, 0x6492, 0x6cd3, 0x7534, 0x7d75, 0x8dd6, 0x9637,
-  0xa699, 0xaed9, 0xb71a, 0xc77b, 0xd7db, 0xeffd, 0xfffe, 0xf7fd,
-  0xeffd, 0xe7bc, 0xdf7b, 0xd75b, 0xe7bc, 0xae78, 0x8e17, 0x7df7,
-  0x5d35, 0x8db6, 0xc6b8, 0xe75a, 0xb617, 0xadf6, 0x8d75, 0x5c92,
-  0x6c92, 0x74d3, 0x74b2, 0xbe16, 0xce57, 0xce98, 0x7450, 0x3aec,
-  0x42ed, 0x42ed, 0x536e, 0x5b6e, 0x536e, 0x6c30, 0xdef9, 0x530c,
-  0x3229, 0x3a6a, 0x42ec, 0x638f, 0x8c91, 0x7c50, 0x5b6e, 0x73cf,
-  0x8c70, 0x73ce, 0x634c, 0x9490, 0xa533, 0xb594, 0x638d, 0x42aa,
-  0xa512, 0xa533, 0x630c, 0x4aab, 0x426a, 0x4aab, 0x4aaa, 0x6b6e,
-  0x8450, 0x9d13, 0x8470, 0x6b8d, 0x634c, 0x634c, 0x5b0b, 0x6b6d,
-  0x6b8d, 0x738d, 0x6b8d, 0x630c, 0x630c, 0x632c, 0x52cb, 0x4a8a,
-  0x4a49, 0x5aec, 0x630c, 0x6b6d, 0x738e, 0x73af, 0x8450, 0x94d2,
-  0x94b1, 0x9d12, 0xa533, 0x9cf2, 0x9cf2, 0x8c91, 0x7c0f, 0x7c30,
-  0x8450, 0x8c91, 0x73cf, 0x634d, 0x73ae, 0x73ee, 0x7c0f, 0x73ce,
-  0x634d, 0x4aaa, 0x4229, 0x4229, 0x3a29, 0x4acb, 0x52eb, 0x4249,
-  0x3a29, 0x3a29, 0x4249, 0x4249, 0x4a8a, 0x4a8a, 0x4a8a, 0x4acb,
-  0x4aab, 0x4aaa, 0x4aab, 0x4aaa, 0x4aab, 0x4aab, 0x4aaa, 0x428a,
-  0x4aab, 0x4acb, 0x42aa, 0x4aab, 0x428a, 0x4aab, 0x4acb, 0x4aab,
-  0x428a, 0x428a, 0x3a6a, 0x428a, 0x42ab, 0x426a, 0x3a29, 0x428a,
-  0x3a49, 0x426a, 0x426a, 0x3a49, 0x424a, 0x3a49, 0x3a49, 0x428a,
-  0x426a, 0x3a49, 0x3a29, 0x3a09, 0x3208, 0x3a49, 0x3a29, 0x3208,
-  0x3a08, 0x3a29, 0x3a29, 0x3a09, 0x3a49, 0x6baf, 0x3a4a, 0x3a08,
-  0x31e8, 0x31e8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x29c8, 0x31c8,
-  0x29a7, 0x2987, 0x31c8, 0x428b, 0x4acc, 0x3a29, 0x3a29, 0x3a29,
-  0x3a49, 0x3a29, 0x3208, 0x3a29, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a29, 0x3a09, 0x3a29, 0x3a09, 0x3a29, 0x3a29, 0x3a09, 0x3a09,
-  0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x426a, 0x3a49, 0x426a, 0x426a,
-  0x428a, 0x3a6a, 0x428a, 0x42cb, 0x42cc, 0x42ab, 0x3a6a, 0x3229,
-  0x3209, 0x3229, 0x3229, 0x3a49, 0x3a6a, 0x3a8a, 0x3a8b, 0x3aab,
-  0x42cb, 0x42ec, 0x4b2d, 0x4b2d, 0x4b4d, 0x536e, 0x53af, 0x5bf0,
-  0x5c10, 0x6451, 0x6472, 0x6cd3, 0x7534, 0x7d55, 0x8dd6, 0x9637,
-  0xa698, 0xaed9, 0xb71a, 0xc77b, 0xd7db, 0xeffd, 0xfffe, 0xf7fd,
-  0xeffd, 0xe7dc, 0xd77b, 0xcf3b, 0xef9b, 0xb699, 0x85d6, 0x7df7,
-  0x5d14, 0x7555, 0xbe98, 0xd6f9, 0xb637, 0xa5d6, 0x9574, 0x64b2,
-  0x5c52, 0x74d3, 0x7492, 0xb5b5, 0xbdf5, 0xce77, 0x7450, 0x42ec,
-  0x430d, 0x42ed, 0x536d, 0x6bcf, 0x5bae, 0x5bae, 0xb5b4, 0x4aeb,
-  0x322a, 0x3a4a, 0x3a8b, 0x532d, 0x7c50, 0x6bee, 0x5b6e, 0x636e,
-  0x7c2f, 0x7c2f, 0x6b8d, 0x7bee, 0xa511, 0xc615, 0x6b8d, 0x6b6d,
-  0xb5b4, 0xb573, 0x6b4c, 0x3a49, 0x31e8, 0x3a29, 0x3a29, 0x4aab,
-  0x73cf, 0x8471, 0x8450, 0x73ee, 0x7bee, 0x8c71, 0x9491, 0x9491,
-  0x9cd2, 0x8430, 0x842f, 0x6b6d, 0x632c, 0x634d, 0x5b0c, 0x4a6a,
-  0x39e7, 0x39c7, 0x39e8, 0x4229, 0x4a8a, 0x6bae, 0x8450, 0x8450,
-  0x8c70, 0x9491, 0x94d1, 0x8c70, 0x8c70, 0x8c71, 0x8450, 0x8450,
-  0x7c2f, 0x8c71, 0x94d2, 0x8c50, 0x73ae, 0x73ef, 0x6bce, 0x636d,
-  0x5b0c, 0x4a8a, 0x4249, 0x3a08, 0x31e8, 0x4249, 0x426a, 0x3a08,
-  0x3a08, 0x3a08, 0x4229, 0x4249, 0x4269, 0x426a, 0x4aaa, 0x4aab,
-  0x4a8a, 0x4aaa, 0x4aab, 0x4aaa, 0x4aab, 0x4aaa, 0x4aab, 0x4aab,
-  0x42aa, 0x4aab, 0x4aab, 0x4aab, 0x428a, 0x426a, 0x428a, 0x428a,
-  0x428a, 0x428a, 0x428a, 0x428a, 0x3a49, 0x3a29, 0x424a, 0x428b,
-  0x3a49, 0x3a49, 0x426a, 0x3a49, 0x3a29, 0x3a29, 0x3a29, 0x3a09,
-  0x3208, 0x3a29, 0x3a29, 0x3208, 0x3a09, 0x3a08, 0x3a29, 0x3a08,
-  0x3a29, 0x3208, 0x3a29, 0x3a29, 0x3a49, 0x3a6a, 0x4aab, 0x31e8,
-  0x3a08, 0x39e9, 0x31c8, 0x31e8, 0x31e8, 0x31c8, 0x31c8, 0x2987,
-  0x2987, 0x31e8, 0x3a4a, 0x4aab, 0x426a, 0x3a08, 0x3a09, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a29, 0x3a08, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a09, 0x3a09,
-  0x3a29, 0x3a29, 0x426a, 0x3a49, 0x426a, 0x426a, 0x3a4a, 0x426a,
-  0x426a, 0x426a, 0x428a, 0x42ab, 0x42ab, 0x4aec, 0x42ec, 0x42cc,
-  0x3a8b, 0x3a8a, 0x3a8a, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42ec,
-  0x42ec, 0x430c, 0x4b2d, 0x4b4d, 0x4b4e, 0x538e, 0x53af, 0x5bd0,
-  0x5c31, 0x6451, 0x6c92, 0x6cd2, 0x7514, 0x7d55, 0x8dd6, 0x9637,
-  0x9e98, 0xaed9, 0xb71a, 0xc77b, 0xd7bb, 0xeffd, 0xfffe, 0xf7fd,
-  0xeffd, 0xe7fc, 0xd77b, 0xc73b, 0xe79b, 0xbeb9, 0x7db6, 0x85f7,
-  0x6535, 0x6d35, 0xb698, 0xced8, 0xb636, 0x9d75, 0x8d54, 0x64b3,
-  0x5c51, 0x74d3, 0x6c72, 0xadd6, 0xbdf6, 0xd678, 0x9533, 0x42ed,
-  0x430d, 0x42ec, 0x534d, 0x6bef, 0x6bf0, 0x536e, 0xadb5, 0x8450,
-  0x3209, 0x3a6a, 0x3a6b, 0x428b, 0x532d, 0x740f, 0x63ae, 0x5b4d,
-  0x740f, 0x8491, 0x7c0f, 0x7bee, 0xad12, 0x9cd1, 0x630c, 0x9cf1,
-  0xb593, 0xb593, 0x9470, 0x426a, 0x4249, 0x4a8a, 0x4a8a, 0x636e,
-  0x6bae, 0x5b0c, 0x7c2f, 0x9d12, 0x9cf2, 0xa533, 0xa533, 0x9cb1,
-  0x9cb1, 0x8c2f, 0x7bce, 0x630c, 0x52cb, 0x5b0c, 0x632c, 0x4269,
-  0x4229, 0x39c7, 0x31c7, 0x31c7, 0x4249, 0x6b8e, 0x73ef, 0x7bef,
-  0x94b1, 0x94d2, 0x94d1, 0x8470, 0x8c91, 0x8450, 0x8450, 0x8471,
-  0x7c0f, 0x73ee, 0x7c0f, 0xb553, 0x9491, 0x6bae, 0x636d, 0x632c,
-  0x5b0c, 0x4a8a, 0x4229, 0x31e7, 0x3186, 0x31c7, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x3a08, 0x4249, 0x4269, 0x4a8a, 0x4aab, 0x4aab,
-  0x4a8a, 0x428a, 0x4aaa, 0x428a, 0x4aab, 0x4aaa, 0x42aa, 0x4aab,
-  0x4acb, 0x4acb, 0x4acb, 0x4aab, 0x426a, 0x428a, 0x428a, 0x428a,
-  0x42ab, 0x428a, 0x428a, 0x426a, 0x426a, 0x3a4a, 0x426a, 0x424a,
-  0x426a, 0x426a, 0x426a, 0x3a49, 0x426a, 0x3a29, 0x3a29, 0x3a29,
-  0x3208, 0x3a29, 0x31e8, 0x3a09, 0x3a29, 0x3a29, 0x3208, 0x3a08,
-  0x3208, 0x31e8, 0x3a09, 0x3a29, 0x3a29, 0x426a, 0x532d, 0x52ec,
-  0x31e8, 0x3a09, 0x3208, 0x31e8, 0x31e8, 0x31c8, 0x2987, 0x3209,
-  0x4aab, 0x4acb, 0x428b, 0x424a, 0x3a09, 0x3a09, 0x3a29, 0x3a09,
-  0x3a09, 0x3a09, 0x3a29, 0x3208, 0x3a08, 0x3a08, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x424a, 0x3a49, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a49, 0x426a, 0x3a49, 0x3a4a, 0x3a49, 0x426a,
-  0x428a, 0x426a, 0x428a, 0x428a, 0x42ab, 0x42ab, 0x42cc, 0x42cc,
-  0x42cb, 0x4b0c, 0x42ec, 0x42ec, 0x42ec, 0x42ec, 0x430c, 0x4b0c,
-  0x430c, 0x4b0d, 0x4b2d, 0x4b4d, 0x4b6e, 0x536e, 0x53af, 0x5bd0,
-  0x5c10, 0x5c51, 0x6492, 0x6cb2, 0x7513, 0x7d55, 0x8dd6, 0x9637,
-  0x9e98, 0xaed9, 0xb71a, 0xc77b, 0xd7bb, 0xeffd, 0xfffe, 0xf7fd,
-  0xeffd, 0xe7fc, 0xd77b, 0xc71b, 0xe79b, 0xc6fa, 0x7db6, 0x85f7,
-  0x6555, 0x6514, 0xb698, 0xdf39, 0xbe77, 0x9574, 0x9575, 0x64b3,
-  0x5c51, 0x74b3, 0x7472, 0x9d74, 0xad94, 0xc636, 0x94d2, 0x4b4e,
-  0x3aec, 0x42ed, 0x4aec, 0x6bef, 0x63ae, 0x5baf, 0x8cb2, 0x9512,
-  0x6bef, 0x3229, 0x3a8b, 0x42ac, 0x4aab, 0x638e, 0x638e, 0x636d,
-  0x6bae, 0x7c30, 0x8450, 0x9491, 0x9cd1, 0xa533, 0x630c, 0xa552,
-  0x8c70, 0x6b8d, 0x7bee, 0x3a69, 0x426a, 0x4a8a, 0x4a6a, 0x5b0c,
-  0x632d, 0x5b0b, 0x7c0f, 0x8c70, 0x94b1, 0x94b1, 0x94b1, 0x9491,
-  0x9470, 0x8c2f, 0x7bae, 0x5aeb, 0x5aeb, 0x5aeb, 0x52cb, 0x4249,
-  0x39e8, 0x31a7, 0x31c7, 0x39e8, 0x52aa, 0x5b0c, 0x636d, 0x73ce,
-  0x8c70, 0x94b1, 0x8cb1, 0x842f, 0x7c0f, 0x7c0f, 0x7c0f, 0x7c0f,
-  0x73ef, 0x6bae, 0x7bef, 0x7c0f, 0x73ae, 0x6b8e, 0x636d, 0x5b0c,
-  0x52ab, 0x4a6a, 0x3a28, 0x31c7, 0x2986, 0x2966, 0x31a7, 0x31c7,
-  0x31c8, 0x31e8, 0x3a28, 0x426a, 0x4269, 0x4aaa, 0x4aab, 0x4acb,
-  0x4aaa, 0x4acb, 0x4acb, 0x4aaa, 0x428a, 0x4aab, 0x4aab, 0x4aab,
-  0x4acb, 0x4aab, 0x428a, 0x428a, 0x426a, 0x428a, 0x3a6a, 0x428a,
-  0x428a, 0x426a, 0x3a49, 0x3a49, 0x3a49, 0x3a49, 0x3a49, 0x3a49,
-  0x426a, 0x428a, 0x3a49, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x3a49, 0x31e8, 0x31e8, 0x3a29, 0x3a09, 0x3a29, 0x3a09, 0x3a29,
-  0x31e8, 0x4249, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x424a, 0x4acb,
-  0x3a29, 0x4249, 0x3a29, 0x426a, 0x3a29, 0x31e8, 0x42ab, 0x532d,
-  0x3a49, 0x3a4a, 0x3a4a, 0x3a29, 0x3a29, 0x3a09, 0x3a08, 0x31e8,
-  0x3a28, 0x3a08, 0x3208, 0x3a29, 0x3a08, 0x3208, 0x3a08, 0x3a29,
-  0x3a29, 0x3a29, 0x3a09, 0x3a29, 0x3a29, 0x3a09, 0x3a29, 0x3a29,
-  0x3a29, 0x4249, 0x426a, 0x424a, 0x3a49, 0x3a49, 0x428a, 0x426a,
-  0x426a, 0x3a6a, 0x426a, 0x428a, 0x428a, 0x3a6a, 0x42ab, 0x42ab,
-  0x42cc, 0x42ec, 0x42cb, 0x42eb, 0x430c, 0x430c, 0x4b0c, 0x4b0c,
-  0x4b0c, 0x4b0d, 0x4b4d, 0x4b4e, 0x536e, 0x538e, 0x53af, 0x53cf,
-  0x5bf0, 0x5c31, 0x6472, 0x6cb2, 0x74f3, 0x7d55, 0x85b6, 0x9617,
-  0x9e78, 0xa6d9, 0xb71a, 0xc77b, 0xd7bb, 0xe7fd, 0xfffe, 0xf7fd,
-  0xeffd, 0xe7fc, 0xd77b, 0xbefa, 0xdf7b, 0xcf3a, 0x7db6, 0x85d7,
-  0x6d55, 0x5d15, 0xae58, 0xdf39, 0xc6d8, 0xa5d6, 0x9595, 0x6cd3,
-  0x5c31, 0x7492, 0x6c71, 0xa574, 0xa594, 0xb5b5, 0x9554, 0x5bcf,
-  0x430d, 0x4b2d, 0x4aec, 0x63ae, 0x63ae, 0x6bf0, 0x63ae, 0x8cd2,
-  0x9d33, 0x3a6a, 0x3aab, 0x42ab, 0x42ab, 0x532d, 0x6bcf, 0x6bae,
-  0x636d, 0x6bae, 0x8470, 0xa4f2, 0x9491, 0xa534, 0x7c0f, 0x7bee,
-  0x4249, 0x6b4d, 0x83ee, 0x4acb, 0x3a29, 0x4a8a, 0x4a8a, 0x4a6a,
-  0x4249, 0x52ca, 0x634c, 0x8c70, 0x9cf2, 0x9cf2, 0xa512, 0xa533,
-  0x9470, 0x9470, 0x840f, 0x738e, 0x5b0c, 0x5b0c, 0x52cb, 0x52ab,
-  0x4a8a, 0x4229, 0x4249, 0x4249, 0x4aaa, 0x632c, 0x632c, 0x73ae,
-  0x8450, 0x8450, 0x8450, 0x7c2f, 0x7bef, 0x7c30, 0x73ef, 0x6bae,
-  0x73ce, 0x7c0f, 0x7c2f, 0x634c, 0x634c, 0x636d, 0x5b2c, 0x52eb,
-  0x4aaa, 0x4a8a, 0x4229, 0x31c7, 0x2966, 0x2966, 0x31a7, 0x31c8,
-  0x39e8, 0x3a08, 0x3a29, 0x428a, 0x4a8a, 0x4acb, 0x4aaa, 0x4aab,
-  0x4acb, 0x4aab, 0x4aaa, 0x4aaa, 0x4a8a, 0x4a8a, 0x428a, 0x428b,
-  0x4a8b, 0x4aab, 0x4aab, 0x428a, 0x4aab, 0x428a, 0x428a, 0x428a,
-  0x3a6a, 0x426a, 0x426a, 0x426a, 0x4249, 0x3a4a, 0x3a29, 0x428a,
-  0x3a29, 0x3a49, 0x426a, 0x426a, 0x3a49, 0x4249, 0x3a08, 0x3a29,
-  0x3a08, 0x3a08, 0x39e8, 0x3a09, 0x31e8, 0x3a29, 0x3a09, 0x31e8,
-  0x31e8, 0x3a09, 0x39e8, 0x3a09, 0x3a09, 0x3a09, 0x3a09, 0x3a29,
-  0x3a29, 0x4249, 0x3a29, 0x3a49, 0x428a, 0x428a, 0x4aab, 0x3229,
-  0x3a09, 0x424a, 0x3a29, 0x3a09, 0x3a29, 0x3a08, 0x39e8, 0x31e8,
-  0x31e8, 0x31e8, 0x31e8, 0x3208, 0x3208, 0x3208, 0x3208, 0x3208,
-  0x3a08, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x3a29,
-  0x3a29, 0x426a, 0x3a29, 0x3a29, 0x3a49, 0x424a, 0x426a, 0x426a,
-  0x426a, 0x3a6a, 0x428a, 0x42ab, 0x428a, 0x42ab, 0x42ab, 0x42ab,
-  0x4acc, 0x42cb, 0x42cb, 0x42eb, 0x42ec, 0x42ec, 0x42ec, 0x4b0c,
-  0x4b0c, 0x4b0d, 0x4b4d, 0x4b4e, 0x4b6e, 0x538e, 0x53af, 0x53cf,
-  0x5bf0, 0x5c31, 0x6471, 0x6cb2, 0x6cf3, 0x7d55, 0x8596, 0x9617,
-  0x9e78, 0xa6b9, 0xb71a, 0xbf7b, 0xcfbb, 0xe7dc, 0xfffe, 0xf7fd,
-  0xeffd, 0xe7fc, 0xdf9b, 0xbf1a, 0xd75b, 0xdf7b, 0x8df7, 0x85f7,
-  0x6d76, 0x6514, 0xa637, 0xc697, 0xc6b8, 0xa5d6, 0x8d34, 0x74d3,
-  0x6472, 0x6c72, 0x6c51, 0xad95, 0xadd5, 0x9533, 0x8cf2, 0x6bf0,
-  0x4b4e, 0x4b2d, 0x4aec, 0x5b6d, 0x63cf, 0x6bf0, 0x6bef, 0x8cb1,
-  0xbdd5, 0x42cb, 0x42cb, 0x4aec, 0x42ab, 0x52ec, 0x6bcf, 0x6bef,
-  0x5b4d, 0x7c2f, 0x8470, 0x7bae, 0x840f, 0x8c70, 0x7c0f, 0x52aa,
-  0x4a8a, 0x52ab, 0x7bef, 0x4aeb, 0x4acb, 0x52ec, 0x426a, 0x4aab,
-  0x4a8a, 0x52cb, 0x7bee, 0x8c91, 0x9cd1, 0xa533, 0xa533, 0x9cf2,
-  0x9cd2, 0x8c70, 0x9471, 0x840f, 0x5aec, 0x5aec, 0x52cb, 0x52cb,
-  0x52cb, 0x52cb, 0x4aaa, 0x4a8a, 0x5b0c, 0x636d, 0x634d, 0x6b8e,
-  0x73ce, 0x7c0f, 0x7c30, 0x73ef, 0x7c0f, 0x73ce, 0x6b8d, 0x73ce,
-  0x73ef, 0x73ef, 0x8450, 0xb5d6, 0x6bae, 0x5b2c, 0x5b0c, 0x52eb,
-  0x4aaa, 0x4a8a, 0x4249, 0x31e7, 0x2986, 0x2966, 0x2987, 0x3a08,
-  0x4249, 0x4269, 0x4aab, 0x4acb, 0x52cb, 0x4aaa, 0x52eb, 0x4aab,
-  0x4aab, 0x4aab, 0x4aaa, 0x4aab, 0x4aab, 0x428a, 0x428a, 0x4aab,
-  0x7410, 0x6bf0, 0x4aab, 0x4aab, 0x426a, 0x3a6a, 0x3a49, 0x428a,
-  0x426a, 0x3a4a, 0x3a49, 0x3a49, 0x3a29, 0x3a29, 0x426a, 0x426a,
-  0x3a29, 0x426a, 0x3a49, 0x4249, 0x3a29, 0x3a49, 0x3a29, 0x3a29,
-  0x3208, 0x3a08, 0x3208, 0x31e8, 0x3a09, 0x3a09, 0x3a09, 0x3a08,
-  0x3a08, 0x31e8, 0x31e8, 0x3a29, 0x39e8, 0x39e8, 0x3a09, 0x3a09,
-  0x3a49, 0x3a29, 0x3a29, 0x3208, 0x3a09, 0x3a29, 0x3a29, 0x3a08,
-  0x3a09, 0x3a09, 0x3a09, 0x3a09, 0x3a09, 0x31e8, 0x31e8, 0x31e8,
-  0x31e8, 0x3208, 0x31e8, 0x31e8, 0x31e8, 0x3a08, 0x3a08, 0x3a08,
-  0x3a08, 0x3a09, 0x3a09, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x3a49, 0x3a29, 0x3a29, 0x3a49, 0x424a, 0x424a, 0x3a49, 0x426a,
-  0x426a, 0x428a, 0x428a, 0x42ab, 0x4aab, 0x42ab, 0x428b, 0x42ab,
-  0x42ab, 0x42cb, 0x42cb, 0x42cb, 0x42cc, 0x42ec, 0x534d, 0x4b2d,
-  0x42ec, 0x4b0c, 0x4b2d, 0x4b4d, 0x4b4e, 0x4b6e, 0x53af, 0x53cf,
-  0x5bf0, 0x5c31, 0x6451, 0x6492, 0x6cf3, 0x7534, 0x8596, 0x8df7,
-  0x9e78, 0xa6b9, 0xb71a, 0xbf7b, 0xcfbb, 0xe7dc, 0xfffe, 0xf7fd,
-  0xeffd, 0xe7dc, 0xdf9c, 0xc71b, 0xcf1a, 0xe79b, 0x9e58, 0x85d7,
-  0x6d76, 0x6535, 0x9df7, 0xbe98, 0xbe97, 0xa5b6, 0x8d34, 0x7d14,
-  0x6cb3, 0x6c72, 0x7492, 0x8cd2, 0x7c91, 0xa594, 0x84b2, 0x7c71,
-  0x5baf, 0x430d, 0x4b0c, 0x534d, 0x63ae, 0x63cf, 0x6c0f, 0x7c2f,
-  0xce77, 0x4aec, 0x638e, 0x6bae, 0x428b, 0x4aec, 0x636e, 0x6bae,
-  0x532d, 0x7c50, 0x8450, 0x94b1, 0x7bce, 0x9cd1, 0x6b6c, 0x52eb,
-  0x5b0c, 0x4a69, 0x634d, 0x532c, 0x5b0c, 0x52cb, 0x5b2c, 0x4a69,
-  0x52ab, 0x6b8e, 0x842f, 0x8c90, 0x9491, 0xa533, 0xad54, 0x9490,
-  0x9491, 0x9cf3, 0xb595, 0xb594, 0x73ae, 0x4a8a, 0x52cb, 0x5b0c,
-  0x5b0c, 0x52cb, 0x52eb, 0x5aec, 0x5b0c, 0x634d, 0x636d, 0x73ce,
-  0x73cf, 0x73ef, 0x73ef, 0x6bae, 0x6bae, 0x6b8e, 0x6b8d, 0x73cf,
-  0x7c10, 0x740f, 0x9cf3, 0xce78, 0x7c30, 0x5b0c, 0x5b0c, 0x52cb,
-  0x4a8a, 0x4269, 0x4269, 0x3a08, 0x31c7, 0x29a7, 0x2986, 0x39e8,
-  0x4a6a, 0x426a, 0x4aaa, 0x4acb, 0x5b2c, 0x5b0c, 0x5b0c, 0x4aaa,
-  0x4acb, 0x4acb, 0x4acb, 0x4acb, 0x4aab, 0x428a, 0x428a, 0x4aec,
-  0x6bf0, 0x4aec, 0x428a, 0x428a, 0x426a, 0x424a, 0x3a4a, 0x426a,
-  0x426a, 0x3a49, 0x428a, 0x426a, 0x3a49, 0x3a29, 0x4249, 0x3a29,
-  0x3a49, 0x3a29, 0x4269, 0x3a29, 0x3a29, 0x3208, 0x3a29, 0x3a29,
-  0x3a29, 0x31e8, 0x31e8, 0x3208, 0x3a09, 0x3a09, 0x31e8, 0x3a09,
-  0x3a29, 0x31e8, 0x3a29, 0x3a29, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a09, 0x31e8, 0x3a08, 0x3208, 0x3a08, 0x3a09, 0x31e8, 0x3a09,
-  0x3a09, 0x31e8, 0x3a08, 0x3a09, 0x31e8, 0x31c8, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x3a08, 0x3a08, 0x3a08,
-  0x3a08, 0x3a08, 0x3a29, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a49,
-  0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x3a49, 0x3a49, 0x3a49, 0x3a6a,
-  0x426a, 0x428a, 0x428a, 0x428a, 0x428a, 0x428a, 0x42ab, 0x42ab,
-  0x42ab, 0x4acc, 0x4acc, 0x42cb, 0x42cb, 0x42ec, 0x4b2d, 0x4b2d,
-  0x42ec, 0x430c, 0x4b2d, 0x4b4d, 0x5bcf, 0x53af, 0x4b8e, 0x53cf,
-  0x53f0, 0x5c10, 0x5c51, 0x6492, 0x6cd3, 0x7534, 0x8575, 0x8df7,
-  0x9e58, 0xa6b9, 0xb71a, 0xbf5b, 0xcfbc, 0xe7dc, 0xf7fe, 0xf7fe,
-  0xeffd, 0xe7dc, 0xdfbb, 0xc71b, 0xcf3b, 0xef9b, 0xae98, 0x85d7,
-  0x7575, 0x6515, 0x95d6, 0xbe98, 0xbe77, 0xb637, 0x8d55, 0x7d14,
-  0x6c92, 0x6c92, 0x74b2, 0x84d3, 0x6c71, 0x9d74, 0x9512, 0xadb5,
-  0x7c30, 0x42ec, 0x534d, 0x5b6d, 0x63ae, 0x63cf, 0x6c0f, 0x740f,
-  0x9d32, 0x4b0c, 0x5b8e, 0x740f, 0x42ab, 0x52ec, 0x5b4d, 0x6bcf,
-  0x5b4d, 0x73ef, 0x840f, 0xa533, 0x7c0f, 0x8c4f, 0x73ae, 0x4a8a,
-  0x5b0c, 0x4a8a, 0x4a69, 0x63ae, 0x52ec, 0x5aeb, 0x6bae, 0x73ef,
-  0x7c0f, 0x94f2, 0x94b1, 0x94b1, 0x94b1, 0x94b1, 0x9cd2, 0x94d1,
-  0x9cf2, 0x94b2, 0x9cf2, 0xad94, 0x94d2, 0x4a6a, 0x4a8a, 0x4aaa,
-  0x530c, 0x52eb, 0x636d, 0x73ae, 0x73ce, 0x6b8e, 0x634c, 0x6b8d,
-  0x6bae, 0x6b8d, 0x634d, 0x6bae, 0x634d, 0x636d, 0x6bce, 0x8471,
-  0x9d54, 0x8491, 0x9d54, 0x8471, 0x634d, 0x5b2c, 0x5b0c, 0x52cb,
-  0x4a8a, 0x4a8a, 0x4269, 0x3a28, 0x39e8, 0x31e7, 0x31c7, 0x39e8,
-  0x4249, 0x426a, 0x428a, 0x4aeb, 0x530c, 0x530c, 0x5b0c, 0x52eb,
-  0x52eb, 0x532c, 0x530c, 0x4acb, 0x4acb, 0x52eb, 0x4a8a, 0x428a,
-  0x3a49, 0x428a, 0x42ab, 0x426a, 0x426a, 0x426a, 0x426a, 0x3a49,
-  0x3a4a, 0x3a49, 0x426a, 0x3a49, 0x426a, 0x3a49, 0x3a29, 0x4249,
-  0x4249, 0x3a29, 0x3a08, 0x3208, 0x3a29, 0x3a09, 0x3a29, 0x3a29,
-  0x4229, 0x31e8, 0x31e8, 0x3a09, 0x31e8, 0x31e8, 0x3a08, 0x31e8,
-  0x3a08, 0x31e8, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x39e8,
-  0x31e8, 0x3a09, 0x31c8, 0x31e8, 0x39e8, 0x31e8, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31c8, 0x39e8, 0x31c8, 0x39e8,
-  0x31e8, 0x31e8, 0x31e8, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a09, 0x3a29, 0x3a28, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x4249,
-  0x3a29, 0x3a49, 0x3a49, 0x3a49, 0x3a49, 0x3a29, 0x3a49, 0x3a49,
-  0x3a49, 0x3a6a, 0x428a, 0x428a, 0x42ab, 0x4acb, 0x42ab, 0x42ab,
-  0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42cc, 0x42ec, 0x42ec,
-  0x430c, 0x4b0d, 0x4b2d, 0x4b2d, 0x5bcf, 0x5bcf, 0x4b8e, 0x53cf,
-  0x53f0, 0x5c10, 0x5c31, 0x6472, 0x6cd3, 0x7514, 0x7d75, 0x8df7,
-  0x9e58, 0xa6b9, 0xb6fa, 0xbf5b, 0xcfbc, 0xdfdc, 0xf7de, 0xfffe,
-  0xeffd, 0xe7dc, 0xdfbc, 0xcf3b, 0xcf3b, 0xefbc, 0xb6b9, 0x85f7,
-  0x7596, 0x6d35, 0x8db6, 0xb657, 0xb657, 0xbe77, 0x9575, 0x8514,
-  0x6cb2, 0x6c92, 0x7492, 0x84b2, 0x7492, 0x8d12, 0xa594, 0xa574,
-  0x7c51, 0x4aed, 0x63af, 0x6bf0, 0x5b8e, 0x63cf, 0x7430, 0x6bef,
-  0x7c30, 0x638e, 0x5b8d, 0x740f, 0x4aec, 0x5b2d, 0x5b2d, 0x6bcf,
-  0x638e, 0x6bcf, 0x8c70, 0x83ef, 0x6bae, 0x73ce, 0x5b0c, 0x4aab,
-  0x5b0c, 0x632c, 0x52cb, 0x638e, 0x5b2c, 0x4aaa, 0x94b2, 0xbe17,
-  0xb5b6, 0xb5d6, 0xad95, 0x94d2, 0x840f, 0x9cf2, 0xd6b9, 0xd6b9,
-  0x8c71, 0x73ae, 0x73ae, 0x632c, 0x6b8d, 0x52aa, 0x4aaa, 0x4aaa,
-  0x5b2c, 0x634d, 0x6bae, 0x6bae, 0x73ef, 0x8451, 0x8c91, 0x8450,
-  0x636d, 0x636d, 0x634c, 0x5b2c, 0x5b2c, 0x634d, 0x6bad, 0x6bef,
-  0x8491, 0x8cb2, 0x7430, 0x636d, 0x634d, 0x5b2d, 0x5b0c, 0x52aa,
-  0x52aa, 0x4a8a, 0x4a69, 0x4229, 0x4228, 0x3a08, 0x3a08, 0x4229,
-  0x4269, 0x426a, 0x4acb, 0x5b6d, 0x8d35, 0x8d34, 0x5b2d, 0x5b0c,
-  0x52ec, 0x4acb, 0x4acb, 0x4acb, 0x4aaa, 0x4aaa, 0x4a8a, 0x426a,
-  0x4aaa, 0x426a, 0x4aab, 0x428a, 0x3a49, 0x3a49, 0x3a49, 0x426a,
-  0x426a, 0x3a49, 0x3a49, 0x3a29, 0x3a29, 0x3a49, 0x4249, 0x426a,
-  0x31e8, 0x3a08, 0x3a08, 0x3a08, 0x31e8, 0x3208, 0x3208, 0x3208,
-  0x31e8, 0x3a09, 0x3a08, 0x31e8, 0x31e8, 0x31e8, 0x39e8, 0x31c8,
-  0x3a09, 0x31e8, 0x3a08, 0x39e8, 0x3a08, 0x31e8, 0x3a08, 0x39e8,
-  0x31e8, 0x31e8, 0x31c8, 0x31c8, 0x39e8, 0x39e8, 0x31c8, 0x31e8,
-  0x31c8, 0x31e8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x39e8,
-  0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x3a09, 0x3a08, 0x3a09,
-  0x3a29, 0x4249, 0x3a29, 0x3a29, 0x3a49, 0x3a29, 0x426a, 0x426a,
-  0x424a, 0x4249, 0x3a49, 0x424a, 0x424a, 0x3a29, 0x4249, 0x426a,
-  0x426a, 0x426a, 0x428a, 0x426a, 0x428a, 0x428a, 0x428a, 0x428a,
-  0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42cb, 0x42ec,
-  0x4b4d, 0x430c, 0x4b0d, 0x4b2d, 0x4b4d, 0x4b6e, 0x538e, 0x53af,
-  0x53f0, 0x5c10, 0x5c31, 0x6472, 0x6cd3, 0x7514, 0x7d75, 0x8dd6,
-  0x9658, 0xa6b9, 0xb6fa, 0xbf5b, 0xcf9b, 0xdfdc, 0xf7fe, 0xfffe,
-  0xeffd, 0xe7dc, 0xe7bc, 0xcf5b, 0xc6fa, 0xe79c, 0xbeda, 0x8e17,
-  0x7db6, 0x6d35, 0x8596, 0xa637, 0xa5f6, 0xbe57, 0x9db5, 0x9555,
-  0x7cf3, 0x6c92, 0x6c72, 0x8cf3, 0x74b2, 0x9513, 0xad94, 0x8471,
-  0x5b8e, 0x4b2d, 0x5b6e, 0x63cf, 0x5b8e, 0x5bae, 0x7430, 0x740f,
-  0x7c30, 0x7c0f, 0x5b6d, 0x6bce, 0x530d, 0x638e, 0x638e, 0x5b2d,
-  0x5b6d, 0x73ef, 0x94b1, 0x94d2, 0x5b2c, 0x6b8e, 0x5b2c, 0x52eb,
-  0x5b0c, 0x738e, 0x52ab, 0x740f, 0x4a8a, 0x52cb, 0x94f3, 0xad95,
-  0xc658, 0xb5d6, 0xbe17, 0x8cb1, 0x73ce, 0x8c91, 0xc657, 0x94b1,
-  0x4a8a, 0x52eb, 0x634c, 0x632c, 0x632c, 0x636d, 0x634d, 0x5b0c,
-  0x636d, 0x6bae, 0x6b8d, 0x6b8e, 0x73cf, 0x8c71, 0xbe17, 0x73ae,
-  0x636d, 0x632c, 0x632c, 0x5aeb, 0x5aeb, 0x5b4c, 0x638d, 0x6bce,
-  0x84b2, 0xa596, 0x9514, 0x6bcf, 0x634d, 0x5b2d, 0x52eb, 0x52aa,
-  0x4a8a, 0x4a8a, 0x4a8a, 0x4a69, 0x4a69, 0x4249, 0x4229, 0x4269,
-  0x4a8a, 0x4aab, 0x52ec, 0x6c10, 0xe7be, 0x8cf4, 0x4acc, 0x52cb,
-  0x4acb, 0x52ec, 0x4acb, 0x4acb, 0x4acb, 0x426a, 0x4a8a, 0x4a8a,
-  0x4a8a, 0x426a, 0x426a, 0x3a29, 0x4249, 0x4249, 0x4a8a, 0x3a29,
-  0x3a29, 0x424a, 0x424a, 0x4269, 0x3a49, 0x4249, 0x4aab, 0x3a08,
-  0x3a29, 0x3a09, 0x3a08, 0x3a08, 0x3a29, 0x3a29, 0x3208, 0x3a29,
-  0x31e8, 0x3a08, 0x3a09, 0x31e8, 0x31e8, 0x39e8, 0x3a08, 0x31c8,
-  0x3a08, 0x31e8, 0x3a09, 0x3a09, 0x31c8, 0x31c8, 0x31c8, 0x31c7,
-  0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31a8, 0x31a8, 0x31c8, 0x31c8,
-  0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c7, 0x31c7, 0x31c8, 0x31c8,
-  0x31c8, 0x31c8, 0x31e8, 0x31e8, 0x31e8, 0x3a29, 0x3a29, 0x4249,
-  0x4249, 0x426a, 0x3a49, 0x3a29, 0x4249, 0x3a29, 0x3a49, 0x426a,
-  0x426a, 0x426a, 0x424a, 0x3a29, 0x3a49, 0x4249, 0x4249, 0x3a29,
-  0x3a49, 0x3a6a, 0x428a, 0x426a, 0x426a, 0x428a, 0x428a, 0x428a,
-  0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42cb, 0x4aec, 0x42ec,
-  0x42ec, 0x42ec, 0x4b0d, 0x4b2d, 0x4b4d, 0x4b6e, 0x53af, 0x53cf,
-  0x5bf0, 0x5c10, 0x6451, 0x6471, 0x6cb2, 0x7514, 0x7d75, 0x8dd6,
-  0x9637, 0xa699, 0xb6fa, 0xbf5b, 0xcf9b, 0xdfdc, 0xf7fe, 0xfffe,
-  0xf7fd, 0xe7dc, 0xdfbc, 0xcf5b, 0xbeda, 0xdf7b, 0xc6fa, 0x9637,
-  0x85b6, 0x6d35, 0x7d75, 0x95b6, 0x9dd6, 0xae16, 0xae16, 0x9d95,
-  0x8514, 0x6c71, 0x6c71, 0x8cf3, 0x74b2, 0x9d53, 0xad94, 0x8cd2,
-  0x5b8e, 0x534e, 0x5b6e, 0x5b6e, 0x5b6e, 0x638e, 0x7c71, 0x7c50,
-  0x7c30, 0x8c91, 0x5b4d, 0x6bae, 0x5b6d, 0x8491, 0x6bae, 0x532d,
-  0x5b6d, 0x6bae, 0x9cf2, 0x94d1, 0x5b0c, 0x6b8e, 0x73cf, 0x4acb,
-  0x52ec, 0x6b8d, 0x52aa, 0x6bce, 0x634c, 0x6bae, 0x8450, 0xa574,
-  0xb5b5, 0xb5f6, 0xa554, 0x73ee, 0x6bae, 0x8450, 0x94d2, 0x73ee,
-  0x4269, 0x4269, 0x4aaa, 0x5b2c, 0x73cf, 0x8c91, 0x7c10, 0x7c30,
-  0x73ef, 0x73ce, 0x6bae, 0x6b8d, 0x632c, 0x73ce, 0x6b6d, 0x6b8d,
-  0x632c, 0x5aeb, 0x52eb, 0x5aeb, 0x52eb, 0x5b2c, 0x636d, 0x6bae,
-  0x73ef, 0x8cd2, 0x7c51, 0x636d, 0x636d, 0x530c, 0x5b0c, 0x5aeb,
-  0x52cb, 0x4aaa, 0x52cb, 0x52cb, 0x4a69, 0x4249, 0x4269, 0x4269,
-  0x52eb, 0x4a8a, 0x4a8a, 0x530c, 0x63cf, 0x4aec, 0x4aab, 0x4acb,
-  0x52cb, 0x4acb, 0x4aab, 0x4acb, 0x4aaa, 0x4a8a, 0x4a8a, 0x4aab,
-  0x428a, 0x4aab, 0x426a, 0x426a, 0x4a8a, 0x4249, 0x4269, 0x3a29,
-  0x3a09, 0x3a29, 0x3a49, 0x3a29, 0x3a29, 0x4249, 0x426a, 0x3a08,
-  0x4249, 0x3a08, 0x3a08, 0x31e8, 0x39e8, 0x3a29, 0x3208, 0x31e8,
-  0x31c7, 0x31e8, 0x3a08, 0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8,
-  0x31c8, 0x31e8, 0x31c8, 0x31e8, 0x31c8, 0x31c7, 0x31c8, 0x31c8,
-  0x31e8, 0x39e8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8, 0x31c8,
-  0x31c8, 0x31c8, 0x39e8, 0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x31c7,
-  0x31c7, 0x31c8, 0x31e8, 0x31e8, 0x3a08, 0x3a08, 0x3a08, 0x3a29,
-  0x4249, 0x4aab, 0x3a29, 0x3a29, 0x4249, 0x424a, 0x426a, 0x424a,
-  0x426a, 0x424a, 0x426a, 0x3a49, 0x4249, 0x426a, 0x3a49, 0x3a49,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x3a6a, 0x428a, 0x42ab, 0x428a,
-  0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x4aec, 0x42cb, 0x42cb,
-  0x42ec, 0x42ec, 0x4b0d, 0x4b2d, 0x4b4d, 0x4b6e, 0x53af, 0x53cf,
-  0x5bf0, 0x5c31, 0x6451, 0x6472, 0x6cb2, 0x74f4, 0x7d55, 0x8dd6,
-  0x9637, 0xa699, 0xb6fa, 0xbf3a, 0xc79b, 0xdfdc, 0xeffd, 0xfffe,
-  0xf7fd, 0xeffc, 0xe7bc, 0xd77c, 0xbefa, 0xdf7b, 0xd73b, 0x9e37,
-  0x85b6, 0x6d55, 0x7d75, 0x7d55, 0x95d6, 0x9df6, 0xb636, 0x9d95,
-  0x9534, 0x74b3, 0x7492, 0x84d2, 0x6c30, 0x9d53, 0xb5f6, 0xc677,
-  0x63ae, 0x4b4d, 0x536e, 0x6bcf, 0x638e, 0x6baf, 0x7c50, 0x8491,
-  0x73ef, 0x8cb1, 0x530c, 0x5b4d, 0x638e, 0x8471, 0x636d, 0x5b6d,
-  0x636e, 0x636d, 0x8c50, 0x842f, 0x5b2c, 0x638d, 0x636d, 0x4aab,
-  0x52ec, 0x6b6d, 0x6b6d, 0x638d, 0x73ae, 0x6b8d, 0x73ce, 0xa533,
-  0x9d13, 0xa554, 0x8c92, 0x6b8e, 0x6bae, 0x6bae, 0x7c0f, 0x94b2,
-  0x6b8d, 0x5b2c, 0x632d, 0x6bae, 0x8471, 0x8451, 0x6bae, 0x6b6d,
-  0x5aeb, 0x52eb, 0x632c, 0x636d, 0x6b8d, 0x5b0b, 0x632c, 0x634c,
-  0x5b2c, 0x5aeb, 0x52cb, 0x5aec, 0x52eb, 0x5b0c, 0x5b4d, 0x638e,
-  0x6bef, 0x7430, 0x6bcf, 0x638e, 0x6baf, 0x6b8e, 0x5b2c, 0x5aec,
-  0x5b0c, 0x52eb, 0x52cb, 0x52cb, 0x52cb, 0x4a8a, 0x4a8a, 0x428a,
-  0x4269, 0x426a, 0x4aaa, 0x4a8a, 0x428a, 0x52cb, 0x52ec, 0x52cb,
-  0x4a8a, 0x52ec, 0x52ec, 0x4aaa, 0x4a8a, 0x4aab, 0x428a, 0x428a,
-  0x4a8a, 0x4a8a, 0x428a, 0x428a, 0x3a49, 0x3a49, 0x4249, 0x4249,
-  0x3a29, 0x4249, 0x3a29, 0x4249, 0x3a29, 0x3a29, 0x3a29, 0x3a08,
-  0x3a09, 0x3a09, 0x31e8, 0x3a08, 0x3a08, 0x31e8, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x31e8, 0x31c8, 0x31c7, 0x31e8, 0x31c8, 0x31c8,
-  0x31c7, 0x31e8, 0x31c8, 0x31c8, 0x31a7, 0x31c7, 0x31c7, 0x31c8,
-  0x31e8, 0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x31c8, 0x31a7, 0x39c8,
-  0x39c8, 0x31c7, 0x31c7, 0x31a7, 0x31a7, 0x31c7, 0x31a7, 0x31c7,
-  0x31e8, 0x31c8, 0x31c8, 0x39e8, 0x3a08, 0x3a29, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a49, 0x3a29, 0x3a49, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x3a4a, 0x426a, 0x4249, 0x3a49, 0x4249, 0x3a49, 0x426a,
-  0x3a4a, 0x426a, 0x426a, 0x3a6a, 0x428a, 0x428a, 0x428a, 0x428a,
-  0x428a, 0x3a8a, 0x428a, 0x42ab, 0x42ab, 0x42ab, 0x42cb, 0x42cc,
-  0x42ec, 0x4b0c, 0x42ec, 0x4b2d, 0x4b4d, 0x4b6e, 0x538e, 0x53af,
-  0x5bf0, 0x5c10, 0x5c31, 0x6492, 0x6cb3, 0x6cf3, 0x7d55, 0x85b6,
-  0x9617, 0xa679, 0xaefa, 0xbf3a, 0xc79b, 0xd7dc, 0xeffd, 0xfffe,
-  0xf7fd, 0xeffd, 0xe7dc, 0xd77c, 0xbeda, 0xd75b, 0xe79b, 0xa678,
-  0x8dd6, 0x7555, 0x7d76, 0x7d55, 0x9dd6, 0x9dd6, 0xb636, 0xa5b5,
-  0x9d75, 0x7cd3, 0x6c92, 0x7471, 0x84b2, 0x8492, 0xbe57, 0xdf3a,
-  0x63ce, 0x536d, 0x536e, 0x7c30, 0x7c30, 0x8cb2, 0x7c0f, 0x8470,
-  0x740f, 0x9d33, 0x4aec, 0x530d, 0x63cf, 0x8451, 0x6bae, 0x5b4d,
-  0x5b6e, 0x5b6d, 0x7bef, 0x7bef, 0x5b0d, 0x6bae, 0x636d, 0x530c,
-  0x5b0c, 0x73ae, 0x6b8d, 0x636d, 0x73ce, 0x738d, 0x94b2, 0xbdf6,
-  0x8c50, 0x7bef, 0x6b8e, 0x6bae, 0x73ef, 0x6bae, 0x6bae, 0x6bcf,
-  0x73cf, 0x8471, 0x9d13, 0xa554, 0x73ef, 0x6b6d, 0x5aeb, 0x52cb,
-  0x52aa, 0x5aeb, 0x634c, 0x6b6d, 0x634d, 0x6b6d, 0x634c, 0x5b0b,
-  0x52cb, 0x52ab, 0x52ab, 0x52cb, 0x52cb, 0x52cb, 0x530c, 0x5b4d,
-  0x638e, 0x636d, 0x73ef, 0x6b8e, 0x636d, 0x5b2d, 0x5b2d, 0x5b0c,
-  0x52cb, 0x52ec, 0x5b0c, 0x4a8a, 0x52cb, 0x426a, 0x4249, 0x4269,
-  0x4249, 0x426a, 0x426a, 0x426a, 0x4a8a, 0x4acb, 0x4aab, 0x4aab,
-  0x4aab, 0x4aab, 0x4aab, 0x4aab, 0x4aab, 0x4aaa, 0x4aab, 0x4aab,
-  0x52cb, 0x426a, 0x4a8a, 0x426a, 0x428a, 0x4249, 0x4249, 0x3a29,
-  0x3a29, 0x3a29, 0x4249, 0x3a29, 0x3a29, 0x3a29, 0x3a09, 0x3a08,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x31e7, 0x3a08, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x31e8, 0x39e8, 0x31e8, 0x31c8,
-  0x31c8, 0x31c7, 0x31c7, 0x31c7, 0x31a7, 0x31c7, 0x31c8, 0x31e8,
-  0x31e8, 0x31c7, 0x31c8, 0x31a7, 0x31c8, 0x31c8, 0x31c7, 0x31a7,
-  0x31a7, 0x31a7, 0x31c7, 0x39e8, 0x31a7, 0x31a7, 0x31a7, 0x31c7,
-  0x31e8, 0x31c8, 0x31c8, 0x39e8, 0x31e8, 0x3a08, 0x3a08, 0x3a29,
-  0x4249, 0x3a08, 0x3a49, 0x4249, 0x4249, 0x426a, 0x426a, 0x4249,
-  0x426a, 0x426a, 0x3a4a, 0x4249, 0x4269, 0x426a, 0x3a4a, 0x3a49,
-  0x3a4a, 0x426a, 0x426a, 0x426a, 0x426a, 0x428a, 0x428a, 0x426a,
-  0x428a, 0x428a, 0x428a, 0x428b, 0x42ab, 0x42ab, 0x42cc, 0x4aec,
-  0x4b0c, 0x4b0c, 0x4b0c, 0x4b2d, 0x4b4d, 0x4b6e, 0x4b8e, 0x53af,
-  0x53ef, 0x5c10, 0x5c51, 0x6492, 0x6cb2, 0x6cf3, 0x7d55, 0x85b6,
-  0x9617, 0x9e79, 0xaed9, 0xb73a, 0xc77b, 0xd7bc, 0xe7fd, 0xf7fe,
-  0xf7fe, 0xeffd, 0xe7dc, 0xd75b, 0xc71b, 0xc71a, 0xe7bc, 0xb698,
-  0x95f7, 0x7555, 0x7555, 0x7d55, 0x9dd6, 0x95b6, 0xae36, 0xadf6,
-  0x9d75, 0x7cd3, 0x6c71, 0x84d2, 0x84d3, 0x84b2, 0xc677, 0xd6d8,
-  0x7c51, 0x5b8e, 0x534d, 0x7c10, 0xb5b5, 0xb5b4, 0x94d1, 0x7430,
-  0x6bef, 0x8cd2, 0x530d, 0x4b0d, 0x5b8e, 0x740f, 0x636d, 0x8430,
-  0x5b4d, 0x5b4d, 0x6bae, 0x6b6e, 0x530c, 0x6bae, 0x638d, 0x6baf,
-  0x52eb, 0x6bae, 0x6b6c, 0x740f, 0x7bee, 0x94b2, 0x94d2, 0x9d13,
-  0xad54, 0x8c71, 0x6b8e, 0x6bae, 0x6bae, 0x6b8e, 0x638e, 0x6b8e,
-  0x8cb2, 0x8c92, 0x8450, 0x73ce, 0x632c, 0x5b0c, 0x52cb, 0x5aeb,
-  0x52cb, 0x632c, 0x6b6d, 0x632c, 0x5b2c, 0x632c, 0x632c, 0x5b0b,
-  0x4a8a, 0x4aab, 0x4aab, 0x4aab, 0x5b0c, 0x52eb, 0x5b2c, 0x530c,
-  0x530c, 0x5b2c, 0x5b2c, 0x5b4d, 0x634d, 0x636e, 0x6bae, 0x52eb,
-  0x6bae, 0x6b6e, 0x5aec, 0x4a6a, 0x4a8a, 0x426a, 0x426a, 0x426a,
-  0x4249, 0x426a, 0x4249, 0x4249, 0x4a8a, 0x4a8a, 0x4aab, 0x4aab,
-  0x52eb, 0x4acb, 0x4aab, 0x52cb, 0x4a8a, 0x426a, 0x4aaa, 0x426a,
-  0x4269, 0x426a, 0x4aaa, 0x428a, 0x4269, 0x426a, 0x3a29, 0x4249,
-  0x3a09, 0x3a08, 0x3a29, 0x3a29, 0x3a29, 0x4249, 0x3a08, 0x4229,
-  0x3a08, 0x3a29, 0x3a08, 0x3a08, 0x31e8, 0x39e8, 0x31e8, 0x31e8,
-  0x31e8, 0x31e8, 0x31c8, 0x31c7, 0x31c8, 0x31c8, 0x31e8, 0x31c8,
-  0x31e8, 0x31c7, 0x31c7, 0x31c8, 0x31a7, 0x31c8, 0x31c8, 0x31c8,
-  0x31c7, 0x31c7, 0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x39e8, 0x31c7,
-  0x31a7, 0x31c7, 0x31a7, 0x31c8, 0x31a7, 0x31a7, 0x31a7, 0x31c7,
-  0x31c7, 0x31c8, 0x31c8, 0x3a08, 0x31e8, 0x31e8, 0x3a29, 0x3a09,
-  0x3a09, 0x3a09, 0x3a29, 0x3a49, 0x3a29, 0x3a49, 0x426a, 0x4aab,
-  0x424a, 0x426a, 0x426a, 0x426a, 0x426a, 0x4249, 0x428a, 0x428a,
-  0x3a49, 0x3a49, 0x3a49, 0x426a, 0x426a, 0x428a, 0x428a, 0x428a,
-  0x428a, 0x428a, 0x428a, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42cb,
-  0x4aec, 0x42ec, 0x4b0d, 0x4b2d, 0x4b4d, 0x4b6e, 0x4b6e, 0x53ae,
-  0x53cf, 0x5c10, 0x6451, 0x6472, 0x6cb2, 0x6cf3, 0x7554, 0x8596,
-  0x95f7, 0x9e58, 0xaed9, 0xb71a, 0xc77b, 0xd7bc, 0xe7dc, 0xf7fe,
-  0xf7fe, 0xeffd, 0xe7dc, 0xd77c, 0xc71b, 0xbeda, 0xe7bc, 0xb699,
-  0x9e37, 0x7555, 0x7d55, 0x7d55, 0x9596, 0x95b6, 0xa5f6, 0xb636,
-  0xa594, 0x7c92, 0x7492, 0x9534, 0x7cb2, 0x84b3, 0xce77, 0xd6d8,
-  0x8cd2, 0x63af, 0x6bcf, 0x7c0f, 0xce36, 0xd656, 0xb5b5, 0x6bae,
-  0x532d, 0x638e, 0x532d, 0x4b0c, 0x532c, 0x5b8d, 0x73ef, 0xc636,
-  0x530c, 0x530d, 0x638e, 0x6bae, 0x5b2d, 0x6bae, 0x636e, 0x52ec,
-  0x52ec, 0x5b0c, 0x7bae, 0x740f, 0x6b6c, 0x842f, 0x94d2, 0x9d13,
-  0xad94, 0xa533, 0x8471, 0x636e, 0x634d, 0x634d, 0x634d, 0x6bae,
-  0x6bae, 0x6bae, 0x6bae, 0x636d, 0x632c, 0x5b0c, 0x5aeb, 0x630c,
-  0x5aeb, 0x632c, 0x634d, 0x634c, 0x5b0b, 0x5aeb, 0x52ca, 0x52cb,
-  0x52ab, 0x4aab, 0x4aab, 0x4aab, 0x52ab, 0x5aeb, 0x52cb, 0x4aaa,
-  0x4a8a, 0x4aab, 0x4aaa, 0x4acb, 0x52cb, 0x52cb, 0x52eb, 0x5b0c,
-  0x4aab, 0x52eb, 0x52cb, 0x4aab, 0x4a8a, 0x4a6a, 0x4a6a, 0x426a,
-  0x426a, 0x426a, 0x4249, 0x4249, 0x426a, 0x426a, 0x4aab, 0x4a8a,
-  0x4a8a, 0x4acb, 0x4aab, 0x4aab, 0x4a8a, 0x426a, 0x4a8a, 0x428a,
-  0x426a, 0x426a, 0x4aab, 0x4aaa, 0x4aab, 0x4249, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a09, 0x4249, 0x4249, 0x4249, 0x4249, 0x4229,
-  0x3a08, 0x3a09, 0x31c8, 0x39e8, 0x39e8, 0x3a08, 0x31e8, 0x31e8,
-  0x31e8, 0x31c8, 0x31c8, 0x31c8, 0x31e8, 0x31c7, 0x31c7, 0x31c8,
-  0x31c7, 0x31c8, 0x31c7, 0x31a7, 0x31c7, 0x31c7, 0x31c7, 0x31c7,
-  0x39e8, 0x31c8, 0x31a7, 0x39e8, 0x31c7, 0x31c7, 0x31c8, 0x31c8,
-  0x31c8, 0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x39e8, 0x39e8, 0x3a09, 0x39e8, 0x31e8, 0x3a08, 0x3a09,
-  0x3a08, 0x3a29, 0x3a29, 0x424a, 0x3a49, 0x4249, 0x426a, 0x424a,
-  0x424a, 0x428a, 0x426a, 0x426a, 0x424a, 0x426a, 0x426a, 0x3a6a,
-  0x3a49, 0x4249, 0x426a, 0x426a, 0x426a, 0x3a6a, 0x3a6a, 0x428a,
-  0x428a, 0x428a, 0x428a, 0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42cb,
-  0x42cc, 0x4aec, 0x4b0d, 0x4b4d, 0x4b6e, 0x4b4e, 0x4b6e, 0x53af,
-  0x53cf, 0x5c10, 0x6451, 0x6c92, 0x6cb2, 0x6cf3, 0x7554, 0x8596,
-  0x95f7, 0x9e58, 0xa6b9, 0xb71a, 0xc75b, 0xcf9c, 0xdfdc, 0xf7fe,
-  0xf7fe, 0xefdd, 0xe7dc, 0xd77c, 0xbefb, 0xb6ba, 0xdf7c, 0xc6fa,
-  0xae58, 0x7d75, 0x8576, 0x8555, 0x8555, 0x95b6, 0x9dd6, 0xbe36,
-  0xadb5, 0x7c92, 0x7c92, 0x8cf3, 0x7cb2, 0x7c51, 0xce57, 0xdef9,
-  0x8471, 0x7c30, 0x7410, 0x94b1, 0xd677, 0xd697, 0xbdb5, 0x8430,
-  0x530c, 0x5b2d, 0x532d, 0x4b0c, 0x532c, 0x534d, 0x7430, 0xa553,
-  0x4aac, 0x530c, 0x636d, 0x63ae, 0x530c, 0x7c10, 0x636d, 0x4acc,
-  0x52ec, 0x52ec, 0x6b4d, 0x740e, 0x6b8d, 0x8c91, 0x7c0f, 0x8c91,
-  0x8c91, 0x9cf2, 0x9d54, 0x73ef, 0x634d, 0x632d, 0x5b2c, 0x5b2c,
-  0x5b2c, 0x5b4d, 0x634c, 0x6b6d, 0x632c, 0x634d, 0x630c, 0x5b0c,
-  0x5aeb, 0x5aeb, 0x6b4d, 0x634d, 0x52cb, 0x52cb, 0x52ab, 0x4a8a,
-  0x4a8a, 0x4aab, 0x4aab, 0x4aaa, 0x5aeb, 0x630b, 0x5aeb, 0x4a8a,
-  0x4269, 0x4a6a, 0x4a6a, 0x4a6a, 0x4249, 0x4249, 0x4249, 0x4aab,
-  0x4249, 0x52cb, 0x52ab, 0x4a6a, 0x426a, 0x4a6a, 0x4a6a, 0x426a,
-  0x426a, 0x4249, 0x426a, 0x4249, 0x3a29, 0x426a, 0x4a8a, 0x4aaa,
-  0x4aab, 0x4acb, 0x426a, 0x4a8a, 0x4a6a, 0x4a8a, 0x426a, 0x426a,
-  0x426a, 0x426a, 0x4249, 0x4a8a, 0x4a8a, 0x4249, 0x4249, 0x3a09,
-  0x3a09, 0x3a09, 0x3a09, 0x3a09, 0x3a29, 0x4229, 0x4249, 0x39e8,
-  0x3a08, 0x3a08, 0x31e8, 0x39e8, 0x31e8, 0x39e8, 0x39e8, 0x31c8,
-  0x31c7, 0x3a08, 0x31e8, 0x31c8, 0x31c8, 0x31a7, 0x31e8, 0x31c7,
-  0x31a7, 0x31c8, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31c8, 0x31c7,
-  0x31c7, 0x31c8, 0x39e8, 0x39c8, 0x31c8, 0x39c8, 0x39c8, 0x39c8,
-  0x31a7, 0x4a6a, 0x4a8b, 0x31a7, 0x31a7, 0x39e8, 0x31c8, 0x31a7,
-  0x31c7, 0x39e8, 0x39e8, 0x3a08, 0x31e8, 0x3a08, 0x3a29, 0x3a08,
-  0x3a09, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x3a49, 0x3a49,
-  0x426a, 0x428a, 0x428a, 0x426a, 0x426a, 0x426a, 0x426a, 0x426a,
-  0x424a, 0x426a, 0x426a, 0x426a, 0x426a, 0x428a, 0x428a, 0x426a,
-  0x426a, 0x426a, 0x428a, 0x428b, 0x428b, 0x42ab, 0x42ab, 0x42cb,
-  0x42cc, 0x42ec, 0x4b0d, 0x4b2d, 0x4b4d, 0x4b4e, 0x4b6e, 0x538e,
-  0x53cf, 0x5c10, 0x6451, 0x6c92, 0x6cb2, 0x74f3, 0x7d54, 0x8596,
-  0x8df7, 0x9e58, 0xa699, 0xb719, 0xbf5b, 0xcf9b, 0xdfdc, 0xf7fe,
-  0xfffe, 0xeffd, 0xe7dd, 0xdf9c, 0xc71a, 0xbeda, 0xd73b, 0xcf1a,
-  0xae78, 0x85b6, 0x8596, 0x8576, 0x8554, 0x8d75, 0x8d95, 0xb637,
-  0xb5d5, 0x84f3, 0x7492, 0x7c91, 0x7491, 0x7c72, 0xce77, 0xce77,
-  0x8491, 0x7c50, 0x94b2, 0xa553, 0xd677, 0xdeb7, 0xce36, 0xad54,
-  0x636d, 0x5b2d, 0x4aec, 0x5b6d, 0x5b4d, 0x4b0c, 0x5b6d, 0x740f,
-  0x4aac, 0x4aec, 0x636d, 0x638e, 0x530c, 0x73ef, 0x5b2d, 0x4acb,
-  0x5b0d, 0x5b0c, 0x52cb, 0x638d, 0x6b8d, 0x632c, 0x6b6d, 0x6b8d,
-  0x73ce, 0x94b1, 0x94d2, 0x73ef, 0x636e, 0x634d, 0x5b2d, 0x5b2c,
-  0x5b0c, 0x52eb, 0x5b2c, 0x632c, 0x5aeb, 0x5aeb, 0x630c, 0x630c,
-  0x632c, 0x5b0c, 0x634d, 0x5aeb, 0x5aeb, 0x5b2c, 0x4aaa, 0x4a8a,
-  0x4a6a, 0x4a8a, 0x4a8a, 0x4aab, 0x8c71, 0x8c90, 0x52aa, 0x4a8a,
-  0x4249, 0x4249, 0x4249, 0x4a6a, 0x4229, 0x4229, 0x4229, 0x4229,
-  0x4249, 0x4a8a, 0x4a6a, 0x4249, 0x426a, 0x4249, 0x426a, 0x4249,
-  0x426a, 0x424a, 0x4229, 0x424a, 0x426a, 0x4a8a, 0x52cb, 0x426a,
-  0x426a, 0x4aab, 0x426a, 0x4a8a, 0x426a, 0x4a8a, 0x4249, 0x4a8a,
-  0x4249, 0x4a8a, 0x4269, 0x4249, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3a08, 0x4229, 0x3a08, 0x3a09, 0x39e8, 0x3a08,
-  0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x31c8,
-  0x31c8, 0x31c8, 0x31e8, 0x31c7, 0x31c7, 0x31a7, 0x31c8, 0x31c7,
-  0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31c8, 0x31a7, 0x31c7, 0x31c7,
-  0x31c8, 0x31c7, 0x39e8, 0x31c7, 0x31a7, 0x31a7, 0x39e8, 0x31c7,
-  0x31c7, 0x39e8, 0x39c8, 0x31c7, 0x31c7, 0x31a7, 0x31c7, 0x31c7,
-  0x31c8, 0x39e8, 0x39e8, 0x39e8, 0x31e8, 0x39e8, 0x3a08, 0x3a08,
-  0x3a09, 0x3a09, 0x4229, 0x3a29, 0x4249, 0x3a49, 0x4249, 0x4249,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x426a, 0x426a, 0x4269, 0x426a,
-  0x426a, 0x428a, 0x426a, 0x426a, 0x426a, 0x426a, 0x428a, 0x3a49,
-  0x3a6a, 0x428a, 0x428a, 0x42ab, 0x426a, 0x3a8a, 0x42ab, 0x3a8b,
-  0x42ab, 0x42cb, 0x42ec, 0x4b2d, 0x4b2d, 0x4b6e, 0x4b8e, 0x53af,
-  0x53cf, 0x5bf0, 0x5c31, 0x6472, 0x6cd3, 0x6cf3, 0x7534, 0x8595,
-  0x8df7, 0x9638, 0xa699, 0xaef9, 0xbf5a, 0xcf9b, 0xdfdc, 0xf7fe,
-  0xfffe, 0xefdd, 0xe7bc, 0xe79c, 0xc71a, 0xc71b, 0xc6fa, 0xdf5b,
-  0xbeb9, 0x8db6, 0x7d76, 0x8555, 0x8d55, 0x7d54, 0x8554, 0xb617,
-  0xbe17, 0x8d33, 0x7cb2, 0x8cb2, 0x7c91, 0x7451, 0xc637, 0xbe16,
-  0x7c50, 0x8c90, 0xc616, 0xce16, 0xce57, 0xded8, 0xce56, 0xb574,
-  0x7c0f, 0x4aec, 0x4aab, 0x8471, 0x73cf, 0x42ab, 0x532d, 0x532c,
-  0x532d, 0x4aec, 0x5b2c, 0x638e, 0x52ec, 0x636d, 0x636d, 0x4acb,
-  0x52ec, 0x5b2d, 0x4acb, 0x5b4c, 0x636d, 0x634c, 0x636d, 0x5b2c,
-  0x636d, 0x9d33, 0xad95, 0x73ef, 0x634d, 0x5b0c, 0x52ec, 0x5b0c,
-  0x52cb, 0x52eb, 0x5b2c, 0x5b0b, 0x5aeb, 0x5b0b, 0x5b0c, 0x5aeb,
-  0x5aeb, 0x632c, 0x634d, 0x5b0c, 0x52eb, 0x634c, 0x5b0b, 0x4a8a,
-  0x4249, 0x426a, 0x4a8a, 0x4aab, 0x8c92, 0xad94, 0x52aa, 0x4a8a,
-  0x4249, 0x4249, 0x4229, 0x4229, 0x3a29, 0x4229, 0x4229, 0x4229,
-  0x4229, 0x4a6a, 0x424a, 0x424a, 0x426a, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x424a, 0x426a, 0x424a, 0x426a, 0x4a8a, 0x4aaa, 0x4a6a,
-  0x4249, 0x4a8a, 0x4249, 0x4a8a, 0x4269, 0x4269, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x3a29, 0x4249, 0x4249, 0x4229, 0x4229, 0x3a09,
-  0x3a08, 0x3a08, 0x3a08, 0x3a29, 0x3a09, 0x3a08, 0x3a09, 0x3a08,
-  0x39e8, 0x3a08, 0x39e8, 0x31c7, 0x31c8, 0x31a7, 0x31c8, 0x31c8,
-  0x39e8, 0x31a7, 0x31a7, 0x31c8, 0x31c7, 0x31a7, 0x31c7, 0x31a7,
-  0x31a7, 0x31c7, 0x31c7, 0x31a7, 0x31c8, 0x31c8, 0x31a7, 0x31a7,
-  0x31c8, 0x31c7, 0x31c7, 0x31a7, 0x31c7, 0x31c8, 0x31c7, 0x31c7,
-  0x31c7, 0x31c7, 0x31c8, 0x31c8, 0x31a7, 0x31c7, 0x31c8, 0x31e8,
-  0x31e8, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x3a09, 0x3a29, 0x3a08,
-  0x3a08, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x3a49, 0x424a, 0x426a,
-  0x426a, 0x4a8b, 0x4aab, 0x426a, 0x3a49, 0x426a, 0x426a, 0x426a,
-  0x428a, 0x428a, 0x3a6a, 0x426a, 0x3a4a, 0x3a6a, 0x426a, 0x426a,
-  0x428a, 0x428a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a6a, 0x3a8a,
-  0x42ab, 0x42ab, 0x42ec, 0x4b0d, 0x432d, 0x4b4d, 0x4b6e, 0x538e,
-  0x53cf, 0x5bf0, 0x5c31, 0x6471, 0x6492, 0x6cd3, 0x7534, 0x7d75,
-  0x8dd6, 0x9637, 0xa679, 0xaef9, 0xbf3a, 0xc79b, 0xd7db, 0xeffd,
-  0xfffe, 0xefdd, 0xe7dc, 0xe7bc, 0xc71a, 0xbefa, 0xbed9, 0xdf5b,
-  0xc6d9, 0x9e17, 0x7d55, 0x8d55, 0x8d75, 0x8555, 0x7d14, 0x9db5,
-  0xb5f6, 0x8d33, 0x7471, 0x9513, 0x84b2, 0x6c51, 0xbdf6, 0xbdd5,
-  0x6bef, 0x9d12, 0xd6b7, 0xd657, 0xce36, 0xded8, 0xd657, 0xbdd5,
-  0x8430, 0x530c, 0x4aac, 0x6bae, 0x740f, 0x42cb, 0x4aec, 0x530c,
-  0x530c, 0x5b4d, 0x52eb, 0x5b2c, 0x52ec, 0x5aec, 0x636d, 0x52ec,
-  0x4acb, 0x5b2c, 0x4aaa, 0x740f, 0x5b2c, 0x636d, 0x6b8e, 0x52ca,
-  0x632c, 0x7c0f, 0x7c30, 0x740f, 0x6bae, 0x52ec, 0x52cb, 0x52cb,
-  0x52eb, 0x52eb, 0x52eb, 0x52cb, 0x52cb, 0x5aeb, 0x632c, 0x632c,
-  0x5b0c, 0x6b6d, 0x5aeb, 0x5b0c, 0x52cb, 0x5b0c, 0x634c, 0x4a8a,
-  0x424a, 0x426a, 0x426a, 0x428a, 0x5b0c, 0x73ef, 0x634d, 0x5b2d,
-  0x4249, 0x4249, 0x4249, 0x4229, 0x4229, 0x4229, 0x3a29, 0x3a29,
-  0x3a09, 0x3a29, 0x4229, 0x4249, 0x4249, 0x426a, 0x4a6a, 0x426a,
-  0x426a, 0x4249, 0x424a, 0x426a, 0x4a8b, 0x4aab, 0x52cb, 0x426a,
-  0x4a8a, 0x4269, 0x4249, 0x4249, 0x4249, 0x4269, 0x4249, 0x4229,
-  0x4249, 0x4249, 0x4249, 0x4229, 0x4229, 0x4249, 0x3a09, 0x3a08,
-  0x3a08, 0x3a08, 0x3a09, 0x3a29, 0x3a08, 0x3a08, 0x3a08, 0x39e8,
-  0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x31c7, 0x29a7, 0x31c7, 0x31c8,
-  0x31e8, 0x31c7, 0x31c7, 0x31c8, 0x31c7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31c8, 0x31a7, 0x31a7, 0x31a7, 0x31c8, 0x31a7, 0x31a7,
-  0x31a7, 0x31c8, 0x31a7, 0x31c8, 0x39c8, 0x39c8, 0x31c7, 0x39e8,
-  0x31c7, 0x31c7, 0x39e8, 0x31c8, 0x31a7, 0x39e8, 0x31c7, 0x31c7,
-  0x31c7, 0x31c8, 0x39e8, 0x3a09, 0x3a08, 0x426a, 0x3a08, 0x3a08,
-  0x3a08, 0x3a08, 0x3a09, 0x4249, 0x3a49, 0x3a49, 0x424a, 0x4249,
-  0x426a, 0x426a, 0x426a, 0x428a, 0x426a, 0x426a, 0x4249, 0x4a8a,
-  0x426a, 0x3a49, 0x3a49, 0x426a, 0x424a, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x3a6a, 0x426a, 0x3a6a, 0x3a4a, 0x3a6a, 0x3a6a, 0x3a6a,
-  0x3a8a, 0x3aab, 0x42cb, 0x42ec, 0x432d, 0x4b2d, 0x4b4e, 0x538e,
-  0x53cf, 0x5bf0, 0x6431, 0x6451, 0x6492, 0x6cd3, 0x7534, 0x7d75,
-  0x8dd6, 0x9637, 0xa679, 0xaed9, 0xb73a, 0xc77b, 0xd7bb, 0xeffd,
-  0xfffe, 0xefdd, 0xe7bc, 0xe7bc, 0xc73a, 0xbeda, 0xbed9, 0xdf5b,
-  0xc6d9, 0xa638, 0x8576, 0x8d95, 0x8d75, 0x8d75, 0x7d14, 0x9d95,
-  0x9513, 0x8d13, 0x7471, 0xa575, 0x8d13, 0x6c30, 0xadb5, 0xce57,
-  0x7c50, 0x9d53, 0xe719, 0xd697, 0xc616, 0xdeb8, 0xde97, 0xce36,
-  0x9d33, 0x5b4d, 0x4aec, 0x634d, 0x8450, 0x4b0c, 0x42ab, 0x4aec,
-  0x530c, 0x5b2d, 0x634d, 0x636d, 0x52eb, 0x5b0c, 0x636d, 0x4aec,
-  0x4aab, 0x4aab, 0x5b0c, 0x638d, 0x4a89, 0x5b0c, 0x52cb, 0x5b0b,
-  0x5aeb, 0x6b8d, 0x73ce, 0x6bae, 0x636d, 0x5b0c, 0x5aec, 0x52cb,
-  0x52ab, 0x4aaa, 0x52aa, 0x52cb, 0x5aeb, 0x5b2c, 0x5b0c, 0x5aeb,
-  0x632c, 0x634d, 0x634d, 0x5b2c, 0x5b0c, 0x52cb, 0x4269, 0x4249,
-  0x426a, 0x426a, 0x4269, 0x428a, 0x4aaa, 0x5b4d, 0x6bcf, 0x426a,
-  0x4249, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x4229, 0x3a28,
-  0x3a29, 0x4229, 0x4229, 0x4249, 0x4249, 0x4a6a, 0x424a, 0x426a,
-  0x4249, 0x426a, 0x426a, 0x4aab, 0x4aab, 0x52cc, 0x4aab, 0x4a8a,
-  0x4aaa, 0x4a6a, 0x4249, 0x3a08, 0x3a29, 0x3a09, 0x4229, 0x4229,
-  0x3a08, 0x4229, 0x3a08, 0x3a09, 0x3a09, 0x3a09, 0x3a09, 0x3a08,
-  0x3a09, 0x3a08, 0x3a09, 0x4249, 0x4269, 0x4a6a, 0x3a08, 0x39e8,
-  0x4229, 0x4249, 0x4229, 0x39e8, 0x39e8, 0x31c7, 0x31c8, 0x31c7,
-  0x29a7, 0x31a7, 0x31c8, 0x31c7, 0x31a7, 0x31c8, 0x31c8, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x3187, 0x31a7, 0x31c7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x3187, 0x31c7, 0x31a7, 0x39c7, 0x39c8, 0x31a7,
-  0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x31c7,
-  0x31c8, 0x39e8, 0x31c8, 0x31c8, 0x39e8, 0x39e8, 0x3a08, 0x3a08,
-  0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x3a49, 0x4249, 0x4269,
-  0x4249, 0x426a, 0x4269, 0x426a, 0x426a, 0x426a, 0x426a, 0x428a,
-  0x426a, 0x428a, 0x4249, 0x4249, 0x424a, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x3a49, 0x3a4a, 0x3a49, 0x3a49, 0x3a4a, 0x3a4a, 0x3a6a,
-  0x3a6a, 0x3a8a, 0x42ab, 0x42ec, 0x4b4d, 0x4b2d, 0x4b4e, 0x538e,
-  0x5bf0, 0x5c10, 0x6451, 0x6451, 0x6492, 0x6cd3, 0x7534, 0x7d75,
-  0x8dd6, 0x9617, 0x9e78, 0xaed9, 0xb73a, 0xc77b, 0xd7bc, 0xefdd,
-  0xfffe, 0xeffd, 0xe7bc, 0xe7bc, 0xcf5b, 0xbefa, 0xb6d9, 0xd75b,
-  0xc6b9, 0xb679, 0x8596, 0x8d75, 0x8554, 0x9575, 0x7cf3, 0x9d95,
-  0x8d33, 0x84f2, 0x7492, 0x8cf3, 0x9513, 0x6c0f, 0xadb5, 0xce77,
-  0x94f3, 0xad74, 0xef5a, 0xdeb8, 0xd677, 0xded8, 0xde97, 0xce16,
-  0xbdd6, 0x7c0f, 0x4aec, 0x52ec, 0x8450, 0x5b2c, 0x3a8a, 0x4acb,
-  0x532d, 0x4acb, 0x73cf, 0x636d, 0x8c91, 0x9d13, 0x634d, 0x52ec,
-  0x42ab, 0x426a, 0x530c, 0x6bad, 0x4a8a, 0x52cb, 0x52cb, 0x52ca,
-  0x4aaa, 0x5b0b, 0x636d, 0x73cf, 0x636d, 0x5aec, 0x52cb, 0x52aa,
-  0x52cb, 0x52cb, 0x52cb, 0x52eb, 0x5b0c, 0x5b0c, 0x5b2c, 0x632c,
-  0x634d, 0x5b2c, 0x5b2c, 0x5b2c, 0x634d, 0x632c, 0x4a69, 0x426a,
-  0x426a, 0x4a6a, 0x4249, 0x426a, 0x428a, 0x4aeb, 0x6bae, 0x4aab,
-  0x4249, 0x4249, 0x4a49, 0x4a6a, 0x4229, 0x4229, 0x4208, 0x3a08,
-  0x4229, 0x4229, 0x3a29, 0x4229, 0x4249, 0x4249, 0x426a, 0x426a,
-  0x426a, 0x428a, 0x4aab, 0x4aab, 0x6b8f, 0x5b2d, 0x4aab, 0x4269,
-  0x4269, 0x4249, 0x4249, 0x3a08, 0x3a08, 0x3a09, 0x3a29, 0x39e8,
-  0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x3a08, 0x4229, 0x3a29,
-  0x4249, 0x4a6a, 0x4a8b, 0x4aaa, 0x4a6a, 0x4229, 0x3a08, 0x4208,
-  0x39e8, 0x31c8, 0x39e8, 0x3a29, 0x39e8, 0x31c7, 0x39c8, 0x31a7,
-  0x31a7, 0x31c7, 0x31c7, 0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x31a7,
-  0x31a7, 0x31a7, 0x31c8, 0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31c8,
-  0x3187, 0x31a7, 0x31a7, 0x39c8, 0x39c8, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x31a7, 0x31c8,
-  0x31c8, 0x31c8, 0x39e8, 0x31e8, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a09, 0x3a29, 0x3a29, 0x3a49, 0x4249, 0x426a, 0x4249, 0x4269,
-  0x426a, 0x426a, 0x4269, 0x426a, 0x426a, 0x4a8a, 0x426a, 0x428a,
-  0x428a, 0x426a, 0x426a, 0x424a, 0x426a, 0x426a, 0x3a49, 0x426a,
-  0x3a49, 0x3a49, 0x3a29, 0x3229, 0x3229, 0x3a29, 0x3a29, 0x3a4a,
-  0x3a8a, 0x3a8a, 0x42ab, 0x42cc, 0x4b2d, 0x4b4d, 0x4b6e, 0x538e,
-  0x53cf, 0x5bf0, 0x5c10, 0x6451, 0x6471, 0x6cb2, 0x6d13, 0x7d55,
-  0x85b6, 0x9617, 0x9e78, 0xaed9, 0xb71a, 0xbf5b, 0xcfbb, 0xefdd,
-  0xfffe, 0xeffd, 0xe7dc, 0xe7bc, 0xd77b, 0xbefa, 0xb6ba, 0xcf3b,
-  0xc6b9, 0xae37, 0x8575, 0x8575, 0x8555, 0x9595, 0x7d13, 0x8513,
-  0x84f3, 0x84f2, 0x7491, 0x7c71, 0x9d33, 0xa574, 0xa594, 0xb5d5,
-  0x9d13, 0xbdb5, 0xef3a, 0xde97, 0xd677, 0xe6d8, 0xde77, 0xd657,
-  0xc616, 0x94b1, 0x4aec, 0x42ab, 0x7bef, 0x740f, 0x3a8a, 0x42ab,
-  0x532d, 0x4acb, 0x73ee, 0x740f, 0xa553, 0x7c0f, 0x4aab, 0x52ec,
-  0x428b, 0x428a, 0x426a, 0x740f, 0x632c, 0x4aaa, 0x4a69, 0x4249,
-  0x4269, 0x4aaa, 0x636d, 0x73ef, 0x73ce, 0x5b0c, 0x52cb, 0x52ca,
-  0x52ab, 0x52ab, 0x52aa, 0x52ca, 0x5aeb, 0x5b0b, 0x6b6d, 0x6b8d,
-  0x632c, 0x632c, 0x5b2c, 0x5b2c, 0x636d, 0x6b8d, 0x52aa, 0x4a8a,
-  0x4249, 0x426a, 0x426a, 0x4249, 0x4aab, 0x52cc, 0x530c, 0x52cb,
-  0x636d, 0x5aec, 0x4a49, 0x4a6a, 0x4a49, 0x4229, 0x4229, 0x4229,
-  0x4229, 0x4229, 0x4249, 0x4229, 0x4249, 0x4249, 0x424a, 0x4a6a,
-  0x426a, 0x428a, 0x52cb, 0x52ec, 0xb618, 0x8c92, 0x3a49, 0x426a,
-  0x4269, 0x4249, 0x3a29, 0x39e8, 0x31e8, 0x31e7, 0x39e8, 0x39e8,
-  0x31c8, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x3a09, 0x4229,
-  0x4a8a, 0x4a6a, 0x426a, 0x4a6a, 0x4249, 0x4229, 0x3a08, 0x39e8,
-  0x39c8, 0x31c7, 0x39e8, 0x39e8, 0x39e8, 0x31c8, 0x31a7, 0x31a7,
-  0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31a7,
-  0x3187, 0x31a7, 0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x31c8,
-  0x31c8, 0x31c8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a29, 0x3a08,
-  0x3a08, 0x3a29, 0x4249, 0x4249, 0x4249, 0x426a, 0x4269, 0x426a,
-  0x426a, 0x426a, 0x426a, 0x428a, 0x4a8a, 0x4aab, 0x426a, 0x4aab,
-  0x426a, 0x428a, 0x428a, 0x426a, 0x426a, 0x426a, 0x3a49, 0x3a29,
-  0x3a29, 0x3a29, 0x3a29, 0x3229, 0x3209, 0x3229, 0x3a29, 0x3a4a,
-  0x3a6a, 0x3aab, 0x42cb, 0x42ec, 0x4b2d, 0x4b4d, 0x538e, 0x538e,
-  0x53cf, 0x5bef, 0x5c10, 0x5c31, 0x6471, 0x6c92, 0x6cf3, 0x7d54,
-  0x8596, 0x8df7, 0x9e58, 0xa6b9, 0xb71a, 0xbf5b, 0xcfbb, 0xe7dc,
-  0xfffe, 0xf7fd, 0xe7dd, 0xe7bc, 0xd77b, 0xb6da, 0xb6da, 0xc6fa,
-  0xcefa, 0xb678, 0x8595, 0x8575, 0x8555, 0x8d55, 0x7d14, 0x7cd3,
-  0x84f3, 0x8d13, 0x7cb2, 0x7471, 0x9d53, 0x9d33, 0xa553, 0x94d2,
-  0xa553, 0xd698, 0xef39, 0xd676, 0xd657, 0xdeb8, 0xd677, 0xd677,
-  0xce16, 0xa512, 0x4b2c, 0x42ac, 0x634d, 0x8450, 0x3a6a, 0x426a,
-  0x4aab, 0x530c, 0x5b6d, 0x6bee, 0x8470, 0x634d, 0x4aaa, 0x4acb,
-  0x4aab, 0x428a, 0x426a, 0x6bce, 0x634c, 0x5aeb, 0x4269, 0x4249,
-  0x4a8a, 0x5aec, 0x632d, 0x632c, 0x634d, 0x5b0c, 0x52ca, 0x4aaa,
-  0x52aa, 0x4aaa, 0x52cb, 0x52cb, 0x5aeb, 0x632c, 0x634d, 0x636d,
-  0x634d, 0x632c, 0x5b0c, 0x5b0c, 0x636d, 0x8450, 0x5b0c, 0x4a89,
-  0x4a8a, 0x4a8a, 0x426a, 0x4249, 0x428a, 0x4acc, 0x52ec, 0x4aab,
-  0x6bae, 0x5b0c, 0x4a8a, 0x52cb, 0x4a8a, 0x4249, 0x4229, 0x4229,
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4249, 0x4249, 0x4249, 0x4229,
-  0x426a, 0x428a, 0x4aab, 0x4acc, 0x6baf, 0x73f0, 0x4a8a, 0x426a,
-  0x426a, 0x3a09, 0x39e8, 0x31c8, 0x31e7, 0x31c7, 0x31c7, 0x39e8,
-  0x39e8, 0x31e8, 0x31c8, 0x31e8, 0x39e8, 0x31e8, 0x31e8, 0x3a08,
-  0x4229, 0x4229, 0x4229, 0x4249, 0x4229, 0x3a29, 0x3a29, 0x3a08,
-  0x3a08, 0x39c7, 0x39e8, 0x39e8, 0x3a09, 0x31c8, 0x31a7, 0x31a7,
-  0x39c8, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x39e8, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39c7, 0x31a7, 0x31a7,
-  0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31c8, 0x31c8, 0x31c7, 0x31c7,
-  0x31c7, 0x31e8, 0x31e8, 0x39e8, 0x31e8, 0x39e8, 0x3a08, 0x3a29,
-  0x4249, 0x3a29, 0x4249, 0x426a, 0x4249, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x426a, 0x428a, 0x426a, 0x426a, 0x426a, 0x426a, 0x4249,
-  0x4269, 0x426a, 0x426a, 0x4acb, 0x426a, 0x426a, 0x4249, 0x3a29,
-  0x3a49, 0x3a29, 0x3208, 0x3208, 0x3208, 0x3a29, 0x3a4a, 0x3a4a,
-  0x3a8a, 0x3a8a, 0x42cb, 0x4b0c, 0x4b0c, 0x4b4d, 0x53af, 0x53ae,
-  0x538e, 0x53cf, 0x5bf0, 0x5c30, 0x6471, 0x6c92, 0x6cf3, 0x7534,
-  0x8595, 0x8df7, 0x9e58, 0xa6b9, 0xb6fa, 0xbf5b, 0xcf9b, 0xe7dc,
-  0xfffe, 0xf7fd, 0xe7dc, 0xe7bc, 0xdf7c, 0xb6fa, 0xa6ba, 0xbeda,
-  0xdf5b, 0xbeb9, 0x8596, 0x7d55, 0x8d95, 0x8554, 0x7d14, 0x7cf3,
-  0x84f3, 0x84f4, 0x84d3, 0x7c91, 0xa594, 0x7c50, 0xad94, 0x94f2,
-  0xb5f5, 0xe719, 0xe739, 0xd697, 0xde97, 0xdeb7, 0xde97, 0xd656,
-  0xce16, 0xb574, 0x5b4d, 0x4acc, 0x52ec, 0x7c0f, 0x428b, 0x426b,
-  0x428a, 0x530c, 0x5b2c, 0x52ec, 0x8450, 0x73cf, 0x4a8a, 0x4a8a,
-  0x4aab, 0x4acb, 0x428a, 0x6bad, 0x636d, 0x5b2c, 0x52aa, 0x4a89,
-  0x4a69, 0x52cb, 0x634d, 0x7c0f, 0x634d, 0x52cb, 0x52ca, 0x52aa,
-  0x4aaa, 0x4aaa, 0x52aa, 0x52cb, 0x5aeb, 0x634c, 0x5b2c, 0x632d,
-  0x634d, 0x5b0c, 0x5b0c, 0x5b0c, 0x636d, 0x7c30, 0x5b0b, 0x4aaa,
-  0x52cb, 0x4aaa, 0x4a8a, 0x4269, 0x428a, 0x4aab, 0x4acb, 0x52cb,
-  0x94f4, 0x634d, 0x5aec, 0x632d, 0x52aa, 0x4a8a, 0x4249, 0x4249,
-  0x4229, 0x4229, 0x4229, 0x4249, 0x4229, 0x4229, 0x4249, 0x4249,
-  0x4a8a, 0x4a8a, 0x4a8a, 0x4aab, 0x4a8b, 0x4aab, 0x4a8a, 0x4249,
-  0x3a08, 0x31c8, 0x39e8, 0x31c7, 0x31c7, 0x31a7, 0x31a7, 0x31a7,
-  0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c7, 0x31c8, 0x39e8, 0x3a09,
-  0x3a29, 0x3a09, 0x3a08, 0x39e8, 0x31e8, 0x3a08, 0x4229, 0x39e8,
-  0x3a08, 0x31a7, 0x31c8, 0x39e8, 0x31c7, 0x31a7, 0x31a7, 0x31c7,
-  0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x31c8, 0x31a7,
-  0x3187, 0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x3187,
-  0x31a7, 0x39c7, 0x31a7, 0x31a7, 0x39e8, 0x39c7, 0x31a7, 0x31a7,
-  0x31a7, 0x39c8, 0x39c7, 0x39c8, 0x31a7, 0x31a7, 0x31c7, 0x39e8,
-  0x31e8, 0x39e8, 0x3a08, 0x39e8, 0x3a29, 0x3a08, 0x3a08, 0x3a29,
-  0x4229, 0x4249, 0x3a29, 0x426a, 0x426a, 0x4a8a, 0x426a, 0x428a,
-  0x426a, 0x426a, 0x4a8a, 0x428a, 0x426a, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x428a, 0x4249, 0x4269, 0x3a49, 0x3a49, 0x3a29, 0x3a29,
-  0x3a29, 0x3a29, 0x3208, 0x3208, 0x3208, 0x3229, 0x3a4a, 0x3a6a,
-  0x42ab, 0x42ab, 0x42cb, 0x42ec, 0x4b0c, 0x4b4d, 0x5baf, 0x5bcf,
-  0x538e, 0x53af, 0x53cf, 0x5c10, 0x6451, 0x6492, 0x6cd3, 0x7534,
-  0x7d75, 0x8dd6, 0x9e38, 0xa699, 0xaefa, 0xbf3b, 0xcf9b, 0xdfdc,
-  0xf7fe, 0xf7fd, 0xe7dc, 0xe7bc, 0xe79c, 0xbf1a, 0xa6b9, 0xaeb9,
-  0xdf5b, 0xbe99, 0x8db6, 0x7d55, 0x8575, 0x7d34, 0x7d13, 0x7cd3,
-  0x7cd3, 0x84d3, 0x84b3, 0x84d2, 0xad95, 0x7430, 0xa594, 0x9d33,
-  0xbe36, 0xef7b, 0xe719, 0xd677, 0xded8, 0xd656, 0xce36, 0xd697,
-  0xce16, 0xb595, 0x73ef, 0x42ab, 0x52cc, 0x6b8e, 0x4aab, 0x426a,
-  0x426a, 0x42aa, 0x5b4d, 0x5aec, 0xad53, 0x636d, 0x3a29, 0x426a,
-  0x4a8b, 0x4acb, 0x4aab, 0x638d, 0x634c, 0x52aa, 0x5acb, 0x52cb,
-  0x4a8a, 0x52aa, 0x5b0c, 0x634d, 0x6b8d, 0x52eb, 0x52cb, 0x52cb,
-  0x52aa, 0x52aa, 0x52cb, 0x52cb, 0x5aeb, 0x5b2c, 0x632d, 0x5b2c,
-  0x52eb, 0x5aec, 0x5b0c, 0x5b0c, 0x634d, 0x73cf, 0x5b2c, 0x52aa,
-  0x52aa, 0x52aa, 0x52ab, 0x4aaa, 0x4aaa, 0x4aaa, 0x4acb, 0x530c,
-  0x5b2d, 0x4aaa, 0x7bef, 0x6b6d, 0x52cb, 0x4a8a, 0x4269, 0x4249,
-  0x4269, 0x4249, 0x4249, 0x4a6a, 0x4229, 0x4229, 0x4229, 0x4249,
-  0x4249, 0x4a8a, 0x428a, 0x4a8b, 0x428a, 0x426a, 0x4249, 0x4229,
-  0x3a08, 0x39e8, 0x31c7, 0x31a7, 0x2987, 0x2987, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x39c8, 0x39c8, 0x39e8,
-  0x39e8, 0x3a08, 0x39e8, 0x31c8, 0x31c8, 0x3a08, 0x31c8, 0x39c8,
-  0x31c7, 0x31a7, 0x31a7, 0x39c7, 0x31a7, 0x39c7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x39c7, 0x31c7, 0x31a7, 0x31a7, 0x31a7,
-  0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x39c7, 0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31c7, 0x39c7, 0x31a7,
-  0x31a7, 0x31a7, 0x39c7, 0x39c7, 0x31a7, 0x31a7, 0x31a7, 0x39e8,
-  0x31c8, 0x39e8, 0x3a08, 0x39e8, 0x3a08, 0x3a29, 0x3a29, 0x4249,
-  0x3a29, 0x4269, 0x3a49, 0x4249, 0x426a, 0x4a8a, 0x426a, 0x426a,
-  0x428a, 0x426a, 0x428a, 0x426a, 0x426a, 0x426a, 0x426a, 0x426a,
-  0x428a, 0x426a, 0x426a, 0x4249, 0x4249, 0x3a49, 0x3a29, 0x3a29,
-  0x3a29, 0x3a09, 0x3a29, 0x3a4a, 0x3a29, 0x3a49, 0x3a6a, 0x428a,
-  0x42aa, 0x4acb, 0x4aec, 0x42ec, 0x4b0c, 0x4b2d, 0x4b6e, 0x536e,
-  0x538e, 0x53af, 0x53cf, 0x5c10, 0x5c31, 0x6471, 0x6cd3, 0x7514,
-  0x7d75, 0x8dd6, 0x9618, 0xa678, 0xaeda, 0xbf3b, 0xc79b, 0xdfbc,
-  0xf7fd, 0xf7fd, 0xe7dc, 0xe7bc, 0xe79c, 0xc73b, 0xa6b9, 0xa6b9,
-  0xd73a, 0xc6d9, 0x8dd6, 0x7555, 0x8575, 0x7d14, 0x74f3, 0x7d13,
-  0x7cf3, 0x84f3, 0x7c92, 0x8492, 0xa554, 0x6c0f, 0x8cf2, 0x9d53,
-  0xbdf6, 0xef7b, 0xe6f9, 0xde97, 0xdeb7, 0xc5f5, 0xce36, 0xd676,
-  0xbdf5, 0xb574, 0x8c50, 0x42aa, 0x5b4d, 0x5b0c, 0x4aab, 0x426a,
-  0x3a6a, 0x426a, 0x52eb, 0xbdd5, 0xbdf5, 0x4a8a, 0x3a09, 0x3a09,
-  0x426a, 0x4a8b, 0x4acb, 0x6bce, 0x73ce, 0x5aeb, 0x52aa, 0x52aa,
-  0x52cb, 0x52aa, 0x4aaa, 0x5b0c, 0x634c, 0x52eb, 0x4aaa, 0x52aa,
-  0x52aa, 0x52cb, 0x52cb, 0x5b0c, 0x5aeb, 0x5b0c, 0x634d, 0x52eb,
-  0x52cb, 0x52cb, 0x52cb, 0x52eb, 0x634d, 0x73cf, 0x5b0c, 0x4aaa,
-  0x4aaa, 0x4aaa, 0x52aa, 0x52aa, 0x52ab, 0x5b0c, 0x52eb, 0x4aab,
-  0x4249, 0x4269, 0x94f3, 0x8451, 0x52eb, 0x52aa, 0x4a8a, 0x4a8a,
-  0x4a8a, 0x4a8a, 0x4a8a, 0x4249, 0x4229, 0x4a49, 0x4229, 0x4229,
-  0x4249, 0x4a8a, 0x4aab, 0x4a8a, 0x4a8a, 0x4249, 0x4249, 0x4249,
-  0x3a09, 0x39e8, 0x31c7, 0x3187, 0x3187, 0x3187, 0x2987, 0x2987,
-  0x3187, 0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x39c8,
-  0x31c8, 0x39e8, 0x39e8, 0x31c7, 0x39e8, 0x39e8, 0x31c8, 0x39c8,
-  0x31a7, 0x31c7, 0x31c7, 0x39c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x39c8, 0x39c8, 0x31a7, 0x31a7, 0x39e8, 0x39c8,
-  0x39c7, 0x39c8, 0x39c7, 0x31a7, 0x39c7, 0x31c7, 0x31c7, 0x31c8,
-  0x31e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x3a29,
-  0x3a29, 0x426a, 0x426a, 0x426a, 0x426a, 0x4a8a, 0x4a8a, 0x428a,
-  0x4aab, 0x4aaa, 0x428a, 0x4a8a, 0x426a, 0x428a, 0x428a, 0x426a,
-  0x426a, 0x426a, 0x424a, 0x426a, 0x4249, 0x3a49, 0x3a6a, 0x3209,
-  0x3a29, 0x3a09, 0x426a, 0x3a49, 0x428a, 0x428a, 0x428a, 0x42aa,
-  0x4acb, 0x4b0c, 0x4aec, 0x4aec, 0x4b0d, 0x4b2d, 0x4b4d, 0x538e,
-  0x538e, 0x53af, 0x53cf, 0x5bf0, 0x5c30, 0x6471, 0x6cd2, 0x7514,
-  0x7d55, 0x8db6, 0x9617, 0x9e78, 0xaed9, 0xb71a, 0xc77b, 0xd7bc,
-  0xf7fe, 0xfffe, 0xeffd, 0xdfdc, 0xe7bc, 0xd75b, 0xa6b9, 0xa699,
-  0xd71a, 0xcef9, 0x95d6, 0x7534, 0x8555, 0x7d34, 0x74f3, 0x7cf3,
-  0x7cf3, 0x84f3, 0x7c92, 0x84b2, 0x9d33, 0x7450, 0x7c71, 0xad94,
-  0xc656, 0xef5a, 0xe719, 0xd697, 0xd657, 0xd657, 0xd677, 0xce56,
-  0xb5b4, 0xa533, 0x94f2, 0x4aeb, 0x5b4d, 0x5b0c, 0x426a, 0x428a,
-  0x3a49, 0x426a, 0x426a, 0xad73, 0xa4f2, 0x426a, 0x31e8, 0x31e8,
-  0x3a29, 0x426a, 0x52cb, 0x6bae, 0x6b6d, 0x52eb, 0x4aaa, 0x52aa,
-  0x4aaa, 0x52aa, 0x5aeb, 0x632c, 0x632c, 0x52eb, 0x4aaa, 0x4aaa,
-  0x4aab, 0x52eb, 0x52eb, 0x52cb, 0x4aaa, 0x5b0c, 0x636d, 0x634d,
-  0x5aec, 0x52ec, 0x52cb, 0x52cb, 0x636d, 0x6b8e, 0x52cb, 0x4a8a,
-  0x4aaa, 0x4a8a, 0x52cb, 0x52ab, 0x52cb, 0x52ec, 0x52cb, 0x426a,
-  0x4269, 0x4269, 0x4aaa, 0x4aaa, 0x52ab, 0x634d, 0x5aeb, 0x4aaa,
-  0x4249, 0x4249, 0x4249, 0x4269, 0x4229, 0x4249, 0x4249, 0x4229,
-  0x4249, 0x426a, 0x426a, 0x4a8a, 0x4a8b, 0x426a, 0x4249, 0x4229,
-  0x3a09, 0x31c7, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x2987, 0x2987,
-  0x2987, 0x2987, 0x2987, 0x3187, 0x31a7, 0x31c7, 0x39e8, 0x39e8,
-  0x39c7, 0x39c7, 0x39c7, 0x31a7, 0x39e8, 0x39c7, 0x31a7, 0x31c7,
-  0x31c7, 0x31c7, 0x39c7, 0x31a7, 0x31a7, 0x3187, 0x31a7, 0x31a7,
-  0x3187, 0x3186, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39e8, 0x31a7,
-  0x31a7, 0x31a7, 0x3187, 0x3187, 0x3187, 0x31a7, 0x31a7, 0x31a7,
-  0x3187, 0x39c7, 0x31a7, 0x31a7, 0x39c8, 0x31c7, 0x31c7, 0x39c7,
-  0x31c7, 0x31a7, 0x31c7, 0x31c7, 0x39e8, 0x39c7, 0x31c7, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x3a29, 0x3a29, 0x3a09, 0x3a08, 0x3a09,
-  0x4249, 0x4a8a, 0x4a8a, 0x428a, 0x426a, 0x426a, 0x4aab, 0x428a,
-  0x4aab, 0x428a, 0x4a8a, 0x4aab, 0x428a, 0x426a, 0x426a, 0x428a,
-  0x426a, 0x3a29, 0x4249, 0x4249, 0x3a29, 0x3a29, 0x3a09, 0x3a09,
-  0x3a09, 0x3a29, 0x3a29, 0x3a49, 0x428a, 0x428a, 0x42ab, 0x42aa,
-  0x42ab, 0x42ab, 0x42cb, 0x4aec, 0x4b2d, 0x4b0d, 0x534d, 0x536e,
-  0x4b6e, 0x53cf, 0x53cf, 0x53ef, 0x5c10, 0x6471, 0x6cb2, 0x7513,
-  0x7d55, 0x85b6, 0x95f7, 0x9e58, 0xa6b9, 0xb71a, 0xc77b, 0xd7bb,
-  0xeffd, 0xfffe, 0xefdd, 0xe7dc, 0xe7bc, 0xcf3b, 0xa699, 0xa699,
-  0xcf1a, 0xd71a, 0x95f6, 0x7d54, 0x7d54, 0x7d34, 0x7d13, 0x7cf3,
-  0x74b2, 0x7cd2, 0x7cb2, 0x9514, 0x8cd2, 0x6c30, 0x6bef, 0xa574,
-  0xc656, 0xef7a, 0xe719, 0xce57, 0xd677, 0xe6f9, 0xd656, 0xce16,
-  0xb594, 0xa513, 0x9d12, 0x52ec, 0x4aec, 0x6bae, 0x426a, 0x428a,
-  0x4249, 0x3a69, 0x3a6a, 0x8c4f, 0xe6d7, 0x6b6d, 0x31c7, 0x31e8,
-  0x3a09, 0x3a29, 0x4aab, 0x6bad, 0x5b0c, 0x4aaa, 0x4a8a, 0x4a8a,
-  0x52aa, 0x52aa, 0x5b0b, 0x636d, 0x5b0b, 0x4a8a, 0x52aa, 0x4aaa,
-  0x52eb, 0x52cb, 0x4aaa, 0x4aaa, 0x5b0c, 0x5b2c, 0x5b2c, 0x5b0c,
-  0x5b2c, 0x52cb, 0x52eb, 0x52cb, 0x634d, 0x6b8e, 0x4a8a, 0x4a8a,
-  0x4269, 0x4a6a, 0x4aaa, 0x4aab, 0x5b0c, 0x52eb, 0x4aaa, 0x4a8a,
-  0x426a, 0x4269, 0x4a69, 0x4aaa, 0x4aaa, 0x5b0c, 0x52eb, 0x4aaa,
-  0x4a8a, 0x4a8a, 0x52cb, 0x4a6a, 0x4249, 0x4229, 0x4229, 0x4229,
-  0x4229, 0x424a, 0x4a6a, 0x4a6a, 0x4a8a, 0x424a, 0x4249, 0x3a09,
-  0x39e8, 0x31c8, 0x31a7, 0x31a7, 0x2987, 0x3187, 0x2987, 0x2987,
-  0x2986, 0x2966, 0x2966, 0x31a7, 0x3a08, 0x39e8, 0x31c7, 0x31a7,
-  0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39c7, 0x31a7,
-  0x3187, 0x31a7, 0x31a7, 0x31a7, 0x39c7, 0x3187, 0x31a7, 0x31a7,
-  0x3186, 0x3186, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x3186, 0x3187, 0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39c8, 0x39e8,
-  0x39c7, 0x31a7, 0x39c7, 0x39e8, 0x31c7, 0x31a7, 0x31a7, 0x31c7,
-  0x39e8, 0x39e8, 0x3a08, 0x3a29, 0x4249, 0x3a29, 0x3a29, 0x4249,
-  0x4249, 0x428a, 0x428a, 0x428a, 0x426a, 0x426a, 0x4aab, 0x4aab,
-  0x4aaa, 0x4aab, 0x4aab, 0x4aab, 0x4aab, 0x4a8a, 0x4a8a, 0x4a8a,
-  0x4269, 0x426a, 0x426a, 0x426a, 0x3a29, 0x3a29, 0x3a29, 0x3a09,
-  0x3209, 0x3209, 0x3a09, 0x4249, 0x4aab, 0x426a, 0x428a, 0x4acb,
-  0x428b, 0x4aab, 0x4acc, 0x4aec, 0x4b0c, 0x4b0d, 0x4b2d, 0x536e,
-  0x4b6d, 0x53ae, 0x53cf, 0x53ef, 0x5c30, 0x6451, 0x6492, 0x6cf3,
-  0x7d54, 0x8596, 0x8df6, 0x9e38, 0xa699, 0xaefa, 0xbf5b, 0xcfbb,
-  0xe7fc, 0xfffd, 0xeffd, 0xe7dd, 0xe7bc, 0xd75b, 0xaeb9, 0xa699,
-  0xbed9, 0xdf3a, 0x95d6, 0x7d54, 0x7d54, 0x7d14, 0x7cf3, 0x7cf3,
-  0x8513, 0x8513, 0x7c92, 0x9513, 0x9533, 0x7450, 0x7430, 0xa574,
-  0xce76, 0xf79b, 0xded8, 0xd677, 0xce57, 0xef39, 0xd677, 0xce16,
-  0xbd94, 0x9cd2, 0xa512, 0x5b4d, 0x3a6b, 0x636d, 0x428b, 0x3a6a,
-  0x426a, 0x3a69, 0x3a49, 0x73ef, 0xde76, 0x7bee, 0x31c7, 0x31c8,
-  0x3a08, 0x3a09, 0x426a, 0x6bae, 0x52aa, 0x4a8a, 0x4a8a, 0x52aa,
-  0x52aa, 0x4a69, 0x4228, 0x52cb, 0x4aaa, 0x4a8a, 0x4a8a, 0x4a8a,
-  0x4aaa, 0x52eb, 0x52eb, 0x5b2c, 0x634d, 0x5b0c, 0x4aaa, 0x52cb,
-  0x5b0c, 0x52cb, 0x52eb, 0x4acb, 0x5b0c, 0x5b2c, 0x4a8a, 0x4a8a,
-  0x4249, 0x4269, 0x4a8a, 0x4aab, 0x52cb, 0x4a8a, 0x4a8a, 0x4a8a,
-  0x4a8a, 0x4269, 0x52cb, 0x5b0c, 0x4a8a, 0x4aaa, 0x4a8a, 0x4a8a,
-  0x4a69, 0x4a6a, 0x4a8a, 0x4269, 0x4249, 0x4229, 0x4229, 0x4229,
-  0x3a29, 0x424a, 0x426a, 0x426a, 0x4a8a, 0x4269, 0x3a29, 0x39e8,
-  0x31c7, 0x31c8, 0x39c8, 0x31a7, 0x31c7, 0x3187, 0x2987, 0x2966,
-  0x31a7, 0x39e8, 0x4a6a, 0x4209, 0x31c7, 0x39c8, 0x31c7, 0x31a7,
-  0x31a7, 0x39e8, 0x39c8, 0x31a7, 0x3187, 0x31a7, 0x39a7, 0x3186,
-  0x31a7, 0x31a7, 0x3187, 0x3186, 0x3187, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x3187, 0x3186, 0x3187, 0x3187, 0x31a7, 0x3186, 0x3186,
-  0x31a7, 0x3186, 0x3186, 0x3186, 0x3187, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x39c7, 0x31a7, 0x3187, 0x31a7, 0x31c7,
-  0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x31c7, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a08, 0x4249, 0x4249, 0x4229, 0x3a29, 0x4249,
-  0x3a29, 0x4a8a, 0x4aab, 0x4a8a, 0x428a, 0x4aaa, 0x4aab, 0x4acb,
-  0x4acb, 0x52cb, 0x4aab, 0x4aab, 0x4aab, 0x4aab, 0x428a, 0x428a,
-  0x4a8a, 0x424a, 0x3a29, 0x424a, 0x3a29, 0x3a29, 0x3a29, 0x3a09,
-  0x3209, 0x3a49, 0x426a, 0x426a, 0x428a, 0x42ab, 0x426a, 0x428a,
-  0x428b, 0x4aab, 0x4acc, 0x4aec, 0x4aec, 0x4b0c, 0x4b2d, 0x536e,
-  0x4b6d, 0x4b8e, 0x53cf, 0x53ef, 0x5c30, 0x5c51, 0x6492, 0x6cd3,
-  0x7534, 0x8575, 0x8dd6, 0x9638, 0xa699, 0xaeda, 0xbf5b, 0xcfbc,
-  0xe7dc, 0xf7fd, 0xf7fd, 0xe7dd, 0xe7dc, 0xd75b, 0xb6da, 0xa6b9,
-  0xb699, 0xdf3a, 0x95f7, 0x8575, 0x7d14, 0x8534, 0x7d13, 0x7cf2,
-  0x8513, 0x84f3, 0x7c92, 0x84b2, 0x8cd2, 0x6c10, 0x7c92, 0xa574,
-  0xce77, 0xf7bb, 0xde98, 0xce36, 0xded8, 0xe719, 0xde97, 0xd657,
-  0xad33, 0x8c50, 0xad33, 0x73cf, 0x322a, 0x4acb, 0x4aab, 0x426a,
-  0x42aa, 0x4aab, 0x426a, 0x4269, 0x94b0, 0x9cf2, 0x3a08, 0x31c8,
-  0x39e8, 0x3a09, 0x3a29, 0x530b, 0x4249, 0x4a69, 0x4a69, 0x4a69,
-  0x4228, 0x4249, 0x4a69, 0x4249, 0x4aaa, 0x4a89, 0x4a8a, 0x4a8a,
-  0x52ab, 0x52cb, 0x52eb, 0x5b0c, 0x5aeb, 0x5b2c, 0x5b4d, 0x4acb,
-  0x52cb, 0x52cb, 0x52cb, 0x52cb, 0x52ec, 0x5b0c, 0x4a69, 0x4a8a,
-  0x426a, 0x4249, 0x426a, 0x4a8a, 0x5b0c, 0x4269, 0x4249, 0x4249,
-  0x4249, 0x3a29, 0x4a8a, 0x52cb, 0x4a8a, 0x4a69, 0x4a69, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x4a6a, 0x4249, 0x4249, 0x4229, 0x4229,
-  0x4229, 0x4229, 0x424a, 0x4a6a, 0x4249, 0x4249, 0x4229, 0x39e8,
-  0x39e8, 0x39e8, 0x39c7, 0x31c7, 0x31a7, 0x31c7, 0x428a, 0x52ec,
-  0x3a09, 0x3a08, 0x52ab, 0x3a08, 0x39c7, 0x39e8, 0x39c8, 0x31a7,
-  0x31a7, 0x39c8, 0x41e8, 0x31a7, 0x3187, 0x39a7, 0x31a7, 0x3186,
-  0x3186, 0x3166, 0x3186, 0x3186, 0x3187, 0x3186, 0x3186, 0x3186,
-  0x31a7, 0x31a7, 0x39c7, 0x3186, 0x3186, 0x31a7, 0x3187, 0x3186,
-  0x3186, 0x3186, 0x31a7, 0x3187, 0x3186, 0x3187, 0x31a7, 0x3187,
-  0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39c7,
-  0x39c7, 0x31c7, 0x39c7, 0x39c7, 0x31c7, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x4229, 0x4229, 0x3a29, 0x4249, 0x426a, 0x426a,
-  0x426a, 0x4a8a, 0x426a, 0x428a, 0x4aaa, 0x4aab, 0x4aab, 0x4aab,
-  0x52ec, 0x4acb, 0x4aab, 0x52ec, 0x4a8b, 0x4a8a, 0x4a8a, 0x4249,
-  0x426a, 0x4249, 0x4249, 0x4249, 0x3a29, 0x3a09, 0x3208, 0x31e8,
-  0x3208, 0x424a, 0x3a29, 0x426a, 0x426a, 0x426a, 0x426a, 0x428a,
-  0x42ab, 0x4acb, 0x4aab, 0x4acc, 0x4b0c, 0x4aec, 0x4b2d, 0x4b2d,
-  0x4b4d, 0x4b8e, 0x53ae, 0x53cf, 0x5c10, 0x5c31, 0x6472, 0x6cd3,
-  0x7534, 0x8575, 0x8dd6, 0x9617, 0xa679, 0xaeda, 0xbf3b, 0xcfbc,
-  0xdffc, 0xf7fd, 0xf7fd, 0xe7fc, 0xefbc, 0xdf7c, 0xbefa, 0xb6d9,
-  0xb699, 0xd71a, 0xa657, 0x7d55, 0x8555, 0x8534, 0x7d14, 0x7cf3,
-  0x84f3, 0x84d3, 0x7cb2, 0x84d2, 0x7c51, 0x6c10, 0x7450, 0xa553,
-  0xd697, 0xf7bb, 0xdeb8, 0xc5f5, 0xd677, 0xe6f8, 0xdeb8, 0xcdf6,
-  0xc5d5, 0x94b2, 0xa4f2, 0x73ef, 0x324a, 0x3a6a, 0x52ec, 0x428a,
-  0x428a, 0x4a6a, 0x4a8b, 0x426a, 0x5aeb, 0x9d12, 0x4a89, 0x31a8,
-  0x31e8, 0x3a09, 0x3a09, 0x4aca, 0x4aaa, 0x4a8a, 0x4a69, 0x4a8a,
-  0x52aa, 0x52aa, 0x5aeb, 0x4a8a, 0x5aeb, 0x52ca, 0x52eb, 0x52eb,
-  0x4aaa, 0x5b0c, 0x632c, 0x52eb, 0x4aaa, 0x4aaa, 0x5b2c, 0x52eb,
-  0x52ec, 0x4aaa, 0x52cb, 0x4aab, 0x52cb, 0x52cb, 0x426a, 0x4aaa,
-  0x4a8a, 0x3a29, 0x426a, 0x4a8a, 0x4aaa, 0x52cb, 0x426a, 0x4249,
-  0x3a29, 0x4229, 0x52cb, 0x4a69, 0x4aaa, 0x4aaa, 0x4aaa, 0x4a69,
-  0x4249, 0x4249, 0x4a6a, 0x52ab, 0x4a8a, 0x4229, 0x4208, 0x4229,
-  0x4229, 0x4229, 0x4249, 0x424a, 0x4229, 0x3a08, 0x3a08, 0x39e8,
-  0x31c7, 0x31c7, 0x39c7, 0x31c7, 0x31c7, 0x3a08, 0x4a6a, 0x4a6a,
-  0x3a09, 0x3a29, 0x4229, 0x39e8, 0x4208, 0x39c7, 0x39c7, 0x39c7,
-  0x39c7, 0x31a7, 0x31a7, 0x31a7, 0x3186, 0x39a7, 0x3187, 0x31a7,
-  0x3186, 0x3186, 0x3186, 0x3187, 0x3186, 0x31a7, 0x3186, 0x3186,
-  0x31a6, 0x31a7, 0x31a7, 0x3186, 0x3186, 0x31a7, 0x3187, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31a7, 0x3187, 0x3187, 0x3186,
-  0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39c7,
-  0x39c7, 0x31c7, 0x39c7, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a09,
-  0x3a09, 0x3a09, 0x4229, 0x3a29, 0x3a29, 0x4249, 0x3a29, 0x426a,
-  0x426a, 0x4a8b, 0x428a, 0x4aab, 0x4aab, 0x4acb, 0x52cb, 0x4aab,
-  0x4aab, 0x4aab, 0x52ec, 0x4aab, 0x4a8b, 0x426a, 0x426a, 0x426a,
-  0x424a, 0x4249, 0x424a, 0x424a, 0x426a, 0x3a29, 0x31e8, 0x3209,
-  0x3a09, 0x3208, 0x3a49, 0x426a, 0x426a, 0x426a, 0x428a, 0x42ab,
-  0x428a, 0x42ab, 0x4aab, 0x4acb, 0x4aec, 0x4b0c, 0x4b0d, 0x4b2d,
-  0x4b4d, 0x4b6e, 0x4b8e, 0x53cf, 0x5c10, 0x5c31, 0x6472, 0x6cb2,
-  0x7514, 0x7d75, 0x8db6, 0x9617, 0x9e79, 0xaed9, 0xb73a, 0xcf9b,
-  0xdfdc, 0xf7fd, 0xf7fd, 0xe7fd, 0xe7dc, 0xdf9c, 0xc6fa, 0xb6b9,
-  0xb699, 0xcef9, 0xb6b9, 0x8576, 0x8d75, 0x7cf3, 0x8534, 0x84f3,
-  0x84f3, 0x9d54, 0x8cf2, 0x9513, 0x7c51, 0x7c71, 0x7471, 0xad94,
-  0xd697, 0xf7bc, 0xd698, 0xce36, 0xd677, 0xded8, 0xe6f8, 0xc5f5,
-  0xd657, 0x9cd2, 0x8c50, 0x6b8d, 0x3a6a, 0x3a4a, 0x4acb, 0x4aab,
-  0x5b0c, 0x6b4d, 0x3a29, 0x426a, 0x4a4a, 0x842f, 0x6b8d, 0x29a7,
-  0x31e8, 0x31e8, 0x3a09, 0x5b2b, 0x4aaa, 0x4a69, 0x4aaa, 0x5b0c,
-  0x5b0c, 0x52cb, 0x52eb, 0x5b0c, 0x52eb, 0x52cb, 0x52cb, 0x52cb,
-  0x52ab, 0x52aa, 0x52ab, 0x52cb, 0x52eb, 0x5b2c, 0x4aaa, 0x4aaa,
-  0x4aab, 0x4a8a, 0x52cb, 0x4aaa, 0x4aaa, 0x52cb, 0x4a8a, 0x4249,
-  0x4249, 0x52ec, 0x7c31, 0x4aaa, 0x52ec, 0x52cb, 0x4a8a, 0x4a8a,
-  0x4269, 0x3a28, 0x4aaa, 0x52cb, 0x5b0c, 0x4249, 0x4249, 0x4249,
-  0x4a69, 0x4229, 0x4a6a, 0x52ab, 0x4229, 0x4249, 0x4229, 0x4208,
-  0x39e8, 0x4229, 0x4229, 0x4a6a, 0x4229, 0x39e8, 0x31c7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x39e8, 0x3a08, 0x39e8, 0x39c7,
-  0x4229, 0x4a49, 0x3a08, 0x39c8, 0x39c7, 0x39c7, 0x31a7, 0x39c8,
-  0x39a7, 0x39c8, 0x39a7, 0x31a7, 0x3186, 0x3186, 0x31a7, 0x3186,
-  0x3166, 0x3186, 0x3166, 0x3186, 0x3186, 0x3187, 0x3186, 0x3166,
-  0x3186, 0x3187, 0x3166, 0x3166, 0x3187, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3186, 0x31a7, 0x3186, 0x31a7, 0x31a7,
-  0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31c7,
-  0x39c7, 0x39e8, 0x39c7, 0x39c7, 0x3a08, 0x39e8, 0x3a08, 0x39e8,
-  0x4209, 0x4229, 0x4229, 0x3a09, 0x4249, 0x4229, 0x4249, 0x426a,
-  0x424a, 0x428a, 0x428a, 0x4acb, 0x4aab, 0x4aab, 0x4acb, 0x52ec,
-  0x52ec, 0x4acb, 0x52cb, 0x52cb, 0x4a8b, 0x426a, 0x4a8b, 0x424a,
-  0x426a, 0x426a, 0x426a, 0x4249, 0x3a49, 0x3a29, 0x3a29, 0x3a09,
-  0x3a29, 0x3208, 0x4249, 0x3a29, 0x424a, 0x3a49, 0x426a, 0x428a,
-  0x428a, 0x4acb, 0x4acb, 0x42cb, 0x4aec, 0x4aec, 0x4b0c, 0x4b2d,
-  0x4b2d, 0x4b6d, 0x4b8e, 0x53ae, 0x53ef, 0x6431, 0x6471, 0x64b2,
-  0x6cf3, 0x7d54, 0x85b6, 0x8df7, 0x9e58, 0xa6b9, 0xb73a, 0xc77b,
-  0xd7bc, 0xeffd, 0xf7fe, 0xefdd, 0xe7dc, 0xe7bc, 0xcf1a, 0xb6b9,
-  0xb699, 0xced9, 0xbeb9, 0x8db6, 0x8554, 0x7d13, 0x8d54, 0x8513,
-  0x9554, 0x9d54, 0x9513, 0x8cf2, 0x7450, 0x7c71, 0x7c71, 0xad74,
-  0xd698, 0xf7bc, 0xd677, 0xce36, 0xde97, 0xe6f9, 0xe6d8, 0xce16,
-  0xd677, 0xad53, 0x8450, 0x5b2c, 0x426a, 0x3a4a, 0x428a, 0x4aab,
-  0x7bee, 0xa532, 0x3a29, 0x3a29, 0x52ab, 0x52cb, 0x634c, 0x4269,
-  0x39e8, 0x31e8, 0x39e8, 0x52eb, 0x3a28, 0x4269, 0x4a8a, 0x4aaa,
-  0x52aa, 0x52ca, 0x4aaa, 0x5b0c, 0x5b2c, 0x632c, 0x52cb, 0x52aa,
-  0x5aeb, 0x52aa, 0x52cb, 0x52eb, 0x52eb, 0x52eb, 0x52cb, 0x52cb,
-  0x5b0c, 0x4a8a, 0x426a, 0x52cb, 0x52cb, 0x426a, 0x4249, 0x4249,
-  0x4229, 0x4aab, 0x4aab, 0x4aaa, 0x4249, 0x4249, 0x3a29, 0x4249,
-  0x4249, 0x4a8a, 0x4a8a, 0x52cb, 0x4269, 0x4228, 0x39e8, 0x3a08,
-  0x4209, 0x4229, 0x4229, 0x4249, 0x4208, 0x4249, 0x4249, 0x39e8,
-  0x4229, 0x3a08, 0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x39c7, 0x39c8,
-  0x39c8, 0x39c7, 0x39c7, 0x39c7, 0x31c7, 0x4208, 0x3a08, 0x3a08,
-  0x39e8, 0x39e8, 0x39e8, 0x39c7, 0x31a7, 0x39c8, 0x39a7, 0x39c7,
-  0x39c7, 0x39c7, 0x39a7, 0x39a7, 0x39a7, 0x3186, 0x3186, 0x39a7,
-  0x3166, 0x3186, 0x3166, 0x3186, 0x3166, 0x3186, 0x3186, 0x3166,
-  0x3186, 0x3166, 0x3186, 0x31a7, 0x3186, 0x31a7, 0x3186, 0x3186,
-  0x3187, 0x3187, 0x3186, 0x3186, 0x3186, 0x3186, 0x3187, 0x3186,
-  0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x31a7, 0x39c8, 0x31c7,
-  0x39c7, 0x39c8, 0x39e8, 0x39e7, 0x31c7, 0x4209, 0x7bae, 0x62eb,
-  0x39e8, 0x4229, 0x3a09, 0x3a29, 0x424a, 0x424a, 0x4229, 0x426a,
-  0x4a6a, 0x4a8b, 0x428b, 0x4aab, 0x4aab, 0x52ec, 0x52ec, 0x52ec,
-  0x4acb, 0x52cb, 0x4aab, 0x4aab, 0x4aab, 0x426a, 0x4a8a, 0x4249,
-  0x426a, 0x426a, 0x424a, 0x4249, 0x3a29, 0x3a29, 0x3a49, 0x3a08,
-  0x3a29, 0x3a08, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x426a, 0x3a6a,
-  0x42ab, 0x42ab, 0x42aa, 0x42cb, 0x4aec, 0x4aec, 0x4aec, 0x4b0c,
-  0x4b2d, 0x4b4d, 0x4b6e, 0x53ae, 0x53cf, 0x5c10, 0x5c51, 0x6492,
-  0x6cf3, 0x7534, 0x8596, 0x8df6, 0x9e58, 0xa6b9, 0xb71a, 0xc77b,
-  0xd7bb, 0xeffc, 0xfffe, 0xefdd, 0xe7dc, 0xe7bc, 0xcf5b, 0xae99,
-  0xbeda, 0xc6d9, 0xc6d9, 0x8db6, 0x8d75, 0x8534, 0x8533, 0x8533,
-  0x9534, 0x8d13, 0x84f2, 0x7cb1, 0x7471, 0x7450, 0x740f, 0xa554,
-  0xded8, 0xf7bb, 0xd677, 0xd677, 0xce36, 0xdeb8, 0xe6d8, 0xd657,
-  0xce16, 0xc5f5, 0x8450, 0x7c30, 0x4acb, 0x322a, 0x632c, 0x6b4c,
-  0x8c4f, 0x7bee, 0x4249, 0x3a09, 0x5aec, 0x4a6a, 0x4a8a, 0x73ce,
-  0x52cb, 0x31c8, 0x39e8, 0x4aaa, 0x4229, 0x4aaa, 0x4a8a, 0x52ab,
-  0x52eb, 0x52cb, 0x5aeb, 0x52eb, 0x5aeb, 0x5b2c, 0x632c, 0x5aeb,
-  0x632c, 0x5b0c, 0x5b0c, 0x4aaa, 0x52cb, 0x52cb, 0x4aaa, 0x5b0c,
-  0x52ec, 0x52cb, 0x4aaa, 0x52cb, 0x52cb, 0x4a8a, 0x4249, 0x4a6a,
-  0x426a, 0x426a, 0x4249, 0x4249, 0x4249, 0x4249, 0x4249, 0x4269,
-  0x4249, 0x4269, 0x52eb, 0x4aaa, 0x3a28, 0x3a08, 0x3a08, 0x3a08,
-  0x3a08, 0x4208, 0x4229, 0x4a6a, 0x4a8a, 0x3a08, 0x3a08, 0x3a08,
-  0x4229, 0x3a08, 0x39e8, 0x3a08, 0x39e8, 0x39c8, 0x39c7, 0x39c7,
-  0x39a7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x3a08, 0x3a08, 0x39e8,
-  0x3a08, 0x3a08, 0x39c8, 0x39e8, 0x39c8, 0x31a7, 0x31a7, 0x39c8,
-  0x39c8, 0x39a7, 0x31a7, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3166, 0x3166, 0x3186, 0x3186, 0x3186, 0x3166, 0x3186,
-  0x3187, 0x31a7, 0x3186, 0x3187, 0x3186, 0x3186, 0x39a7, 0x31a7,
-  0x3186, 0x3186, 0x3186, 0x31a6, 0x3186, 0x3186, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31a7, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x39c7,
-  0x39c7, 0x39c7, 0x39e8, 0x39e8, 0x31c7, 0x4229, 0x528a, 0x4a6a,
-  0x4209, 0x4229, 0x4229, 0x4249, 0x4249, 0x4249, 0x4a6a, 0x426a,
-  0x4a8a, 0x4aab, 0x428a, 0x4aab, 0x4aab, 0x52ec, 0x52ec, 0x4acb,
-  0x634d, 0x5b2d, 0x52cb, 0x4aab, 0x428a, 0x426a, 0x424a, 0x426a,
-  0x426a, 0x3a49, 0x3a49, 0x3a49, 0x3a29, 0x3a29, 0x3a08, 0x3a08,
-  0x3a29, 0x3208, 0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x426a, 0x426a,
-  0x428a, 0x428a, 0x428a, 0x42ab, 0x42cb, 0x42cb, 0x4aec, 0x430c,
-  0x432d, 0x4b4d, 0x4b6d, 0x4b8e, 0x53cf, 0x53f0, 0x5c51, 0x6492,
-  0x6cd3, 0x7534, 0x8595, 0x8dd6, 0x9638, 0xa699, 0xb71a, 0xbf7b,
-  0xd7bb, 0xe7fc, 0xfffe, 0xefdd, 0xe7fc, 0xe7bc, 0xd75b, 0xae99,
-  0xb6b9, 0xc6b9, 0xc6b9, 0x8575, 0x8d96, 0x9575, 0x7d13, 0x7d13,
-  0x9553, 0x8d13, 0x84f2, 0x84d2, 0x7c91, 0x7c71, 0x7c30, 0xad54,
-  0xded8, 0xf7bb, 0xdeb8, 0xde98, 0xce36, 0xce36, 0xd677, 0xd677,
-  0xc5f5, 0xbdb4, 0x8c50, 0x8470, 0x530c, 0x3209, 0x842f, 0xa4f1,
-  0x9cd1, 0x634c, 0x3a29, 0x3a09, 0x4a8a, 0x52aa, 0x4269, 0x636d,
-  0x73ad, 0x31e8, 0x31e8, 0x4aaa, 0x4249, 0x4aaa, 0x4a8a, 0x4aaa,
-  0x4a69, 0x4aaa, 0x5aeb, 0x52eb, 0x5aeb, 0x52eb, 0x52cb, 0x52eb,
-  0x52eb, 0x52eb, 0x52cb, 0x52cb, 0x52eb, 0x52cb, 0x4aab, 0x4aaa,
-  0x4aaa, 0x4aaa, 0x4aab, 0x52cb, 0x52cb, 0x4249, 0x4a8a, 0x4a6a,
-  0x4a69, 0x4249, 0x4a69, 0x4269, 0x4229, 0x4249, 0x4229, 0x4249,
-  0x4249, 0x4249, 0x4a69, 0x4228, 0x3a08, 0x4229, 0x39e8, 0x39e8,
-  0x39e7, 0x39e8, 0x4249, 0x4228, 0x3a08, 0x4a69, 0x4229, 0x4228,
-  0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x39c7, 0x31c7, 0x31a7, 0x31c7,
-  0x31a7, 0x3187, 0x31a7, 0x31c7, 0x39e8, 0x3a08, 0x3a08, 0x3a08,
-  0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39c7, 0x39a7, 0x3187, 0x39a7,
-  0x39a7, 0x4208, 0x39a7, 0x3186, 0x3987, 0x3166, 0x3987, 0x3187,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x3186, 0x3186,
-  0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3186, 0x3186, 0x39a7,
-  0x3186, 0x3186, 0x3187, 0x3186, 0x3186, 0x31a7, 0x3187, 0x3187,
-  0x31a7, 0x31a7, 0x31c7, 0x31a7, 0x31c7, 0x31a7, 0x31a7, 0x39c8,
-  0x39e8, 0x39e8, 0x4209, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x3a29,
-  0x4229, 0x3a29, 0x4229, 0x426a, 0x424a, 0x424a, 0x4a8b, 0x424a,
-  0x426a, 0x4a8b, 0x4aab, 0x52ec, 0x5b2d, 0x4aab, 0x530c, 0x52cb,
-  0x5b2d, 0x636e, 0x6b8e, 0x5b0d, 0x4a8a, 0x4a8a, 0x4a6a, 0x426a,
-  0x426a, 0x424a, 0x4229, 0x3a29, 0x3a29, 0x31e8, 0x3a08, 0x3a09,
-  0x3a08, 0x3a29, 0x3a29, 0x3a29, 0x4249, 0x3a49, 0x3a4a, 0x426a,
-  0x428a, 0x3a8a, 0x42ab, 0x42cb, 0x42ab, 0x42cb, 0x42ec, 0x42ec,
-  0x430c, 0x4b4d, 0x4b4d, 0x4b8e, 0x53cf, 0x5bf0, 0x5c30, 0x6471,
-  0x6cd2, 0x7534, 0x8575, 0x8dd6, 0x9638, 0x9e99, 0xaefa, 0xbf5b,
-  0xcf9b, 0xe7fc, 0xfffe, 0xefdd, 0xe7fd, 0xdfbc, 0xd75b, 0xb6da,
-  0xae99, 0xbe98, 0xc699, 0x8d96, 0x8575, 0x9595, 0x7d13, 0x7d13,
-  0x9554, 0x84d2, 0x84d2, 0x7cb1, 0x7451, 0x7c71, 0x94f2, 0xa553,
-  0xded8, 0xf79b, 0xd697, 0xde97, 0xde98, 0xc5f6, 0xce16, 0xde77,
-  0xce16, 0xb574, 0x9491, 0x7c0f, 0x4acb, 0x3209, 0x9491, 0x9cb0,
-  0x7bad, 0x7bef, 0x840f, 0x3a28, 0x4aaa, 0x5aeb, 0x52cb, 0x4a89,
-  0x7bce, 0x3a09, 0x31e8, 0x634c, 0x52aa, 0x52cb, 0x52cb, 0x52eb,
-  0x52cb, 0x52cb, 0x52cb, 0x52cb, 0x52cb, 0x52eb, 0x5aec, 0x52cb,
-  0x52cb, 0x5b0c, 0x52eb, 0x4aab, 0x52ec, 0x52cb, 0x4aab, 0x4a8a,
-  0x4aab, 0x4aaa, 0x4249, 0x4aaa, 0x4aaa, 0x4a8a, 0x4229, 0x4a8a,
-  0x4249, 0x4a69, 0x4a49, 0x4a49, 0x4249, 0x4249, 0x4229, 0x4229,
-  0x4249, 0x4269, 0x4269, 0x4249, 0x4229, 0x3a08, 0x3a08, 0x39e8,
-  0x39e8, 0x39e8, 0x4229, 0x4249, 0x39e7, 0x4229, 0x4228, 0x39e7,
-  0x39e8, 0x39c7, 0x39e8, 0x39c7, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x39c7, 0x39c7, 0x39e8, 0x3a08, 0x3a08, 0x4229,
-  0x4249, 0x31c7, 0x39e8, 0x31c7, 0x39a7, 0x39a7, 0x39a7, 0x3187,
-  0x31a7, 0x39a7, 0x39a7, 0x3987, 0x3187, 0x3187, 0x3166, 0x3987,
-  0x3186, 0x3186, 0x3166, 0x3186, 0x3166, 0x3166, 0x3186, 0x3166,
-  0x3186, 0x3166, 0x3186, 0x3166, 0x3166, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x31a7, 0x31a7, 0x3187, 0x3186, 0x3187, 0x31a7,
-  0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x31a7, 0x31c8, 0x31c8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a29, 0x3a08, 0x3a08, 0x4249,
-  0x4249, 0x424a, 0x4229, 0x426a, 0x426a, 0x428b, 0x426a, 0x426a,
-  0x426a, 0x4aac, 0x4aab, 0x52cc, 0x52ec, 0x52ec, 0x52ec, 0x5b2d,
-  0x52ec, 0x5b2d, 0x52cb, 0x4aab, 0x4aab, 0x4a8b, 0x4aab, 0x4249,
-  0x426a, 0x426a, 0x426a, 0x424a, 0x3a09, 0x3a08, 0x3a09, 0x3a08,
-  0x3a08, 0x3a08, 0x3a29, 0x3a49, 0x4269, 0x426a, 0x426a, 0x426a,
-  0x428a, 0x428b, 0x42ab, 0x42ab, 0x42ab, 0x42ab, 0x42ec, 0x42ec,
-  0x430c, 0x432d, 0x4b4d, 0x4b6e, 0x53af, 0x53cf, 0x5c10, 0x6471,
-  0x6cb2, 0x74f3, 0x7d55, 0x85d6, 0x9617, 0x9e79, 0xaefa, 0xbf5b,
-  0xcf9b, 0xe7fc, 0xfffe, 0xf7fd, 0xeffd, 0xe7bc, 0xcf3b, 0xb6da,
-  0xae99, 0xb658, 0xc699, 0x8db6, 0x8555, 0x9db5, 0x8534, 0x7d13,
-  0x9554, 0x84d2, 0x84d2, 0x84d2, 0x7471, 0x7451, 0xa574, 0xa554,
-  0xded8, 0xf77a, 0xdeb7, 0xdeb8, 0xde97, 0xce16, 0xce16, 0xd656,
-  0xce36, 0xad32, 0x844f, 0x7bef, 0x4acb, 0x3229, 0x7c0f, 0x83ce,
-  0x736d, 0x5aeb, 0xa4f2, 0x5b2c, 0x4a8a, 0x6b8d, 0x52eb, 0x4a69,
-  0x7b8d, 0x4a6a, 0x31e8, 0x5b2c, 0x52aa, 0x52aa, 0x4a8a, 0x4aaa,
-  0x5aeb, 0x52eb, 0x52eb, 0x52cb, 0x5aeb, 0x52cb, 0x5b0c, 0x52eb,
-  0x52eb, 0x52cb, 0x5aec, 0x4aab, 0x4a8a, 0x4aaa, 0x4aab, 0x4aab,
-  0x4a6a, 0x4249, 0x4269, 0x4aaa, 0x4a8a, 0x4269, 0x4a6a, 0x4a69,
-  0x4249, 0x4a49, 0x3a08, 0x4229, 0x4208, 0x4208, 0x3a08, 0x4208,
-  0x4229, 0x5b0c, 0x8450, 0x31c7, 0x4228, 0x4249, 0x31c7, 0x39e8,
-  0x39c7, 0x31c7, 0x39c7, 0x4229, 0x39e7, 0x3a08, 0x39c7, 0x39c7,
-  0x39e7, 0x39e7, 0x31c7, 0x31a7, 0x31a7, 0x31a7, 0x3186, 0x3186,
-  0x31a7, 0x31a7, 0x39c7, 0x31c7, 0x39e8, 0x39e8, 0x4229, 0x3a08,
-  0x39e7, 0x31c7, 0x39c7, 0x31c7, 0x39a7, 0x3187, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3186, 0x3166, 0x3166, 0x3987, 0x3166, 0x3186,
-  0x3186, 0x3166, 0x3166, 0x3166, 0x3186, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3186, 0x3166, 0x39a7, 0x3186, 0x39a7, 0x31a7,
-  0x31a7, 0x3186, 0x31a7, 0x3186, 0x31a7, 0x31a7, 0x31a7, 0x31a7,
-  0x31a7, 0x31a7, 0x31c7, 0x31c7, 0x31c7, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a09, 0x4229, 0x4229, 0x3a09, 0x3a09, 0x3a29,
-  0x4249, 0x424a, 0x424a, 0x424a, 0x426a, 0x4a8b, 0x4a8b, 0x4a8b,
-  0x4aab, 0x4aab, 0x52cc, 0x52cc, 0x52cc, 0x5b0d, 0x5b4d, 0x5b2d,
-  0x5b2d, 0x5b4d, 0x52ec, 0x52cc, 0x4a8b, 0x426a, 0x424a, 0x424a,
-  0x424a, 0x3a29, 0x3a29, 0x3a09, 0x3a08, 0x3a08, 0x3a08, 0x3a08,
-  0x3a08, 0x3a08, 0x31e8, 0x3a29, 0x3a29, 0x3a49, 0x3a49, 0x3a49,
-  0x426a, 0x3a6a, 0x426a, 0x428a, 0x42aa, 0x42ab, 0x42ec, 0x42ec,
-  0x430c, 0x432d, 0x4b4d, 0x4b6e, 0x4bae, 0x53cf, 0x5c10, 0x6451,
-  0x6492, 0x6cf3, 0x7d54, 0x85b6, 0x8e17, 0x9e78, 0xa6d9, 0xbf3b,
-  0xcf9b, 0xdfdc, 0xf7fe, 0xf7fe, 0xeffd, 0xe7bc, 0xd75b, 0xbf1a,
-  0xa699, 0xb679, 0xbe99, 0x95b6, 0x7d34, 0x9595, 0x8554, 0x74f3,
-  0x9554, 0x7cb2, 0x7cb2, 0x84d2, 0x84d2, 0x7451, 0x8cb2, 0xa533,
-  0xdeb8, 0xf77a, 0xdeb7, 0xe6f8, 0xd697, 0xbdb4, 0xd677, 0xd676,
-  0xce36, 0x9cf2, 0x8c50, 0x7bce, 0x4aab, 0x3a4a, 0x52ab, 0x7bce,
-  0x9470, 0x840f, 0x7bce, 0x52cb, 0x4a8a, 0x634c, 0x42aa, 0x6b4c,
-  0xb533, 0x6b8d, 0x29c7, 0x4aca, 0x5b0c, 0x4aaa, 0x52ab, 0x5aec,
-  0x4aaa, 0x52eb, 0x52cb, 0x52cb, 0x5b0c, 0x52eb, 0x5b2c, 0x52eb,
-  0x52cb, 0x52cb, 0x5b2c, 0x4aaa, 0x4aaa, 0x428a, 0x4a8a, 0x4269,
-  0x4249, 0x4249, 0x4aab, 0x4aaa, 0x4a8a, 0x4269, 0x4249, 0x4249,
-  0x4228, 0x3a08, 0x4228, 0x4229, 0x4229, 0x3a08, 0x4229, 0x3a08,
-  0x3a08, 0x4249, 0x5b0c, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39c7,
-  0x39c7, 0x31a7, 0x39c7, 0x39c7, 0x4208, 0x39e8, 0x39e8, 0x31c7,
-  0x39c7, 0x39c7, 0x39c7, 0x31c7, 0x31a6, 0x3186, 0x3186, 0x31a6,
-  0x39c7, 0x39e8, 0x3a08, 0x31c7, 0x39e8, 0x4228, 0x39e8, 0x39e8,
-  0x31a7, 0x39c7, 0x31a6, 0x3186, 0x3166, 0x3166, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3166, 0x3186, 0x3986, 0x3166, 0x3186, 0x3186,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x3166, 0x3186, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186, 0x3187,
-  0x3187, 0x31a7, 0x3187, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31c7,
-  0x31c7, 0x31c8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a09, 0x3a09, 0x3a09, 0x3a29, 0x3a29, 0x4229, 0x424a,
-  0x426a, 0x424a, 0x426a, 0x426a, 0x428a, 0x4acb, 0x4aab, 0x4a8b,
-  0x4aab, 0x4aab, 0x530c, 0x52ec, 0x5b0d, 0x5b0d, 0x5b0d, 0x5b0d,
-  0x52ec, 0x52cb, 0x52ec, 0x52cc, 0x426a, 0x4a8a, 0x4249, 0x4249,
-  0x3a29, 0x3a29, 0x3a08, 0x3a29, 0x3a08, 0x31e8, 0x31e8, 0x3a08,
-  0x39e8, 0x3a08, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29,
-  0x3a49, 0x3a49, 0x426a, 0x428b, 0x42ab, 0x42cb, 0x42cb, 0x42ec,
-  0x430c, 0x430c, 0x4b4d, 0x4b6e, 0x4b8e, 0x53af, 0x5bf0, 0x6451,
-  0x6492, 0x6cd3, 0x7534, 0x8596, 0x8df7, 0x9658, 0xa6b9, 0xb71a,
-  0xc79b, 0xd7dc, 0xf7fe, 0xfffe, 0xeffc, 0xefdd, 0xcf5b, 0xc73b,
-  0xae99, 0xb699, 0xbe99, 0x9df6, 0x74f3, 0x8534, 0x8534, 0x74d3,
-  0x8d34, 0x8cf3, 0x7cb2, 0x8cb2, 0x8cd2, 0x6c30, 0x7c51, 0x9cf3,
-  0xd698, 0xf77a, 0xdeb7, 0xe6f8, 0xd677, 0xb594, 0xde97, 0xd676,
-  0xc5d5, 0x9cb1, 0xa512, 0x9491, 0x4aab, 0x3a6a, 0x4a8b, 0x8c2f,
-  0x9cb0, 0xad32, 0x83ee, 0x428a, 0x4aab, 0x73ae, 0x3a6a, 0x7bef,
-  0xd635, 0x7c0e, 0x29a7, 0x4aca, 0x52cb, 0x52ab, 0x52cb, 0x4aaa,
-  0x4269, 0x52cb, 0x52cb, 0x52cb, 0x52eb, 0x5b0c, 0x5b2c, 0x5b0c,
-  0x5b0c, 0x5b0c, 0x5b2c, 0x4aaa, 0x52cb, 0x4a8a, 0x4a6a, 0x4a6a,
-  0x4249, 0x4a8a, 0x52ab, 0x4aaa, 0x4a8a, 0x4a6a, 0x4229, 0x3a08,
-  0x4229, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39e8, 0x3a08,
-  0x3a28, 0x3a28, 0x3a28, 0x4229, 0x4228, 0x39e7, 0x39e7, 0x31c7,
-  0x39c7, 0x31c7, 0x39c7, 0x39c7, 0x39e7, 0x39e8, 0x39e8, 0x39c7,
-  0x39e7, 0x31c7, 0x39c7, 0x3186, 0x3186, 0x3186, 0x3186, 0x31a7,
-  0x39c7, 0x39e8, 0x4208, 0x39e8, 0x4208, 0x4208, 0x39e8, 0x39a7,
-  0x31a7, 0x39a7, 0x39a7, 0x3186, 0x3186, 0x3166, 0x3166, 0x3186,
-  0x3166, 0x3166, 0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3186, 0x39a7, 0x3166, 0x3186, 0x3166,
-  0x3186, 0x3186, 0x39c7, 0x3166, 0x3166, 0x3166, 0x3166, 0x39a7,
-  0x31a7, 0x3186, 0x3186, 0x3187, 0x39a7, 0x31a7, 0x31a7, 0x31c7,
-  0x31c8, 0x39c8, 0x39e8, 0x39c8, 0x31c8, 0x39c8, 0x39e8, 0x39e8,
-  0x39e8, 0x3a09, 0x3a09, 0x3a09, 0x3a29, 0x4229, 0x4229, 0x424a,
-  0x426a, 0x426a, 0x426a, 0x4aab, 0x5b0d, 0x5b0d, 0x52cc, 0x52ec,
-  0x52ec, 0x4acb, 0x530c, 0x52ec, 0x530c, 0x5b0d, 0x530c, 0x530c,
-  0x5b2d, 0x52cb, 0x52ec, 0x52cc, 0x52cc, 0x4a8a, 0x426a, 0x4249,
-  0x3a29, 0x3a29, 0x3a09, 0x3a29, 0x3a08, 0x31e8, 0x31e8, 0x31e8,
-  0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a08, 0x426a, 0x3a29, 0x4249,
-  0x424a, 0x3a49, 0x428a, 0x3a8a, 0x3a8a, 0x42ab, 0x42cb, 0x42cb,
-  0x42ec, 0x430c, 0x4b2d, 0x4b4e, 0x4b8e, 0x53af, 0x53ef, 0x5c31,
-  0x6472, 0x6cb2, 0x7514, 0x7d75, 0x8dd7, 0x9638, 0x9e99, 0xb6fa,
-  0xc77b, 0xd7dc, 0xf7fe, 0xfffe, 0xeffd, 0xefdd, 0xd77b, 0xcf5b,
-  0xb6b9, 0xb678, 0xc699, 0xa616, 0x7513, 0x74d3, 0x8513, 0x7cf3,
-  0x8513, 0x8d33, 0x84b2, 0x9533, 0x8cd2, 0x6c30, 0x84b2, 0x8c71,
-  0xce77, 0xef7a, 0xdeb7, 0xe719, 0xd677, 0xb5b4, 0xce77, 0xde97,
-  0xbd94, 0x8c50, 0xc5f6, 0x9cd2, 0x42ab, 0x42ab, 0x4a8a, 0x9470,
-  0xbd93, 0xce15, 0xc5b5, 0x5aec, 0x426a, 0x634d, 0x3a29, 0x73ce,
-  0xb552, 0x5aeb, 0x31c8, 0x5b0c, 0x4a8a, 0x5aec, 0x52cb, 0x52cb,
-  0x4a8a, 0x52eb, 0x5b0b, 0x5aeb, 0x634d, 0x634d, 0x6bae, 0x52eb,
-  0x52cb, 0x52ec, 0x5b2d, 0x4aab, 0x4a8a, 0x426a, 0x426a, 0x4a8a,
-  0x4249, 0x4249, 0x4249, 0x4aaa, 0x4aaa, 0x4249, 0x4228, 0x4208,
-  0x4229, 0x4208, 0x4208, 0x4208, 0x39e8, 0x39e8, 0x4208, 0x3a08,
-  0x3a08, 0x39e8, 0x4229, 0x4229, 0x3a08, 0x39c7, 0x39c7, 0x39c7,
-  0x39e7, 0x31a7, 0x39c7, 0x39a7, 0x39c7, 0x39c7, 0x39c7, 0x31a7,
-  0x39c7, 0x39a7, 0x31a7, 0x3186, 0x31a7, 0x3186, 0x39c7, 0x39c7,
-  0x39a7, 0x39e8, 0x4208, 0x4208, 0x4229, 0x39c7, 0x39e8, 0x39e8,
-  0x39c7, 0x39c7, 0x31a7, 0x3186, 0x3186, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3146, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x31a7, 0x31a7, 0x39a7, 0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x31c7,
-  0x39e8, 0x39e8, 0x31c8, 0x31c7, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x3a09, 0x4229, 0x4249, 0x426a, 0x424a, 0x426a,
-  0x424a, 0x428a, 0x4a8b, 0x4aab, 0x4acc, 0x52ec, 0x5b2d, 0x5b0d,
-  0x5b0d, 0x52cc, 0x5b0d, 0x530d, 0x5b0d, 0x5b2d, 0x52ec, 0x52ec,
-  0x530c, 0x52ec, 0x52ec, 0x52cb, 0x52cc, 0x426a, 0x4249, 0x4229,
-  0x4249, 0x4249, 0x3a29, 0x3a09, 0x3a08, 0x39e8, 0x39e8, 0x31c8,
-  0x39e8, 0x39e8, 0x31e8, 0x31e8, 0x3a09, 0x3a08, 0x3a29, 0x4249,
-  0x424a, 0x426a, 0x3a6a, 0x3a6a, 0x428a, 0x42ab, 0x42ab, 0x42cb,
-  0x42cc, 0x430c, 0x4b2d, 0x4b4d, 0x4b6e, 0x538e, 0x53ef, 0x5c31,
-  0x6451, 0x6cb2, 0x6cf3, 0x7d55, 0x85b6, 0x9637, 0x9e98, 0xaefa,
-  0xbf7b, 0xcfbb, 0xeffd, 0xfffe, 0xeffc, 0xeffd, 0xd77b, 0xc73b,
-  0xbefa, 0xbeb9, 0xced9, 0xae37, 0x7d54, 0x74d3, 0x8d54, 0x8534,
-  0x7cd2, 0x9554, 0x84d2, 0x94f2, 0x9513, 0x7451, 0x8491, 0x8471,
-  0xce57, 0xef7a, 0xded8, 0xe6f8, 0xce56, 0xb573, 0xbdb4, 0xde97,
-  0xb574, 0x9470, 0xad54, 0x9cd2, 0x5b2d, 0x3a8a, 0x426a, 0x944f,
-  0xde76, 0xde97, 0xce16, 0x634c, 0x426a, 0x4a89, 0x3a29, 0x52eb,
-  0xa512, 0x3a28, 0x29c8, 0x52eb, 0x52ab, 0x4aaa, 0x5b0c, 0x632d,
-  0x5b2c, 0x634d, 0x632c, 0x52aa, 0x52cb, 0x52cb, 0x52aa, 0x52cb,
-  0x52cb, 0x4a8a, 0x4a8a, 0x4a8a, 0x4a8a, 0x4aab, 0x4a6a, 0x4249,
-  0x4249, 0x4249, 0x3a28, 0x4249, 0x4249, 0x4249, 0x4229, 0x4208,
-  0x4208, 0x4249, 0x4229, 0x4208, 0x4229, 0x4229, 0x4229, 0x4228,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x31c7, 0x39a7, 0x39c7, 0x39a7, 0x39c7, 0x39c7, 0x39a7, 0x39c7,
-  0x39c7, 0x39a7, 0x31a7, 0x39c7, 0x39a7, 0x4a49, 0x41e8, 0x39e7,
-  0x41e8, 0x41e8, 0x4a29, 0x4208, 0x39e8, 0x39e8, 0x39c7, 0x39c7,
-  0x31a7, 0x31a7, 0x31a6, 0x3186, 0x3186, 0x3166, 0x3146, 0x3166,
-  0x3146, 0x3186, 0x39a7, 0x3166, 0x3166, 0x3146, 0x3966, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3186, 0x3166, 0x3186, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3186, 0x3987, 0x3186, 0x3166, 0x3986, 0x3186,
-  0x3186, 0x31a7, 0x39a7, 0x39c7, 0x31a7, 0x31a7, 0x31c7, 0x31c8,
-  0x39e8, 0x31c8, 0x39c8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a09,
-  0x3a08, 0x3a29, 0x4249, 0x4249, 0x4249, 0x426a, 0x426a, 0x426a,
-  0x426a, 0x4aab, 0x4aab, 0x52ec, 0x4aab, 0x52ed, 0x634e, 0x52ec,
-  0x52ec, 0x530d, 0x5b0d, 0x52ec, 0x52ec, 0x5b0d, 0x530c, 0x5b0d,
-  0x530c, 0x52cc, 0x4aab, 0x4aab, 0x4a6a, 0x424a, 0x4249, 0x426a,
-  0x4229, 0x3a09, 0x3a09, 0x3a08, 0x39e8, 0x3a08, 0x39e8, 0x31e8,
-  0x31e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x3a29,
-  0x3a49, 0x3a49, 0x3a49, 0x428a, 0x428a, 0x428b, 0x42ab, 0x42ab,
-  0x42cc, 0x42ec, 0x4b0d, 0x4b4d, 0x4b6e, 0x4b8e, 0x53cf, 0x5c10,
-  0x6451, 0x6c92, 0x6cf3, 0x7554, 0x8596, 0x8df7, 0x9e78, 0xaeda,
-  0xbf5b, 0xcfbc, 0xe7fd, 0xfffe, 0xeffd, 0xeffd, 0xdf9c, 0xc71a,
-  0xc71a, 0xcefa, 0xced9, 0xb677, 0x7d54, 0x7cf3, 0x8d54, 0x8d34,
-  0x7cf3, 0x9554, 0x8cf2, 0x9d53, 0x8cb2, 0x7c91, 0x7c70, 0x7c30,
-  0xbdf5, 0xf77a, 0xe6f8, 0xe6d8, 0xd697, 0xb594, 0xad53, 0xe6b8,
-  0xb574, 0x9cd2, 0x9cb1, 0xa4d2, 0x6b6d, 0x42ab, 0x530c, 0x736c,
-  0xde76, 0xdeb7, 0xa512, 0x6bce, 0x4a8a, 0x52cb, 0x3a29, 0x4249,
-  0x9470, 0x4269, 0x29c8, 0x52eb, 0x52cb, 0x4a69, 0x5b2c, 0x634d,
-  0x7c30, 0x5b0b, 0x4aaa, 0x4269, 0x4a8a, 0x4aaa, 0x52cb, 0x4a8a,
-  0x4a8a, 0x4aaa, 0x4a8a, 0x4249, 0x4a8a, 0x4a6a, 0x4249, 0x4a6a,
-  0x4229, 0x4a6a, 0x4249, 0x4249, 0x4228, 0x4229, 0x4229, 0x4229,
-  0x4229, 0x4209, 0x4208, 0x4a6a, 0x4a8a, 0x4a6a, 0x4a49, 0x4a6a,
-  0x4a6a, 0x52ab, 0x73af, 0x4229, 0x39e8, 0x3a08, 0x3a08, 0x39c7,
-  0x39c7, 0x39c7, 0x39a7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39a7,
-  0x31a7, 0x39c7, 0x39c7, 0x31a7, 0x39c7, 0x4a29, 0x41e8, 0x4229,
-  0x39c7, 0x39e8, 0x39e8, 0x4208, 0x39e8, 0x39a7, 0x39c7, 0x39a7,
-  0x31a7, 0x31a7, 0x3186, 0x3166, 0x3166, 0x3166, 0x3145, 0x3146,
-  0x3166, 0x3146, 0x3166, 0x3166, 0x3166, 0x3146, 0x3166, 0x3146,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3987,
-  0x3186, 0x31a7, 0x31a7, 0x31a7, 0x39a7, 0x31a7, 0x39e8, 0x39c8,
-  0x31c8, 0x31c8, 0x39c8, 0x39e8, 0x31e8, 0x31e8, 0x39e8, 0x3a09,
-  0x3a29, 0x3a29, 0x4229, 0x4a6a, 0x4a8a, 0x4aab, 0x4a8a, 0x4a8b,
-  0x4aab, 0x52cc, 0x4acc, 0x530d, 0x4aab, 0x5b2d, 0x5b4e, 0x52ec,
-  0x530d, 0x5b0d, 0x5b2d, 0x5b0d, 0x5b0d, 0x530c, 0x5b0d, 0x52cc,
-  0x4aab, 0x4aab, 0x4a8b, 0x4a8b, 0x4a8a, 0x426a, 0x426a, 0x4229,
-  0x3a29, 0x4229, 0x3a09, 0x3a08, 0x3a08, 0x4249, 0x3a09, 0x3a09,
-  0x31c7, 0x31e8, 0x3a08, 0x31c8, 0x39e8, 0x3a08, 0x3a08, 0x3a08,
-  0x3a29, 0x3a4a, 0x426a, 0x426a, 0x3a6a, 0x42ab, 0x42ab, 0x42ec,
-  0x42cb, 0x42ec, 0x430d, 0x4b4d, 0x4b4e, 0x4b6e, 0x53af, 0x53f0,
-  0x5c31, 0x6492, 0x6cd3, 0x7534, 0x7d96, 0x8df7, 0x9678, 0xa6d9,
-  0xb75b, 0xc7bc, 0xe7fd, 0xfffe, 0xf7fd, 0xe7fc, 0xdf9c, 0xc71a,
-  0xc71b, 0xd73b, 0xdf3a, 0xb678, 0x7d14, 0x7d34, 0x8d54, 0x8d34,
-  0x8513, 0x8d13, 0x9512, 0x8d12, 0x8cd2, 0x84b1, 0x84d2, 0x740f,
-  0xb5b5, 0xf77a, 0xe718, 0xe6f9, 0xce56, 0xb5b4, 0xad53, 0xdeb8,
-  0xc5d5, 0x9cd2, 0x9cb1, 0xa512, 0x7bce, 0x530c, 0x5b2d, 0x6b2c,
-  0xd656, 0xde96, 0x8c50, 0x636d, 0x52ec, 0x6b6d, 0x31e8, 0x31e8,
-  0x7c0e, 0x52ab, 0x31e8, 0x52eb, 0x4acb, 0x4a8a, 0x5b0c, 0x52cb,
-  0x4aaa, 0x4a69, 0x4269, 0x4269, 0x4249, 0x4a8a, 0x52cb, 0x4a8a,
-  0x4a69, 0x4a69, 0x4a8a, 0x4269, 0x4249, 0x4a6a, 0x4269, 0x4269,
-  0x4249, 0x4a6a, 0x4229, 0x4249, 0x3a08, 0x4229, 0x4208, 0x4208,
-  0x4209, 0x39e8, 0x4208, 0x4a69, 0x528a, 0x4a69, 0x4a69, 0x4a6a,
-  0x4249, 0x5aec, 0x8430, 0x5b0b, 0x4228, 0x3a08, 0x3a08, 0x39e8,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x39c7, 0x39c7, 0x39a7,
-  0x39c7, 0x39c7, 0x39a7, 0x4208, 0x39c7, 0x4a49, 0x39c7, 0x39e8,
-  0x39e7, 0x39e7, 0x39e8, 0x39c7, 0x39c7, 0x39a7, 0x3187, 0x3187,
-  0x3187, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146,
-  0x3166, 0x3166, 0x3146, 0x3166, 0x3186, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x3146, 0x3186, 0x3166, 0x3166, 0x3166, 0x3187,
-  0x39a7, 0x31a7, 0x39e8, 0x31a7, 0x31a7, 0x31a7, 0x31e8, 0x39e8,
-  0x31e8, 0x31c8, 0x31c8, 0x39e8, 0x31e8, 0x3a08, 0x39e8, 0x3a29,
-  0x3a29, 0x3a29, 0x4a49, 0x4a49, 0x4a8a, 0x4a8a, 0x52cc, 0x52cb,
-  0x52cc, 0x4acc, 0x52ec, 0x52ec, 0x52ec, 0x5b0d, 0x5b0d, 0x5b2d,
-  0x532d, 0x5b2d, 0x5b0d, 0x6bae, 0x5b4d, 0x634d, 0x5b0c, 0x52cc,
-  0x4a8a, 0x4a8a, 0x4a8b, 0x4a6a, 0x4a6a, 0x426a, 0x426a, 0x3a29,
-  0x3a08, 0x4229, 0x3a08, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x3a08,
-  0x31e8, 0x31c7, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x3a29, 0x3a29,
-  0x3a29, 0x3a49, 0x4249, 0x428a, 0x428a, 0x428a, 0x42ab, 0x42ab,
-  0x42cb, 0x42cc, 0x430c, 0x4b2d, 0x4b4d, 0x4b6e, 0x53af, 0x53f0,
-  0x5c31, 0x6471, 0x64b2, 0x7513, 0x7d75, 0x85f7, 0x9657, 0xa6b9,
-  0xb73b, 0xc79b, 0xdffc, 0xfffe, 0xf7fe, 0xe7dd, 0xdfbc, 0xc73b,
-  0xbf1b, 0xd73a, 0xdf5a, 0xbe78, 0x8555, 0x8554, 0x8513, 0x8d33,
-  0x8513, 0x84b2, 0xa594, 0x8cf2, 0x9513, 0x8cf2, 0x8cd2, 0x7c50,
-  0xad74, 0xef5a, 0xe6f8, 0xe6f8, 0xc5f5, 0xbdd4, 0xa532, 0xc5f5,
-  0xce15, 0xa513, 0xad53, 0xa532, 0x9cf2, 0x632c, 0x4aaa, 0x5aca,
-  0xce14, 0xd656, 0x842f, 0x5aec, 0x632c, 0x5acb, 0x39e8, 0x29c7,
-  0x634c, 0x5b2c, 0x31a7, 0x52ca, 0x4269, 0x52eb, 0x632d, 0x5b0c,
-  0x4229, 0x4aaa, 0x4aaa, 0x4249, 0x52aa, 0x4a8a, 0x4aaa, 0x4a69,
-  0x4aaa, 0x4a69, 0x4a8a, 0x4269, 0x4a8a, 0x4269, 0x4249, 0x4a8a,
-  0x4269, 0x4229, 0x4229, 0x3a29, 0x4249, 0x4229, 0x3a08, 0x4229,
-  0x3a08, 0x4208, 0x4229, 0x4a69, 0x4249, 0x4228, 0x4228, 0x4249,
-  0x4229, 0x4269, 0x634d, 0x52eb, 0x4249, 0x4228, 0x3a08, 0x39e8,
-  0x39c7, 0x39c7, 0x39c7, 0x41e8, 0x39e7, 0x39a7, 0x39e7, 0x39c7,
-  0x39c7, 0x39e7, 0x39c7, 0x39e8, 0x4208, 0x4229, 0x4a69, 0x39e7,
-  0x4208, 0x4208, 0x39e7, 0x39e8, 0x39c7, 0x31a7, 0x3186, 0x3187,
-  0x3186, 0x3186, 0x3166, 0x3166, 0x3166, 0x3146, 0x3146, 0x3146,
-  0x3166, 0x3166, 0x3166, 0x3186, 0x3986, 0x3186, 0x3146, 0x3166,
-  0x3146, 0x3146, 0x3146, 0x3166, 0x3146, 0x3166, 0x3166, 0x3146,
-  0x3145, 0x3166, 0x3166, 0x3186, 0x3166, 0x3186, 0x3186, 0x3187,
-  0x3186, 0x31a7, 0x31a7, 0x39a7, 0x39c7, 0x31a7, 0x31e8, 0x31c8,
-  0x31c8, 0x39e8, 0x31c8, 0x39e8, 0x31e8, 0x3a08, 0x3a08, 0x3a29,
-  0x4249, 0x4249, 0x4a6a, 0x52ab, 0x528a, 0x52ab, 0x4aab, 0x4aab,
-  0x52cc, 0x530d, 0x4acc, 0x52ec, 0x5b2d, 0x5b2d, 0x5b0d, 0x5b2d,
-  0x5b2d, 0x5b2d, 0x5b4d, 0x5b2d, 0x5b0c, 0x6b8e, 0x52ec, 0x52cb,
-  0x4aab, 0x4aab, 0x4aab, 0x426a, 0x424a, 0x426a, 0x4249, 0x3a29,
-  0x3a09, 0x3a08, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a09, 0x3a29,
-  0x3a29, 0x3a49, 0x424a, 0x426a, 0x3a6a, 0x428a, 0x42ab, 0x42ab,
-  0x42cb, 0x42cc, 0x430c, 0x4b2d, 0x4b4d, 0x4b6e, 0x4b8e, 0x53cf,
-  0x5c10, 0x6451, 0x64b2, 0x6d13, 0x7d75, 0x85d6, 0x9637, 0x9e99,
-  0xb71a, 0xc79b, 0xdfdc, 0xf7fe, 0xf7fe, 0xefdd, 0xe7bd, 0xc75b,
-  0xbf1b, 0xcf1a, 0xe75a, 0xc6b9, 0x95b6, 0x8d54, 0x84f3, 0x9554,
-  0x84f3, 0x7cb2, 0x9d53, 0x8cf3, 0x8cd2, 0x8cf2, 0x9d33, 0x8cb1,
-  0x9d13, 0xef5a, 0xe718, 0xdef8, 0xd677, 0xbdb4, 0xa512, 0xad33,
-  0xce36, 0xa512, 0xad53, 0xad32, 0xb553, 0x73ae, 0x52ab, 0x52ab,
-  0xbd93, 0xbd73, 0x7c10, 0x6b2d, 0x83cf, 0x52cb, 0x3a08, 0x29c8,
-  0x4249, 0x5b2c, 0x3a08, 0x52eb, 0x4a8a, 0x4aaa, 0x4a8a, 0x4249,
-  0x4269, 0x4a6a, 0x4a6a, 0x4a8a, 0x4aaa, 0x4a8a, 0x4a69, 0x4a8a,
-  0x4a6a, 0x4249, 0x4249, 0x4a6a, 0x4a6a, 0x4249, 0x4249, 0x4249,
-  0x4a69, 0x4a8a, 0x4269, 0x4229, 0x3a08, 0x39e8, 0x39e8, 0x3a08,
-  0x3a08, 0x4229, 0x4a49, 0x4229, 0x4228, 0x3a08, 0x4208, 0x4229,
-  0x4208, 0x4229, 0x4aaa, 0x52ab, 0x4249, 0x4249, 0x39e8, 0x39e7,
-  0x39e8, 0x39e8, 0x39c7, 0x41e8, 0x39e7, 0x39a7, 0x39c7, 0x39c7,
-  0x39c7, 0x41e8, 0x39e8, 0x4228, 0x39c7, 0x4208, 0x39e7, 0x39c7,
-  0x4208, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39a7, 0x3187, 0x3187,
-  0x3187, 0x3186, 0x3166, 0x3146, 0x3146, 0x3166, 0x3146, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3166, 0x3146,
-  0x3146, 0x3166, 0x3146, 0x3166, 0x3166, 0x3146, 0x3146, 0x3145,
-  0x3166, 0x3166, 0x3146, 0x3146, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x39c7, 0x3186, 0x3187, 0x39e8, 0x39c7, 0x31a7, 0x31c7, 0x31a7,
-  0x31c8, 0x39e8, 0x31c8, 0x39e8, 0x3a08, 0x3a09, 0x3a29, 0x4249,
-  0x4249, 0x424a, 0x4a6a, 0x52ab, 0x52ab, 0x52cc, 0x52cb, 0x52ec,
-  0x52ec, 0x52ec, 0x5b0d, 0x5b4d, 0x5b4e, 0x6baf, 0x6baf, 0x5b2d,
-  0x530d, 0x5b2d, 0x634d, 0x5b0d, 0x52ec, 0x52cc, 0x52cc, 0x52ec,
-  0x52cb, 0x4aab, 0x4a6a, 0x426a, 0x426a, 0x424a, 0x424a, 0x3a09,
-  0x3a09, 0x4229, 0x3a08, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8,
-  0x31c7, 0x31c8, 0x39c8, 0x31c8, 0x39e8, 0x39e8, 0x39e8, 0x3a29,
-  0x3a29, 0x3a49, 0x4249, 0x426a, 0x3a6a, 0x428a, 0x42ab, 0x42ab,
-  0x42ab, 0x42cb, 0x42ec, 0x430d, 0x4b2d, 0x4b4d, 0x4b8e, 0x53af,
-  0x5410, 0x5c31, 0x6472, 0x6cf3, 0x7d55, 0x85b6, 0x8e17, 0x9e98,
-  0xaf1a, 0xc77b, 0xdfdc, 0xf7fe, 0xfffe, 0xefdd, 0xe7bc, 0xcf5b,
-  0xbf1b, 0xcf1a, 0xe77b, 0xcef9, 0x9dd6, 0x8554, 0x7cf3, 0x8d34,
-  0x8514, 0x7cd3, 0x8cd2, 0x84b1, 0x84b1, 0x9513, 0x8cd1, 0x9512,
-  0x8c91, 0xef39, 0xe719, 0xded8, 0xded8, 0xd677, 0xad53, 0x9cd2,
-  0xbdf5, 0xad52, 0xa511, 0xad32, 0xbd93, 0x842f, 0x52eb, 0x52ab,
-  0x9470, 0xb553, 0x6b4d, 0x736d, 0x9450, 0x5aeb, 0x4249, 0x31e8,
-  0x31c8, 0x3a09, 0x4a8a, 0x52eb, 0x4aaa, 0x4a8a, 0x4269, 0x4a8a,
-  0x4a8a, 0x4a69, 0x4a8a, 0x52cb, 0x4aab, 0x4aaa, 0x4aaa, 0x4229,
-  0x4a6a, 0x4a8a, 0x4269, 0x4249, 0x4229, 0x4249, 0x4249, 0x4249,
-  0x4249, 0x4a6a, 0x4249, 0x4229, 0x39e8, 0x3a08, 0x39e8, 0x3a08,
-  0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x3a08, 0x3a08, 0x4228,
-  0x4208, 0x4a69, 0x52cb, 0x4a69, 0x4249, 0x4209, 0x3a08, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39a7, 0x39c7, 0x41e7,
-  0x41e8, 0x41e7, 0x39e7, 0x39e8, 0x39e8, 0x39e8, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39e8, 0x4208, 0x39a7, 0x3187,
-  0x3186, 0x3186, 0x3166, 0x3146, 0x3166, 0x3146, 0x3166, 0x3166,
-  0x3146, 0x3166, 0x3187, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3146, 0x3166, 0x3146, 0x3166, 0x3146, 0x3166, 0x3166, 0x3146,
-  0x3145, 0x3145, 0x3166, 0x3146, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x39a7, 0x3186, 0x31a7, 0x31a7, 0x3187, 0x3186, 0x31c7, 0x39c8,
-  0x31c7, 0x31c8, 0x31e8, 0x39e8, 0x39e8, 0x3a09, 0x3a09, 0x4229,
-  0x4249, 0x426a, 0x4a8a, 0x52ab, 0x52ab, 0x52cb, 0x5b0d, 0x5b0c,
-  0x5b0d, 0x636e, 0x5b2d, 0x5b2d, 0x5b2d, 0x634e, 0x636e, 0x634e,
-  0x6baf, 0x5b0d, 0x52ec, 0x52ec, 0x52cc, 0x52cc, 0x52cc, 0x4a6a,
-  0x4a8a, 0x426a, 0x424a, 0x424a, 0x424a, 0x424a, 0x424a, 0x4229,
-  0x3a08, 0x4209, 0x3a09, 0x3a08, 0x3a08, 0x39e8, 0x39c8, 0x39e8,
-  0x31c8, 0x39e8, 0x31c8, 0x39e8, 0x39c8, 0x39e8, 0x3a08, 0x3a09,
-  0x3a29, 0x3a49, 0x3a49, 0x3a4a, 0x426a, 0x3a6a, 0x42ab, 0x42ab,
-  0x3aab, 0x42ab, 0x42ec, 0x4b2d, 0x4b2d, 0x4b4d, 0x4b6e, 0x53af,
-  0x53f0, 0x5c31, 0x6492, 0x6cd3, 0x7554, 0x7db5, 0x8e17, 0x9e78,
-  0xaefa, 0xbf7b, 0xd7dc, 0xeffe, 0xfffe, 0xefdd, 0xe7bc, 0xd77c,
-  0xc71b, 0xc6fa, 0xe79b, 0xd71a, 0xa5f6, 0x8d34, 0x8514, 0x8534,
-  0x8534, 0x7cb2, 0x84d2, 0x8cf2, 0x8cf2, 0x9533, 0x8491, 0x8cd1,
-  0x8450, 0xe719, 0xef59, 0xded8, 0xdef8, 0xce56, 0xbdf5, 0xa512,
-  0xbdd5, 0xc5f5, 0xb573, 0xb552, 0xad11, 0x94b1, 0x5b0c, 0x4a8b,
-  0x6b4c, 0xa512, 0x6b6d, 0xa4f2, 0xb532, 0x632c, 0x4269, 0x3208,
-  0x31c8, 0x31c8, 0x4aab, 0x52eb, 0x4a8a, 0x4a6a, 0x4249, 0x4aaa,
-  0x4a8a, 0x4a6a, 0x52cb, 0x4a8a, 0x4aaa, 0x4a8a, 0x4a8a, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x3a08, 0x4229, 0x4a8a, 0x4249, 0x4249,
-  0x4249, 0x4249, 0x4249, 0x3a08, 0x4229, 0x3a08, 0x39e8, 0x4208,
-  0x39e8, 0x39c7, 0x39c7, 0x39e7, 0x39e8, 0x3a08, 0x3a08, 0x3a08,
-  0x4228, 0x4249, 0x4229, 0x4249, 0x4a8a, 0x4a6a, 0x39e8, 0x39e7,
-  0x39e8, 0x39c7, 0x39c7, 0x41e8, 0x39e8, 0x39c7, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7,
-  0x39a7, 0x39c7, 0x4208, 0x39e8, 0x3186, 0x3186, 0x3186, 0x3187,
-  0x3186, 0x3166, 0x3166, 0x3146, 0x3166, 0x3146, 0x3166, 0x3166,
-  0x3166, 0x3166, 0x41e8, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3966, 0x3166, 0x3146, 0x3146, 0x3166, 0x3146, 0x3146,
-  0x3166, 0x3146, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x3166, 0x3186, 0x3187, 0x31a7, 0x31a7, 0x31a7, 0x31c7, 0x31c7,
-  0x31c7, 0x31c7, 0x31c8, 0x39e8, 0x3a08, 0x3a09, 0x4249, 0x424a,
-  0x3a29, 0x426a, 0x4a8a, 0x52cc, 0x52cc, 0x5aec, 0x52ec, 0x5b2d,
-  0x632d, 0x636e, 0x634e, 0x636e, 0x636e, 0x6b8f, 0x634e, 0x6b8f,
-  0x7410, 0x5b2d, 0x52ec, 0x52cc, 0x4aab, 0x52ab, 0x4aab, 0x4a8b,
-  0x426a, 0x426a, 0x426a, 0x426a, 0x3a29, 0x4229, 0x3a09, 0x4229,
-  0x3a09, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x31c8, 0x31c8, 0x31c8, 0x39e8, 0x39e8, 0x39e8, 0x31e8, 0x39e8,
-  0x3a29, 0x3a49, 0x3a49, 0x3a4a, 0x428a, 0x428b, 0x3a8a, 0x3a8a,
-  0x3aab, 0x42ab, 0x42cb, 0x430c, 0x432d, 0x4b4d, 0x4b8e, 0x53af,
-  0x53cf, 0x5c10, 0x6471, 0x6cd2, 0x7534, 0x7d95, 0x8df7, 0x9658,
-  0xa6d9, 0xb75a, 0xcfbb, 0xeffd, 0xfffe, 0xefdd, 0xe7bc, 0xd79c,
-  0xcf3b, 0xcefa, 0xe77a, 0xdf1a, 0xae36, 0x8d34, 0x8d55, 0x7cf3,
-  0x8514, 0x7cd2, 0x84d2, 0x94f2, 0x9513, 0x9533, 0x73f0, 0x8cd2,
-  0x8491, 0xdeb9, 0xef5a, 0xdeb7, 0xdeb7, 0xc615, 0xb5b4, 0xb5b4,
-  0xb574, 0xbdb4, 0xbdb4, 0xb593, 0xad32, 0xa4f2, 0x632c, 0x4a8b,
-  0x632c, 0x8c50, 0x6b6e, 0xad32, 0xbd73, 0x738d, 0x3a29, 0x3a09,
-  0x31c8, 0x31c8, 0x4249, 0x52eb, 0x4a8a, 0x4229, 0x4229, 0x4249,
-  0x4a8a, 0x4249, 0x4a6a, 0x4a6a, 0x4aab, 0x4a8a, 0x4249, 0x4249,
-  0x4a8a, 0x4269, 0x4a69, 0x4229, 0x4229, 0x4249, 0x4a6a, 0x4a6a,
-  0x4249, 0x3a28, 0x3a08, 0x3a29, 0x4229, 0x3a08, 0x31c7, 0x31c7,
-  0x39e8, 0x3a08, 0x39e7, 0x39e8, 0x39e8, 0x3a08, 0x39e7, 0x3a08,
-  0x3a08, 0x3a08, 0x4228, 0x4208, 0x4229, 0x3a08, 0x39c7, 0x39e8,
-  0x39e8, 0x39e7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7,
-  0x39a6, 0x39a7, 0x39c7, 0x39c7, 0x39a7, 0x39a7, 0x39c7, 0x39c7,
-  0x31a7, 0x39c7, 0x41e8, 0x39e8, 0x3187, 0x3187, 0x3186, 0x3187,
-  0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3146, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3166, 0x3145,
-  0x3146, 0x3145, 0x3166, 0x3165, 0x3145, 0x3145, 0x3145, 0x3145,
-  0x3166, 0x3166, 0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x3186, 0x3187, 0x39a7, 0x31a7, 0x31a7, 0x31c7, 0x31c7,
-  0x31c8, 0x31c7, 0x39e8, 0x3a08, 0x3a09, 0x4229, 0x424a, 0x426a,
-  0x4249, 0x428a, 0x4aab, 0x4a8b, 0x52ab, 0x5b0c, 0x52ec, 0x5b2d,
-  0x6b8e, 0x634e, 0x634e, 0x6baf, 0x636e, 0x638f, 0x73d0, 0x636e,
-  0x636e, 0x52ec, 0x52ac, 0x52ec, 0x52ac, 0x4a8b, 0x426a, 0x4a6a,
-  0x426a, 0x426a, 0x426a, 0x424a, 0x3a29, 0x3a29, 0x3a29, 0x3a08,
-  0x3a09, 0x39e8, 0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39e8,
-  0x31c8, 0x31c8, 0x39e8, 0x31c7, 0x39e8, 0x3a08, 0x3a08, 0x3a09,
-  0x3a29, 0x3a29, 0x3a29, 0x3a49, 0x3a49, 0x3a6a, 0x3a6a, 0x3a8a,
-  0x428b, 0x3aab, 0x42ab, 0x42ec, 0x430c, 0x4b4d, 0x4b6e, 0x53ae,
-  0x53cf, 0x5c10, 0x6451, 0x6cb3, 0x7514, 0x7d75, 0x85d6, 0x9637,
-  0xa6b9, 0xb73a, 0xcf9b, 0xe7dd, 0xfffe, 0xf7dd, 0xe7bc, 0xdf9c,
-  0xd77b, 0xd73a, 0xe75b, 0xdf5a, 0xb677, 0x8533, 0x9554, 0x7cb2,
-  0x8513, 0x8513, 0x7491, 0x9533, 0x94f3, 0x9512, 0x7431, 0x9d34,
-  0x8cb2, 0xce57, 0xf77a, 0xdeb7, 0xd697, 0xd697, 0xc5f5, 0x9cf2,
-  0x9d12, 0xb573, 0xbdb4, 0xb553, 0xbdd5, 0xad33, 0x6b8d, 0x5aeb,
-  0x4a6a, 0x632d, 0x634d, 0x8c2f, 0xcdd5, 0x7bce, 0x4249, 0x3a29,
-  0x31c8, 0x31c8, 0x3a28, 0x4aaa, 0x4229, 0x3a28, 0x3a29, 0x4249,
-  0x4a8a, 0x4249, 0x4249, 0x52ab, 0x4a6a, 0x4a8a, 0x4a8a, 0x4a8a,
-  0x4a8a, 0x4a6a, 0x4249, 0x4229, 0x4229, 0x3a08, 0x4229, 0x4229,
-  0x4229, 0x4229, 0x4229, 0x4229, 0x4228, 0x39e7, 0x3a08, 0x39e8,
-  0x3a08, 0x3a08, 0x3a08, 0x3a08, 0x39e8, 0x3a08, 0x39e8, 0x39e8,
-  0x39e8, 0x3a08, 0x3a08, 0x4208, 0x39e8, 0x39c8, 0x39c8, 0x39c7,
-  0x39c8, 0x39c7, 0x31c7, 0x39c7, 0x39c7, 0x39c7, 0x39e7, 0x39c7,
-  0x39c7, 0x39c8, 0x41e8, 0x39a7, 0x31a7, 0x39a7, 0x39a7, 0x4a49,
-  0x39e8, 0x31a7, 0x39e8, 0x39e8, 0x3186, 0x3186, 0x3187, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3166, 0x3166, 0x39a7,
-  0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3146, 0x3986,
-  0x3166, 0x3166, 0x3146, 0x3166, 0x3145, 0x3966, 0x3166, 0x3166,
-  0x3146, 0x3966, 0x3145, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3186, 0x3186, 0x39a7, 0x3187, 0x3187, 0x31a7, 0x31a7, 0x31c8,
-  0x31c8, 0x39e8, 0x31e8, 0x3a08, 0x3a29, 0x426a, 0x424a, 0x4a8b,
-  0x426a, 0x4aab, 0x4aab, 0x52cc, 0x4aab, 0x52ec, 0x634d, 0x634e,
-  0x638e, 0x636e, 0x6baf, 0x6b8f, 0x73d0, 0x636e, 0x5b2d, 0x5b2d,
-  0x634e, 0x634e, 0x52ec, 0x5b0d, 0x5b2d, 0x52ab, 0x4aab, 0x4a6a,
-  0x4aab, 0x4a8b, 0x4aab, 0x52cc, 0x3a29, 0x4229, 0x3a09, 0x3a29,
-  0x3a08, 0x39e8, 0x39e8, 0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x39e8,
-  0x39c8, 0x39c8, 0x39e8, 0x39e8, 0x39c7, 0x39e8, 0x39e8, 0x3a08,
-  0x3a09, 0x3a09, 0x3a49, 0x3a29, 0x3a49, 0x426a, 0x3a4a, 0x3a8a,
-  0x3a8a, 0x3aab, 0x42ab, 0x42cc, 0x430c, 0x4b2d, 0x4b4d, 0x4b8e,
-  0x53cf, 0x5c10, 0x6451, 0x6cb2, 0x74f4, 0x7d55, 0x85b6, 0x9617,
-  0xa698, 0xb71a, 0xc79b, 0xdfdc, 0xf7de, 0xf7de, 0xe7dc, 0xdf9c,
-  0xd77b, 0xe77b, 0xdf5b, 0xe75a, 0xc6d8, 0x8554, 0x8d34, 0x7cf3,
-  0x8513, 0x8d33, 0x7472, 0x9554, 0x9d33, 0x7c91, 0x7451, 0xa575,
-  0x94d2, 0xbdf5, 0xf77a, 0xdef8, 0xdeb8, 0xd677, 0xc616, 0x842f,
-  0x8c50, 0xbdd5, 0xb553, 0xa4f2, 0xb553, 0xa512, 0x7bce, 0x6b4c,
-  0x4269, 0x52ec, 0x840f, 0x9490, 0xc5d4, 0x840e, 0x4a8a, 0x3a29,
-  0x31c8, 0x31c7, 0x31e8, 0x4269, 0x4a8a, 0x4269, 0x4269, 0x3a29,
-  0x4249, 0x4a6a, 0x4a69, 0x4229, 0x4249, 0x4249, 0x52cb, 0x52ab,
-  0x4249, 0x4229, 0x3a28, 0x4229, 0x4249, 0x4249, 0x4249, 0x3a29,
-  0x4249, 0x4229, 0x4269, 0x4249, 0x4229, 0x4229, 0x3a08, 0x3a08,
-  0x39e8, 0x3a08, 0x39e8, 0x3a08, 0x3a08, 0x39e7, 0x3a08, 0x39e8,
-  0x39e8, 0x3a08, 0x4208, 0x3a08, 0x39c7, 0x39c7, 0x39e8, 0x31a7,
-  0x31a7, 0x3a08, 0x31c7, 0x39e7, 0x39e8, 0x41e8, 0x39c7, 0x39c7,
-  0x41c7, 0x39c7, 0x39a7, 0x3986, 0x39a7, 0x39c7, 0x3186, 0x4a49,
-  0x630c, 0x4229, 0x41e8, 0x39a7, 0x39a7, 0x3166, 0x3186, 0x3166,
-  0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166,
-  0x3166, 0x3146, 0x3166, 0x3166, 0x3145, 0x3166, 0x3146, 0x3166,
-  0x3166, 0x3166, 0x3166, 0x3146, 0x3145, 0x3145, 0x3986, 0x3186,
-  0x3146, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3166, 0x3186,
-  0x31a6, 0x3166, 0x3187, 0x3187, 0x3186, 0x31a7, 0x39c7, 0x39c8,
-  0x31c8, 0x3a08, 0x39e8, 0x3a09, 0x4249, 0x4aab, 0x426a, 0x52ec,
-  0x52cc, 0x4aab, 0x4aab, 0x52cc, 0x52cb, 0x5b2d, 0x636e, 0x6b6e,
-  0x6b8f, 0x6b8f, 0x6baf, 0x6baf, 0x73f1, 0x6bb0, 0x636e, 0x5b4e,
-  0x7411, 0x7c32, 0x5b2d, 0x52cc, 0x5b0d, 0x5b2d, 0x4aab, 0x426a,
-  0x4a6a, 0x4a8b, 0x426a, 0x424a, 0x424a, 0x3a09, 0x3a09, 0x3a08,
-  0x39e8, 0x39e8, 0x39c8, 0x39e8, 0x39c8, 0x39e8, 0x39e8, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x31c7, 0x39c8, 0x39e8, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a4a, 0x3a6a,
-  0x3a8a, 0x3aaa, 0x42ab, 0x42cc, 0x42ec, 0x4b2d, 0x4b4d, 0x4b8e,
-  0x53cf, 0x5c10, 0x6451, 0x6492, 0x74f3, 0x7d55, 0x85b6, 0x9617,
-  0x9e78, 0xaefa, 0xc77b, 0xd7dc, 0xf7fe, 0xf7de, 0xe7dd, 0xdf9c,
-  0xd75b, 0xe79c, 0xdf5b, 0xe77b, 0xced8, 0x8d75, 0x8534, 0x7d13,
-  0x7cf3, 0x8d34, 0x6c72, 0x84b2, 0xad95, 0x7c51, 0x6c31, 0x9d53,
-  0xa513, 0xb594, 0xef5a, 0xe719, 0xdeb7, 0xd697, 0xbdb4, 0x8c70,
-  0x8c70, 0xb594, 0xb573, 0xbdd5, 0x9cb1, 0xa4f2, 0xa4d2, 0x6b2c,
-  0x4249, 0x4a8a, 0x9c91, 0x9470, 0xc5f4, 0xad12, 0x52cb, 0x4249,
-  0x31e8, 0x31c8, 0x31e8, 0x52ab, 0x4249, 0x4229, 0x426a, 0x3a29,
-  0x4269, 0x4a6a, 0x4a8a, 0x4269, 0x4249, 0x4269, 0x4aaa, 0x4229,
-  0x4a89, 0x3a28, 0x3a08, 0x4249, 0x4249, 0x4229, 0x4229, 0x4229,
-  0x3a28, 0x3a08, 0x4229, 0x4249, 0x4229, 0x3a08, 0x3a08, 0x4228,
-  0x3a08, 0x4228, 0x3a08, 0x3a08, 0x4228, 0x3a08, 0x3a08, 0x3a08,
-  0x4208, 0x4249, 0x4228, 0x39c7, 0x39c7, 0x39c7, 0x39c7, 0x39c7,
-  0x31c7, 0x39c7, 0x31a7, 0x31c7, 0x39c7, 0x39e8, 0x39c7, 0x39c7,
-  0x39a7, 0x39c7, 0x39a7, 0x39c7, 0x4208, 0x4a29, 0x634d, 0x636d,
-  0x52eb, 0x4249, 0x39a7, 0x39c8, 0x39a7, 0x3187, 0x3187, 0x3166,
-  0x3166, 0x3186, 0x3166, 0x3166, 0x3166, 0x3166, 0x3146, 0x3146,
-  0x3146, 0x3166, 0x3145, 0x3145, 0x3146, 0x3146, 0x3145, 0x3125,
-  0x3145, 0x3145, 0x3145, 0x3145, 0x3146, 0x3145, 0x3166, 0x3166,
-  0x3146, 0x3146, 0x3146, 0x3166, 0x3166, 0x3186, 0x3186, 0x3186,
-  0x3186, 0x3166, 0x3187, 0x3187, 0x3187, 0x31a7, 0x31c7, 0x39e8,
-  0x39e8, 0x39e8, 0x3a08, 0x39e8, 0x3a09, 0x424a, 0x426a, 0x4a8b,
-  0x4aab, 0x4aab, 0x52cb, 0x52ec, 0x52ec, 0x5b2d, 0x636e, 0x6b6e,
-  0x6b6e, 0x73af, 0x6b8f, 0x6bd0, 0x73f0, 0x6b8f, 0x636f, 0x6b8f,
-  0x6baf, 0x6baf, 0x530d, 0x94f4, 0x6baf, 0x4aab, 0x4aab, 0x426a,
-  0x426a, 0x4a8a, 0x4a8a, 0x426a, 0x424a, 0x3a29, 0x39e8, 0x39e8,
-  0x31c8, 0x31c8, 0x39e8, 0x39c8, 0x39c8, 0x39c8, 0x39c8, 0x39e8,
-  0x39c7, 0x39e8, 0x3a08, 0x39c8, 0x39c8, 0x31e8, 0x39e8, 0x39e8,
-  0x3a08, 0x3a08, 0x3a09, 0x3a29, 0x3a29, 0x3a29, 0x3a4a, 0x3a6a,
-  0x3a8a, 0x3a8a, 0x3aab, 0x42cb, 0x42ec, 0x4b2d, 0x4b4d, 0x4b8e,
-  0x53af, 0x5bf0, 0x6431, 0x6492, 0x74f3, 0x7d54, 0x8596, 0x8df7,
-  0x9658, 0xaef9, 0xbf7b, 0xd7bb, 0xf7fe, 0xffde, 0xe7dd, 0xdf9c,
-  0xcf5b, 0xe79c, 0xd73a, 0xe77b, 0xd6f9, 0x9575, 0x7cd3, 0x7cf3,
-  0x7cb2, 0x84f3, 0x6c51, 0x7c72, 0xb5d6, 0x8492, 0x6c50, 0x8cd2,
-  0xa533, 0xa553, 0xe6f9, 0xe739, 0xd697, 0xded8, 0xad53, 0x9cf2,
-  0xb594, 0xad33, 0xbd94, 0xbd94, 0xa4f2, 0xa4f2, 0xb553, 0x736d,
-  0x4aab, 0x4229, 0x8c2f, 0x944f, 0xb552, 0xcdf5, 0x634c, 0x3a49,
-  0x3209, 0x31c8, 0x31e8,
-};
-
-#ifdef __cplusplus
-}
-#endif  /* __cplusplus */
-
-#endif  /* __IMAGE_space_H__ */
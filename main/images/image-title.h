@@ -1,647 +0,0 @@
-// SKIP: 1007
-#ifndef __IMAGE_title_H__
-#define __IMAGE_title_H__
-
-#ifdef __cplusplus
-extern "C" {
-#endif  /* __cplusplus */
-#include <stdint.h>
-
-const uint16_t image_title[] = {
-  0x0105, 0x006a, 0x0026, 0x03ef, 0x1111, 0x1111, 0x1111, 0x2222,
-  0x2222, 0x2222, 0x2222, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222,
-  0x2222, 0x2211, 0x1111, 0x1111, 0x1111, 0x1111, 0x0011, 0x1111,
-  0x1111, 0x2222, 0x4553, 0x2222, 0x24bf, 0xfa32, 0x2111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1112, 0x2222, 0x2222, 0x2222,
-  0x5663, 0x2222, 0x2458, 0x8ba2, 0x2211, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x2224, 0xafff, 0xffc5, 0x223d, 0xffff,
-  0xb222, 0x2221, 0x1111, 0x1111, 0x1111, 0x1111, 0x1222, 0x2222,
-  0x2222, 0x2225, 0xafff, 0xffc5, 0x222c, 0xffff, 0xc222, 0x2221,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1222, 0x7fff, 0xffff,
-  0xfe52, 0x7fff, 0xfff2, 0x2222, 0x2222, 0x2111, 0x1111, 0x1112,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x7fff, 0xffff, 0xfe52, 0x2fff,
-  0xff82, 0x2222, 0x2221, 0x1111, 0x1111, 0x1111, 0x1111, 0x1122,
-  0x25ff, 0xffff, 0xffff, 0xc28f, 0xffff, 0xe222, 0x2222, 0x2222,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x26ff, 0xffff,
-  0xffff, 0xc36f, 0xffff, 0x6222, 0x2222, 0x2221, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x222b, 0xffff, 0xffff, 0xffe4, 0x7fff, 0xff92,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222,
-  0x233b, 0xffff, 0xffff, 0xffe4, 0x8fff, 0xff42, 0x2222, 0x2222,
-  0x2211, 0x1111, 0x1111, 0x1111, 0x1222, 0x2eff, 0xffc3, 0xbfd8,
-  0x3339, 0xfffb, 0x3222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222,
-  0x2222, 0x2222, 0x3333, 0x3eff, 0xffc4, 0xbfd8, 0x43af, 0xfffe,
-  0x3222, 0x2222, 0x2222, 0x2211, 0x1111, 0x1111, 0x1122, 0x222f,
-  0xffff, 0x8356, 0x3333, 0x3346, 0x4222, 0x2222, 0x2222, 0x2222,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x3333, 0x333f, 0xffff, 0x9356,
-  0x3333, 0xdfff, 0xfc33, 0x3222, 0x2222, 0x2222, 0x2211, 0x1111,
-  0x1111, 0x2222, 0x2cff, 0xff83, 0x3333, 0x3333, 0x3333, 0x3222,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2233, 0x3333, 0x3333,
-  0x3cff, 0xff93, 0x3333, 0x33ff, 0xfff9, 0x3333, 0x3222, 0x2222,
-  0x2222, 0x2111, 0x1111, 0x1222, 0x2227, 0xffff, 0xb333, 0x3333,
-  0x3333, 0x3333, 0x3222, 0x2222, 0x2222, 0x2222, 0x2222, 0x3333,
-  0x6653, 0x3333, 0x3338, 0xffff, 0xb333, 0x3336, 0xffff, 0xf833,
-  0x3333, 0x3222, 0x2222, 0x2222, 0x1111, 0x1112, 0x22ff, 0xffff,
-  0xffff, 0xfff3, 0x36ff, 0xfff7, 0x3333, 0x338d, 0x7224, 0xaefc,
-  0x8323, 0x3349, 0xdfff, 0xfea5, 0x33ff, 0xffff, 0xffff, 0xfff3,
-  0x38ff, 0xfff5, 0x3333, 0x589c, 0xe522, 0x225f, 0xffff, 0x8111,
-  0x1222, 0xffff, 0xffff, 0xffff, 0xc339, 0xffff, 0xf433, 0x35bf,
-  0xffb3, 0x5eff, 0xfff9, 0x3338, 0xefff, 0xffff, 0xfe53, 0xffff,
-  0xffff, 0xffff, 0xc33a, 0xffff, 0xf333, 0x33bf, 0xfff9, 0x2222,
-  0x8fff, 0xff51, 0x1122, 0x22ff, 0xffff, 0xffff, 0xff93, 0x3bff,
-  0xffd3, 0x3336, 0xffff, 0xf3df, 0xffff, 0xe433, 0xafff, 0xffff,
-  0xffff, 0xa3ff, 0xffff, 0xffff, 0xffa4, 0x4cff, 0xffd3, 0x3333,
-  0x9fff, 0xfd33, 0x22af, 0xffff, 0x2111, 0x2222, 0xffff, 0xffff,
-  0xffff, 0x933d, 0xffff, 0xc333, 0x33df, 0xfff8, 0xffff, 0xff83,
-  0x38ff, 0xffff, 0xffff, 0xffe3, 0xffff, 0xffff, 0xffff, 0x944f,
-  0xffff, 0xa333, 0x339f, 0xffff, 0x3332, 0xcfff, 0xfd22, 0x1122,
-  0x2266, 0x8fff, 0xff96, 0x6643, 0x4fff, 0xff93, 0x3333, 0x9fff,
-  0xddff, 0xfffc, 0x334e, 0xffff, 0xe64d, 0xffff, 0xf477, 0x9fff,
-  0xffa7, 0x7744, 0x6fff, 0xff94, 0x3333, 0xafff, 0xff33, 0x33ff,
-  0xfffb, 0x2211, 0x2222, 0x227f, 0xffff, 0x6333, 0x336f, 0xffff,
-  0x7333, 0x339f, 0xffef, 0xfa45, 0xc433, 0xafff, 0xff63, 0x3dff,
-  0xffc4, 0x448f, 0xffff, 0x7444, 0x447f, 0xffff, 0x7443, 0x33df,
-  0xfffd, 0x3336, 0xffff, 0xf822, 0x1122, 0x2222, 0x9fff, 0xff33,
-  0x3333, 0x9fff, 0xff53, 0x3333, 0x9fff, 0xffc3, 0x3333, 0x34ff,
-  0xfffb, 0x34af, 0xffff, 0x8444, 0xafff, 0xff44, 0x4444, 0x9fff,
-  0xff44, 0x4435, 0xffff, 0xf933, 0x38ff, 0xfff5, 0x2211, 0x2222,
-  0x22cf, 0xfffd, 0x3333, 0x33bf, 0xfffe, 0x3333, 0x339f, 0xffff,
-  0x6333, 0x3338, 0xffff, 0xfcae, 0xffff, 0xfc44, 0x44cf, 0xfffd,
-  0x4444, 0x44cf, 0xfffd, 0x4444, 0x49ff, 0xfff6, 0x333d, 0xffff,
-  0xf322, 0x1122, 0x2222, 0xffff, 0xfb33, 0x3333, 0xdfff, 0xfc33,
-  0x3333, 0xcfff, 0xfd33, 0x3333, 0x3aff, 0xffff, 0xffff, 0xffc4,
-  0x4444, 0xffff, 0xfb44, 0x4444, 0xefff, 0xfb44, 0x444c, 0xffff,
-  0xe333, 0x5fff, 0xffd2, 0x2211, 0x2222, 0x25ff, 0xfff9, 0x3333,
-  0x34ff, 0xfff9, 0x3333, 0x33ff, 0xfffa, 0x3333, 0x333c, 0xffff,
-  0xffff, 0xffd8, 0x3344, 0x46ff, 0xfff9, 0x4444, 0x45ff, 0xfff9,
-  0x4444, 0x4fff, 0xffa3, 0x339f, 0xffff, 0xc222, 0x1122, 0x2227,
-  0xffff, 0xf633, 0x3336, 0xffff, 0xf733, 0x3335, 0xffff, 0xf833,
-  0x3333, 0x3fff, 0xffff, 0xfea7, 0x3333, 0x3448, 0xffff, 0xf744,
-  0x4337, 0xffff, 0xf744, 0x447f, 0xffff, 0x6335, 0xefff, 0xff82,
-  0x2211, 0x2222, 0x29ff, 0xfff4, 0x3333, 0x39ff, 0xfff4, 0x3333,
-  0x38ff, 0xfff6, 0x3333, 0x333f, 0xffff, 0xd653, 0x3333, 0x3333,
-  0x3aff, 0xfff4, 0x3333, 0x39ff, 0xfff5, 0x4444, 0x9fff, 0xff33,
-  0x3cff, 0xffff, 0x8222, 0x1122, 0x222c, 0xffff, 0xd333, 0x333b,
-  0xffff, 0xf333, 0x3339, 0xffff, 0xf333, 0x3333, 0x3fff, 0xffd3,
-  0x3333, 0x6a33, 0x333c, 0xffff, 0xd333, 0x333b, 0xffff, 0xe443,
-  0x33cf, 0xffff, 0x43af, 0xfeff, 0xff82, 0x2211, 0x2222, 0x2eff,
-  0xffb3, 0x3333, 0x3dff, 0xfff8, 0xb333, 0x3cff, 0xffd3, 0x3333,
-  0x333c, 0xffff, 0xf969, 0xbeff, 0x7333, 0x3eff, 0xffb3, 0x3333,
-  0x3dff, 0xfff9, 0xa833, 0xcfff, 0xffdd, 0xfff9, 0xffff, 0x8222,
-  0x1112, 0x224f, 0xffff, 0x8233, 0x333f, 0xffff, 0xfff3, 0x322f,
-  0xffff, 0xa222, 0x2233, 0x38ff, 0xffff, 0xffff, 0xffa3, 0x335f,
-  0xffff, 0x9333, 0x333f, 0xffff, 0xfff9, 0x33bf, 0xffff, 0xffff,
-  0xd7ff, 0xff82, 0x2211, 0x1222, 0x6fff, 0xff62, 0x2222, 0x3dff,
-  0xffff, 0xf222, 0x5fff, 0xff82, 0x2222, 0x2223, 0xdfff, 0xffff,
-  0xffff, 0xe433, 0x7fff, 0xff63, 0x3333, 0x3dff, 0xffff, 0xf933,
-  0x8fff, 0xffff, 0xff56, 0xffff, 0xc222, 0x1112, 0x229f, 0xffff,
-  0x3222, 0x2227, 0xffff, 0xfff2, 0x227f, 0xffff, 0x6222, 0x2222,
-  0x225d, 0xffff, 0xffff, 0xea53, 0x339f, 0xffff, 0x4333, 0x3338,
-  0xffff, 0xfff9, 0x334d, 0xffff, 0xffe6, 0x36ff, 0xffc2, 0x2211,
-  0x1122, 0xcfff, 0xfc22, 0x2222, 0x226c, 0xffca, 0x6222, 0xafff,
-  0xff22, 0x2222, 0x2222, 0x228b, 0xefdc, 0x8633, 0x3333, 0xdfff,
-  0xfd33, 0x3333, 0x337d, 0xffdb, 0x9533, 0x34ad, 0xffd9, 0x4336,
-  0xffff, 0xf222, 0x1111, 0x25ff, 0xfff8, 0x2222, 0x2222, 0x2222,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2333,
-  0x3333, 0x36ff, 0xfff8, 0x3333, 0x3333, 0x3333, 0x3333, 0x3333,
-  0x3333, 0x3333, 0x36ff, 0xfff2, 0x2211, 0x114e, 0xffff, 0xf322,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222,
-  0x2222, 0x2222, 0x2222, 0x225e, 0xffff, 0xf322, 0x2222, 0x2222,
-  0x3333, 0x3333, 0x3384, 0x3333, 0x3338, 0xffff, 0xe222, 0x1115,
-  0xefff, 0xff82, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2226, 0xefff, 0xff82,
-  0x2222, 0x2222, 0x2222, 0x2223, 0x3336, 0xffd8, 0x5333, 0x8fff,
-  0xffc2, 0x2213, 0x9fff, 0xfffc, 0x2222, 0x2222, 0x2222, 0x2222,
-  0x2222, 0x1112, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2224,
-  0xafff, 0xfffc, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2cff,
-  0xffff, 0xffff, 0xffff, 0x9222, 0x19ff, 0xffff, 0xc212, 0x2222,
-  0x2222, 0x2222, 0x1111, 0x1111, 0x1111, 0x1111, 0x1112, 0x2222,
-  0x2222, 0x2222, 0x2aff, 0xffff, 0xc322, 0x2222, 0x2222, 0x2222,
-  0x2222, 0x224f, 0xffff, 0xffff, 0xffff, 0xff42, 0x2113, 0xefff,
-  0xf921, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1222, 0x2222, 0x2224, 0xefff, 0xf932, 0x2222,
-  0x2222, 0x2222, 0x2222, 0x2222, 0x9fff, 0xffff, 0xffff, 0xfff7,
-  0x2221, 0x118f, 0xfd51, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1112, 0x2222, 0x228f,
-  0xfd52, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2227, 0xcfff,
-  0xffff, 0xfffe, 0x8222, 0x1111, 0x2c71, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x2c72, 0x2222, 0x1111, 0x1111, 0x1122, 0x2222,
-  0x2222, 0x2224, 0x8bcf, 0xfffc, 0x8422, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x2222, 0x2222, 0x2222, 0x2222, 0x2222, 0x2111,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111,
-  0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x1111, 0x2222, 0x2222,
-  0x2222, 0x2111, 0x1111, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xc714, 0xbef2, 0xbef2, 0xdf79, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xd736, 0xaeae, 0xae8d, 0xae8d,
-  0xb6af, 0xdf79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xcf15, 0xc6f3, 0xc6f3, 0xe77a, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xd736, 0xc6f3, 0xb6b0, 0xb6b0,
-  0xaeae, 0xb6af, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xc714, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8e, 0xcf14, 0xffff, 0xffff, 0xe77a, 0xae8e, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xaeae, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xcf15, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8e, 0xcf15, 0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xb6d1, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf15, 0xffff, 0xbed1,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf15, 0xffff, 0xffff,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d0, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xbef2, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e,
-  0xffff, 0xb6d0, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xc714, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xaeae,
-  0xffff, 0xc714, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbef2,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xaeae, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xd757, 0xbef2, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6b0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xdf58, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xd757, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xaeae, 0xe79a, 0xb6af,
-  0xae8d, 0xae8e, 0xbed2, 0xe79b, 0xffff, 0xffff, 0xb6b0, 0xae8d,
-  0xae8d, 0xae8d, 0xb6af, 0xe79a, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xaeaf, 0xe79b, 0xb6af,
-  0xae8d, 0xae8e, 0xbed2, 0xe79b, 0xffff, 0xb6b0, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d1,
-  0xffff, 0xcf36, 0xc714, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xdf58, 0xc714, 0xd757, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed1,
-  0xffff, 0xd736, 0xcf15, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8e,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xaeaf, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xbed1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xbed1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d0, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xe79b, 0xc714, 0xc714, 0xcf36, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef2, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xd736, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xbef2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xffff, 0xffff, 0xcf14, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xc6f3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xe79b, 0xb6d1, 0xae8e, 0xbef2, 0xffff, 0xffff, 0xd757, 0xb6af,
-  0xae8d, 0xae8d, 0xae8e, 0xb6d1, 0xe79a, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xdf58, 0xb6b0, 0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6b0, 0xdf58, 0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xffff, 0xffff, 0xbef2, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xd736, 0xffff, 0xffff, 0xffff, 0xffff, 0xcf36,
-  0xbed1, 0xb6b0, 0xaeae, 0xae8d, 0xcf15, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xcf14, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xffff, 0xbed1, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xe79b, 0xffff, 0xffff, 0xffff,
-  0xcf36, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xcf35,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6b0, 0xffff,
-  0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xdf79, 0xffff, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xffff, 0xbed1, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6b0, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xb6d0, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xbed2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d0, 0xffff, 0xffff,
-  0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xc714, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xe79b, 0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xe79b, 0xffff, 0xffff, 0xb6b0, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6b0,
-  0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed1, 0xffff, 0xffff,
-  0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xaeae, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8e, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xdf79, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed1,
-  0xffff, 0xffff, 0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xbed1, 0xffff, 0xffff, 0xbed2, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed2,
-  0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d0,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8e,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc6f3, 0xc6f3, 0xb6d1,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d0, 0xcf14, 0xcf15,
-  0xcf15, 0xef9b, 0xffff, 0xef9b, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xbed1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6d0,
-  0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xae8e, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xaeaf, 0xffff, 0xffff, 0xdf58, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf15, 0xef9b, 0xae8e, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xcf35, 0xcf35, 0xbed2,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed1, 0xcf35, 0xcf35,
-  0xcf35, 0xefbc, 0xffff, 0xd757, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xbed2, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6d1,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xaeae, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf14,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xcf15, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xc6f3, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xb6b0, 0xe79b, 0xcf36, 0xaeaf, 0xdf58, 0xffff, 0xffff, 0xb6b0,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf15, 0xffff, 0xffff,
-  0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xffff,
-  0xffff, 0xc6f3, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf35,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc714, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xcf35, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff,
-  0xffff, 0xffff, 0xc714, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xb6b0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xb6b0, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbed1,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xdf58, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xaeaf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xe79b, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff,
-  0xefbb, 0xb6b0, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xc6f3,
-  0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbed2,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xdf79, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xb6d1, 0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xc6f3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xaeae, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6d0, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xc714, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xbef2, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xb6af, 0xb6b0, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xb6af, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xaeae, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xbed2, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xcf15, 0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xe77a, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xb6af, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xaeaf,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xb6b0, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6af, 0xefbb, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6b0, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xb6b0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff, 0xdf58,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xcf15, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed1, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xef9b, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xbed1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6b0, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xaeaf, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8e, 0xc6f3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xd757, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed2, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xdf79, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xbed2, 0xffff, 0xffff, 0xffff, 0xffff, 0xefbb,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6b0, 0xffff, 0xffff,
-  0xffff, 0xb6d0, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xc714, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xcf14, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xc6f3, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xcf36, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xbed1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6b0, 0xc714, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xc6f3, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xcf35, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xcf15, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf35, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xc714, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf15,
-  0xffff, 0xffff, 0xdf78, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6d0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xb6b0, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xe79b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xdf58, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xbed2, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xc714, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e,
-  0xcf15, 0xdf79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xefbb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xbed2, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xdf79, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xbed2, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xb6d0, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6b0, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xd736,
-  0xb6d1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xefbb, 0xffff, 0xb6b0, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d0, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xbed1, 0xb6af, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xaeae, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xaeae, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed1, 0xcf15, 0xbed1, 0xb6af,
-  0xae8d, 0xae8d, 0xae8d, 0xc6f3, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xbed2, 0xbed1, 0xc6f3, 0xffff, 0xffff, 0xb6af,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xae8e, 0xae8d,
-  0xae8d, 0xae8d, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d0,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xd736, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6d1,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6b0, 0xffff, 0xffff,
-  0xffff, 0xdf79, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed1,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed2, 0xffff,
-  0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xc6f3, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6d0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xbed2, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xc6f3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xffff, 0xffff, 0xffff, 0xcf15, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6d0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xe79b, 0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xef9b, 0xffff, 0xffff, 0xc6f3, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xcf15, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xbed1, 0xffff, 0xffff, 0xbef2, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xd736, 0xcf14, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xe79a, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xbef2, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xc6f3, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xcf35, 0xae8e, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xb6b0, 0xcf36, 0xffff, 0xffff, 0xffff, 0xb6d0, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xe79b, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xbed2, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xbed1, 0xffff, 0xffff, 0xef9b, 0xae8e, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xcf14, 0xffff,
-  0xc714, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8e,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbef2, 0xae8e, 0xae8d,
-  0xae8d, 0xae8e, 0xb6af, 0xbef2, 0xffff, 0xffff, 0xffff, 0xb6af,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xb6d1, 0xb6af, 0xae8d, 0xae8d, 0xae8e, 0xaeae, 0xbed1,
-  0xc714, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xae8e,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc6f3, 0xae8e, 0xae8d,
-  0xae8d, 0xae8e, 0xb6af, 0xbed1, 0xdf58, 0xffff, 0xffff, 0xffff,
-  0xef9b, 0xb6b0, 0xae8e, 0xae8d, 0xae8d, 0xae8e, 0xb6d0, 0xe79b,
-  0xffff, 0xffff, 0xc714, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xbef2, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6b0, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xc714, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xbed1, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xc714, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xc6f3, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xdf79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xcf35, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xe79a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbed1, 0xdf58, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xb6d1, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xbed1, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6b0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xc6f3, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xb6d0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc714, 0xae8d,
-  0xae8d, 0xae8e, 0xbed1, 0xcf36, 0xffff, 0xffff, 0xffff, 0xb6d1,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xc714, 0xae8e, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xd737, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xaeae, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xae8e, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xdf78, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8e, 0xe77a, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xd757, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xd736, 0xffff, 0xffff, 0xffff, 0xffff, 0xc6f3, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xaeaf, 0xdf58, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xcf36, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xb6af, 0xdf79, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xb6b0, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xb6d1, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xb6af, 0xae8d, 0xae8d, 0xae8d, 0xbed1, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xb6b0, 0xae8d, 0xae8d, 0xae8d, 0xbef2, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xbed1, 0xae8e,
-  0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8d, 0xb6b0, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xcf36, 0xae8d, 0xb6af, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdf78, 0xae8e, 0xb6d0, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xd736, 0xb6b0, 0xaeae, 0xae8e, 0xae8d, 0xae8d,
-  0xae8d, 0xae8d, 0xae8e, 0xb6b0, 0xcf36, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-};
-
-#ifdef __cplusplus
-}
-#endif  /* __cplusplus */
-
-#endif  /* __IMAGE_title_H__ */
@@ -8,6 +8,10 @@
 #include "firefly-demos.h"
 #include "firefly-hollows.h"
 
+#include "entities.h"
+#include "image.h"
+#include "images.h"
+#include "secp256k1.h"
 #include "utils.h"
 
 //#include "panel-connect.h"
@@ -15,7 +19,7 @@
 //#include "panel-null.h"
 #include "panel-space.h"
 //#include "panel-test.h"
-//#include "panel-tx.h"
+#include "panel-tx.h"
 //#include "./panel-keyboard.h"
 //#include "./panel-game.h"
 
@@ -36,6 +40,18 @@ void app_main() {
 
     FFX_LOG("GIT Commit: %s\n", GIT_COMMIT);
 
+    // Decode cost per line of the compressed background vs raw RGB565
+    //imageBenchmark(image_background, IMAGE_BACKGROUND_SIZE);
+
+    // Collision broadphase vs brute force for a full-size formation
+    //entitiesBenchmark(5, 11, 24);
+
+    // Signing and public key rates, checked against ffx_ec_*
+    //secp256k1Benchmark(16);
+
+    // Methods answered over the connection, beyond the built-in ones
+    panelTxRegister();
+
     ffx_init(ffx_demo_backgroundPixies, NULL);
     //ffx_init(NULL, NULL);
     //ffx_demo_pushPanelTest(NULL);
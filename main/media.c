@@ -0,0 +1,286 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+#include "media.h"
+
+
+#define NO_CHUNK        (0xffffffff)
+
+
+static uint16_t readU16(const uint8_t *data) {
+    return data[0] | (data[1] << 8);
+}
+
+static uint32_t readU32(const uint8_t *data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
+}
+
+
+/////////////////////////////
+// Backend
+
+#ifdef ESP_PLATFORM
+
+static bool openBackend(Media *media, const char *name) {
+    media->partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+      ESP_PARTITION_SUBTYPE_ANY, name);
+    return (media->partition != NULL);
+}
+
+static void closeBackend(Media *media) {
+    media->partition = NULL;
+}
+
+static bool readBackend(Media *media, uint32_t offset, void *buffer,
+  size_t length) {
+    if (offset + length > media->partition->size) { return false; }
+    return (esp_partition_read(media->partition, offset, buffer,
+      length) == ESP_OK);
+}
+
+uint8_t* mediaAllocCache() {
+    return heap_caps_malloc(MEDIA_CACHE_SIZE, MALLOC_CAP_DMA);
+}
+
+#else
+
+static bool openBackend(Media *media, const char *name) {
+    media->file = fopen(name, "rb");
+    return (media->file != NULL);
+}
+
+static void closeBackend(Media *media) {
+    if (media->file) { fclose(media->file); }
+    media->file = NULL;
+}
+
+static bool readBackend(Media *media, uint32_t offset, void *buffer,
+  size_t length) {
+    if (fseek(media->file, offset, SEEK_SET)) { return false; }
+    return (fread(buffer, 1, length, media->file) == length);
+}
+
+uint8_t* mediaAllocCache() {
+    return malloc(MEDIA_CACHE_SIZE);
+}
+
+#endif
+
+
+/////////////////////////////
+// Media
+
+bool mediaOpen(Media *media, const char *name) {
+    memset(media, 0, sizeof(Media));
+
+    if (!openBackend(media, name)) {
+        printf("[media] not found: %s\n", name);
+        return false;
+    }
+
+    uint8_t header[MEDIA_HEADER_SIZE];
+    if (!readBackend(media, 0, header, sizeof(header)) ||
+      memcmp(header, "FFXM", 4) || readU16(&header[4]) != 1) {
+        printf("[media] bad header: %s\n", name);
+        closeBackend(media);
+        return false;
+    }
+
+    media->count = readU16(&header[6]);
+    media->length = readU32(&header[8]);
+
+    return true;
+}
+
+void mediaClose(Media *media) {
+    closeBackend(media);
+    media->count = 0;
+    media->length = 0;
+}
+
+bool mediaRead(Media *media, uint32_t offset, void *buffer, size_t length) {
+    if (offset + length > media->length) { return false; }
+    return readBackend(media, offset, buffer, length);
+}
+
+bool mediaFind(Media *media, const char *name, MediaEntry *entry) {
+    // The index is small; a linear scan is cheaper than anything that
+    // needs the index held in RAM
+    for (int i = 0; i < media->count; i++) {
+        uint8_t data[MEDIA_ENTRY_SIZE];
+        if (!mediaRead(media, MEDIA_HEADER_SIZE + i * MEDIA_ENTRY_SIZE,
+          data, sizeof(data))) {
+            return false;
+        }
+
+        if (strncmp((char*)data, name, MEDIA_NAME_LENGTH)) { continue; }
+
+        memcpy(entry->name, data, MEDIA_NAME_LENGTH);
+        entry->name[MEDIA_NAME_LENGTH] = 0;
+        entry->offset = readU32(&data[MEDIA_NAME_LENGTH]);
+        entry->length = readU32(&data[MEDIA_NAME_LENGTH + 4]);
+
+        if (entry->offset + entry->length > media->length) {
+            printf("[media] bad entry: %s\n", name);
+            return false;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+
+/////////////////////////////
+// Cache
+
+void mediaCacheInit(MediaCache *cache, Media *media, MediaEntry *entry,
+  uint8_t *buffer) {
+    memset(cache, 0, sizeof(MediaCache));
+    cache->media = media;
+    cache->offset = entry->offset;
+    cache->length = entry->length;
+    cache->buffer = buffer;
+    cache->chunk[0] = cache->chunk[1] = NO_CHUNK;
+}
+
+// Make sure the half the chunk maps to holds it
+static bool loadChunk(MediaCache *cache, uint32_t chunk) {
+    int half = chunk & 1;
+    if (cache->chunk[half] == chunk) { return true; }
+
+    uint32_t start = chunk * MEDIA_CHUNK_SIZE;
+    size_t length = MEDIA_CHUNK_SIZE;
+    if (start + length > cache->media->length) {
+        length = cache->media->length - start;
+    }
+
+    cache->reads++;
+    if (!mediaRead(cache->media, start,
+      &cache->buffer[half * MEDIA_CHUNK_SIZE], length)) {
+        cache->chunk[half] = NO_CHUNK;
+        return false;
+    }
+
+    cache->chunk[half] = chunk;
+
+    return true;
+}
+
+const uint8_t* mediaCacheRead(MediaCache *cache, uint32_t offset,
+  size_t length) {
+
+    if (length > MEDIA_SPILL_SIZE || offset + length > cache->length) {
+        return NULL;
+    }
+
+    // Chunks are aligned to the partition, not the entry, so every
+    // flash read is aligned
+    uint32_t position = cache->offset + offset;
+    uint32_t chunk = position / MEDIA_CHUNK_SIZE;
+    size_t start = position % MEDIA_CHUNK_SIZE;
+
+    if (!loadChunk(cache, chunk)) { return NULL; }
+
+    uint8_t *result = &cache->buffer[(chunk & 1) * MEDIA_CHUNK_SIZE + start];
+    if (start + length <= MEDIA_CHUNK_SIZE) { return result; }
+
+    // Straddles into the next chunk, which lives in the other half
+    if (!loadChunk(cache, chunk + 1)) { return NULL; }
+
+    // If the next chunk wrapped around to the first half, copy the
+    // part needed into the spill area so the result is contiguous
+    if (chunk & 1) {
+        memcpy(&cache->buffer[2 * MEDIA_CHUNK_SIZE], cache->buffer,
+          start + length - MEDIA_CHUNK_SIZE);
+    }
+
+    return result;
+}
+
+
+/////////////////////////////
+// Video
+
+static const uint8_t* readVideo(void *arg, uint32_t offset, size_t length) {
+    MediaVideo *player = arg;
+    return mediaCacheRead(&player->cache, offset, length);
+}
+
+static bool openEntry(MediaVideo *player, Media *media, MediaEntry *entry,
+  uint16_t *image, size_t imageSize, uint8_t *cacheBuffer) {
+
+    memset(player, 0, sizeof(MediaVideo));
+
+    // Keep the header, palette and frame table in RAM, so seeking never
+    // has to touch flash
+    uint8_t header[VIDEO_HEADER_SIZE];
+    if (entry->length < sizeof(header) ||
+      !mediaRead(media, entry->offset, header, sizeof(header))) {
+        return false;
+    }
+
+    size_t length = videoGetPreambleSize(header);
+    if (length == 0 || length > entry->length) {
+        printf("[media] bad video: %s\n", entry->name);
+        return false;
+    }
+
+    player->preamble = malloc(length);
+    if (player->preamble == NULL) { return false; }
+
+    if (!mediaRead(media, entry->offset, player->preamble, length) ||
+      !videoInit(&player->video, player->preamble, length, image,
+      imageSize)) {
+        mediaVideoClose(player);
+        return false;
+    }
+
+    mediaCacheInit(&player->cache, media, entry, cacheBuffer);
+    videoSetSource(&player->video, entry->length, readVideo, player);
+
+    return true;
+}
+
+bool mediaVideoOpen(MediaVideo *player, Media *media, const char *name,
+  uint16_t *image, size_t imageSize, uint8_t *cacheBuffer) {
+
+    MediaEntry entry;
+    if (!mediaFind(media, name, &entry)) {
+        printf("[media] video not found: %s\n", name);
+        memset(player, 0, sizeof(MediaVideo));
+        return false;
+    }
+
+    return openEntry(player, media, &entry, image, imageSize, cacheBuffer);
+}
+
+bool mediaVideoOpenClip(MediaVideo *player, Media *media,
+  const MediaClip *clip, uint16_t *image, size_t imageSize,
+  uint8_t *cacheBuffer) {
+
+    MediaEntry entry = { .offset = clip->offset, .length = clip->length };
+    strncpy(entry.name, clip->name, MEDIA_NAME_LENGTH);
+
+    if (entry.offset + entry.length <= media->length &&
+      openEntry(player, media, &entry, image, imageSize, cacheBuffer)) {
+        if (player->video.frameCount == clip->frameCount) { return true; }
+        mediaVideoClose(player);
+    }
+
+    // The partition was updated since the firmware was built
+    return mediaVideoOpen(player, media, clip->name, image, imageSize,
+      cacheBuffer);
+}
+
+void mediaVideoClose(MediaVideo *player) {
+    if (player->preamble) { free(player->preamble); }
+    player->preamble = NULL;
+    player->video.data = NULL;
+}
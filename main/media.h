@@ -0,0 +1,142 @@
+#ifndef __MEDIA_H__
+#define __MEDIA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_partition.h"
+#else
+#include <stdio.h>
+#endif
+
+#include "video.h"
+
+
+/**
+ *  Packed media file (all values little-endian), flashed to the "media"
+ *  partition by the build (see tools/media-pack.py).
+ *
+ *  Header (16 bytes)
+ *     0  magic "FFXM"
+ *     4  uint16 version (1)
+ *     6  uint16 count
+ *     8  uint32 length (of the whole file)
+ *    12  uint32 reserved
+ *
+ *  Index: count entries of
+ *    char[24] name (NUL-padded), uint32 offset, uint32 length
+ *
+ *  Followed by the entry payloads, each aligned to MEDIA_ALIGN. Videos
+ *  are stored in the container format described in video.h, whose frame
+ *  table is used to seek within the entry.
+ */
+
+#define MEDIA_PARTITION          ("media")
+
+#define MEDIA_HEADER_SIZE        (16)
+#define MEDIA_ENTRY_SIZE         (32)
+#define MEDIA_NAME_LENGTH        (24)
+#define MEDIA_ALIGN              (16)
+
+// Each half of the streaming cache; flash reads are this size and aligned
+#define MEDIA_CHUNK_SIZE         (2048)
+
+// Room past the second half so reads that wrap around stay contiguous
+#define MEDIA_SPILL_SIZE         (VIDEO_MAX_READ)
+
+#define MEDIA_CACHE_SIZE         (2 * MEDIA_CHUNK_SIZE + MEDIA_SPILL_SIZE)
+
+
+typedef struct Media {
+#ifdef ESP_PLATFORM
+    const esp_partition_t *partition;
+#else
+    FILE *file;
+#endif
+    uint16_t count;
+    uint32_t length;
+} Media;
+
+typedef struct MediaEntry {
+    char name[MEDIA_NAME_LENGTH + 1];
+    uint32_t offset;
+    uint32_t length;
+} MediaEntry;
+
+// A double-buffered window onto a single entry; each half holds one
+// chunk, so streaming forward refills one half while the other is in use
+typedef struct MediaCache {
+    Media *media;
+    uint32_t offset;
+    uint32_t length;
+
+    uint8_t *buffer;
+    uint32_t chunk[2];
+
+    // Number of flash reads issued; for tuning MEDIA_CHUNK_SIZE
+    uint32_t reads;
+} MediaCache;
+
+// An entry in the clip table generated by tools/media-pack.py; the
+// offset and length are hints, checked against the partition contents
+// so the media can be updated without rebuilding the firmware
+typedef struct MediaClip {
+    const char *name;
+    const char *title;
+    uint16_t frameCount;
+    uint16_t framePeriod;
+    uint32_t offset;
+    uint32_t length;
+} MediaClip;
+
+// A video streamed from a media entry
+typedef struct MediaVideo {
+    Video video;
+    MediaCache cache;
+    uint8_t *preamble;
+} MediaVideo;
+
+
+// Open the media partition; on the host %name% is the path of a packed file
+bool mediaOpen(Media *media, const char *name);
+void mediaClose(Media *media);
+
+bool mediaRead(Media *media, uint32_t offset, void *buffer, size_t length);
+
+bool mediaFind(Media *media, const char *name, MediaEntry *entry);
+
+// Allocate a MEDIA_CACHE_SIZE buffer suitable for flash DMA
+uint8_t* mediaAllocCache();
+
+void mediaCacheInit(MediaCache *cache, Media *media, MediaEntry *entry,
+  uint8_t *buffer);
+
+// Returns a pointer to %length% (at most MEDIA_SPILL_SIZE) contiguous bytes
+// at %offset% within the entry, valid until the next read
+const uint8_t* mediaCacheRead(MediaCache *cache, uint32_t offset,
+  size_t length);
+
+// Open the video %name% for streaming into %image%; %cacheBuffer% must be
+// MEDIA_CACHE_SIZE bytes (see mediaAllocCache)
+bool mediaVideoOpen(MediaVideo *player, Media *media, const char *name,
+  uint16_t *image, size_t imageSize, uint8_t *cacheBuffer);
+void mediaVideoClose(MediaVideo *player);
+
+// Open a video from the generated clip table, skipping the index lookup
+// when the partition still matches the table
+bool mediaVideoOpenClip(MediaVideo *player, Media *media,
+  const MediaClip *clip, uint16_t *image, size_t imageSize,
+  uint8_t *cacheBuffer);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __MEDIA_H__ */
@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "metadata.h"
+
+
+static uint16_t readU16(const uint8_t *data) {
+    return data[0] | (data[1] << 8);
+}
+
+static uint32_t readU32(const uint8_t *data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
+}
+
+
+/////////////////////////////
+// Backend
+
+#ifdef ESP_PLATFORM
+
+static bool openBackend(Metadata *metadata, const char *name) {
+    const esp_partition_t *partition = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+    if (partition == NULL) { return false; }
+
+    const void *data = NULL;
+    if (esp_partition_mmap(partition, 0, partition->size,
+      ESP_PARTITION_MMAP_DATA, &data, &metadata->handle) != ESP_OK) {
+        return false;
+    }
+
+    metadata->data = data;
+    metadata->length = partition->size;
+
+    return true;
+}
+
+static void closeBackend(Metadata *metadata) {
+    if (metadata->data) { esp_partition_munmap(metadata->handle); }
+}
+
+#else
+
+static bool openBackend(Metadata *metadata, const char *name) {
+    FILE *file = fopen(name, "rb");
+    if (file == NULL) { return false; }
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    if (length < 0) {
+        fclose(file);
+        return false;
+    }
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *data = malloc(length);
+    if (data == NULL || fread(data, 1, length, file) != (size_t)length) {
+        free(data);
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+
+    metadata->data = data;
+    metadata->length = length;
+
+    return true;
+}
+
+static void closeBackend(Metadata *metadata) {
+    free((void*)metadata->data);
+}
+
+#endif
+
+
+/////////////////////////////
+// Metadata
+
+// Whether %count% entries of %size% at %offset% lie within the file
+static bool checkTable(Metadata *metadata, uint32_t offset, uint32_t count,
+  size_t size) {
+    if (offset > metadata->length) { return false; }
+    return (count <= (metadata->length - offset) / size);
+}
+
+bool metadataOpen(Metadata *metadata, const char *name) {
+    memset(metadata, 0, sizeof(Metadata));
+
+    if (!openBackend(metadata, name)) {
+        printf("[metadata] not found: %s\n", name);
+        return false;
+    }
+
+    const uint8_t *header = metadata->data;
+    if (metadata->length < METADATA_HEADER_SIZE ||
+      memcmp(header, "FFXD", 4) || readU16(&header[4]) != 1) {
+        printf("[metadata] bad header: %s\n", name);
+        metadataClose(metadata);
+        return false;
+    }
+
+    // The partition is usually larger than the file
+    uint32_t length = readU32(&header[28]);
+    if (length < METADATA_HEADER_SIZE || length > metadata->length) {
+        printf("[metadata] bad length: %s\n", name);
+        metadataClose(metadata);
+        return false;
+    }
+    metadata->length = length;
+
+    uint32_t selectorCount = readU32(&header[8]);
+    uint32_t selectorOffset = readU32(&header[12]);
+    uint32_t tokenCount = readU32(&header[16]);
+    uint32_t tokenOffset = readU32(&header[20]);
+    uint32_t stringsOffset = readU32(&header[24]);
+
+    // Strings must end in a NUL, so any offset within them is safe
+    if (!checkTable(metadata, selectorOffset, selectorCount,
+      METADATA_SELECTOR_SIZE) || !checkTable(metadata, tokenOffset,
+      tokenCount, METADATA_TOKEN_SIZE) || stringsOffset >= length ||
+      metadata->data[length - 1] != 0) {
+        printf("[metadata] bad tables: %s\n", name);
+        metadataClose(metadata);
+        return false;
+    }
+
+    metadata->selectors = &metadata->data[selectorOffset];
+    metadata->selectorCount = selectorCount;
+    metadata->tokens = &metadata->data[tokenOffset];
+    metadata->tokenCount = tokenCount;
+    metadata->strings = (const char*)&metadata->data[stringsOffset];
+    metadata->stringsLength = length - stringsOffset;
+
+    return true;
+}
+
+void metadataClose(Metadata *metadata) {
+    closeBackend(metadata);
+    memset(metadata, 0, sizeof(Metadata));
+}
+
+bool metadataIsOpen(Metadata *metadata) {
+    return (metadata->data != NULL);
+}
+
+// Find %key% in a table in Eytzinger order; the children of the entry
+// at k (from 1) are at 2k and 2k + 1
+static const uint8_t* search(const uint8_t *table, uint32_t count,
+  size_t size, const uint8_t *key, size_t keyLength) {
+
+    uint32_t k = 1;
+    while (k <= count) {
+        const uint8_t *entry = &table[(k - 1) * size];
+        int cmp = memcmp(key, entry, keyLength);
+        if (cmp == 0) { return entry; }
+        k = 2 * k + (cmp > 0);
+    }
+
+    return NULL;
+}
+
+static const char* getString(Metadata *metadata, uint32_t offset) {
+    if (offset >= metadata->stringsLength) { return NULL; }
+    return &metadata->strings[offset];
+}
+
+const char* metadataGetSignature(Metadata *metadata, const uint8_t *selector) {
+    const uint8_t *entry = search(metadata->selectors,
+      metadata->selectorCount, METADATA_SELECTOR_SIZE, selector, 4);
+    if (entry == NULL) { return NULL; }
+
+    return getString(metadata, readU32(&entry[4]));
+}
+
+bool metadataGetToken(Metadata *metadata, uint32_t chainId,
+  const uint8_t *address, MetadataToken *token) {
+
+    uint8_t key[24];
+    key[0] = chainId >> 24;
+    key[1] = chainId >> 16;
+    key[2] = chainId >> 8;
+    key[3] = chainId;
+    memcpy(&key[4], address, 20);
+
+    const uint8_t *entry = search(metadata->tokens, metadata->tokenCount,
+      METADATA_TOKEN_SIZE, key, sizeof(key));
+    if (entry == NULL) { return false; }
+
+    token->symbol = getString(metadata, readU32(&entry[28]));
+    token->decimals = entry[24];
+
+    return (token->symbol != NULL);
+}
@@ -0,0 +1,101 @@
+#ifndef __METADATA_H__
+#define __METADATA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_partition.h"
+#endif
+
+
+/**
+ *  Metadata file (values little-endian, unless noted), flashed to the
+ *  "metadata" partition by the build (see tools/metadata-pack.py) and
+ *  memory-mapped, so lookups read flash directly.
+ *
+ *  Header (32 bytes)
+ *     0  magic "FFXD"
+ *     4  uint16 version (1)
+ *     6  uint16 reserved
+ *     8  uint32 selector count
+ *    12  uint32 selector table offset
+ *    16  uint32 token count
+ *    20  uint32 token table offset
+ *    24  uint32 strings offset
+ *    28  uint32 length (of the whole file)
+ *
+ *  Selectors (8 bytes each)
+ *     0  uint8[4] selector (as in calldata)
+ *     4  uint32 signature (offset in strings)
+ *
+ *  Tokens (32 bytes each)
+ *     0  uint32 chain id (big-endian)
+ *     4  uint8[20] address
+ *    24  uint8 decimals
+ *    25  uint8[3] reserved
+ *    28  uint32 symbol (offset in strings)
+ *
+ *  Strings: NUL-terminated
+ *
+ *  Each table is in Eytzinger (breadth-first) order of its key (the
+ *  first 4 or 24 bytes, compared as bytes), so a lookup is a binary
+ *  search whose first steps share the same few flash cache lines.
+ */
+
+#define METADATA_PARTITION       ("metadata")
+
+#define METADATA_HEADER_SIZE     (32)
+#define METADATA_SELECTOR_SIZE   (8)
+#define METADATA_TOKEN_SIZE      (32)
+
+
+typedef struct Metadata {
+#ifdef ESP_PLATFORM
+    esp_partition_mmap_handle_t handle;
+#endif
+    const uint8_t *data;
+    uint32_t length;
+
+    const uint8_t *selectors;
+    uint32_t selectorCount;
+
+    const uint8_t *tokens;
+    uint32_t tokenCount;
+
+    const char *strings;
+    uint32_t stringsLength;
+} Metadata;
+
+typedef struct MetadataToken {
+    const char *symbol;
+    uint8_t decimals;
+} MetadataToken;
+
+
+// Map the metadata partition; on the host %name% is the path of a packed
+// file, which is loaded
+bool metadataOpen(Metadata *metadata, const char *name);
+void metadataClose(Metadata *metadata);
+
+bool metadataIsOpen(Metadata *metadata);
+
+// The signature (e.g. "transfer(address,uint256)") of the 4-byte
+// %selector%, or NULL; valid until closed
+const char* metadataGetSignature(Metadata *metadata, const uint8_t *selector);
+
+// The token at %address% (20 bytes) on %chainId%; false if unknown
+bool metadataGetToken(Metadata *metadata, uint32_t chainId,
+  const uint8_t *address, MetadataToken *token);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __METADATA_H__ */
@@ -1,25 +1,43 @@
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "firefly-hollows.h"
 #include "firefly-scene.h"
 
 #include "utils.h"
 
+#include "media.h"
 #include "panel-gifs.h"
+#include "playback.h"
+#include "profiler.h"
 
-#include "images/video-fox.h"
-#include "images/video-rroll.h"
-#include "images/video-shiba.h"
-#include "images/video-nyan.h"
+// Generated by tools/media-pack.py at build time
+#include "media-clips.h"
+
+
+#define WIDTH        (240)
+#define HEIGHT       (240)
 
 typedef struct State {
-    int video;
+    size_t clip;
     int menuHidden;
     FfxScene scene;
     FfxNode gif;
     FfxNode menu;
+    FfxNode title;
 } State;
 
+// The player streaming the delta-encoded videos from the media partition,
+// with its working buffer and flash read cache; these are allocated once
+// and kept, since the scene may still be rendering the frame while the
+// panel slides out
+static Media media = { 0 };
+static MediaVideo player = { 0 };
+static Playback playback = { 0 };
+static const MediaClip *playerClip = NULL;
+static uint16_t *frameBuffer = NULL;
+static uint8_t *cacheBuffer = NULL;
+
 static void animateMenu(FfxNode menu, FfxNodeAnimation *animation, void *arg) {
     int32_t x = *(int*)arg;
     animation->duration = 1000;
@@ -28,162 +46,114 @@ static void animateMenu(FfxNode menu, FfxNodeAnimation *animation, void *arg) {
     ffx_sceneNode_setPosition(menu, ffx_point(x, 0));
 }
 
+static void showMenu(State *state, bool show) {
+    if (state->menuHidden == !show) { return; }
+
+    ffx_sceneNode_stopAnimations(state->menu, FfxSceneActionStopCurrent);
+    int32_t x = show ? 0: 240;
+    ffx_sceneNode_animate(state->menu, animateMenu, &x);
+    state->menuHidden = !show;
+}
+
 static void onKeys(FfxEvent event, FfxEventProps props, void *_state) {
     State *state = _state;
 
     switch(props.keys.down) {
         case FfxKeyCancel:
-            state->video = 0;
             if (state->menuHidden) {
-                ffx_sceneNode_stopAnimations(state->menu,
-                   FfxSceneActionStopCurrent);
-                int32_t x = 0;
-                ffx_sceneNode_animate(state->menu, animateMenu, &x);
-                state->menuHidden = false;
+                showMenu(state, true);
             } else {
                 ffx_popPanel(42);
             }
             break;
         case FfxKeyOk:
-            state->video = 1;
-            if (!state->menuHidden) {
-                ffx_sceneNode_stopAnimations(state->menu,
-                  FfxSceneActionStopCurrent);
-                int32_t x = 240;
-                ffx_sceneNode_animate(state->menu, animateMenu, &x);
-                state->menuHidden = true;
-            }
+            showMenu(state, state->menuHidden);
             break;
         case FfxKeyNorth:
-            state->video = 2;
-            if (!state->menuHidden) {
-                ffx_sceneNode_stopAnimations(state->menu,
-                  FfxSceneActionStopCurrent);
-                int32_t x = 240;
-                ffx_sceneNode_animate(state->menu, animateMenu, &x);
-                state->menuHidden = true;
-            }
+            state->clip = (state->clip + MEDIA_CLIP_COUNT - 1) %
+              MEDIA_CLIP_COUNT;
+            ffx_sceneLabel_setText(state->title, mediaClips[state->clip].title);
             break;
         case FfxKeySouth:
-            state->video = 3;
-            if (!state->menuHidden) {
-                ffx_sceneNode_stopAnimations(state->menu,
-                  FfxSceneActionStopCurrent);
-                int32_t x = 240;
-                ffx_sceneNode_animate(state->menu, animateMenu, &x);
-                state->menuHidden = true;
-            }
+            state->clip = (state->clip + 1) % MEDIA_CLIP_COUNT;
+            ffx_sceneLabel_setText(state->title, mediaClips[state->clip].title);
             break;
     }
 }
 
-static void setFoxFrame(FfxNode node) {
-    const size_t frameCount = 47;
-
-    // 20 fps
-    uint32_t frame = (ticks() / 50) % frameCount;
-
-    const uint16_t *frames[] = {
-        image_fox_0, image_fox_1, image_fox_2, image_fox_3, image_fox_4,
-        image_fox_5, image_fox_6, image_fox_7, image_fox_8, image_fox_9,
-        image_fox_10, image_fox_11, image_fox_12, image_fox_13,
-        image_fox_14, image_fox_15, image_fox_16, image_fox_17,
-        image_fox_18, image_fox_19, image_fox_20, image_fox_21,
-        image_fox_22, image_fox_23, image_fox_24, image_fox_25,
-        image_fox_26, image_fox_27, image_fox_28, image_fox_29,
-        image_fox_30, image_fox_31, image_fox_32, image_fox_33,
-        image_fox_34, image_fox_35, image_fox_36, image_fox_37,
-        image_fox_38, image_fox_39, image_fox_40, image_fox_41,
-        image_fox_42, image_fox_43, image_fox_44, image_fox_45,
-        image_fox_46
-    };
-
-    const uint16_t *imgData = frames[frame];
-    ffx_sceneImage_setData(node, imgData, sizeof(image_fox_0));
+static uint16_t getDuration(void *arg, uint32_t frame) {
+    return videoGetDuration(arg, frame);
 }
 
-static void setNyanFrame(FfxNode node) {
-    const size_t frameCount = 8;
+static void setVideoFrame(State *state, const MediaClip *clip) {
+    Video *video = &player.video;
+
+    if (playerClip != clip) {
+        if (playerClip) {
+            printf("[gifs] %s: shown=%ld dropped=%ld late=%ld\n",
+              playerClip->name,
+              playback.stats.shown, playback.stats.dropped,
+              playback.stats.late);
+            PROFILE_DUMP("gifs");
+        }
+
+        mediaVideoClose(&player);
+        playerClip = clip;
+        if (!mediaVideoOpenClip(&player, &media, clip, frameBuffer,
+          VIDEO_IMAGE_SIZE(WIDTH, HEIGHT), cacheBuffer)) {
+            return;
+        }
+
+        playbackInit(&playback, video->frameCount, getDuration, video,
+          PlaybackPolicySkip);
+    }
 
-    // 10 fps
-    uint32_t frame = (ticks() / 100) % frameCount;
+    if (video->data == NULL) { return; }
 
-    const uint16_t *frames[] = {
-        image_nyan_0, image_nyan_1, image_nyan_2, image_nyan_3,
-        image_nyan_4, image_nyan_5, image_nyan_6, image_nyan_7
-    };
+    // Nothing to do until the current frame has been shown for its duration
+    if (!playbackUpdate(&playback, ticks())) { return; }
 
-    const uint16_t *imgData = frames[frame];
-    ffx_sceneImage_setData(node, imgData, sizeof(image_nyan_0));
+    // Only the tiles which changed are patched into the working buffer
+    if (videoSeek(video, playback.frame)) {
+        ffx_sceneImage_setData(state->gif, video->image, video->imageSize);
+    }
 }
 
-static void setShibaFrame(FfxNode node) {
-
-    const size_t frameCount = 13;
+static void onRender(FfxEvent event, FfxEventProps props, void *_state) {
+    State *state = _state;
 
-    // 10 fps
-    uint32_t frame = (ticks() / 100) % frameCount;
+    PROFILE_FRAME();
+    PROFILE_BEGIN(t0);
 
-    const uint16_t *frames[] = {
-        image_shiba_0, image_shiba_1, image_shiba_2, image_shiba_3,
-        image_shiba_4, image_shiba_5, image_shiba_6, image_shiba_7,
-        image_shiba_8, image_shiba_9, image_shiba_10, image_shiba_11,
-        image_shiba_12
-    };
+    setVideoFrame(state, &mediaClips[state->clip]);
 
-    const uint16_t *imgData = frames[frame];
-    ffx_sceneImage_setData(node, imgData, sizeof(image_fox_0));
+    PROFILE_END(t0, ProfilerKindUpdate, PROFILER_FRAGMENTS, 0);
 }
 
-static void setRrollFrame(FfxNode node) {
-    const size_t frameCount = 27;
-
-    // 12.5 fps
-    uint32_t frame = (ticks() / 80) % frameCount;
-
-    const uint16_t *frames[] = {
-        image_rroll_0, image_rroll_1, image_rroll_2, image_rroll_3,
-        image_rroll_4, image_rroll_5, image_rroll_6, image_rroll_7,
-        image_rroll_8, image_rroll_9, image_rroll_10, image_rroll_11,
-        image_rroll_12, image_rroll_13, image_rroll_14, image_rroll_15,
-        image_rroll_16, image_rroll_17, image_rroll_18, image_rroll_19,
-        image_rroll_20, image_rroll_21, image_rroll_22, image_rroll_23,
-        image_rroll_24, image_rroll_25, image_rroll_26
-    };
+static int initFunc(FfxScene scene, FfxNode node, void *_state, void *arg) {
+    State *state = _state;
+    state->scene = scene;
 
-    const uint16_t *imgData = frames[frame];
-    ffx_sceneImage_setData(node, imgData, sizeof(image_rroll_0));
-}
+    if (frameBuffer == NULL) {
+        frameBuffer = calloc(1, VIDEO_IMAGE_SIZE(WIDTH, HEIGHT));
+        assert(frameBuffer);
 
+        // Black until a frame is decoded (e.g. the media is not flashed)
+        frameBuffer[0] = VIDEO_IMAGE_FORMAT;
+        frameBuffer[1] = WIDTH;
+        frameBuffer[2] = HEIGHT;
 
-static void onRender(FfxEvent event, FfxEventProps props, void *_state) {
-    State *state = _state;
+        cacheBuffer = mediaAllocCache();
+        assert(cacheBuffer);
 
-    switch (state->video) {
-        case 0:
-            setShibaFrame(state->gif);
-            break;
-        case 1:
-            setNyanFrame(state->gif);
-            break;
-        case 2:
-            setFoxFrame(state->gif);
-            break;
-        case 3:
-            setRrollFrame(state->gif);
-            break;
+        mediaOpen(&media, MEDIA_PARTITION);
     }
-}
-
-static int initFunc(FfxScene scene, FfxNode node, void *_state, void *arg) {
-    State *state = _state;
-    state->scene = scene;
 
-    FfxNode gif = ffx_scene_createImage(scene, image_nyan_0,
-      sizeof(image_nyan_0));
+    FfxNode gif = ffx_scene_createImage(scene, frameBuffer,
+      VIDEO_IMAGE_SIZE(WIDTH, HEIGHT));
     state->gif = gif;
     ffx_sceneGroup_appendChild(node, gif);
-    setShibaFrame(gif);
+    setVideoFrame(state, &mediaClips[state->clip]);
 
     FfxNode menu = ffx_scene_createGroup(scene);
     state->menu = menu;
@@ -198,19 +168,21 @@ static int initFunc(FfxScene scene, FfxNode node, void *_state, void *arg) {
     ffx_sceneLabel_setAlign(text, FfxTextAlignRight | FfxTextAlignMiddle);
     ffx_sceneLabel_setOutlineColor(text, ffx_color_rgb(0, 0, 0));
 
-    text = ffx_scene_createLabel(scene, FfxFontLarge, "  Nyan");
+    text = ffx_scene_createLabel(scene, FfxFontLarge,
+      mediaClips[state->clip].title);
+    state->title = text;
     ffx_sceneGroup_appendChild(menu, text);
     ffx_sceneNode_setPosition(text, (FfxPoint){ .x = 230, .y = 84 });
     ffx_sceneLabel_setAlign(text, FfxTextAlignRight | FfxTextAlignMiddle);
     ffx_sceneLabel_setOutlineColor(text, ffx_color_rgb(0, 0, 0));
 
-    text = ffx_scene_createLabel(scene, FfxFontLarge, "   Fox");
+    text = ffx_scene_createLabel(scene, FfxFontLarge, "prev");
     ffx_sceneGroup_appendChild(menu, text);
     ffx_sceneNode_setPosition(text, (FfxPoint){ .x = 230, .y = 156 });
     ffx_sceneLabel_setAlign(text, FfxTextAlignRight | FfxTextAlignMiddle);
     ffx_sceneLabel_setOutlineColor(text, ffx_color_rgb(0, 0, 0));
 
-    text = ffx_scene_createLabel(scene, FfxFontLarge, "R-Roll");
+    text = ffx_scene_createLabel(scene, FfxFontLarge, "next");
     ffx_sceneGroup_appendChild(menu, text);
     ffx_sceneNode_setPosition(text, (FfxPoint){ .x = 230, .y = 226 });
     ffx_sceneLabel_setAlign(text, FfxTextAlignRight | FfxTextAlignMiddle);
@@ -1,4 +1,6 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "firefly-color.h"
 #include "firefly-hollows.h"
@@ -9,12 +11,99 @@
 
 #define WIDTH     (200)
 
-#define  TAG_BASE       (10)
-
 #define DURATION_HIGHLIGHT    (300)
 
 #define COLOR_ENTRY           (0x00444488)
 
+#define COLOR_HR              (ffx_color_rgb(92, 168, 199))
+#define COLOR_CARET           (0x007777aa)
+
+#define FONT_TITLE         (FfxFontSmallBold)
+#define COLOR_TITLE        (ffx_color_rgb(120, 120, 120))
+
+#define FONT_HEADING       (FfxFontSmall)
+#define COLOR_HEADING      (ffx_color_rgb(200, 200, 200))
+
+#define FONT_VALUE         (FfxFontMediumBold)
+#define COLOR_VALUE        (COLOR_WHITE)
+
+#define FONT_CARET         (FfxFontLargeBold)
+
+#define SCREEN_HEIGHT         (240)
+
+// Rows are only built while within this distance (px) of the screen,
+// so scrolling reveals rows which already exist
+#define MARGIN                (40)
+
+// The content is kept as a compact list of rows (an entry or button is
+// a single row); nodes are only built for the rows near the screen, from
+// pools which are recycled while scrolling, so the number of nodes does
+// not depend on the length of the content. Should a pool run short (e.g.
+// while both ends of a long scroll are built), rows are built once nodes
+// are released.
+#define MAX_ROWS              (INFO_MAX_ROWS)
+#define MAX_TEXT              (2048)
+#define MAX_LABELS            (40)
+#define MAX_BOXES             (24)
+
+// Longest text of a formatted row
+#define MAX_FORMAT            (64)
+
+
+typedef enum RowKind {
+    RowKindText = 0,
+    RowKindHR,
+    RowKindEntry,
+    RowKindButton,
+
+    // Text from the format function, only once built
+    RowKindFormat,
+} RowKind;
+
+// The labels of a row
+#define LABEL_TEXT            (0)
+#define LABEL_VALUE           (1)
+#define LABEL_CARET           (2)
+#define LABEL_COUNT           (3)
+
+typedef struct Row {
+    // Within the info group
+    int16_t y;
+    int16_t height;
+
+    uint8_t kind;
+    bool caret;
+
+    // Of the text and value labels, within the row
+    uint8_t offsets[2];
+
+    // Of the highlight (entries and buttons)
+    int16_t index;
+    uint16_t userData;
+
+    // Of the text and value, in the text pool
+    uint16_t text[2];
+
+    // Of text rows
+    FfxFont font;
+
+    // Of the text, rule or highlight
+    color_ffxt color;
+
+    // Slots in the pools, or -1; only while built
+    bool built;
+    int8_t box;
+    int8_t labels[LABEL_COUNT];
+} Row;
+
+typedef struct Slot {
+    FfxNode node;
+    bool used;
+
+    // Labels are only reused for the same font (and carets for carets)
+    FfxFont font;
+    bool caret;
+} Slot;
 
 typedef struct State {
     FfxScene scene;
@@ -22,116 +111,450 @@ typedef struct State {
 
     FfxNode info;      // container of all fields
     FfxNode box;       // background of info
+    FfxNode back;      // highlights and rules, behind...
+    FfxNode front;     // ...the text
     int offset;
 
     int lastHR;
 
     int nextIndex;
 
-    FfxNode active;
+    // The selected highlight
     int index;
 
+    Row rows[MAX_ROWS];
+    size_t rowCount;
+
+    // The row of each highlight, so navigating does not search the rows
+    uint8_t highlights[MAX_ROWS];
+
+    char text[MAX_TEXT];
+    size_t textLength;
+
+    Slot labels[MAX_LABELS];
+    size_t labelCount;
+
+    Slot boxes[MAX_BOXES];
+    size_t boxCount;
+
+    // Where the info group is scrolling to, and where it was when the
+    // rows were last laid out
+    int32_t scrollY;
+    int32_t layoutY;
+
+    // Rows near the screen are waiting for nodes
+    bool incomplete;
+
     InfoSelectFunc selectFunc;
+    InfoFormatFunc formatFunc;
+
+    // Rows still to be appended, on the first frame
+    InfoFillFunc fillFunc;
 
     // Child state goes here
 } State;
 
 
-typedef struct Button {
-    int16_t userData;
-} Button;
+static int getTextHeight(FfxFont font) {
+    FfxFontMetrics metrics = ffx_scene_getFontMetrics(font);
+    return metrics.size.height -  metrics.descent;
+}
+
 
-static FfxNode appendHighlight(State *state, color_ffxt color,
-  int16_t userData) {
+/////////////////////////////
+// Rows
 
-    int index = state->nextIndex++;
+static Row* appendRow(State *state, RowKind kind) {
+    if (state->rowCount == MAX_ROWS) {
+        printf("[info] too many rows\n");
+        return NULL;
+    }
 
-    FfxNode glow = ffx_scene_createBox(state->scene, ffx_size(180, 25));
-    ffx_sceneBox_setColor(glow, ffx_color_setOpacity(color, 0));
+    Row *row = &state->rows[state->rowCount++];
+    memset(row, 0, sizeof(Row));
+    row->y = state->offset;
+    row->kind = kind;
+    row->index = -1;
 
-    FfxNode anchor = ffx_scene_createAnchor(state->scene, TAG_BASE + index,
-      sizeof(Button), glow);
-    ffx_sceneNode_setPosition(anchor, ffx_point(10, state->offset));
-    Button *button = ffx_sceneAnchor_getData(anchor);
-    button->userData = userData;
-    ffx_sceneGroup_appendChild(state->info, anchor);
+    return row;
+}
 
-    if (state->active == NULL && userData) {
-        ffx_sceneBox_setColor(glow, ffx_color_setOpacity(color, OPACITY_80));
-        state->active = anchor;
-        state->index = index;
+// Copy %text% into the pool, as rows may be built long after the
+// caller's string is gone; returns its offset
+static uint16_t appendString(State *state, const char *text) {
+    size_t length = strlen(text);
+    if (state->textLength + length + 1 > MAX_TEXT) {
+        printf("[info] text pool full\n");
+        if (state->textLength == MAX_TEXT) { return MAX_TEXT - 1; }
+        length = 0;
     }
 
-    return glow;
+    uint16_t offset = state->textLength;
+    memcpy(&state->text[offset], text, length);
+    state->text[offset + length] = 0;
+    state->textLength += length + 1;
+
+    return offset;
 }
 
-static bool highlight(State *state, uint32_t index) {
-    FfxNode target = ffx_sceneNode_findAnchor(state->panel, TAG_BASE + index);
+static Row* findHighlight(State *state, int index) {
+    if (index < 0 || index >= state->nextIndex) { return NULL; }
+    return &state->rows[state->highlights[index]];
+}
 
-    if (target == NULL) { return false; }
+static color_ffxt getHighlightColor(State *state, Row *row) {
+    bool on = (row->index == state->index && row->userData);
+    return ffx_color_setOpacity(row->color, on ? OPACITY_80: 0);
+}
 
-    Button *button = ffx_sceneAnchor_getData(target);
 
-    state->index = index;
+/////////////////////////////
+// Node pools
+
+static int acquireLabel(State *state, FfxFont font, bool caret,
+  const char *text) {
 
-    // Turn off existing highlight @TODO: use node_find
-    if (state->active) {
-        FfxNode glow = ffx_sceneAnchor_getChild(state->active);
-        color_ffxt color = ffx_sceneBox_getColor(glow);
-        ffx_sceneNode_stopAnimations(glow, false);
-        ffx_sceneBox_animateColor(glow,
-          ffx_color_setOpacity(color, 0), 0, 300, FfxCurveLinear, NULL, NULL);
+    for (size_t i = 0; i < state->labelCount; i++) {
+        Slot *slot = &state->labels[i];
+        if (slot->used || slot->font != font || slot->caret != caret) {
+            continue;
+        }
+
+        slot->used = true;
+        ffx_sceneLabel_setText(slot->node, text);
+        ffx_sceneNode_setHidden(slot->node, false);
+        return i;
     }
 
-    // Turn on highlight
-    state->active = target;
+    if (state->labelCount == MAX_LABELS) { return -1; }
+
+    Slot *slot = &state->labels[state->labelCount];
+    slot->used = true;
+    slot->font = font;
+    slot->caret = caret;
+    slot->node = ffx_scene_createLabel(state->scene, font, text);
+    ffx_sceneGroup_appendChild(state->front, slot->node);
+
+    if (caret) {
+        ffx_sceneLabel_setTextColor(slot->node, COLOR_CARET);
+        ffx_sceneLabel_setOutlineColor(slot->node, COLOR_BLACK);
+    } else {
+        ffx_sceneLabel_setAlign(slot->node,
+          FfxTextAlignTop | FfxTextAlignCenter);
+    }
 
-    FfxNode glow = ffx_sceneAnchor_getChild(state->active);
-    color_ffxt color = ffx_sceneBox_getColor(glow);
-    ffx_sceneNode_stopAnimations(glow, false);
+    return state->labelCount++;
+}
+
+static int acquireBox(State *state) {
+    for (size_t i = 0; i < state->boxCount; i++) {
+        Slot *slot = &state->boxes[i];
+        if (slot->used) { continue; }
 
-    if (button->userData) {
-        ffx_sceneBox_animateColor(glow, ffx_color_setOpacity(color, OPACITY_80),
-          0, 300, FfxCurveLinear, NULL, NULL);
+        slot->used = true;
+        ffx_sceneNode_setHidden(slot->node, false);
+        return i;
     }
 
-    // Scroll highlight onto screen
+    if (state->boxCount == MAX_BOXES) { return -1; }
 
-    if (ffx_sceneBox_getSize(state->box).height <= 200) {
-        // Infobox is too small to scroll
-        return true;
-    };
+    Slot *slot = &state->boxes[state->boxCount];
+    slot->used = true;
+    slot->node = ffx_scene_createBox(state->scene, ffx_size(1, 1));
+    ffx_sceneGroup_appendChild(state->back, slot->node);
+
+    return state->boxCount++;
+}
+
+static FfxNode getBox(State *state, Row *row) {
+    if (row->box == -1) { return NULL; }
+    return state->boxes[row->box].node;
+}
+
+static FfxNode getLabel(State *state, Row *row, int label) {
+    if (row->labels[label] == -1) { return NULL; }
+    return state->labels[row->labels[label]].node;
+}
+
+// False if the pool is exhausted
+static bool placeLabel(State *state, Row *row, int label, const char *text,
+  FfxFont font, color_ffxt color) {
+
+    row->labels[label] = acquireLabel(state, font, false, text);
+
+    FfxNode node = getLabel(state, row, label);
+    if (node == NULL) { return false; }
+
+    ffx_sceneLabel_setTextColor(node, color);
+    ffx_sceneNode_setPosition(node,
+      ffx_point(WIDTH / 2, row->y + row->offsets[label]));
+
+    return true;
+}
+
+// Place a label with its text from the pool
+static bool placeText(State *state, Row *row, int label, FfxFont font,
+  color_ffxt color) {
+
+    return placeLabel(state, row, label, &state->text[row->text[label]],
+      font, color);
+}
+
+// False if the pool is exhausted
+static bool placeBox(State *state, Row *row, FfxPoint position,
+  FfxSize size, color_ffxt color) {
+
+    row->box = acquireBox(state);
+
+    FfxNode node = getBox(state, row);
+    if (node == NULL) { return false; }
+
+    ffx_sceneBox_setSize(node, size);
+    ffx_sceneBox_setColor(node, color);
+    ffx_sceneNode_setPosition(node, position);
+
+    return true;
+}
+
+static void releaseRow(State *state, Row *row) {
+    FfxNode box = getBox(state, row);
+    if (box) {
+        ffx_sceneNode_stopAnimations(box, false);
+        ffx_sceneNode_setHidden(box, true);
+        state->boxes[row->box].used = false;
+    }
+
+    for (int i = 0; i < LABEL_COUNT; i++) {
+        FfxNode label = getLabel(state, row, i);
+        if (label == NULL) { continue; }
+        ffx_sceneNode_setHidden(label, true);
+        state->labels[row->labels[i]].used = false;
+    }
+
+    row->built = false;
+}
+
+// Build the nodes of %row%; if any pool is exhausted, the row is left
+// unbuilt (holding no nodes), to be built by a later layout
+static bool buildRow(State *state, Row *row) {
+    row->built = true;
+    row->box = -1;
+    memset(row->labels, -1, sizeof(row->labels));
+
+    bool placed = true;
+
+    switch (row->kind) {
+        case RowKindText:
+            placed = placeText(state, row, LABEL_TEXT, row->font, row->color);
+            break;
+
+        case RowKindFormat: {
+            char text[MAX_FORMAT] = { 0 };
+            state->formatFunc(&state[1], row->userData, text, sizeof(text));
+            placed = placeLabel(state, row, LABEL_TEXT, text, row->font,
+              row->color);
+            break;
+        }
+
+        case RowKindHR:
+            placed = placeBox(state, row, ffx_point(15, row->y),
+              ffx_size(WIDTH - 30, 1), row->color);
+            break;
+
+        case RowKindEntry:
+            placed = placeBox(state, row, ffx_point(10, row->y),
+              ffx_size(180, row->height), getHighlightColor(state, row)) &&
+              placeText(state, row, LABEL_TEXT, FONT_HEADING, COLOR_HEADING) &&
+              placeText(state, row, LABEL_VALUE, FONT_VALUE, COLOR_VALUE);
+
+            if (placed && row->caret) {
+                row->labels[LABEL_CARET] = acquireLabel(state, FONT_CARET,
+                  true, ">");
+                FfxNode caret = getLabel(state, row, LABEL_CARET);
+                if (caret) {
+                    ffx_sceneNode_setPosition(caret, ffx_point(188,
+                      row->y + (row->height / 2) - 10));
+                } else {
+                    placed = false;
+                }
+            }
+            break;
+
+        case RowKindButton:
+            placed = placeBox(state, row, ffx_point(10, row->y),
+              ffx_size(180, row->height), getHighlightColor(state, row)) &&
+              placeText(state, row, LABEL_TEXT, FONT_VALUE, COLOR_VALUE);
+            break;
+    }
+
+    if (!placed) { releaseRow(state, row); }
+
+    return placed;
+}
+
+// Whether %row% is within the span %top% to %bottom% of the info group
+// (plus the margin)
+static bool inSpan(Row *row, int32_t top, int32_t bottom) {
+    return (row->y + row->height >= top - MARGIN &&
+      row->y <= bottom + MARGIN);
+}
+
+// Build the rows near the screen, both where the info group is now and
+// where it is scrolling to, and release the rest; the rows in between
+// are built as the scroll reaches them (see onRender)
+static void layout(State *state) {
+    int32_t y = ffx_sceneNode_getPosition(state->info).y;
+
+    // Look ahead as far as the scroll moved since the last layout, as it
+    // moves again before the next
+    int32_t top = -y, bottom = -y + SCREEN_HEIGHT;
+    int32_t ahead = abs(y - state->layoutY);
+    if (state->scrollY < y) {
+        bottom += ahead;
+    } else {
+        top -= ahead;
+    }
+
+    int32_t targetTop = -state->scrollY;
+    int32_t targetBottom = targetTop + SCREEN_HEIGHT;
+
+    // Release first, so the nodes can be reused
+    for (size_t i = 0; i < state->rowCount; i++) {
+        Row *row = &state->rows[i];
+        if (!row->built) { continue; }
+        if (inSpan(row, top, bottom) ||
+          inSpan(row, targetTop, targetBottom)) {
+            continue;
+        }
+        releaseRow(state, row);
+    }
+
+    // The rows on screen first, should a pool run short
+    state->incomplete = false;
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < state->rowCount; i++) {
+            Row *row = &state->rows[i];
+            if (row->built) { continue; }
+
+            bool near = pass ? inSpan(row, targetTop, targetBottom):
+              inSpan(row, top, bottom);
+            if (near && !buildRow(state, row)) { state->incomplete = true; }
+        }
+    }
+
+    state->layoutY = y;
+}
+
+static void adjust(State *state);
+
+// Append the rows deferred by setFillFunc, and lay them out
+static void fill(State *state) {
+    InfoFillFunc fillFunc = state->fillFunc;
+    state->fillFunc = NULL;
+
+    fillFunc(state, &state[1]);
+
+    appendHR(state);
+    adjust(state);
+    layout(state);
+}
+
+// Follow the scroll, building the rows nearing the screen and releasing
+// those left behind; rows without nodes are retried each frame
+static void onRender(FfxEvent event, FfxEventProps props, void *_state) {
+    State *state = _state;
+
+    if (state->fillFunc) {
+        fill(state);
+        return;
+    }
+
+    int32_t y = ffx_sceneNode_getPosition(state->info).y;
+    if (y == state->layoutY && !state->incomplete) { return; }
+
+    layout(state);
+}
+
+
+/////////////////////////////
+// Highlights
+
+static Row* appendHighlight(State *state, RowKind kind, color_ffxt color,
+  int16_t userData) {
+
+    Row *row = appendRow(state, kind);
+    if (row == NULL) { return NULL; }
+
+    // Rows are never removed, so neither index can exceed MAX_ROWS
+    int index = state->nextIndex++;
+    state->highlights[index] = row - state->rows;
+
+    if (state->index == -1 && userData) { state->index = index; }
+
+    row->index = index;
+    row->userData = userData;
+    row->color = color;
+
+    return row;
+}
+
+// Scroll the info group to %y%; the rows there are built now, and those
+// passed on the way as the scroll reaches them
+static void scrollTo(State *state, int32_t y) {
+    ffx_sceneNode_stopAnimations(state->info, false);
+
+    state->scrollY = y;
+    layout(state);
 
     FfxPoint pos = ffx_sceneNode_getPosition(state->info);
-    int32_t y = ffx_sceneNode_getPosition(target).y;
-    int32_t h = ffx_sceneBox_getSize(glow).height;
-
-    if (index == 0) {
-        ffx_sceneNode_stopAnimations(state->info, false);
-        pos.y = 20;
-        ffx_sceneNode_animatePosition(state->info, pos, 0, 300,
-          FfxCurveEaseOutQuad, NULL, NULL);
-
-    } else if (index + 1 == state->nextIndex) {
-        int32_t H = ffx_sceneBox_getSize(state->box).height;
-        ffx_sceneNode_stopAnimations(state->info, false);
-        pos.y = -(H + 20 - 240);
-        ffx_sceneNode_animatePosition(state->info, pos, 0, 300,
-          FfxCurveEaseOutQuad, NULL, NULL);
-
-    } else if (y + h + pos.y > 200) {
-        ffx_sceneNode_stopAnimations(state->info, false);
-        pos.y = -(y + h - 200);
-        ffx_sceneNode_animatePosition(state->info, pos, 0, 300,
-          FfxCurveEaseOutQuad, NULL, NULL);
-
-    } else if (y + pos.y < 40) {
-        ffx_sceneNode_stopAnimations(state->info, false);
-        pos.y = -(y - 40);
-        ffx_sceneNode_animatePosition(state->info, pos, 0, 300,
-          FfxCurveEaseOutQuad, NULL, NULL);
+    pos.y = y;
+    ffx_sceneNode_animatePosition(state->info, pos, 0, DURATION_HIGHLIGHT,
+      FfxCurveEaseOutQuad, NULL, NULL);
+}
+
+static void animateHighlight(State *state, Row *row) {
+    FfxNode glow = getBox(state, row);
+    if (glow == NULL) { return; }
+
+    ffx_sceneNode_stopAnimations(glow, false);
+    ffx_sceneBox_animateColor(glow, getHighlightColor(state, row), 0,
+      DURATION_HIGHLIGHT, FfxCurveLinear, NULL, NULL);
+}
+
+static bool highlight(State *state, uint32_t index) {
+    Row *target = findHighlight(state, index);
+
+    if (target == NULL) { return false; }
+
+    Row *previous = findHighlight(state, state->index);
+
+    state->index = index;
+
+    // Scroll highlight onto screen, first, so it is built
+
+    int32_t H = ffx_sceneBox_getSize(state->box).height;
+
+    // Otherwise, the infobox is too small to scroll
+    if (H > 200) {
+        FfxPoint pos = ffx_sceneNode_getPosition(state->info);
+        int32_t y = target->y;
+        int32_t h = target->height;
+
+        if (index == 0) {
+            scrollTo(state, 20);
+        } else if (index + 1 == state->nextIndex) {
+            scrollTo(state, -(H + 20 - 240));
+        } else if (y + h + pos.y > 200) {
+            scrollTo(state, -(y + h - 200));
+        } else if (y + pos.y < 40) {
+            scrollTo(state, -(y - 40));
+        }
     }
 
+    // Turn off existing highlight and turn on the new one
+    if (previous) { animateHighlight(state, previous); }
+    animateHighlight(state, target);
+
     return true;
 }
 
@@ -139,11 +562,10 @@ static bool selectHighlight(State *state) {
     int index = state->index;
     if (index == -1) { return false; }
 
-    FfxNode node = ffx_sceneNode_findAnchor(state->panel, TAG_BASE + index);
-    if (node == NULL) { return false; }
+    Row *row = findHighlight(state, index);
+    if (row == NULL) { return false; }
 
-    Button *button = ffx_sceneAnchor_getData(node);
-    state->selectFunc(&state[1], button->userData);
+    state->selectFunc(&state[1], row->userData);
 
     return true;
 }
@@ -154,29 +576,50 @@ void appendPadding(void *infoState, size_t size) {
     state->offset += size;
 }
 
-#define FONT_TITLE         (FfxFontSmallBold)
-#define COLOR_TITLE        (ffx_color_rgb(120, 120, 120))
+void appendText(void *infoState, const char* text, FfxFont font,
+  color_ffxt color) {
 
-#define FONT_HEADING       (FfxFontSmall)
-#define COLOR_HEADING      (ffx_color_rgb(200, 200, 200))
+    State *state = infoState;
 
-#define FONT_VALUE         (FfxFontMediumBold)
-#define COLOR_VALUE        (COLOR_WHITE)
+    int height = getTextHeight(font);
 
-void appendText(void *infoState, const char* text, FfxFont font,
-  color_ffxt color) {
+    Row *row = appendRow(state, RowKindText);
+    if (row) {
+        row->height = height;
+        row->font = font;
+        row->color = color;
+        row->text[LABEL_TEXT] = appendString(state, text);
+    }
+
+    state->offset += height;
+}
 
+void setFormatFunc(void *infoState, InfoFormatFunc formatFunc) {
     State *state = infoState;
+    state->formatFunc = formatFunc;
+}
 
-    FfxFontMetrics metrics = ffx_scene_getFontMetrics(font);
+void setFillFunc(void *infoState, InfoFillFunc fillFunc) {
+    State *state = infoState;
+    state->fillFunc = fillFunc;
+}
+
+void appendFormatted(void *infoState, FfxFont font, color_ffxt color,
+  uint16_t userData) {
+
+    State *state = infoState;
 
-    FfxNode label = ffx_scene_createLabel(state->scene, font, text);
-    ffx_sceneGroup_appendChild(state->info, label);
-    ffx_sceneLabel_setAlign(label, FfxTextAlignTop | FfxTextAlignCenter);
-    ffx_sceneLabel_setTextColor(label, color);
-    ffx_sceneNode_setPosition(label, ffx_point(WIDTH / 2, state->offset));
+    int height = getTextHeight(font);
 
-    state->offset += metrics.size.height -  metrics.descent;
+    Row *row = appendRow(state, RowKindFormat);
+    if (row) {
+        row->height = height;
+        row->font = font;
+        row->color = color;
+        row->userData = userData;
+    }
+
+    state->offset += height;
 }
 
 void appendHR(void *_state) {
@@ -186,10 +629,12 @@ void appendHR(void *_state) {
     if (state->lastHR + 1 == state->offset) { return; }
     state->lastHR = state->offset;
 
-    FfxNode hr = ffx_scene_createBox(state->scene, ffx_size(WIDTH - 30, 1));
-    ffx_sceneBox_setColor(hr, ffx_color_rgb(92, 168, 199));
-    ffx_sceneNode_setPosition(hr, ffx_point(15, state->offset));
-    ffx_sceneGroup_appendChild(state->info, hr);
+    Row *row = appendRow(state, RowKindHR);
+    if (row) {
+        row->height = 1;
+        row->color = COLOR_HR;
+    }
+
     state->offset += 1;
 }
 
@@ -218,28 +663,27 @@ void appendEntry(void *_state, const char* heading, const char* value,
     appendHR(state);
 
     state->offset += 3;
-    size_t top = state->offset;
-    FfxNode on = appendHighlight(state, COLOR_ENTRY, userData);
+    int top = state->offset;
+    Row *row = appendHighlight(state, RowKindEntry, COLOR_ENTRY, userData);
 
     state->offset += 10;
-    appendText(state, heading, FONT_HEADING, COLOR_HEADING);
+    int headingOffset = state->offset - top;
+    state->offset += getTextHeight(FONT_HEADING);
 
     state->offset += 8;
-    appendText(state, value, FONT_VALUE, COLOR_VALUE);
+    int valueOffset = state->offset - top;
+    state->offset += getTextHeight(FONT_VALUE);
 
     state->offset += 12;
 
-    // Resize the highlight to fill the entry
-    FfxSize boxSize = ffx_size(180, state->offset - top - 1);
-    ffx_sceneBox_setSize(on, boxSize);
-
-    if (userData && userData != PanelTxViewNoDrill) {
-        FfxNode caret = ffx_scene_createLabel(state->scene, FfxFontLargeBold, ">");
-        ffx_sceneLabel_setTextColor(caret, 0x007777aa);
-        ffx_sceneLabel_setOutlineColor(caret, COLOR_BLACK);
-        ffx_sceneNode_setPosition(caret,
-          ffx_point(188, top + (boxSize.height / 2) - 10));
-        ffx_sceneGroup_appendChild(state->info, caret);
+    if (row) {
+        // The highlight fills the entry
+        row->height = state->offset - top - 1;
+        row->offsets[LABEL_TEXT] = headingOffset;
+        row->offsets[LABEL_VALUE] = valueOffset;
+        row->text[LABEL_TEXT] = appendString(state, heading);
+        row->text[LABEL_VALUE] = appendString(state, value);
+        row->caret = (userData && userData != PanelTxViewNoDrill);
     }
 
     state->offset += 3;
@@ -253,14 +697,21 @@ void appendButton(void *_state, const char* label, color_ffxt color,
     State *state = _state;
 
     state->offset += 3;
-    size_t top = state->offset;
-    FfxNode on = appendHighlight(state, color, userData);
+    int top = state->offset;
+    Row *row = appendHighlight(state, RowKindButton, color, userData);
     state->offset += PADDING - 6;
 
-    appendText(state, label, FONT_VALUE, COLOR_VALUE);
+    int labelOffset = state->offset - top;
+    state->offset += getTextHeight(FONT_VALUE);
 
     state->offset += PADDING - 3;
-    ffx_sceneBox_setSize(on, ffx_size(180, state->offset - top - 1));
+
+    if (row) {
+        row->height = state->offset - top - 1;
+        row->offsets[LABEL_TEXT] = labelOffset;
+        row->text[LABEL_TEXT] = appendString(state, label);
+    }
+
     state->offset += 3;
 }
 
@@ -310,21 +761,36 @@ static int initFunc(FfxScene scene, FfxNode panel, void* _state, void* _arg) {
     ffx_sceneGroup_appendChild(panel, info);
     ffx_sceneNode_setPosition(info, ffx_point(20, 20));
 
-    FfxNode box = ffx_scene_createBox(scene, ffx_size(WIDTH, 400));
+    // Sized once the rows are known
+    FfxNode box = ffx_scene_createBox(scene, ffx_size(WIDTH, 0));
     state->box = box;
     ffx_sceneGroup_appendChild(info, box);
 
+    state->back = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(info, state->back);
+
+    state->front = ffx_scene_createGroup(scene);
+    ffx_sceneGroup_appendChild(info, state->front);
+
     InitArg *init = _arg;
     state->selectFunc = init->selectFunc;
 
     init->initFunc(state, &state[1], init->arg);
 
-    appendHR(state);
+    // Closed once any deferred rows are appended
+    if (state->fillFunc == NULL) { appendHR(state); }
 
     adjust(state);
 
+    // Only what is on screen (from the top)
+    state->scrollY = 20;
+    state->layoutY = 20;
+    layout(state);
+
     ffx_onEvent(FfxEventKeys, onKeys, state);
 
+    ffx_onEvent(FfxEventRenderScene, onRender, state);
+
     return 0;
 }
 
@@ -8,6 +8,11 @@ extern "C" {
 
 #define PADDING         (15)
 
+// Rows a panel can hold; each text, formatted line, entry, button and
+// rule is a row (an entry also adds the rules around it, unless one is
+// already there)
+#define INFO_MAX_ROWS   (160)
+
 
 typedef enum PanelTxView {
     PanelTxViewSummary    = 0,
@@ -23,6 +28,8 @@ typedef enum PanelTxView {
     // Used internally
     PanelTxActionReject   = 0x80,
     PanelTxActionApprove  = 0x81,
+    PanelTxActionNext     = 0x82,
+    PanelTxActionPrevious = 0x83,
 } PanelTxView;
 
 /*
@@ -59,6 +66,25 @@ void appendPadding(void *infoState, size_t size);
 typedef int (*InfoInitFunc)(void *infoState, void *state, void *arg);
 typedef void (*InfoSelectFunc)(void *state, uint16_t userData);
 
+// Fill %text% (of %length%) for the row appended with %userData%; called
+// each time the row nears the screen, so content need not be formatted
+// (or held) up front
+typedef void (*InfoFormatFunc)(void *state, uint16_t userData, char *text,
+  size_t length);
+
+void setFormatFunc(void *infoState, InfoFormatFunc formatFunc);
+
+// Append the remaining rows on the panel's first frame, rather than in
+// its init, so content which is slow to prepare is formatted while the
+// panel slides in (showing the rows appended during init until then)
+typedef void (*InfoFillFunc)(void *infoState, void *state);
+
+void setFillFunc(void *infoState, InfoFillFunc fillFunc);
+
+// A line of text from the format function
+void appendFormatted(void *infoState, FfxFont font, color_ffxt color,
+  uint16_t userData);
+
 int pushPanelInfo(InfoInitFunc initFunc, size_t stateSize,
   InfoSelectFunc selectFunc, void *arg);
 
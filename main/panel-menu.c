@@ -8,7 +8,7 @@
 #include "./panel-menu.h"
 #include "./panel-space.h"
 
-#include "images/image-arrow.h"
+#include "images.h"
 
 
 typedef struct State {
@@ -30,7 +30,7 @@ static void onKeys(FfxEvent event, FfxEventProps props, void *_app) {
                     result = pushPanelConnect();
                     break;
                 case 1:
-//                    result = pushPanelGifs(NULL);
+                    result = pushPanelGifs();
                     break;
                 case 2:
                     result = pushPanelSpace(NULL);
@@ -82,7 +82,7 @@ static int initFunc(FfxScene scene, FfxNode node, void *_app, void *arg) {
     ffx_sceneNode_setPosition(text, (FfxPoint){ .x = 70, .y = 143 });
 
     FfxNode cursor = ffx_scene_createImage(scene, image_arrow,
-      sizeof(image_arrow));
+      IMAGE_ARROW_SIZE);
     ffx_sceneGroup_appendChild(node, cursor);
     ffx_sceneNode_setPosition(cursor, (FfxPoint){ .x = 25, .y = 58 });
 
@@ -7,23 +7,106 @@
 #include "firefly-scene.h"
 #include "firefly-hollows.h"
 
+#include "damage.h"
+#include "entities.h"
+#include "game-loop.h"
+#include "profiler.h"
 #include "utils.h"
 
-#include "images/image-alien-1.h"
-#include "images/image-alien-2.h"
-#include "images/image-alien-boom.h"
-#include "images/image-bullet.h"
-#include "images/image-ship.h"
-#include "images/image-space.h"
+#include "images.h"
 
 #include "panel-space.h"
 
 
-#define ROWS        (4)
-#define COLS        (4)
-#define BULLETS     (5)
-
-// @TODO: Refactor this a LOT; was put together in a couple hours. :p
+// The formation and bullet counts may be overridden at build time
+// (e.g. -DSPACE_ROWS=5 -DSPACE_COLS=11)
+#ifndef SPACE_ROWS
+#define SPACE_ROWS  (4)
+#endif
+#ifndef SPACE_COLS
+#define SPACE_COLS  (4)
+#endif
+#ifndef SPACE_BULLETS
+#define SPACE_BULLETS   (5)
+#endif
+
+#define ROWS        (SPACE_ROWS)
+#define COLS        (SPACE_COLS)
+#define BULLETS     (SPACE_BULLETS)
+#define ALIENS      (ROWS * COLS)
+
+// Formations too tall for the screen are squeezed together
+#define SPACING_X   (30)
+#define SPACING_Y   ((COLS > 1 && 40 * (COLS - 1) + 26 > 240) ? \
+                      ((240 - 26) / (COLS - 1)): 40)
+
+// Entity indices
+#define SHIP            (0)
+#define FORMATION       (1)
+#define FIRST_ALIEN     (2)
+#define FIRST_BULLET    (FIRST_ALIEN + ALIENS)
+#define FIRST_BOOM      (FIRST_BULLET + BULLETS)
+#define ENTITY_COUNT    (FIRST_BOOM + BULLETS)
+
+_Static_assert(ENTITY_COUNT <= ENTITIES_MAX, "too many entities");
+
+#define SIZE_ALIENS     (ffx_size(SPACING_X * (ROWS - 1) + 20, \
+                          SPACING_Y * (COLS - 1) + 26))
+
+#define ORIGIN          (ffx_point(0, 0))
+
+// Logic runs at a fixed rate, independent of how fast the scene renders;
+// the positions drawn are interpolated between steps
+#define STEP_PERIOD     (33)
+
+// Speeds (pixels per second) and times (ms), as whole pixels or steps of
+// STEP_PERIOD
+#define PER_STEP(rate)  (((rate) * STEP_PERIOD + 500) / 1000)
+#define STEPS(ms)       (((ms) + STEP_PERIOD / 2) / STEP_PERIOD)
+
+#define SPEED_SHIP      (PER_STEP(60))
+#define SPEED_BULLET    (PER_STEP(60))
+
+// The formation sways up and down the screen, advancing a column each
+// time it reaches an edge, which takes two advances
+#define SPEED_SWAY      (PER_STEP(60))
+#define SPEED_ADVANCE   (PER_STEP(120))
+#define ADVANCE_COLUMN  (2 * SPEED_ADVANCE)
+
+// Each alien swaps its image in turn, one per DANCE_STEPS
+#define DANCE_STEPS     (STEPS(132))
+
+#define BOOM_STEPS      (STEPS(400))
+
+_Static_assert(SPEED_SHIP > 0 && SPEED_BULLET > 0 && SPEED_SWAY > 0 &&
+  SPEED_ADVANCE > 0 && DANCE_STEPS > 0, "STEP_PERIOD too short");
+
+// Frames slower than this are counted as over budget
+#define FRAME_BUDGET    (34)
+
+
+typedef enum Sprite {
+    SpriteNone = 0,
+    SpriteShip,
+    SpriteAlien1,
+    SpriteAlien2,
+    SpriteBullet,
+    SpriteBoom,
+} Sprite;
+
+typedef struct SpriteInfo {
+    const uint16_t *data;
+    size_t size;
+    FfxSize bounds;
+} SpriteInfo;
+
+static const SpriteInfo sprites[] = {
+    [SpriteShip] = { image_ship, IMAGE_SHIP_SIZE, { 36, 38 } },
+    [SpriteAlien1] = { image_alien1, IMAGE_ALIEN1_SIZE, { 20, 26 } },
+    [SpriteAlien2] = { image_alien2, IMAGE_ALIEN2_SIZE, { 20, 26 } },
+    [SpriteBullet] = { image_bullet, IMAGE_BULLET_SIZE, { 10, 8 } },
+    [SpriteBoom] = { image_alienboom, IMAGE_ALIENBOOM_SIZE, { 20, 26 } },
+};
 
 typedef struct SpaceState {
     bool running;
@@ -32,162 +115,254 @@ typedef struct SpaceState {
 
     FfxScene scene;
     FfxNode panel;
-    FfxNode ship;
-    FfxNode aliens;
-    FfxNode alien[ROWS * COLS];
-    FfxNode bullet[BULLETS];
-    FfxNode boom[BULLETS];
     uint8_t boomLife[BULLETS];
-    uint8_t dead[ROWS * COLS];
     uint32_t tick;
     FfxKeys keys;
+
+    GameLoop loop;
+
+    // The game state; the scene is only updated from it once per frame
+    Entities entities;
+    EntityGrid grid;
+
+    // Steps in which the grid dropped items, so could miss hits
+    uint32_t gridOverflows;
+
+    // The node for each entity and the sprite it shows (SpriteNone if
+    // hidden); aliens are children of the formation
+    FfxNode node[ENTITY_COUNT];
+    uint8_t shown[ENTITY_COUNT];
+
+    // Regions changed since the last render, and totals for tuning
+    Damage damage;
+    uint32_t damageFrames;
+    uint32_t damageFragments;
 } SpaceState;
 
-static void explodeShip(SpaceState *space) {
-    FfxPoint ship = ffx_sceneNode_getPosition(space->ship);
 
+static bool isAlien(int index) {
+    return (index >= FIRST_ALIEN && index < FIRST_ALIEN + ALIENS);
+}
+
+static FfxPoint getPosition(SpaceState *space, int index, bool latest) {
+    Entities *entities = &space->entities;
+    if (latest) { return ffx_point(entities->x[index], entities->y[index]); }
+    return ffx_point(
+      gameLoopLerp(&space->loop, entities->previousX[index],
+        entities->x[index]),
+      gameLoopLerp(&space->loop, entities->previousY[index],
+        entities->y[index]));
+}
+
+// Update the scene from the entities in a single pass; positions are
+// interpolated between steps unless %latest%
+static void syncScene(SpaceState *space, bool latest) {
+    Entities *entities = &space->entities;
+
+    // Aliens never move within the formation, which moves as a whole
+    FfxPoint formation = getPosition(space, FORMATION, latest);
+    damageMoveNode(&space->damage, space->node[FORMATION], ORIGIN, formation,
+      SIZE_ALIENS);
+
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        if (i == FORMATION) { continue; }
+
+        FfxNode node = space->node[i];
+
+        FfxPoint origin = ORIGIN, position;
+        if (isAlien(i)) {
+            origin = formation;
+            position = ffx_point(entities->x[i] - entities->x[FORMATION],
+              entities->y[i] - entities->y[FORMATION]);
+        } else {
+            position = getPosition(space, i, latest);
+        }
+
+        Sprite sprite = entitiesIsAlive(entities, i) ? entities->sprite[i]:
+          SpriteNone;
+        Sprite shown = space->shown[i];
+
+        if (sprite != shown) {
+            space->shown[i] = sprite;
+
+            FfxPoint current = ffx_sceneNode_getPosition(node);
+            FfxSize size = sprites[sprite ? sprite: shown].bounds;
+            damageAdd(&space->damage, (DamageRect){
+                .x = origin.x + current.x, .y = origin.y + current.y,
+                .width = size.width, .height = size.height
+            });
+
+            if (sprite == SpriteNone) {
+                ffx_sceneNode_setHidden(node, true);
+                continue;
+            }
+
+            ffx_sceneImage_setData(node, sprites[sprite].data,
+              sprites[sprite].size);
+
+            // Appearing; there is nothing to clear where it was hidden
+            if (shown == SpriteNone) {
+                ffx_sceneNode_setHidden(node, false);
+                ffx_sceneNode_setPosition(node, position);
+                damageAdd(&space->damage, (DamageRect){
+                    .x = origin.x + position.x, .y = origin.y + position.y,
+                    .width = size.width, .height = size.height
+                });
+                continue;
+            }
+        }
+
+        if (sprite == SpriteNone) { continue; }
+
+        damageMoveNode(&space->damage, node, origin, position,
+          sprites[sprite].bounds);
+    }
+}
+
+// Start an explosion at %x%, %y%
+static void addBoom(SpaceState *space, int16_t x, int16_t y) {
     for (int i = 0; i < BULLETS; i++) {
         if (space->boomLife[i]) { continue; }
-        space->boomLife[i] = 12;
-        ffx_sceneNode_setPosition(space->boom[i], ship);
+        space->boomLife[i] = BOOM_STEPS;
+        entitiesPlace(&space->entities, FIRST_BOOM + i, x, y);
+        entitiesSetAlive(&space->entities, FIRST_BOOM + i, true);
     }
+}
 
-    ship.x = 300;
-    ffx_sceneNode_setPosition(space->ship, ship);
+static void explodeShip(SpaceState *space) {
+    Entities *entities = &space->entities;
+    addBoom(space, entities->x[SHIP], entities->y[SHIP]);
+    entitiesSetAlive(entities, SHIP, false);
 }
 
 static void explode(SpaceState *space, int index) {
-    space->dead[index] = 1;
+    Entities *entities = &space->entities;
+    addBoom(space, entities->x[index], entities->y[index]);
+    entitiesSetAlive(entities, index, false);
+}
 
-    FfxPoint alien = ffx_sceneNode_getPosition(space->alien[index]);
+static void endGame(SpaceState *space) {
+    space->running = false;
 
-    for (int i = 0; i < BULLETS; i++) {
-        if (space->boomLife[i]) { continue; }
-        space->boomLife[i] = 12;
+    // The end animations start from where the simulation stopped
+    syncScene(space, true);
 
-        FfxPoint aliens = ffx_sceneNode_getPosition(space->aliens);
+    uint32_t frames = space->damageFrames ? space->damageFrames: 1;
+    uint32_t average = space->damageFragments * 10 / frames;
+    printf("[space] damage: frames=%ld fragments/frame=%ld.%ld (of %d)\n",
+      space->damageFrames, average / 10, average % 10,
+      DAMAGE_HEIGHT / DAMAGE_FRAGMENT_HEIGHT);
 
-        ffx_sceneNode_setPosition(space->boom[i], (FfxPoint){
-            .x = aliens.x + alien.x,
-            .y = aliens.y + alien.y
-        });
+    if (space->gridOverflows) {
+        printf("[space] grid overflowed: steps=%ld\n", space->gridOverflows);
     }
 
-    alien.x = 300;
-    ffx_sceneNode_setPosition(space->alien[index], alien);
+    gameLoopDumpStats(&space->loop, "space");
 }
 
 static void onFocus(FfxEvent event, FfxEventProps props, void *_app) {
     SpaceState *space = _app;
     space->running = true;
+
+    // Shown (or uncovered); everything on screen is new
+    damageAdd(&space->damage, (DamageRect){
+        .x = 0, .y = 0, .width = DAMAGE_WIDTH, .height = DAMAGE_HEIGHT
+    });
 }
 
-static void onRender(FfxEvent event, FfxEventProps props, void *_app) {
+// Advance the game by one step; this only touches the entities,
+// until the game ends
+static void step(void *_app) {
     SpaceState *space = _app;
+    Entities *entities = &space->entities;
 
-    FfxPoint ship = ffx_sceneNode_getPosition(space->ship);
-    FfxPoint aliens = ffx_sceneNode_getPosition(space->aliens);
-
-    // Finished animating the win
-    if (ship.x < -50) { ffx_popPanel(RESULT_WIN); }
-
-    // Finished animating the loss
-    if (aliens.x > 400) { ffx_popPanel(RESULT_LOSE); }
-
-    // Either hasn't started yet or game over
+    // A previous step this frame may have ended the game
     if (!space->running) { return; }
 
-    // Reset button heald down for more than 3s
-    if (space->keys == FfxKeyOk && ticks() - space->resetTimer > 3000) {
-        ffx_popPanel(RESULT_QUIT);
-    }
+    entitiesSnapshot(entities);
 
     // Mode left/right if keys are being held down
+    int16_t shipY = entities->y[SHIP];
+    entities->vy[SHIP] = 0;
     if (space->keys & FfxKeyNorth) {
-        if (ship.y > 0) { ship.y -= 2; }
+        if (shipY > 0) { entities->vy[SHIP] = -SPEED_SHIP; }
     } else if (space->keys & FfxKeySouth) {
-        if (ship.y < 240 - 38) { ship.y += 2; }
+        if (shipY < 240 - 38) { entities->vy[SHIP] = SPEED_SHIP; }
     }
-    ffx_sceneNode_setPosition(space->ship, ship);
+
+    // Moves the ship, the bullets and the formation (as decided at the
+    // end of the last step)
+    entitiesMove(entities);
 
     space->tick++;
 
     for (int i = 0; i < BULLETS; i++) {
-        // Animate bullets
-        FfxPoint b = ffx_sceneNode_getPosition(space->bullet[i]);
-        if (b.x > -10) { b.x -= 2; }
-        ffx_sceneNode_setPosition(space->bullet[i], b);
+        // Bullets leaving the screen are parked for reuse
+        if (entities->x[FIRST_BULLET + i] <= -10) {
+            entitiesSetAlive(entities, FIRST_BULLET + i, false);
+        }
 
         // Animate the exposions
         if (space->boomLife[i]) {
             space->boomLife[i]--;
             if (space->boomLife[i] == 0) {
-                ffx_sceneNode_setPosition(space->boom[i], (FfxPoint){
-                    .x = 300, .y = 0
-                });
+                entitiesSetAlive(entities, FIRST_BOOM + i, false);
             }
         }
     }
 
     // Make the aliens dance; animate between alien1 and alien2 images
-    if ((space->tick % 4) == 0) {
-        int toggle = (space->tick / 4) % (ROWS * COLS);
-        if (!space->dead[toggle]) {
-            const uint16_t *current = ffx_sceneImage_getData(space->alien[toggle]);
-            if (current == image_alien1) {
-                ffx_sceneImage_setData(space->alien[toggle], image_alien2, sizeof(image_alien2));
-            } else {
-                ffx_sceneImage_setData(space->alien[toggle], image_alien1, sizeof(image_alien1));
-            }
-        }
+    if ((space->tick % DANCE_STEPS) == 0) {
+        int toggle = FIRST_ALIEN + (space->tick / DANCE_STEPS) % ALIENS;
+        entities->sprite[toggle] = (entities->sprite[toggle] == SpriteAlien1) ?
+          SpriteAlien2: SpriteAlien1;
     }
 
-
-    // Check for bullets hitting any alien
     bool allKill = true;
-    for (int i = 0; i < (ROWS * COLS); i++) {
-        if (space->dead[i]) { continue; }
-        allKill = false;
+    for (int i = FIRST_ALIEN; i < FIRST_ALIEN + ALIENS; i++) {
+        if (entitiesIsAlive(entities, i)) { allKill = false; }
+    }
 
-        FfxPoint alien = ffx_sceneNode_getPosition(space->alien[i]);
+    // Check for bullets hitting any alien; only the aliens sharing a grid
+    // cell with a bullet are tested
+    entityGridBuild(&space->grid, entities, FIRST_ALIEN, ALIENS);
+    if (space->grid.overflow) { space->gridOverflows++; }
+    for (int i = FIRST_BULLET; i < FIRST_BULLET + BULLETS; i++) {
+        if (!entitiesIsAlive(entities, i)) { continue; }
 
-        FfxPoint w;
-        w.x = aliens.x + alien.x + 10;
-        w.y = aliens.y + alien.y + 13;
-
-        for (int j = 0; j < BULLETS; j++) {
-            FfxPoint b = ffx_sceneNode_getPosition(space->bullet[j]);
-            if (abs(b.x - w.x) < 10 && abs(b.y - w.y) < 13) {
-                explode(space, i);
-                b.x = -10;
-                ffx_sceneNode_setPosition(space->bullet[j], b);
-                break;
-            }
-        }
+        int hit = entityGridFindOverlap(&space->grid, entities, i);
+        if (hit < 0 || !entitiesIsAlive(entities, hit)) { continue; }
+
+        explode(space, hit);
+        entitiesSetAlive(entities, i, false);
     }
 
     if (allKill) {
-        ffx_sceneNode_animatePosition(space->ship, ffx_point(-200, ship.y),
-          0, 1000, FfxCurveEaseInQuad, NULL, NULL);
-        space->running = false;
+        endGame(space);
+        ffx_sceneNode_animatePosition(space->node[SHIP],
+          ffx_point(-200, entities->y[SHIP]), 0, 1000, FfxCurveEaseInQuad,
+          NULL, NULL);
         return;
     }
 
     // Check for any alien hitting the player; compute aliens bounds
+    FfxPoint aliens = ffx_point(entities->x[FORMATION], entities->y[FORMATION]);
+    FfxPoint ship = ffx_point(entities->x[SHIP], entities->y[SHIP]);
+
     bool isDead = false;
     int leftMost = 0, rightMost = 240;
-    for (int i = 0; i < ROWS * COLS; i++) {
-        if (space->dead[i]) { continue; }
-
-        FfxPoint alien = ffx_sceneNode_getPosition(space->alien[i]);
+    for (int i = FIRST_ALIEN; i < FIRST_ALIEN + ALIENS; i++) {
+        if (!entitiesIsAlive(entities, i)) { continue; }
 
-        if (alien.y < rightMost) { rightMost = alien.y; }
-        if (alien.y + 26 > leftMost) { leftMost = alien.y + 26; }
+        // Relative to the alien field
+        int y = entities->y[i] - aliens.y;
+        if (y < rightMost) { rightMost = y; }
+        if (y + 26 > leftMost) { leftMost = y + 26; }
 
         // Check for alien-ship collision
         FfxPoint w;
-        w.x = aliens.x + alien.x + 10;
-        w.y = aliens.y + alien.y + 13;
+        w.x = entities->x[i] + 10;
+        w.y = entities->y[i] + 13;
 
         if (w.x + 7 > ship.x && abs(ship.y + 19 - w.y) < 20) {
             isDead = true;
@@ -198,41 +373,94 @@ static void onRender(FfxEvent event, FfxEventProps props, void *_app) {
     // Dead; stop the game and animate the aliens
     if (isDead) {
         explodeShip(space);
+        endGame(space);
 
-        ffx_sceneNode_animatePosition(space->aliens, ffx_point(480, aliens.y),
-          0, 1000, FfxCurveEaseInBack, NULL, NULL);
+        ffx_sceneNode_animatePosition(space->node[FORMATION],
+          ffx_point(480, aliens.y), 0, 1000, FfxCurveEaseInBack, NULL, NULL);
 
-        space->running = false;
         return;
     }
 
-    // Move the alien field; zig-zag
-    if ((aliens.x % 8) == 0) {
+    // Decide the next move of the alien field; zig-zag
+    int vx = 0, vy = 0;
+    if ((aliens.x % ADVANCE_COLUMN) == 0) {
         if (leftMost + aliens.y < 240) {
-            aliens.y += 2;
+            vy = SPEED_SWAY;
         } else {
-            aliens.x += 4;
+            vx = SPEED_ADVANCE;
         }
     } else {
         if (rightMost + aliens.y > 0) {
-            aliens.y -= 2;
+            vy = -SPEED_SWAY;
         } else {
-            aliens.x += 4;
+            vx = SPEED_ADVANCE;
         }
     }
-    ffx_sceneNode_setPosition(space->aliens, aliens);
+
+    for (int i = FORMATION; i < FIRST_ALIEN + ALIENS; i++) {
+        entities->vx[i] = vx;
+        entities->vy[i] = vy;
+    }
+}
+
+static void onRender(FfxEvent event, FfxEventProps props, void *_app) {
+    SpaceState *space = _app;
+
+    FfxPoint ship = ffx_sceneNode_getPosition(space->node[SHIP]);
+    FfxPoint aliens = ffx_sceneNode_getPosition(space->node[FORMATION]);
+
+    // Finished animating the win
+    if (ship.x < -50) { ffx_popPanel(RESULT_WIN); }
+
+    // Finished animating the loss
+    if (aliens.x > 400) { ffx_popPanel(RESULT_LOSE); }
+
+    // Either hasn't started yet or game over
+    if (!space->running) { return; }
+
+    // Reset button heald down for more than 3s
+    if (space->keys == FfxKeyOk && ticks() - space->resetTimer > 3000) {
+        gameLoopDumpStats(&space->loop, "space");
+        PROFILE_DUMP("space");
+        ffx_popPanel(RESULT_QUIT);
+    }
+
+    gameLoopUpdate(&space->loop, ticks());
+
+    // The game ended during a step
+    if (!space->running) { return; }
+
+    PROFILE_FRAME();
+    PROFILE_BEGIN(t0);
+
+    syncScene(space, false);
+
+    PROFILE_END(t0, ProfilerKindUpdate, PROFILER_FRAGMENTS, 0);
+
+    uint32_t fragments = damageGetFragments(&space->damage);
+
+    // Only the changed fragments need rendering and sending. The display
+    // pipeline in firefly-scene does not take a damage region yet, so on
+    // the device this only measures how much of each frame changed; the
+    // host scene skips the rest.
+#ifdef FFX_SCENE_DAMAGE
+    ffx_scene_setDamage(space->scene, fragments);
+#endif
+
+    space->damageFrames++;
+    space->damageFragments += __builtin_popcount(fragments);
+    damageReset(&space->damage);
 }
 
 static void onKeys(FfxEvent event, FfxEventProps props, void *_app) {
     SpaceState *space = _app;
+    Entities *entities = &space->entities;
 
     if (!space->running) { return; }
 
     uint32_t keys = props.keys.down;
     space->keys = keys;
 
-    FfxPoint ship = ffx_sceneNode_getPosition(space->ship);
-
     //printf("[space] high-water: %d\n", uxTaskGetStackHighWaterMark(NULL));
 
     if (keys == FfxKeyOk) {
@@ -242,66 +470,81 @@ static void onKeys(FfxEvent event, FfxEventProps props, void *_app) {
     }
 
     if (keys & FfxKeyCancel) {
-        for (int i = 0; i < BULLETS; i++) {
-            FfxPoint b = ffx_sceneNode_getPosition(space->bullet[i]);
-
+        for (int i = FIRST_BULLET; i < FIRST_BULLET + BULLETS; i++) {
             // Already in-flight
-            if (b.x > -10) { continue; }
+            if (entitiesIsAlive(entities, i)) { continue; }
 
-            b.y = ship.y + 16;
-            b.x = 240 - 32 - 2;
-            ffx_sceneNode_setPosition(space->bullet[i], b);
+            entitiesPlace(entities, i, 240 - 32 - 2, entities->y[SHIP] + 16);
+            entities->vx[i] = -SPEED_BULLET;
+            entitiesSetAlive(entities, i, true);
             break;
         }
     }
 }
 
+static FfxNode createNode(SpaceState *space, FfxNode parent, int index) {
+    Sprite sprite = space->entities.sprite[index];
+    FfxNode node = ffx_scene_createImage(space->scene, sprites[sprite].data,
+      sprites[sprite].size);
+    ffx_sceneGroup_appendChild(parent, node);
+
+    // Shown by the first sync
+    ffx_sceneNode_setHidden(node, true);
+    space->node[index] = node;
+    space->shown[index] = SpriteNone;
+
+    return node;
+}
+
 static int initFunc(FfxScene scene, FfxNode panel, void* panelState, void* arg) {
     SpaceState *space = panelState;
     space->scene = scene;
     space->panel = panel;
 
-    FfxNode bg = ffx_scene_createImage(scene, image_space, sizeof(image_space));
+    Entities *entities = &space->entities;
+    entitiesInit(entities);
+
+    // Bullets collide as points (their leading corner)
+    entitiesAdd(entities, 240 - 36, 120 - 19, 36, 38, SpriteShip);
+    entitiesAdd(entities, 0, 0, SIZE_ALIENS.width, SIZE_ALIENS.height,
+      SpriteNone);
+    for (int r = 0; r < ROWS; r++) {
+        for (int c = 0; c < COLS; c++) {
+            entitiesAdd(entities, SPACING_X * r, c * SPACING_Y, 20, 26,
+              SpriteAlien1);
+        }
+    }
+    for (int i = 0; i < BULLETS; i++) {
+        int bullet = entitiesAdd(entities, -10, 0, 0, 0, SpriteBullet);
+        entitiesSetAlive(entities, bullet, false);
+    }
+    for (int i = 0; i < BULLETS; i++) {
+        int boom = entitiesAdd(entities, 300, 0, 20, 26, SpriteBoom);
+        entitiesSetAlive(entities, boom, false);
+    }
+
+    FfxNode bg = ffx_scene_createImage(scene, image_space, IMAGE_SPACE_SIZE);
     ffx_sceneGroup_appendChild(panel, bg);
 
     for (int i = 0; i < BULLETS; i++) {
-        FfxNode bullet = ffx_scene_createImage(scene, image_bullet, sizeof(image_bullet));
-        space->bullet[i] = bullet;
-        ffx_sceneGroup_appendChild(panel, bullet);
-        ffx_sceneNode_setPosition(bullet, (FfxPoint){
-            .x = -10, .y = 0
-        });
-
-        FfxNode boom = ffx_scene_createImage(scene, image_alienboom, sizeof(image_alienboom));
-        space->boom[i] = boom;
-        ffx_sceneGroup_appendChild(panel, boom);
-        ffx_sceneNode_setPosition(boom, (FfxPoint){
-            .x = 300, .y = 0
-        });
+        createNode(space, panel, FIRST_BULLET + i);
+        createNode(space, panel, FIRST_BOOM + i);
     }
 
-    FfxNode ship = ffx_scene_createImage(scene, image_ship, sizeof(image_ship));
-    space->ship = ship;
-    ffx_sceneGroup_appendChild(panel, ship);
-    ffx_sceneNode_setPosition(ship, (FfxPoint){
-        .x = (240 - 36), .y = (120 - 19)
-    });
+    createNode(space, panel, SHIP);
 
     FfxNode aliens = ffx_scene_createGroup(scene);
-    space->aliens = aliens;
+    space->node[FORMATION] = aliens;
     ffx_sceneGroup_appendChild(panel, aliens);
 
-    for (int r = 0; r < ROWS; r++) {
-        for (int c = 0; c < COLS; c++) {
-            FfxNode alien = ffx_scene_createImage(scene, image_alien1, sizeof(image_alien1));
-            space->alien[(r * COLS) + c] = alien;
-            ffx_sceneGroup_appendChild(aliens, alien);
-            ffx_sceneNode_setPosition(alien, (FfxPoint){
-                .x = 30 * r, .y = c * 40
-            });
-        }
+    for (int i = FIRST_ALIEN; i < FIRST_ALIEN + ALIENS; i++) {
+        createNode(space, aliens, i);
     }
 
+    syncScene(space, true);
+
+    gameLoopInit(&space->loop, STEP_PERIOD, FRAME_BUDGET, step, space);
+
     ffx_onEvent(FfxEventKeys, onKeys, space);
 
     ffx_onEvent(FfxEventRenderScene, onRender, space);
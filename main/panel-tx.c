@@ -4,11 +4,14 @@
 #include "firefly-address.h"
 #include "firefly-db.h"
 #include "firefly-decimal.h"
+#include "firefly-hash.h"
 #include "firefly-hollows.h"
 #include "firefly-scene.h"
 #include "firefly-tx.h"
 
+#include "metadata.h"
 #include "panel-tx.h"
+#include "secp256k1.h"
 
 #include "utils.h"
 
@@ -16,11 +19,72 @@
 void dumpBuffer(const char*, const uint8_t*, size_t);
 #include <stdio.h>
 
+#define ACCOUNT_INDEX      (0)
+
+// Most fields in a transaction request
+#define MAX_TX_FIELDS      (16)
+
+#define SIGN_REPLY_SIZE    (128)
+
 #define FONT_VALUE         (FfxFontMediumBold)
 #define COLOR_VALUE        (COLOR_WHITE)
 
+#define FONT_DATA          (FfxFontSmall)
+#define COLOR_DATA         (ffx_color_rgb(200, 200, 200))
+
+// Bytes of a word on each line of hex
+#define DATA_LINE_BYTES    (8)
+
+// Info rows of each word of the data view: its heading, decoded value,
+// lines of hex and the rule after it
+#define DATA_WORD_ROWS     (2 + 32 / DATA_LINE_BYTES + 1)
+
+// Info rows of a page besides its words: the title and its rule, the
+// function and length entries and their rules, the page number and its
+// rule, the buttons and the closing rule
+#define DATA_PAGE_ROWS     (2 + 4 + 2 + 3 + 1)
+
+// Words (of 32 bytes) on each page of the data view, as many as the info
+// panel has rows for; lines are formatted as they scroll onto the screen,
+// so large calldata is never held as hex
+#define DATA_PAGE_WORDS    ((INFO_MAX_ROWS - DATA_PAGE_ROWS) / DATA_WORD_ROWS)
+
+// The lines of each word; a formatted row's userData is the word index
+// shifted by DATA_LINE_BITS, with the line
+#define DATA_LINE_BITS     (3)
+#define DATA_LINE_HEADING  (0)
+#define DATA_LINE_DECODED  (1)
+#define DATA_LINE_HEX      (2)
+
+// Results of a data page, besides PANEL_TX_REJECT (back)
+#define DATA_PAGE_NEXT     (2)
+#define DATA_PAGE_PREVIOUS (3)
+
+typedef enum WordKind {
+    WordKindNone = 0,
+    WordKindNumber,
+    WordKindAddress,
+    WordKindBool,
+} WordKind;
+
+typedef struct TxModel TxModel;
+
 typedef struct State {
     FfxDataResult tx;
+    PanelTxView view;
+
+    // Formatted strings of the views
+    const TxModel *model;
+
+    // The data view
+    FfxDataResult data;
+    const char *signature;
+    size_t page;
+
+    // Answers requests arriving while this is shown; its arena holds the
+    // model, and anything formatted during init (released after, as the
+    // labels keep a copy)
+    Requests *requests;
 } State;
 
 
@@ -37,129 +101,430 @@ static size_t getHex(char *hexOut, const uint8_t* data, size_t length) {
     return offset;
 }
 
-static bool initViewNetwork(void *infoState, State *state) {
-    appendTitle(infoState, "NETWORK");
+// "0x01234...5678"
+static void getShortAddress(char *str, const uint8_t *bytes) {
+    FFX_INIT_ADDRESS(addr, bytes);
+    FfxChecksumAddress address = ffx_eth_checksumAddress(&addr);
 
-    FfxDataResult data = ffx_tx_getChainId(state->tx);
-    if (data.error) {
-        printf("ERROR! Bad Value\n");
+    memcpy(&str[0], &address.text[0], 6);
+    str[6] = '.';
+    str[7] = '.';
+    str[8] = '.';
+    memcpy(&str[9], &address.text[38], 5);
+}
+
+// Opened on first use and kept; it is mapped, so costs no RAM
+static Metadata* getMetadata() {
+    static Metadata metadata = { 0 };
+    static bool opened = false;
+
+    if (!opened) {
+        opened = true;
+        metadataOpen(&metadata, METADATA_PARTITION);
+    }
+
+    return metadataIsOpen(&metadata) ? &metadata: NULL;
+}
+
+// The signature of the function %data% calls, or NULL if unknown
+static const char* findSignature(const uint8_t *data, size_t length) {
+    if (length < 4) { return NULL; }
+
+    Metadata *metadata = getMetadata();
+    if (metadata == NULL) { return NULL; }
+
+    return metadataGetSignature(metadata, data);
+}
+
+// The token %tx% is sent to, if known
+static bool findToken(FfxDataResult tx, MetadataToken *token) {
+    Metadata *metadata = getMetadata();
+    if (metadata == NULL) { return false; }
+
+    FfxDataResult chainId = ffx_tx_getChainId(tx);
+    FfxDataResult address = ffx_tx_getAddress(tx);
+    if (chainId.error || chainId.length > 4 || address.error ||
+      address.length != 20) {
         return false;
     }
 
-    FfxBigInt value = ffx_bigint_initBytes(data.bytes, data.length);
-    if (!ffx_bigint_cmpU32(&value, 1)) {
-        appendEntry(infoState, "NAME", "Mainnet", PanelTxViewNoDrill);
-    } else if (!ffx_bigint_cmpU32(&value, 11155111)) {
-        appendEntry(infoState, "NAME", "Sepolia", PanelTxViewNoDrill);
+    uint32_t value = 0;
+    for (int i = 0; i < chainId.length; i++) {
+        value = (value << 8) | chainId.bytes[i];
     }
 
-    char str[FFX_BIGINT_STRING_LENGTH];
-    size_t length = ffx_bigint_getString(&value, str);
-    appendEntry(infoState, "CHAIN ID", str, PanelTxViewNoDrill);
+    return metadataGetToken(metadata, value, address.bytes, token);
+}
 
-    appendHR(infoState);
+// Copy the name of the function of %signature% into %name%
+static void getFunctionName(char *name, size_t length,
+  const char *signature) {
 
-    // Buttons
-    appendButton(infoState, "BACK", COLOR_BLUE, PanelTxActionApprove);
-
-    return true;
+    size_t offset = 0;
+    while (signature[offset] && signature[offset] != '(' &&
+      offset + 1 < length) {
+        name[offset] = signature[offset];
+        offset++;
+    }
+    name[offset] = 0;
 }
 
-static bool initViewTo(void *infoState, State *state) {
-    appendTitle(infoState, "TO");
+static bool hasPrefix(const char *type, size_t length, const char *prefix) {
+    size_t prefixLength = strlen(prefix);
+    return (length >= prefixLength && !strncmp(type, prefix, prefixLength));
+}
 
-    FfxDataResult data = ffx_tx_getAddress(state->tx);
-    if (data.error) {
-        printf("ERROR!! Bad Address\n");
+// Whether the ABI type %type% (of %length%) is static and a single word,
+// so it is encoded in place in the word at its position
+static bool isWordType(const char *type, size_t length) {
+    if (memchr(type, '[', length) || memchr(type, '(', length)) {
         return false;
     }
 
-    appendPadding(infoState, PADDING);
+    if ((length == 7 && !strncmp(type, "address", 7)) ||
+      (length == 4 && !strncmp(type, "bool", 4)) ||
+      (length == 8 && !strncmp(type, "function", 8))) {
+        return true;
+    }
 
-    if (data.length == 0) {
-        appendText(infoState, "contract", FONT_VALUE, COLOR_VALUE);
-        appendText(infoState, "deployment", FONT_VALUE, COLOR_VALUE);
+    // The sized bytesN, but not the dynamic bytes
+    if (hasPrefix(type, length, "bytes")) { return (length > 5); }
 
-    } else if (data.length == 20) {
-        FFX_INIT_ADDRESS(addr, data.bytes);
-        FfxChecksumAddress address = ffx_eth_checksumAddress(&addr);
+    return (hasPrefix(type, length, "uint") || hasPrefix(type, length, "int"));
+}
 
-        char line[16] = { 0 };
-        line[0] = '0';
-        line[1] = 'x';
+// Copy the type of param %index% of %signature% into %type%; false if
+// unknown. The words of the data only line up with the params while each
+// is a single static word, so once a param is not (e.g. bytes, a tuple or
+// a fixed array) no later word can be typed.
+static bool getParamType(char *type, size_t length, const char *signature,
+  size_t index) {
+
+    if (signature == NULL) { return false; }
+
+    const char *param = strchr(signature, '(');
+    if (param == NULL) { return false; }
+    param++;
+
+    for (size_t i = 0; ; i++) {
+        // Tuples may contain commas
+        size_t end = 0;
+        int depth = 0;
+        while (param[end] && (depth || (param[end] != ',' &&
+          param[end] != ')'))) {
+            if (param[end] == '(') {
+                depth++;
+            } else if (param[end] == ')') {
+                depth--;
+            }
+            end++;
+        }
+        if (param[end] == 0 || end == 0) { return false; }
 
-        memcpy(&line[2], &address.text[2], 10);
-        appendText(infoState, line, FONT_VALUE, COLOR_VALUE);
-        appendPadding(infoState, 3);
+        if (i == index) {
+            if (memchr(param, '(', end) || end + 1 > length) { return false; }
+            memcpy(type, param, end);
+            type[end] = 0;
+            return true;
+        }
 
-        line[0] = line[1] = ' ';
-        memcpy(&line[2], &address.text[12], 10);
-        appendText(infoState, line, FONT_VALUE, COLOR_VALUE);
-        appendPadding(infoState, 3);
+        if (param[end] == ')' || !isWordType(param, end)) { return false; }
+        param += end + 1;
+    }
+}
 
-        memcpy(&line[2], &address.text[22], 10);
-        appendText(infoState, line, FONT_VALUE, COLOR_VALUE);
-        appendPadding(infoState, 3);
+// Bytes before the words of the data; the selector
+static size_t getDataBase(State *state) {
+    return (state->data.length >= 4) ? 4: 0;
+}
 
-        memcpy(&line[2], &address.text[32], 10);
-        appendText(infoState, line, FONT_VALUE, COLOR_VALUE);
-        appendPadding(infoState, 3);
+static size_t getWordCount(State *state) {
+    size_t length = state->data.length - getDataBase(state);
+    return (length + 31) / 32;
+}
+
+// Copy word %index% of the data into %word%, zero-padded; returns the
+// bytes present
+static size_t getWord(State *state, size_t index, uint8_t *word) {
+    size_t offset = getDataBase(state) + index * 32;
+
+    size_t length = state->data.length - offset;
+    if (length > 32) { length = 32; }
+
+    memset(word, 0, 32);
+    memcpy(word, &state->data.bytes[offset], length);
+
+    return length;
+}
+
+static WordKind getWordKind(State *state, size_t index, const uint8_t *word,
+  size_t length) {
+
+    if (length != 32) { return WordKindNone; }
+
+    size_t zeros = 0;
+    while (zeros < 32 && word[zeros] == 0) { zeros++; }
+
+    char type[16];
+    if (getParamType(type, sizeof(type), state->signature, index)) {
+        // The offset of a dynamic param, which is shown as hex
+        if (!isWordType(type, strlen(type))) { return WordKindNone; }
+
+        if (!strcmp(type, "address")) {
+            return (zeros >= 12) ? WordKindAddress: WordKindNone;
+        } else if (!strcmp(type, "bool")) {
+            return (zeros >= 31 && word[31] <= 1) ? WordKindBool: WordKindNone;
+        } else if (!strncmp(type, "uint", 4)) {
+            return (zeros >= 20) ? WordKindNumber: WordKindNone;
+        }
+        return WordKindNone;
+    }
+
+    // Guess; small values are likely amounts (or offsets), and values
+    // the width of an address are likely addresses
+    if (zeros >= 20) { return WordKindNumber; }
+    if (zeros >= 12) { return WordKindAddress; }
+
+    return WordKindNone;
+}
+
+// Format the lines of the data view, as they are built
+static void formatData(void *_state, uint16_t userData, char *text,
+  size_t length) {
+
+    State *state = _state;
+
+    size_t index = userData >> DATA_LINE_BITS;
+    size_t line = userData & ((1 << DATA_LINE_BITS) - 1);
+
+    uint8_t word[32];
+    size_t wordLength = getWord(state, index, word);
+
+    if (line == DATA_LINE_HEADING) {
+        char type[16];
+        if (getParamType(type, sizeof(type), state->signature, index)) {
+            snprintf(text, length, "WORD %d: %s", index, type);
+        } else {
+            snprintf(text, length, "WORD %d", index);
+        }
+
+    } else if (line == DATA_LINE_DECODED) {
+        switch (getWordKind(state, index, word, wordLength)) {
+            case WordKindAddress:
+                getShortAddress(text, &word[12]);
+                break;
+            case WordKindBool:
+                snprintf(text, length, "%s", word[31] ? "true": "false");
+                break;
+            case WordKindNumber: {
+                FfxBigInt value = ffx_bigint_initBytes(word, 32);
+                char str[FFX_BIGINT_STRING_LENGTH];
+                ffx_bigint_getString(&value, str);
+                snprintf(text, length, "%s", str);
+                break;
+            }
+            default:
+                break;
+        }
 
     } else {
-        printf("ERROR!! Bad Address\n");
+        size_t offset = (line - DATA_LINE_HEX) * DATA_LINE_BYTES;
+        size_t end = offset + DATA_LINE_BYTES;
+        if (end > wordLength) { end = wordLength; }
+
+        char *hex = text;
+        for (; offset < end && hex + 3 <= text + length; offset++) {
+            *hex++ = HEX[word[offset] >> 4];
+            *hex++ = HEX[word[offset] & 0x0f];
+        }
+        *hex = 0;
+    }
+}
+
+static bool initViewData(void *infoState, State *state) {
+    FfxDataResult data = ffx_tx_getData(state->tx);
+    if (data.error) {
+        printf("ERROR! Bad Data\n");
         return false;
     }
 
-    appendPadding(infoState, PADDING);
+    state->data = data;
+    state->signature = findSignature(data.bytes, data.length);
+
+    setFormatFunc(infoState, formatData);
+
+    size_t count = getWordCount(state);
+    size_t pages = (count + DATA_PAGE_WORDS - 1) / DATA_PAGE_WORDS;
+    if (pages == 0) { pages = 1; }
+
+    if (state->page == 0) {
+        if (state->signature) {
+            char name[32];
+            getFunctionName(name, sizeof(name), state->signature);
+            appendEntry(infoState, "FUNCTION", name, PanelTxViewNoDrill);
+        } else if (data.length >= 4) {
+            char hex[12] = { 0 };
+            getHex(hex, data.bytes, 4);
+            appendEntry(infoState, "SELECTOR", hex, PanelTxViewNoDrill);
+        }
+
+        char str[24];
+        snprintf(str, sizeof(str), "%d bytes", data.length);
+        appendEntry(infoState, "LENGTH", str, PanelTxViewNoDrill);
+    }
+
+    if (pages > 1) {
+        char str[24];
+        snprintf(str, sizeof(str), "PAGE %d OF %d", state->page + 1, pages);
+        appendPadding(infoState, PADDING);
+        appendText(infoState, str, FONT_DATA, COLOR_DATA);
+        appendPadding(infoState, PADDING);
+        appendHR(infoState);
+    }
+
+    size_t index = state->page * DATA_PAGE_WORDS;
+    size_t end = index + DATA_PAGE_WORDS;
+    if (end > count) { end = count; }
+
+    for (; index < end; index++) {
+        uint8_t word[32];
+        size_t length = getWord(state, index, word);
+
+        uint16_t userData = index << DATA_LINE_BITS;
+
+        appendPadding(infoState, 10);
+        appendFormatted(infoState, FONT_DATA, COLOR_DATA,
+          userData | DATA_LINE_HEADING);
+        appendPadding(infoState, 6);
+
+        if (getWordKind(state, index, word, length)) {
+            appendFormatted(infoState, FONT_VALUE, COLOR_VALUE,
+              userData | DATA_LINE_DECODED);
+            appendPadding(infoState, 6);
+        }
+
+        size_t lines = (length + DATA_LINE_BYTES - 1) / DATA_LINE_BYTES;
+        for (int i = 0; i < lines; i++) {
+            appendFormatted(infoState, FONT_DATA, COLOR_DATA,
+              userData | (DATA_LINE_HEX + i));
+            appendPadding(infoState, 3);
+        }
+
+        appendPadding(infoState, 7);
+        appendHR(infoState);
+    }
+
+    // Buttons
+    if (state->page + 1 < pages) {
+        appendButton(infoState, "NEXT", COLOR_BLUE, PanelTxActionNext);
+    }
+    if (state->page > 0) {
+        appendButton(infoState, "PREVIOUS", COLOR_BLUE,
+          PanelTxActionPrevious);
+    }
+    appendButton(infoState, "BACK", COLOR_BLUE, PanelTxActionApprove);
 
     return true;
 }
 
-static bool initViewSummary(void *infoState, State *state) {
-    appendTitle(infoState, "TRANSACTION");
+/////////////////////////////
+// View model
+
+// The strings of the summary and its drill-downs, formatted while the
+// summary slides in (or when the request is queued, if the user is on
+// another prompt), and shared by the views pushed from it; kept in the
+// requests arena
+struct TxModel {
+    // The network name, if known
+    const char *network;
+    const char *chainId;
+
+    // Otherwise, a contract deployment
+    bool hasTo;
+    FfxChecksumAddress to;
+    char shortTo[14];
+
+    const char *value;
+
+    // The name of the function called, if known, otherwise the data (or
+    // its start) as hex
+    size_t dataLength;
+    const char *function;
+    char data[20];
+
+    // For transfers and approvals of a known token
+    const char *amountHeading;
+    const char *amount;
+};
+
+static const char* copyString(Arena *arena, const char *str) {
+    size_t length = strlen(str) + 1;
+    char *result = arenaAlloc(arena, length);
+    if (result) { memcpy(result, str, length); }
+    return result;
+}
+
+// Format %value% (with %decimals%) in %arena%, prefixed with a "<" if it
+// is rounded
+static const char* formatValue(Arena *arena, FfxBigInt *value,
+  size_t decimals) {
+
+    char str[1 + FFX_ETHER_STRING_LENGTH] = { 0 };
+    FfxDecimalResult result = ffx_decimal_formatValue(&str[1], value,
+      (FfxDecimalFormat){
+        .round = FfxDecimalRoundCeiling,
+        .decimals = decimals,
+        .groups = 3,
+        .maxDecimals = 5,
+        .minDecimals = 1,
+    });
+
+    if (result.flags & FfxDecimalFlagRounded) {
+        str[0] = '<';
+        return copyString(arena, str);
+    }
+
+    return copyString(arena, result.str);
+}
+
+static bool buildModel(const TxModel **result, FfxDataResult tx,
+  Arena *arena) {
+
+    TxModel *model = arenaAlloc(arena, sizeof(TxModel));
+    if (model == NULL) { return false; }
+    memset(model, 0, sizeof(TxModel));
 
     // Network
     {
-        FfxDataResult data = ffx_tx_getChainId(state->tx);
+        FfxDataResult data = ffx_tx_getChainId(tx);
         if (data.error) {
             printf("ERROR! Bad Value\n");
             return false;
         }
 
         FfxBigInt value = ffx_bigint_initBytes(data.bytes, data.length);
-        const char *name = ffx_db_getNetworkName(&value);
-        if (name) {
-            appendEntry(infoState, "NETWORK", name, PanelTxViewNetwork);
-        } else {
-            char str[FFX_BIGINT_STRING_LENGTH];
-            size_t length = ffx_bigint_getString(&value, str);
-            appendEntry(infoState, "CHAIN ID", str, PanelTxViewNetwork);
-        }
+        model->network = ffx_db_getNetworkName(&value);
+
+        char str[FFX_BIGINT_STRING_LENGTH];
+        ffx_bigint_getString(&value, str);
+        model->chainId = copyString(arena, str);
+        if (model->chainId == NULL) { return false; }
     }
 
     // To Address
     {
-        FfxDataResult data = ffx_tx_getAddress(state->tx);
+        FfxDataResult data = ffx_tx_getAddress(tx);
         if (data.error) {
             printf("ERROR!! Bad Address\n");
             return false;
         }
 
-        if (data.length == 0) {
-            appendEntry(infoState, "TO", "deploy", PanelTxViewTo);
-        } else if (data.length == 20) {
+        if (data.length == 20) {
             FFX_INIT_ADDRESS(addr, data.bytes);
-            FfxChecksumAddress address = ffx_eth_checksumAddress(&addr);
-
-            // "0x01234...5678\0"
-            char str[14];
-            memcpy(&str[0], &address.text[0], 6);
-            str[6] = '.';
-            str[7] = '.';
-            str[8] = '.';
-            memcpy(&str[9], &address.text[38], 5);
-            appendEntry(infoState, "TO", str, PanelTxViewTo);
-        } else {
+            model->hasTo = true;
+            model->to = ffx_eth_checksumAddress(&addr);
+            getShortAddress(model->shortTo, data.bytes);
+        } else if (data.length != 0) {
             printf("ERROR!! Bad Address\n");
             return false;
         }
@@ -167,66 +532,163 @@ static bool initViewSummary(void *infoState, State *state) {
 
     // Value
     {
-        FfxDataResult data = ffx_tx_getValue(state->tx);
+        FfxDataResult data = ffx_tx_getValue(tx);
         if (data.error) {
             printf("ERROR! Bad Value\n");
             return false;
         }
 
         FfxBigInt value = ffx_bigint_initBytes(data.bytes, data.length);
-
-        // Reserve a space to indicate rounding occurred
-        char str[1 + FFX_ETHER_STRING_LENGTH] = { 0 };
-        FfxDecimalResult result = ffx_decimal_formatValue(&str[1], &value, (FfxDecimalFormat){
-            .round = FfxDecimalRoundCeiling,
-            .decimals = 18,
-            .groups = 3,
-            .maxDecimals = 5,
-            .minDecimals = 1,
-        });
-
-        if (result.flags & FfxDecimalFlagRounded) {
-            str[0] = '<';
-            result.str = str;
-        }
-
-        // @TODO: Drill down into value
-        //appendEntry(state, "VALUE (sETH)", result.str, PanelTxViewValue);
-        appendEntry(infoState, "VALUE (sETH)", result.str, PanelTxViewNoDrill);
+        model->value = formatValue(arena, &value, 18);
+        if (model->value == NULL) { return false; }
     }
 
     // Data
     {
-        FfxDataResult data = ffx_tx_getData(state->tx);
+        FfxDataResult data = ffx_tx_getData(tx);
         if (data.error) {
             printf("ERROR! Bad Data\n");
             return false;
         }
 
-        // @TODO: Drill down into data; offer suggestions for selector
+        model->dataLength = data.length;
+
+        const char *signature = findSignature(data.bytes, data.length);
 
-        if (data.length == 0) {
-            // No data
-            appendEntry(infoState, "DATA", "none", PanelTxViewNoDrill);
+        if (signature) {
+            // Known function
+            char name[32];
+            getFunctionName(name, sizeof(name), signature);
+            model->function = copyString(arena, name);
+            if (model->function == NULL) { return false; }
+
+            // Token amount, for transfers and approvals of a known token
+            MetadataToken token;
+            bool amount = (!strcmp(signature, "transfer(address,uint256)") ||
+              !strcmp(signature, "approve(address,uint256)"));
+            if (amount && data.length >= 4 + 64 && findToken(tx, &token)) {
+                FfxBigInt value = ffx_bigint_initBytes(&data.bytes[36], 32);
+                model->amount = formatValue(arena, &value, token.decimals);
+
+                char heading[24];
+                snprintf(heading, sizeof(heading), "AMOUNT (%s)",
+                  token.symbol);
+                model->amountHeading = copyString(arena, heading);
+
+                if (model->amount == NULL || model->amountHeading == NULL) {
+                    return false;
+                }
+            }
 
         } else if (data.length <= 5) {
             // Short data; will fit in a single entry
-            char hex[20] = { 0 };
-            getHex(hex, data.bytes, data.length);
-            //appendEntry(state, "DATA", hex, PanelTxViewData);
-            appendEntry(infoState, "DATA", hex, PanelTxViewNoDrill);
+            getHex(model->data, data.bytes, data.length);
 
         } else {
             // Long data; show first 4 bytes
-            char hex[20] = { 0 };
-            size_t offset = getHex(hex, data.bytes, 4) - 1;
-            hex[offset++] = '.';
-            hex[offset++] = '.';
-            hex[offset++] = '.';
-            hex[offset++] = '\0';
-            //appendEntry(state, "DATA", hex, PanelTxViewData);
-            appendEntry(infoState, "DATA", hex, PanelTxViewNoDrill);
+            size_t offset = getHex(model->data, data.bytes, 4) - 1;
+            model->data[offset++] = '.';
+            model->data[offset++] = '.';
+            model->data[offset++] = '.';
+            model->data[offset++] = '\0';
+        }
+    }
+
+    *result = model;
+
+    return true;
+}
+
+
+/////////////////////////////
+// Views
+
+static bool initViewNetwork(void *infoState, State *state) {
+    const TxModel *model = state->model;
+
+    if (model->network) {
+        appendEntry(infoState, "NAME", model->network, PanelTxViewNoDrill);
+    }
+
+    appendEntry(infoState, "CHAIN ID", model->chainId, PanelTxViewNoDrill);
+
+    appendHR(infoState);
+
+    // Buttons
+    appendButton(infoState, "BACK", COLOR_BLUE, PanelTxActionApprove);
+
+    return true;
+}
+
+static bool initViewTo(void *infoState, State *state) {
+    const TxModel *model = state->model;
+
+    appendPadding(infoState, PADDING);
+
+    if (!model->hasTo) {
+        appendText(infoState, "contract", FONT_VALUE, COLOR_VALUE);
+        appendText(infoState, "deployment", FONT_VALUE, COLOR_VALUE);
+
+    } else {
+        const char *address = model->to.text;
+
+        char line[16] = { 0 };
+        line[0] = '0';
+        line[1] = 'x';
+
+        memcpy(&line[2], &address[2], 10);
+        appendText(infoState, line, FONT_VALUE, COLOR_VALUE);
+        appendPadding(infoState, 3);
+
+        line[0] = line[1] = ' ';
+        memcpy(&line[2], &address[12], 10);
+        appendText(infoState, line, FONT_VALUE, COLOR_VALUE);
+        appendPadding(infoState, 3);
+
+        memcpy(&line[2], &address[22], 10);
+        appendText(infoState, line, FONT_VALUE, COLOR_VALUE);
+        appendPadding(infoState, 3);
+
+        memcpy(&line[2], &address[32], 10);
+        appendText(infoState, line, FONT_VALUE, COLOR_VALUE);
+        appendPadding(infoState, 3);
+    }
+
+    appendPadding(infoState, PADDING);
+
+    return true;
+}
+
+static bool initViewSummary(void *infoState, State *state) {
+    const TxModel *model = state->model;
+
+    // Network
+    if (model->network) {
+        appendEntry(infoState, "NETWORK", model->network, PanelTxViewNetwork);
+    } else {
+        appendEntry(infoState, "CHAIN ID", model->chainId, PanelTxViewNetwork);
+    }
+
+    // To Address
+    appendEntry(infoState, "TO", model->hasTo ? model->shortTo: "deploy",
+      PanelTxViewTo);
+
+    // Value
+    // @TODO: Drill down into value
+    //appendEntry(state, "VALUE (sETH)", model->value, PanelTxViewValue);
+    appendEntry(infoState, "VALUE (sETH)", model->value, PanelTxViewNoDrill);
+
+    // Data
+    if (model->dataLength == 0) {
+        appendEntry(infoState, "DATA", "none", PanelTxViewNoDrill);
+    } else if (model->function) {
+        appendEntry(infoState, "FUNCTION", model->function, PanelTxViewData);
+        if (model->amount) {
+            appendEntry(infoState, model->amountHeading, model->amount,
+              PanelTxViewNoDrill);
         }
+    } else {
+        appendEntry(infoState, "DATA", model->data, PanelTxViewData);
     }
 
     appendHR(infoState);
@@ -244,37 +706,150 @@ static bool initViewSummary(void *infoState, State *state) {
 
 typedef struct InitArg {
     FfxDataResult *tx;
+    const TxModel *model;
     PanelTxView view;
+    size_t page;
+    Requests *requests;
 } InitArg;
 
+static void onMessage(FfxEvent event, FfxEventProps props, void* arg) {
+    State *state = arg;
+
+    // Anything needing the user is queued until this is closed
+    requestsHandleMessage(state->requests, props.message.id,
+      props.message.method, *props.message.params);
+}
+
+static const char* getViewTitle(PanelTxView view) {
+    switch (view) {
+        case PanelTxViewSummary:
+            return "TRANSACTION";
+        case PanelTxViewTo:
+            return "TO";
+        case PanelTxViewNetwork:
+            return "NETWORK";
+        case PanelTxViewData:
+            return "DATA";
+        default:
+            break;
+    }
+
+    printf("Not supported yet: %d\n", view);
+    assert(0);
+    return "";
+}
+
+// Append the rows of the view below its title; anything formatted for
+// them is released after, as the labels keep a copy
+static void initView(void *infoState, State *state) {
+    Arena *arena = &state->requests->arena;
+    size_t mark = arenaSave(arena);
+
+    if (state->view == PanelTxViewSummary) {
+        initViewSummary(infoState, state);
+    } else if (state->view == PanelTxViewTo) {
+        initViewTo(infoState, state);
+    } else if (state->view == PanelTxViewNetwork) {
+        initViewNetwork(infoState, state);
+    } else if (state->view == PanelTxViewData) {
+        initViewData(infoState, state);
+    }
+
+    arenaRestore(arena, mark);
+}
+
+// Format the model on the panel's first frame, so it overlaps the
+// slide-in instead of delaying it, then append the view; the model is
+// kept for any views pushed from this one
+static void fillView(void *infoState, void *_state) {
+    State *state = _state;
+
+    uint32_t t0 = ticks();
+    bool built = buildModel(&state->model, state->tx,
+      &state->requests->arena);
+    printf("panel-tx: prepared view dt=%ld\n", ticks() - t0);
+
+    if (!built) {
+        state->model = NULL;
+        appendText(infoState, "invalid transaction", FONT_VALUE,
+          COLOR_VALUE);
+        appendPadding(infoState, PADDING);
+        appendHR(infoState);
+        appendButton(infoState, "REJECT", COLOR_RED, PanelTxActionReject);
+        return;
+    }
+
+    initView(infoState, state);
+}
+
 static int initFunc(void *infoState, void *_state, void *_arg) {
     State *state = _state;
 
     InitArg *init = _arg;
     state->tx = *(init->tx);
+    state->view = init->view;
+    state->model = init->model;
+    state->requests = init->requests;
+    state->page = init->page;
     printf("panel-tx: ");
-    ffx_tx_dump(state->tx);;
+    ffx_tx_dump(state->tx);
 
-    if (init->view == PanelTxViewSummary) {
-        initViewSummary(infoState, state);
-    } else if (init->view == PanelTxViewTo) {
-        initViewTo(infoState, state);
-    } else if (init->view == PanelTxViewNetwork) {
-        initViewNetwork(infoState, state);
+    appendTitle(infoState, getViewTitle(state->view));
+
+    // Only the title shows until the model is ready, as the panel slides
+    // in; views pushed from a summary (and requests prepared while
+    // another was shown) have it already
+    if (state->model) {
+        initView(infoState, state);
     } else {
-        printf("Not supported yet: %d\n", init->view);
-        assert(0);
+        setFillFunc(infoState, fillView);
     }
 
+    ffx_onEvent(FfxEventMessage, onMessage, state);
+
     return 0;
 }
 
+void selectFunc(void *_state, uint16_t userData);
+
+static int pushPanelPage(FfxDataResult *tx, const TxModel *model,
+  PanelTxView view, size_t page, Requests *requests) {
+
+    InitArg init = {
+        .tx = tx, .model = model, .view = view, .page = page,
+        .requests = requests
+    };
+    return pushPanelInfo(initFunc, sizeof(State), selectFunc, &init);
+}
+
+// Show the data a page at a time; each page replaces the last, so only
+// one is held at once
+static void showData(State *state) {
+    size_t page = 0;
+    while (true) {
+        int result = pushPanelPage(&state->tx, state->model,
+          PanelTxViewData, page, state->requests);
+
+        if (result == DATA_PAGE_NEXT) {
+            page++;
+        } else if (result == DATA_PAGE_PREVIOUS && page > 0) {
+            page--;
+        } else {
+            break;
+        }
+    }
+}
+
 void selectFunc(void *_state, uint16_t userData) {
 
     if (userData == PanelTxActionReject) {
         ffx_popPanel(PANEL_TX_REJECT);
     } else if (userData == PanelTxActionApprove) {
         ffx_popPanel(PANEL_TX_APPROVE);
+    } else if (userData == PanelTxActionNext) {
+        ffx_popPanel(DATA_PAGE_NEXT);
+    } else if (userData == PanelTxActionPrevious) {
+        ffx_popPanel(DATA_PAGE_PREVIOUS);
     } else if (userData == PanelTxViewNoDrill) {
         // Do nothing; cannot drill down
     } else if (userData) {
@@ -282,13 +857,108 @@ void selectFunc(void *_state, uint16_t userData) {
 
         if (userData == PanelTxViewSummary || userData == PanelTxViewTo ||
           userData == PanelTxViewNetwork) {
-            pushPanelTx(&state->tx, userData);
+            pushPanelPage(&state->tx, state->model, userData, 0,
+              state->requests);
+        } else if (userData == PanelTxViewData) {
+            showData(state);
         }
     }
 }
 
-int pushPanelTx(FfxDataResult *tx, PanelTxView view) {
-    InitArg init = { .tx = tx, .view = view };
-    return pushPanelInfo(initFunc, sizeof(State), selectFunc, &init);
+int pushPanelTx(FfxDataResult *tx, PanelTxView view, Requests *requests) {
+    return pushPanelPage(tx, NULL, view, 0, requests);
 }
 
+
+
+/////////////////////////////
+// ffx_signTransaction
+
+// Serialize the tx into the arena, claiming only the space used, and hash
+// it, so an approval only needs to sign. The views are formatted as the
+// panel slides in, unless another prompt is shown, in which case they are
+// formatted now, while the user is still on it.
+static RequestError prepareSign(Requests *requests, Request *request,
+  FfxCborCursor params, FfxCborBuilder *result) {
+
+    size_t length = 0;
+    uint8_t *buffer = arenaGetFree(&requests->arena, &length);
+
+    request->tx = ffx_tx_serializeUnsigned(params, buffer, length);
+    if (request->tx.error) { return RequestErrorInvalid; }
+
+    if (arenaAlloc(&requests->arena, request->tx.length) == NULL) {
+        return RequestErrorInternal;
+    }
+
+    printf("panel-tx: queued ");
+    ffx_tx_dump(request->tx);
+
+    ffx_hash_keccak256(request->digest.data, request->tx.bytes,
+      request->tx.length);
+
+    if (!requests->busy) { return RequestErrorNone; }
+
+    // If this fails (e.g. the arena is short), the panel tries again
+    const TxModel *model = NULL;
+    uint32_t t0 = ticks();
+    if (buildModel(&model, request->tx, &requests->arena)) {
+        request->context = model;
+    }
+    printf("panel-tx: prepared queued view dt=%ld\n", ticks() - t0);
+
+    return RequestErrorNone;
+}
+
+static uint32_t promptSign(Requests *requests, Request *request) {
+    return pushPanelPage(&request->tx, request->context, PanelTxViewSummary,
+      0, requests);
+}
+
+static RequestError replySign(Requests *requests, Request *request,
+  uint32_t result, FfxCborBuilder *reply) {
+
+    if (result == PANEL_TX_REJECT) {
+        return RequestErrorRejected;
+    } else if (result != PANEL_TX_APPROVE) {
+        return RequestErrorInternal;
+    }
+
+    // Get the private key
+    FfxEcPrivkey privkey;
+    assert(ffx_deviceTestPrivkey(&privkey, ACCOUNT_INDEX));
+
+    // Sign the transaction (using the precomputed generator table)
+    uint32_t t0 = ticks();
+    FfxEcSignature sig;
+    bool status = secp256k1Sign(sig.data, privkey.data, request->digest.data);
+    printf("sig: status=%d dt=%ld\n", status, ticks() - t0);
+
+    memset(privkey.data, 0, sizeof(privkey.data));
+
+    if (!status) { return RequestErrorInternal; }
+
+    ffx_cbor_appendMap(reply, 3);
+    ffx_cbor_appendString(reply, "r");
+    ffx_cbor_appendData(reply, &sig.data[0], 32);
+    ffx_cbor_appendString(reply, "s");
+    ffx_cbor_appendData(reply, &sig.data[32], 32);
+    ffx_cbor_appendString(reply, "v");
+    ffx_cbor_appendNumber(reply, sig.data[64]);
+
+    return RequestErrorNone;
+}
+
+static const RequestMethod methodSign = {
+    .name = "ffx_signTransaction",
+    .flags = RequestFlagInteractive,
+    .maxParams = MAX_TX_FIELDS,
+    .arenaSize = SIGN_REPLY_SIZE,
+    .callFunc = prepareSign,
+    .promptFunc = promptSign,
+    .replyFunc = replySign,
+};
+
+bool panelTxRegister() {
+    return requestsRegister(&methodSign);
+}
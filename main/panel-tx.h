@@ -10,9 +10,15 @@ extern "C" {
 #include "firefly-tx.h"
 
 #include "panel-info.h"
+#include "requests.h"
 
 
-int pushPanelTx(FfxDataResult *tx, PanelTxView view);
+// Messages arriving while shown are passed to %requests%, whose arena
+// also holds the formatted view (until the requests are released)
+int pushPanelTx(FfxDataResult *tx, PanelTxView view, Requests *requests);
+
+// Register ffx_signTransaction, which prompts with this panel
+bool panelTxRegister();
 
 
 #ifdef __cplusplus
@@ -0,0 +1,81 @@
+#include <string.h>
+
+#include "playback.h"
+
+
+static uint32_t getDuration(Playback *playback, uint32_t frame) {
+    uint32_t duration = playback->duration(playback->arg, frame);
+    return duration ? duration: 1;
+}
+
+void playbackInit(Playback *playback, uint32_t frameCount,
+  PlaybackDurationFunc duration, void *arg, PlaybackPolicy policy) {
+
+    memset(playback, 0, sizeof(Playback));
+    playback->policy = policy;
+    playback->frameCount = frameCount;
+    playback->duration = duration;
+    playback->arg = arg;
+}
+
+void playbackRestart(Playback *playback) {
+    playback->started = false;
+}
+
+bool playbackUpdate(Playback *playback, uint32_t now) {
+    if (playback->frameCount == 0) { return false; }
+
+    if (!playback->started) {
+        playback->started = true;
+        playback->frame = 0;
+        playback->due = now;
+        playback->deadline = now + getDuration(playback, 0);
+        playback->stats.shown++;
+        return true;
+    }
+
+    // Fast path; nothing to do until the current frame expires. The
+    // subtraction keeps this correct across tick wrap-around.
+    if ((int32_t)(now - playback->deadline) < 0) { return false; }
+
+    uint32_t frame = (playback->frame + 1) % playback->frameCount;
+    uint32_t due = playback->deadline;
+
+    if (playback->policy == PlaybackPolicySkip) {
+        // Skip every frame that would already have expired; after a full
+        // loop (e.g. the panel was not rendering) just resync to now
+        uint32_t duration = getDuration(playback, frame);
+        for (uint32_t i = 0; (int32_t)(now - (due + duration)) >= 0; i++) {
+            if (i == playback->frameCount) {
+                playback->stats.late++;
+                due = now;
+                break;
+            }
+
+            playback->stats.dropped++;
+            due += duration;
+            frame = (frame + 1) % playback->frameCount;
+            duration = getDuration(playback, frame);
+        }
+    }
+
+    uint32_t duration = getDuration(playback, frame);
+
+    if (now - due > duration / 2) {
+        playback->stats.late++;
+
+        // Push the schedule back so the held frame gets its full time
+        if (playback->policy == PlaybackPolicyHold) { due = now; }
+    }
+
+    playback->due = due;
+    playback->deadline = due + duration;
+
+    // Single-frame clips never change
+    if (frame == playback->frame) { return false; }
+
+    playback->frame = frame;
+    playback->stats.shown++;
+
+    return true;
+}
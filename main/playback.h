@@ -0,0 +1,69 @@
+#ifndef __PLAYBACK_H__
+#define __PLAYBACK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+typedef enum PlaybackPolicy {
+    // Stay in sync with the clock; frames whose time has passed are dropped
+    PlaybackPolicySkip = 0,
+
+    // Show every frame; when late, the schedule is pushed back instead
+    PlaybackPolicyHold,
+} PlaybackPolicy;
+
+// The display duration (in ms) of %frame%
+typedef uint16_t (*PlaybackDurationFunc)(void *arg, uint32_t frame);
+
+typedef struct PlaybackStats {
+    // Frames shown
+    uint32_t shown;
+
+    // Frames skipped over without being shown (PlaybackPolicySkip)
+    uint32_t dropped;
+
+    // Frames shown more than half their duration after they were due
+    uint32_t late;
+} PlaybackStats;
+
+typedef struct Playback {
+    PlaybackPolicy policy;
+
+    uint32_t frameCount;
+    PlaybackDurationFunc duration;
+    void *arg;
+
+    bool started;
+    uint32_t frame;
+
+    // When the current frame was due and when the next one is
+    uint32_t due;
+    uint32_t deadline;
+
+    PlaybackStats stats;
+} Playback;
+
+
+// Prepare %playback% to schedule %frameCount% frames, each lasting
+// %duration(arg, frame)% ms; durations of 0 are treated as 1 ms.
+void playbackInit(Playback *playback, uint32_t frameCount,
+  PlaybackDurationFunc duration, void *arg, PlaybackPolicy policy);
+
+// Advance the schedule to %now% (ms). Returns true if the frame to show
+// changed; otherwise the caller should leave the scene untouched.
+bool playbackUpdate(Playback *playback, uint32_t now);
+
+// Restart from frame 0 at the next update; the stats are kept
+void playbackRestart(Playback *playback);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __PLAYBACK_H__ */
@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_cpu.h"
+#else
+#include <time.h>
+#endif
+
+#include "profiler.h"
+
+#if PROFILER_ENABLED
+
+
+_Static_assert((PROFILER_RING_LENGTH & (PROFILER_RING_LENGTH - 1)) == 0,
+  "ring length must be a power of two");
+
+
+typedef struct Totals {
+    uint64_t duration;
+    uint64_t pixels;
+    uint32_t count;
+    uint32_t longest;
+} Totals;
+
+typedef struct Profiler {
+    ProfilerSample ring[PROFILER_RING_LENGTH];
+    uint32_t head;
+
+    Totals totals[ProfilerKindCount];
+
+    // Pixels written by nodes into each fragment, and times rendered
+    uint64_t fragmentPixels[PROFILER_FRAGMENTS];
+    uint32_t fragmentCount[PROFILER_FRAGMENTS];
+
+    uint32_t lastFrame;
+} Profiler;
+
+static Profiler profiler = { 0 };
+
+static const char* kindNames[] = {
+    "frame", "update", "box", "label", "image", "fragment", "transfer"
+};
+
+_Static_assert(sizeof(kindNames) / sizeof(kindNames[0]) == ProfilerKindCount,
+  "missing kind name");
+
+
+uint32_t profilerNow() {
+#ifdef ESP_PLATFORM
+    return esp_cpu_get_cycle_count();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ull + now.tv_nsec;
+#endif
+}
+
+void profilerRecord(ProfilerKind kind, uint32_t fragment, uint32_t start,
+  uint32_t pixels) {
+
+    if (kind >= ProfilerKindCount) { return; }
+
+    uint32_t duration = profilerNow() - start;
+
+    ProfilerSample *sample =
+      &profiler.ring[profiler.head++ & (PROFILER_RING_LENGTH - 1)];
+    sample->start = start;
+    sample->duration = duration;
+    sample->kind = kind;
+    sample->fragment = fragment;
+    sample->reserved = 0;
+    sample->pixels = pixels;
+
+    Totals *totals = &profiler.totals[kind];
+    totals->duration += duration;
+    totals->pixels += pixels;
+    totals->count++;
+    if (duration > totals->longest) { totals->longest = duration; }
+
+    if (fragment >= PROFILER_FRAGMENTS) { return; }
+
+    // Node pixels count towards overdraw; the fragment counts its renders
+    if (kind == ProfilerKindBox || kind == ProfilerKindLabel ||
+      kind == ProfilerKindImage) {
+        profiler.fragmentPixels[fragment] += pixels;
+    } else if (kind == ProfilerKindFragment) {
+        profiler.fragmentCount[fragment]++;
+    }
+}
+
+void profilerMarkFrame() {
+    uint32_t now = profilerNow();
+    if (profiler.lastFrame) {
+        profilerRecord(ProfilerKindFrame, PROFILER_FRAGMENTS,
+          profiler.lastFrame, 0);
+    }
+    profiler.lastFrame = now;
+}
+
+size_t profilerGetSamples(ProfilerSample *samples, size_t count) {
+    size_t available = profiler.head;
+    if (available > PROFILER_RING_LENGTH) {
+        available = PROFILER_RING_LENGTH;
+    }
+    if (count > available) { count = available; }
+
+    for (size_t i = 0; i < count; i++) {
+        uint32_t index = profiler.head - count + i;
+        samples[i] = profiler.ring[index & (PROFILER_RING_LENGTH - 1)];
+    }
+
+    return count;
+}
+
+void profilerDump(const char *tag, bool samples) {
+    for (int kind = 0; kind < ProfilerKindCount; kind++) {
+        Totals *totals = &profiler.totals[kind];
+        if (totals->count == 0) { continue; }
+
+        printf("[%s] %s: count=%ld average=%lld longest=%ld pixels=%lld\n",
+          tag, kindNames[kind], totals->count,
+          totals->duration / totals->count, totals->longest,
+          totals->pixels);
+    }
+
+    // Pixels written per pixel of the fragment, x10
+    for (int i = 0; i < PROFILER_FRAGMENTS; i++) {
+        if (profiler.fragmentCount[i] == 0) { continue; }
+        uint64_t area = (uint64_t)PROFILER_FRAGMENT_AREA *
+          profiler.fragmentCount[i];
+        uint32_t overdraw = profiler.fragmentPixels[i] * 10 / area;
+        printf("[%s] fragment %d: renders=%ld overdraw=%ld.%ld\n", tag, i,
+          profiler.fragmentCount[i], overdraw / 10, overdraw % 10);
+    }
+
+    if (!samples) { return; }
+
+    ProfilerSample ring[PROFILER_RING_LENGTH];
+    size_t count = profilerGetSamples(ring, PROFILER_RING_LENGTH);
+    for (size_t i = 0; i < count; i++) {
+        ProfilerSample *sample = &ring[i];
+        printf("[%s] sample: kind=%s fragment=%d start=%ld duration=%ld "
+          "pixels=%ld\n", tag, kindNames[sample->kind], sample->fragment,
+          sample->start, sample->duration, sample->pixels);
+    }
+}
+
+void profilerReset() {
+    memset(&profiler, 0, sizeof(Profiler));
+}
+
+#endif /* PROFILER_ENABLED */
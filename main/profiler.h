@@ -0,0 +1,105 @@
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+// Render profiling is compiled out unless enabled by the build (see
+// main/CMakeLists.txt); the PROFILE_* macros then cost nothing and the
+// functions below do not exist
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED         (0)
+#endif
+
+// Recent samples kept, for dumping or capture; a power of two
+#define PROFILER_RING_LENGTH     (256)
+
+// Strips the display is rendered and transferred in
+#define PROFILER_FRAGMENTS       (10)
+#define PROFILER_FRAGMENT_AREA   (240 * 24)
+
+
+typedef enum ProfilerKind {
+    // From one frame mark to the next
+    ProfilerKindFrame = 0,
+
+    // Per-frame work of the panel (e.g. decoding video, moving sprites)
+    ProfilerKindUpdate,
+
+    // Rendering a node into a fragment, by node type; pixels are those
+    // written (for overdraw)
+    ProfilerKindBox,
+    ProfilerKindLabel,
+    ProfilerKindImage,
+
+    // Rendering a whole fragment, and sending it to the display; the
+    // index is the fragment
+    ProfilerKindFragment,
+    ProfilerKindTransfer,
+
+    ProfilerKindCount
+} ProfilerKind;
+
+typedef struct ProfilerSample {
+    // Cycles (or ns on a host)
+    uint32_t start;
+    uint32_t duration;
+
+    uint8_t kind;
+    uint8_t fragment;
+    uint16_t reserved;
+
+    uint32_t pixels;
+} ProfilerSample;
+
+
+// The cycle counter (ns on a host)
+uint32_t profilerNow();
+
+// Record %kind% as having run from %start% (profilerNow) until now
+void profilerRecord(ProfilerKind kind, uint32_t fragment, uint32_t start,
+  uint32_t pixels);
+
+// End a frame; records a ProfilerKindFrame since the previous mark
+void profilerMarkFrame();
+
+// Copy up to %count% of the most recent samples, oldest first, into
+// %samples% (e.g. for a host build to save); returns the number copied
+size_t profilerGetSamples(ProfilerSample *samples, size_t count);
+
+// Write the totals per kind, the overdraw per fragment and, if
+// %samples%, the ring to the console, prefixed with %tag%
+void profilerDump(const char *tag, bool samples);
+
+void profilerReset();
+
+
+#if PROFILER_ENABLED
+
+#define PROFILE_BEGIN(name)      uint32_t name = profilerNow()
+#define PROFILE_END(name, kind, fragment, pixels) \
+  profilerRecord((kind), (fragment), (name), (pixels))
+#define PROFILE_FRAME()          profilerMarkFrame()
+#define PROFILE_DUMP(tag)        profilerDump((tag), false)
+
+#else
+
+#define PROFILE_BEGIN(name)
+#define PROFILE_END(name, kind, fragment, pixels)
+#define PROFILE_FRAME()
+#define PROFILE_DUMP(tag)
+
+#endif /* PROFILER_ENABLED */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __PROFILER_H__ */
@@ -0,0 +1,590 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "firefly-address.h"
+#include "firefly-hollows.h"
+
+#include "accounts.h"
+#include "requests.h"
+
+#include "utils.h"
+
+
+#define ACCOUNT_INDEX        (0)
+
+#define REPLY_BUFFER_SIZE    (128)
+
+#define ACK_BUFFER_SIZE      (64)
+
+// Longest method name which can be registered
+#define MAX_METHOD_LENGTH    (31)
+
+
+static const char* getErrorMessage(RequestError error) {
+    switch (error) {
+        case RequestErrorUnsupported:
+            return "Unsupported operation";
+        case RequestErrorInvalid:
+            return "invalid request";
+        case RequestErrorBusy:
+            return "too many pending requests";
+        case RequestErrorInteractive:
+            return "method cannot be batched";
+        case RequestErrorTooLarge:
+            return "payload too large";
+        case RequestErrorExpired:
+            return "upload expired";
+        case RequestErrorRejected:
+            return "user rejected request";
+        default:
+            break;
+    }
+    return "internal error";
+}
+
+static void sendReply(Requests *requests, uint32_t id,
+  FfxCborBuilder *reply) {
+
+    const Transport *transport = requests->transport;
+    transport->sendReply(transport->context, id, reply);
+}
+
+static void sendError(Requests *requests, uint32_t id, RequestError error) {
+    const Transport *transport = requests->transport;
+    transport->sendError(transport->context, id, error,
+      getErrorMessage(error));
+}
+
+
+/////////////////////////////
+// Registry
+
+// Open addressing; at least half the slots are always empty, so probes
+// stay short and a lookup always reaches an empty slot
+#define METHOD_SLOTS         (2 * REQUESTS_METHODS_MAX)
+
+// In registration order
+static const RequestMethod *methods[REQUESTS_METHODS_MAX] = { 0 };
+static size_t methodCount = 0;
+
+// Index into methods plus one; 0 is empty
+static uint8_t slots[METHOD_SLOTS] = { 0 };
+
+static bool builtinsRegistered = false;
+static void registerBuiltins();
+
+// FNV-1a
+static uint32_t hashName(const char *name) {
+    uint32_t hash = 0x811c9dc5;
+    while (*name) { hash = (hash ^ (uint8_t)(*name++)) * 0x01000193; }
+    return hash;
+}
+
+// The slot holding %name%, or the empty slot it belongs in
+static size_t findSlot(const char *name) {
+    size_t slot = hashName(name) % METHOD_SLOTS;
+    while (slots[slot]) {
+        if (strcmp(methods[slots[slot] - 1]->name, name) == 0) { break; }
+        slot = (slot + 1) % METHOD_SLOTS;
+    }
+    return slot;
+}
+
+static bool addMethod(const RequestMethod *method) {
+    if (methodCount == REQUESTS_METHODS_MAX) { return false; }
+    if (strlen(method->name) > MAX_METHOD_LENGTH) { return false; }
+
+    size_t slot = findSlot(method->name);
+    if (slots[slot]) { return false; }
+
+    methods[methodCount++] = method;
+    slots[slot] = methodCount;
+
+    return true;
+}
+
+bool requestsRegister(const RequestMethod *method) {
+    registerBuiltins();
+
+    if (!addMethod(method)) {
+        printf("[requests] failed to register: %s\n", method->name);
+        return false;
+    }
+
+    return true;
+}
+
+const RequestMethod* requestsGetMethod(const char *name) {
+    registerBuiltins();
+
+    size_t slot = findSlot(name);
+    if (slots[slot] == 0) { return NULL; }
+    return methods[slots[slot] - 1];
+}
+
+// Items in params; anything not an array or map has none
+static bool checkParams(const RequestMethod *method, FfxCborCursor params) {
+    size_t count = 0;
+    if (ffx_cbor_getLength(params, &count)) { count = 0; }
+    return (count <= method->maxParams);
+}
+
+
+/////////////////////////////
+// Methods answered immediately
+
+static RequestError getAccounts(Requests *requests, Request *request,
+  FfxCborCursor params, FfxCborBuilder *result) {
+
+    uint32_t t0 = ticks();
+
+    // Dapps poll this; only the first call derives the address
+    FfxAddress address;
+    if (!accountsGetAddress(ACCOUNT_INDEX, &address)) {
+        return RequestErrorInternal;
+    }
+
+    printf("getAccounts: dt=%ld\n", ticks() - t0);
+
+    ffx_cbor_appendArray(result, 1);
+    ffx_cbor_appendData(result, address.data, sizeof(address.data));
+
+    return RequestErrorNone;
+}
+
+// Handled before dispatch; see handleUpload
+static const char* uploadMethods[] = {
+    "ffx_uploadBegin",
+    "ffx_uploadChunk",
+    "ffx_uploadStatus",
+};
+
+#define UPLOAD_METHOD_COUNT  (sizeof(uploadMethods) / sizeof(uploadMethods[0]))
+
+static RequestError getCapabilities(Requests *requests, Request *request,
+  FfxCborCursor params, FfxCborBuilder *result) {
+
+    ffx_cbor_appendArray(result, methodCount + UPLOAD_METHOD_COUNT);
+    for (size_t i = 0; i < methodCount; i++) {
+        ffx_cbor_appendString(result, methods[i]->name);
+    }
+    for (size_t i = 0; i < UPLOAD_METHOD_COUNT; i++) {
+        ffx_cbor_appendString(result, uploadMethods[i]);
+    }
+
+    return RequestErrorNone;
+}
+
+static RequestError callBatch(Requests *requests, Request *request,
+  FfxCborCursor params, FfxCborBuilder *result);
+
+static const RequestMethod methodAccounts = {
+    .name = "ffx_accounts",
+    .maxParams = 1,
+    .arenaSize = REPLY_BUFFER_SIZE,
+    .callFunc = getAccounts,
+};
+
+static const RequestMethod methodBatch = {
+    .name = "ffx_batch",
+    .maxParams = REQUESTS_BATCH_MAX,
+    .arenaSize = REPLY_BUFFER_SIZE * (REQUESTS_BATCH_MAX + 1),
+    .callFunc = callBatch,
+};
+
+// Sized for every name in the registry
+static const RequestMethod methodCapabilities = {
+    .name = "ffx_capabilities",
+    .maxParams = 0,
+    .arenaSize = 16 + (REQUESTS_METHODS_MAX + UPLOAD_METHOD_COUNT) *
+      (MAX_METHOD_LENGTH + 2),
+    .callFunc = getCapabilities,
+};
+
+static void registerBuiltins() {
+    if (builtinsRegistered) { return; }
+    builtinsRegistered = true;
+
+    addMethod(&methodAccounts);
+    addMethod(&methodBatch);
+    addMethod(&methodCapabilities);
+}
+
+// Reads entry %index% of %array% as data (or a string)
+static bool readData(FfxCborCursor array, size_t index, const uint8_t **data,
+  size_t *length) {
+
+    FfxCborCursor item = array;
+    if (ffx_cbor_followIndex(&item, index)) { return false; }
+    return (ffx_cbor_getData(item, data, length) == 0);
+}
+
+// Reads entry %index% of %array% as a string of at most %maxLength%
+static bool readString(FfxCborCursor array, size_t index, char *str,
+  size_t maxLength) {
+
+    const uint8_t *data = NULL;
+    size_t length = 0;
+    if (!readData(array, index, &data, &length)) { return false; }
+    if (length > maxLength) { return false; }
+    memcpy(str, data, length);
+    str[length] = 0;
+
+    return true;
+}
+
+static bool readNumber(FfxCborCursor array, size_t index, uint64_t *value) {
+    FfxCborCursor item = array;
+    if (ffx_cbor_followIndex(&item, index)) { return false; }
+    return (ffx_cbor_getValue(item, value) == 0);
+}
+
+// Reads call %index% of a batch, [ method, params ]
+static bool readCall(FfxCborCursor batch, size_t index, char *method,
+  FfxCborCursor *params) {
+
+    FfxCborCursor call = batch;
+    if (ffx_cbor_followIndex(&call, index)) { return false; }
+
+    if (!readString(call, 0, method, MAX_METHOD_LENGTH)) { return false; }
+
+    *params = call;
+    return (ffx_cbor_followIndex(params, 1) == 0);
+}
+
+// Append the result of a batched call to %result%; nothing is appended
+// on error
+static RequestError callBatched(Requests *requests, Request *request,
+  FfxCborCursor batch, size_t index, FfxCborBuilder *result) {
+
+    char name[MAX_METHOD_LENGTH + 1];
+    FfxCborCursor params;
+    if (!readCall(batch, index, name, &params)) { return RequestErrorInvalid; }
+
+    const RequestMethod *method = requestsGetMethod(name);
+    if (method == NULL) { return RequestErrorUnsupported; }
+    if (method->flags & RequestFlagInteractive) {
+        return RequestErrorInteractive;
+    }
+    if (method == &methodBatch) { return RequestErrorInvalid; }
+    if (method->arenaSize > REPLY_BUFFER_SIZE) { return RequestErrorTooLarge; }
+    if (!checkParams(method, params)) { return RequestErrorInvalid; }
+
+    return method->callFunc(requests, request, params, result);
+}
+
+// The result is an array with each call's result, or for a failed call a
+// map of its error code and message. Each call gets REPLY_BUFFER_SIZE of
+// the batch's arena (the extra one holds the array header), so methods
+// whose reply may be larger (e.g. ffx_capabilities) fail as too large.
+static RequestError callBatch(Requests *requests, Request *request,
+  FfxCborCursor params, FfxCborBuilder *result) {
+
+    size_t count = 0;
+    if (ffx_cbor_getLength(params, &count)) { return RequestErrorInvalid; }
+
+    ffx_cbor_appendArray(result, count);
+
+    for (size_t i = 0; i < count; i++) {
+        RequestError error = callBatched(requests, request, params, i,
+          result);
+
+        if (error) {
+            ffx_cbor_appendMap(result, 2);
+            ffx_cbor_appendString(result, "error");
+            ffx_cbor_appendNumber(result, error);
+            ffx_cbor_appendString(result, "message");
+            ffx_cbor_appendString(result, getErrorMessage(error));
+        }
+    }
+
+    return RequestErrorNone;
+}
+
+// Prepare and queue a call to an interactive %method%
+static RequestError queueRequest(Requests *requests, uint32_t id,
+  const RequestMethod *method, FfxCborCursor params) {
+
+    if (requests->count == REQUESTS_QUEUE_LENGTH) { return RequestErrorBusy; }
+
+    Request *request = &requests->queue[(requests->head + requests->count) %
+      REQUESTS_QUEUE_LENGTH];
+    memset(request, 0, sizeof(Request));
+    request->id = id;
+    request->method = method;
+
+    // Anything the method keeps in the arena stays until the queue empties
+    RequestError error = method->callFunc(requests, request, params, NULL);
+    if (error) { return error; }
+
+    requests->count++;
+    requests->queued++;
+
+    return RequestErrorNone;
+}
+
+
+/////////////////////////////
+// Uploads
+
+static RequestError getUploadError(UploadStatus status) {
+    switch (status) {
+        case UploadStatusOk:
+        case UploadStatusComplete:
+            return RequestErrorNone;
+        case UploadStatusBusy:
+            return RequestErrorBusy;
+        case UploadStatusTooLarge:
+            return RequestErrorTooLarge;
+        case UploadStatusUnknown:
+            return RequestErrorExpired;
+        default:
+            break;
+    }
+    return RequestErrorInvalid;
+}
+
+// The progress of the upload, so the sender knows what to (re)send next
+static void sendAck(Requests *requests, uint32_t id) {
+    Upload *upload = &requests->upload;
+
+    size_t mark = arenaSave(&requests->arena);
+
+    uint8_t *buffer = arenaAlloc(&requests->arena, ACK_BUFFER_SIZE);
+    if (buffer == NULL) {
+        sendError(requests, id, RequestErrorInternal);
+        return;
+    }
+
+    FfxCborBuilder reply = ffx_cbor_build(buffer, ACK_BUFFER_SIZE);
+
+    ffx_cbor_appendMap(&reply, 5);
+    ffx_cbor_appendString(&reply, "upload");
+    ffx_cbor_appendNumber(&reply, upload->id);
+    ffx_cbor_appendString(&reply, "chunk");
+    ffx_cbor_appendNumber(&reply, upload->chunkSize);
+    ffx_cbor_appendString(&reply, "next");
+    ffx_cbor_appendNumber(&reply, upload->next);
+    ffx_cbor_appendString(&reply, "received");
+    ffx_cbor_appendNumber(&reply, upload->received);
+    ffx_cbor_appendString(&reply, "window");
+    ffx_cbor_appendNumber(&reply, UPLOAD_WINDOW);
+
+    sendReply(requests, id, &reply);
+
+    arenaRestore(&requests->arena, mark);
+}
+
+// [ method, length, mtu ]
+static RequestError beginUpload(Requests *requests, uint32_t id,
+  FfxCborCursor params) {
+
+    char method[UPLOAD_METHOD_LENGTH + 1];
+    uint64_t length = 0, mtu = 0;
+    if (!readString(params, 0, method, UPLOAD_METHOD_LENGTH) ||
+      !readNumber(params, 1, &length) || !readNumber(params, 2, &mtu)) {
+        return RequestErrorInvalid;
+    }
+
+    // Only methods which exist, so a payload is never sent for nothing
+    if (requestsGetMethod(method) == NULL) {
+        return RequestErrorUnsupported;
+    }
+
+    UploadStatus status = uploadBegin(&requests->upload, &requests->arena,
+      method, length, mtu, ticks());
+    if (status) { return getUploadError(status); }
+
+    sendAck(requests, id);
+    return RequestErrorNone;
+}
+
+// [ upload, seq, data ]; the chunk completing the payload is answered by
+// the method it was for, with the payload as its params
+static RequestError receiveChunk(Requests *requests, uint32_t id,
+  FfxCborCursor params) {
+
+    Upload *upload = &requests->upload;
+
+    uint64_t uploadId = 0, seq = 0;
+    const uint8_t *data = NULL;
+    size_t length = 0;
+    if (!readNumber(params, 0, &uploadId) || !readNumber(params, 1, &seq) ||
+      !readData(params, 2, &data, &length)) {
+        return RequestErrorInvalid;
+    }
+
+    UploadStatus status = uploadChunk(upload, uploadId, seq, data, length,
+      ticks());
+
+    if (status == UploadStatusOk) {
+        sendAck(requests, id);
+        return RequestErrorNone;
+
+    } else if (status != UploadStatusComplete) {
+        return getUploadError(status);
+    }
+
+    char method[UPLOAD_METHOD_LENGTH + 1];
+    strcpy(method, upload->method);
+    FfxCborCursor payload = ffx_cbor_walk(upload->data, upload->length);
+
+    // The payload stays in the arena until the next release
+    uploadFinish(upload);
+
+    requestsHandleMessage(requests, id, method, payload);
+
+    return RequestErrorNone;
+}
+
+// [ upload ]; for resuming, e.g. after reconnecting
+static RequestError getUploadStatus(Requests *requests, uint32_t id,
+  FfxCborCursor params) {
+
+    uint64_t uploadId = 0;
+    if (!readNumber(params, 0, &uploadId)) { return RequestErrorInvalid; }
+
+    Upload *upload = &requests->upload;
+    if (!uploadIsActive(upload) || uploadId != upload->id) {
+        return RequestErrorExpired;
+    }
+
+    sendAck(requests, id);
+    return RequestErrorNone;
+}
+
+// Uploads are handled before dispatch, as the payload must outlive the
+// message; returns false for any other method
+static bool handleUpload(Requests *requests, uint32_t id, const char *name,
+  FfxCborCursor params) {
+
+    RequestError error = RequestErrorNone;
+    if (strcmp(name, "ffx_uploadBegin") == 0) {
+        error = beginUpload(requests, id, params);
+    } else if (strcmp(name, "ffx_uploadChunk") == 0) {
+        error = receiveChunk(requests, id, params);
+    } else if (strcmp(name, "ffx_uploadStatus") == 0) {
+        error = getUploadStatus(requests, id, params);
+    } else {
+        return false;
+    }
+
+    if (error) { sendError(requests, id, error); }
+
+    return true;
+}
+
+
+/////////////////////////////
+// API
+
+void requestsInit(Requests *requests) {
+    memset(requests, 0, sizeof(Requests));
+    arenaInit(&requests->arena, requests->arenaData,
+      sizeof(requests->arenaData));
+    uploadInit(&requests->upload);
+    requests->transport = &transportRadio;
+}
+
+void requestsSetTransport(Requests *requests, const Transport *transport) {
+    requests->transport = transport;
+}
+
+void requestsHandleMessage(Requests *requests, uint32_t id,
+  const char *name, FfxCborCursor params) {
+
+    printf("GOT MESSAGE: id=%ld, method=%s cbor=", id, name);
+    ffx_cbor_dump(params);
+
+    if (handleUpload(requests, id, name, params)) { return; }
+
+    // Replies are sent before returning, so their memory is only needed
+    // until then
+    size_t mark = arenaSave(&requests->arena);
+
+    RequestError error = RequestErrorNone;
+
+    const RequestMethod *method = requestsGetMethod(name);
+    if (method == NULL) {
+        error = RequestErrorUnsupported;
+
+    } else if (!checkParams(method, params)) {
+        error = RequestErrorInvalid;
+
+    } else if (method->flags & RequestFlagInteractive) {
+        error = queueRequest(requests, id, method, params);
+        if (error) {
+            requests->refused++;
+            arenaRestore(&requests->arena, mark);
+            sendError(requests, id, error);
+        }
+        return;
+
+    } else {
+        uint8_t *buffer = arenaAlloc(&requests->arena, method->arenaSize);
+        if (buffer == NULL) {
+            error = RequestErrorInternal;
+        } else {
+            Request request = { .id = id, .method = method };
+            FfxCborBuilder reply = ffx_cbor_build(buffer, method->arenaSize);
+            error = method->callFunc(requests, &request, params, &reply);
+            if (!error) { sendReply(requests, id, &reply); }
+        }
+    }
+
+    if (error) { sendError(requests, id, error); }
+    requests->answered++;
+
+    arenaRestore(&requests->arena, mark);
+}
+
+bool requestsNext(Requests *requests, Request *request) {
+    if (requests->count == 0) { return false; }
+
+    *request = requests->queue[requests->head];
+    requests->head = (requests->head + 1) % REQUESTS_QUEUE_LENGTH;
+    requests->count--;
+
+    return true;
+}
+
+void requestsPrompt(Requests *requests, Request *request) {
+    uint32_t result = request->method->promptFunc(requests, request);
+    printf("GOT: %ld\n", result);
+
+    requestsAnswer(requests, request, result);
+}
+
+void requestsAnswer(Requests *requests, Request *request, uint32_t result) {
+    const RequestMethod *method = request->method;
+
+    size_t mark = arenaSave(&requests->arena);
+
+    RequestError error = RequestErrorInternal;
+
+    uint8_t *buffer = arenaAlloc(&requests->arena, method->arenaSize);
+    if (buffer) {
+        FfxCborBuilder reply = ffx_cbor_build(buffer, method->arenaSize);
+        error = method->replyFunc(requests, request, result, &reply);
+        if (!error) { sendReply(requests, request->id, &reply); }
+    }
+
+    if (error) { sendError(requests, request->id, error); }
+
+    arenaRestore(&requests->arena, mark);
+}
+
+void requestsRelease(Requests *requests) {
+    if (requests->count || requests->busy) { return; }
+
+    // An upload the client stopped sending would otherwise hold the
+    // arena (and everything allocated after it) forever
+    uploadExpire(&requests->upload, ticks());
+    if (uploadIsActive(&requests->upload)) { return; }
+
+    printf("[requests] answered=%ld queued=%ld refused=%ld\n",
+      requests->answered, requests->queued, requests->refused);
+    arenaDumpStats(&requests->arena, "requests");
+
+    arenaReset(&requests->arena);
+}
@@ -0,0 +1,179 @@
+#ifndef __REQUESTS_H__
+#define __REQUESTS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "firefly-cbor.h"
+#include "firefly-ecc.h"
+#include "firefly-tx.h"
+
+#include "arena.h"
+#include "transport.h"
+#include "upload.h"
+
+
+// Interactive requests waiting for the user, including the one shown;
+// more are refused as busy
+#define REQUESTS_QUEUE_LENGTH    (4)
+
+// Most calls in a single ffx_batch
+#define REQUESTS_BATCH_MAX       (8)
+
+// Scratch memory for requests (queued txs, uploads, replies and strings
+// for review), reserved with the panel so requests do not use the heap
+// shared with the radio; tune with the high-water mark logged. An
+// uploaded tx is held along with its serialized form, so this bounds
+// uploads to a little under half.
+#define REQUESTS_ARENA_SIZE      (24 * 1024)
+
+
+// Most methods which can be registered
+#define REQUESTS_METHODS_MAX     (16)
+
+
+typedef enum RequestError {
+    RequestErrorNone           = 0,
+    RequestErrorUnsupported    = 1,
+    RequestErrorInvalid        = 2,
+    RequestErrorBusy           = 3,
+    RequestErrorInteractive    = 4,
+    RequestErrorTooLarge       = 5,
+    RequestErrorExpired        = 6,
+    RequestErrorInternal       = 42,
+    RequestErrorRejected       = 1000,
+} RequestError;
+
+typedef enum RequestFlag {
+    RequestFlagNone            = 0,
+
+    // The user must approve the method; calls are queued and shown in
+    // turn, so the method cannot be batched
+    RequestFlagInteractive     = (1 << 0),
+} RequestFlag;
+
+typedef struct Request Request;
+typedef struct Requests Requests;
+
+// Append the result for %params% to %result%. For an interactive method,
+// %result% is NULL and this instead prepares %request% for the queue,
+// keeping anything needed until the reply in the arena.
+typedef RequestError (*RequestCallFunc)(Requests *requests, Request *request,
+  FfxCborCursor params, FfxCborBuilder *result);
+
+// Show %request% to the user; returns once they answer, with the answer
+typedef uint32_t (*RequestPromptFunc)(Requests *requests, Request *request);
+
+// Append the reply for the user's answer %result% to %reply%
+typedef RequestError (*RequestReplyFunc)(Requests *requests, Request *request,
+  uint32_t result, FfxCborBuilder *reply);
+
+typedef struct RequestMethod {
+    const char *name;
+    RequestFlag flags;
+
+    // Most items in params (array entries or map keys)
+    size_t maxParams;
+
+    // Arena used to build the reply
+    size_t arenaSize;
+
+    RequestCallFunc callFunc;
+
+    // Interactive methods only
+    RequestPromptFunc promptFunc;
+    RequestReplyFunc replyFunc;
+} RequestMethod;
+
+// A request which needs the user; any payload is in the arena
+struct Request {
+    uint32_t id;
+    const RequestMethod *method;
+
+    // For transactions
+    FfxDataResult tx;
+    FfxEcDigest digest;
+
+    // Anything else the method prepares ahead of the prompt (such as the
+    // formatted view), in the arena
+    const void *context;
+};
+
+struct Requests {
+    Request queue[REQUESTS_QUEUE_LENGTH];
+    uint8_t head;
+    uint8_t count;
+
+    // A request is being shown to the user
+    bool busy;
+
+    uint32_t answered;
+    uint32_t queued;
+    uint32_t refused;
+
+    // Where replies are sent; the radio unless replaced
+    const Transport *transport;
+
+    // A payload being received in chunks, for messages larger than the
+    // link allows
+    Upload upload;
+
+    Arena arena;
+    uint8_t arenaData[REQUESTS_ARENA_SIZE];
+};
+
+
+// Add %method% to those answered; %method% must remain valid. Returns
+// false if the name is taken or there is no room (REQUESTS_METHODS_MAX).
+bool requestsRegister(const RequestMethod *method);
+
+// The registered method named %name%, or NULL
+const RequestMethod* requestsGetMethod(const char *name);
+
+void requestsInit(Requests *requests);
+
+// Send replies over %transport% instead of the radio, e.g. a loopback
+// to drive requests from a host
+void requestsSetTransport(Requests *requests, const Transport *transport);
+
+// Answer a message now, unless it needs the user, in which case it is
+// queued (or refused if the queue is full); safe to call while a request
+// is being shown. Batches (ffx_batch) may only contain methods which do
+// not need the user and whose reply fits in a small buffer (so not
+// ffx_capabilities).
+//
+// Large params may be uploaded in chunks: ffx_uploadBegin([ method,
+// length, mtu ]) replies with an ack, a map of the upload id, chunk
+// size, next missing chunk, bits of the chunks received after it and
+// the window. Chunks, ffx_uploadChunk([ upload, seq, data ]), may be
+// sent up to the window beyond the next missing one without waiting and
+// are each acked, except the one completing the payload, which gets the
+// method's reply. After reconnecting, ffx_uploadStatus([ upload ])
+// replies with an ack to resume from.
+void requestsHandleMessage(Requests *requests, uint32_t id,
+  const char *method, FfxCborCursor params);
+
+// Take the oldest queued request; false if there are none
+bool requestsNext(Requests *requests, Request *request);
+
+// Show %request% to the user and reply with their answer
+void requestsPrompt(Requests *requests, Request *request);
+
+// Reply to %request% with the answer %result% (PANEL_TX_*), without
+// showing it; for headless drivers, such as a loopback
+void requestsAnswer(Requests *requests, Request *request, uint32_t result);
+
+// Free the memory of answered requests, once the queue is empty and no
+// upload is in progress (an idle upload expires after UPLOAD_TIMEOUT)
+void requestsRelease(Requests *requests);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __REQUESTS_H__ */
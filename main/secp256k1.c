@@ -0,0 +1,876 @@
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#include "firefly-ecc.h"
+#else
+#include <time.h>
+#endif
+
+#include "secp256k1.h"
+
+
+// Numbers are 8 little-endian 32-bit words; products are 16
+
+// The field prime; p = 2^256 - 0x1000003d1
+static const uint32_t P[8] = {
+    0xfffffc2f, 0xfffffffe, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff
+};
+
+static const uint32_t P_MINUS_2[8] = {
+    0xfffffc2d, 0xfffffffe, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff
+};
+
+// The group order
+static const uint32_t N[8] = {
+    0xd0364141, 0xbfd25e8c, 0xaf48a03b, 0xbaaedce6,
+    0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff
+};
+
+static const uint32_t N_MINUS_2[8] = {
+    0xd036413f, 0xbfd25e8c, 0xaf48a03b, 0xbaaedce6,
+    0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff
+};
+
+static const uint32_t N_HALF[8] = {
+    0x681b20a0, 0xdfe92f46, 0x57a4501d, 0x5d576e73,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x7fffffff
+};
+
+// 2^256 - n
+#define N_COMPLEMENT_WORDS    (5)
+static const uint32_t N_COMPLEMENT[N_COMPLEMENT_WORDS] = {
+    0x2fc9bebf, 0x402da173, 0x50b75fc4, 0x45512319, 0x00000001
+};
+
+#define BENCHMARK_VECTOR_MESSAGE    ("Satoshi Nakamoto")
+
+// The signature of BENCHMARK_VECTOR_MESSAGE with the private key 1
+static const uint8_t vectorSignature[64] = {
+    0x93, 0x4b, 0x1e, 0xa1, 0x0a, 0x4b, 0x3c, 0x17,
+    0x57, 0xe2, 0xb0, 0xc0, 0x17, 0xd0, 0xb6, 0x14,
+    0x3c, 0xe3, 0xc9, 0xa7, 0xe6, 0xa4, 0xa4, 0x98,
+    0x60, 0xd7, 0xa6, 0xab, 0x21, 0x0e, 0xe3, 0xd8,
+    0x24, 0x42, 0xce, 0x9d, 0x2b, 0x91, 0x60, 0x64,
+    0x10, 0x80, 0x14, 0x78, 0x3e, 0x92, 0x3e, 0xc3,
+    0x6b, 0x49, 0x74, 0x3e, 0x2f, 0xfa, 0x1c, 0x44,
+    0x96, 0xf0, 0x1a, 0x51, 0x2a, 0xaf, 0xd9, 0xe5
+};
+
+
+typedef void (*MulFunc)(uint32_t *r, const uint32_t *a, const uint32_t *b);
+
+typedef struct Jacobian {
+    uint32_t x[8];
+    uint32_t y[8];
+    uint32_t z[8];
+} Jacobian;
+
+
+// Clear secrets in a way the compiler cannot optimize away
+static void wipe(void *data, size_t length) {
+    volatile uint8_t *bytes = data;
+    while (length--) { *bytes++ = 0; }
+}
+
+
+/////////////////////////////
+// SHA-256 and HMAC (for the nonce)
+
+typedef struct Sha256 {
+    uint32_t state[8];
+    uint8_t block[64];
+    uint32_t offset;
+    uint64_t length;
+} Sha256;
+
+typedef struct Hmac {
+    Sha256 inner;
+    Sha256 outer;
+} Hmac;
+
+static const uint32_t sha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ROTR(x, n)     (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256Block(Sha256 *sha) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        const uint8_t *b = &sha->block[4 * i];
+        w[i] = (b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3];
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^
+          (w[i - 15] >> 3);
+        uint32_t s1 = ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^
+          (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = sha->state[0], b = sha->state[1], c = sha->state[2];
+    uint32_t d = sha->state[3], e = sha->state[4], f = sha->state[5];
+    uint32_t g = sha->state[6], h = sha->state[7];
+
+    for (int i = 0; i < 64; i++) {
+        uint32_t s1 = ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25);
+        uint32_t t1 = h + s1 + ((e & f) ^ (~e & g)) + sha256K[i] + w[i];
+        uint32_t s0 = ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22);
+        uint32_t t2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+
+    sha->state[0] += a; sha->state[1] += b; sha->state[2] += c;
+    sha->state[3] += d; sha->state[4] += e; sha->state[5] += f;
+    sha->state[6] += g; sha->state[7] += h;
+}
+
+static void sha256Init(Sha256 *sha) {
+    static const uint32_t init[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    memcpy(sha->state, init, sizeof(init));
+    sha->offset = 0;
+    sha->length = 0;
+}
+
+static void sha256Update(Sha256 *sha, const uint8_t *data, size_t length) {
+    sha->length += length;
+    while (length--) {
+        sha->block[sha->offset++] = *data++;
+        if (sha->offset == 64) {
+            sha256Block(sha);
+            sha->offset = 0;
+        }
+    }
+}
+
+static void sha256Final(Sha256 *sha, uint8_t *digest) {
+    uint64_t bits = sha->length * 8;
+
+    uint8_t pad = 0x80;
+    sha256Update(sha, &pad, 1);
+    pad = 0;
+    while (sha->offset != 56) { sha256Update(sha, &pad, 1); }
+
+    uint8_t length[8];
+    for (int i = 0; i < 8; i++) { length[i] = bits >> (56 - 8 * i); }
+    sha256Update(sha, length, 8);
+
+    for (int i = 0; i < 8; i++) {
+        digest[4 * i + 0] = sha->state[i] >> 24;
+        digest[4 * i + 1] = sha->state[i] >> 16;
+        digest[4 * i + 2] = sha->state[i] >> 8;
+        digest[4 * i + 3] = sha->state[i];
+    }
+}
+
+static void sha256(uint8_t *digest, const uint8_t *data, size_t length) {
+    Sha256 sha;
+    sha256Init(&sha);
+    sha256Update(&sha, data, length);
+    sha256Final(&sha, digest);
+}
+
+// Keys are at most one block (only 32 bytes are used here)
+static void hmacInit(Hmac *hmac, const uint8_t *key, size_t length) {
+    uint8_t pad[64] = { 0 };
+    memcpy(pad, key, length);
+
+    for (int i = 0; i < 64; i++) { pad[i] ^= 0x36; }
+    sha256Init(&hmac->inner);
+    sha256Update(&hmac->inner, pad, 64);
+
+    for (int i = 0; i < 64; i++) { pad[i] ^= 0x36 ^ 0x5c; }
+    sha256Init(&hmac->outer);
+    sha256Update(&hmac->outer, pad, 64);
+
+    wipe(pad, sizeof(pad));
+}
+
+static void hmacUpdate(Hmac *hmac, const uint8_t *data, size_t length) {
+    sha256Update(&hmac->inner, data, length);
+}
+
+static void hmacFinal(Hmac *hmac, uint8_t *digest) {
+    sha256Final(&hmac->inner, digest);
+    sha256Update(&hmac->outer, digest, 32);
+    sha256Final(&hmac->outer, digest);
+    wipe(hmac, sizeof(Hmac));
+}
+
+
+/////////////////////////////
+// Multi-precision helpers
+
+static void fromBytes(uint32_t *r, const uint8_t *bytes) {
+    for (int i = 0; i < 8; i++) {
+        const uint8_t *b = &bytes[28 - 4 * i];
+        r[i] = (b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3];
+    }
+}
+
+static void toBytes(uint8_t *bytes, const uint32_t *a) {
+    for (int i = 0; i < 8; i++) {
+        uint8_t *b = &bytes[28 - 4 * i];
+        b[0] = a[i] >> 24;
+        b[1] = a[i] >> 16;
+        b[2] = a[i] >> 8;
+        b[3] = a[i];
+    }
+}
+
+static uint32_t add8(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    uint64_t acc = 0;
+    for (int i = 0; i < 8; i++) {
+        acc += (uint64_t)a[i] + b[i];
+        r[i] = acc;
+        acc >>= 32;
+    }
+    return acc;
+}
+
+static uint32_t sub8(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    uint32_t borrow = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t diff = (uint64_t)a[i] - b[i] - borrow;
+        r[i] = diff;
+        borrow = (diff >> 32) & 1;
+    }
+    return borrow;
+}
+
+// r = a where %mask% is all ones, b where it is zero
+static void select8(uint32_t *r, const uint32_t *a, const uint32_t *b,
+  uint32_t mask) {
+    for (int i = 0; i < 8; i++) { r[i] = (a[i] & mask) | (b[i] & ~mask); }
+}
+
+static bool isZero8(const uint32_t *a) {
+    uint32_t bits = 0;
+    for (int i = 0; i < 8; i++) { bits |= a[i]; }
+    return (bits == 0);
+}
+
+static void mul8(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    memset(r, 0, 16 * sizeof(uint32_t));
+    for (int i = 0; i < 8; i++) {
+        uint64_t acc = 0;
+        for (int j = 0; j < 8; j++) {
+            acc += (uint64_t)a[i] * b[j] + r[i + j];
+            r[i + j] = acc;
+            acc >>= 32;
+        }
+        r[i + 8] = acc;
+    }
+}
+
+// Subtracts %m% from %a% (< 2m) if a >= m; returns 1 if it did
+static uint32_t reduceOnce(uint32_t *a, const uint32_t *m) {
+    uint32_t d[8];
+    uint32_t borrow = sub8(d, a, m);
+    select8(a, a, d, -borrow);
+    return borrow ^ 1;
+}
+
+// r = a^exponent, for a public %exponent%
+static void power(uint32_t *r, const uint32_t *a, const uint32_t *exponent,
+  MulFunc mul) {
+
+    uint32_t result[8] = { 1 };
+    for (int i = 255; i >= 0; i--) {
+        mul(result, result, result);
+        if ((exponent[i / 32] >> (i % 32)) & 1) { mul(result, result, a); }
+    }
+    memcpy(r, result, sizeof(result));
+}
+
+
+/////////////////////////////
+// Field arithmetic (mod p)
+
+// Since 2^256 = 0x1000003d1 (mod p), the high half of %t% is folded
+// into the low half as high * 0x1000003d1 (twice, then once more for
+// the carry), which leaves less than 2p
+static void fieldReduce(uint32_t *r, const uint32_t *t) {
+    uint32_t w[8];
+
+    uint64_t acc = 0;
+    for (int i = 0; i < 8; i++) {
+        acc += (uint64_t)t[i] + (uint64_t)t[8 + i] * 0x3d1;
+        if (i) { acc += t[7 + i]; }
+        w[i] = acc;
+        acc >>= 32;
+    }
+    uint64_t top = acc + t[15];
+
+    uint64_t low = top * 0x3d1;
+    acc = (uint64_t)w[0] + (uint32_t)low;
+    w[0] = acc;
+    acc = (acc >> 32) + w[1] + (low >> 32) + (uint32_t)top;
+    w[1] = acc;
+    acc = (acc >> 32) + w[2] + (top >> 32);
+    w[2] = acc;
+    acc >>= 32;
+    for (int i = 3; i < 8; i++) {
+        acc += w[i];
+        w[i] = acc;
+        acc >>= 32;
+    }
+
+    // A carry here leaves w small, so this cannot carry again
+    uint32_t carry = acc;
+    acc = (uint64_t)w[0] + (0x3d1 & -carry);
+    w[0] = acc;
+    acc = (acc >> 32) + w[1] + carry;
+    w[1] = acc;
+    acc >>= 32;
+    for (int i = 2; i < 8; i++) {
+        acc += w[i];
+        w[i] = acc;
+        acc >>= 32;
+    }
+
+    reduceOnce(w, P);
+    memcpy(r, w, sizeof(w));
+}
+
+static void fieldMul(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    uint32_t t[16];
+    mul8(t, a, b);
+    fieldReduce(r, t);
+}
+
+static void fieldAdd(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    uint32_t t[8], d[8];
+    uint32_t carry = add8(t, a, b);
+    uint32_t borrow = sub8(d, t, P);
+    select8(r, d, t, -(carry | (borrow ^ 1)));
+}
+
+static void fieldSub(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    uint32_t t[8], m[8];
+    uint32_t borrow = sub8(t, a, b);
+    for (int i = 0; i < 8; i++) { m[i] = P[i] & -borrow; }
+    add8(r, t, m);
+}
+
+static void fieldInvert(uint32_t *r, const uint32_t *a) {
+    power(r, a, P_MINUS_2, fieldMul);
+}
+
+
+/////////////////////////////
+// Scalar arithmetic (mod n)
+
+// Replaces the words of %x% above 256 bits (h) with h * (2^256 - n); each
+// fold shrinks x by about 127 bits, until it is just over 256
+static void scalarFold(uint32_t *x, int length) {
+    uint32_t high[8];
+    int highLength = length - 8;
+    memcpy(high, &x[8], highLength * sizeof(uint32_t));
+    memset(&x[8], 0, highLength * sizeof(uint32_t));
+
+    for (int i = 0; i < highLength; i++) {
+        uint64_t acc = 0;
+        for (int j = 0; j < N_COMPLEMENT_WORDS; j++) {
+            acc += (uint64_t)high[i] * N_COMPLEMENT[j] + x[i + j];
+            x[i + j] = acc;
+            acc >>= 32;
+        }
+        for (int k = i + N_COMPLEMENT_WORDS; k < length; k++) {
+            acc += x[k];
+            x[k] = acc;
+            acc >>= 32;
+        }
+    }
+}
+
+static void scalarMul(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    uint32_t t[16];
+    mul8(t, a, b);
+
+    // 512 bits => 386 => 260 => 257 => 257 (a carry) => under 2^256
+    scalarFold(t, 16);
+    scalarFold(t, 13);
+    scalarFold(t, 9);
+    scalarFold(t, 9);
+    scalarFold(t, 9);
+
+    reduceOnce(t, N);
+    memcpy(r, t, 8 * sizeof(uint32_t));
+}
+
+static void scalarAdd(uint32_t *r, const uint32_t *a, const uint32_t *b) {
+    uint32_t t[8], d[8];
+    uint32_t carry = add8(t, a, b);
+    uint32_t borrow = sub8(d, t, N);
+    select8(r, d, t, -(carry | (borrow ^ 1)));
+}
+
+static void scalarInvert(uint32_t *r, const uint32_t *a) {
+    power(r, a, N_MINUS_2, scalarMul);
+}
+
+// Whether %k% is in [1, n)
+static bool isScalar(const uint32_t *k) {
+    uint32_t d[8];
+    return (!isZero8(k) && sub8(d, k, N));
+}
+
+
+/////////////////////////////
+// Point arithmetic
+
+// A point is at infinity when its z is 0
+
+// r = 2a (a == r is allowed). Uses 3 multiplications and 4 squarings.
+static void pointDouble(Jacobian *r, const Jacobian *a) {
+    uint32_t xx[8], yy[8], yyyy[8], d[8], e[8], t[8];
+
+    fieldMul(xx, a->x, a->x);
+    fieldMul(yy, a->y, a->y);
+    fieldMul(yyyy, yy, yy);
+
+    // d = 2 * ((x1 + yy)^2 - xx - yyyy)
+    fieldAdd(d, a->x, yy);
+    fieldMul(d, d, d);
+    fieldSub(d, d, xx);
+    fieldSub(d, d, yyyy);
+    fieldAdd(d, d, d);
+
+    // e = 3 * xx
+    fieldAdd(e, xx, xx);
+    fieldAdd(e, e, xx);
+
+    // z3 = 2 * y1 * z1; before y1 is replaced
+    fieldMul(t, a->y, a->z);
+    fieldAdd(r->z, t, t);
+
+    // x3 = e^2 - 2d
+    fieldMul(t, e, e);
+    fieldSub(t, t, d);
+    fieldSub(r->x, t, d);
+
+    // y3 = e * (d - x3) - 8 * yyyy
+    fieldSub(d, d, r->x);
+    fieldMul(r->y, e, d);
+    fieldAdd(yyyy, yyyy, yyyy);
+    fieldAdd(yyyy, yyyy, yyyy);
+    fieldAdd(yyyy, yyyy, yyyy);
+    fieldSub(r->y, r->y, yyyy);
+}
+
+// r = a + b (a == r is allowed). Uses 8 multiplications and 3 squarings.
+//
+// With the per-row table offsets, a (a partial sum) is never at infinity
+// or +/-b for a valid scalar, but the special cases are still handled so
+// a bad table or input gives infinity (which callers reject) rather than
+// a wrong point. They branch, but are never reached with a valid scalar.
+static void addMixed(Jacobian *r, const Jacobian *a, const Secp256k1Affine *b) {
+    uint32_t z1z1[8], u2[8], s2[8], h[8], rr[8], hh[8], hhh[8], v[8];
+    uint32_t t[8];
+
+    if (isZero8(a->z)) {
+        memcpy(r->x, b->x, sizeof(r->x));
+        memcpy(r->y, b->y, sizeof(r->y));
+        memset(r->z, 0, sizeof(r->z));
+        r->z[0] = 1;
+        return;
+    }
+
+    fieldMul(z1z1, a->z, a->z);
+    fieldMul(u2, b->x, z1z1);
+    fieldMul(s2, a->z, z1z1);
+    fieldMul(s2, s2, b->y);
+    fieldSub(h, u2, a->x);
+    fieldSub(rr, s2, a->y);
+
+    // Same x; a is b (double) or -b (infinity)
+    if (isZero8(h)) {
+        if (isZero8(rr)) {
+            pointDouble(r, a);
+        } else {
+            memset(r, 0, sizeof(Jacobian));
+        }
+        return;
+    }
+
+    fieldMul(hh, h, h);
+    fieldMul(hhh, h, hh);
+    fieldMul(v, a->x, hh);
+
+    // z3 = z1 * h
+    fieldMul(r->z, a->z, h);
+
+    // y3 = rr * (v - x3) - y1 * hhh; y1 is used before x3 replaces x1
+    fieldMul(t, a->y, hhh);
+
+    // x3 = rr^2 - hhh - 2v
+    fieldMul(r->x, rr, rr);
+    fieldSub(r->x, r->x, hhh);
+    fieldSub(r->x, r->x, v);
+    fieldSub(r->x, r->x, v);
+
+    fieldSub(v, v, r->x);
+    fieldMul(r->y, rr, v);
+    fieldSub(r->y, r->y, t);
+}
+
+// Reads every entry of %row%, so the access pattern does not depend on
+// the (secret) %digit%
+static void lookup(Secp256k1Affine *r, const Secp256k1Affine *row,
+  uint32_t digit) {
+
+    memset(r, 0, sizeof(Secp256k1Affine));
+    for (uint32_t j = 0; j < SECP256K1_ENTRIES; j++) {
+        uint32_t mask = -(((j ^ digit) - 1) >> 31);
+        for (int i = 0; i < 8; i++) {
+            r->x[i] |= row[j].x[i] & mask;
+            r->y[i] |= row[j].y[i] & mask;
+        }
+    }
+}
+
+// r = k * G; one lookup and addition per digit, without doublings. Returns
+// false if the result is at infinity, which for k in [1, n) means the
+// table is corrupt
+static bool mulBase(Secp256k1Affine *r, const uint32_t *k) {
+    const int perWord = 32 / SECP256K1_WINDOW;
+    const uint32_t digitMask = SECP256K1_ENTRIES - 1;
+
+    Secp256k1Affine entry;
+    Jacobian acc;
+
+    lookup(&entry, secp256k1Table[0], k[0] & digitMask);
+    memcpy(acc.x, entry.x, sizeof(acc.x));
+    memcpy(acc.y, entry.y, sizeof(acc.y));
+    memset(acc.z, 0, sizeof(acc.z));
+    acc.z[0] = 1;
+
+    for (int row = 1; row < SECP256K1_ROWS; row++) {
+        uint32_t digit = (k[row / perWord] >> ((row % perWord) *
+          SECP256K1_WINDOW)) & digitMask;
+        lookup(&entry, secp256k1Table[row], digit);
+        addMixed(&acc, &acc, &entry);
+    }
+
+    addMixed(&acc, &acc, &secp256k1Offset);
+
+    bool valid = !isZero8(acc.z);
+
+    uint32_t zi[8], zi2[8];
+    fieldInvert(zi, acc.z);
+    fieldMul(zi2, zi, zi);
+    fieldMul(r->x, acc.x, zi2);
+    fieldMul(zi2, zi2, zi);
+    fieldMul(r->y, acc.y, zi2);
+
+    wipe(&acc, sizeof(acc));
+    wipe(&entry, sizeof(entry));
+
+    return valid;
+}
+
+
+/////////////////////////////
+// Nonce (RFC 6979, HMAC-SHA256)
+
+typedef struct Nonce {
+    uint8_t k[32];
+    uint8_t v[32];
+    bool used;
+} Nonce;
+
+// K = HMAC_K(V || %separator% || %privkey% || %digest%); V = HMAC_K(V)
+static void nonceUpdate(Nonce *nonce, int separator, const uint8_t *privkey,
+  const uint8_t *digest) {
+
+    Hmac hmac;
+    hmacInit(&hmac, nonce->k, 32);
+    hmacUpdate(&hmac, nonce->v, 32);
+    if (separator >= 0) {
+        uint8_t byte = separator;
+        hmacUpdate(&hmac, &byte, 1);
+    }
+    if (privkey) { hmacUpdate(&hmac, privkey, 32); }
+    if (digest) { hmacUpdate(&hmac, digest, 32); }
+    hmacFinal(&hmac, nonce->k);
+
+    hmacInit(&hmac, nonce->k, 32);
+    hmacUpdate(&hmac, nonce->v, 32);
+    hmacFinal(&hmac, nonce->v);
+}
+
+// The %digest% must already be reduced mod n
+static void nonceInit(Nonce *nonce, const uint8_t *privkey,
+  const uint8_t *digest) {
+
+    memset(nonce->v, 0x01, 32);
+    memset(nonce->k, 0x00, 32);
+    nonce->used = false;
+
+    nonceUpdate(nonce, 0x00, privkey, digest);
+    nonceUpdate(nonce, 0x01, privkey, digest);
+}
+
+static void nonceNext(Nonce *nonce, uint32_t *k) {
+    while (true) {
+        if (nonce->used) { nonceUpdate(nonce, 0x00, NULL, NULL); }
+        nonce->used = true;
+
+        Hmac hmac;
+        hmacInit(&hmac, nonce->k, 32);
+        hmacUpdate(&hmac, nonce->v, 32);
+        hmacFinal(&hmac, nonce->v);
+
+        fromBytes(k, nonce->v);
+        if (isScalar(k)) { return; }
+    }
+}
+
+
+/////////////////////////////
+// API
+
+bool secp256k1ComputePubkey(uint8_t *pubkey, const uint8_t *privkey) {
+    uint32_t d[8];
+    fromBytes(d, privkey);
+    if (!isScalar(d)) {
+        wipe(d, sizeof(d));
+        return false;
+    }
+
+    Secp256k1Affine point;
+    bool valid = mulBase(&point, d);
+    wipe(d, sizeof(d));
+
+    if (!valid) {
+        printf("[secp256k1] pubkey at infinity\n");
+        memset(pubkey, 0, SECP256K1_PUBKEY_LENGTH);
+        return false;
+    }
+
+    pubkey[0] = 0x04;
+    toBytes(&pubkey[1], point.x);
+    toBytes(&pubkey[33], point.y);
+
+    return true;
+}
+
+bool secp256k1Sign(uint8_t *signature, const uint8_t *privkey,
+  const uint8_t *digest) {
+
+    uint32_t d[8];
+    fromBytes(d, privkey);
+    if (!isScalar(d)) {
+        wipe(d, sizeof(d));
+        return false;
+    }
+
+    uint32_t z[8];
+    fromBytes(z, digest);
+    reduceOnce(z, N);
+
+    uint8_t reduced[32];
+    toBytes(reduced, z);
+
+    Nonce nonce;
+    nonceInit(&nonce, privkey, reduced);
+
+    uint32_t k[8], r[8], s[8];
+    Secp256k1Affine point;
+    uint8_t recid;
+
+    while (true) {
+        nonceNext(&nonce, k);
+
+        // Never for a valid nonce; trying another would not be RFC 6979
+        if (!mulBase(&point, k)) {
+            printf("[secp256k1] nonce point at infinity\n");
+            wipe(d, sizeof(d));
+            wipe(k, sizeof(k));
+            wipe(&nonce, sizeof(nonce));
+            wipe(&point, sizeof(point));
+            memset(signature, 0, SECP256K1_SIGNATURE_LENGTH);
+            return false;
+        }
+
+        memcpy(r, point.x, sizeof(r));
+        uint32_t overflow = reduceOnce(r, N);
+        if (isZero8(r)) { continue; }
+
+        // s = (z + r * d) / k
+        scalarMul(s, r, d);
+        scalarAdd(s, s, z);
+        scalarInvert(k, k);
+        scalarMul(s, s, k);
+        if (isZero8(s)) { continue; }
+
+        recid = (point.y[0] & 1) | (overflow << 1);
+        break;
+    }
+
+    // Use the low s (the other is its negation), which flips R
+    uint32_t t[8];
+    if (sub8(t, N_HALF, s)) {
+        sub8(s, N, s);
+        recid ^= 1;
+    }
+
+    toBytes(&signature[0], r);
+    toBytes(&signature[32], s);
+    signature[64] = recid;
+
+    wipe(d, sizeof(d));
+    wipe(k, sizeof(k));
+    wipe(&nonce, sizeof(nonce));
+    wipe(&point, sizeof(point));
+
+    return true;
+}
+
+
+/////////////////////////////
+// Benchmark
+
+static uint32_t getMicros() {
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
+static uint32_t getRate(uint32_t count, uint32_t duration) {
+    if (duration == 0) { return 0; }
+    return (uint64_t)count * 1000000 / duration;
+}
+
+#ifdef ESP_PLATFORM
+
+_Static_assert(sizeof(FfxEcPubkey) == SECP256K1_PUBKEY_LENGTH,
+  "pubkey length mismatch");
+_Static_assert(sizeof(FfxEcSignature) == SECP256K1_SIGNATURE_LENGTH,
+  "signature length mismatch");
+
+// Returns the number of results which differ from ffx_ec_*; the
+// recovery id is only compared by parity, in case it is offset by 27
+static uint32_t checkReference(const uint8_t *privkey, const uint8_t *digest,
+  const uint8_t *pubkey, const uint8_t *signature) {
+
+    uint32_t mismatches = 0;
+
+    FfxEcPrivkey key;
+    memcpy(key.data, privkey, sizeof(key.data));
+
+    FfxEcPubkey expectedPubkey;
+    ffx_ec_computePubkey(&expectedPubkey, &key);
+    if (memcmp(expectedPubkey.data, pubkey, SECP256K1_PUBKEY_LENGTH)) {
+        mismatches++;
+    }
+
+    FfxEcDigest hash;
+    memcpy(hash.data, digest, sizeof(hash.data));
+
+    FfxEcSignature expected;
+    ffx_ec_signDigest(&expected, &key, &hash);
+    if (memcmp(expected.data, signature, 64) ||
+      ((expected.data[64] ^ signature[64]) & 1)) {
+        mismatches++;
+    }
+
+    wipe(&key, sizeof(key));
+
+    return mismatches;
+}
+
+#else
+
+// Returns the number of results which differ from a known vector (there
+// is no reference implementation to compare against off the device)
+static uint32_t checkVector() {
+    uint32_t mismatches = 0;
+
+    uint8_t privkey[SECP256K1_PRIVKEY_LENGTH] = { 0 };
+    privkey[31] = 1;
+
+    // The public key of 1 is the generator
+    uint8_t pubkey[SECP256K1_PUBKEY_LENGTH];
+    secp256k1ComputePubkey(pubkey, privkey);
+    if (pubkey[1] != 0x79 || pubkey[32] != 0x98 || pubkey[33] != 0x48 ||
+      pubkey[64] != 0xb8) {
+        mismatches++;
+    }
+
+    const char *message = BENCHMARK_VECTOR_MESSAGE;
+    uint8_t digest[SECP256K1_DIGEST_LENGTH];
+    sha256(digest, (const uint8_t*)message, strlen(message));
+
+    uint8_t signature[SECP256K1_SIGNATURE_LENGTH];
+    secp256k1Sign(signature, privkey, digest);
+    if (memcmp(signature, vectorSignature, sizeof(vectorSignature))) {
+        mismatches++;
+    }
+
+    return mismatches;
+}
+
+#endif
+
+bool secp256k1Benchmark(uint32_t count) {
+    uint8_t privkey[SECP256K1_PRIVKEY_LENGTH];
+    uint8_t digest[SECP256K1_DIGEST_LENGTH];
+    uint8_t pubkey[SECP256K1_PUBKEY_LENGTH];
+    uint8_t signature[SECP256K1_SIGNATURE_LENGTH];
+
+    uint32_t pubkeyTime = 0, signTime = 0, mismatches = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        // Keys and digests are hashes of the index
+        sha256(privkey, (const uint8_t*)&i, sizeof(i));
+        sha256(digest, privkey, sizeof(privkey));
+
+        uint32_t t0 = getMicros();
+        secp256k1ComputePubkey(pubkey, privkey);
+        uint32_t t1 = getMicros();
+        secp256k1Sign(signature, privkey, digest);
+        uint32_t t2 = getMicros();
+
+        pubkeyTime += t1 - t0;
+        signTime += t2 - t1;
+
+#ifdef ESP_PLATFORM
+        mismatches += checkReference(privkey, digest, pubkey, signature);
+#endif
+    }
+
+#ifndef ESP_PLATFORM
+    mismatches += checkVector();
+#endif
+
+    printf("[secp256k1] benchmark: window=%d table=%d bytes count=%ld " \
+      "pubkey=%ld/s sign=%ld/s mismatches=%ld\n", SECP256K1_WINDOW,
+      (int)sizeof(secp256k1Table), count, getRate(count, pubkeyTime),
+      getRate(count, signTime), mismatches);
+
+    return (mismatches == 0);
+}
@@ -0,0 +1,65 @@
+#ifndef __SECP256K1_H__
+#define __SECP256K1_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// Bits of the scalar handled per table lookup (2, 4 or 8); set by the
+// build, which generates the matching table (see tools/secp256k1-table.py)
+#ifndef SECP256K1_WINDOW
+#define SECP256K1_WINDOW         (4)
+#endif
+
+#define SECP256K1_ROWS           (256 / SECP256K1_WINDOW)
+#define SECP256K1_ENTRIES        (1 << SECP256K1_WINDOW)
+
+#define SECP256K1_PRIVKEY_LENGTH     (32)
+#define SECP256K1_DIGEST_LENGTH      (32)
+
+// Uncompressed; 0x04, x, y
+#define SECP256K1_PUBKEY_LENGTH      (65)
+
+// r, s and the recovery id (0 or 1)
+#define SECP256K1_SIGNATURE_LENGTH   (65)
+
+
+// A point, as little-endian 32-bit words
+typedef struct Secp256k1Affine {
+    uint32_t x[8];
+    uint32_t y[8];
+} Secp256k1Affine;
+
+// Precomputed multiples of the generator, in flash (generated)
+extern const Secp256k1Affine secp256k1Table[SECP256K1_ROWS][SECP256K1_ENTRIES];
+extern const Secp256k1Affine secp256k1Offset;
+
+
+// Compute the public key for %privkey%; false if it is not a valid key
+// (or the result is at infinity, which means the table is corrupt)
+bool secp256k1ComputePubkey(uint8_t *pubkey, const uint8_t *privkey);
+
+// Sign %digest% with %privkey%, using a deterministic nonce (RFC 6979)
+// and a low s (EIP-2); false if %privkey% is not a valid key (or the
+// nonce point is at infinity, which means the table is corrupt).
+//
+// The multiplication by the generator is constant-time, using a table
+// lookup per digit which reads every entry of the row.
+bool secp256k1Sign(uint8_t *signature, const uint8_t *privkey,
+  const uint8_t *digest);
+
+// Log the rate of public key derivations and signatures over %count%
+// keys, and the number which do not match the reference (ffx_ec_* on
+// the device, a known vector elsewhere); false if any do not
+bool secp256k1Benchmark(uint32_t count);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __SECP256K1_H__ */
@@ -0,0 +1,203 @@
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "transport-socket.h"
+
+
+// Longest method name accepted
+#define MAX_METHOD_LENGTH    (31)
+
+
+static void writeUint32(uint8_t *data, uint32_t value) {
+    data[0] = value >> 24;
+    data[1] = value >> 16;
+    data[2] = value >> 8;
+    data[3] = value;
+}
+
+static uint32_t readUint32(const uint8_t *data) {
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) |
+      ((uint32_t)data[2] << 8) | data[3];
+}
+
+static bool readAll(int fd, uint8_t *data, size_t length) {
+    while (length) {
+        ssize_t count = read(fd, data, length);
+        if (count <= 0) {
+            if (count < 0 && errno == EINTR) { continue; }
+            return false;
+        }
+        data += count;
+        length -= count;
+    }
+    return true;
+}
+
+static bool writeAll(int fd, const uint8_t *data, size_t length) {
+    while (length) {
+        ssize_t count = write(fd, data, length);
+        if (count < 0) {
+            if (errno == EINTR) { continue; }
+            return false;
+        }
+        data += count;
+        length -= count;
+    }
+    return true;
+}
+
+static void disconnect(SocketTransport *transport) {
+    if (transport->client < 0) { return; }
+    close(transport->client);
+    transport->client = -1;
+}
+
+static void sendFrame(SocketTransport *transport, uint32_t id,
+  uint32_t error, const uint8_t *data, size_t length) {
+
+    if (transport->client < 0) { return; }
+
+    uint8_t header[12];
+    writeUint32(&header[0], 8 + length);
+    writeUint32(&header[4], id);
+    writeUint32(&header[8], error);
+
+    if (!writeAll(transport->client, header, sizeof(header)) ||
+      !writeAll(transport->client, data, length)) {
+        disconnect(transport);
+    }
+}
+
+static void sendReply(void *context, uint32_t id, FfxCborBuilder *reply) {
+    sendFrame(context, id, 0, reply->data, ffx_cbor_getBuildLength(reply));
+}
+
+static void sendError(void *context, uint32_t id, uint32_t code,
+  const char *message) {
+    sendFrame(context, id, code, (const uint8_t*)message, strlen(message));
+}
+
+// [ id, method, params ]
+static bool dispatch(SocketTransport *transport, Requests *requests,
+  size_t length) {
+
+    FfxCborCursor message = ffx_cbor_walk(transport->buffer, length);
+
+    FfxCborCursor item = message;
+    uint64_t id = 0;
+    if (ffx_cbor_followIndex(&item, 0) || ffx_cbor_getValue(item, &id)) {
+        return false;
+    }
+
+    item = message;
+    const uint8_t *data = NULL;
+    size_t nameLength = 0;
+    if (ffx_cbor_followIndex(&item, 1) ||
+      ffx_cbor_getData(item, &data, &nameLength) ||
+      nameLength > MAX_METHOD_LENGTH) {
+        return false;
+    }
+
+    char method[MAX_METHOD_LENGTH + 1];
+    memcpy(method, data, nameLength);
+    method[nameLength] = 0;
+
+    FfxCborCursor params = message;
+    if (ffx_cbor_followIndex(&params, 2)) { return false; }
+
+    requestsHandleMessage(requests, id, method, params);
+
+    if (transport->autoAnswer && !requests->busy) {
+        Request request;
+        while (requestsNext(requests, &request)) {
+            requestsAnswer(requests, &request, transport->answer);
+        }
+    }
+
+    requestsRelease(requests);
+
+    return true;
+}
+
+bool socketTransportOpen(SocketTransport *transport, const char *path) {
+    memset(transport, 0, sizeof(SocketTransport));
+    transport->transport.name = "socket";
+    transport->transport.sendReply = sendReply;
+    transport->transport.sendError = sendError;
+    transport->transport.context = transport;
+    transport->client = -1;
+
+    struct sockaddr_un addr = { 0 };
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) { return false; }
+    strcpy(addr.sun_path, path);
+
+    transport->server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (transport->server < 0) { return false; }
+
+    unlink(path);
+    if (bind(transport->server, (struct sockaddr*)&addr, sizeof(addr)) ||
+      listen(transport->server, 1)) {
+        printf("[socket] failed to listen: path=%s error=%s\n", path,
+          strerror(errno));
+        close(transport->server);
+        transport->server = -1;
+        return false;
+    }
+
+    printf("[socket] listening: path=%s\n", path);
+
+    return true;
+}
+
+bool socketTransportPoll(SocketTransport *transport, Requests *requests,
+  uint32_t timeout) {
+
+    if (transport->server < 0) { return false; }
+
+    // One client at a time; a new one is accepted once it leaves
+    int fd = (transport->client < 0) ? transport->server: transport->client;
+
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    int ready = poll(&pfd, 1, timeout);
+    if (ready < 0) { return (errno == EINTR); }
+    if (ready == 0) { return true; }
+
+    if (transport->client < 0) {
+        transport->client = accept(transport->server, NULL, NULL);
+        return (transport->client >= 0);
+    }
+
+    uint8_t header[4];
+    if (!readAll(transport->client, header, sizeof(header))) {
+        disconnect(transport);
+        return true;
+    }
+
+    size_t length = readUint32(header);
+    if (length > SOCKET_MESSAGE_MAX ||
+      !readAll(transport->client, transport->buffer, length)) {
+        printf("[socket] bad frame: length=%zu\n", length);
+        disconnect(transport);
+        return true;
+    }
+
+    if (!dispatch(transport, requests, length)) {
+        printf("[socket] bad message\n");
+    }
+
+    return true;
+}
+
+void socketTransportClose(SocketTransport *transport) {
+    disconnect(transport);
+    if (transport->server >= 0) {
+        close(transport->server);
+        transport->server = -1;
+    }
+}
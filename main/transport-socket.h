@@ -0,0 +1,57 @@
+#ifndef __TRANSPORT_SOCKET_H__
+#define __TRANSPORT_SOCKET_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+// A loopback over a Unix socket, so a host build can be driven (e.g. by
+// tools/loadgen.py) without a phone or radio; host builds only (see
+// host/pixie-dispatch.c).
+//
+// Each frame is a big-endian uint32 length, then:
+//   - to the device: CBOR [ id, method, params ]
+//   - from the device: big-endian uint32 id and error (0 for none), then
+//     the CBOR result or the error message
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "requests.h"
+
+
+// Larger params must use an upload (see requestsHandleMessage)
+#define SOCKET_MESSAGE_MAX       (4 * 1024)
+
+
+typedef struct SocketTransport {
+    Transport transport;
+
+    int server;
+    int client;
+
+    // Answer requests which need the user with %answer% (PANEL_TX_*),
+    // instead of leaving them queued for the panels
+    bool autoAnswer;
+    uint32_t answer;
+
+    uint8_t buffer[SOCKET_MESSAGE_MAX];
+} SocketTransport;
+
+
+// Listen on %path% (replacing any stale socket); false on error
+bool socketTransportOpen(SocketTransport *transport, const char *path);
+
+// Wait up to %timeout% ms for a message and pass it to %requests%, which
+// must be using this transport; false once the socket fails
+bool socketTransportPoll(SocketTransport *transport, Requests *requests,
+  uint32_t timeout);
+
+void socketTransportClose(SocketTransport *transport);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __TRANSPORT_SOCKET_H__ */
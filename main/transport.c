@@ -0,0 +1,20 @@
+#include "firefly-hollows.h"
+
+#include "transport.h"
+
+
+static void sendReply(void *context, uint32_t id, FfxCborBuilder *reply) {
+    ffx_sendReply(id, reply);
+}
+
+static void sendError(void *context, uint32_t id, uint32_t code,
+  const char *message) {
+    ffx_sendErrorReply(id, code, message);
+}
+
+const Transport transportRadio = {
+    .name = "radio",
+    .sendReply = sendReply,
+    .sendError = sendError,
+    .context = NULL,
+};
@@ -0,0 +1,34 @@
+#ifndef __TRANSPORT_H__
+#define __TRANSPORT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+
+#include "firefly-cbor.h"
+
+
+// Where the replies to requests go; messages come in by calling
+// requestsHandleMessage, so a transport only needs to send
+typedef struct Transport {
+    const char *name;
+
+    void (*sendReply)(void *context, uint32_t id, FfxCborBuilder *reply);
+    void (*sendError)(void *context, uint32_t id, uint32_t code,
+      const char *message);
+
+    void *context;
+} Transport;
+
+
+// The radio link (via firefly-hollows)
+extern const Transport transportRadio;
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __TRANSPORT_H__ */
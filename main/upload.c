@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "upload.h"
+
+
+_Static_assert(UPLOAD_WINDOW <= 32, "window does not fit the ack bits");
+
+
+void uploadInit(Upload *upload) {
+    memset(upload, 0, sizeof(Upload));
+}
+
+bool uploadIsActive(Upload *upload) {
+    return (upload->id != 0);
+}
+
+UploadStatus uploadBegin(Upload *upload, Arena *arena, const char *method,
+  size_t length, size_t mtu, uint32_t now) {
+
+    uploadExpire(upload, now);
+    if (uploadIsActive(upload)) { return UploadStatusBusy; }
+
+    if (length == 0 || strlen(method) > UPLOAD_METHOD_LENGTH) {
+        return UploadStatusInvalid;
+    }
+
+    size_t chunkSize = 0;
+    if (mtu > UPLOAD_OVERHEAD) { chunkSize = mtu - UPLOAD_OVERHEAD; }
+    if (chunkSize < UPLOAD_CHUNK_MIN) { chunkSize = UPLOAD_CHUNK_MIN; }
+    if (chunkSize > UPLOAD_CHUNK_MAX) { chunkSize = UPLOAD_CHUNK_MAX; }
+
+    size_t chunkCount = (length + chunkSize - 1) / chunkSize;
+    if (chunkCount > UINT16_MAX) { return UploadStatusTooLarge; }
+
+    uint8_t *data = arenaAlloc(arena, length);
+    if (data == NULL) { return UploadStatusTooLarge; }
+
+    upload->id = ++upload->lastId;
+    if (upload->id == 0) { upload->id = ++upload->lastId; }
+
+    strcpy(upload->method, method);
+    upload->data = data;
+    upload->length = length;
+    upload->chunkSize = chunkSize;
+    upload->chunkCount = chunkCount;
+    upload->next = 0;
+    upload->received = 0;
+    upload->lastTicks = now;
+
+    return UploadStatusOk;
+}
+
+UploadStatus uploadChunk(Upload *upload, uint32_t id, uint32_t seq,
+  const uint8_t *data, size_t length, uint32_t now) {
+
+    if (!uploadIsActive(upload) || id != upload->id) {
+        return UploadStatusUnknown;
+    }
+
+    if (seq >= upload->chunkCount) { return UploadStatusInvalid; }
+
+    // The last chunk holds the remainder
+    size_t offset = seq * upload->chunkSize;
+    size_t expected = upload->length - offset;
+    if (expected > upload->chunkSize) { expected = upload->chunkSize; }
+    if (length != expected) { return UploadStatusInvalid; }
+
+    upload->lastTicks = now;
+
+    // A resend of a chunk already received, or beyond the window
+    if (seq < upload->next || seq >= upload->next + UPLOAD_WINDOW) {
+        return UploadStatusOk;
+    }
+
+    memcpy(&upload->data[offset], data, length);
+    upload->received |= ((uint32_t)1 << (seq - upload->next));
+
+    while (upload->received & 1) {
+        upload->received >>= 1;
+        upload->next++;
+    }
+
+    if (upload->next == upload->chunkCount) { return UploadStatusComplete; }
+
+    return UploadStatusOk;
+}
+
+void uploadFinish(Upload *upload) {
+    upload->id = 0;
+    upload->data = NULL;
+    upload->length = 0;
+    upload->chunkCount = 0;
+    upload->next = 0;
+    upload->received = 0;
+}
+
+bool uploadExpire(Upload *upload, uint32_t now) {
+    if (!uploadIsActive(upload)) { return false; }
+    if (now - upload->lastTicks < UPLOAD_TIMEOUT) { return false; }
+
+    printf("[upload] abandoned: id=%ld next=%d/%d\n", upload->id,
+      upload->next, upload->chunkCount);
+    uploadFinish(upload);
+
+    return true;
+}
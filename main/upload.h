@@ -0,0 +1,106 @@
+#ifndef __UPLOAD_H__
+#define __UPLOAD_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+
+// Chunks which may be sent beyond the first missing one without waiting
+// for an ack; must fit in the bits of Upload.received
+#define UPLOAD_WINDOW            (8)
+
+// Bytes of each message which are not payload (the ATT header and the
+// message envelope around a chunk)
+#define UPLOAD_OVERHEAD          (32)
+
+#define UPLOAD_CHUNK_MIN         (16)
+#define UPLOAD_CHUNK_MAX         (480)
+
+// Idle time (ms) after which an unfinished upload may be replaced; until
+// then a client may resume it (e.g. after reconnecting)
+#define UPLOAD_TIMEOUT           (30000)
+
+// Longest name of the method the payload is for
+#define UPLOAD_METHOD_LENGTH     (31)
+
+
+typedef enum UploadStatus {
+    UploadStatusOk = 0,
+
+    // The last missing chunk arrived; the payload is ready
+    UploadStatusComplete,
+
+    // Another upload is in progress
+    UploadStatusBusy,
+
+    // The payload does not fit in the arena
+    UploadStatusTooLarge,
+
+    UploadStatusInvalid,
+
+    // Not the current upload (e.g. it timed out and was replaced)
+    UploadStatusUnknown,
+} UploadStatus;
+
+// A payload sent in numbered chunks, which may arrive in any order within
+// the window; it is written in place, so only the payload is stored
+typedef struct Upload {
+    // 0 if no upload is in progress
+    uint32_t id;
+    uint32_t lastId;
+
+    char method[UPLOAD_METHOD_LENGTH + 1];
+
+    // In the arena
+    uint8_t *data;
+    size_t length;
+
+    uint16_t chunkSize;
+    uint16_t chunkCount;
+
+    // The first missing chunk (everything before has arrived)
+    uint16_t next;
+
+    // Chunks after next which have arrived; bit i is chunk next + i
+    uint32_t received;
+
+    uint32_t lastTicks;
+} Upload;
+
+
+void uploadInit(Upload *upload);
+
+bool uploadIsActive(Upload *upload);
+
+// Start receiving %length% bytes for %method%, in chunks sized for the
+// link %mtu%; the payload is allocated from %arena%, which must not be
+// reset until the upload is finished.
+UploadStatus uploadBegin(Upload *upload, Arena *arena, const char *method,
+  size_t length, size_t mtu, uint32_t now);
+
+// Store chunk %seq% of upload %id%. Chunks already received or beyond
+// the window are ignored (the ack tells the sender what to resend).
+UploadStatus uploadChunk(Upload *upload, uint32_t id, uint32_t seq,
+  const uint8_t *data, size_t length, uint32_t now);
+
+// Forget the upload (once complete or abandoned); the payload remains in
+// the arena until it is reset
+void uploadFinish(Upload *upload);
+
+// Finish the upload if it has been idle for UPLOAD_TIMEOUT, so its arena
+// can be reset; returns true if it was abandoned
+bool uploadExpire(Upload *upload, uint32_t now);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __UPLOAD_H__ */
@@ -0,0 +1,321 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "video.h"
+
+
+static uint16_t readU16(const uint8_t *data) {
+    return data[0] | (data[1] << 8);
+}
+
+static uint32_t readU32(const uint8_t *data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
+}
+
+static size_t getEntryCount(uint16_t frameCount, uint8_t flags) {
+    return frameCount + ((flags & VIDEO_FLAG_LOOP) ? 1: 0);
+}
+
+static const uint8_t* readMemory(void *arg, uint32_t offset, size_t length) {
+    Video *video = arg;
+    if (offset + length > video->length) { return NULL; }
+    return &video->data[offset];
+}
+
+static const uint8_t* getEntry(Video *video, uint32_t index) {
+    return &video->data[VIDEO_HEADER_SIZE + VIDEO_PALETTE_SIZE +
+      index * VIDEO_ENTRY_SIZE];
+}
+
+static uint8_t* getIndices(Video *video) {
+    return (uint8_t*)&video->image[3 + 256];
+}
+
+static void addDirty(Video *video, int x, int y, int w, int h) {
+    VideoRect *dirty = &video->dirty;
+
+    if (dirty->width == 0) {
+        *dirty = (VideoRect){ .x = x, .y = y, .width = w, .height = h };
+        return;
+    }
+
+    int x1 = dirty->x + dirty->width, y1 = dirty->y + dirty->height;
+    if (x + w > x1) { x1 = x + w; }
+    if (y + h > y1) { y1 = y + h; }
+    if (x < dirty->x) { dirty->x = x; }
+    if (y < dirty->y) { dirty->y = y; }
+    dirty->width = x1 - dirty->x;
+    dirty->height = y1 - dirty->y;
+}
+
+// Copy a raw frame over the whole working buffer
+static bool applyRaw(Video *video, uint32_t offset, uint32_t length) {
+    const size_t size = video->width * video->height;
+    if (length != size) { return false; }
+
+    uint8_t *indices = getIndices(video);
+    for (size_t i = 0; i < size; i += VIDEO_MAX_READ) {
+        size_t count = size - i;
+        if (count > VIDEO_MAX_READ) { count = VIDEO_MAX_READ; }
+
+        const uint8_t *chunk = video->read(video->arg, offset + i, count);
+        if (chunk == NULL) { return false; }
+        memcpy(&indices[i], chunk, count);
+    }
+
+    addDirty(video, 0, 0, video->width, video->height);
+
+    return true;
+}
+
+// Apply the tiles in a single frame on top of the working buffer
+static bool applyFrame(Video *video, uint32_t index) {
+    const uint8_t *entry = getEntry(video, index);
+    uint32_t offset = readU32(&entry[0]);
+    uint32_t length = readU32(&entry[4]);
+
+    if (offset + length > video->sourceLength) {
+        printf("[video] frame out of range: frame=%ld\n", index);
+        return false;
+    }
+
+    if (readU16(&entry[10]) & VIDEO_ENTRY_RAW) {
+        if (!applyRaw(video, offset, length)) { goto overrun; }
+        return true;
+    }
+
+    const int tileSize = video->tileSize;
+    const int width = video->width, height = video->height;
+    const int tilesX = (width + tileSize - 1) / tileSize;
+    const int tilesY = (height + tileSize - 1) / tileSize;
+
+    // Keep a copy of the bitmap, since the source may be a small window
+    const size_t bitmapLength = (tilesX * tilesY + 7) / 8;
+    if (bitmapLength > length) { goto overrun; }
+
+    uint8_t bitmap[VIDEO_MAX_READ];
+    const uint8_t *chunk = video->read(video->arg, offset, bitmapLength);
+    if (chunk == NULL) { goto overrun; }
+    memcpy(bitmap, chunk, bitmapLength);
+
+    uint32_t cursor = offset + bitmapLength;
+    const uint32_t end = offset + length;
+
+    uint8_t *indices = getIndices(video);
+
+    int tile = 0;
+    for (int ty = 0; ty < tilesY; ty++) {
+        const int y = ty * tileSize;
+        const int h = (height - y < tileSize) ? (height - y): tileSize;
+
+        for (int tx = 0; tx < tilesX; tx++, tile++) {
+            if ((bitmap[tile >> 3] & (1 << (tile & 7))) == 0) { continue; }
+
+            const int x = tx * tileSize;
+            const int w = (width - x < tileSize) ? (width - x): tileSize;
+
+            if (cursor + 1 > end) { goto overrun; }
+            chunk = video->read(video->arg, cursor++, 1);
+            if (chunk == NULL) { goto overrun; }
+            uint8_t mode = chunk[0];
+
+            if (mode == VIDEO_TILE_RAW) {
+                if (cursor + (w * h) > end) { goto overrun; }
+                chunk = video->read(video->arg, cursor, w * h);
+                if (chunk == NULL) { goto overrun; }
+                cursor += w * h;
+
+                for (int row = 0; row < h; row++) {
+                    memcpy(&indices[(y + row) * width + x], chunk, w);
+                    chunk += w;
+                }
+
+            } else if (mode == VIDEO_TILE_RLE) {
+                int row = 0, col = 0;
+                while (row < h) {
+                    if (cursor + 2 > end) { goto overrun; }
+                    chunk = video->read(video->arg, cursor, 2);
+                    if (chunk == NULL) { goto overrun; }
+                    cursor += 2;
+
+                    int count = chunk[0] + 1;
+                    uint8_t value = chunk[1];
+
+                    // Runs may wrap across rows within the tile
+                    while (count && row < h) {
+                        int span = w - col;
+                        if (span > count) { span = count; }
+                        memset(&indices[(y + row) * width + x + col], value,
+                          span);
+                        count -= span;
+                        col += span;
+                        if (col == w) { col = 0; row++; }
+                    }
+                }
+
+            } else if (mode == VIDEO_TILE_PACKED) {
+                if (cursor + 1 > end) { goto overrun; }
+                chunk = video->read(video->arg, cursor++, 1);
+                if (chunk == NULL) { goto overrun; }
+                const int count = chunk[0] + 1;
+
+                if (count > VIDEO_MAX_PACKED || cursor + count > end) {
+                    goto overrun;
+                }
+
+                // The sub-palette; copied, as the bits are a separate read
+                uint8_t colors[VIDEO_MAX_PACKED];
+                chunk = video->read(video->arg, cursor, count);
+                if (chunk == NULL) { goto overrun; }
+                memcpy(colors, chunk, count);
+                cursor += count;
+
+                int bits = 0;
+                while ((1 << bits) < count) { bits++; }
+
+                const uint32_t packedLength = (w * h * bits + 7) / 8;
+                if (cursor + packedLength > end) { goto overrun; }
+                chunk = video->read(video->arg, cursor, packedLength);
+                if (chunk == NULL && packedLength) { goto overrun; }
+                cursor += packedLength;
+
+                const uint32_t mask = (1 << bits) - 1;
+                uint32_t bit = 0;
+                for (int row = 0; row < h; row++) {
+                    uint8_t *out = &indices[(y + row) * width + x];
+                    for (int col = 0; col < w; col++, bit += bits) {
+                        uint32_t value = 0;
+                        if (bits) {
+                            value = chunk[bit >> 3];
+                            if ((bit & 7) + bits > 8) {
+                                value |= chunk[(bit >> 3) + 1] << 8;
+                            }
+                            value = (value >> (bit & 7)) & mask;
+                        }
+                        out[col] = colors[value];
+                    }
+                }
+
+            } else {
+                printf("[video] bad tile mode: frame=%ld mode=%d\n", index,
+                  mode);
+                return false;
+            }
+
+            addDirty(video, x, y, w, h);
+        }
+    }
+
+    if (cursor != end) { goto overrun; }
+
+    return true;
+
+overrun:
+    printf("[video] frame overrun: frame=%ld\n", index);
+    return false;
+}
+
+size_t videoGetPreambleSize(const uint8_t *header) {
+    if (memcmp(header, "FFXV", 4)) { return 0; }
+    return VIDEO_HEADER_SIZE + VIDEO_PALETTE_SIZE +
+      getEntryCount(readU16(&header[8]), header[11]) * VIDEO_ENTRY_SIZE;
+}
+
+bool videoInit(Video *video, const uint8_t *data, size_t length,
+  uint16_t *image, size_t imageSize) {
+
+    memset(video, 0, sizeof(Video));
+    video->frame = -1;
+
+    if (length < VIDEO_HEADER_SIZE || videoGetPreambleSize(data) == 0 ||
+      length < videoGetPreambleSize(data)) {
+        printf("[video] bad header\n");
+        return false;
+    }
+
+    video->width = readU16(&data[4]);
+    video->height = readU16(&data[6]);
+    video->frameCount = readU16(&data[8]);
+    video->tileSize = data[10];
+    video->flags = data[11];
+
+    const int tiles = ((video->width + video->tileSize - 1) / video->tileSize) *
+      ((video->height + video->tileSize - 1) / video->tileSize);
+
+    if (video->frameCount == 0 || video->tileSize == 0 ||
+      (tiles + 7) / 8 > VIDEO_MAX_READ ||
+      video->tileSize * video->tileSize > VIDEO_MAX_READ ||
+      imageSize < VIDEO_IMAGE_SIZE(video->width, video->height)) {
+        printf("[video] unsupported video\n");
+        return false;
+    }
+
+    video->data = data;
+    video->length = length;
+
+    video->read = readMemory;
+    video->arg = video;
+    video->sourceLength = length;
+
+    video->image = image;
+    video->imageSize = imageSize;
+
+    image[0] = VIDEO_IMAGE_FORMAT;
+    image[1] = video->width;
+    image[2] = video->height;
+
+    const uint8_t *palette = &data[VIDEO_HEADER_SIZE];
+    for (int i = 0; i < 256; i++) {
+        image[3 + i] = readU16(&palette[i * 2]);
+    }
+
+    return true;
+}
+
+void videoSetSource(Video *video, size_t length, VideoReadFunc read,
+  void *arg) {
+    video->read = read;
+    video->arg = arg;
+    video->sourceLength = length;
+    video->frame = -1;
+}
+
+uint16_t videoGetDuration(Video *video, uint32_t frame) {
+    if (frame >= video->frameCount) { return 0; }
+    return readU16(&getEntry(video, frame)[8]);
+}
+
+bool videoSeek(Video *video, uint32_t frame) {
+    video->dirty = (VideoRect){ 0 };
+
+    if (video->data == NULL || frame >= video->frameCount) { return false; }
+
+    int32_t current = video->frame;
+    if (frame == current) { return false; }
+
+    if (frame == current + 1) {
+        // Common case; the next frame
+        if (!applyFrame(video, frame)) { goto fail; }
+
+    } else if (frame == 0 && current == video->frameCount - 1 &&
+      (video->flags & VIDEO_FLAG_LOOP)) {
+        // Wrapping around; the loop frame restores the keyframe
+        if (!applyFrame(video, video->frameCount)) { goto fail; }
+
+    } else {
+        // Random access; replay from the keyframe
+        int32_t start = (current >= 0 && frame > current) ? current + 1: 0;
+        for (int32_t i = start; i <= frame; i++) {
+            if (!applyFrame(video, i)) { goto fail; }
+        }
+    }
+
+    video->frame = frame;
+
+    return true;
+
+fail:
+    // The working buffer is in an unknown state; force a keyframe next time
+    video->frame = -1;
+    return false;
+}
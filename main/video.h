@@ -0,0 +1,139 @@
+#ifndef __VIDEO_H__
+#define __VIDEO_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ *  Delta-encoded video container (all values little-endian).
+ *
+ *  Header (16 bytes)
+ *     0  magic "FFXV"
+ *     4  uint16 width
+ *     6  uint16 height
+ *     8  uint16 frameCount (not including the loop frame)
+ *    10  uint8  tileSize
+ *    11  uint8  flags
+ *    12  uint32 reserved
+ *
+ *  Palette: 256 x uint16 RGB565, shared by all frames
+ *
+ *  Frame table: (frameCount + 1 if VIDEO_FLAG_LOOP) entries of
+ *    uint32 offset, uint32 length, uint16 duration (ms), uint16 tiles
+ *    (with VIDEO_ENTRY_RAW set if the frame is the raw 8-bit indices of
+ *    the whole image, for frames which would code larger)
+ *
+ *  Frame: a bitmap with one bit per tile (raster order, LSB first)
+ *    followed by the payload of each set tile: a uint8 mode, then
+ *    either the raw 8-bit indices (VIDEO_TILE_RAW), (count - 1, index)
+ *    run pairs (VIDEO_TILE_RLE) or a uint8 (count - 1), count indices
+ *    and each pixel as a ceil(log2(count))-bit index into those, packed
+ *    LSB first (VIDEO_TILE_PACKED).
+ *
+ *  Frame 0 is a keyframe containing every tile. Every other frame only
+ *  contains the tiles which changed since the previous frame. The loop
+ *  frame (if present) restores frame 0 from the last frame; otherwise
+ *  looping replays frame 0.
+ *
+ *  See tools/video-encode.py.
+ */
+
+#define VIDEO_HEADER_SIZE        (16)
+#define VIDEO_PALETTE_SIZE       (256 * 2)
+#define VIDEO_ENTRY_SIZE         (12)
+
+#define VIDEO_FLAG_LOOP          (0x01)
+
+#define VIDEO_ENTRY_RAW          (0x8000)
+
+#define VIDEO_TILE_RAW           (0)
+#define VIDEO_TILE_RLE           (1)
+#define VIDEO_TILE_PACKED        (2)
+
+// The most colors in a packed tile (so at most 7 bits per pixel)
+#define VIDEO_MAX_PACKED         (128)
+
+// The working buffer is a firefly-scene 8-bit paletted image (0x0138)
+#define VIDEO_IMAGE_FORMAT       (0x0138)
+
+// Size in bytes of the working buffer needed for a width x height video
+#define VIDEO_IMAGE_SIZE(w,h)    (2 * (3 + 256 + (((w) * (h) + 1) / 2)))
+
+// The largest single read made through a VideoReadFunc
+#define VIDEO_MAX_READ           (512)
+
+
+// Returns a pointer to %length% contiguous bytes at %offset% within the
+// container, or NULL on error
+typedef const uint8_t* (*VideoReadFunc)(void *arg, uint32_t offset,
+  size_t length);
+
+typedef struct VideoRect {
+    int16_t x, y;
+    int16_t width, height;
+} VideoRect;
+
+typedef struct Video {
+    // The header, palette and frame table
+    const uint8_t *data;
+    size_t length;
+
+    // Frame payloads are read through this; by default from data
+    VideoReadFunc read;
+    void *arg;
+    size_t sourceLength;
+
+    uint16_t width;
+    uint16_t height;
+    uint16_t frameCount;
+    uint8_t tileSize;
+    uint8_t flags;
+
+    // Working buffer; pass this to ffx_sceneImage_setData
+    uint16_t *image;
+    size_t imageSize;
+
+    // The currently decoded frame (-1 if none)
+    int32_t frame;
+
+    // The region of the image modified by the last seek
+    VideoRect dirty;
+} Video;
+
+
+// Prepare %video% to decode %data% into the %image% working buffer, which
+// must be at least VIDEO_IMAGE_SIZE(width, height) bytes. No frame is
+// decoded until the first videoSeek.
+bool videoInit(Video *video, const uint8_t *data, size_t length,
+  uint16_t *image, size_t imageSize);
+
+// Size of the header, palette and frame table, given the first
+// VIDEO_HEADER_SIZE bytes of a container (0 if invalid)
+size_t videoGetPreambleSize(const uint8_t *header);
+
+// Stream frame payloads through %read% instead of from the data passed to
+// videoInit, which then only needs to hold the preamble. The %length% is the
+// total container length.
+void videoSetSource(Video *video, size_t length, VideoReadFunc read,
+  void *arg);
+
+// The display duration (in ms) of %frame%
+uint16_t videoGetDuration(Video *video, uint32_t frame);
+
+// Decode %frame% into the working buffer, applying only the deltas needed
+// from the current frame when moving forward. Returns true if the image
+// changed, in which case video->dirty holds the bounds of the modified tiles.
+bool videoSeek(Video *video, uint32_t frame);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __VIDEO_H__ */
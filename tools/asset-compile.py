@@ -0,0 +1,355 @@
+#!/usr/bin/env python3
+"""
+Compiles PNG assets into firefly-scene image data (replaces generate.sh).
+
+Each image is written as a packed binary (little-endian uint16 words)
+named image_TAG.bin, which the build links in with target_add_binary_data,
+and a single header declares the symbols and sizes:
+
+  extern const uint16_t image_ship[] asm("_binary_image_ship_bin_start");
+  #define IMAGE_SHIP_SIZE          (2740)
+
+The tag is the file name with any non-alphanumeric characters removed
+(alien-1.png => image_alien1). Images with any transparent pixels are
+stored as RGBA (0x0105, 4-bit alpha), otherwise as RGB (0x0104), unless
+a format is given with --format TAG=FORMAT:
+
+  indexed  quantized to a 256 color palette (0x0138); half the size of
+           RGB and drawn natively by firefly-scene
+  rle      quantized and run-length coded per line (0x0148, see
+           main/image.h); for flat backgrounds, decoded a line
+           fragment at a time with imageDecodeLine (the host scene
+           draws it; firefly-scene does not yet)
+
+For builds which cannot link binary data (e.g. the host build), the
+images can also be written as C arrays, defining the same symbols, with
+--source PATH.
+
+Images are converted in parallel and only when their content changed
+since the last run (tracked by hash in OUTPUT/asset-cache.json). The
+header is only rewritten when it would change, so editing the pixels of
+an image does not recompile the code which uses it.
+
+Usage:
+  tools/asset-compile.py --output build/images --header build/images.h \\
+    --format space=indexed assets/*.png
+"""
+
+import argparse
+import concurrent.futures
+import hashlib
+import importlib.util
+import json
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import pngfile
+
+
+# Bump when the output for a given input changes, to invalidate caches
+VERSION = 4
+
+FORMAT_RGB = 0x0104
+FORMAT_RGBA = 0x0105
+FORMAT_INDEXED = 0x0138
+FORMAT_RLE = 0x0148
+
+FORMATS = [ "auto", "indexed", "rle" ]
+
+# Longest literal and run a single RLE token can hold
+MAX_LITERAL = 128
+MAX_RUN = 129
+
+CACHE_NAME = "asset-cache.json"
+
+# Tools whose source affects the output, hashed into each cache key
+TOOLS = [ "asset-compile.py", "pngfile.py", "video-encode.py" ]
+
+
+def loadTool(name):
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), name)
+    spec = importlib.util.spec_from_file_location(name.split(".")[0], path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+# Rounds to nearest, as the previous converter did, so images stay
+# bit-identical to the old headers
+def rgb565(r, g, b):
+    return ((((r * 31 + 127) // 255) << 11) | (((g * 63 + 127) // 255) << 5) |
+      ((b * 31 + 127) // 255))
+
+def alpha4(a):
+    return (a * 15 + 127) // 255
+
+def getTag(path):
+    name = os.path.splitext(os.path.basename(path))[0]
+    return re.sub("[^a-zA-Z0-9]", "", name)
+
+
+###############################
+# Conversion
+
+def convert(image):
+    colors = [ rgb565(r, g, b) for (r, g, b, _) in image.pixels ]
+
+    if all(a == 255 for (_, _, _, a) in image.pixels):
+        return [ FORMAT_RGB, image.width, image.height ] + colors
+
+    # 4 pixels per word, the first pixel in the high nibble
+    alphas = [ alpha4(a) for (_, _, _, a) in image.pixels ]
+    alphas += [ 0 ] * ((4 - (len(alphas) % 4)) % 4)
+    packed = [ ((alphas[i] << 12) | (alphas[i + 1] << 8) |
+      (alphas[i + 2] << 4) | alphas[i + 3])
+      for i in range(0, len(alphas), 4) ]
+
+    return ([ FORMAT_RGBA, image.width, image.height, len(packed) ] +
+      packed + colors)
+
+def quantize(image):
+    # Shares the palette builder with the video encoder
+    encoder = loadTool("video-encode.py")
+    colors = [ rgb565(r, g, b) for (r, g, b, _) in image.pixels ]
+    (palette, lookup) = encoder.buildPalette([ colors ])
+    return (palette, [ lookup[c] for c in colors ])
+
+def convertIndexed(image):
+    (palette, indices) = quantize(image)
+    indices += [ 0 ] * (len(indices) % 2)
+    packed = [ indices[i] | (indices[i + 1] << 8)
+      for i in range(0, len(indices), 2) ]
+    return [ FORMAT_INDEXED, image.width, image.height ] + palette + packed
+
+def encodeLine(indices):
+    out = bytearray()
+    literal = [ ]
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(indices):
+        run = 1
+        while (i + run < len(indices) and run < MAX_RUN and
+          indices[i + run] == indices[i]):
+            run += 1
+
+        if run >= 2:
+            flush()
+            out += bytes([ 0x80 + run - 2, indices[i] ])
+        else:
+            literal.append(indices[i])
+        i += run
+
+    flush()
+    return bytes(out)
+
+def decodeLine(stream, width):
+    indices = [ ]
+    i = 0
+    while i < len(stream):
+        token = stream[i]
+        if token & 0x80:
+            indices += [ stream[i + 1] ] * (token - 0x80 + 2)
+            i += 2
+        else:
+            indices += stream[i + 1:i + 2 + token]
+            i += 2 + token
+    return indices[:width]
+
+def convertRle(image):
+    (palette, indices) = quantize(image)
+    (width, height) = (image.width, image.height)
+
+    stream = bytearray()
+    offsets = [ ]
+    for y in range(height):
+        line = indices[y * width:(y + 1) * width]
+        offsets.append(len(stream))
+        encoded = encodeLine(line)
+        if decodeLine(encoded, width) != line:
+            raise ValueError("RLE round-trip failed on line %d" % y)
+        stream += encoded
+    offsets.append(len(stream))
+
+    stream += b"\0" * (len(stream) % 2)
+    table = [ ]
+    for offset in offsets:
+        table += [ offset & 0xffff, offset >> 16 ]
+
+    return ([ FORMAT_RLE, width, height, 0 ] + palette + table +
+      list(struct.unpack("<%dH" % (len(stream) // 2), stream)))
+
+def compileImage(path, output, format):
+    image = pngfile.read(path)
+    if format == "indexed":
+        words = convertIndexed(image)
+    elif format == "rle":
+        words = convertRle(image)
+    else:
+        words = convert(image)
+
+    data = struct.pack("<%dH" % len(words), *words)
+    with open(output, "wb") as f:
+        f.write(data)
+    return len(data)
+
+
+###############################
+# Output
+
+def writeIfChanged(path, content):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == content: return False
+    with open(path, "w") as f:
+        f.write(content)
+    return True
+
+def dumpHeader(images):
+    lines = [
+      "// Generated by tools/asset-compile.py; do not edit",
+      "",
+      "#ifndef __IMAGES_H__",
+      "#define __IMAGES_H__",
+      "",
+      "#ifdef __cplusplus",
+      "extern \"C\" {",
+      "#endif  /* __cplusplus */",
+      "",
+      "#include <stdint.h>",
+      "",
+    ]
+
+    for (tag, size) in images:
+        lines.append("extern const uint16_t image_%s[] " % tag +
+          "asm(\"_binary_image_%s_bin_start\");" % tag)
+        lines.append("#define %-24s (%d)" % ("IMAGE_%s_SIZE" % tag.upper(),
+          size))
+        lines.append("")
+
+    lines += [
+      "#ifdef __cplusplus",
+      "}",
+      "#endif  /* __cplusplus */",
+      "",
+      "#endif  /* __IMAGES_H__ */",
+    ]
+
+    return "\n".join(lines) + "\n"
+
+def dumpSource(images, directory):
+    lines = [
+      "// Generated by tools/asset-compile.py; do not edit",
+      "",
+      "#include <stdint.h>",
+      "",
+    ]
+
+    for (tag, size) in images:
+        with open(os.path.join(directory, "image_%s.bin" % tag), "rb") as f:
+            data = f.read()
+        words = struct.unpack("<%dH" % (len(data) // 2), data)
+
+        lines.append("const uint16_t image_%s[] " % tag +
+          "asm(\"_binary_image_%s_bin_start\") = {" % tag)
+        for i in range(0, len(words), 12):
+            lines.append("    " + ", ".join("0x%04x" % w
+              for w in words[i:i + 12]) + ",")
+        lines.append("};")
+        lines.append("")
+
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description = "Compile image assets")
+    parser.add_argument("images", nargs = "+", help = "PNG files")
+    parser.add_argument("--output", required = True,
+      help = "directory for the image binaries")
+    parser.add_argument("--header", required = True,
+      help = "where to write the symbol header")
+    parser.add_argument("--source",
+      help = "where to also write the images as C arrays")
+    parser.add_argument("--format", action = "append", default = [ ],
+      metavar = "TAG=FORMAT", help = "one of %s" % ", ".join(FORMATS))
+    parser.add_argument("--jobs", type = int, default = os.cpu_count())
+    args = parser.parse_args()
+
+    formats = { }
+    for spec in args.format:
+        (tag, format) = spec.split("=", 1)
+        if format not in FORMATS:
+            raise ValueError("unknown format: %s" % spec)
+        formats[tag] = format
+
+    os.makedirs(args.output, exist_ok = True)
+
+    cachePath = os.path.join(args.output, CACHE_NAME)
+    cache = { }
+    if os.path.exists(cachePath):
+        with open(cachePath) as f:
+            cache = json.load(f)
+
+    tools = hashlib.sha256()
+    for name in TOOLS:
+        with open(os.path.join(os.path.dirname(os.path.abspath(__file__)),
+          name), "rb") as f:
+            tools.update(f.read())
+    tools = tools.digest()
+
+    # Find the images which need converting
+    tags = { }
+    pending = [ ]
+    for path in sorted(args.images):
+        tag = getTag(path)
+        if tag in tags:
+            raise ValueError("%s: duplicate tag %s (%s)" % (path, tag,
+              tags[tag]))
+        tags[tag] = path
+
+        format = formats.get(tag, "auto")
+        with open(path, "rb") as f:
+            digest = hashlib.sha256(f.read() + struct.pack("<I", VERSION) +
+              tools + format.encode())
+        digest = digest.hexdigest()
+
+        output = os.path.join(args.output, "image_%s.bin" % tag)
+        entry = cache.get(tag)
+        if entry and entry["hash"] == digest and os.path.exists(output):
+            continue
+
+        cache[tag] = dict(hash = digest, size = 0)
+        pending.append((tag, path, output, format))
+
+    with concurrent.futures.ProcessPoolExecutor(max_workers = args.jobs) as pool:
+        jobs = [ (tag, pool.submit(compileImage, path, output, format))
+          for (tag, path, output, format) in pending ]
+        for (tag, job) in jobs:
+            cache[tag]["size"] = job.result()
+
+    # Forget removed images
+    cache = dict((tag, cache[tag]) for tag in tags)
+
+    with open(cachePath, "w") as f:
+        json.dump(cache, f, indent = 2, sort_keys = True)
+
+    images = [ (tag, cache[tag]["size"]) for tag in sorted(tags) ]
+    writeIfChanged(args.header, dumpHeader(images))
+    if args.source:
+        writeIfChanged(args.source, dumpSource(images, args.output))
+
+    sys.stderr.write("assets: %d images, %d converted\n" % (len(tags),
+      len(pending)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+"""
+Replays a trace of requests against a host build listening on a Unix
+socket (see main/transport-socket.h), at a fixed rate, and reports the
+latency percentiles per method; for regression testing throughput and
+tail latency without a phone or radio.
+
+A trace is either CBOR (a sequence of [ method, params ] items, as
+recorded) or JSON lines of { "method": ..., "params": ... }, where
+strings starting with "0x" are sent as bytes.
+
+Usage:
+  tools/loadgen.py --socket /tmp/pixie.sock --trace traces/accounts.jsonl \\
+    --rate 50 --count 1000
+
+Exits with status 1 if any request failed or timed out, or a --max-p99
+(ms) is exceeded, so it can gate CI.
+"""
+
+import argparse
+import json
+import socket
+import struct
+import sys
+import threading
+import time
+
+
+TIMEOUT = 10.0
+
+
+#############################
+# CBOR (the subset requests use)
+
+def encodeHead(major, value):
+    if value < 24:
+        return bytes([ (major << 5) | value ])
+    if value < 0x100:
+        return bytes([ (major << 5) | 24, value ])
+    if value < 0x10000:
+        return bytes([ (major << 5) | 25 ]) + struct.pack(">H", value)
+    if value < 0x100000000:
+        return bytes([ (major << 5) | 26 ]) + struct.pack(">I", value)
+    return bytes([ (major << 5) | 27 ]) + struct.pack(">Q", value)
+
+def encode(value):
+    if value is None: return b"\xf6"
+    if value is True: return b"\xf5"
+    if value is False: return b"\xf4"
+    if isinstance(value, int):
+        if value >= 0: return encodeHead(0, value)
+        return encodeHead(1, -1 - value)
+    if isinstance(value, bytes):
+        return encodeHead(2, len(value)) + value
+    if isinstance(value, str):
+        data = value.encode("utf8")
+        return encodeHead(3, len(data)) + data
+    if isinstance(value, list):
+        return encodeHead(4, len(value)) + b"".join(encode(v) for v in value)
+    if isinstance(value, dict):
+        return encodeHead(5, len(value)) + b"".join(encode(k) + encode(v)
+          for k, v in value.items())
+    raise Exception("cannot encode: %r" % (value, ))
+
+def decode(data, offset = 0):
+    head = data[offset]
+    major, info = head >> 5, head & 0x1f
+    offset += 1
+
+    if major == 7:
+        if info == 20: return (False, offset)
+        if info == 21: return (True, offset)
+        if info == 22: return (None, offset)
+        raise Exception("unsupported simple value: %d" % info)
+
+    if info < 24:
+        value = info
+    else:
+        size = 1 << (info - 24)
+        value = int.from_bytes(data[offset:offset + size], "big")
+        offset += size
+
+    if major == 0: return (value, offset)
+    if major == 1: return (-1 - value, offset)
+    if major == 2: return (data[offset:offset + value], offset + value)
+    if major == 3:
+        return (data[offset:offset + value].decode("utf8"), offset + value)
+    if major == 4:
+        result = [ ]
+        for i in range(value):
+            (item, offset) = decode(data, offset)
+            result.append(item)
+        return (result, offset)
+    if major == 5:
+        result = { }
+        for i in range(value):
+            (key, offset) = decode(data, offset)
+            (result[key], offset) = decode(data, offset)
+        return (result, offset)
+    raise Exception("unsupported major type: %d" % major)
+
+
+#############################
+# Traces
+
+def fromJson(value):
+    if isinstance(value, str) and value.startswith("0x"):
+        return bytes.fromhex(value[2:])
+    if isinstance(value, list):
+        return [ fromJson(v) for v in value ]
+    if isinstance(value, dict):
+        return dict((k, fromJson(v)) for k, v in value.items())
+    return value
+
+def loadTrace(path):
+    with open(path, "rb") as fp:
+        data = fp.read()
+
+    calls = [ ]
+    if path.endswith(".jsonl") or path.endswith(".json"):
+        for line in data.decode("utf8").split("\n"):
+            if not line.strip(): continue
+            call = json.loads(line)
+            calls.append((call["method"], fromJson(call.get("params", [ ]))))
+    else:
+        offset = 0
+        while offset < len(data):
+            ((method, params), offset) = decode(data, offset)
+            calls.append((method, params))
+
+    if not calls: raise Exception("empty trace: %s" % path)
+    return calls
+
+
+#############################
+# Replay
+
+class Client:
+    def __init__(self, path):
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.sock.connect(path)
+
+        self.lock = threading.Lock()
+        self.pending = dict()
+        self.results = [ ]
+        self.done = threading.Event()
+
+        self.reader = threading.Thread(target = self.read, daemon = True)
+        self.reader.start()
+
+    def send(self, id, method, params):
+        frame = encode([ id, method, params ])
+        with self.lock:
+            self.pending[id] = (method, time.perf_counter())
+        self.sock.sendall(struct.pack(">I", len(frame)) + frame)
+
+    def readAll(self, length):
+        data = b""
+        while len(data) < length:
+            chunk = self.sock.recv(length - len(data))
+            if not chunk: raise EOFError()
+            data += chunk
+        return data
+
+    def read(self):
+        try:
+            while True:
+                (length, ) = struct.unpack(">I", self.readAll(4))
+                frame = self.readAll(length)
+                now = time.perf_counter()
+
+                (id, error) = struct.unpack(">II", frame[:8])
+                with self.lock:
+                    if id not in self.pending: continue
+                    (method, t0) = self.pending.pop(id)
+                    self.results.append((method, now - t0, error))
+        except (EOFError, OSError):
+            pass
+        self.done.set()
+
+    def wait(self, timeout):
+        deadline = time.perf_counter() + timeout
+        while time.perf_counter() < deadline:
+            with self.lock:
+                if not self.pending: return 0
+            if self.done.is_set(): break
+            time.sleep(0.01)
+        with self.lock:
+            return len(self.pending)
+
+def percentile(values, p):
+    index = max(0, int(len(values) * p / 100.0 + 0.999999) - 1)
+    return values[min(index, len(values) - 1)]
+
+def report(results, duration):
+    methods = dict()
+    for (method, latency, error) in results:
+        stats = methods.setdefault(method, { "latencies": [ ], "errors": 0 })
+        stats["latencies"].append(latency * 1000)
+        if error: stats["errors"] += 1
+
+    summary = dict()
+    for method in sorted(methods):
+        stats = methods[method]
+        latencies = sorted(stats["latencies"])
+        summary[method] = {
+            "count": len(latencies),
+            "errors": stats["errors"],
+            "p50": percentile(latencies, 50),
+            "p90": percentile(latencies, 90),
+            "p99": percentile(latencies, 99),
+            "max": latencies[-1],
+        }
+
+    print("%-24s %7s %6s %9s %9s %9s %9s" % ("method", "count", "errors",
+      "p50 ms", "p90 ms", "p99 ms", "max ms"))
+    for method, stats in summary.items():
+        print("%-24s %7d %6d %9.2f %9.2f %9.2f %9.2f" % (method,
+          stats["count"], stats["errors"], stats["p50"], stats["p90"],
+          stats["p99"], stats["max"]))
+    print("throughput: %.1f requests/s" % (len(results) / duration))
+
+    return summary
+
+
+def main():
+    parser = argparse.ArgumentParser(
+      description="Replay a request trace and report latency per method")
+    parser.add_argument("--socket", required=True,
+      help="Unix socket of the host build")
+    parser.add_argument("--trace", required=True, action="append",
+      help="trace to replay (CBOR or JSON lines); may repeat")
+    parser.add_argument("--rate", type=float, default=0,
+      help="requests per second (default: each after the last reply)")
+    parser.add_argument("--count", type=int, default=0,
+      help="requests to send, cycling the trace (default: the trace once)")
+    parser.add_argument("--max-p99", type=float, default=0,
+      help="fail if any method's p99 (ms) exceeds this")
+    parser.add_argument("--json", help="also write the summary here")
+    args = parser.parse_args()
+
+    calls = [ ]
+    for path in args.trace: calls += loadTrace(path)
+
+    count = args.count or len(calls)
+
+    client = Client(args.socket)
+
+    t0 = time.perf_counter()
+    for i in range(count):
+        (method, params) = calls[i % len(calls)]
+
+        if args.rate:
+            delay = t0 + i / args.rate - time.perf_counter()
+            if delay > 0: time.sleep(delay)
+
+        client.send(i + 1, method, params)
+
+        # Closed loop; only one request in flight
+        if not args.rate and client.wait(TIMEOUT):
+            break
+
+    lost = client.wait(TIMEOUT)
+    duration = time.perf_counter() - t0
+
+    summary = report(client.results, duration)
+
+    failed = lost > 0
+    if lost: print("lost: %d requests timed out" % lost)
+    for method, stats in summary.items():
+        if stats["errors"]: failed = True
+        if args.max_p99 and stats["p99"] > args.max_p99:
+            print("slow: %s p99=%.2fms" % (method, stats["p99"]))
+            failed = True
+
+    if args.json:
+        with open(args.json, "w") as fp:
+            json.dump(summary, fp, indent = 2)
+
+    if failed: sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Packs assets into a media file for the "media" flash partition (see
+main/media.h for the format).
+
+Usage:
+  tools/media-pack.py --output build/media.bin --header build/media-clips.h \\
+    --video nyan=assets/video-nyan:100 --video shiba=assets/video-shiba:100
+
+The header holds the clip table (MediaClip) the firmware plays from, in
+the order the videos are given.
+
+To update the assets on a device without rebuilding the firmware:
+  parttool.py write_partition --partition-name media --input build/media.bin
+"""
+
+import argparse
+import importlib.util
+import os
+import struct
+import sys
+
+
+MAGIC = b"FFXM"
+VERSION = 1
+
+HEADER_SIZE = 16
+ENTRY_SIZE = 32
+NAME_LENGTH = 24
+ALIGN = 16
+
+
+def loadTool(name):
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), name)
+    spec = importlib.util.spec_from_file_location(name.split(".")[0], path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+def pack(entries):
+    data = bytearray(HEADER_SIZE + len(entries) * ENTRY_SIZE)
+
+    index = bytearray()
+    for (name, payload) in entries:
+        if len(name.encode()) > NAME_LENGTH:
+            raise ValueError("name too long: %s" % name)
+
+        data += b"\0" * ((ALIGN - (len(data) % ALIGN)) % ALIGN)
+        index += struct.pack("<24sII", name.encode(), len(data), len(payload))
+        data += payload
+
+    data[0:HEADER_SIZE] = MAGIC + struct.pack("<HHII", VERSION, len(entries),
+      len(data), 0)
+    data[HEADER_SIZE:HEADER_SIZE + len(index)] = index
+
+    return bytes(data)
+
+
+def dumpClips(clips, out):
+    out.write("// Generated by tools/media-pack.py; do not edit\n\n")
+    out.write("#ifndef __MEDIA_CLIPS_H__\n#define __MEDIA_CLIPS_H__\n\n")
+    out.write("#include \"media.h\"\n\n")
+    out.write("#define MEDIA_CLIP_COUNT      (%d)\n\n" % len(clips))
+    out.write("static const MediaClip mediaClips[] = {\n")
+    for clip in clips:
+        out.write(("    { .name = \"%(name)s\", .title = \"%(title)s\", " +
+          ".frameCount = %(frameCount)d, .framePeriod = %(framePeriod)d, " +
+          ".offset = 0x%(offset)x, .length = %(length)d },\n") % clip)
+    out.write("};\n\n#endif  /* __MEDIA_CLIPS_H__ */\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description = "Pack the media partition")
+    parser.add_argument("--output", required = True)
+    parser.add_argument("--header", help = "where to write the clip table")
+    parser.add_argument("--video", action = "append", default = [ ],
+      metavar = "NAME=DIR[:DURATIONS]",
+      help = "directory of PNG frames; comma-separated durations (ms)")
+    args = parser.parse_args()
+
+    encoder = loadTool("video-encode.py")
+
+    entries = [ ]
+    for spec in args.video:
+        (name, source) = spec.split("=", 1)
+        durations = [ 100 ]
+        if ":" in source:
+            (source, durations) = source.rsplit(":", 1)
+            durations = encoder.parseDurations(durations)
+
+        entries.append((name, encoder.encodeDirectory(source, durations)))
+
+    data = pack(entries)
+
+    with open(args.output, "wb") as f:
+        f.write(data)
+
+    if args.header:
+        clips = [ ]
+        for (i, (name, payload)) in enumerate(entries):
+            (offset, length) = struct.unpack("<II",
+              data[HEADER_SIZE + i * ENTRY_SIZE + NAME_LENGTH:][:8])
+            (frameCount, ) = struct.unpack("<H", payload[8:10])
+
+            # The duration of the first frame, from the frame table
+            table = encoder.HEADER_SIZE + encoder.PALETTE_SIZE
+            (framePeriod, ) = struct.unpack("<H", payload[table + 8:table + 10])
+            clips.append(dict(name = name, title = name.capitalize(),
+              frameCount = frameCount, framePeriod = framePeriod,
+              offset = offset, length = length))
+
+        with open(args.header, "w") as f:
+            dumpClips(clips, f)
+
+    sys.stderr.write("media: %d entries, %d bytes\n" % (len(entries),
+      len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+Packs function selectors and token metadata into a file for the
+"metadata" flash partition (see main/metadata.h for the format).
+
+Usage:
+  tools/metadata-pack.py --output build/metadata.bin assets/metadata.json
+
+The source is JSON, with "selectors", a map of 4-byte selectors ("0x"
+hex) to signatures, and "tokens", a list of { "chainId", "address",
+"symbol", "decimals" }. Several sources may be given; later entries
+replace earlier ones with the same key.
+
+To update the metadata on a device without rebuilding the firmware:
+  parttool.py write_partition --partition-name metadata \\
+    --input build/metadata.bin
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+
+MAGIC = b"FFXD"
+VERSION = 1
+
+HEADER_SIZE = 32
+SELECTOR_SIZE = 8
+TOKEN_SIZE = 32
+
+
+def parseHex(value, length):
+    if not value.startswith("0x"):
+        raise ValueError("expected hex: %r" % value)
+    data = bytes.fromhex(value[2:])
+    if len(data) != length:
+        raise ValueError("expected %d bytes: %r" % (length, value))
+    return data
+
+
+# Order the sorted %items% so the children of item k (from 1) are at 2k
+# and 2k + 1; see main/metadata.c
+def eytzinger(items):
+    result = [ None ] * len(items)
+
+    def fill(i, k):
+        if k <= len(items):
+            i = fill(i, 2 * k)
+            result[k - 1] = items[i]
+            i = fill(i + 1, 2 * k + 1)
+        return i
+
+    fill(0, 1)
+    return result
+
+
+class Strings:
+    def __init__(self):
+        self.data = bytearray()
+        self.offsets = dict()
+
+    def add(self, value):
+        if value not in self.offsets:
+            self.offsets[value] = len(self.data)
+            self.data += value.encode("utf8") + b"\0"
+        return self.offsets[value]
+
+
+def pack(selectors, tokens):
+    strings = Strings()
+
+    selectorTable = bytearray()
+    for key in eytzinger(sorted(selectors)):
+        selectorTable += key + struct.pack("<I", strings.add(selectors[key]))
+
+    tokenTable = bytearray()
+    for key in eytzinger(sorted(tokens)):
+        (symbol, decimals) = tokens[key]
+        tokenTable += key + struct.pack("<B3xI", decimals, strings.add(symbol))
+
+    # The strings come last, so the file ends in a NUL
+    strings.add("")
+
+    selectorOffset = HEADER_SIZE
+    tokenOffset = selectorOffset + len(selectorTable)
+    stringsOffset = tokenOffset + len(tokenTable)
+    length = stringsOffset + len(strings.data)
+
+    header = MAGIC + struct.pack("<HHIIIIII", VERSION, 0, len(selectors),
+      selectorOffset, len(tokens), tokenOffset, stringsOffset, length)
+
+    return header + selectorTable + tokenTable + strings.data
+
+
+def main():
+    parser = argparse.ArgumentParser(
+      description = "Pack the metadata partition")
+    parser.add_argument("--output", required = True)
+    parser.add_argument("source", nargs = "+", help = "JSON metadata")
+    args = parser.parse_args()
+
+    selectors = dict()
+    tokens = dict()
+
+    for path in args.source:
+        with open(path) as f:
+            source = json.load(f)
+
+        for (selector, signature) in source.get("selectors", { }).items():
+            selectors[parseHex(selector, 4)] = signature
+
+        for token in source.get("tokens", [ ]):
+            key = struct.pack(">I", token["chainId"])
+            key += parseHex(token["address"], 20)
+            tokens[key] = (token["symbol"], token["decimals"])
+
+    data = pack(selectors, tokens)
+
+    with open(args.output, "wb") as f:
+        f.write(data)
+
+    sys.stderr.write("metadata: %d selectors, %d tokens, %d bytes\n" % (
+      len(selectors), len(tokens), len(data)))
+
+
+if __name__ == "__main__":
+    main()
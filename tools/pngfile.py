@@ -0,0 +1,170 @@
+"""
+Minimal PNG reader/writer for the asset tools.
+
+Only what the assets in this repo need is supported: 8-bit depth,
+non-interlaced, greyscale, RGB, RGBA and paletted images. It only
+depends on the Python standard library.
+"""
+
+import struct
+import zlib
+
+
+SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+COLOR_GREY = 0
+COLOR_RGB = 2
+COLOR_PALETTE = 3
+COLOR_GREY_ALPHA = 4
+COLOR_RGBA = 6
+
+CHANNELS = {
+    COLOR_GREY: 1, COLOR_RGB: 3, COLOR_PALETTE: 1,
+    COLOR_GREY_ALPHA: 2, COLOR_RGBA: 4
+}
+
+
+class Image:
+    """Decoded image; pixels is a flat list of (r, g, b, a) tuples."""
+
+    def __init__(self, width, height, pixels):
+        self.width = width
+        self.height = height
+        self.pixels = pixels
+
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    if pb <= pc:
+        return b
+    return c
+
+
+def _unfilter(raw, width, height, bpp):
+    stride = width * bpp
+    out = bytearray(stride * height)
+    prev = bytearray(stride)
+    offset = 0
+    for y in range(height):
+        kind = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        offset += 1 + stride
+
+        if kind == 1:
+            for i in range(bpp, stride):
+                line[i] = (line[i] + line[i - bpp]) & 0xff
+        elif kind == 2:
+            for i in range(stride):
+                line[i] = (line[i] + prev[i]) & 0xff
+        elif kind == 3:
+            for i in range(stride):
+                left = line[i - bpp] if i >= bpp else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xff
+        elif kind == 4:
+            for i in range(stride):
+                left = line[i - bpp] if i >= bpp else 0
+                upLeft = prev[i - bpp] if i >= bpp else 0
+                line[i] = (line[i] + _paeth(left, prev[i], upLeft)) & 0xff
+        elif kind != 0:
+            raise ValueError("bad filter type: %d" % kind)
+
+        out[y * stride:(y + 1) * stride] = line
+        prev = line
+
+    return out
+
+
+def read(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:8] != SIGNATURE:
+        raise ValueError("%s: not a PNG file" % path)
+
+    offset = 8
+    header = None
+    palette = []
+    transparency = b""
+    idat = bytearray()
+
+    while offset < len(data):
+        (length, kind) = struct.unpack(">I4s", data[offset:offset + 8])
+        chunk = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+        elif kind == b"tRNS":
+            transparency = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    (width, height, depth, colorType, _, _, interlace) = header
+    if depth != 8 or interlace != 0:
+        raise ValueError("%s: unsupported PNG (depth=%d, interlace=%d)" %
+          (path, depth, interlace))
+
+    bpp = CHANNELS[colorType]
+    raw = _unfilter(zlib.decompress(bytes(idat)), width, height, bpp)
+
+    pixels = []
+    if colorType == COLOR_PALETTE:
+        alpha = list(transparency) + [255] * (256 - len(transparency))
+        lut = [ (r, g, b, alpha[i]) for i, (r, g, b) in enumerate(palette) ]
+        pixels = [ lut[i] for i in raw ]
+    elif colorType == COLOR_RGB:
+        pixels = [ (raw[i], raw[i + 1], raw[i + 2], 255)
+          for i in range(0, len(raw), 3) ]
+    elif colorType == COLOR_RGBA:
+        pixels = [ tuple(raw[i:i + 4]) for i in range(0, len(raw), 4) ]
+    elif colorType == COLOR_GREY:
+        pixels = [ (v, v, v, 255) for v in raw ]
+    elif colorType == COLOR_GREY_ALPHA:
+        pixels = [ (raw[i], raw[i], raw[i], raw[i + 1])
+          for i in range(0, len(raw), 2) ]
+
+    return Image(width, height, pixels)
+
+
+def _chunk(kind, data):
+    body = kind + data
+    return (struct.pack(">I", len(data)) + body +
+      struct.pack(">I", zlib.crc32(body) & 0xffffffff))
+
+
+def write(path, width, height, pixels, palette=None):
+    """
+    Writes pixels as an RGBA PNG, or as a paletted PNG if palette (a
+    list of (r, g, b) tuples) is given, in which case pixels are indices.
+    """
+
+    raw = bytearray()
+    if palette is None:
+        colorType = COLOR_RGBA
+        for y in range(height):
+            raw.append(0)
+            for (r, g, b, a) in pixels[y * width:(y + 1) * width]:
+                raw += bytes((r, g, b, a))
+    else:
+        colorType = COLOR_PALETTE
+        for y in range(height):
+            raw.append(0)
+            raw += bytes(pixels[y * width:(y + 1) * width])
+
+    data = SIGNATURE
+    data += _chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8,
+      colorType, 0, 0, 0))
+    if palette is not None:
+        data += _chunk(b"PLTE", b"".join(bytes(c) for c in palette))
+    data += _chunk(b"IDAT", zlib.compress(bytes(raw), 9))
+    data += _chunk(b"IEND", b"")
+
+    with open(path, "wb") as f:
+        f.write(data)
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+Generates the fixed-base table main/secp256k1.c multiplies the secp256k1
+generator with, as a C source linked into the app (so it lives in flash).
+
+The scalar is split into 256 / WINDOW digits of WINDOW bits, and row i of
+the table holds every possible digit d as the point
+
+  d * 2^(WINDOW * i) * G + 2^i * U
+
+so a multiplication is one addition per digit and no doublings. The
+offset U is a point of unknown discrete log (hashed from a fixed string),
+so no entry is at infinity. Each row has its own multiple of U, so a
+partial sum, which holds (2^i - 1) * U, can only equal (or negate) the
+next entry if the discrete log of U were known; a shared offset would
+make every pair of zero digits a doubling. The offsets are removed at
+the end by adding the final entry:
+
+  -(2^(256 / WINDOW) - 1) * U
+
+Each extra bit of window halves the additions per multiplication and
+(roughly) doubles the flash used:
+
+  WINDOW  additions  size
+       2        128  32 KiB
+       4         64  64 KiB
+       8         32  512 KiB
+
+Usage:
+  tools/secp256k1-table.py --window 4 --output build/secp256k1-table.c
+"""
+
+import argparse
+import hashlib
+import os
+
+
+P = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F
+N = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141
+
+G = (0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798,
+     0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8)
+
+WINDOWS = [ 2, 4, 8 ]
+
+OFFSET_SEED = b"pixie-firmware/secp256k1/offset"
+
+
+def add(a, b):
+    if a is None: return b
+    if b is None: return a
+
+    if a[0] == b[0]:
+        if (a[1] + b[1]) % P == 0: return None
+        l = 3 * a[0] * a[0] * pow(2 * a[1], P - 2, P)
+    else:
+        l = (b[1] - a[1]) * pow(b[0] - a[0], P - 2, P)
+
+    x = (l * l - a[0] - b[0]) % P
+    return (x, (l * (a[0] - x) - a[1]) % P)
+
+def multiply(k, point):
+    result = None
+    while k:
+        if k & 1: result = add(result, point)
+        point = add(point, point)
+        k >>= 1
+    return result
+
+def negate(point):
+    return (point[0], P - point[1])
+
+# Try-and-increment; the first x (from the hash of the seed) on the curve
+def getOffset():
+    x = int.from_bytes(hashlib.sha256(OFFSET_SEED).digest(), "big") % P
+    while True:
+        rhs = (x * x * x + 7) % P
+        y = pow(rhs, (P + 1) // 4, P)
+        if (y * y) % P == rhs: return (x, y)
+        x += 1
+
+def formatElement(value):
+    words = [ (value >> (32 * i)) & 0xffffffff for i in range(8) ]
+    return "{ %s }" % ", ".join("0x%08x" % w for w in words)
+
+def formatPoint(point):
+    return "{ %s,\n          %s }" % (formatElement(point[0]),
+      formatElement(point[1]))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+      description="Generate the secp256k1 fixed-base table")
+    parser.add_argument("--window", type=int, default=4, choices=WINDOWS,
+      help="bits per digit (default: 4)")
+    parser.add_argument("--output", required=True,
+      help="C source to write")
+    args = parser.parse_args()
+
+    window = args.window
+    rows = 256 // window
+    entries = 1 << window
+
+    offset = getOffset()
+
+    lines = [
+        "// Generated by tools/secp256k1-table.py; do not edit",
+        "",
+        "#include \"secp256k1.h\"",
+        "",
+        "",
+        "_Static_assert(SECP256K1_WINDOW == %d, \"table window mismatch\");"
+          % window,
+        "",
+        "const Secp256k1Affine secp256k1Table[SECP256K1_ROWS]" \
+          "[SECP256K1_ENTRIES] = {",
+    ]
+
+    base = G
+    rowOffset = offset
+    for row in range(rows):
+        lines.append("    {")
+
+        point = rowOffset
+        for digit in range(entries):
+            if point is None:
+                raise Exception("table entry at infinity (offset collision)")
+            lines.append("        %s," % formatPoint(point))
+            point = add(point, base)
+
+        lines.append("    },")
+
+        base = multiply(entries, base)
+        rowOffset = add(rowOffset, rowOffset)
+
+    lines.append("};")
+    lines.append("")
+
+    final = negate(multiply((1 << rows) - 1, offset))
+    lines.append("const Secp256k1Affine secp256k1Offset =")
+    lines.append("        %s;" % formatPoint(final))
+    lines.append("")
+
+    data = "\n".join(lines)
+
+    # Only touch the output when it changes, to avoid rebuilding
+    if os.path.exists(args.output):
+        with open(args.output) as fp:
+            if fp.read() == data: return
+
+    with open(args.output, "w") as fp:
+        fp.write(data)
+
+    print("secp256k1-table: window=%d entries=%d size=%d bytes" % (window,
+      rows * entries, rows * entries * 64))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,492 @@
+#!/usr/bin/env python3
+"""
+Encodes a directory of PNG frames into a delta-encoded video container
+(see main/video.h for the format).
+
+All frames share a single 256 color palette. The first frame is stored
+as a keyframe and every following frame only carries the tiles which
+differ from what the decoder will have in its working buffer. Each tile
+is stored raw, run-length coded or packed against its own sub-palette
+(with as few bits per pixel as its colors need), whichever is smallest,
+and a frame which would code larger than the raw image is stored raw.
+A loop frame which restores the exact keyframe is appended if it is
+smaller than the keyframe; otherwise looping replays the keyframe. So a
+clip (of more than one frame) is never larger than its frames as raw
+0x0138 keyframes.
+
+By default only unchanged tiles are skipped, so playback shows exactly
+the palette-mapped frames; the only loss is the palette itself, when a
+video has more than 256 colors (nyan: mean 1.1, worst 50 per 8-bit
+channel; shiba: mean 0.2, worst 9). A --threshold skips tiles whose
+mean per-pixel error is below it, which is lossy: the stale tiles stay
+on screen until they drift past it.
+
+Lossless, nyan is about 2.1x smaller than raw keyframes and shiba
+(dithered, with most tiles changing every frame) about 1.4x; even zlib
+over whole frames only reaches 1.6x on shiba.
+
+Usage:
+  tools/video-encode.py --tag nyan --duration 100 assets/video-nyan \\
+    > video-nyan.h
+
+The firmware streams videos from the media partition; see media-pack.py.
+
+The output is decoded again before being written and compared against
+the palette-mapped frames; any tile outside the threshold aborts the
+encode. The error against the source frames is reported.
+"""
+
+import argparse
+import glob
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import pngfile
+
+
+MAGIC = b"FFXV"
+
+HEADER_SIZE = 16
+PALETTE_SIZE = 256 * 2
+ENTRY_SIZE = 12
+
+FLAG_LOOP = 0x01
+
+ENTRY_RAW = 0x8000
+
+TILE_RAW = 0
+TILE_RLE = 1
+TILE_PACKED = 2
+
+# Colors in a packed tile's sub-palette, so at most 7 bits per pixel
+MAX_PACKED_COLORS = 128
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+def expand(color):
+    r = (color >> 11) & 0x1f
+    g = (color >> 5) & 0x3f
+    b = color & 0x1f
+    return ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+
+
+###############################
+# Palette
+
+def medianCut(counts, size):
+    boxes = [ [ (expand(c), n, c) for (c, n) in counts.items() ] ]
+
+    while len(boxes) < size:
+        # Split the box with the largest weighted channel range
+        best = None
+        for (i, box) in enumerate(boxes):
+            if len(box) < 2: continue
+            for ch in range(3):
+                values = [ rgb[ch] for (rgb, _, _) in box ]
+                spread = (max(values) - min(values)) * sum(n for (_, n, _) in box)
+                if best is None or spread > best[0]:
+                    best = (spread, i, ch)
+
+        if best is None: break
+
+        (_, i, ch) = best
+        box = sorted(boxes.pop(i), key = lambda e: e[0][ch])
+        total = sum(n for (_, n, _) in box)
+        acc = 0
+        for (split, (_, n, _)) in enumerate(box):
+            acc += n
+            if acc * 2 >= total: break
+        split = min(max(split + 1, 1), len(box) - 1)
+        boxes += [ box[:split], box[split:] ]
+
+    palette = [ ]
+    for box in boxes:
+        total = sum(n for (_, n, _) in box)
+        rgb = [ sum(c[ch] * n for (c, n, _) in box) // total for ch in range(3) ]
+        palette.append(rgb565(*rgb))
+
+    return palette
+
+def buildPalette(frames):
+    counts = { }
+    for frame in frames:
+        for color in frame:
+            counts[color] = counts.get(color, 0) + 1
+
+    if len(counts) <= 256:
+        palette = sorted(counts, key = lambda c: -counts[c])
+    else:
+        palette = medianCut(counts, 256)
+
+    palette += [ 0 ] * (256 - len(palette))
+
+    # Map every source color to its nearest palette entry
+    expanded = [ expand(c) for c in palette ]
+    lookup = { }
+    for color in counts:
+        (r, g, b) = expand(color)
+        best = min(range(256), key = lambda i: (
+          (expanded[i][0] - r) ** 2 + (expanded[i][1] - g) ** 2 +
+          (expanded[i][2] - b) ** 2))
+        lookup[color] = best
+
+    return (palette, lookup)
+
+
+###############################
+# Tiles
+
+def tileRects(width, height, tileSize):
+    rects = [ ]
+    for ty in range(0, height, tileSize):
+        for tx in range(0, width, tileSize):
+            rects.append((tx, ty, min(tileSize, width - tx),
+              min(tileSize, height - ty)))
+    return rects
+
+def tileIndices(pixels, width, rect):
+    (x, y, w, h) = rect
+    result = [ ]
+    for row in range(y, y + h):
+        result += pixels[row * width + x:row * width + x + w]
+    return result
+
+def tileError(a, b, colors):
+    error = 0
+    for (i, j) in zip(a, b):
+        if i == j: continue
+        (ca, cb) = (colors[i], colors[j])
+        error += abs(ca[0] - cb[0]) + abs(ca[1] - cb[1]) + abs(ca[2] - cb[2])
+    return error / len(a)
+
+def diffTiles(rects, state, target, width, colors, threshold):
+    dirty = [ ]
+    for rect in rects:
+        a = tileIndices(state, width, rect)
+        b = tileIndices(target, width, rect)
+        if threshold == 0:
+            dirty.append(a != b)
+        else:
+            dirty.append(tileError(a, b, colors) > threshold)
+    return dirty
+
+def applyTiles(rects, dirty, state, target, width):
+    for (i, (x, y, w, h)) in enumerate(rects):
+        if not dirty[i]: continue
+        for row in range(y, y + h):
+            offset = row * width + x
+            state[offset:offset + w] = target[offset:offset + w]
+
+# Bits per pixel of a packed tile with %count% colors
+def packedBits(count):
+    return (count - 1).bit_length()
+
+def encodeRle(indices):
+    rle = bytearray()
+    i = 0
+    while i < len(indices):
+        run = 1
+        while (i + run < len(indices) and run < 256 and
+          indices[i + run] == indices[i]):
+            run += 1
+        rle += bytes((run - 1, indices[i]))
+        i += run
+    return bytes((TILE_RLE, )) + bytes(rle)
+
+# The colors of the tile (in order of first use), then each pixel as an
+# index into them, LSB first
+def encodePacked(indices):
+    colors = list(dict.fromkeys(indices))
+    if len(colors) > MAX_PACKED_COLORS: return None
+
+    bits = packedBits(len(colors))
+    lookup = { c: i for (i, c) in enumerate(colors) }
+
+    packed = bytearray((len(indices) * bits + 7) // 8)
+    for (i, index) in enumerate(indices if bits else [ ]):
+        value = lookup[index] << ((i * bits) & 7)
+        packed[(i * bits) >> 3] |= value & 0xff
+        if value > 0xff: packed[((i * bits) >> 3) + 1] |= value >> 8
+
+    return bytes((TILE_PACKED, len(colors) - 1)) + bytes(colors) + bytes(packed)
+
+def encodeTile(indices):
+    options = [ encodeRle(indices), encodePacked(indices),
+      bytes((TILE_RAW, )) + bytes(indices) ]
+    return min((o for o in options if o), key = len)
+
+
+###############################
+# Container
+
+# The frame and its entry's tile field; a frame which would code larger
+# than the raw image is stored as the raw image
+def encodeFrame(rects, dirty, target, width):
+    bitmap = bytearray((len(rects) + 7) // 8)
+    payload = bytearray()
+    for (i, rect) in enumerate(rects):
+        if not dirty[i]: continue
+        bitmap[i >> 3] |= 1 << (i & 7)
+        payload += encodeTile(tileIndices(target, width, rect))
+
+    if len(bitmap) + len(payload) > len(target):
+        return (bytes(target), ENTRY_RAW | len(rects))
+
+    return (bytes(bitmap + payload), sum(dirty))
+
+def encode(frames, width, height, tileSize, durations, threshold):
+    (palette, lookup) = buildPalette(frames)
+    colors = [ expand(c) for c in palette ]
+    indexed = [ [ lookup[c] for c in frame ] for frame in frames ]
+
+    rects = tileRects(width, height, tileSize)
+
+    # Run the cycle until the working buffer at frame 0 settles, so the
+    # keyframe is what looping playback actually shows and the loop
+    # frame stays a small delta
+    keyframe = list(indexed[0])
+    for cycle in range(8):
+        state = list(keyframe)
+        for target in indexed[1:] + [ indexed[0] ]:
+            dirty = diffTiles(rects, state, target, width, colors, threshold)
+            applyTiles(rects, dirty, state, target, width)
+        if state == keyframe: break
+        keyframe = state
+
+    state = list(keyframe)
+    encoded = [ encodeFrame(rects, [ True ] * len(rects), state, width) ]
+
+    for target in indexed[1:] + [ keyframe ]:
+        # The loop frame must restore the keyframe exactly
+        loop = (len(encoded) == len(indexed))
+        dirty = diffTiles(rects, state, target, width, colors,
+          0 if loop else threshold)
+        applyTiles(rects, dirty, state, target, width)
+
+        encoded.append(encodeFrame(rects, dirty, target, width))
+
+    # Replaying the keyframe restores it too, so only keep a loop frame
+    # which is smaller
+    flags = FLAG_LOOP
+    if len(encoded[-1][0]) >= len(encoded[0][0]):
+        encoded.pop()
+        flags = 0
+
+    data = bytearray(MAGIC)
+    data += struct.pack("<HHHBBI", width, height, len(frames), tileSize,
+      flags, 0)
+    data += struct.pack("<256H", *palette)
+
+    offset = HEADER_SIZE + PALETTE_SIZE + len(encoded) * ENTRY_SIZE
+    for (i, (frame, tiles)) in enumerate(encoded):
+        duration = durations[i % len(frames)]
+        data += struct.pack("<IIHH", offset, len(frame), duration, tiles)
+        offset += len(frame)
+
+    for (frame, _) in encoded:
+        data += frame
+
+    return (bytes(data), indexed, colors)
+
+
+###############################
+# Verification
+
+def decode(data):
+    (width, height, frameCount, tileSize, flags, _) = struct.unpack("<HHHBBI",
+      data[4:HEADER_SIZE])
+
+    rects = tileRects(width, height, tileSize)
+    entries = frameCount + (1 if (flags & FLAG_LOOP) else 0)
+
+    state = [ 0 ] * (width * height)
+    result = [ ]
+    for f in range(entries):
+        (offset, length, _, tiles) = struct.unpack("<IIHH",
+          data[HEADER_SIZE + PALETTE_SIZE + f * ENTRY_SIZE:][:ENTRY_SIZE])
+        frame = data[offset:offset + length]
+
+        if tiles & ENTRY_RAW:
+            if length != width * height:
+                raise ValueError("frame %d: bad raw length" % f)
+            state = list(frame)
+            result.append(list(state))
+            continue
+
+        cursor = (len(rects) + 7) // 8
+        for (i, (x, y, w, h)) in enumerate(rects):
+            if not (frame[i >> 3] & (1 << (i & 7))): continue
+
+            mode = frame[cursor]
+            cursor += 1
+            indices = [ ]
+            if mode == TILE_RAW:
+                indices = list(frame[cursor:cursor + w * h])
+                cursor += w * h
+            elif mode == TILE_RLE:
+                while len(indices) < w * h:
+                    indices += [ frame[cursor + 1] ] * (frame[cursor] + 1)
+                    cursor += 2
+            elif mode == TILE_PACKED:
+                count = frame[cursor] + 1
+                colors = frame[cursor + 1:cursor + 1 + count]
+                cursor += 1 + count
+                bits = packedBits(count)
+                for i in range(w * h):
+                    if bits == 0:
+                        indices.append(colors[0])
+                        continue
+                    value = frame[cursor + ((i * bits) >> 3)]
+                    if ((i * bits) & 7) + bits > 8:
+                        value |= frame[cursor + ((i * bits) >> 3) + 1] << 8
+                    value = (value >> ((i * bits) & 7)) & ((1 << bits) - 1)
+                    indices.append(colors[value])
+                cursor += (w * h * bits + 7) // 8
+            else:
+                raise ValueError("frame %d: bad tile mode %d" % (f, mode))
+
+            for row in range(h):
+                offset = (y + row) * width + x
+                state[offset:offset + w] = indices[row * w:(row + 1) * w]
+
+        if cursor != len(frame):
+            raise ValueError("frame %d: trailing data" % f)
+
+        result.append(list(state))
+
+    return result
+
+# The mean and worst per-channel error (of 8-bit channels) of the
+# %decoded% frames against the %source% RGB565 frames
+def sourceError(decoded, source, colors):
+    (total, worst, count) = (0, 0, 0)
+    for (frame, pixels) in zip(decoded, source):
+        for (index, color) in zip(frame, pixels):
+            (a, b) = (colors[index], expand(color))
+            error = max(abs(a[0] - b[0]), abs(a[1] - b[1]), abs(a[2] - b[2]))
+            total += error
+            worst = max(worst, error)
+            count += 1
+    return (total / count, worst)
+
+def verify(data, indexed, colors, width, height, tileSize, threshold):
+    decoded = decode(data)
+    rects = tileRects(width, height, tileSize)
+
+    # The loop frame must bring playback back to the keyframe exactly
+    if len(decoded) > len(indexed) and decoded[-1] != decoded[0]:
+        raise ValueError("loop frame does not restore the keyframe")
+
+    for (f, frame) in enumerate(decoded[:len(indexed)]):
+        worst = 0
+        for rect in rects:
+            a = tileIndices(frame, width, rect)
+            b = tileIndices(indexed[f], width, rect)
+            worst = max(worst, tileError(a, b, colors))
+
+        if worst > threshold:
+            raise ValueError("frame %d: tile error %f exceeds threshold" %
+              (f, worst))
+
+    return decoded
+
+
+###############################
+# Output
+
+def dumpHeader(tag, data, out):
+    guard = "__VIDEO_%s_H__" % tag
+    out.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+    out.write("#ifdef __cplusplus\nextern \"C\" {\n#endif  /* __cplusplus */\n")
+    out.write("#include <stdint.h>\n\n")
+    out.write("const uint8_t video_%s[] = {\n" % tag)
+    for i in range(0, len(data), 16):
+        out.write("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) +
+          ",\n")
+    out.write("};\n\n")
+    out.write("#ifdef __cplusplus\n}\n#endif  /* __cplusplus */\n\n")
+    out.write("#endif  /* %s */\n" % guard)
+
+
+def parseDurations(text):
+    return [ int(d) for d in str(text).split(",") ]
+
+# The width, height and RGB565 frames of the PNGs in %path%, in order
+def loadFrames(path):
+    paths = sorted(glob.glob(os.path.join(path, "*.png")))
+    if len(paths) == 0:
+        raise ValueError("no frames found in %s" % path)
+
+    frames = [ ]
+    (width, height) = (None, None)
+    for framePath in paths:
+        image = pngfile.read(framePath)
+        if width is None:
+            (width, height) = (image.width, image.height)
+        elif (width, height) != (image.width, image.height):
+            raise ValueError("%s: frame size mismatch" % framePath)
+        frames.append([ rgb565(r, g, b) for (r, g, b, _) in image.pixels ])
+
+    return (width, height, frames)
+
+# The size of %count% frames as raw 0x0138 images, as the firmware once
+# stored them
+def keyframeSize(width, height, count):
+    return count * (3 + 256 + (width * height + 1) // 2) * 2
+
+def encodeDirectory(path, durations, tileSize = 8, threshold = 0):
+    """
+    The durations (ms) apply to the frames in order and repeat if there
+    are fewer durations than frames, so GIF-style variable frame delays
+    are supported.
+    """
+
+    (width, height, frames) = loadFrames(path)
+
+    durations = [ durations[i % len(durations)] for i in range(len(frames)) ]
+
+    (data, indexed, colors) = encode(frames, width, height, tileSize,
+      durations, threshold)
+
+    decoded = verify(data, indexed, colors, width, height, tileSize,
+      threshold)
+    (mean, worst) = sourceError(decoded, frames, colors)
+
+    raw = keyframeSize(width, height, len(frames))
+    sys.stderr.write("%s: %d frames, %d bytes (keyframes: %d bytes, %.2fx)\n" %
+      (path, len(frames), len(data), raw, raw / len(data)))
+    sys.stderr.write("%s: error: mean %.2f, worst %d\n" % (path, mean, worst))
+
+    return data
+
+
+def main():
+    parser = argparse.ArgumentParser(description = "Delta-encode video frames")
+    parser.add_argument("frames", help = "directory of PNG frames")
+    parser.add_argument("--tag", required = True, help = "symbol name")
+    parser.add_argument("--duration", type = parseDurations, default = [ 100 ],
+      help = "frame duration (ms); a comma-separated list for per-frame")
+    parser.add_argument("--tile-size", type = int, default = 8)
+    parser.add_argument("--threshold", type = float, default = 0,
+      help = "max mean per-pixel error before a tile is re-sent (lossy; " +
+      "default: only unchanged tiles are skipped)")
+    parser.add_argument("--binary", action = "store_true",
+      help = "emit the raw container instead of a C header")
+    args = parser.parse_args()
+
+    data = encodeDirectory(args.frames, args.duration, args.tile_size,
+      args.threshold)
+
+    if args.binary:
+        sys.stdout.buffer.write(data)
+    else:
+        dumpHeader(args.tag, data, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()